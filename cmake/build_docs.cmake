@@ -1,9 +1,11 @@
 # cmake/build_docs.cmake
 #
-# Builds build/archive/wxWidgetsDocs.zip if it doesn't already exist.
+# Builds build/archive/wxWidgetsDocs.zip if it doesn't already exist, or if its search index was
+# written with a different .kfts version than the one src/helptext/data/ftsrch/types.h declares.
 #
 # Flow:
-#   1. If build/archive/wxWidgetsDocs.zip exists, return immediately.
+#   1. If build/archive/wxWidgetsDocs.zip exists and data/search_index.kfts inside it has the
+#      current KFTS_VERSION, return immediately.
 #   2. Create build/archive/ directory.
 #   3. Configure and build a Release version of tools/build_resources.
 #   4. Run build_resources --parse to generate the zip.
@@ -11,82 +13,58 @@
 # Expected variables from the including scope:
 #   CMAKE_CURRENT_SOURCE_DIR  -- root of the wxUiEditor repository
 #   CMAKE_COMMAND            -- path to the cmake executable
+#   CMAKE_CURRENT_BINARY_DIR -- scratch space for extracting the search index
 
 set(_archive_dir "${CMAKE_CURRENT_SOURCE_DIR}/build/archive")
 set(_zip_file "${_archive_dir}/wxWidgetsDocs.zip")
 
-# Step 0: If the zip already exists, we're done.
+# Step 0: If the zip already exists with a current search index, we're done. The reader only
+# accepts the .kfts versions it knows about, so an older zip would silently lose docs search.
+set(_kfts_types_file "${CMAKE_CURRENT_SOURCE_DIR}/src/helptext/data/ftsrch/types.h")
+set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${_kfts_types_file}")
+file(STRINGS "${_kfts_types_file}" _kfts_version_line REGEX "KFTS_VERSION = [0-9]+")
+string(REGEX MATCH "KFTS_VERSION = ([0-9]+)" _kfts_version_line "${_kfts_version_line}")
+set(_kfts_version "${CMAKE_MATCH_1}")
+
 if(EXISTS "${_zip_file}")
-    message(STATUS "wxWidgetsDocs.zip already exists at ${_zip_file}")
-    return()
-endif()
+    set(_kfts_extract_dir "${CMAKE_CURRENT_BINARY_DIR}/kfts_version_check")
+    file(REMOVE_RECURSE "${_kfts_extract_dir}")
+    file(MAKE_DIRECTORY "${_kfts_extract_dir}")
 
-# Step 1: Create the archive directory.
-file(MAKE_DIRECTORY "${_archive_dir}")
+    # A zip without a search index fails here and is treated as stale below
+    execute_process(
+        COMMAND "${CMAKE_COMMAND}" -E tar xf "${_zip_file}" "data/search_index.kfts"
+        WORKING_DIRECTORY "${_kfts_extract_dir}"
+        OUTPUT_QUIET
+        ERROR_QUIET
+    )
+    set(_kfts_file "${_kfts_extract_dir}/data/search_index.kfts")
 
-# Step 2: Configure and build a Release version of tools/build_resources.
-# This is a standalone CMake project -- invoked as a separate process to avoid
-# target-name collisions (miniz, snowball_stemmer, etc.) with the parent project.
-set(_br_src_dir "${CMAKE_CURRENT_SOURCE_DIR}/tools/build_resources")
-set(_br_build_dir "${_br_src_dir}/build")
+    # The version is the little-endian uint32 that follows the "KFTS" signature
+    set(_zip_kfts_version "none")
+    if(EXISTS "${_kfts_file}")
+        file(READ "${_kfts_file}" _kfts_header LIMIT 8 HEX)
+        if(_kfts_header MATCHES "^4b465453(..)(..)(..)(..)$")
+            math(EXPR _zip_kfts_version
+                "0x${CMAKE_MATCH_4}${CMAKE_MATCH_3}${CMAKE_MATCH_2}${CMAKE_MATCH_1}")
+        endif()
+    endif()
+    file(REMOVE_RECURSE "${_kfts_extract_dir}")
 
-message(STATUS "Configuring build_resources (Release)...")
-execute_process(
-    COMMAND "${CMAKE_COMMAND}"
-        -B "${_br_build_dir}"
-        -S "${_br_src_dir}"
-        -DCMAKE_BUILD_TYPE=Release
-        "-DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}"
-        "-DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}"
-    RESULT_VARIABLE _configure_result
-    OUTPUT_VARIABLE _configure_output
-    ERROR_VARIABLE _configure_error
-    OUTPUT_STRIP_TRAILING_WHITESPACE
-    ERROR_STRIP_TRAILING_WHITESPACE
-)
-if(NOT _configure_result EQUAL 0)
-    message(FATAL_ERROR
-        "Failed to configure build_resources (exit code ${_configure_result}).\n"
-        "stdout:\n${_configure_output}\n"
-        "stderr:\n${_configure_error}")
+    if(_zip_kfts_version STREQUAL _kfts_version)
+        message(STATUS "wxWidgetsDocs.zip already exists at ${_zip_file}")
+        return()
+    endif()
+    message(STATUS "wxWidgetsDocs.zip search index version is ${_zip_kfts_version}, "
+        "expected ${_kfts_version} -- regenerating")
+    file(REMOVE "${_zip_file}")
 endif()
 
-message(STATUS "Building build_resources (Release)...")
-execute_process(
-    COMMAND "${CMAKE_COMMAND}"
-        --build "${_br_build_dir}"
-        --config Release
-    RESULT_VARIABLE _build_result
-    OUTPUT_VARIABLE _build_output
-    ERROR_VARIABLE _build_error
-    OUTPUT_STRIP_TRAILING_WHITESPACE
-    ERROR_STRIP_TRAILING_WHITESPACE
-)
-if(NOT _build_result EQUAL 0)
-    message(FATAL_ERROR
-        "Failed to build build_resources (exit code ${_build_result}).\n"
-        "stdout:\n${_build_output}\n"
-        "stderr:\n${_build_error}")
-endif()
+# Step 1: Create the archive directory.
+file(MAKE_DIRECTORY "${_archive_dir}")
 
-# Locate the built executable. CMakeLists.txt sets CMAKE_RUNTIME_OUTPUT_DIRECTORY
-# to ${CMAKE_SOURCE_DIR}/../../bin, so the executable lands in <repo>/bin/ (or
-# bin/Release/ for multi-config). Fall back to the build dir for older builds.
-set(_br_exe "")
-foreach(_candidate
-    "${CMAKE_CURRENT_SOURCE_DIR}/bin/Release/build_resources${CMAKE_EXECUTABLE_SUFFIX}"
-    "${CMAKE_CURRENT_SOURCE_DIR}/bin/build_resources${CMAKE_EXECUTABLE_SUFFIX}"
-    "${_br_build_dir}/Release/build_resources${CMAKE_EXECUTABLE_SUFFIX}"
-    "${_br_build_dir}/build_resources${CMAKE_EXECUTABLE_SUFFIX}"
-)
-    if(EXISTS "${_candidate}")
-        set(_br_exe "${_candidate}")
-        break()
-    endif()
-endforeach()
-if(_br_exe STREQUAL "")
-    message(FATAL_ERROR "Could not locate build_resources executable in ${_br_build_dir}")
-endif()
+# Step 2: Configure and build a Release version of tools/build_resources.
+include("${CMAKE_CURRENT_LIST_DIR}/build_resources_exe.cmake")
 
 # Step 3: Run build_resources --parse to generate the zip.
 set(_interface_wx "${_br_build_dir}/_deps/interface-src/wx")
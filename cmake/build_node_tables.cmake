@@ -0,0 +1,70 @@
+# cmake/build_node_tables.cmake
+#
+# Regenerates src/nodes/node_tables.cpp from the XML files in src/xml/ whenever their contents no
+# longer match the hash recorded in node_tables.cpp. The generated file is committed along with
+# its hash, so a fresh clone (or an XML file that was only touched) never needs to run
+# build_resources -- only an actual change to an XML file does.
+#
+# Flow:
+#   1. Add every XML file as a configure dependency so that editing one re-runs CMake.
+#   2. Hash the names and contents of the XML files. If node_tables.cpp records the same hash,
+#      return immediately.
+#   3. Configure and build a Release version of tools/build_resources.
+#   4. Run build_resources --node-tables to regenerate node_tables.cpp with the new hash.
+#      build_resources fails if an XML file isn't in its list of files.
+#
+# Expected variables from the including scope:
+#   CMAKE_CURRENT_SOURCE_DIR  -- root of the wxUiEditor repository
+#   CMAKE_COMMAND            -- path to the cmake executable
+
+set(_node_tables_xml_dir "${CMAKE_CURRENT_SOURCE_DIR}/src/xml")
+set(_node_tables_file "${CMAKE_CURRENT_SOURCE_DIR}/src/nodes/node_tables.cpp")
+
+# Step 1: Re-run CMake whenever an XML file changes.
+file(GLOB _node_tables_xml_files "${_node_tables_xml_dir}/*.xml")
+list(SORT _node_tables_xml_files)
+set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${_node_tables_xml_files})
+
+# Step 2: Compare content hashes. Each file contributes a "name sha256" line, so adding,
+# removing or renaming a file changes the hash as well.
+set(_node_tables_digest "")
+foreach(_xml_file ${_node_tables_xml_files})
+    get_filename_component(_xml_name "${_xml_file}" NAME)
+    file(SHA256 "${_xml_file}" _xml_hash)
+    string(APPEND _node_tables_digest "${_xml_name} ${_xml_hash}\n")
+endforeach()
+string(SHA256 _node_tables_hash "${_node_tables_digest}")
+
+set(_node_tables_recorded_hash "")
+if(EXISTS "${_node_tables_file}")
+    file(STRINGS "${_node_tables_file}" _node_tables_hash_line
+        LIMIT_COUNT 10 REGEX "^// xml-sha256: [0-9a-f]+$")
+    string(REPLACE "// xml-sha256: " "" _node_tables_recorded_hash "${_node_tables_hash_line}")
+endif()
+if(_node_tables_recorded_hash STREQUAL _node_tables_hash)
+    return()
+endif()
+
+# Step 3: Configure and build a Release version of tools/build_resources.
+include("${CMAKE_CURRENT_LIST_DIR}/build_resources_exe.cmake")
+
+# Step 4: Regenerate the tables.
+message(STATUS "Generating src/nodes/node_tables.cpp via build_resources...")
+execute_process(
+    COMMAND "${_br_exe}"
+        --node-tables "${_node_tables_file}"
+        --srcdir "${_node_tables_xml_dir}"
+        --xml-hash "${_node_tables_hash}"
+    RESULT_VARIABLE _node_tables_result
+    OUTPUT_VARIABLE _node_tables_output
+    ERROR_VARIABLE _node_tables_error
+    OUTPUT_STRIP_TRAILING_WHITESPACE
+    ERROR_STRIP_TRAILING_WHITESPACE
+)
+if(NOT _node_tables_result EQUAL 0)
+    message(FATAL_ERROR
+        "build_resources --node-tables failed (exit code ${_node_tables_result}).\n"
+        "stdout:\n${_node_tables_output}\n"
+        "stderr:\n${_node_tables_error}")
+endif()
+message(STATUS "${_node_tables_output}")
@@ -0,0 +1,76 @@
+# cmake/build_resources_exe.cmake
+#
+# Configures and builds a Release version of tools/build_resources, then sets _br_exe to the
+# path of the executable and _br_build_dir to its build directory. Including this more than once
+# during the same configure only builds the tool once.
+#
+# Expected variables from the including scope:
+#   CMAKE_CURRENT_SOURCE_DIR  -- root of the wxUiEditor repository
+#   CMAKE_COMMAND            -- path to the cmake executable
+
+if(DEFINED _br_exe AND EXISTS "${_br_exe}")
+    return()
+endif()
+
+# This is a standalone CMake project -- invoked as a separate process to avoid
+# target-name collisions (miniz, snowball_stemmer, etc.) with the parent project.
+set(_br_src_dir "${CMAKE_CURRENT_SOURCE_DIR}/tools/build_resources")
+set(_br_build_dir "${_br_src_dir}/build")
+
+message(STATUS "Configuring build_resources (Release)...")
+execute_process(
+    COMMAND "${CMAKE_COMMAND}"
+        -B "${_br_build_dir}"
+        -S "${_br_src_dir}"
+        -DCMAKE_BUILD_TYPE=Release
+        "-DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}"
+        "-DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}"
+    RESULT_VARIABLE _configure_result
+    OUTPUT_VARIABLE _configure_output
+    ERROR_VARIABLE _configure_error
+    OUTPUT_STRIP_TRAILING_WHITESPACE
+    ERROR_STRIP_TRAILING_WHITESPACE
+)
+if(NOT _configure_result EQUAL 0)
+    message(FATAL_ERROR
+        "Failed to configure build_resources (exit code ${_configure_result}).\n"
+        "stdout:\n${_configure_output}\n"
+        "stderr:\n${_configure_error}")
+endif()
+
+message(STATUS "Building build_resources (Release)...")
+execute_process(
+    COMMAND "${CMAKE_COMMAND}"
+        --build "${_br_build_dir}"
+        --config Release
+    RESULT_VARIABLE _build_result
+    OUTPUT_VARIABLE _build_output
+    ERROR_VARIABLE _build_error
+    OUTPUT_STRIP_TRAILING_WHITESPACE
+    ERROR_STRIP_TRAILING_WHITESPACE
+)
+if(NOT _build_result EQUAL 0)
+    message(FATAL_ERROR
+        "Failed to build build_resources (exit code ${_build_result}).\n"
+        "stdout:\n${_build_output}\n"
+        "stderr:\n${_build_error}")
+endif()
+
+# Locate the built executable. CMakeLists.txt sets CMAKE_RUNTIME_OUTPUT_DIRECTORY
+# to ${CMAKE_SOURCE_DIR}/../../bin, so the executable lands in <repo>/bin/ (or
+# bin/Release/ for multi-config). Fall back to the build dir for older builds.
+set(_br_exe "")
+foreach(_candidate
+    "${CMAKE_CURRENT_SOURCE_DIR}/bin/Release/build_resources${CMAKE_EXECUTABLE_SUFFIX}"
+    "${CMAKE_CURRENT_SOURCE_DIR}/bin/build_resources${CMAKE_EXECUTABLE_SUFFIX}"
+    "${_br_build_dir}/Release/build_resources${CMAKE_EXECUTABLE_SUFFIX}"
+    "${_br_build_dir}/build_resources${CMAKE_EXECUTABLE_SUFFIX}"
+)
+    if(EXISTS "${_candidate}")
+        set(_br_exe "${_candidate}")
+        break()
+    endif()
+endforeach()
+if(_br_exe STREQUAL "")
+    message(FATAL_ERROR "Could not locate build_resources executable in ${_br_build_dir}")
+endif()
@@ -314,13 +314,16 @@ set( file_list
 
     # ############################ Nodes ##############################
     src/nodes/node.cpp                   # Contains user-modifiable node
+    src/nodes/node_arena.cpp             # Monotonic arena for Node allocations
     src/nodes/node_constants.cpp         # Maps wxWidgets constants to their numerical value
     src/nodes/node_creator.cpp           # Class used to create nodes
     src/nodes/node_decl.cpp              # Contains the declarations for a node (properties, events, etc.)
     src/nodes/node_gridbag.cpp           # Create and modify a node containing a wxGridBagSizer
     src/nodes/node_init.cpp              # Initialize NodeCreator class
     src/nodes/node_prop.cpp              # NodeProperty class
+    src/nodes/node_tables.cpp            # (generated) Node declaration tables from src/xml/*.xml
     src/nodes/tool_creator.cpp           # Functions for creating new nodes from Ribbon Panel
+    src/nodes/unique_names.cpp           # Index of the variable names and property grid labels in use
 
     # ############################ Panels ##############################
     src/panels/base_panel.cpp         # Code generation panel
@@ -331,6 +334,7 @@ set( file_list
     src/panels/navpopupmenu.cpp        # Context-menu for Navigation panel
     src/panels/propgrid_create.cpp     # PropGridPanel Create functions
     src/panels/propgrid_events.cpp     # PropGridPanel event handlers
+    src/panels/propgrid_layout.cpp     # PropGridPanel cache of grid layouts
     src/panels/propgrid_modify.cpp     # PropGridPanel modification functions
     src/panels/propgrid_panel.cpp      # Property panel
     src/panels/cstm_propgrid.cpp       # Derived wxPropertyGrid class
@@ -342,6 +346,8 @@ set( file_list
     # Project classes
     src/project/data_handler.cpp           # DataHandler class
     src/project/embed_image.cpp            # class to manage images stored in the generated code
+    src/project/image_cache.cpp            # Persistent cache of encoded embedded images
+    src/project/image_encoder.cpp          # Decode and compress image files for EmbeddedImage
     src/project/image_handler.cpp          # ProjectImage class
     src/project/loadproject.cpp            # Load wxUiEditor project
     src/project/project_handler.cpp        # ProjectHandler class
@@ -350,6 +356,7 @@ set( file_list
     src/utils/dlg_msgs.cpp                 # wxMessageDialog dialogs
     src/utils/font_prop.cpp                # FontProperty class
     src/utils/set_stc_colors.cpp           # Contains function for initializing wxStyledTextCtrl colors
+    src/utils/task_pool.cpp                # Shared pool of worker threads for background tasks
     src/utils/utils.cpp                    # Utility functions that work with properties
 
     # Testing
@@ -6,6 +6,8 @@
 /////////////////////////////////////////////////////////////////////////////
 // CR: [07-12-2026]
 
+#include <algorithm>
+
 #include <wx/wupdlock.h>  // wxWindowUpdateLocker prevents window redrawing
 
 #include "cstm_event.h"
@@ -31,6 +33,9 @@ wxDEFINE_EVENT(EVT_MultiPropChange, CustomEvent);
 
 wxDEFINE_EVENT(EVT_GridBagAction, CustomEvent);
 
+// How long EVT_NodePropChange events are held for handlers passed to DeferPropChangeEvents()
+constexpr int PROP_CHANGE_DELAY_MS = 100;
+
 void MainFrame::FireProjectLoadedEvent()
 {
     // The Project loaded event can be fired even if just the language is changed which can cause
@@ -40,6 +45,9 @@ void MainFrame::FireProjectLoadedEvent()
 
     wxWindowUpdateLocker const freeze(this);
 
+    // Every handler rebuilds everything for the new project
+    DiscardPropChangeEvents();
+
     ProjectLoaded();
 
     CustomEvent event(EVT_ProjectUpdated, Project.get_ProjectNode());
@@ -59,6 +67,8 @@ void MainFrame::FireProjectLoadedEvent()
 
 void MainFrame::FireSelectedEvent(Node* node, size_t flags)
 {
+    FlushPropChangeEvents();
+
     CustomEvent node_event(EVT_NodeSelected, node);
 
     const auto handlers = m_custom_event_handlers;
@@ -80,6 +90,8 @@ void MainFrame::FireSelectedEvent(Node* node, size_t flags)
 
 void MainFrame::FireCreatedEvent(Node* node)
 {
+    FlushPropChangeEvents();
+
     CustomEvent node_event(EVT_NodeCreated, node);
     const auto handlers = m_custom_event_handlers;
     for (auto* handler: handlers)
@@ -91,6 +103,8 @@ void MainFrame::FireCreatedEvent(Node* node)
 
 void MainFrame::FireDeletedEvent(Node* node)
 {
+    FlushPropChangeEvents();
+
     CustomEvent node_event(EVT_NodeDeleted, node);
     const auto handlers = m_custom_event_handlers;
     for (auto* handler: handlers)
@@ -106,13 +120,90 @@ void MainFrame::FirePropChangeEvent(NodeProperty* prop)
     const auto handlers = m_custom_event_handlers;
     for (auto* handler: handlers)
     {
-        handler->ProcessEvent(node_event);
+        if (std::ranges::find(m_deferred_prop_handlers, handler) == m_deferred_prop_handlers.end())
+        {
+            handler->ProcessEvent(node_event);
+        }
+    }
+
+    if (!m_deferred_prop_handlers.empty())
+    {
+        if (!std::ranges::any_of(m_pending_prop_changes,
+                                 [prop](const auto& pending)
+                                 {
+                                     return pending.second == prop;
+                                 }))
+        {
+            m_pending_prop_changes.emplace_back(prop->getNode()->get_SharedPtr(), prop);
+        }
+
+        // The timer is not restarted by later changes, so a user who keeps typing still sees
+        // updates every PROP_CHANGE_DELAY_MS.
+        if (!m_prop_change_timer.IsRunning())
+        {
+            std::ignore = m_prop_change_timer.StartOnce(PROP_CHANGE_DELAY_MS);
+        }
     }
     UpdateWakaTime();
 }
 
+void MainFrame::DeferPropChangeEvents(wxEvtHandler* handler)
+{
+    m_deferred_prop_handlers.push_back(handler);
+}
+
+void MainFrame::FlushPropChangeEvents()
+{
+    m_prop_change_timer.Stop();
+    if (m_pending_prop_changes.empty())
+    {
+        return;
+    }
+
+    // A handler could change another property, so take ownership of the current list first
+    const auto pending = std::move(m_pending_prop_changes);
+    m_pending_prop_changes.clear();
+
+    // The panel the user is looking at gets updated first. Every handler in the list is still
+    // registered, so it is safe to check whether its window is visible.
+    auto handlers = m_deferred_prop_handlers;
+    std::ranges::stable_partition(handlers,
+                                  [](wxEvtHandler* handler)
+                                  {
+                                      auto* window = wxDynamicCast(handler, wxWindow);
+                                      return window && window->IsShownOnScreen();
+                                  });
+
+    for (auto* handler: handlers)
+    {
+        // The handler may have been removed by a previous handler
+        if (std::ranges::find(m_deferred_prop_handlers, handler) == m_deferred_prop_handlers.end())
+        {
+            continue;
+        }
+        for (const auto& [node, prop]: pending)
+        {
+            CustomEvent node_event(EVT_NodePropChange, prop);
+            handler->ProcessEvent(node_event);
+        }
+    }
+}
+
+void MainFrame::DiscardPropChangeEvents()
+{
+    m_prop_change_timer.Stop();
+    m_pending_prop_changes.clear();
+}
+
+void MainFrame::OnPropChangeTimer(wxTimerEvent& /* event unused */)
+{
+    FlushPropChangeEvents();
+}
+
 void MainFrame::FireMultiPropEvent(ModifyProperties* undo_cmd)
 {
+    FlushPropChangeEvents();
+
     CustomEvent node_event(EVT_MultiPropChange, undo_cmd);
     const auto handlers = m_custom_event_handlers;
     for (auto* handler: handlers)
@@ -124,6 +215,9 @@ void MainFrame::FireMultiPropEvent(ModifyProperties* undo_cmd)
 
 void MainFrame::FireProjectUpdatedEvent()
 {
+    // Every handler rebuilds everything when the project is updated
+    DiscardPropChangeEvents();
+
     CustomEvent event(EVT_ProjectUpdated, Project.get_ProjectNode());
     const auto handlers = m_custom_event_handlers;
     for (auto* handler: handlers)
@@ -134,6 +228,8 @@ void MainFrame::FireProjectUpdatedEvent()
 
 void MainFrame::FireChangeEventHandler(NodeEvent* evt_node)
 {
+    FlushPropChangeEvents();
+
     CustomEvent event(EVT_EventHandlerChanged, evt_node);
     const auto handlers = m_custom_event_handlers;
     for (auto* handler: handlers)
@@ -144,6 +240,8 @@ void MainFrame::FireChangeEventHandler(NodeEvent* evt_node)
 
 void MainFrame::FireParentChangedEvent(ChangeParentAction* undo_cmd)
 {
+    FlushPropChangeEvents();
+
     CustomEvent event(EVT_ParentChanged, undo_cmd);
     const auto handlers = m_custom_event_handlers;
     for (auto* handler: handlers)
@@ -155,6 +253,8 @@ void MainFrame::FireParentChangedEvent(ChangeParentAction* undo_cmd)
 
 void MainFrame::FirePositionChangedEvent(ChangePositionAction* undo_cmd)
 {
+    FlushPropChangeEvents();
+
     CustomEvent event(EVT_PositionChanged, undo_cmd);
     const auto handlers = m_custom_event_handlers;
     for (auto* handler: handlers)
@@ -166,6 +266,8 @@ void MainFrame::FirePositionChangedEvent(ChangePositionAction* undo_cmd)
 
 void MainFrame::FireGridBagActionEvent(GridBagAction* undo_cmd)
 {
+    FlushPropChangeEvents();
+
     CustomEvent event(EVT_GridBagAction, undo_cmd);
     const auto handlers = m_custom_event_handlers;
     for (auto* handler: handlers)
@@ -38,6 +38,9 @@ public:
         return new EventStringDialogAdapter(m_event);
     }
 
+    // Used when a cached event grid is reused for a different node
+    void SetNodeEvent(NodeEvent* event) { m_event = event; }
+
 private:
     NodeEvent* m_event;
 };
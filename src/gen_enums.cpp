@@ -9,6 +9,12 @@
 // project file. When wxUiEditor is first initialized, the regular maps will be read and used to
 // initialize the rmaps.
 
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
 #include "gen_enums.h"
 
 using namespace GenEnum;
@@ -571,6 +577,123 @@ const std::map<GenEnum::PropName, std::string_view> GenEnum::map_PropNames = {
 };
 std::map<std::string_view, GenEnum::PropName, std::less<>> GenEnum::rmap_PropNames {};
 
+namespace
+{
+    // Hash-and-displace: every name is first hashed into a bucket, and each bucket stores the
+    // seed that moves all of its names into empty slots of s_prop_slots. Buckets are placed
+    // largest first, which is what makes it possible to find a seed for every bucket.
+
+    struct PropSlot
+    {
+        std::string_view name;
+        PropName prop { prop_unknown };
+    };
+
+    std::vector<std::uint32_t> s_bucket_seeds;
+    std::vector<PropSlot> s_prop_slots;
+
+    constexpr auto HashPropName(std::string_view name) -> std::uint64_t
+    {
+        std::uint64_t hash = 14695981039346656037ULL;  // FNV-1a
+        for (const auto chr: name)
+        {
+            hash ^= static_cast<unsigned char>(chr);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    constexpr auto SlotIndex(std::uint64_t hash, std::uint32_t seed, size_t mask) -> size_t
+    {
+        hash ^= seed * 0x9E3779B97F4A7C15ULL;  // splitmix64 finalizer
+        hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+        return static_cast<size_t>(hash ^ (hash >> 31)) & mask;
+    }
+}  // namespace
+
+void GenEnum::InitPropNameHash()
+{
+    const size_t bucket_count = std::bit_ceil(std::max<size_t>(map_PropNames.size() / 4, 1));
+    const size_t slot_count = std::bit_ceil(map_PropNames.size() * 2);
+
+    struct HashedName
+    {
+        std::uint64_t hash;
+        PropSlot slot;
+    };
+    std::vector<std::vector<HashedName>> buckets(bucket_count);
+    for (const auto& [prop, name]: map_PropNames)
+    {
+        const auto hash = HashPropName(name);
+        buckets[hash & (bucket_count - 1)].push_back({ hash, { name, prop } });
+    }
+
+    std::vector<size_t> order(bucket_count);
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::stable_sort(order,
+                             [&buckets](size_t lhs, size_t rhs)
+                             {
+                                 return buckets[lhs].size() > buckets[rhs].size();
+                             });
+
+    s_bucket_seeds.assign(bucket_count, 0);
+    s_prop_slots.assign(slot_count, {});
+    std::vector<bool> used(slot_count, false);
+    std::vector<size_t> placed;
+
+    for (const auto bucket_index: order)
+    {
+        const auto& bucket = buckets[bucket_index];
+        if (bucket.empty())
+        {
+            break;
+        }
+        for (std::uint32_t seed = 1;; ++seed)
+        {
+            placed.clear();
+            for (const auto& entry: bucket)
+            {
+                const auto slot = SlotIndex(entry.hash, seed, slot_count - 1);
+                if (used[slot] || std::ranges::find(placed, slot) != placed.end())
+                {
+                    break;
+                }
+                placed.push_back(slot);
+            }
+            if (placed.size() != bucket.size())
+            {
+                continue;
+            }
+
+            s_bucket_seeds[bucket_index] = seed;
+            for (size_t idx = 0; idx < bucket.size(); ++idx)
+            {
+                used[placed[idx]] = true;
+                s_prop_slots[placed[idx]] = bucket[idx].slot;
+            }
+            break;
+        }
+    }
+}
+
+auto GenEnum::LookupPropName(std::string_view name) -> PropName
+{
+    if (s_bucket_seeds.empty())
+    {
+        return FindProp(name);
+    }
+
+    const auto hash = HashPropName(name);
+    const auto seed = s_bucket_seeds[hash & (s_bucket_seeds.size() - 1)];
+    if (const auto& slot = s_prop_slots[SlotIndex(hash, seed, s_prop_slots.size() - 1)];
+        slot.name == name)
+    {
+        return slot.prop;
+    }
+    return prop_unknown;
+}
+
 const std::map<GenType, std::string_view> GenEnum::map_GenTypes = {
 
     { type_aui_tool, "aui_tool" },
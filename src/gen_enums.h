@@ -612,6 +612,14 @@ namespace GenEnum
         return prop_unknown;
     }
 
+    // Builds a minimal perfect hash of every name in map_PropNames. Called once by
+    // NodeCreator::Initialize() after rmap_PropNames has been filled in.
+    void InitPropNameHash();
+
+    // Same result as FindProp(), but a lookup only hashes the name once and then does a single
+    // string comparison. The project loader uses this for every attribute it reads.
+    [[nodiscard]] auto LookupPropName(std::string_view name) -> PropName;
+
     // Given a prop_ name, this will return the actual string used in the XRC file.
     inline std::optional<wxue::string_view> GetPropStringName(PropName prop_name)
     {
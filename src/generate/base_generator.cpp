@@ -699,35 +699,40 @@ bool BaseGenerator::VerifyProperty(NodeProperty* prop)
 
     if (prop->isProp(prop_alignment))
     {
-        wxue::string* value = prop->as_raw_ptr();
-        if (value->contains("wxALIGN_LEFT") &&
-            (value->contains("wxALIGN_RIGHT") || value->contains("wxALIGN_CENTER_HORIZONTAL")))
+        // The value is read from the pool, and only copied if a flag actually has to be removed
+        auto contains = [prop](std::string_view flag)
         {
-            std::ignore = value->Replace("wxALIGN_LEFT|", "");
+            return prop->as_string().contains(flag);
+        };
+        auto remove = [&](std::string_view flag)
+        {
+            std::ignore = prop->get_value().Replace(flag, "");
             result = true;
+        };
+
+        if (contains("wxALIGN_LEFT") &&
+            (contains("wxALIGN_RIGHT") || contains("wxALIGN_CENTER_HORIZONTAL")))
+        {
+            remove("wxALIGN_LEFT|");
         }
-        if (value->contains("wxALIGN_TOP") &&
-            (value->contains("wxALIGN_BOTTOM") || value->contains("wxALIGN_CENTER_VERTICAL")))
+        if (contains("wxALIGN_TOP") &&
+            (contains("wxALIGN_BOTTOM") || contains("wxALIGN_CENTER_VERTICAL")))
         {
-            std::ignore = value->Replace("wxALIGN_TOP|", "");
-            result = true;
+            remove("wxALIGN_TOP|");
         }
-        if (value->contains("wxALIGN_RIGHT") && value->contains("wxALIGN_CENTER_HORIZONTAL"))
+        if (contains("wxALIGN_RIGHT") && contains("wxALIGN_CENTER_HORIZONTAL"))
         {
-            std::ignore = value->Replace("wxALIGN_RIGHT|", "");
-            result = true;
+            remove("wxALIGN_RIGHT|");
         }
-        if (value->contains("wxALIGN_BOTTOM") && value->contains("wxALIGN_CENTER_VERTICAL"))
+        if (contains("wxALIGN_BOTTOM") && contains("wxALIGN_CENTER_VERTICAL"))
         {
-            std::ignore = value->Replace("wxALIGN_BOTTOM|", "");
-            result = true;
+            remove("wxALIGN_BOTTOM|");
         }
 
         // wxALIGN_CENTER can't be combined with anything
-        if (value->contains("wxALIGN_CENTER|"))
+        if (contains("wxALIGN_CENTER|"))
         {
-            std::ignore = value->Replace("wxALIGN_CENTER|", "");
-            result = true;
+            remove("wxALIGN_CENTER|");
         }
     }
 
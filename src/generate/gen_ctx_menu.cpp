@@ -42,11 +42,11 @@ static void GenCtxConstruction(Code& code)
 void CtxMenuGenerator::CollectCtxMenuEventHandlers(Node* node, std::vector<NodeEvent*>& events)
 {
     ASSERT(node);
-    for (auto& iter: node->get_MapEvents())
+    for (auto& iter: node->get_Events())
     {
-        if (iter.second.get_value().size())
+        if (iter.get_value().size())
         {
-            events.push_back(&iter.second);
+            events.push_back(&iter);
         }
     }
 
@@ -6,11 +6,15 @@
 /////////////////////////////////////////////////////////////////////////////
 // CR: [06-30-2026]
 
-#include <cstring>  // for std::memcmp
+#include <algorithm>  // for std::ranges::move
+#include <atomic>     // for std::atomic
+#include <cstring>    // for std::memcmp
 #include <format>
 #include <future>    // for std::async, std::future
+#include <iterator>  // for std::back_inserter
 #include <memory>    // for std::shared_ptr, std::make_shared
 #include <optional>  // for std::optional
+#include <thread>    // for std::jthread
 #include <utility>   // std::to_underlying
 
 #include <wx/file.h>     // wxFile - raw file I/O
@@ -22,6 +26,7 @@
 #include "../tools/compare/diff.h"  // Diff -- Compare for file diffs
 #include "file_codewriter.h"        // FileCodeWriter -- Write code to disk with test mode support
 #include "gen_common.h"             // GeneratorLibrary
+#include "image_handler.h"          // ProjectImages
 #include "mainapp.h"                // wxGetApp()
 #include "mainframe.h"              // MainFrame -- Main window frame
 #include "node.h"                   // Node class
@@ -40,6 +45,7 @@
 #include "gen_ruby.h"        // RubyCodeGenerator -- Generate wxRuby code
 #include "gen_typescript.h"  // TypeScriptCodeGenerator -- Generate TypeScript code
 #include "gen_xrc.h"         // XrcCodeGenerator -- Generate XRC code
+#include "task_pool.h"       // BackgroundTasks -- shared background task pool
 #include "write_code.h"      // WriteCode -- Write code to a string
 
 void GenResults::SetNodes(Node* startNode)
@@ -383,6 +389,7 @@ void GenResults::StartClock()
     }
     m_start_time = std::chrono::steady_clock::now();
     m_clock_started = true;
+    BackgroundTasks.ResetTimings();
 }
 
 void GenResults::EndClock()
@@ -392,6 +399,17 @@ void GenResults::EndClock()
         std::chrono::duration_cast<std::chrono::milliseconds>(end_time - m_start_time).count();
     m_msgs.emplace_back(std::format("Elapsed time: {} milliseconds", m_elapsed));
     m_clock_started = false;
+
+    if (wxGetApp().isVerboseCodeGen())
+    {
+        for (const auto& timing: BackgroundTasks.GetTimings())
+        {
+            m_msgs.emplace_back(std::format(
+                "{}: {} tasks, {} ms total, {} ms longest", timing.name, timing.count,
+                std::chrono::duration_cast<std::chrono::milliseconds>(timing.total).count(),
+                std::chrono::duration_cast<std::chrono::milliseconds>(timing.longest).count()));
+        }
+    }
 }
 
 void GenResults::Clear()
@@ -425,7 +443,9 @@ void GenResults::EnableProgressDialog(const wxString& title)
 }
 
 constexpr int progress_forms_step = 50;
-constexpr size_t max_diff_file_size = (100 * 1024);  // 102,400 bytes
+// Diff::Compare() uses linear memory, so the only limit is the largest file that
+// wxue::ViewVector::ReadFile() will read (100 MB).
+constexpr size_t max_diff_file_size = (100 * 1024 * 1024);
 
 bool GenResults::GenerateLanguageFiles(GenLang language, bool comparison_only)
 {
@@ -474,6 +494,12 @@ bool GenResults::GenerateLanguageFiles(GenLang language, bool comparison_only)
             // requested to. XRC generation is so fast, that we should be able to handle
             // extremely large projects without it.
 
+            if (UseConcurrentForms(forms.size()))
+            {
+                generate_result = GenerateFormsConcurrently(forms, comparison_only);
+                forms.clear();  // Skip the serial loop below
+            }
+
             for (auto* form: forms)
             {
                 // CR: 448: Inconsistent result tracking - checking GetUpdatedFiles().size() instead
@@ -521,6 +547,12 @@ bool GenResults::GenerateLanguageFiles(GenLang language, bool comparison_only)
             max_progress += static_cast<int>(forms.size() / progress_forms_step);
         }
 
+        if (UseConcurrentForms(forms.size()))
+        {
+            generate_result = GenerateFormsConcurrently(forms, comparison_only);
+            forms.clear();  // Skip the progress dialog and the serial loop below
+        }
+
         std::optional<wxProgressDialog> progress;
         if (m_show_progress && !forms.empty())
         {
@@ -695,8 +727,11 @@ bool GenResults::GenerateLanguageForm(std::string_view /* class_name */, Node* f
                "GenerateLanguageForm expects a single non-C++ language");
     code_generator->GenerateClass(m_languages);
 
-    const int write_flags =
-        comparison_only ? (code::flag_test_only | code::flag_no_ui) : code::flag_none;
+    int write_flags = comparison_only ? (code::flag_test_only | code::flag_no_ui) : code::flag_none;
+    if (m_is_form_worker)
+    {
+        write_flags |= code::flag_no_ui;  // Worker threads must never display a dialog
+    }
 
     // Check if file exists before writing (to distinguish created vs updated)
     const bool file_existed = src_path.file_exists();
@@ -799,6 +834,10 @@ bool GenResults::GenerateCppForm(Node* form, bool comparison_only, wxProgressDia
 
     bool any_updated = false;
     int write_flags = comparison_only ? (code::flag_test_only | code::flag_no_ui) : code::flag_none;
+    if (m_is_form_worker)
+    {
+        write_flags |= code::flag_no_ui;  // Worker threads must never display a dialog
+    }
 
     // Check if files exist before writing (to distinguish created vs updated)
     const bool hdr_existed = hdr_path.file_exists();
@@ -986,6 +1025,12 @@ bool GenResults::GenerateCppFiles(bool comparison_only)
     }
 
     bool generate_result = false;
+    if (UseConcurrentForms(forms.size()))
+    {
+        generate_result = GenerateFormsConcurrently(forms, comparison_only);
+        forms.clear();  // Skip the serial loop below
+    }
+
     int progress_count = 0;
     for (const auto& form: forms)
     {
@@ -1010,6 +1055,88 @@ bool GenResults::GenerateCppFiles(bool comparison_only)
     return generate_result;
 }
 
+auto GenResults::UseConcurrentForms(size_t form_count) const -> bool
+{
+    // The progress dialog and any directory-creation prompts must run on the main thread, so
+    // concurrent generation is limited to command-line generation.
+    return m_jobs != 1 && form_count > 1 && wxGetApp().is_Generating();
+}
+
+bool GenResults::GenerateFormsConcurrently(const std::vector<Node*>& forms, bool comparison_only)
+{
+    size_t jobs = m_jobs;
+    if (jobs == 0)
+    {
+        jobs = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    jobs = std::min(jobs, forms.size());
+
+    // Every worker reads project images, and ProjectImages will only collect them on this thread
+    ProjectImages.EnsureBundlesCollected();
+
+    // Each form gets its own GenResults so that workers never share a result container. Once all
+    // workers are done, the per-form results are merged in the original form order which keeps
+    // the file lists, messages and diffs identical to a serial run.
+    std::vector<GenResults> form_results(forms.size());
+    std::vector<std::uint8_t> form_updated(forms.size(), 0);  // not vector<bool> -- no data races
+
+    // Workers pull the next unclaimed form from a shared counter, so a thread that finishes a
+    // small form immediately picks up more work instead of waiting on a fixed partition.
+    std::atomic<size_t> next_form { 0 };
+    auto worker = [&]()
+    {
+        for (size_t idx = next_form.fetch_add(1); idx < forms.size();
+             idx = next_form.fetch_add(1))
+        {
+            auto& sub_results = form_results[idx];
+            sub_results.m_mode = m_mode;
+            sub_results.m_languages = m_languages;
+            sub_results.m_is_form_worker = true;
+            try
+            {
+                if (sub_results.GenerateLanguageForm(forms[idx]->as_view(prop_class_name),
+                                                     forms[idx], comparison_only))
+                {
+                    form_updated[idx] = 1;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                sub_results.m_msgs.emplace_back(
+                    std::format("Error generating {}: {}",
+                                forms[idx]->as_string(prop_class_name), e.what()));
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(jobs - 1);
+        for (size_t idx = 1; idx < jobs; ++idx)
+        {
+            threads.emplace_back(worker);
+        }
+        worker();  // The calling thread works through forms as well
+    }  // std::jthread joins on destruction
+
+    bool generate_result = false;
+    for (size_t idx = 0; idx < forms.size(); ++idx)
+    {
+        auto& sub_results = form_results[idx];
+        if (form_updated[idx])
+        {
+            generate_result = true;
+        }
+        m_file_count += sub_results.m_file_count;
+        std::ranges::move(sub_results.m_msgs, std::back_inserter(m_msgs));
+        std::ranges::move(sub_results.m_updated_files, std::back_inserter(m_updated_files));
+        std::ranges::move(sub_results.m_created_files, std::back_inserter(m_created_files));
+        std::ranges::move(sub_results.m_file_diffs, std::back_inserter(m_file_diffs));
+    }
+
+    return generate_result;
+}
+
 void GenResults::RemoveFormsWithoutOutputPath(std::vector<Node*>& forms)
 {
     // Remove forms that don't have an output file configured for the current language
@@ -1223,9 +1350,80 @@ bool GenResults::GenerateCombinedXrcFile(bool comparison_only)
     return true;
 }
 
+namespace
+{
+    // Compares generated content against the file on disk. Safe to call from any thread -- it
+    // only reads the file and the shared content buffer.
+    auto ComputeFileDiff(const wxue::string& path, const std::shared_ptr<std::string>& content,
+                         Node* form) -> std::optional<FileDiff>
+    {
+        // Files larger than max_diff_file_size can't be read back from disk, so they are
+        // flagged as too large rather than diffed
+        if (content->size() > max_diff_file_size)
+        {
+            FileDiff file_diff;
+            file_diff.filename = path.filename();
+            file_diff.form = form;
+            file_diff.is_too_large_to_display = true;
+            return file_diff;
+        }
+
+        // If the file doesn't exist on disk (e.g. the output file was just
+        // given a new name), leave disk_content empty so it is treated as a
+        // new file. Diff::Compare will then report every generated line as added.
+        // Do not attempt to open a missing file: wxFile::Open logs a system error
+        // when opening fails, which would popup an unwanted warning during Compare.
+        wxue::ViewVector disk_content;
+        if (path.file_exists())
+        {
+            // If the file exists but cannot be read (permissions, transient IO
+            // error, etc.), report the failure instead of treating the file as
+            // brand-new (which would show every line as added).
+            if (!disk_content.ReadFile(std::string_view(path)))
+            {
+                FileDiff file_diff;
+                file_diff.filename = path.filename();
+                file_diff.form = form;
+                file_diff.error_message = std::format("Unable to read the existing file: {}",
+                                                      static_cast<std::string>(path));
+                return file_diff;
+            }
+        }
+
+        wxue::ViewVector gen_content;
+        gen_content.ReadString(std::string_view(*content));
+
+        DiffResult diff_result = Diff::Compare(disk_content, gen_content);
+        if (diff_result.has_differences)
+        {
+            FileDiff file_diff;
+            file_diff.filename = path.filename();
+            file_diff.original_content = disk_content.GetBuffer();
+            file_diff.new_content = *content;
+            file_diff.diff_result = std::move(diff_result);
+            file_diff.form = form;
+            return file_diff;
+        }
+
+        return std::nullopt;
+    }
+}  // namespace
+
 void GenResults::ProcessFileDiff(wxue::string path, std::shared_ptr<std::string> content,
                                  Node* form)
 {
+    // A form worker is already running on its own thread, so the diff is computed inline and
+    // stored in this instance's m_file_diffs. GenerateFormsConcurrently() merges it back in form
+    // order.
+    if (m_is_form_worker)
+    {
+        if (auto diff = ComputeFileDiff(path, content, form); diff.has_value())
+        {
+            m_file_diffs.push_back(std::move(*diff));
+        }
+        return;
+    }
+
     // This function assumes it is being called from the main thread *only* and as such it does not
     // protect m_pending_diffs from race conditions.
     ASSERT(wxThread::IsMain());
@@ -1259,61 +1457,11 @@ void GenResults::ProcessFileDiff(wxue::string path, std::shared_ptr<std::string>
     }
 
     // Launch async task to perform diff computation
-    m_pending_diffs.emplace_back(std::async(
-        std::launch::async,
-        [path = std::move(path), content, form]() -> std::optional<FileDiff>
-        {
-            // Check if generated file is too large to process diff efficiently
-            // Files larger than max_diff_file_size are flagged as too large to avoid
-            // performance issues
-            if (content->size() > max_diff_file_size)
-            {
-                FileDiff file_diff;
-                file_diff.filename = path.filename();
-                file_diff.form = form;
-                file_diff.is_too_large_to_display = true;
-                return file_diff;
-            }
-
-            // If the file doesn't exist on disk (e.g. the output file was just
-            // given a new name), leave disk_content empty so it is treated as a
-            // new file. Diff::Compare will then report every generated line as added.
-            // Do not attempt to open a missing file: wxFile::Open logs a system error
-            // when opening fails, which would popup an unwanted warning during Compare.
-            wxue::ViewVector disk_content;
-            if (path.file_exists())
-            {
-                // If the file exists but cannot be read (permissions, transient IO
-                // error, etc.), report the failure instead of treating the file as
-                // brand-new (which would show every line as added).
-                if (!disk_content.ReadFile(std::string_view(path)))
-                {
-                    FileDiff file_diff;
-                    file_diff.filename = path.filename();
-                    file_diff.form = form;
-                    file_diff.error_message = std::format("Unable to read the existing file: {}",
-                                                          static_cast<std::string>(path));
-                    return file_diff;
-                }
-            }
-
-            wxue::ViewVector gen_content;
-            gen_content.ReadString(std::string_view(*content));
-
-            DiffResult diff_result = Diff::Compare(disk_content, gen_content);
-            if (diff_result.has_differences)
-            {
-                FileDiff file_diff;
-                file_diff.filename = path.filename();
-                file_diff.original_content = disk_content.GetBuffer();
-                file_diff.new_content = *content;
-                file_diff.diff_result = std::move(diff_result);
-                file_diff.form = form;
-                return file_diff;
-            }
-
-            return std::nullopt;
-        }));
+    m_pending_diffs.emplace_back(std::async(std::launch::async,
+                                            [path = std::move(path), content, form]()
+                                            {
+                                                return ComputeFileDiff(path, content, form);
+                                            }));
 }
 
 void GenResults::WaitForPendingDiffs()
@@ -77,6 +77,11 @@ public:
     // Returns true if file was written/needs updating, false otherwise.
     [[nodiscard]] auto GenerateCombinedFile(GenLang language) -> bool;
 
+    // Number of threads used to generate forms when generating from the command line. 0 uses
+    // every available core, 1 (the default) generates one form at a time.
+    void SetJobs(size_t jobs) { m_jobs = jobs; }
+    [[nodiscard]] auto GetJobs() const { return m_jobs; }
+
     void StartClock();
     void EndClock();
     void Clear();
@@ -148,6 +153,15 @@ private:
     // In compare mode, captures FileDiff. Returns true if file was updated/needs updating.
     [[nodiscard]] auto GenerateCombinedXrcFile(bool comparison_only = false) -> bool;
 
+    // Returns true if form_count forms should be handed to GenerateFormsConcurrently()
+    [[nodiscard]] auto UseConcurrentForms(size_t form_count) const -> bool;
+
+    // Generates every form in forms using up to m_jobs threads. Results are collected per form
+    // and merged in the order of forms, so output is identical to a serial run.
+    // Returns true if any file was updated/needs updating.
+    [[nodiscard]] auto GenerateFormsConcurrently(const std::vector<Node*>& forms,
+                                                 bool comparison_only) -> bool;
+
     // Remove forms from the vector that don't have an output file configured for the current
     // language
     void RemoveFormsWithoutOutputPath(std::vector<Node*>& forms);
@@ -177,6 +191,10 @@ private:
 
     size_t m_file_count { 0 };
     size_t m_elapsed { 0 };
+    size_t m_jobs { 1 };  // Threads for GenerateFormsConcurrently(), 0 == all cores
+
+    // true when this instance collects the results for a single form on a worker thread
+    bool m_is_form_worker { false };
 
     std::vector<std::string> m_msgs;
     std::vector<std::string> m_updated_files;
@@ -29,6 +29,13 @@
 
 using namespace GenEnum;
 
+namespace
+{
+    // Embedded images are shared by every form. When forms are generated concurrently (see
+    // GenResults::GenerateFormsConcurrently), this serializes refreshing or adding an image.
+    std::mutex s_project_images_mutex;  // NOLINT (cppcheck-suppress)
+}  // namespace
+
 BaseCodeGenerator::BaseCodeGenerator(GenLang language, Node* form_node) :
     m_header(nullptr),
     m_source(nullptr),
@@ -295,15 +302,15 @@ void BaseCodeGenerator::CollectEventHandlers(Node* node, std::vector<NodeEvent*>
 {
     ASSERT(node);
 
-    for (auto& iter: node->get_MapEvents())
+    for (auto& iter: node->get_Events())
     {
         // Only add the event if a handler was specified
-        if (!iter.second.get_value().empty())
+        if (!iter.get_value().empty())
         {
             // Because the NodeEvent* gets stored in a set if there is a conditional, it won't get
             // duplicated even if it is added by both the Node and any container containing the same
             // conditional
-            ProcessEventHandler(node, &iter.second, events);
+            ProcessEventHandler(node, &iter, events);
         }
     }
 
@@ -342,6 +349,7 @@ void BaseCodeGenerator::ProcessEmbeddedImages(const std::vector<wxue::string>& f
             {
                 if (embed->base_image().filename.file_exists())
                 {
+                    const std::lock_guard<std::mutex> images_lock(s_project_images_mutex);
                     const wxDateTime file_time = embed->base_image().filename.last_write_time();
                     if (file_time != embed->base_image().file_time)
                     {
@@ -410,6 +418,7 @@ void BaseCodeGenerator::ProcessAnimationEmbed(std::string_view value)
 
     if (!parts[IndexImage].empty())
     {
+        const std::lock_guard<std::mutex> images_lock(s_project_images_mutex);
         const EmbeddedImage* embed = ProjectImages.GetEmbeddedImage(parts[IndexImage]);
         if (!embed)
         {
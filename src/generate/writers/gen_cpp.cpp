@@ -8,7 +8,6 @@
 #include <algorithm>
 #include <format>
 #include <set>
-#include <thread>
 
 #include "gen_cpp.h"
 
@@ -552,7 +551,7 @@ auto CppCodeGenerator::GenerateClass(GenLang language, PANEL_PAGE panel_type,
     {
         m_thrd_collect_img_headers.join();
     }
-    catch (const std::system_error& err)
+    catch (const std::exception& err)
     {
 #ifdef _DEBUG
         MSG_ERROR(err.what());
@@ -614,11 +613,25 @@ auto CppCodeGenerator::GenerateClass(GenLang language, PANEL_PAGE panel_type,
 
 void CppCodeGenerator::StartThreadedCollections(std::set<std::string>& img_include_set)
 {
-    m_thrd_get_events =
-        std::thread(&CppCodeGenerator::CollectEventHandlers, this, m_form_node, std::ref(m_events));
-    m_thrd_collect_img_headers = std::thread(&CppCodeGenerator::CollectImageHeaders, this,
-                                             m_form_node, std::ref(img_include_set));
-    m_thrd_need_img_func = std::thread(&CppCodeGenerator::ParseImageProperties, this, m_form_node);
+    // The image passes below read ProjectImages, which only collects on the main thread
+    ProjectImages.EnsureBundlesCollected();
+
+    m_thrd_get_events = BackgroundTasks.Submit("CollectEventHandlers",
+                                               [this]
+                                               {
+                                                   CollectEventHandlers(m_form_node, m_events);
+                                               });
+    m_thrd_collect_img_headers =
+        BackgroundTasks.Submit("CollectImageHeaders",
+                               [this, &img_include_set]
+                               {
+                                   CollectImageHeaders(m_form_node, img_include_set);
+                               });
+    m_thrd_need_img_func = BackgroundTasks.Submit("ParseImageProperties",
+                                                  [this]
+                                                  {
+                                                      ParseImageProperties(m_form_node);
+                                                  });
 }
 
 void CppCodeGenerator::ProcessEmbeddedImagesAndIncludes(
@@ -686,7 +699,7 @@ void CppCodeGenerator::FinalizeNamespace(const wxue::StringVector& names, size_t
 // files
 void CppCodeGenerator::CollectBaseIncludes(std::set<std::string>& src_includes,
                                            std::set<std::string>& hdr_includes,
-                                           std::thread* thrd_get_events)
+                                           PoolTask* thrd_get_events)
 {
     if (Project.as_string(prop_help_provider) != "none")
     {
@@ -719,7 +732,7 @@ void CppCodeGenerator::CollectBaseIncludes(std::set<std::string>& src_includes,
         src_includes.insert("#include <wx/artprov.h>");
     }
 
-    // Delay calling join() for as long as possible to increase the chance that the thread will
+    // Delay calling join() for as long as possible to increase the chance that the task will
     // have already completed.
     thrd_get_events->join();
     if (m_events.size() || m_map_conditional_events.size() || m_ctx_menu_events.size())
@@ -865,7 +878,7 @@ void CppCodeGenerator::WriteSourceIncludes(const std::set<std::string>& src_incl
 }
 
 void CppCodeGenerator::GenerateClassIncludes(Code& code, PANEL_PAGE panel_type,
-                                             std::thread* thrd_get_events)
+                                             PoolTask* thrd_get_events)
 {
     std::string file;
     if (const auto& base_file = m_form_node->as_string(prop_base_file); base_file.size())
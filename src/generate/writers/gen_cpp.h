@@ -5,9 +5,10 @@
 // License:   Apache License -- see ../../LICENSE
 /////////////////////////////////////////////////////////////////////////////
 
-#include <thread>
+#include <mutex>
 
-#include "gen_base.h"  // BaseCodeGenerator
+#include "gen_base.h"   // BaseCodeGenerator
+#include "task_pool.h"  // PoolTask -- shared background task pool
 
 #include "wxue_namespace/wxue_string.h"  // wxue::string
 
@@ -31,7 +32,7 @@ protected:
 
     // Called from GenerateClass() to generate #include statements in both source and header
     // files
-    void GenerateClassIncludes(Code& code, PANEL_PAGE panel_type, std::thread* thrd_get_events);
+    void GenerateClassIncludes(Code& code, PANEL_PAGE panel_type, PoolTask* thrd_get_events);
 
     // Write code to m_source that will load any image handlers needed by the form's class
     void GenerateCppHandlers();
@@ -125,7 +126,7 @@ private:
 
     // Helper methods for GenerateClassIncludes
     void CollectBaseIncludes(std::set<std::string>& src_includes,
-                             std::set<std::string>& hdr_includes, std::thread* thrd_get_events);
+                             std::set<std::string>& hdr_includes, PoolTask* thrd_get_events);
     static void ProcessOrderDependentIncludes(std::set<std::string>& src_includes,
                                               std::vector<std::string>& ordered_includes);
     void WriteSourceIncludes(const std::set<std::string>& src_includes,
@@ -231,10 +232,10 @@ private:
     void WriteEventHandlerImplementation(NodeEvent* event, const wxue::string& derived_name,
                                          const wxue::string& event_code, bool close_type_button);
 
-    // Thread member variables for GenerateClass
-    std::thread m_thrd_get_events;
-    std::thread m_thrd_collect_img_headers;
-    std::thread m_thrd_need_img_func;
+    // Collection passes submitted to BackgroundTasks by GenerateClass
+    PoolTask m_thrd_get_events;
+    PoolTask m_thrd_collect_img_headers;
+    PoolTask m_thrd_need_img_func;
 };
 
 class GenData
@@ -246,19 +247,31 @@ public:
     {
     }
 
+    // The Add/Update functions can be called from multiple form-generation threads
+
     void AddUpdateFilename(const std::string& path) const
     {
+        const std::lock_guard<std::mutex> lock(m_results_mutex);
         m_results->GetUpdatedFiles().emplace_back(path);
     };
 
-    void AddResultMsg(std::string_view msg) const { m_results->GetMsgs().emplace_back(msg); };
+    void AddResultMsg(std::string_view msg) const
+    {
+        const std::lock_guard<std::mutex> lock(m_results_mutex);
+        m_results->GetMsgs().emplace_back(msg);
+    };
 
-    void UpdateFileCount() const { m_results->IncrementFileCount(); };
+    void UpdateFileCount() const
+    {
+        const std::lock_guard<std::mutex> lock(m_results_mutex);
+        m_results->IncrementFileCount();
+    };
 
     void AddClassName(std::string_view class_name) const
     {
         if (m_pClassList)
         {
+            const std::lock_guard<std::mutex> lock(m_results_mutex);
             m_pClassList->emplace_back(class_name);
         }
     };
@@ -276,6 +289,7 @@ private:
     std::string m_header_ext;
     std::vector<std::string>* m_pClassList { nullptr };
     GenResults* m_results { nullptr };
+    mutable std::mutex m_results_mutex;  // Protects m_results and m_pClassList
 };
 
 void GenCppForm(GenData& gen_data, Node* form);
@@ -23,7 +23,6 @@
 */
 
 #include <array>
-#include <thread>
 
 #include "gen_cpp.h"
 
@@ -72,8 +71,11 @@ int CppCodeGenerator::GenerateDerivedClass(Node* form, PANEL_PAGE panel_type)
 
     // Caution! Don't return until thrd_get_events.join(); is called.
     EventVector events;
-    std::thread thrd_get_events(&CppCodeGenerator::CollectEventHandlers, this, m_form_node,
-                                std::ref(events));
+    auto thrd_get_events = BackgroundTasks.Submit("CollectEventHandlers",
+                                                  [this, &events]
+                                                  {
+                                                      CollectEventHandlers(m_form_node, events);
+                                                  });
 
     DetermineBaseFilePath(form, class_data.base_file);
 
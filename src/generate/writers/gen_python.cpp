@@ -8,7 +8,6 @@
 #include <algorithm>
 #include <array>
 #include <set>
-#include <thread>
 
 #include <wx/artprov.h>
 #include <wx/progdlg.h>  // wxProgressDialog
@@ -62,12 +61,22 @@ PythonCodeGenerator::PythonCodeGenerator(Node* form_node) :
 }
 
 auto PythonCodeGenerator::InitializeThreads(std::set<std::string>& img_include_set)
-    -> std::tuple<std::thread, std::thread>
+    -> std::tuple<PoolTask, PoolTask>
 {
-    auto thrd_get_events = std::thread(&PythonCodeGenerator::CollectEventHandlers, this,
-                                       m_form_node, std::ref(m_events));
-    auto thrd_collect_img_headers = std::thread(&PythonCodeGenerator::CollectImageHeaders, this,
-                                                m_form_node, std::ref(img_include_set));
+    // CollectImageHeaders() reads ProjectImages, which only collects on the main thread
+    ProjectImages.EnsureBundlesCollected();
+
+    auto thrd_get_events = BackgroundTasks.Submit("CollectEventHandlers",
+                                                  [this]
+                                                  {
+                                                      CollectEventHandlers(m_form_node, m_events);
+                                                  });
+    auto thrd_collect_img_headers =
+        BackgroundTasks.Submit("CollectImageHeaders",
+                               [this, &img_include_set]
+                               {
+                                   CollectImageHeaders(m_form_node, img_include_set);
+                               });
 
     return { std::move(thrd_get_events), std::move(thrd_collect_img_headers) };
 }
@@ -288,7 +297,7 @@ auto PythonCodeGenerator::GenerateConstructionCode(Code& code) -> void
     }
 }
 
-auto PythonCodeGenerator::GenerateEventHandlers(Code& code, std::thread& thrd_get_events) -> void
+auto PythonCodeGenerator::GenerateEventHandlers(Code& code, PoolTask& thrd_get_events) -> void
 {
     // Timer code must be created before the events, otherwise the timer variable won't exist
     // when the event is created.
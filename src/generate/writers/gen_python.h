@@ -5,7 +5,8 @@
 // License:   Apache License -- see ../../LICENSE
 /////////////////////////////////////////////////////////////////////////////
 
-#include "gen_base.h"  // BaseCodeGenerator
+#include "gen_base.h"   // BaseCodeGenerator
+#include "task_pool.h"  // PoolTask -- shared background task pool
 
 class PythonCodeGenerator : public BaseCodeGenerator
 {
@@ -20,7 +21,7 @@ public:
 protected:
     // Helper methods to break down GenerateClass complexity
     auto InitializeThreads(std::set<std::string>& img_include_set)
-        -> std::tuple<std::thread, std::thread>;
+        -> std::tuple<PoolTask, PoolTask>;
     auto WriteSourceHeader() -> void;
     auto WriteImports(std::set<std::string>& imports) -> void;
     auto WriteImportList() -> void;
@@ -28,7 +29,7 @@ protected:
     auto WriteInheritedClass() -> void;
     auto WriteInsertCode() -> void;
     auto GenerateConstructionCode(Code& code) -> void;
-    auto GenerateEventHandlers(Code& code, std::thread& thrd_get_events) -> void;
+    auto GenerateEventHandlers(Code& code, PoolTask& thrd_get_events) -> void;
     auto WriteWizardComment(Code& code) -> void;
 
     // Helper methods for GenUnhandledEvents
@@ -10,7 +10,6 @@
 
 #include <algorithm>
 #include <set>
-#include <thread>
 
 #include "gen_ruby.h"
 #include "gen_script_common.h"  // Common functions for generating Script Languages
@@ -96,14 +95,27 @@ RubyCodeGenerator::RubyCodeGenerator(Node* form_node) : BaseCodeGenerator(GenLan
 }
 
 auto RubyCodeGenerator::InitializeThreads(std::set<std::string>& img_include_set)
-    -> std::tuple<std::thread, std::thread, std::thread>
+    -> std::tuple<PoolTask, PoolTask, PoolTask>
 {
-    auto thrd_get_events = std::thread(&RubyCodeGenerator::CollectEventHandlers, this, m_form_node,
-                                       std::ref(m_events));
-    auto thrd_need_img_func =
-        std::thread(&RubyCodeGenerator::ParseImageProperties, this, m_form_node);
-    auto thrd_collect_img_headers = std::thread(&RubyCodeGenerator::CollectImageHeaders, this,
-                                                m_form_node, std::ref(img_include_set));
+    // Both image passes read ProjectImages, which only collects on the main thread
+    ProjectImages.EnsureBundlesCollected();
+
+    auto thrd_get_events = BackgroundTasks.Submit("CollectEventHandlers",
+                                                  [this]
+                                                  {
+                                                      CollectEventHandlers(m_form_node, m_events);
+                                                  });
+    auto thrd_need_img_func = BackgroundTasks.Submit("ParseImageProperties",
+                                                     [this]
+                                                     {
+                                                         ParseImageProperties(m_form_node);
+                                                     });
+    auto thrd_collect_img_headers =
+        BackgroundTasks.Submit("CollectImageHeaders",
+                               [this, &img_include_set]
+                               {
+                                   CollectImageHeaders(m_form_node, img_include_set);
+                               });
 
     return { std::move(thrd_get_events), std::move(thrd_need_img_func),
              std::move(thrd_collect_img_headers) };
@@ -332,7 +344,7 @@ auto RubyCodeGenerator::GenerateConstructionCode(Code& code) -> void
 }
 
 auto RubyCodeGenerator::GenerateEventHandlers([[maybe_unused]] Code& code,
-                                              std::thread& thrd_get_events) -> void
+                                              PoolTask& thrd_get_events) -> void
 {
     thrd_get_events.join();
     if (m_events.size())
@@ -5,10 +5,10 @@
 // License:   Apache License -- see ../../LICENSE
 /////////////////////////////////////////////////////////////////////////////
 
-#include <thread>
 #include <tuple>
 
-#include "gen_base.h"  // BaseCodeGenerator
+#include "gen_base.h"   // BaseCodeGenerator
+#include "task_pool.h"  // PoolTask -- shared background task pool
 
 class RubyCodeGenerator : public BaseCodeGenerator
 {
@@ -30,14 +30,14 @@ protected:
 
 private:
     auto InitializeThreads(std::set<std::string>& img_include_set)
-        -> std::tuple<std::thread, std::thread, std::thread>;
+        -> std::tuple<PoolTask, PoolTask, PoolTask>;
     auto WriteSourceHeader() -> void;
     auto WriteImports(std::set<std::string>& imports) -> void;
     auto WriteRelativeRequires(const std::vector<Node*>& forms) -> void;
     auto WriteIDConstants() -> void;
     auto WriteInheritedClass() -> void;
     auto GenerateConstructionCode(Code& code) -> void;
-    auto GenerateEventHandlers([[maybe_unused]] Code& code, std::thread& thrd_get_events) -> void;
+    auto GenerateEventHandlers([[maybe_unused]] Code& code, PoolTask& thrd_get_events) -> void;
     auto WriteHelperFunctions() -> void;
     auto WriteEmbeddedImages(Code& code) -> void;
     auto WriteRuboCopFooter() -> void;
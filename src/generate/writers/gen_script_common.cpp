@@ -5,8 +5,6 @@
 // License:   Apache License -- see ../../LICENSE
 /////////////////////////////////////////////////////////////////////////////
 
-#include <thread>
-
 #include <wx/msgdlg.h>
 
 #include "gen_script_common.h"  // Common functions for generating Script Languages
@@ -17,12 +15,13 @@
 #include "node.h"             // Node class
 #include "node_event.h"       // NodeEvent -- NodeEvent class
 #include "project_handler.h"  // ProjectHandler class
+#include "task_pool.h"        // PoolTask -- shared background task pool
 
 #include "wxue_namespace/wxue_view_vector.h"  // wxue::ViewVector
 
 namespace ScriptCommon
 {
-    void JoinThreadSafely(std::thread& thread)
+    void JoinThreadSafely(PoolTask& thread)
     {
         if (!thread.joinable())
         {
@@ -33,7 +32,7 @@ namespace ScriptCommon
         {
             thread.join();
         }
-        catch (const std::system_error& err)
+        catch (const std::exception& err)
         {
 #ifdef _DEBUG
             MSG_ERROR(err.what());
@@ -7,7 +7,6 @@
 
 #pragma once
 
-#include <thread>
 #include <unordered_set>
 
 #include "../panels/base_panel.h"  // PANEL_PAGE
@@ -16,6 +15,7 @@
 class Node;
 class NodeEvent;
 class Code;
+class PoolTask;
 
 #include "wxue_namespace/wxue_string.h"  // wxue::string
 
@@ -23,10 +23,10 @@ enum class GenLang : unsigned int;
 
 namespace ScriptCommon
 {
-    // Safely joins a thread with proper error handling.
-    // Returns immediately if thread is not joinable.
-    // Catches std::system_error and displays appropriate error message.
-    void JoinThreadSafely(std::thread& thread);
+    // Safely joins a task submitted to BackgroundTasks with proper error handling.
+    // Returns immediately if the task is not joinable.
+    // Catches any exception thrown by the task and displays appropriate error message.
+    void JoinThreadSafely(PoolTask& thread);
 
     // Collects existing event handlers from a generated file.
     // Returns true if user-defined handlers were found.
@@ -7,7 +7,9 @@
 
 #include "archive_handler.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <span>
 #include <string>
 #include <vector>
@@ -40,6 +42,8 @@ std::expected<void, std::string> ArchiveHandler::OpenArchive(const wxString& zip
     }
     m_archive = std::move(*archive_result);
 
+    // Pages are prefetched on worker threads, so cppmark's one-time setup is done here first
+    cmark_register_extensions();
     RegisterMemoryFSHandler();
 
     return {};
@@ -66,22 +70,17 @@ bool ArchiveHandler::DisplayArchivePage(const std::string& archive_name, wxHtmlW
         return false;
     }
 
-    std::expected<std::string, std::string> markdown_result =
-        ReadMarkdown(*m_archive, archive_name);
-    if (!markdown_result)
+    RenderedPagePtr page = GetRenderedPage(archive_name);
+    if (!page)
     {
         return false;
     }
 
-    const std::string& markdown = *markdown_result;
-    m_current_markdown = markdown;
-
-    const std::string html_text =
-        cmark_markdown_to_html(markdown, CMARK_OPT_GITHUB_PRE_LANG | CMARK_OPT_UNSAFE);
-    m_current_html_with_ids = AddHeadingIds(html_text);
-    html_win.SetPage(wxString::FromUTF8(m_current_html_with_ids));
+    m_current_page = std::move(page);
+    html_win.SetPage(wxString::FromUTF8(m_current_page->html_with_ids));
 
     m_current_archive_page = archive_name;
+    PrefetchLinkedPages(m_current_page->html_with_ids);
     return true;
 }
 
@@ -90,6 +89,18 @@ bool ArchiveHandler::DisplayHomePage(wxHtmlWindow& html_win)
     return DisplayArchivePage("index.md", html_win);
 }
 
+const std::string& ArchiveHandler::GetCurrentMarkdown() const noexcept
+{
+    static const std::string empty_text;
+    return m_current_page ? m_current_page->markdown : empty_text;
+}
+
+const std::string& ArchiveHandler::GetCurrentHtml() const noexcept
+{
+    static const std::string empty_text;
+    return m_current_page ? m_current_page->html_with_ids : empty_text;
+}
+
 void ArchiveHandler::OnHtmlLink(const wxHtmlLinkInfo& link_info, wxHtmlWindow& html_win)
 {
     if (!m_archive)
@@ -132,6 +143,168 @@ void ArchiveHandler::OnHtmlLink(const wxHtmlLinkInfo& link_info, wxHtmlWindow& h
     }
 }
 
+// ###################### Page cache #######################
+
+auto ArchiveHandler::RenderPage(const DocArchive& archive, const std::string& archive_name)
+    -> RenderedPagePtr
+{
+    std::expected<std::string, std::string> markdown_result = ReadMarkdown(archive, archive_name);
+    if (!markdown_result)
+    {
+        return nullptr;
+    }
+
+    auto page = std::make_shared<RenderedPage>();
+    page->markdown = std::move(*markdown_result);
+    page->html_with_ids = AddHeadingIds(
+        cmark_markdown_to_html(page->markdown, CMARK_OPT_GITHUB_PRE_LANG | CMARK_OPT_UNSAFE));
+    return page;
+}
+
+void ArchiveHandler::CollectPrefetchedPages()
+{
+    for (auto iter = m_prefetched_pages.begin(); iter != m_prefetched_pages.end();)
+    {
+        PrefetchedPage& prefetched = iter->second;
+        if (!prefetched.result->ready)
+        {
+            ++iter;
+            continue;
+        }
+
+        prefetched.task.join();
+        if (prefetched.result->page)
+        {
+            CachePage(iter->first, prefetched.result->page);
+        }
+        iter = m_prefetched_pages.erase(iter);
+    }
+}
+
+auto ArchiveHandler::GetRenderedPage(const std::string& archive_name) -> RenderedPagePtr
+{
+    // Cached first, so that the requested page ends up as the most recently used one
+    CollectPrefetchedPages();
+
+    if (const auto cached = m_page_cache_index.find(archive_name);
+        cached != m_page_cache_index.end())
+    {
+        m_page_cache.splice(m_page_cache.begin(), m_page_cache, cached->second);
+        return cached->second->second;
+    }
+
+    RenderedPagePtr page;
+    if (auto prefetched = m_prefetched_pages.find(archive_name);
+        prefetched != m_prefetched_pages.end())
+    {
+        // If no worker has started on the page yet, join() renders it on this thread
+        prefetched->second.task.join();
+        page = prefetched->second.result->page;
+        m_prefetched_pages.erase(prefetched);
+    }
+    else
+    {
+        page = RenderPage(*m_archive, archive_name);
+    }
+
+    if (page)
+    {
+        CachePage(archive_name, page);
+    }
+    return page;
+}
+
+void ArchiveHandler::CachePage(const std::string& archive_name, RenderedPagePtr page)
+{
+    if (const auto cached = m_page_cache_index.find(archive_name);
+        cached != m_page_cache_index.end())
+    {
+        cached->second->second = std::move(page);
+        m_page_cache.splice(m_page_cache.begin(), m_page_cache, cached->second);
+        return;
+    }
+
+    m_page_cache.emplace_front(archive_name, std::move(page));
+    m_page_cache_index[archive_name] = m_page_cache.begin();
+    if (m_page_cache.size() > PAGE_CACHE_SIZE)
+    {
+        m_page_cache_index.erase(m_page_cache.back().first);
+        m_page_cache.pop_back();
+    }
+}
+
+void ArchiveHandler::PrefetchLinkedPages(std::string_view html)
+{
+    // Collect the archive pages this page links to, the same way OnHtmlLink()
+    // turns an href into an archive name.
+    std::vector<std::string> linked_pages;
+    constexpr std::string_view href_attr = "href=\"";
+    std::size_t pos = html.find(href_attr);
+    while (pos != std::string_view::npos && linked_pages.size() < MAX_PREFETCH_PAGES)
+    {
+        const std::size_t name_begin = pos + href_attr.size();
+        const std::size_t name_end = html.find('"', name_begin);
+        if (name_end == std::string_view::npos)
+        {
+            break;
+        }
+        pos = html.find(href_attr, name_end);
+
+        std::string_view archive_name = html.substr(name_begin, name_end - name_begin);
+        archive_name = archive_name.substr(0, archive_name.find_first_of("#?"));
+        if (!archive_name.ends_with(".md") || archive_name.contains("://") ||
+            archive_name == m_current_archive_page ||
+            std::ranges::find(linked_pages, archive_name) != linked_pages.end())
+        {
+            continue;
+        }
+        linked_pages.emplace_back(archive_name);
+    }
+
+    // Prefetches for pages that this page doesn't link to are abandoned so that
+    // they don't tie up the workers.
+    AbandonPrefetches(linked_pages);
+
+    for (std::string& archive_name: linked_pages)
+    {
+        if (m_page_cache_index.contains(archive_name) || m_prefetched_pages.contains(archive_name))
+        {
+            continue;
+        }
+
+        auto result = std::make_shared<PrefetchResult>();
+        PoolTask task = BackgroundTasks.Submit("PrefetchPage",
+                                               [archive = m_archive, archive_name, result]
+                                               {
+                                                   if (!result->abandoned)
+                                                   {
+                                                       result->page =
+                                                           RenderPage(*archive, archive_name);
+                                                   }
+                                                   result->ready = true;
+                                               });
+        m_prefetched_pages.emplace(std::move(archive_name),
+                                   PrefetchedPage { std::move(task), std::move(result) });
+    }
+}
+
+void ArchiveHandler::AbandonPrefetches(const std::vector<std::string>& keep)
+{
+    for (auto iter = m_prefetched_pages.begin(); iter != m_prefetched_pages.end();)
+    {
+        if (std::ranges::find(keep, iter->first) == keep.end())
+        {
+            iter->second.result->abandoned = true;
+            iter->second.task.detach();
+            iter = m_prefetched_pages.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
 // ###################### Search #######################
 
 bool ArchiveHandler::LoadSearchIndex()
@@ -162,11 +335,13 @@ bool ArchiveHandler::LoadSearchIndex()
         return false;
     }
 
-    const std::string& kfts_data = *kfts_result;
-    const std::span<const char> kfts_chars(kfts_data.data(), kfts_data.size());
+    // The index is searched in place -- it holds on to the extracted data instead of a copy
+    const auto kfts_data = std::make_shared<const std::string>(std::move(*kfts_result));
+    const std::span<const char> kfts_chars(kfts_data->data(), kfts_data->size());
     const std::span<const std::byte> kfts_span = std::as_bytes(kfts_chars);
 
-    std::expected<ftsrch::IndexPtr, ftsrch::Error> index_result = ftsrch::OpenIndex(kfts_span);
+    std::expected<ftsrch::IndexPtr, ftsrch::Error> index_result =
+        ftsrch::OpenIndex(kfts_span, kfts_data);
     if (!index_result)
     {
         return false;
@@ -7,17 +7,24 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <expected>
+#include <functional>
+#include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <wx/string.h>
 
 #include "data/ftsrch/ftsrch.h"
 #include "data/include/utils.h"
+#include "task_pool.h"  // PoolTask, BackgroundTasks
 
 class wxHtmlLinkInfo;
 class wxHtmlWindow;
@@ -28,11 +35,17 @@ class wxHtmlWindow;
 //
 // The caller supplies the wxHtmlWindow pointer at display time so the
 // same ArchiveHandler can serve a dialog, a wxPanel, or any other host.
+//
+// Rendered pages are kept in a small LRU cache so that revisiting a page
+// (including back/forward navigation) skips the extraction and the
+// markdown conversion. After a page is displayed, the pages it links to
+// are rendered in the background so that following a link is usually a
+// cache hit as well.
 class ArchiveHandler
 {
 public:
     ArchiveHandler() = default;
-    ~ArchiveHandler() = default;
+    ~ArchiveHandler() { AbandonPrefetches(); }
 
     ArchiveHandler(const ArchiveHandler&) = delete;
     ArchiveHandler& operator=(const ArchiveHandler&) = delete;
@@ -78,10 +91,10 @@ public:
     const std::string& GetCurrentPage() const noexcept { return m_current_archive_page; }
 
     // Raw markdown for the currently displayed page (empty if none displayed).
-    const std::string& GetCurrentMarkdown() const noexcept { return m_current_markdown; }
+    const std::string& GetCurrentMarkdown() const noexcept;
 
     // HTML (with heading IDs injected) for the currently displayed page.
-    const std::string& GetCurrentHtml() const noexcept { return m_current_html_with_ids; }
+    const std::string& GetCurrentHtml() const noexcept;
 
     // ----- Search -----
 
@@ -119,14 +132,67 @@ private:
     // slugify "Some Heading Text" → "some-heading-text"
     static std::string SlugifyHeading(std::string_view text);
 
+    struct RenderedPage
+    {
+        std::string markdown;
+        std::string html_with_ids;
+    };
+    using RenderedPagePtr = std::shared_ptr<const RenderedPage>;
+
+    // Extract a markdown page and convert it to HTML with heading anchors.
+    // Returns nullptr if the page can't be read. Safe to call from any thread
+    // once OpenArchive() has registered cppmark's extensions.
+    static RenderedPagePtr RenderPage(const DocArchive& archive, const std::string& archive_name);
+
+    // Return the page from the cache, from a prefetch, or by rendering it now.
+    RenderedPagePtr GetRenderedPage(const std::string& archive_name);
+
+    // Make the page the most recently used one, evicting the least recently
+    // used page if the cache is full.
+    void CachePage(const std::string& archive_name, RenderedPagePtr page);
+
+    // Move every finished prefetch into the cache.
+    void CollectPrefetchedPages();
+
+    // Start rendering the archive pages that html links to in the background.
+    void PrefetchLinkedPages(std::string_view html);
+
+    // Stop waiting for every prefetch that isn't in keep. The tasks only use
+    // the shared PrefetchResult, so they are detached rather than joined.
+    void AbandonPrefetches(const std::vector<std::string>& keep = {});
+
     std::shared_ptr<DocArchive> m_archive;
     ftsrch::IndexPtr m_fts_index;
     std::unordered_map<ftsrch::DocId, std::string> m_doc_map;
 
-    // Cached state for the currently displayed page
+    // Most recently used page first
+    std::list<std::pair<std::string, RenderedPagePtr>> m_page_cache;
+    std::unordered_map<std::string, decltype(m_page_cache)::iterator> m_page_cache_index;
+    static constexpr std::size_t PAGE_CACHE_SIZE = 32;
+
+    struct PrefetchResult
+    {
+        RenderedPagePtr page;
+        std::atomic<bool> ready { false };
+        std::atomic<bool> abandoned { false };
+    };
+
+    struct PrefetchedPage
+    {
+        PoolTask task;
+
+        // Shared with the task so that it remains valid even if the prefetch
+        // is abandoned before the task runs.
+        std::shared_ptr<PrefetchResult> result;
+    };
+
+    // std::string is the archive name
+    std::map<std::string, PrefetchedPage, std::less<>> m_prefetched_pages;
+    static constexpr std::size_t MAX_PREFETCH_PAGES = 8;
+
+    // State for the currently displayed page
     std::string m_current_archive_page;
-    std::string m_current_markdown;
-    std::string m_current_html_with_ids;
+    RenderedPagePtr m_current_page;
 };
 
 extern ArchiveHandler& wxueArchive;  // NOLINT (global variable) // cppcheck-suppress globalVariable
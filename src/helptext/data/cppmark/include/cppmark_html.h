@@ -9,9 +9,15 @@
 #include <string>
 #include <string_view>
 
-// Convert UTF-8 Markdown to HTML and return it as a UTF-8 std::string.
+// Convert UTF-8 Markdown to HTML and return it as a UTF-8 std::string. Safe to call from several
+// threads at once.
 std::string cmark_markdown_to_html(std::string_view text, int options);
 
+// Register the process-wide state used by the syntax extensions. cmark_markdown_to_html() does
+// this on its first call, but an application that renders on worker threads can call this from
+// its main thread first so that the one-time setup never runs on a worker.
+void cmark_register_extensions();
+
 // Option flags retained for compatibility with existing code.
 constexpr int CMARK_OPT_DEFAULT = 0;
 constexpr int CMARK_OPT_SOURCEPOS = (1 << 1);
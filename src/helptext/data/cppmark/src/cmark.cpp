@@ -11,6 +11,11 @@
 cmark_node_type CMARK_NODE_LAST_BLOCK = CMARK_NODE_FOOTNOTE_DEFINITION;
 cmark_node_type CMARK_NODE_LAST_INLINE = CMARK_NODE_FOOTNOTE_REFERENCE;
 
+void cmark_register_extensions()
+{
+    register_table_node_types();
+}
+
 std::string cmark_markdown_to_html(std::string_view text, int options)
 {
     cmark_parser* parser = cmark_parser_new(options);
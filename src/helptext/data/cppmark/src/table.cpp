@@ -1,7 +1,8 @@
 // GFM table syntax extension
 // Purpose: Implements GitHub Flavored Markdown table parsing and HTML rendering
 // Key types: NodeTable, NodeTableRow, HtmlTableState
-// Key functions: create_table_extension(), try_opening_table_block(), html_render()
+// Key functions: register_table_node_types(), create_table_extension(), try_opening_table_block(),
+//                html_render()
 // Dependencies: cmark-gfm-extension_api.hxx, node.hxx, parser.hxx, render.hxx
 
 #include "table.hxx"
@@ -10,6 +11,7 @@
 #include <cassert>
 #include <cctype>
 #include <cstring>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -879,29 +881,39 @@ static void html_render(cmark_syntax_extension* /*self*/, cmark_html_renderer* r
     }
 }
 
+// ---------------------------------------------------------------------------
+// register_table_node_types
+// ---------------------------------------------------------------------------
+
+void register_table_node_types()
+{
+    // The node types and flag are process-wide, so they must only be assigned once even if
+    // several threads render their first page at the same time.
+    static std::once_flag registered;
+    std::call_once(registered,
+                   []
+                   {
+                       cmark_register_node_flag(&CMARK_NODE_TABLE_VISITED);
+
+                       CMARK_NODE_TABLE = cmark_syntax_extension_add_node(0);
+                       CMARK_NODE_TABLE_ROW = cmark_syntax_extension_add_node(0);
+                       CMARK_NODE_TABLE_CELL = cmark_syntax_extension_add_node(0);
+                   });
+}
+
 // ---------------------------------------------------------------------------
 // create_table_extension
 // ---------------------------------------------------------------------------
 
 cmark_syntax_extension* create_table_extension()
 {
-    static bool is_initialized = false;
-
     cmark_syntax_extension* table_ext = cmark_syntax_extension_new("table");
     if (table_ext == nullptr)
     {
         return nullptr;
     }
 
-    if (!is_initialized)
-    {
-        cmark_register_node_flag(&CMARK_NODE_TABLE_VISITED);
-
-        CMARK_NODE_TABLE = cmark_syntax_extension_add_node(0);
-        CMARK_NODE_TABLE_ROW = cmark_syntax_extension_add_node(0);
-        CMARK_NODE_TABLE_CELL = cmark_syntax_extension_add_node(0);
-        is_initialized = true;
-    }
+    register_table_node_types();
 
     cmark_syntax_extension_set_match_block_func(table_ext, matches);
     cmark_syntax_extension_set_open_block_func(table_ext, try_opening_table_block);
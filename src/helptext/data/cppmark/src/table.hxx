@@ -7,11 +7,15 @@
 #include "cmark-gfm-extension_api.hxx"
 
 // Global table node type variables — zero-initialized; assigned by
-// cmark_syntax_extension_add_node() when create_table_extension() is first called.
+// cmark_syntax_extension_add_node() when register_table_node_types() is first called.
 extern cmark_node_type CMARK_NODE_TABLE;
 extern cmark_node_type CMARK_NODE_TABLE_ROW;
 extern cmark_node_type CMARK_NODE_TABLE_CELL;
 
+// Assign the table node types and flag. Only the first call does anything, and it is safe to call
+// from several threads at once. create_table_extension() calls this itself.
+void register_table_node_types();
+
 // Create and return the fully-configured table syntax extension.
 // The caller is responsible for attaching it to a parser with
 // cmark_parser_attach_syntax_extension() and freeing it with cmark_syntax_extension_free()
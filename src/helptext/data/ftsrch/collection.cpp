@@ -14,6 +14,7 @@
 #include <cstring>
 
 #include "compressor.h"
+#include "mapped_file.h"
 
 namespace ftsrch
 {
@@ -36,6 +37,18 @@ namespace ftsrch
         m_max_concept_id = std::max(m_max_concept_id, concept_id);
     }
 
+    void Collection::RecordConcept(ConceptId concept_id, std::uint16_t count)
+    {
+        if (m_current_doc == nullptr)
+        {
+            return;
+        }
+        assert(concept_id != STOP_WORD);
+        std::uint16_t& term_frequency = m_current_doc->term_freqs[concept_id];
+        term_frequency = static_cast<std::uint16_t>(term_frequency + count);
+        m_max_concept_id = std::max(m_max_concept_id, concept_id);
+    }
+
     void Collection::EndDocument()
     {
         m_current_doc = nullptr;
@@ -49,17 +62,18 @@ namespace ftsrch
         }
 
         m_doc_count = static_cast<uint32_t>(m_documents.size());
-        m_concept_count = m_max_concept_id + 1;
-        m_concept_entries.resize(m_concept_count);
+        const uint32_t concept_count = m_max_concept_id + 1;
+        m_owned_records.resize(concept_count);
 
         if (m_doc_count == 0)
         {
+            UseOwnedPostings();
             m_finalized = true;
             return;
         }
 
         // Step 1: Compute document frequency per concept
-        std::vector<uint32_t> document_frequency(m_concept_count, 0);
+        std::vector<uint32_t> document_frequency(concept_count, 0);
         for (const auto& doc_rec: m_documents)
         {
             for (const auto& [concept_id, term_frequency]: doc_rec.term_freqs)
@@ -70,8 +84,8 @@ namespace ftsrch
 
         // Step 2: Compute IDF per concept
         const double num_docs = static_cast<double>(m_doc_count);
-        std::vector<double> inverse_document_frequency(m_concept_count, 0.0);
-        for (uint32_t concept_id = 0; concept_id < m_concept_count; ++concept_id)
+        std::vector<double> inverse_document_frequency(concept_count, 0.0);
+        for (uint32_t concept_id = 0; concept_id < concept_count; ++concept_id)
         {
             if (document_frequency[concept_id] == 0)
             {
@@ -97,7 +111,7 @@ namespace ftsrch
         // Step 3: Compute TF-IDF weights per doc-concept pair and build
         //         inverted index
         // First pass: collect per-concept sorted doc lists
-        std::vector<std::vector<std::pair<DocId, double>>> concept_docs(m_concept_count);
+        std::vector<std::vector<std::pair<DocId, double>>> concept_docs(concept_count);
 
         for (const auto& doc_rec: m_documents)
         {
@@ -142,7 +156,7 @@ namespace ftsrch
         {
             // Compute L2 norm per document
             std::unordered_map<DocId, double> doc_squared_weight_sum;
-            for (uint32_t concept_id = 0; concept_id < m_concept_count; ++concept_id)
+            for (uint32_t concept_id = 0; concept_id < concept_count; ++concept_id)
             {
                 for (const auto& [document_id, document_weight]: concept_docs[concept_id])
                 {
@@ -159,7 +173,7 @@ namespace ftsrch
         {
             // Compute sum of weights per document
             std::unordered_map<DocId, double> document_weight_sum;
-            for (uint32_t concept_id = 0; concept_id < m_concept_count; ++concept_id)
+            for (uint32_t concept_id = 0; concept_id < concept_count; ++concept_id)
             {
                 for (const auto& [document_id, document_weight]: concept_docs[concept_id])
                 {
@@ -173,8 +187,12 @@ namespace ftsrch
         }
         // NormScheme::none: no normalization
 
-        // Step 5: Build final inverted index with compressed doc lists
-        for (uint32_t concept_id = 0; concept_id < m_concept_count; ++concept_id)
+        // Step 5: Build final inverted index with block-compressed doc lists
+        std::vector<uint32_t> sorted_doc_ids;
+        std::vector<Weight> sorted_weights;
+        std::vector<PostingBlock> blocks;
+        std::vector<std::uint32_t> packed_docs;
+        for (uint32_t concept_id = 0; concept_id < concept_count; ++concept_id)
         {
             std::vector<std::pair<DocId, double>>& concept_document_weights =
                 concept_docs[concept_id];
@@ -186,13 +204,9 @@ namespace ftsrch
             // Sort by doc_id for delta compression
             std::ranges::sort(concept_document_weights);
 
-            ConceptEntry& entry = m_concept_entries[concept_id];
-            entry.doc_count = static_cast<uint32_t>(concept_document_weights.size());
-
-            // Build sorted doc ID list and weight vector (already sorted by doc_id)
-            std::vector<uint32_t> sorted_doc_ids;
-            sorted_doc_ids.reserve(concept_document_weights.size());
-            entry.doc_weights.reserve(concept_document_weights.size());
+            // Build sorted doc ID list and the parallel weight vector
+            sorted_doc_ids.clear();
+            sorted_weights.clear();
 
             for (const auto& [document_id, raw_weight]: concept_document_weights)
             {
@@ -212,15 +226,32 @@ namespace ftsrch
                 // Clamp to [0, 1] and convert to uint16_t
                 final_weight = std::max(final_weight, 0.0);
                 final_weight = std::min(final_weight, 1.0);
-                const Weight encoded_weight =
-                    static_cast<Weight>(final_weight * static_cast<double>(WT_ONE));
-                entry.doc_weights.emplace_back(document_id, encoded_weight);
+                sorted_weights.push_back(
+                    static_cast<Weight>(final_weight * static_cast<double>(WT_ONE)));
             }
 
-            // Compress the sorted doc ID list
-            const std::uint32_t universe = m_doc_count;
-            entry.compressed_docs = CompressSortedIds(sorted_doc_ids, universe);
+            // Block offsets are relative to the concept's first packed word
+            blocks.clear();
+            packed_docs.clear();
+            const Weight max_weight =
+                BuildPostingBlocks(sorted_doc_ids, sorted_weights, blocks, packed_docs);
+
+            m_owned_records[concept_id] = {
+                .posting_count = static_cast<std::uint32_t>(sorted_weights.size()),
+                .first_block = static_cast<std::uint32_t>(m_owned_blocks.size()),
+                .block_count = static_cast<std::uint32_t>(blocks.size()),
+                .first_packed = static_cast<std::uint32_t>(m_owned_packed_docs.size()),
+                .packed_size = static_cast<std::uint32_t>(packed_docs.size()),
+                .first_weight = static_cast<std::uint32_t>(m_owned_weights.size()),
+                .max_weight = max_weight,
+            };
+            m_owned_blocks.insert(m_owned_blocks.end(), blocks.begin(), blocks.end());
+            m_owned_packed_docs.insert(m_owned_packed_docs.end(), packed_docs.begin(),
+                                       packed_docs.end());
+            m_owned_weights.insert(m_owned_weights.end(), sorted_weights.begin(),
+                                   sorted_weights.end());
         }
+        UseOwnedPostings();
 
         // Free build-phase data
         m_documents.clear();
@@ -229,6 +260,14 @@ namespace ftsrch
         m_finalized = true;
     }
 
+    void Collection::UseOwnedPostings()
+    {
+        m_records = m_owned_records;
+        m_blocks = m_owned_blocks;
+        m_packed_docs = m_owned_packed_docs;
+        m_weights = m_owned_weights;
+    }
+
     std::uint32_t Collection::DocCount() const
     {
         return m_doc_count;
@@ -236,107 +275,131 @@ namespace ftsrch
 
     std::uint32_t Collection::ConceptCount() const
     {
-        return m_concept_count;
+        return static_cast<std::uint32_t>(m_records.size());
     }
 
-    std::span<const std::uint32_t> Collection::GetCompressedDocList(ConceptId concept_id) const
+    PostingList Collection::GetPostings(ConceptId concept_id) const
     {
-        if (concept_id >= m_concept_count)
+        if (concept_id >= m_records.size())
         {
             return {};
         }
-        return m_concept_entries[concept_id].compressed_docs;
+        const ConceptRecord& record = m_records[concept_id];
+
+        // A mapped index is only checked one concept at a time, as its postings are needed
+        if (record.posting_count == 0 ||
+            static_cast<std::size_t>(record.first_block) + record.block_count > m_blocks.size() ||
+            static_cast<std::size_t>(record.first_packed) + record.packed_size >
+                m_packed_docs.size() ||
+            static_cast<std::size_t>(record.first_weight) + record.posting_count >
+                m_weights.size())
+        {
+            return {};
+        }
+        const PostingList postings { m_blocks.subspan(record.first_block, record.block_count),
+                                     m_packed_docs.subspan(record.first_packed,
+                                                           record.packed_size),
+                                     m_weights.subspan(record.first_weight, record.posting_count),
+                                     record.max_weight };
+
+        // A cursor trusts the skip table, so an inconsistent one must never be used
+        if (!ValidatePostingBlocks(postings.blocks, postings.packed_docs, record.posting_count))
+        {
+            return {};
+        }
+        return postings;
     }
 
     Weight Collection::GetDocWeight(ConceptId concept_id, DocId doc_id) const
     {
-        const ConceptEntry& entry = m_concept_entries[concept_id];
-        // Binary search on sorted vector — faster than hash lookup for small-N
-        // and eliminates per-element heap allocations that slow shutdown.
-        const std::vector<std::pair<DocId, Weight>>::const_iterator it =
-            std::lower_bound(entry.doc_weights.begin(), entry.doc_weights.end(), doc_id,
-                             [](const std::pair<DocId, Weight>& pair, DocId id)
-                             {
-                                 return pair.first < id;
-                             });
-        if (it != entry.doc_weights.end() && it->first == doc_id)
+        const PostingList postings = GetPostings(concept_id);
+        if (postings.empty())
         {
-            return it->second;
+            return 0;
         }
-        return 0;
+        // The skip table finds the block, so only one block is decoded
+        PostingCursor cursor(postings);
+        cursor.Advance(doc_id);
+        return (cursor.Doc() == doc_id) ? cursor.CurrentWeight() : 0;
     }
 
     std::vector<std::uint8_t> Collection::Serialize() const
     {
-        constexpr size_t U32_BYTES = sizeof(uint32_t);
-        constexpr size_t U16_BYTES = sizeof(uint16_t);
-        constexpr size_t HEADER_BYTES = 2 * U32_BYTES;        // m_doc_count + m_concept_count
-        constexpr size_t ENTRY_HEADER_BYTES = 2 * U32_BYTES;  // doc_count + packed_size
-        constexpr size_t WEIGHT_PAIR_BYTES = U32_BYTES + U16_BYTES;  // doc_id + weight
-
-        std::vector<uint8_t> result;
-
-        // Pre-compute serialized size to avoid reallocations
-        size_t total_bytes = HEADER_BYTES;
-        for (const auto& entry: m_concept_entries)
+        // doc_count, concept_count, block_count, packed_size, weight_count, concept records,
+        // skip table, packed doc IDs, weights
+        SectionWriter writer;
+        writer.WriteU32(m_doc_count);
+        writer.WriteU32(static_cast<std::uint32_t>(m_records.size()));
+        writer.WriteU32(static_cast<std::uint32_t>(m_blocks.size()));
+        writer.WriteU32(static_cast<std::uint32_t>(m_packed_docs.size()));
+        writer.WriteU32(static_cast<std::uint32_t>(m_weights.size()));
+
+        for (const ConceptRecord& record: m_records)
         {
-            total_bytes += ENTRY_HEADER_BYTES + (entry.compressed_docs.size() * U32_BYTES) +
-                           (static_cast<size_t>(entry.doc_count) * WEIGHT_PAIR_BYTES);
+            writer.WriteU32(record.posting_count);
+            writer.WriteU32(record.first_block);
+            writer.WriteU32(record.block_count);
+            writer.WriteU32(record.first_packed);
+            writer.WriteU32(record.packed_size);
+            writer.WriteU32(record.first_weight);
+            writer.WriteU16(record.max_weight);
+            writer.WriteU16(0);
         }
-        result.reserve(total_bytes);
-
-        auto WriteU32 = [&](uint32_t value)
+        for (const PostingBlock& block: m_blocks)
         {
-            result.push_back(static_cast<uint8_t>(value & 0xFF));
-            result.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-            result.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
-            result.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
-        };
+            writer.WriteU32(block.last_doc);
+            writer.WriteU32(block.offset);
+            writer.WriteU16(block.max_weight);
+            writer.WriteU16(0);
+        }
+        writer.WriteArray(m_packed_docs);
+        writer.WriteArray(m_weights);
+        return writer.Finish();
+    }
 
-        auto WriteU16 = [&](uint16_t value)
-        {
-            result.push_back(static_cast<uint8_t>(value & 0xFF));
-            result.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
-        };
+    Collection Collection::Map(std::span<const std::byte> data)
+    {
+        static_assert(sizeof(ConceptRecord) == 28 && alignof(ConceptRecord) == 4);
 
-        // Header
-        WriteU32(m_doc_count);
-        WriteU32(m_concept_count);
+        Collection collection;
 
-        // Per concept: doc_count, compressed_docs, weight pairs
-        for (uint32_t concept_id = 0; concept_id < m_concept_count; ++concept_id)
+        SectionReader reader(data);
+        const std::uint32_t doc_count = reader.ReadU32();
+        const std::uint32_t concept_count = reader.ReadU32();
+        const std::uint32_t block_count = reader.ReadU32();
+        const std::uint32_t packed_size = reader.ReadU32();
+        const std::uint32_t weight_count = reader.ReadU32();
+        const std::span<const ConceptRecord> records =
+            reader.ReadArray<ConceptRecord>(concept_count);
+        const std::span<const PostingBlock> blocks = reader.ReadArray<PostingBlock>(block_count);
+        const std::span<const std::uint32_t> packed_docs =
+            reader.ReadArray<std::uint32_t>(packed_size);
+        const std::span<const Weight> weights = reader.ReadArray<Weight>(weight_count);
+        if (!reader.ok())
         {
-            const ConceptEntry& entry = m_concept_entries[concept_id];
-            WriteU32(entry.doc_count);
-
-            const std::uint32_t packed_size =
-                static_cast<std::uint32_t>(entry.compressed_docs.size());
-            WriteU32(packed_size);
-            for (auto packed_word: entry.compressed_docs)
-            {
-                WriteU32(packed_word);
-            }
-
-            // Write weight pairs: (doc_id, weight) for each doc
-            for (const auto& [doc_id, weight]: entry.doc_weights)
-            {
-                WriteU32(doc_id);
-                WriteU16(weight);
-            }
+            return collection;
         }
 
-        return result;
+        collection.m_doc_count = doc_count;
+        collection.m_records = records;
+        collection.m_blocks = blocks;
+        collection.m_packed_docs = packed_docs;
+        collection.m_weights = weights;
+        collection.m_finalized = true;
+        return collection;
     }
 
-    Collection Collection::Deserialize(std::span<const std::byte> data)
+    Collection Collection::DeserializeV2(std::span<const std::byte> data)
     {
         Collection collection;
 
         constexpr size_t U32_BYTES = sizeof(uint32_t);
         constexpr size_t U16_BYTES = sizeof(uint16_t);
-        constexpr size_t HEADER_BYTES = 2 * U32_BYTES;        // m_doc_count + m_concept_count
-        constexpr size_t ENTRY_HEADER_BYTES = 2 * U32_BYTES;  // doc_count + packed_size
-        constexpr size_t WEIGHT_PAIR_BYTES = U32_BYTES + U16_BYTES;  // doc_id + weight
+        constexpr size_t HEADER_BYTES = 2 * U32_BYTES;  // doc_count + concept_count
+        // doc_count + block_count + packed_size
+        constexpr size_t ENTRY_HEADER_BYTES = 3 * U32_BYTES;
+        // last_doc + offset + max_weight
+        constexpr size_t BLOCK_BYTES = (2 * U32_BYTES) + U16_BYTES;
 
         if (data.size() < HEADER_BYTES)
         {
@@ -363,60 +426,73 @@ namespace ftsrch
 
         collection.m_doc_count = ReadU32(data_bytes + offset);
         offset += U32_BYTES;
-        collection.m_concept_count = ReadU32(data_bytes + offset);
+        const std::uint32_t concept_count = ReadU32(data_bytes + offset);
         offset += U32_BYTES;
 
         // Guard against corrupt concept_count triggering a huge allocation:
         // each concept entry occupies at least ENTRY_HEADER_BYTES
-        if (collection.m_concept_count > (total_bytes - offset) / ENTRY_HEADER_BYTES)
+        if (concept_count > (total_bytes - offset) / ENTRY_HEADER_BYTES)
         {
             return collection;
         }
 
-        collection.m_concept_entries.resize(collection.m_concept_count);
+        // Concepts that can't be read are left without postings
+        collection.m_owned_records.resize(concept_count);
+        collection.UseOwnedPostings();
 
-        for (std::uint32_t concept_id = 0; concept_id < collection.m_concept_count; ++concept_id)
+        for (std::uint32_t concept_id = 0; concept_id < concept_count; ++concept_id)
         {
-            ConceptEntry& entry = collection.m_concept_entries[concept_id];
-
             if (offset + ENTRY_HEADER_BYTES > total_bytes)
             {
                 return collection;
             }
-            entry.doc_count = ReadU32(data_bytes + offset);
+            const std::uint32_t doc_count = ReadU32(data_bytes + offset);
+            offset += U32_BYTES;
+            const std::uint32_t block_count = ReadU32(data_bytes + offset);
             offset += U32_BYTES;
             const std::uint32_t packed_size = ReadU32(data_bytes + offset);
             offset += U32_BYTES;
 
-            if (static_cast<std::size_t>(packed_size) * U32_BYTES > total_bytes - offset)
+            const std::size_t entry_bytes = (static_cast<std::size_t>(block_count) * BLOCK_BYTES) +
+                                            (static_cast<std::size_t>(packed_size) * U32_BYTES) +
+                                            (static_cast<std::size_t>(doc_count) * U16_BYTES);
+            if (entry_bytes > total_bytes - offset)
             {
                 return collection;
             }
-            entry.compressed_docs.resize(packed_size);
-            for (auto& word: entry.compressed_docs)
+
+            ConceptRecord& record = collection.m_owned_records[concept_id];
+            record.posting_count = doc_count;
+            record.first_block = static_cast<std::uint32_t>(collection.m_owned_blocks.size());
+            record.block_count = block_count;
+            record.first_packed = static_cast<std::uint32_t>(collection.m_owned_packed_docs.size());
+            record.packed_size = packed_size;
+            record.first_weight = static_cast<std::uint32_t>(collection.m_owned_weights.size());
+
+            for (std::uint32_t index = 0; index < block_count; ++index)
             {
-                word = ReadU32(data_bytes + offset);
+                PostingBlock& block = collection.m_owned_blocks.emplace_back();
+                block.last_doc = ReadU32(data_bytes + offset);
                 offset += U32_BYTES;
+                block.offset = ReadU32(data_bytes + offset);
+                offset += U32_BYTES;
+                block.max_weight = ReadU16(data_bytes + offset);
+                offset += U16_BYTES;
+                record.max_weight = std::max(record.max_weight, block.max_weight);
             }
 
-            // WEIGHT_PAIR_BYTES per pair: U32_BYTES (doc_id) + U16_BYTES (weight)
-            if (static_cast<std::size_t>(entry.doc_count) * WEIGHT_PAIR_BYTES >
-                total_bytes - offset)
+            for (std::uint32_t index = 0; index < packed_size; ++index)
             {
-                return collection;
+                collection.m_owned_packed_docs.push_back(ReadU32(data_bytes + offset));
+                offset += U32_BYTES;
             }
-            entry.doc_weights.reserve(entry.doc_count);
-            for (std::uint32_t index = 0; index < entry.doc_count; ++index)
+
+            for (std::uint32_t index = 0; index < doc_count; ++index)
             {
-                const DocId doc_id = ReadU32(data_bytes + offset);
-                offset += U32_BYTES;
-                const Weight weight = ReadU16(data_bytes + offset);
+                collection.m_owned_weights.push_back(ReadU16(data_bytes + offset));
                 offset += U16_BYTES;
-                entry.doc_weights.emplace_back(doc_id, weight);
             }
-            // Sort by DocId for binary-search lookup; also handles old .kfts
-            // files where weight pairs were written in hash-table iteration order.
-            std::ranges::sort(entry.doc_weights, {}, &std::pair<DocId, Weight>::first);
+            collection.UseOwnedPostings();
         }
 
         collection.m_finalized = true;
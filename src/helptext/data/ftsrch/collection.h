@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "postings.h"
 #include "types.h"
 
 #include <cstddef>
@@ -47,18 +48,29 @@ namespace ftsrch
     class Collection
     {
     public:
+        Collection() = default;
+
+        // Not copyable -- the views may point at the owned posting lists
+        Collection(Collection&&) = default;
+        Collection& operator=(Collection&&) = default;
+
         void BeginDocument(DocId doc_id);
         void RecordConcept(ConceptId concept_id);
+        // Records count occurrences at once
+        void RecordConcept(ConceptId concept_id, std::uint16_t count);
         void EndDocument();
         void Finalize(const WeightConfig& config = {});
 
         std::uint32_t DocCount() const;
         std::uint32_t ConceptCount() const;
-        std::span<const std::uint32_t> GetCompressedDocList(ConceptId concept_id) const;
+        PostingList GetPostings(ConceptId concept_id) const;
         Weight GetDocWeight(ConceptId concept_id, DocId doc_id) const;
 
+        // Map() reads the posting lists in place, so data must outlive the collection;
+        // DeserializeV2() copies the posting lists of a version 2 index.
         std::vector<std::uint8_t> Serialize() const;
-        static Collection Deserialize(std::span<const std::byte> data);
+        static Collection Map(std::span<const std::byte> data);
+        static Collection DeserializeV2(std::span<const std::byte> data);
 
     private:
         // Build phase — per-document concept frequencies
@@ -72,18 +84,35 @@ namespace ftsrch
         DocRecord* m_current_doc = nullptr;
         uint32_t m_max_concept_id = 0;
 
-        // After finalize — inverted index per concept
-        struct ConceptEntry
+        // After finalize — the posting lists of all concepts, concatenated. A concept's record
+        // locates its part of each array.
+        struct ConceptRecord
         {
-            std::vector<std::uint32_t> compressed_docs;
-            std::uint32_t doc_count = 0;
-            // weight lookup: sorted by DocId for binary-search access
-            std::vector<std::pair<DocId, Weight>> doc_weights;
+            std::uint32_t posting_count = 0;
+            std::uint32_t first_block = 0;
+            std::uint32_t block_count = 0;
+            std::uint32_t first_packed = 0;  // first word in the packed doc IDs
+            std::uint32_t packed_size = 0;
+            std::uint32_t first_weight = 0;
+            Weight max_weight = 0;
+            std::uint16_t reserved = 0;
         };
 
-        std::vector<ConceptEntry> m_concept_entries;
+        // Points the views at the owned posting lists
+        void UseOwnedPostings();
+
+        std::vector<ConceptRecord> m_owned_records;
+        std::vector<PostingBlock> m_owned_blocks;
+        std::vector<std::uint32_t> m_owned_packed_docs;
+        std::vector<Weight> m_owned_weights;
+
+        // Either the owned vectors or a mapped index
+        std::span<const ConceptRecord> m_records;
+        std::span<const PostingBlock> m_blocks;
+        std::span<const std::uint32_t> m_packed_docs;
+        std::span<const Weight> m_weights;
+
         std::uint32_t m_doc_count = 0;
-        std::uint32_t m_concept_count = 0;
         bool m_finalized = false;
     };
 
@@ -7,6 +7,7 @@
 
 #include "compressor.h"
 
+#include <algorithm>
 #include <bit>
 #include <cassert>
 #include <utility>
@@ -80,6 +81,14 @@ namespace ftsrch
         WriteBits(0, 1);
     }
 
+    void BitWriter::WriteGamma(uint32_t value)
+    {
+        assert(value > 0);
+        const int low_bits = static_cast<int>(std::bit_width(value)) - 1;
+        WriteUnary(static_cast<uint32_t>(low_bits));
+        WriteBits(value, low_bits);  // WriteBits() masks off the leading one
+    }
+
     std::vector<uint32_t> BitWriter::Finish()
     {
         if (m_bit_pos > 0)
@@ -209,6 +218,17 @@ namespace ftsrch
         }
     }
 
+    uint32_t BitReader::ReadGamma()
+    {
+        const uint32_t low_bits = ReadUnary();
+        if (low_bits >= 32)
+        {
+            // Only possible with corrupt data
+            return 0;
+        }
+        return (uint32_t { 1 } << low_bits) | ReadBits(static_cast<int>(low_bits));
+    }
+
     size_t BitReader::BitsRemaining() const
     {
         if (m_data.empty())
@@ -328,4 +348,34 @@ namespace ftsrch
         return result;
     }
 
+    uint32_t DecompressSortedIds(std::span<const uint32_t> packed, uint32_t base,
+                                 std::span<uint32_t> output)
+    {
+        if (packed.empty())
+        {
+            return 0;
+        }
+
+        BitReader reader(packed);
+
+        const int basis_bits = static_cast<int>(reader.ReadBits(kBasisBitsWidth));
+        const uint32_t stored_count = reader.ReadBits(kCountWidth);
+        const uint32_t count = std::min(stored_count, static_cast<uint32_t>(output.size()));
+
+        uint32_t prev = base;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint32_t high_bits = reader.ReadUnary();
+            uint32_t low_bits = 0;
+            if (basis_bits > 0)
+            {
+                low_bits = reader.ReadBits(basis_bits);
+            }
+            prev += (high_bits << basis_bits) | low_bits;
+            output[i] = prev;
+        }
+
+        return count;
+    }
+
 }  // namespace ftsrch
@@ -20,6 +20,9 @@ namespace ftsrch
     public:
         void WriteBits(uint32_t value, int nbits);
         void WriteUnary(uint32_t count);
+        // Elias-gamma code: the bit length in unary, then the bits below the leading one.
+        // value must be at least 1.
+        void WriteGamma(uint32_t value);
         std::vector<uint32_t> Finish();
         size_t BitCount() const;
 
@@ -36,6 +39,7 @@ namespace ftsrch
 
         uint32_t ReadBits(int nbits);
         uint32_t ReadUnary();
+        uint32_t ReadGamma();
         size_t BitsRemaining() const;
 
     private:
@@ -54,4 +58,9 @@ namespace ftsrch
                                               [[maybe_unused]] uint32_t count,
                                               [[maybe_unused]] uint32_t universe_size);
 
+    // Decodes into output without allocating, adding base to every ID. Returns the number of
+    // IDs written, which is the smaller of the stored count and output.size().
+    uint32_t DecompressSortedIds(std::span<const uint32_t> packed, uint32_t base,
+                                 std::span<uint32_t> output);
+
 }  // namespace ftsrch
@@ -8,12 +8,14 @@
 #include "dictionary.h"
 
 #include "compressor.h"
+#include "mapped_file.h"
 #include "tokenizer.h"
 
 #include <algorithm>
 #include <bit>
 #include <cstddef>
 #include <cstring>
+#include <ranges>
 #include <set>
 #include <utility>
 
@@ -43,8 +45,25 @@ namespace ftsrch
             return map_iterator->second;
         }
 
-        const std::string stemmed_word = StemWord(lowered_word);
+        return InsertWord(lowered_word, StemWord(lowered_word));
+    }
+
+    ConceptId Dictionary::AddStemmedWord(const std::string& lowered_word,
+                                         const std::string& stemmed_word)
+    {
+        if (const std::unordered_map<std::string, ConceptId>::iterator map_iterator =
+                m_word_to_concept.find(lowered_word);
+            map_iterator != m_word_to_concept.end())
+        {
+            return map_iterator->second;
+        }
 
+        return InsertWord(lowered_word, stemmed_word);
+    }
+
+    ConceptId Dictionary::InsertWord(const std::string& lowered_word,
+                                     const std::string& stemmed_word)
+    {
         // Check stop list
         if (m_stop_stems.contains(stemmed_word))
         {
@@ -108,29 +127,53 @@ namespace ftsrch
                               return lhs_pair.first < rhs_pair.first;
                           });
 
-        // Split into parallel arrays
-        m_sorted_words.clear();
-        m_sorted_concept_ids.clear();
-        m_sorted_words.reserve(word_pairs.size());
-        m_sorted_concept_ids.reserve(word_pairs.size());
+        // Concatenate the words into the table the query phase searches
+        m_owned_offsets.clear();
+        m_owned_concept_ids.clear();
+        m_owned_chars.clear();
+        m_owned_offsets.reserve(word_pairs.size() + 1);
+        m_owned_concept_ids.reserve(word_pairs.size());
 
-        for (auto& [word, concept_id]: word_pairs)
+        for (const auto& [word, concept_id]: word_pairs)
         {
-            m_sorted_words.push_back(std::move(word));
-            m_sorted_concept_ids.push_back(concept_id);
+            m_owned_offsets.push_back(static_cast<std::uint32_t>(m_owned_chars.size()));
+            m_owned_chars.insert(m_owned_chars.end(), word.begin(), word.end());
+            m_owned_concept_ids.push_back(concept_id);
         }
+        m_owned_offsets.push_back(static_cast<std::uint32_t>(m_owned_chars.size()));
+        UseOwnedTable();
 
-        // Compute bits needed per concept ID: ceil(log2(num_concepts + 1))
-        if (m_num_concepts == 0)
-        {
-            m_concept_id_bits = 1U;
-        }
-        else
+        m_finalized = true;
+    }
+
+    void Dictionary::UseOwnedTable()
+    {
+        m_word_offsets = m_owned_offsets;
+        m_concept_ids = m_owned_concept_ids;
+        m_word_chars = m_owned_chars;
+    }
+
+    std::string_view Dictionary::Word(std::size_t index) const
+    {
+        // A mapped table is never validated as a whole, so a corrupt offset just reads as an
+        // empty word.
+        const std::uint32_t begin = m_word_offsets[index];
+        const std::uint32_t end = m_word_offsets[index + 1];
+        if (begin > end || end > m_word_chars.size())
         {
-            m_concept_id_bits = std::bit_width(m_num_concepts);
+            return {};
         }
+        return { m_word_chars.data() + begin, end - begin };
+    }
 
-        m_finalized = true;
+    std::size_t Dictionary::LowerBound(std::string_view word) const
+    {
+        const auto indexes = std::views::iota(std::size_t { 0 }, m_concept_ids.size());
+        return *std::ranges::partition_point(indexes,
+                                             [&](std::size_t index)
+                                             {
+                                                 return Word(index) < word;
+                                             });
     }
 
     std::optional<ConceptId> Dictionary::Lookup(std::string_view word) const
@@ -145,24 +188,19 @@ namespace ftsrch
         }
 
         // Binary search in sorted word list for the stem
-        std::vector<std::string>::const_iterator word_iterator =
-            std::ranges::lower_bound(m_sorted_words, stemmed_word);
-        if (word_iterator != m_sorted_words.end() && *word_iterator == stemmed_word)
+        std::size_t word_index = LowerBound(stemmed_word);
+        if (word_index < m_concept_ids.size() && Word(word_index) == stemmed_word)
         {
-            const std::size_t concept_index =
-                static_cast<std::size_t>(std::distance(m_sorted_words.begin(), word_iterator));
-            return m_sorted_concept_ids[concept_index];
+            return m_concept_ids[word_index];
         }
 
         // Also try the lowered form (unstemmed) for exact match
         if (lowered_word != stemmed_word)
         {
-            word_iterator = std::ranges::lower_bound(m_sorted_words, lowered_word);
-            if (word_iterator != m_sorted_words.end() && *word_iterator == lowered_word)
+            word_index = LowerBound(lowered_word);
+            if (word_index < m_concept_ids.size() && Word(word_index) == lowered_word)
             {
-                const std::size_t concept_index =
-                    static_cast<std::size_t>(std::distance(m_sorted_words.begin(), word_iterator));
-                return m_sorted_concept_ids[concept_index];
+                return m_concept_ids[word_index];
             }
         }
 
@@ -173,16 +211,12 @@ namespace ftsrch
     {
         const std::string lowered_prefix = Tokenizer::ToLower(prefix);
 
-        std::vector<std::string>::const_iterator word_iterator =
-            std::ranges::lower_bound(m_sorted_words, lowered_prefix);
-
         std::set<ConceptId> unique_concepts;
-        while (word_iterator != m_sorted_words.end() && word_iterator->starts_with(lowered_prefix))
+        for (std::size_t word_index = LowerBound(lowered_prefix);
+             word_index < m_concept_ids.size() && Word(word_index).starts_with(lowered_prefix);
+             ++word_index)
         {
-            const std::size_t concept_index =
-                static_cast<std::size_t>(std::distance(m_sorted_words.begin(), word_iterator));
-            unique_concepts.insert(m_sorted_concept_ids[concept_index]);
-            ++word_iterator;
+            unique_concepts.insert(m_concept_ids[word_index]);
         }
 
         return { unique_concepts.begin(), unique_concepts.end() };
@@ -190,49 +224,48 @@ namespace ftsrch
 
     std::vector<std::uint8_t> Dictionary::Serialize() const
     {
-        std::vector<std::uint8_t> result;
-
-        const std::uint32_t word_count = static_cast<std::uint32_t>(m_sorted_words.size());
-
-        const auto write_u32 = [&](std::uint32_t value)
+        // word_count, num_concepts, char_count, word offsets (word_count + 1), concept IDs,
+        // characters
+        SectionWriter writer;
+        writer.WriteU32(static_cast<std::uint32_t>(m_concept_ids.size()));
+        writer.WriteU32(m_num_concepts);
+        writer.WriteU32(static_cast<std::uint32_t>(m_word_chars.size()));
+        if (m_word_offsets.empty())
         {
-            result.push_back(static_cast<std::uint8_t>(value & 0xFFU));
-            result.push_back(static_cast<std::uint8_t>((value >> 8U) & 0xFFU));
-            result.push_back(static_cast<std::uint8_t>((value >> 16U) & 0xFFU));
-            result.push_back(static_cast<std::uint8_t>((value >> 24U) & 0xFFU));
-        };
-
-        // Header
-        write_u32(word_count);
-        write_u32(m_num_concepts);
-        write_u32(m_concept_id_bits);
-
-        // Sorted words (null-terminated)
-        for (const auto& word: m_sorted_words)
-        {
-            result.insert(result.end(), word.begin(), word.end());
-            result.push_back(0U);
+            writer.WriteU32(0);  // never finalized
         }
+        writer.WriteArray(m_word_offsets);
+        writer.WriteArray(m_concept_ids);
+        writer.WriteArray(m_word_chars);
+        return writer.Finish();
+    }
 
-        // Bit-pack concept IDs
-        BitWriter writer;
-        for (const ConceptId concept_id: m_sorted_concept_ids)
-        {
-            writer.WriteBits(concept_id, static_cast<int>(m_concept_id_bits));
-        }
-        const std::vector<std::uint32_t> packed_words = writer.Finish();
+    Dictionary Dictionary::Map(std::span<const std::byte> data)
+    {
+        Dictionary dict;
 
-        // Write packed data length and data
-        write_u32(static_cast<std::uint32_t>(packed_words.size()));
-        for (const std::uint32_t packed_word: packed_words)
+        SectionReader reader(data);
+        const std::uint32_t word_count = reader.ReadU32();
+        const std::uint32_t num_concepts = reader.ReadU32();
+        const std::uint32_t char_count = reader.ReadU32();
+        const std::span<const std::uint32_t> word_offsets =
+            reader.ReadArray<std::uint32_t>(static_cast<std::size_t>(word_count) + 1);
+        const std::span<const ConceptId> concept_ids = reader.ReadArray<ConceptId>(word_count);
+        const std::span<const char> word_chars = reader.ReadArray<char>(char_count);
+        if (!reader.ok())
         {
-            write_u32(packed_word);
+            return dict;
         }
 
-        return result;
+        dict.m_word_offsets = word_offsets;
+        dict.m_concept_ids = concept_ids;
+        dict.m_word_chars = word_chars;
+        dict.m_num_concepts = num_concepts;
+        dict.m_finalized = true;
+        return dict;
     }
 
-    Dictionary Dictionary::Deserialize(std::span<const std::byte> data)
+    Dictionary Dictionary::DeserializeV2(std::span<const std::byte> data)
     {
         Dictionary dict;
 
@@ -254,22 +287,45 @@ namespace ftsrch
         offset += 4;
         dict.m_num_concepts = read_u32(data.data() + offset);
         offset += 4;
-        dict.m_concept_id_bits = read_u32(data.data() + offset);
+        const std::uint32_t concept_id_bits = read_u32(data.data() + offset);
         offset += 4;
 
+        // Every word takes at least its terminator
+        if (word_count > data.size() - offset || concept_id_bits > 32)
+        {
+            return dict;
+        }
+
         // Read sorted words (null-terminated)
-        dict.m_sorted_words.reserve(word_count);
+        dict.m_owned_offsets.reserve(static_cast<std::size_t>(word_count) + 1);
         for (std::uint32_t index = 0; index < word_count; ++index)
         {
             const char* word_start = std::bit_cast<const char*>(data.data() + offset);
-            const std::size_t word_length = std::strlen(word_start);
-            dict.m_sorted_words.emplace_back(word_start, word_length);
+            const void* terminator = std::memchr(word_start, 0, data.size() - offset);
+            if (!terminator)
+            {
+                return Dictionary();
+            }
+            const std::size_t word_length =
+                static_cast<std::size_t>(static_cast<const char*>(terminator) - word_start);
+            dict.m_owned_offsets.push_back(static_cast<std::uint32_t>(dict.m_owned_chars.size()));
+            dict.m_owned_chars.insert(dict.m_owned_chars.end(), word_start,
+                                      word_start + word_length);
             offset += word_length + 1;
         }
+        dict.m_owned_offsets.push_back(static_cast<std::uint32_t>(dict.m_owned_chars.size()));
 
         // Read packed concept IDs
+        if (data.size() - offset < 4)
+        {
+            return Dictionary();
+        }
         const std::uint32_t packed_count = read_u32(data.data() + offset);
         offset += 4;
+        if (packed_count > (data.size() - offset) / 4)
+        {
+            return Dictionary();
+        }
         std::vector<std::uint32_t> packed_words(packed_count);
         for (std::uint32_t index = 0; index < packed_count; ++index)
         {
@@ -278,17 +334,23 @@ namespace ftsrch
         }
 
         // Unpack concept IDs
-        dict.m_sorted_concept_ids.reserve(word_count);
+        dict.m_owned_concept_ids.reserve(word_count);
         if (!packed_words.empty() && word_count > 0U)
         {
             BitReader reader(packed_words);
             for (std::uint32_t index = 0; index < word_count; ++index)
             {
-                dict.m_sorted_concept_ids.push_back(
-                    reader.ReadBits(static_cast<int>(dict.m_concept_id_bits)));
+                dict.m_owned_concept_ids.push_back(
+                    reader.ReadBits(static_cast<int>(concept_id_bits)));
             }
         }
+        else
+        {
+            dict.m_owned_offsets.resize(1);
+            dict.m_owned_chars.clear();
+        }
 
+        dict.UseOwnedTable();
         dict.m_finalized = true;
         return dict;
     }
@@ -297,7 +359,7 @@ namespace ftsrch
     {
         if (m_finalized)
         {
-            return m_sorted_words.size();
+            return m_concept_ids.size();
         }
         return m_word_to_concept.size();
     }
@@ -27,8 +27,15 @@ namespace ftsrch
     public:
         explicit Dictionary(StemmerFn stemmer = {});
 
+        // Not copyable -- the views may point at the owned word table
+        Dictionary(Dictionary&&) = default;
+        Dictionary& operator=(Dictionary&&) = default;
+
         // Build phase
         ConceptId AddWord(std::string_view word);
+        // Same as AddWord() for a word that has already been lowercased and stemmed
+        ConceptId AddStemmedWord(const std::string& lowered_word,
+                                 const std::string& stemmed_word);
         void AddStopWords(std::span<const std::string> words);
         void Finalize();
 
@@ -36,15 +43,25 @@ namespace ftsrch
         std::optional<ConceptId> Lookup(std::string_view word) const;
         std::vector<ConceptId> PrefixMatch(std::string_view prefix) const;
 
-        // Serialization
+        // Serialization. Map() reads the word table in place, so data must outlive the
+        // dictionary; DeserializeV2() copies a table from a version 2 index.
         std::vector<std::uint8_t> Serialize() const;
-        static Dictionary Deserialize(std::span<const std::byte> data);
+        static Dictionary Map(std::span<const std::byte> data);
+        static Dictionary DeserializeV2(std::span<const std::byte> data);
 
         std::size_t NumWords() const;
         std::size_t NumConcepts() const;
 
     private:
         std::string StemWord(std::string_view lowered) const;
+        ConceptId InsertWord(const std::string& lowered_word, const std::string& stemmed_word);
+
+        // Returns the first word index whose word is >= word
+        std::size_t LowerBound(std::string_view word) const;
+        std::string_view Word(std::size_t index) const;
+
+        // Points the views at the owned word table
+        void UseOwnedTable();
 
         StemmerFn m_stemmer;
 
@@ -54,10 +71,16 @@ namespace ftsrch
         std::unordered_set<std::string> m_stop_stems;
         ConceptId m_next_concept_id = 0;
 
-        // After finalize (also used at query time after deserialize)
-        std::vector<std::string> m_sorted_words;
-        std::vector<ConceptId> m_sorted_concept_ids;
-        std::uint32_t m_concept_id_bits = 0;
+        // After finalize -- the words sorted and concatenated, word i being the characters from
+        // m_word_offsets[i] up to m_word_offsets[i + 1]. The views point either at the owned
+        // vectors or into a mapped index.
+        std::vector<std::uint32_t> m_owned_offsets;
+        std::vector<ConceptId> m_owned_concept_ids;
+        std::vector<char> m_owned_chars;
+
+        std::span<const std::uint32_t> m_word_offsets;
+        std::span<const ConceptId> m_concept_ids;
+        std::span<const char> m_word_chars;
         std::uint32_t m_num_concepts = 0;
         bool m_finalized = false;
     };
@@ -11,18 +11,24 @@
 #include "dictionary.h"
 #include "index_file.h"
 #include "phrase_table.h"
+#include "positions.h"
 #include "query.h"
+#include "shard.h"
+#include "titles.h"
 #include "tokenizer.h"
 
+#include <algorithm>
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
 #include <expected>
 #include <filesystem>
+#include <functional>
+#include <memory>
 #include <optional>
 #include <span>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -43,12 +49,15 @@ namespace ftsrch
         Dictionary dictionary;
         Collection collection;
         PhraseTable phrase_table;
+        PositionIndex positions;
+        bool store_positions = false;
         Tokenizer tokenizer;
         IndexMeta meta;
         WeightConfig weight_config;
-        std::vector<std::pair<DocId, std::string>> titles;
-        mutable std::unordered_map<DocId, std::string> title_lookup;
-        mutable bool title_lookup_valid = false;
+        TitleTable titles;
+
+        // Mapped file or buffer that an opened index is read from
+        std::shared_ptr<const void> storage;
 
         explicit Index(StemmerFn stemmer_fn) : dictionary(std::move(stemmer_fn)) {}
 
@@ -62,7 +71,9 @@ namespace ftsrch
 
     IndexPtr CreateIndex(IndexOptions options)
     {
-        return IndexPtr(new Index(std::move(options.stemmer)));
+        IndexPtr index(new Index(std::move(options.stemmer)));
+        index->store_positions = options.store_positions;
+        return index;
     }
 
     std::expected<void, Error> AddDocument(Index& index, DocId doc_id, std::string_view title,
@@ -75,6 +86,10 @@ namespace ftsrch
 
         index.collection.BeginDocument(doc_id);
 
+        // Every word counts towards the position, including stop words, so that a phrase
+        // containing a stop word only matches words the same distance apart.
+        std::uint32_t position = 0;
+
         // Tokenize and index title words
         const std::vector<Token> title_tokens = index.tokenizer.Tokenize(title);
         for (const Token& token: title_tokens)
@@ -88,9 +103,17 @@ namespace ftsrch
             if (concept_id != STOP_WORD)
             {
                 index.collection.RecordConcept(concept_id);
+                if (index.store_positions)
+                {
+                    index.positions.Record(concept_id, doc_id, position);
+                }
             }
+            ++position;
         }
 
+        // Keep phrases from spanning the title and the body
+        position += FIELD_POSITION_GAP;
+
         // Tokenize and index body text words
         const std::vector<Token> text_tokens = index.tokenizer.Tokenize(text);
         for (const Token& token: text_tokens)
@@ -104,7 +127,12 @@ namespace ftsrch
             if (concept_id != STOP_WORD)
             {
                 index.collection.RecordConcept(concept_id);
+                if (index.store_positions)
+                {
+                    index.positions.Record(concept_id, doc_id, position);
+                }
             }
+            ++position;
         }
 
         index.collection.EndDocument();
@@ -114,86 +142,225 @@ namespace ftsrch
         index.phrase_table.Scan(text);
 
         // Store title for result display
-        index.titles.emplace_back(doc_id, std::string(title));
-        index.title_lookup_valid = false;
+        index.titles.Add(doc_id, title);
 
         return {};
     }
 
-    std::expected<void, Error> SaveIndex(Index& index, const std::filesystem::path& file_path)
+    void IndexShardDeleter::operator()(IndexShard* ptr) const noexcept
+    {
+        delete ptr;
+    }
+
+    IndexShardPtr CreateShard(const Index& index, StemmerFn stemmer)
+    {
+        return IndexShardPtr(new IndexShard(std::move(stemmer), index.store_positions));
+    }
+
+    std::expected<void, Error> AddDocument(IndexShard& shard, DocId doc_id,
+                                           std::string_view title, std::string_view text)
+    {
+        if (shard.IsReleased())
+        {
+            return std::unexpected(Error::index_already_finalized);
+        }
+        shard.AddDocument(doc_id, title, text);
+        return {};
+    }
+
+    // Marks a shard word that hasn't been added to the dictionary yet
+    static constexpr ConceptId UNRESOLVED_CONCEPT = STOP_WORD - 1;
+
+    // Adds one shard document the way AddDocument would add it. concept_ids caches the concept
+    // of every shard word that has been added to the dictionary.
+    static void MergeDocument(Index& index, const IndexShard& shard,
+                              const IndexShard::ShardDocument& document,
+                              std::vector<ConceptId>& concept_ids)
+    {
+        const std::span<const IndexShard::ShardWord> words = shard.Words();
+
+        index.collection.BeginDocument(document.doc_id);
+
+        // The dictionary hands out concept IDs in the order words are first seen, so the words
+        // are added in the order AddDocument would have added them
+        for (const auto& [word_id, count]: document.word_counts)
+        {
+            ConceptId& concept_id = concept_ids[word_id];
+            if (concept_id == UNRESOLVED_CONCEPT)
+            {
+                concept_id = index.dictionary.AddStemmedWord(words[word_id].lowered,
+                                                             words[word_id].stemmed);
+            }
+            if (concept_id != STOP_WORD)
+            {
+                index.collection.RecordConcept(concept_id, count);
+            }
+        }
+
+        if (index.store_positions)
+        {
+            for (std::size_t word_index = 0; word_index < document.words.size(); ++word_index)
+            {
+                const ConceptId concept_id = concept_ids[document.words[word_index]];
+                if (concept_id != STOP_WORD)
+                {
+                    // Body positions start FIELD_POSITION_GAP after the title
+                    const auto position =
+                        static_cast<std::uint32_t>(word_index) +
+                        (word_index < document.title_word_count ? 0 : FIELD_POSITION_GAP);
+                    index.positions.Record(concept_id, document.doc_id, position);
+                }
+            }
+        }
+
+        index.collection.EndDocument();
+
+        index.titles.Add(document.doc_id, document.title);
+    }
+
+    std::expected<void, Error> MergeShards(Index& index, std::span<const IndexShardPtr> shards)
+    {
+        if (index.state != IndexState::building)
+        {
+            return std::unexpected(Error::index_already_finalized);
+        }
+        for (const IndexShardPtr& shard: shards)
+        {
+            if (!shard || shard->IsReleased() || shard->StorePositions() != index.store_positions)
+            {
+                return std::unexpected(Error::invalid_argument);
+            }
+            shard->SortDocuments();
+        }
+
+        // k-way merge by doc ID; documents with the same ID are taken in shard order
+        struct ShardCursor
+        {
+            std::span<const IndexShard::ShardDocument> documents;
+            std::size_t next = 0;
+            std::vector<ConceptId> concept_ids;
+        };
+        std::vector<ShardCursor> cursors;
+        cursors.reserve(shards.size());
+        for (const IndexShardPtr& shard: shards)
+        {
+            ShardCursor& cursor = cursors.emplace_back();
+            cursor.documents = shard->Documents();
+            cursor.concept_ids.assign(shard->Words().size(), UNRESOLVED_CONCEPT);
+        }
+
+        using HeapEntry = std::pair<DocId, std::size_t>;  // next doc ID, shard index
+        std::vector<HeapEntry> heap;
+        for (std::size_t shard_index = 0; shard_index < cursors.size(); ++shard_index)
+        {
+            if (!cursors[shard_index].documents.empty())
+            {
+                heap.emplace_back(cursors[shard_index].documents.front().doc_id, shard_index);
+            }
+        }
+        std::ranges::make_heap(heap, std::greater<> {});
+
+        while (!heap.empty())
+        {
+            std::ranges::pop_heap(heap, std::greater<> {});
+            const std::size_t shard_index = heap.back().second;
+            heap.pop_back();
+
+            ShardCursor& cursor = cursors[shard_index];
+            MergeDocument(index, *shards[shard_index], cursor.documents[cursor.next],
+                          cursor.concept_ids);
+            if (++cursor.next < cursor.documents.size())
+            {
+                heap.emplace_back(cursor.documents[cursor.next].doc_id, shard_index);
+                std::ranges::push_heap(heap, std::greater<> {});
+            }
+        }
+
+        // The phrase statistics are plain counts, so the order they're added in doesn't matter
+        for (const IndexShardPtr& shard: shards)
+        {
+            index.phrase_table.Merge(shard->Phrases());
+            shard->Release();
+        }
+
+        return {};
+    }
+
+    static void FinalizeIndex(Index& index)
     {
         if (index.state == IndexState::building)
         {
             index.dictionary.Finalize();
             index.collection.Finalize(index.weight_config);
             index.phrase_table.Build();
-        }
-
-        std::expected<void, Error> save_result =
-            IndexFile::Save(file_path, index.meta, index.dictionary, index.collection,
-                            index.phrase_table, index.titles);
-        if (save_result)
-        {
+            index.positions.Finalize();
+            index.titles.Finalize();
             index.state = IndexState::finalized;
         }
-        return save_result;
     }
 
-    std::expected<IndexPtr, Error> OpenIndex(const std::filesystem::path& file_path)
+    std::expected<void, Error> SaveIndex(Index& index, const std::filesystem::path& file_path)
+    {
+        FinalizeIndex(index);
+        return IndexFile::Save(file_path, index.meta, index.dictionary, index.collection,
+                               index.phrase_table, index.titles, index.positions);
+    }
+
+    std::vector<std::uint8_t> SerializeIndex(Index& index)
+    {
+        FinalizeIndex(index);
+        return IndexFile::Serialize(index.meta, index.dictionary, index.collection,
+                                    index.phrase_table, index.titles, index.positions);
+    }
+
+    static std::expected<IndexPtr, Error> MakeIndex(std::expected<IndexFile, Error> result)
     {
-        std::expected<IndexFile, Error> result = IndexFile::Open(file_path);
         if (!result)
         {
             return std::unexpected(result.error());
         }
 
+        // The phrase table is only used to build an index, so it's never read here
         IndexPtr index(new Index());
         index->state = IndexState::finalized;
         index->dictionary = result->TakeDictionary();
         index->collection = result->TakeCollection();
-        index->phrase_table = result->TakePhraseTable();
+        index->positions = result->TakePositions();
         index->titles = result->TakeTitles();
         index->meta = result->TakeMeta();
+        index->storage = result->Storage();
 
         return index;
     }
 
+    std::expected<IndexPtr, Error> OpenIndex(const std::filesystem::path& file_path)
+    {
+        return MakeIndex(IndexFile::Open(file_path));
+    }
+
     std::expected<IndexPtr, Error> OpenIndex(std::span<const std::byte> data)
     {
-        std::expected<IndexFile, Error> result = IndexFile::Open(data);
-        if (!result)
-        {
-            return std::unexpected(result.error());
-        }
+        return MakeIndex(IndexFile::Open(data));
+    }
 
-        IndexPtr index(new Index());
-        index->state = IndexState::finalized;
-        index->dictionary = result->TakeDictionary();
-        index->collection = result->TakeCollection();
-        index->phrase_table = result->TakePhraseTable();
-        index->titles = result->TakeTitles();
-        index->meta = result->TakeMeta();
+    std::expected<IndexPtr, Error> OpenIndex(std::span<const std::byte> data,
+                                             std::shared_ptr<const void> owner)
+    {
+        return MakeIndex(IndexFile::Open(data, std::move(owner)));
+    }
 
-        return index;
+    // Distance used by NEAR without a "/n"
+    static constexpr std::uint32_t DEFAULT_NEAR_DISTANCE = 8;
+
+    static bool IsQuote(std::string_view text)
+    {
+        // ASCII, left and right double quotation marks
+        return text == "\"" || text == "\xE2\x80\x9C" || text == "\xE2\x80\x9D";
     }
 
     static std::string FindTitle(const Index& index, DocId doc_id)
     {
-        if (!index.title_lookup_valid)
-        {
-            index.title_lookup.clear();
-            for (const auto& [stored_doc_id, stored_title]: index.titles)
-            {
-                index.title_lookup[stored_doc_id] = stored_title;
-            }
-            index.title_lookup_valid = true;
-        }
-
-        if (index.title_lookup.contains(doc_id))
-        {
-            return index.title_lookup.at(doc_id);
-        }
-        return {};
+        return std::string(index.titles.Find(doc_id));
     }
 
     std::expected<std::vector<QueryResult>, Error> Search(const Index& index,
@@ -222,13 +389,79 @@ namespace ftsrch
         };
         OpState op_state = OpState::optional;
 
-        for (const Token& token: tokens)
+        // Quoted phrase being collected
+        bool in_phrase = false;
+        bool phrase_prohibited = false;
+        bool phrase_can_match = true;
+        std::uint32_t phrase_offset = 0;
+        std::vector<PhraseTerm> phrase_terms;
+
+        // "a NEAR/n b" -- previous_term is a, near_distance is n until b is found
+        std::optional<ConceptId> previous_term;
+        std::optional<std::uint32_t> near_distance;
+
+        // Set if the query contains a phrase or NEAR that no document can match
+        bool no_match = false;
+
+        auto finish_phrase = [&]()
         {
+            if (!phrase_can_match)
+            {
+                // A word that isn't in the index can't be part of any document's phrase
+                no_match = no_match || !phrase_prohibited;
+            }
+            else
+            {
+                parsed_query.AddPhrase(phrase_terms, phrase_prohibited);
+            }
+            in_phrase = false;
+            phrase_terms.clear();
+        };
+
+        for (std::size_t token_index = 0; token_index < tokens.size(); ++token_index)
+        {
+            const Token& token = tokens[token_index];
+            if (token.type == TokenType::symbol && IsQuote(token.text))
+            {
+                if (in_phrase)
+                {
+                    finish_phrase();
+                }
+                else
+                {
+                    in_phrase = true;
+                    phrase_prohibited = (op_state == OpState::prohibited);
+                    phrase_can_match = true;
+                    phrase_offset = 0;
+                    op_state = OpState::optional;
+                    previous_term.reset();
+                    near_distance.reset();
+                }
+                continue;
+            }
+
             if (token.type != TokenType::word)
             {
                 continue;
             }
 
+            if (in_phrase)
+            {
+                // Operators are ordinary words inside a phrase, and stop words still count
+                // towards the position of the next word.
+                const std::optional<ConceptId> concept_id = index.dictionary.Lookup(token.text);
+                if (!concept_id)
+                {
+                    phrase_can_match = false;
+                }
+                else if (*concept_id != STOP_WORD)
+                {
+                    phrase_terms.push_back({ *concept_id, phrase_offset });
+                }
+                ++phrase_offset;
+                continue;
+            }
+
             // Check for operator keywords (full-word, uppercase only)
             if (token.text.size() == 3)
             {
@@ -252,10 +485,39 @@ namespace ftsrch
                     continue;
                 }
             }
+            if (token.text == "NEAR" && previous_term)
+            {
+                near_distance = DEFAULT_NEAR_DISTANCE;
+                // NEAR/n
+                if (token_index + 2 < tokens.size() && tokens[token_index + 1].text == "/" &&
+                    tokens[token_index + 2].type == TokenType::number)
+                {
+                    const std::string_view digits = tokens[token_index + 2].text;
+                    std::uint32_t distance = 0;
+                    if (std::from_chars(digits.data(), digits.data() + digits.size(), distance)
+                            .ec == std::errc {})
+                    {
+                        near_distance = std::clamp(distance, 1U, MAX_NEAR_DISTANCE);
+                    }
+                    token_index += 2;
+                }
+                continue;
+            }
 
             const std::optional<ConceptId> concept_id = index.dictionary.Lookup(token.text);
             if (concept_id && *concept_id != STOP_WORD)
             {
+                if (near_distance && op_state != OpState::prohibited)
+                {
+                    parsed_query.AddNear(*previous_term, *concept_id, *near_distance);
+                }
+                near_distance.reset();
+                previous_term.reset();
+                if (op_state != OpState::prohibited)
+                {
+                    previous_term = concept_id;
+                }
+
                 if (!seen_concepts.insert(*concept_id).second)
                 {
                     op_state = OpState::optional;
@@ -277,10 +539,25 @@ namespace ftsrch
                 // Reset to optional after consuming a term
                 op_state = OpState::optional;
             }
+            else if (!concept_id && near_distance)
+            {
+                // No document contains the second word, so none can have it near the first
+                no_match = true;
+            }
+        }
+        if (in_phrase)
+        {
+            // An unterminated phrase runs to the end of the query
+            finish_phrase();
+        }
+
+        if (no_match)
+        {
+            return std::vector<QueryResult> {};
         }
 
         const std::vector<QueryResult> raw_results =
-            parsed_query.Execute(index.collection, index.dictionary);
+            parsed_query.Execute(index.collection, index.dictionary, index.positions);
 
         std::vector<QueryResult> output {};
         output.reserve(raw_results.size());
@@ -440,7 +717,7 @@ namespace ftsrch
         }
 
         const std::vector<QueryResult> raw_results =
-            parsed_query.Execute(index.collection, index.dictionary);
+            parsed_query.Execute(index.collection, index.dictionary, index.positions);
 
         std::vector<QueryResult> output {};
         output.reserve(raw_results.size());
@@ -35,10 +35,25 @@ namespace ftsrch
     // Owning smart-pointer to an Index.
     using IndexPtr = std::unique_ptr<Index, IndexDeleter>;
 
+    // Opaque partial index.  Use CreateShard to obtain one.
+    class IndexShard;
+
+    struct IndexShardDeleter
+    {
+        void operator()(IndexShard* ptr) const noexcept;
+    };
+
+    // Owning smart-pointer to an IndexShard.
+    using IndexShardPtr = std::unique_ptr<IndexShard, IndexShardDeleter>;
+
     struct IndexOptions
     {
         // Optional stemmer callback.  If empty, no stemming is applied.
         StemmerFn stemmer;
+
+        // Store the position of every word so that phrase and NEAR queries match exact
+        // positions.  Without positions, they only require every word to be in the document.
+        bool store_positions = false;
     };
 
     // A single search result returned by Search or SearchIncremental.
@@ -68,23 +83,66 @@ namespace ftsrch
     // be added.  The file can later be loaded with OpenIndex.
     std::expected<void, Error> SaveIndex(Index& index, const std::filesystem::path& file_path);
 
+    // Finalize the index and return the contents of the .kfts file SaveIndex would write.
+    // The result can be stored elsewhere (e.g., in a ZIP archive) and later loaded with
+    // OpenIndex(std::span<const std::byte>).
+    std::vector<std::uint8_t> SerializeIndex(Index& index);
+
+    // -----------------------------------------------------------------------
+    //  Building on several threads
+    // -----------------------------------------------------------------------
+    //
+    //  Each thread adds documents to its own shard, which does the tokenizing
+    //  and stemming.  MergeShards then adds the documents of all the shards to
+    //  the index, producing exactly the index that calling AddDocument for
+    //  every document in doc_id order would have.
+
+    // Create an empty shard for index.
+    // index  Index returned by CreateIndex; it isn't accessed by the shard.
+    // stemmer  Stemmer for the shard's thread.  It must stem the same way as
+    //          the stemmer the index was created with, but must not share state
+    //          with it (e.g., a separate SnowballStemmer for every shard).
+    IndexShardPtr CreateShard(const Index& index, StemmerFn stemmer);
+
+    // Only the thread that owns the shard may add documents to it.
+    // shard  Shard returned by CreateShard (must not be merged yet).
+    // doc_id  Caller-chosen document identifier (must be unique across all shards).
+    std::expected<void, Error> AddDocument(IndexShard& shard, DocId doc_id,
+                                           std::string_view title, std::string_view text);
+
+    // Merge the documents of every shard into index in doc_id order.  The
+    // shards are left empty and can't be used again.
+    // index  Index the shards were created for (must not be finalized).
+    std::expected<void, Error> MergeShards(Index& index, std::span<const IndexShardPtr> shards);
+
     // -----------------------------------------------------------------------
     //  Searching
     // -----------------------------------------------------------------------
 
     // Open a previously saved .kfts index file for searching.
+    // The file is memory-mapped and searched in place, so opening it
+    // doesn't depend on its size.
     // file_path  Path to a .kfts file produced by SaveIndex.
     std::expected<IndexPtr, Error> OpenIndex(const std::filesystem::path& file_path);
 
     // Open a .kfts index from an in-memory buffer.
     // This avoids writing to a temporary file when the index data is
     // already available in memory (e.g., extracted from a ZIP archive).
+    // The buffer is copied, so it doesn't need to outlive the index.
     // data  Buffer containing the serialized .kfts index.
     std::expected<IndexPtr, Error> OpenIndex(std::span<const std::byte> data);
 
+    // Open a .kfts index from an in-memory buffer without copying it.
+    // data  Buffer containing the serialized .kfts index.
+    // owner  Keeps data alive; the index holds on to it until it is destroyed.
+    std::expected<IndexPtr, Error> OpenIndex(std::span<const std::byte> data,
+                                             std::shared_ptr<const void> owner);
+
     // Run a full-text search against a loaded index.
     // Query tokens support AND (required), NOT (prohibited), and OR (default,
-    // optional).  Results are sorted by descending relevance score.
+    // optional).  A quoted "phrase" must appear in that order (or, after NOT, must
+    // not appear), and "a NEAR/n b" requires a and b within n words of each other
+    // (n defaults to 8).  Results are sorted by descending relevance score.
     // index  Index loaded via OpenIndex.
     // query  Space-separated search terms.
     std::expected<std::vector<QueryResult>, Error> Search(const Index& index,
@@ -7,7 +7,9 @@
 
 #include "index_file.h"
 
-#include <array>
+#include "mapped_file.h"
+
+#include <algorithm>
 #include <bit>
 #include <cstddef>
 #include <cstring>
@@ -16,27 +18,20 @@
 namespace ftsrch
 {
 
-    static void WriteU32(std::ostream& output, std::uint32_t value)
+    static void WriteU32(std::vector<std::uint8_t>& output, std::uint32_t value)
     {
-        const std::array<char, 4> bytes = { static_cast<char>(value & 0xFFU),
-                                            static_cast<char>((value >> 8) & 0xFFU),
-                                            static_cast<char>((value >> 16) & 0xFFU),
-                                            static_cast<char>((value >> 24) & 0xFFU) };
-        output.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        output.push_back(static_cast<std::uint8_t>(value & 0xFFU));
+        output.push_back(static_cast<std::uint8_t>((value >> 8) & 0xFFU));
+        output.push_back(static_cast<std::uint8_t>((value >> 16) & 0xFFU));
+        output.push_back(static_cast<std::uint8_t>((value >> 24) & 0xFFU));
     }
 
-    static void WriteU64(std::ostream& output, std::uint64_t value)
+    static void WriteU64(std::vector<std::uint8_t>& output, std::uint64_t value)
     {
         WriteU32(output, static_cast<std::uint32_t>(value & 0xFFFF'FFFFULL));
         WriteU32(output, static_cast<std::uint32_t>(value >> 32));
     }
 
-    static void WriteBytes(std::ostream& output, const std::vector<std::uint8_t>& data)
-    {
-        output.write(std::bit_cast<const char*>(data.data()),
-                     static_cast<std::streamsize>(data.size()));
-    }
-
     static std::uint32_t ReadU32(const std::byte* data_ptr)
     {
         return static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data_ptr[0])) |
@@ -94,100 +89,28 @@ namespace ftsrch
         return meta;
     }
 
-    static std::vector<std::uint8_t>
-        SerializeTitles(const std::vector<std::pair<DocId, std::string>>& titles)
-    {
-        std::vector<std::uint8_t> result;
-        const std::uint32_t title_count = static_cast<std::uint32_t>(titles.size());
-        result.push_back(static_cast<std::uint8_t>(title_count & 0xFFU));
-        result.push_back(static_cast<std::uint8_t>((title_count >> 8) & 0xFFU));
-        result.push_back(static_cast<std::uint8_t>((title_count >> 16) & 0xFFU));
-        result.push_back(static_cast<std::uint8_t>((title_count >> 24) & 0xFFU));
-        for (const auto& [doc_id, title]: titles)
-        {
-            const DocId title_doc_id = doc_id;
-            result.push_back(static_cast<std::uint8_t>(title_doc_id & 0xFFU));
-            result.push_back(static_cast<std::uint8_t>((title_doc_id >> 8) & 0xFFU));
-            result.push_back(static_cast<std::uint8_t>((title_doc_id >> 16) & 0xFFU));
-            result.push_back(static_cast<std::uint8_t>((title_doc_id >> 24) & 0xFFU));
-            const std::uint32_t title_length = static_cast<std::uint32_t>(title.size());
-            result.push_back(static_cast<std::uint8_t>(title_length & 0xFFU));
-            result.push_back(static_cast<std::uint8_t>((title_length >> 8) & 0xFFU));
-            result.push_back(static_cast<std::uint8_t>((title_length >> 16) & 0xFFU));
-            result.push_back(static_cast<std::uint8_t>((title_length >> 24) & 0xFFU));
-            if (title_length > 0)
-            {
-                result.insert(result.end(), title.begin(), title.end());
-            }
-        }
-        return result;
-    }
-
-    static std::vector<std::pair<DocId, std::string>>
-        DeserializeTitles(std::span<const std::byte> data)
-    {
-        std::vector<std::pair<DocId, std::string>> titles;
-        if (data.size() < 4)
-        {
-            return titles;
-        }
-
-        const std::uint32_t title_count = ReadU32(data.data());
-        std::size_t position = 4;
-        titles.reserve(title_count);
-        for (std::uint32_t i = 0; i < title_count; ++i)
-        {
-            if (position + 8 > data.size())
-            {
-                break;
-            }
-
-            const DocId doc_id = ReadU32(data.data() + position);
-            position += 4;
-            const std::uint32_t title_length = ReadU32(data.data() + position);
-            position += 4;
-            if (position + title_length > data.size())
-            {
-                break;
-            }
-
-            const std::span<const std::byte> title_bytes = data.subspan(position, title_length);
-            titles.emplace_back(doc_id, std::string(std::bit_cast<const char*>(title_bytes.data()),
-                                                    title_bytes.size()));
-            position += title_length;
-        }
-        return titles;
-    }
-
     static constexpr std::size_t HEADER_SIZE = 32;
     static constexpr std::size_t DIR_ENTRY_SIZE = 20;
 
-    std::expected<void, Error>
-        IndexFile::Save(const std::filesystem::path& file, const IndexMeta& meta,
-                        const Dictionary& dict, const Collection& coll, const PhraseTable& phrases,
-                        const std::vector<std::pair<DocId, std::string>>& titles)
+    std::vector<std::uint8_t> IndexFile::Serialize(const IndexMeta& meta, const Dictionary& dict,
+                                                   const Collection& coll,
+                                                   const PhraseTable& phrases,
+                                                   const TitleTable& titles,
+                                                   const PositionIndex& positions)
     {
-        std::ofstream output(file, std::ios::binary);
-        if (!output)
-        {
-            return std::unexpected(Error::io_error);
-        }
+        std::vector<std::uint8_t> output;
+
+        // The positions section is only written if positions were recorded
+        const std::uint32_t section_count = positions.empty() ? 5 : 6;
 
         // Write header placeholder (32 bytes)
-        output.write(KFTS_SIGNATURE, 4);
+        output.insert(output.end(), KFTS_SIGNATURE, KFTS_SIGNATURE + 4);
         WriteU32(output, KFTS_VERSION);
         WriteU32(output, 0);
-        WriteU32(output, 5);
+        WriteU32(output, section_count);
         WriteU64(output, 0);
         WriteU64(output, 0);
 
-        // Serialize all sections
-        const std::vector<std::uint8_t> meta_bytes = SerializeMeta(meta);
-        const std::vector<std::uint8_t> dict_bytes = dict.Serialize();
-        const std::vector<std::uint8_t> coll_bytes = coll.Serialize();
-        const std::vector<std::uint8_t> phrase_bytes = phrases.Serialize();
-        const std::vector<std::uint8_t> title_bytes = SerializeTitles(titles);
-
         // Write each section, record directory entries
         struct SectionInfo
         {
@@ -199,20 +122,27 @@ namespace ftsrch
 
         auto write_section = [&](SectionTag section_tag, const std::vector<std::uint8_t>& data)
         {
-            const std::uint64_t section_offset = static_cast<std::uint64_t>(output.tellp());
-            WriteBytes(output, data);
+            // Every section starts on an aligned offset so that it can be read in place
+            output.resize(
+                (output.size() + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT);
+            const std::uint64_t section_offset = output.size();
+            output.insert(output.end(), data.begin(), data.end());
             sections.push_back(SectionInfo { section_tag, section_offset,
                                              static_cast<std::uint64_t>(data.size()) });
         };
 
-        write_section(SectionTag::meta, meta_bytes);
-        write_section(SectionTag::dictionary, dict_bytes);
-        write_section(SectionTag::collection, coll_bytes);
-        write_section(SectionTag::phrase_table, phrase_bytes);
-        write_section(SectionTag::titles, title_bytes);
+        write_section(SectionTag::meta, SerializeMeta(meta));
+        write_section(SectionTag::dictionary, dict.Serialize());
+        write_section(SectionTag::collection, coll.Serialize());
+        write_section(SectionTag::phrase_table, phrases.Serialize());
+        write_section(SectionTag::titles, titles.Serialize());
+        if (!positions.empty())
+        {
+            write_section(SectionTag::positions, positions.Serialize());
+        }
 
         // Write directory table
-        const std::uint64_t dir_offset = static_cast<std::uint64_t>(output.tellp());
+        const std::uint64_t dir_offset = output.size();
         for (const SectionInfo& section: sections)
         {
             WriteU32(output, static_cast<std::uint32_t>(section.tag));
@@ -221,9 +151,24 @@ namespace ftsrch
         }
 
         // Patch directory_offset in header (at byte offset 16)
-        output.seekp(16);
-        WriteU64(output, dir_offset);
+        std::vector<std::uint8_t> dir_offset_bytes;
+        WriteU64(dir_offset_bytes, dir_offset);
+        std::ranges::copy(dir_offset_bytes, output.begin() + 16);
+
+        return output;
+    }
+
+    std::expected<void, Error>
+        IndexFile::Save(const std::filesystem::path& file, const IndexMeta& meta,
+                        const Dictionary& dict, const Collection& coll, const PhraseTable& phrases,
+                        const TitleTable& titles, const PositionIndex& positions)
+    {
+        const std::vector<std::uint8_t> data =
+            Serialize(meta, dict, coll, phrases, titles, positions);
 
+        std::ofstream output(file, std::ios::binary);
+        output.write(std::bit_cast<const char*>(data.data()),
+                     static_cast<std::streamsize>(data.size()));
         if (!output)
         {
             return std::unexpected(Error::io_error);
@@ -233,37 +178,34 @@ namespace ftsrch
 
     std::expected<IndexFile, Error> IndexFile::Open(const std::filesystem::path& file)
     {
-        // Read entire file into memory, then delegate to the span-based overload.
-        std::ifstream input(file, std::ios::binary | std::ios::ate);
-        if (!input)
-        {
-            return std::unexpected(Error::io_error);
-        }
-
-        const std::size_t file_size = static_cast<std::size_t>(input.tellg());
-        if (file_size < HEADER_SIZE)
+        std::expected<std::shared_ptr<const MappedFile>, Error> mapped = MappedFile::Open(file);
+        if (!mapped)
         {
-            return std::unexpected(Error::corrupt_index);
+            return std::unexpected(mapped.error());
         }
-
-        input.seekg(0);
-        std::vector<std::uint8_t> buffer(file_size);
-        input.read(std::bit_cast<char*>(buffer.data()), static_cast<std::streamsize>(file_size));
-        if (!input)
-        {
-            return std::unexpected(Error::io_error);
-        }
-
-        return Open(std::as_bytes(std::span<const std::uint8_t>(buffer)));
+        const std::span<const std::byte> data = (*mapped)->Data();
+        return Open(data, std::move(*mapped));
     }
 
     std::expected<IndexFile, Error> IndexFile::Open(std::span<const std::byte> data)
+    {
+        std::shared_ptr<const void> owner;
+        const std::span<const std::byte> copy = CopyToAlignedBuffer(data, owner);
+        return Open(copy, std::move(owner));
+    }
+
+    std::expected<IndexFile, Error> IndexFile::Open(std::span<const std::byte> data,
+                                                    std::shared_ptr<const void> owner)
     {
         const std::size_t data_size = data.size();
         if (data_size < HEADER_SIZE)
         {
             return std::unexpected(Error::corrupt_index);
         }
+        if (!IsAlignedForMapping(data))
+        {
+            return Open(data);
+        }
 
         const std::byte* const base = data.data();
 
@@ -273,19 +215,21 @@ namespace ftsrch
             return std::unexpected(Error::corrupt_index);
         }
         const std::uint32_t version = ReadU32(base + 4);
-        if (version != KFTS_VERSION)
+        if (version != KFTS_VERSION && version != KFTS_VERSION_V2)
         {
             return std::unexpected(Error::corrupt_index);
         }
+        const bool is_mapped = (version == KFTS_VERSION);
         const std::uint32_t section_count = ReadU32(base + 12);
         const std::uint64_t dir_offset = ReadU64(base + 16);
 
-        if (dir_offset + (section_count * DIR_ENTRY_SIZE) > data_size)
+        if (dir_offset > data_size ||
+            static_cast<std::uint64_t>(section_count) * DIR_ENTRY_SIZE > data_size - dir_offset)
         {
             return std::unexpected(Error::corrupt_index);
         }
 
-        // Parse directory and deserialize sections
+        // Parse directory and read (or, for version 2, deserialize) sections
         IndexFile idx_file;
         const std::byte* dir_ptr = base + dir_offset;
 
@@ -296,7 +240,7 @@ namespace ftsrch
             const std::uint64_t size = ReadU64(dir_ptr + 12);
             dir_ptr += DIR_ENTRY_SIZE;
 
-            if (offset + size > data_size)
+            if (offset > data_size || size > data_size - offset)
             {
                 return std::unexpected(Error::corrupt_index);
             }
@@ -310,20 +254,34 @@ namespace ftsrch
                     idx_file.m_meta = DeserializeMeta(section_span);
                     break;
                 case SectionTag::dictionary:
-                    idx_file.m_dict = Dictionary::Deserialize(section_span);
+                    idx_file.m_dict = is_mapped ? Dictionary::Map(section_span) :
+                                                  Dictionary::DeserializeV2(section_span);
                     break;
                 case SectionTag::collection:
-                    idx_file.m_coll = Collection::Deserialize(section_span);
+                    idx_file.m_coll = is_mapped ? Collection::Map(section_span) :
+                                                  Collection::DeserializeV2(section_span);
                     break;
                 case SectionTag::phrase_table:
-                    idx_file.m_phrases = PhraseTable::Deserialize(section_span);
+                    idx_file.m_phrase_section = section_span;
                     break;
                 case SectionTag::titles:
-                    idx_file.m_titles = DeserializeTitles(section_span);
+                    idx_file.m_titles = is_mapped ? TitleTable::Map(section_span) :
+                                                    TitleTable::DeserializeV2(section_span);
+                    break;
+                case SectionTag::positions:
+                    idx_file.m_positions = is_mapped ? PositionIndex::Map(section_span) :
+                                                       PositionIndex::DeserializeV2(section_span);
                     break;
             }
         }
 
+        idx_file.m_storage = std::move(owner);
+        if (!is_mapped)
+        {
+            // Everything has been copied out of the file except the phrase table
+            idx_file.GetPhraseTable();
+            idx_file.m_storage.reset();
+        }
         return idx_file;
     }
 
@@ -339,19 +297,23 @@ namespace ftsrch
 
     const PhraseTable& IndexFile::GetPhraseTable()
     {
+        if (!m_phrases_loaded)
+        {
+            m_phrases = PhraseTable::Deserialize(m_phrase_section);
+            m_phrase_section = {};
+            m_phrases_loaded = true;
+        }
         return m_phrases;
     }
 
+    const PositionIndex& IndexFile::GetPositions()
+    {
+        return m_positions;
+    }
+
     std::string_view IndexFile::Title(DocId doc_id)
     {
-        for (const auto& [stored_doc_id, title]: m_titles)
-        {
-            if (stored_doc_id == doc_id)
-            {
-                return title;
-            }
-        }
-        return {};
+        return m_titles.Find(doc_id);
     }
 
     const IndexMeta& IndexFile::Meta()
@@ -371,10 +333,16 @@ namespace ftsrch
 
     PhraseTable IndexFile::TakePhraseTable()
     {
+        GetPhraseTable();
         return std::move(m_phrases);
     }
 
-    std::vector<std::pair<DocId, std::string>> IndexFile::TakeTitles()
+    PositionIndex IndexFile::TakePositions()
+    {
+        return std::move(m_positions);
+    }
+
+    TitleTable IndexFile::TakeTitles()
     {
         return std::move(m_titles);
     }
@@ -384,4 +352,9 @@ namespace ftsrch
         return std::move(m_meta);
     }
 
+    std::shared_ptr<const void> IndexFile::Storage() const
+    {
+        return m_storage;
+    }
+
 }  // namespace ftsrch
@@ -10,12 +10,15 @@
 #include "collection.h"
 #include "dictionary.h"
 #include "phrase_table.h"
+#include "positions.h"
+#include "titles.h"
 #include "types.h"
 
 #include <cstddef>
 #include <cstdint>
 #include <expected>
 #include <filesystem>
+#include <memory>
 #include <span>
 #include <string>
 #include <string_view>
@@ -37,7 +40,8 @@ namespace ftsrch
         dictionary = 2,
         collection = 3,
         phrase_table = 4,
-        titles = 5
+        titles = 5,
+        positions = 6  // optional
     };
 
     struct IndexHeader
@@ -57,36 +61,68 @@ namespace ftsrch
         std::uint64_t size;
     };
 
+    // A version 3 index is read in place: Open() only reads the section headers, and the
+    // dictionary, collection, positions and titles are views into the file data (see
+    // mapped_file.h). Version 2 indexes are still read, by copying them into memory.
     class IndexFile
     {
     public:
+        // Builds the complete version 3 file in memory
+        static std::vector<std::uint8_t> Serialize(const IndexMeta& meta, const Dictionary& dict,
+                                                   const Collection& coll,
+                                                   const PhraseTable& phrases,
+                                                   const TitleTable& titles,
+                                                   const PositionIndex& positions);
+
         static std::expected<void, Error>
             Save(const std::filesystem::path& file, const IndexMeta& meta, const Dictionary& dict,
-                 const Collection& coll, const PhraseTable& phrases,
-                 const std::vector<std::pair<DocId, std::string>>& titles);
+                 const Collection& coll, const PhraseTable& phrases, const TitleTable& titles,
+                 const PositionIndex& positions);
 
+        // Memory-maps the file
         static std::expected<IndexFile, Error> Open(const std::filesystem::path& file);
+
+        // Copies data, so it doesn't need to outlive the IndexFile
         static std::expected<IndexFile, Error> Open(std::span<const std::byte> data);
 
+        // Reads data in place. owner must keep data alive, and is held by the IndexFile (see
+        // Storage()).
+        static std::expected<IndexFile, Error> Open(std::span<const std::byte> data,
+                                                    std::shared_ptr<const void> owner);
+
         const Dictionary& GetDictionary();
         const Collection& GetCollection();
         const PhraseTable& GetPhraseTable();
+        const PositionIndex& GetPositions();
         std::string_view Title(DocId doc_id);
         const IndexMeta& Meta();
 
-        // Transfer ownership (move-out) after Open
+        // Transfer ownership (move-out) after Open. The dictionary, collection, positions and
+        // titles of a version 3 index are only valid while Storage() exists.
         Dictionary TakeDictionary();
         Collection TakeCollection();
         PhraseTable TakePhraseTable();
-        std::vector<std::pair<DocId, std::string>> TakeTitles();
+        PositionIndex TakePositions();
+        TitleTable TakeTitles();
         IndexMeta TakeMeta();
 
+        // The mapped file or buffer a version 3 index is read from (null for version 2)
+        std::shared_ptr<const void> Storage() const;
+
     private:
         IndexMeta m_meta;
         Dictionary m_dict;
         Collection m_coll;
         PhraseTable m_phrases;
-        std::vector<std::pair<DocId, std::string>> m_titles;
+        PositionIndex m_positions;
+        TitleTable m_titles;
+
+        // The phrase table is only needed to build an index, so it isn't read until it's used
+        std::span<const std::byte> m_phrase_section;
+        bool m_phrases_loaded = false;
+
+        // Mapped file or buffer that a version 3 index's sections point into
+        std::shared_ptr<const void> m_storage;
     };
 
 }  // namespace ftsrch
@@ -0,0 +1,197 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Read-only file mapping and in-place access to index sections
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif  // _WIN32
+
+namespace ftsrch
+{
+
+    std::expected<std::shared_ptr<const MappedFile>, Error>
+        MappedFile::Open(const std::filesystem::path& file)
+    {
+        std::shared_ptr<MappedFile> mapped(new MappedFile());
+
+#if defined(_WIN32)
+        const HANDLE file_handle =
+            CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE)
+        {
+            return std::unexpected(Error::io_error);
+        }
+
+        LARGE_INTEGER file_size {};
+        if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart == 0)
+        {
+            CloseHandle(file_handle);
+            return std::unexpected(file_size.QuadPart == 0 ? Error::corrupt_index :
+                                                             Error::io_error);
+        }
+
+        // The mapping keeps the file open, so the file handle isn't needed after this
+        mapped->m_mapping =
+            CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file_handle);
+        if (!mapped->m_mapping)
+        {
+            return std::unexpected(Error::io_error);
+        }
+
+        const void* view = MapViewOfFile(mapped->m_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            return std::unexpected(Error::io_error);
+        }
+        mapped->m_data = static_cast<const std::byte*>(view);
+        mapped->m_size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+        const int file_descriptor = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file_descriptor < 0)
+        {
+            return std::unexpected(Error::io_error);
+        }
+
+        struct stat file_status {};
+        if (::fstat(file_descriptor, &file_status) != 0 || file_status.st_size == 0)
+        {
+            ::close(file_descriptor);
+            return std::unexpected(file_status.st_size == 0 ? Error::corrupt_index :
+                                                              Error::io_error);
+        }
+
+        // The mapping keeps its own reference to the file
+        const auto file_size = static_cast<std::size_t>(file_status.st_size);
+        void* view = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        ::close(file_descriptor);
+        if (view == MAP_FAILED)
+        {
+            return std::unexpected(Error::io_error);
+        }
+        mapped->m_data = static_cast<const std::byte*>(view);
+        mapped->m_size = file_size;
+#endif  // _WIN32
+
+        return mapped;
+    }
+
+    MappedFile::~MappedFile()
+    {
+#if defined(_WIN32)
+        if (m_data)
+        {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping)
+        {
+            CloseHandle(m_mapping);
+        }
+#else
+        if (m_data)
+        {
+            ::munmap(const_cast<std::byte*>(m_data), m_size);
+        }
+#endif  // _WIN32
+    }
+
+    std::span<const std::byte> CopyToAlignedBuffer(std::span<const std::byte> data,
+                                                   std::shared_ptr<const void>& owner)
+    {
+        auto buffer = std::make_shared<std::vector<std::uint32_t>>(
+            (data.size() + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t));
+        std::memcpy(buffer->data(), data.data(), data.size());
+        owner = buffer;
+        return std::as_bytes(std::span(*buffer)).first(data.size());
+    }
+
+    bool IsAlignedForMapping(std::span<const std::byte> data)
+    {
+        return std::bit_cast<std::uintptr_t>(data.data()) % SECTION_ALIGNMENT == 0;
+    }
+
+    // ---------------------------------------------------------------------------
+    // SectionWriter
+    // ---------------------------------------------------------------------------
+
+    void SectionWriter::WriteU32(std::uint32_t value)
+    {
+        m_data.push_back(static_cast<std::uint8_t>(value & 0xFFU));
+        m_data.push_back(static_cast<std::uint8_t>((value >> 8U) & 0xFFU));
+        m_data.push_back(static_cast<std::uint8_t>((value >> 16U) & 0xFFU));
+        m_data.push_back(static_cast<std::uint8_t>((value >> 24U) & 0xFFU));
+    }
+
+    void SectionWriter::WriteU16(std::uint16_t value)
+    {
+        m_data.push_back(static_cast<std::uint8_t>(value & 0xFFU));
+        m_data.push_back(static_cast<std::uint8_t>((value >> 8U) & 0xFFU));
+    }
+
+    void SectionWriter::WriteArray(std::span<const std::uint32_t> values)
+    {
+        m_data.reserve(m_data.size() + (values.size() * sizeof(std::uint32_t)));
+        for (const std::uint32_t value: values)
+        {
+            WriteU32(value);
+        }
+    }
+
+    void SectionWriter::WriteArray(std::span<const std::uint16_t> values)
+    {
+        m_data.reserve(m_data.size() + (values.size() * sizeof(std::uint16_t)));
+        for (const std::uint16_t value: values)
+        {
+            WriteU16(value);
+        }
+        Align();
+    }
+
+    void SectionWriter::WriteArray(std::span<const char> chars)
+    {
+        m_data.insert(m_data.end(), chars.begin(), chars.end());
+        Align();
+    }
+
+    void SectionWriter::Align()
+    {
+        while (m_data.size() % SECTION_ALIGNMENT != 0)
+        {
+            m_data.push_back(0);
+        }
+    }
+
+    // ---------------------------------------------------------------------------
+    // SectionReader
+    // ---------------------------------------------------------------------------
+
+    std::uint32_t SectionReader::ReadU32()
+    {
+        const std::span<const std::uint32_t> value = ReadArray<std::uint32_t>(1);
+        return value.empty() ? 0 : value.front();
+    }
+
+    void SectionReader::Align()
+    {
+        const std::size_t padding =
+            (SECTION_ALIGNMENT - (m_offset % SECTION_ALIGNMENT)) % SECTION_ALIGNMENT;
+        m_offset = std::min(m_offset + padding, m_data.size());
+    }
+
+}  // namespace ftsrch
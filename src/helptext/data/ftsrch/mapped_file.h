@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Read-only file mapping and in-place access to index sections
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Starting with version 3, every section of a .kfts file other than the meta and phrase table
+// sections is a sequence of little-endian arrays of fixed-size records, each starting on a
+// 4-byte boundary. A section can then be searched directly from a memory-mapped file (or any
+// sufficiently aligned buffer) -- opening it only reads the array sizes.
+
+#include "types.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace ftsrch
+{
+
+    static_assert(std::endian::native == std::endian::little,
+                  "index sections are read in place, which requires a little-endian host");
+
+    inline constexpr std::size_t SECTION_ALIGNMENT = 4;
+
+    class MappedFile
+    {
+    public:
+        // The returned mapping stays valid for as long as any copy of the pointer exists.
+        static std::expected<std::shared_ptr<const MappedFile>, Error>
+            Open(const std::filesystem::path& file);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        std::span<const std::byte> Data() const { return { m_data, m_size }; }
+
+    private:
+        MappedFile() = default;
+
+        const std::byte* m_data = nullptr;
+        std::size_t m_size = 0;
+#if defined(_WIN32)
+        void* m_mapping = nullptr;
+#endif  // _WIN32
+    };
+
+    // Copies data into a buffer that is aligned for in-place reading. owner is set to the
+    // buffer, and the returned view is only valid while the buffer exists.
+    std::span<const std::byte> CopyToAlignedBuffer(std::span<const std::byte> data,
+                                                   std::shared_ptr<const void>& owner);
+
+    bool IsAlignedForMapping(std::span<const std::byte> data);
+
+    // Builds a section in the version 3 layout
+    class SectionWriter
+    {
+    public:
+        void WriteU32(std::uint32_t value);
+        void WriteU16(std::uint16_t value);
+
+        // Writes one array and pads it to the next SECTION_ALIGNMENT boundary
+        void WriteArray(std::span<const std::uint32_t> values);
+        void WriteArray(std::span<const std::uint16_t> values);
+        void WriteArray(std::span<const char> chars);
+
+        std::vector<std::uint8_t> Finish() { return std::move(m_data); }
+
+    private:
+        void Align();
+
+        std::vector<std::uint8_t> m_data;
+    };
+
+    // Reads a section written by SectionWriter without copying its arrays. Reading past the end
+    // of the section, or a misaligned array, returns zeros and empty arrays and clears ok().
+    class SectionReader
+    {
+    public:
+        explicit SectionReader(std::span<const std::byte> data) : m_data(data) {}
+
+        std::uint32_t ReadU32();
+
+        // T must be a record whose layout matches what the writer produced for it
+        template <typename T>
+        std::span<const T> ReadArray(std::size_t count)
+        {
+            static_assert(alignof(T) <= SECTION_ALIGNMENT);
+            if (!m_ok || count > (m_data.size() - m_offset) / sizeof(T) ||
+                std::bit_cast<std::uintptr_t>(m_data.data() + m_offset) % alignof(T) != 0)
+            {
+                m_ok = false;
+                return {};
+            }
+            const std::span<const T> result(
+                std::bit_cast<const T*>(m_data.data() + m_offset), count);
+            m_offset += count * sizeof(T);
+            Align();
+            return result;
+        }
+
+        bool ok() const { return m_ok; }
+
+    private:
+        void Align();
+
+        std::span<const std::byte> m_data;
+        std::size_t m_offset = 0;
+        bool m_ok = true;
+    };
+
+}  // namespace ftsrch
@@ -30,6 +30,14 @@ namespace ftsrch
         }
     }
 
+    void PhraseTable::Merge(const PhraseTable& other)
+    {
+        for (const auto& [token, frequency]: other.m_token_freq)
+        {
+            m_token_freq[token] += frequency;
+        }
+    }
+
     void PhraseTable::Build()
     {
         // Sort tokens by frequency descending, tiebreak alphabetically
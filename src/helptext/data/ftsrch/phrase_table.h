@@ -30,6 +30,8 @@ namespace ftsrch
     {
     public:
         void Scan(std::string_view text);
+        // Adds the statistics scanned by another table
+        void Merge(const PhraseTable& other);
         void Build();
         std::vector<std::uint8_t> Compress(std::string_view text);
         std::string Decompress(std::span<const std::byte> data);
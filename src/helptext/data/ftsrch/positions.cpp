@@ -0,0 +1,290 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Per-document word positions for phrase and proximity queries
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include "positions.h"
+
+#include "compressor.h"
+#include "mapped_file.h"
+#include "postings.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace ftsrch
+{
+
+    void PositionIndex::Record(ConceptId concept_id, DocId doc_id, std::uint32_t position)
+    {
+        if (concept_id >= m_occurrences.size())
+        {
+            m_occurrences.resize(static_cast<std::size_t>(concept_id) + 1);
+        }
+        m_occurrences[concept_id].push_back({ doc_id, position });
+    }
+
+    void PositionIndex::Finalize()
+    {
+        if (!m_records.empty())
+        {
+            return;  // already finalized
+        }
+
+        m_owned_records.clear();
+        m_owned_records.resize(m_occurrences.size());
+        m_owned_block_offsets.clear();
+        m_owned_packed.clear();
+
+        for (std::size_t concept_id = 0; concept_id < m_occurrences.size(); ++concept_id)
+        {
+            std::vector<Occurrence>& occurrences = m_occurrences[concept_id];
+            if (occurrences.empty())
+            {
+                continue;
+            }
+
+            // Same order as the posting list: by doc ID, and by position within a document
+            std::ranges::stable_sort(occurrences, {}, &Occurrence::doc_id);
+
+            ConceptRecord& record = m_owned_records[concept_id];
+            record.first_block = static_cast<std::uint32_t>(m_owned_block_offsets.size());
+            BitWriter writer;
+            std::uint32_t posting_index = 0;
+            for (std::size_t start = 0; start < occurrences.size();)
+            {
+                const DocId doc_id = occurrences[start].doc_id;
+                std::size_t end = start + 1;
+                while (end < occurrences.size() && occurrences[end].doc_id == doc_id)
+                {
+                    ++end;
+                }
+
+                if (posting_index % POSTING_BLOCK_SIZE == 0)
+                {
+                    m_owned_block_offsets.push_back(static_cast<std::uint32_t>(writer.BitCount()));
+                }
+
+                writer.WriteGamma(static_cast<std::uint32_t>(end - start));
+                std::uint32_t previous = 0;
+                for (std::size_t index = start; index < end; ++index)
+                {
+                    // The first position is stored plus one, the rest as gaps from the previous
+                    // position -- either way, the value is never zero.
+                    const std::uint32_t position = occurrences[index].position;
+                    writer.WriteGamma(index == start ? position + 1 : position - previous);
+                    previous = position;
+                }
+
+                ++posting_index;
+                start = end;
+            }
+            record.block_count =
+                static_cast<std::uint32_t>(m_owned_block_offsets.size()) - record.first_block;
+
+            const std::vector<std::uint32_t> packed = writer.Finish();
+            record.first_packed = static_cast<std::uint32_t>(m_owned_packed.size());
+            record.packed_size = static_cast<std::uint32_t>(packed.size());
+            m_owned_packed.insert(m_owned_packed.end(), packed.begin(), packed.end());
+        }
+        UseOwnedPositions();
+
+        m_occurrences.clear();
+        m_occurrences.shrink_to_fit();
+    }
+
+    void PositionIndex::UseOwnedPositions()
+    {
+        m_records = m_owned_records;
+        m_block_offsets = m_owned_block_offsets;
+        m_packed = m_owned_packed;
+    }
+
+    bool PositionIndex::empty() const
+    {
+        return m_records.empty();
+    }
+
+    void PositionIndex::GetPositions(ConceptId concept_id, std::uint32_t posting_index,
+                                     std::vector<std::uint32_t>& positions) const
+    {
+        positions.clear();
+        if (concept_id >= m_records.size())
+        {
+            return;
+        }
+
+        // A mapped index is only checked one concept at a time, as its positions are needed
+        const ConceptRecord& record = m_records[concept_id];
+        const std::uint32_t block = posting_index / POSTING_BLOCK_SIZE;
+        if (block >= record.block_count ||
+            static_cast<std::size_t>(record.first_block) + record.block_count >
+                m_block_offsets.size() ||
+            static_cast<std::size_t>(record.first_packed) + record.packed_size > m_packed.size())
+        {
+            return;
+        }
+        const std::uint32_t bit_offset = m_block_offsets[record.first_block + block];
+        if (bit_offset / 32 >= record.packed_size)
+        {
+            return;
+        }
+
+        BitReader reader(
+            m_packed.subspan(record.first_packed + (bit_offset / 32),
+                             record.packed_size - (bit_offset / 32)));
+        reader.ReadBits(static_cast<int>(bit_offset % 32));
+
+        // Skip the earlier postings in the block
+        for (std::uint32_t skip = posting_index % POSTING_BLOCK_SIZE; skip > 0; --skip)
+        {
+            for (std::uint32_t count = reader.ReadGamma(); count > 0; --count)
+            {
+                if (reader.BitsRemaining() == 0)
+                {
+                    return;
+                }
+                reader.ReadGamma();
+            }
+        }
+
+        const std::uint32_t count = reader.ReadGamma();
+        // Every position takes at least one bit, so a larger count can only come from a
+        // corrupt index.
+        if (count == 0 || count > reader.BitsRemaining())
+        {
+            return;
+        }
+        positions.reserve(count);
+        std::uint32_t position = reader.ReadGamma() - 1;
+        positions.push_back(position);
+        for (std::uint32_t index = 1; index < count; ++index)
+        {
+            position += reader.ReadGamma();
+            positions.push_back(position);
+        }
+    }
+
+    std::vector<std::uint8_t> PositionIndex::Serialize() const
+    {
+        // concept_count, block_count, packed_size, concept records, block offsets, packed
+        // positions
+        SectionWriter writer;
+        writer.WriteU32(static_cast<std::uint32_t>(m_records.size()));
+        writer.WriteU32(static_cast<std::uint32_t>(m_block_offsets.size()));
+        writer.WriteU32(static_cast<std::uint32_t>(m_packed.size()));
+        for (const ConceptRecord& record: m_records)
+        {
+            writer.WriteU32(record.first_block);
+            writer.WriteU32(record.block_count);
+            writer.WriteU32(record.first_packed);
+            writer.WriteU32(record.packed_size);
+        }
+        writer.WriteArray(m_block_offsets);
+        writer.WriteArray(m_packed);
+        return writer.Finish();
+    }
+
+    PositionIndex PositionIndex::Map(std::span<const std::byte> data)
+    {
+        static_assert(sizeof(ConceptRecord) == 16 && alignof(ConceptRecord) == 4);
+
+        PositionIndex index;
+
+        SectionReader reader(data);
+        const std::uint32_t concept_count = reader.ReadU32();
+        const std::uint32_t block_count = reader.ReadU32();
+        const std::uint32_t packed_size = reader.ReadU32();
+        const std::span<const ConceptRecord> records =
+            reader.ReadArray<ConceptRecord>(concept_count);
+        const std::span<const std::uint32_t> block_offsets =
+            reader.ReadArray<std::uint32_t>(block_count);
+        const std::span<const std::uint32_t> packed = reader.ReadArray<std::uint32_t>(packed_size);
+        if (!reader.ok())
+        {
+            return index;
+        }
+
+        index.m_records = records;
+        index.m_block_offsets = block_offsets;
+        index.m_packed = packed;
+        return index;
+    }
+
+    PositionIndex PositionIndex::DeserializeV2(std::span<const std::byte> data)
+    {
+        PositionIndex index;
+
+        constexpr std::size_t U32_BYTES = sizeof(std::uint32_t);
+        constexpr std::size_t ENTRY_HEADER_BYTES = 2 * U32_BYTES;  // block_count + packed_size
+
+        const auto ReadU32 = [](const std::byte* data_ptr) -> std::uint32_t
+        {
+            return static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data_ptr[0])) |
+                   (static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data_ptr[1])) << 8U) |
+                   (static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data_ptr[2])) << 16U) |
+                   (static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data_ptr[3])) << 24U);
+        };
+
+        if (data.size() < U32_BYTES)
+        {
+            return index;
+        }
+        const std::size_t total_bytes = data.size();
+        const std::byte* data_bytes = data.data();
+        std::size_t offset = 0;
+
+        const std::uint32_t concept_count = ReadU32(data_bytes);
+        offset += U32_BYTES;
+        if (concept_count > (total_bytes - offset) / ENTRY_HEADER_BYTES)
+        {
+            return index;
+        }
+
+        std::vector<ConceptRecord> records(concept_count);
+        std::vector<std::uint32_t> block_offsets;
+        std::vector<std::uint32_t> packed;
+        for (ConceptRecord& record: records)
+        {
+            if (offset + ENTRY_HEADER_BYTES > total_bytes)
+            {
+                return index;
+            }
+            const std::uint32_t block_count = ReadU32(data_bytes + offset);
+            offset += U32_BYTES;
+            const std::uint32_t packed_size = ReadU32(data_bytes + offset);
+            offset += U32_BYTES;
+
+            if ((static_cast<std::size_t>(block_count) + packed_size) * U32_BYTES >
+                total_bytes - offset)
+            {
+                return index;
+            }
+
+            record = { static_cast<std::uint32_t>(block_offsets.size()), block_count,
+                       static_cast<std::uint32_t>(packed.size()), packed_size };
+            for (std::uint32_t block = 0; block < block_count; ++block)
+            {
+                block_offsets.push_back(ReadU32(data_bytes + offset));
+                offset += U32_BYTES;
+            }
+            for (std::uint32_t word = 0; word < packed_size; ++word)
+            {
+                packed.push_back(ReadU32(data_bytes + offset));
+                offset += U32_BYTES;
+            }
+        }
+
+        // Positions are all or nothing -- a partial table would make phrase queries silently
+        // miss documents.
+        index.m_owned_records = std::move(records);
+        index.m_owned_block_offsets = std::move(block_offsets);
+        index.m_owned_packed = std::move(packed);
+        index.UseOwnedPositions();
+        return index;
+    }
+
+}  // namespace ftsrch
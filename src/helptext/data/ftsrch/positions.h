@@ -0,0 +1,94 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Per-document word positions for phrase and proximity queries
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Positions are optional -- an index saved without them still answers phrase queries, but only
+// at the document level (every word of the phrase somewhere in the document).
+//
+// A concept's positions are stored in the same order as its posting list, so the positions for
+// a document are found from the posting index of a PostingCursor rather than by doc ID. For
+// each posting, the number of positions and then the gaps between them are Elias-gamma coded.
+// The bit offset of every POSTING_BLOCK_SIZE'th posting is recorded so that at most one block
+// of postings has to be skipped over to reach any document.
+
+#include "types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ftsrch
+{
+
+    // Positions are counted in words. The body of a document starts this many positions after
+    // the last word of its title, so that neither a phrase nor a NEAR query can match across
+    // the two.
+    inline constexpr std::uint32_t MAX_NEAR_DISTANCE = 64;
+    inline constexpr std::uint32_t FIELD_POSITION_GAP = MAX_NEAR_DISTANCE + 1;
+
+    class PositionIndex
+    {
+    public:
+        PositionIndex() = default;
+
+        // Not copyable -- the views may point at the owned positions
+        PositionIndex(PositionIndex&&) = default;
+        PositionIndex& operator=(PositionIndex&&) = default;
+
+        // Build phase. Positions within a document must be recorded in increasing order.
+        void Record(ConceptId concept_id, DocId doc_id, std::uint32_t position);
+        void Finalize();
+
+        bool empty() const;
+
+        // Replaces positions with the positions of concept_id in the document at posting_index
+        // in the concept's posting list.
+        void GetPositions(ConceptId concept_id, std::uint32_t posting_index,
+                          std::vector<std::uint32_t>& positions) const;
+
+        // Map() reads the positions in place, so data must outlive the index; DeserializeV2()
+        // copies the positions of a version 2 index.
+        std::vector<std::uint8_t> Serialize() const;
+        static PositionIndex Map(std::span<const std::byte> data);
+        static PositionIndex DeserializeV2(std::span<const std::byte> data);
+
+    private:
+        // Build phase
+        struct Occurrence
+        {
+            DocId doc_id;
+            std::uint32_t position;
+        };
+        std::vector<std::vector<Occurrence>> m_occurrences;
+
+        // After finalize -- the positions of all concepts, concatenated. A concept's record
+        // locates its part of each array.
+        struct ConceptRecord
+        {
+            std::uint32_t first_block = 0;
+            std::uint32_t block_count = 0;
+            std::uint32_t first_packed = 0;
+            std::uint32_t packed_size = 0;
+        };
+
+        // Points the views at the owned positions
+        void UseOwnedPositions();
+
+        std::vector<ConceptRecord> m_owned_records;
+        // bit offset (within the concept's packed words) of every POSTING_BLOCK_SIZE'th posting
+        std::vector<std::uint32_t> m_owned_block_offsets;
+        std::vector<std::uint32_t> m_owned_packed;
+
+        // Either the owned vectors or a mapped index
+        std::span<const ConceptRecord> m_records;
+        std::span<const std::uint32_t> m_block_offsets;
+        std::span<const std::uint32_t> m_packed;
+    };
+
+}  // namespace ftsrch
@@ -0,0 +1,247 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Block-structured posting lists with skip pointers
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include "postings.h"
+
+#include "compressor.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+namespace ftsrch
+{
+
+    Weight BuildPostingBlocks(std::span<const DocId> sorted_doc_ids,
+                              std::span<const Weight> weights, std::vector<PostingBlock>& blocks,
+                              std::vector<std::uint32_t>& packed_docs)
+    {
+        assert(sorted_doc_ids.size() == weights.size());
+
+        Weight list_max_weight = 0;
+        DocId base = 0;
+        std::vector<std::uint32_t> rebased_ids;
+        rebased_ids.reserve(POSTING_BLOCK_SIZE);
+
+        for (std::size_t start = 0; start < sorted_doc_ids.size(); start += POSTING_BLOCK_SIZE)
+        {
+            const std::size_t end =
+                std::min(start + POSTING_BLOCK_SIZE, sorted_doc_ids.size());
+
+            rebased_ids.clear();
+            Weight block_max_weight = 0;
+            for (std::size_t index = start; index < end; ++index)
+            {
+                assert(sorted_doc_ids[index] >= base);
+                rebased_ids.push_back(sorted_doc_ids[index] - base);
+                block_max_weight = std::max(block_max_weight, weights[index]);
+            }
+
+            const DocId last_doc = sorted_doc_ids[end - 1];
+            blocks.push_back({ last_doc, static_cast<std::uint32_t>(packed_docs.size()),
+                               block_max_weight });
+
+            const std::vector<std::uint32_t> packed_block =
+                CompressSortedIds(rebased_ids, last_doc - base + 1);
+            packed_docs.insert(packed_docs.end(), packed_block.begin(), packed_block.end());
+
+            list_max_weight = std::max(list_max_weight, block_max_weight);
+            base = last_doc + 1;
+        }
+
+        return list_max_weight;
+    }
+
+    bool ValidatePostingBlocks(std::span<const PostingBlock> blocks,
+                               std::span<const std::uint32_t> packed_docs,
+                               std::uint32_t doc_count)
+    {
+        const std::size_t expected_blocks =
+            (static_cast<std::size_t>(doc_count) + POSTING_BLOCK_SIZE - 1) / POSTING_BLOCK_SIZE;
+        if (blocks.size() != expected_blocks)
+        {
+            return false;
+        }
+
+        for (std::size_t index = 0; index < blocks.size(); ++index)
+        {
+            const PostingBlock& block = blocks[index];
+            if (block.offset >= packed_docs.size() || block.last_doc == END_OF_POSTINGS)
+            {
+                return false;
+            }
+            if (index == 0 ? block.offset != 0 :
+                             (block.offset <= blocks[index - 1].offset ||
+                              block.last_doc <= blocks[index - 1].last_doc))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // ---------------------------------------------------------------------------
+    // PostingCursor
+    // ---------------------------------------------------------------------------
+
+    PostingCursor::PostingCursor(const PostingList& postings) : m_postings(postings)
+    {
+        if (!m_postings.empty())
+        {
+            LoadBlock(0);
+            m_doc = m_block_docs[0];
+        }
+    }
+
+    void PostingCursor::LoadBlock(std::uint32_t block)
+    {
+        const PostingBlock& info = m_postings.blocks[block];
+        const std::size_t end_offset = (block + 1 < m_postings.blocks.size()) ?
+                                           m_postings.blocks[block + 1].offset :
+                                           m_postings.packed_docs.size();
+        const DocId base = (block > 0) ? m_postings.blocks[block - 1].last_doc + 1 : 0;
+
+        m_block_count =
+            std::min(POSTING_BLOCK_SIZE, m_postings.size() - (block * POSTING_BLOCK_SIZE));
+        const std::uint32_t decoded = DecompressSortedIds(
+            m_postings.packed_docs.subspan(info.offset, end_offset - info.offset), base,
+            std::span(m_block_docs).first(m_block_count));
+
+        // Only a corrupt index stores fewer IDs than the posting count says it should, or IDs
+        // past the end of the block -- callers rely on neither happening.
+        std::fill(m_block_docs.begin() + decoded, m_block_docs.begin() + m_block_count,
+                  info.last_doc);
+        for (DocId& doc_id: std::span(m_block_docs).first(decoded))
+        {
+            doc_id = std::min(doc_id, info.last_doc);
+        }
+
+        m_block = block;
+    }
+
+    std::uint32_t PostingCursor::FindBlock(std::uint32_t from, DocId target) const
+    {
+        const std::span<const PostingBlock> blocks = m_postings.blocks;
+        const auto block_count = static_cast<std::uint32_t>(blocks.size());
+
+        // Gallop forward to bracket the block, then binary search within the bracket
+        std::uint32_t low = from;
+        std::uint32_t high = from;
+        std::uint32_t step = 1;
+        while (high < block_count && blocks[high].last_doc < target)
+        {
+            low = high + 1;
+            high += step;
+            step *= 2;
+        }
+        high = std::min(high, block_count);
+
+        const auto found = std::partition_point(blocks.begin() + low, blocks.begin() + high,
+                                                [target](const PostingBlock& block)
+                                                {
+                                                    return block.last_doc < target;
+                                                });
+        return static_cast<std::uint32_t>(found - blocks.begin());
+    }
+
+    void PostingCursor::Next()
+    {
+        if (m_doc == END_OF_POSTINGS)
+        {
+            return;
+        }
+
+        ++m_index;
+        if (m_index >= m_postings.size())
+        {
+            m_doc = END_OF_POSTINGS;
+            return;
+        }
+        if (m_index % POSTING_BLOCK_SIZE == 0)
+        {
+            LoadBlock(m_index / POSTING_BLOCK_SIZE);
+        }
+        m_doc = m_block_docs[m_index % POSTING_BLOCK_SIZE];
+    }
+
+    void PostingCursor::Advance(DocId target)
+    {
+        while (m_doc < target)
+        {
+            if (target > m_postings.blocks[m_block].last_doc)
+            {
+                const std::uint32_t block = FindBlock(m_block + 1, target);
+                if (block >= m_postings.blocks.size())
+                {
+                    m_index = m_postings.size();
+                    m_doc = END_OF_POSTINGS;
+                    return;
+                }
+                LoadBlock(block);
+                m_index = block * POSTING_BLOCK_SIZE;
+            }
+
+            // Gallop within the decoded block
+            const std::uint32_t start = m_index % POSTING_BLOCK_SIZE;
+            std::uint32_t low = start;
+            std::uint32_t high = start;
+            std::uint32_t step = 1;
+            while (high < m_block_count && m_block_docs[high] < target)
+            {
+                low = high + 1;
+                high += step;
+                step *= 2;
+            }
+            high = std::min(high, m_block_count);
+            const auto* found =
+                std::lower_bound(m_block_docs.data() + low, m_block_docs.data() + high, target);
+            const auto position = static_cast<std::uint32_t>(found - m_block_docs.data());
+
+            m_index = (m_block * POSTING_BLOCK_SIZE) + position;
+            if (position < m_block_count)
+            {
+                m_doc = m_block_docs[position];
+            }
+            else if (m_block + 1 < m_postings.blocks.size())
+            {
+                // Can only happen with a corrupt block -- continue with the next one
+                LoadBlock(m_block + 1);
+                m_index = m_block * POSTING_BLOCK_SIZE;
+                m_doc = m_block_docs[0];
+            }
+            else
+            {
+                m_index = m_postings.size();
+                m_doc = END_OF_POSTINGS;
+            }
+        }
+    }
+
+    bool PostingCursor::ShallowAdvance(DocId target)
+    {
+        if (m_doc == END_OF_POSTINGS)
+        {
+            return false;
+        }
+
+        // A previous call may have selected a block past target
+        std::uint32_t from = m_block;
+        if (m_shallow_block > m_block && m_postings.blocks[m_shallow_block - 1].last_doc < target)
+        {
+            from = m_shallow_block;
+        }
+
+        const std::uint32_t block = FindBlock(from, target);
+        if (block >= m_postings.blocks.size())
+        {
+            return false;
+        }
+        m_shallow_block = block;
+        return true;
+    }
+
+}  // namespace ftsrch
@@ -0,0 +1,113 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Block-structured posting lists with skip pointers
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// A concept's posting list is split into blocks of POSTING_BLOCK_SIZE documents. Each block's
+// doc IDs are compressed independently (relative to the last doc ID of the previous block), and
+// the skip table records the last doc ID, the word offset of the packed data and the largest
+// weight of every block. A PostingCursor uses the skip table to jump over blocks without
+// decoding them, and the per-block maximum weights let the query evaluator skip blocks that
+// can't contribute enough to a document's score to put it in the top results.
+
+#include "types.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace ftsrch
+{
+
+    inline constexpr std::uint32_t POSTING_BLOCK_SIZE = 128;
+
+    // Returned by PostingCursor::Doc() once the cursor has moved past the last posting
+    inline constexpr DocId END_OF_POSTINGS = std::numeric_limits<DocId>::max();
+
+    struct PostingBlock
+    {
+        DocId last_doc = 0;        // largest doc ID in the block
+        std::uint32_t offset = 0;  // first word of the block in the packed doc IDs
+        Weight max_weight = 0;     // largest weight of any posting in the block
+    };
+
+    // Version 3 indexes store the skip table in this exact layout so that it can be read in place
+    static_assert(sizeof(PostingBlock) == 12 && alignof(PostingBlock) == 4);
+
+    // Non-owning view of one concept's postings
+    struct PostingList
+    {
+        std::span<const PostingBlock> blocks;
+        std::span<const std::uint32_t> packed_docs;
+        std::span<const Weight> weights;  // one per posting, in doc ID order
+        Weight max_weight = 0;
+
+        bool empty() const { return weights.empty(); }
+        std::uint32_t size() const { return static_cast<std::uint32_t>(weights.size()); }
+    };
+
+    // Compresses sorted_doc_ids into blocks, appending to blocks and packed_docs. weights must
+    // be parallel to sorted_doc_ids. Returns the largest weight.
+    Weight BuildPostingBlocks(std::span<const DocId> sorted_doc_ids,
+                              std::span<const Weight> weights, std::vector<PostingBlock>& blocks,
+                              std::vector<std::uint32_t>& packed_docs);
+
+    // Returns true if the skip table is consistent with the packed data and posting count.
+    bool ValidatePostingBlocks(std::span<const PostingBlock> blocks,
+                               std::span<const std::uint32_t> packed_docs,
+                               std::uint32_t doc_count);
+
+    // Forward iterator over a PostingList. Blocks are only decoded when the cursor lands in
+    // them.
+    class PostingCursor
+    {
+    public:
+        explicit PostingCursor(const PostingList& postings);
+
+        // Current doc ID, or END_OF_POSTINGS
+        DocId Doc() const { return m_doc; }
+        Weight CurrentWeight() const { return m_postings.weights[m_index]; }
+
+        // Index of the current posting in the list
+        std::uint32_t Index() const { return m_index; }
+
+        // Largest weight in the entire list
+        Weight MaxWeight() const { return m_postings.max_weight; }
+
+        // Moves to the next posting.
+        void Next();
+
+        // Moves to the first posting with a doc ID >= target. Never moves backwards.
+        void Advance(DocId target);
+
+        // Moves the block position (but not the current posting) to the block that would
+        // contain target, without decoding it. Returns false if target is past the last block.
+        bool ShallowAdvance(DocId target);
+
+        // Last doc ID and maximum weight of the block selected by ShallowAdvance()
+        DocId BlockLastDoc() const { return m_postings.blocks[m_shallow_block].last_doc; }
+        Weight BlockMaxWeight() const { return m_postings.blocks[m_shallow_block].max_weight; }
+
+    private:
+        // Returns the first block at or after from whose last doc ID is >= target, or the
+        // block count if there isn't one.
+        std::uint32_t FindBlock(std::uint32_t from, DocId target) const;
+        void LoadBlock(std::uint32_t block);
+
+        DocId m_doc = END_OF_POSTINGS;
+        std::uint32_t m_index = 0;          // index of the current posting in the list
+        std::uint32_t m_block = 0;          // block m_block_docs was decoded from
+        std::uint32_t m_block_count = 0;    // number of docs decoded into m_block_docs
+        std::uint32_t m_shallow_block = 0;  // block selected by ShallowAdvance()
+
+        PostingList m_postings;
+        std::array<DocId, POSTING_BLOCK_SIZE> m_block_docs {};
+    };
+
+}  // namespace ftsrch
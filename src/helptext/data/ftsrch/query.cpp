@@ -7,17 +7,219 @@
 
 #include "query.h"
 
-#include "compressor.h"
 #include "ftsrch.h"
+#include "postings.h"
 
 #include <algorithm>
-#include <unordered_map>
-#include <unordered_set>
+#include <cstddef>
+#include <limits>
 #include <utility>
 
 namespace ftsrch
 {
 
+    namespace
+    {
+        // Scores are compared with bounds that sum the same values in a different order, so
+        // allow for float rounding before deciding a document can't make it into the results.
+        constexpr float kBoundSlack = 1e-5F;
+
+        // With more optional terms than this (typically a short prefix in an incremental
+        // search), nearly every document has to be scored anyway, and walking each list once
+        // into a dense score array is faster than keeping hundreds of cursors in doc order.
+        constexpr std::size_t kMaxWandTerms = 8;
+
+        // The dense score array is indexed by doc ID, so it is only used when the doc IDs are
+        // reasonably compact.
+        constexpr std::uint32_t kDenseScoreFactor = 4;
+
+        float Score(Weight weight, float boost)
+        {
+            return (static_cast<float>(weight) / static_cast<float>(WT_ONE)) * boost;
+        }
+
+        struct ScoredTerm
+        {
+            ScoredTerm(const PostingList& postings, float term_boost, bool is_required,
+                       std::size_t term_position) :
+                cursor(postings), boost(term_boost),
+                upper_bound(std::max(Score(postings.max_weight, term_boost), 0.0F)),
+                size(postings.size()), last_doc(postings.blocks.back().last_doc),
+                position(term_position), required(is_required)
+            {
+            }
+
+            PostingCursor cursor;
+            float boost;
+            float upper_bound;  // largest contribution this term can make to a score
+            std::uint32_t size;
+            DocId last_doc;
+            std::size_t position;  // index in the order the scores are summed in
+            bool required;
+        };
+
+        // Keeps the max_results best documents. Documents are offered in increasing doc ID
+        // order, so a document that ties the lowest score never replaces it.
+        class TopResults
+        {
+        public:
+            explicit TopResults(std::uint32_t max_results) : m_max_results(max_results) {}
+
+            // A document needs a score higher than this to be added
+            float Threshold() const
+            {
+                return (m_heap.size() < m_max_results) ? -std::numeric_limits<float>::infinity() :
+                                                         m_heap.front().score;
+            }
+
+            void Offer(DocId doc_id, float score)
+            {
+                if (m_heap.size() < m_max_results)
+                {
+                    m_heap.push_back({ doc_id, score, {} });
+                    std::ranges::push_heap(m_heap, IsBetter);
+                }
+                else if (score > m_heap.front().score)
+                {
+                    std::ranges::pop_heap(m_heap, IsBetter);
+                    m_heap.back() = { doc_id, score, {} };
+                    std::ranges::push_heap(m_heap, IsBetter);
+                }
+            }
+
+            // Returns the results sorted by descending score
+            std::vector<QueryResult> Take()
+            {
+                std::ranges::sort(m_heap, IsBetter);
+                return std::move(m_heap);
+            }
+
+        private:
+            static bool IsBetter(const QueryResult& lhs, const QueryResult& rhs)
+            {
+                return lhs.score > rhs.score || (lhs.score == rhs.score && lhs.doc_id < rhs.doc_id);
+            }
+
+            // Heap ordered so that the worst result is at the front
+            std::vector<QueryResult> m_heap;
+            std::uint32_t m_max_results;
+        };
+
+        // order is sorted by current doc ID, except for the first moved_count terms whose
+        // cursors have just moved forward. Each of them is moved to its place in the sorted
+        // remainder, which is cheaper than sorting the whole list when it is long.
+        void ResortByDoc(std::vector<ScoredTerm*>& order, std::size_t moved_count)
+        {
+            for (std::size_t index = moved_count; index-- > 0;)
+            {
+                const DocId doc_id = order[index]->cursor.Doc();
+                const auto insert_at = std::upper_bound(order.begin() + index + 1, order.end(),
+                                                        doc_id,
+                                                        [](DocId lhs, const ScoredTerm* rhs)
+                                                        {
+                                                            return lhs < rhs->cursor.Doc();
+                                                        });
+                std::rotate(order.begin() + index, order.begin() + index + 1, insert_at);
+            }
+        }
+
+        // Checks a phrase or NEAR constraint. Documents must be checked in increasing doc ID
+        // order.
+        class PhraseMatcher
+        {
+        public:
+            PhraseMatcher(const Collection& collection, const PositionIndex& positions,
+                          std::span<const PhraseTerm> terms, std::uint32_t max_distance) :
+                m_positions(positions), m_max_distance(max_distance)
+            {
+                m_terms.reserve(terms.size());
+                for (const PhraseTerm& term: terms)
+                {
+                    m_terms.push_back({ term.concept_id, term.offset,
+                                        PostingCursor(collection.GetPostings(term.concept_id)),
+                                        {} });
+                }
+            }
+
+            // Returns false if no document can match
+            bool CanMatch() const
+            {
+                return std::ranges::none_of(m_terms,
+                                            [](const Term& term)
+                                            {
+                                                return term.cursor.Doc() == END_OF_POSTINGS;
+                                            });
+            }
+
+            bool Matches(DocId doc_id)
+            {
+                for (Term& term: m_terms)
+                {
+                    term.cursor.Advance(doc_id);
+                    if (term.cursor.Doc() != doc_id)
+                    {
+                        return false;
+                    }
+                }
+                if (m_positions.empty())
+                {
+                    return true;
+                }
+
+                for (Term& term: m_terms)
+                {
+                    m_positions.GetPositions(term.concept_id, term.cursor.Index(),
+                                             term.positions);
+                }
+
+                const Term& first = m_terms.front();
+                if (m_max_distance > 0)
+                {
+                    const std::vector<std::uint32_t>& other = m_terms.back().positions;
+                    return std::ranges::any_of(
+                        first.positions,
+                        [&](std::uint32_t position)
+                        {
+                            const std::uint32_t low =
+                                (position > m_max_distance) ? position - m_max_distance : 0;
+                            const auto found = std::ranges::lower_bound(other, low);
+                            return found != other.end() && *found <= position + m_max_distance;
+                        });
+                }
+
+                return std::ranges::any_of(
+                    first.positions,
+                    [&](std::uint32_t position)
+                    {
+                        if (position < first.offset)
+                        {
+                            return false;
+                        }
+                        const std::uint32_t start = position - first.offset;
+                        return std::all_of(m_terms.begin() + 1, m_terms.end(),
+                                           [start](const Term& term)
+                                           {
+                                               return std::ranges::binary_search(
+                                                   term.positions, start + term.offset);
+                                           });
+                    });
+            }
+
+        private:
+            struct Term
+            {
+                ConceptId concept_id;
+                std::uint32_t offset;
+                PostingCursor cursor;
+                std::vector<std::uint32_t> positions;
+            };
+
+            const PositionIndex& m_positions;
+            std::vector<Term> m_terms;
+            std::uint32_t m_max_distance;
+        };
+    }  // namespace
+
     void Query::AddTerm(ConceptId concept_id, float boost)
     {
         m_terms.push_back({ concept_id, boost });
@@ -45,172 +247,396 @@ namespace ftsrch
         m_prohibited_concepts.push_back(concept_id);
     }
 
+    void Query::AddPhrase(std::span<const PhraseTerm> terms, bool prohibited)
+    {
+        if (terms.empty())
+        {
+            return;
+        }
+        Constraint constraint { { terms.begin(), terms.end() }, 0 };
+        if (prohibited)
+        {
+            m_prohibited_constraints.push_back(std::move(constraint));
+        }
+        else
+        {
+            m_constraints.push_back(std::move(constraint));
+        }
+    }
+
+    void Query::AddNear(ConceptId first, ConceptId second, std::uint32_t max_distance)
+    {
+        m_constraints.push_back({ { { first, 0 }, { second, 0 } }, std::max(max_distance, 1U) });
+    }
+
     std::vector<QueryResult> Query::Execute(const Collection& collection,
                                             [[maybe_unused]] const Dictionary& dictionary,
+                                            const PositionIndex& positions,
                                             std::uint32_t max_results)
     {
-        const std::uint32_t doc_count = collection.DocCount();
+        if (max_results == 0)
+        {
+            return {};
+        }
 
-        // Phase A+B: Collect required term doc sets and intersect into candidate_set
-        std::unordered_set<DocId> candidate_set;
-        const bool has_required = !m_required_terms.empty();
+        // Every term of a phrase or NEAR constraint is required
+        std::vector<ConceptId> constrained_concepts;
+        for (const Constraint& constraint: m_constraints)
+        {
+            for (const PhraseTerm& term: constraint.terms)
+            {
+                constrained_concepts.push_back(term.concept_id);
+            }
+        }
+        auto is_constrained = [&constrained_concepts](ConceptId concept_id)
+        {
+            return std::ranges::find(constrained_concepts, concept_id) !=
+                   constrained_concepts.end();
+        };
 
-        if (has_required)
+        // Phase A: Open a cursor for every scoring term. The order is the order the scores
+        // are summed in: optional terms, then required terms, then prefix groups.
+        std::vector<ScoredTerm> terms;
+        terms.reserve(m_terms.size() + m_required_terms.size() + constrained_concepts.size());
+        auto add_required = [&](ConceptId concept_id, float boost)
         {
-            bool first = true;
-            for (const auto& term: m_required_terms)
+            const PostingList postings = collection.GetPostings(concept_id);
+            if (postings.empty())
             {
-                const std::span<const std::uint32_t> packed =
-                    collection.GetCompressedDocList(term.concept_id);
-                if (packed.empty())
+                return false;
+            }
+            terms.emplace_back(postings, boost, true, terms.size());
+            return true;
+        };
+        std::vector<ConceptId> required_concepts;
+        for (const auto& term: m_terms)
+        {
+            if (is_constrained(term.concept_id))
+            {
+                if (!add_required(term.concept_id, term.boost))
                 {
-                    // Required term has no matching docs — intersection is empty
                     return {};
                 }
-
-                const std::uint32_t header_word = packed[0];
-                const std::vector<std::uint32_t> doc_ids =
-                    DecompressSortedIds(packed, 0, doc_count);
-
-                if (first)
+                required_concepts.push_back(term.concept_id);
+            }
+            else if (const PostingList postings = collection.GetPostings(term.concept_id);
+                     !postings.empty())
+            {
+                terms.emplace_back(postings, term.boost, false, terms.size());
+            }
+        }
+        for (const auto& term: m_required_terms)
+        {
+            if (!add_required(term.concept_id, term.boost))
+            {
+                // Required term has no matching docs — intersection is empty
+                return {};
+            }
+            required_concepts.push_back(term.concept_id);
+        }
+        for (const ConceptId concept_id: constrained_concepts)
+        {
+            if (std::ranges::find(required_concepts, concept_id) == required_concepts.end())
+            {
+                if (!add_required(concept_id, 1.0F))
                 {
-                    candidate_set.insert(doc_ids.begin(), doc_ids.end());
-                    first = false;
+                    return {};
                 }
-                else
+                required_concepts.push_back(concept_id);
+            }
+        }
+        for (const auto& group: m_prefix_groups)
+        {
+            for (const ConceptId concept_id: group.concepts)
+            {
+                if (const PostingList postings = collection.GetPostings(concept_id);
+                    !postings.empty())
                 {
-                    // Intersect with existing set
-                    for (std::unordered_set<DocId>::iterator it = candidate_set.begin();
-                         it != candidate_set.end();)
-                    {
-                        if (!std::ranges::binary_search(doc_ids, *it))
-                        {
-                            it = candidate_set.erase(it);
-                        }
-                        else
-                        {
-                            ++it;
-                        }
-                    }
-                    if (candidate_set.empty())
-                    {
-                        return {};
-                    }
+                    terms.emplace_back(postings, group.boost, false, terms.size());
                 }
             }
         }
+        if (terms.empty())
+        {
+            return {};
+        }
 
-        // Phase C: Collect prohibited docs for subtraction
-        std::unordered_set<DocId> prohibited_set;
-        const bool has_prohibited = !m_prohibited_concepts.empty();
+        std::vector<PostingCursor> prohibited;
+        for (const ConceptId concept_id: m_prohibited_concepts)
+        {
+            if (const PostingList postings = collection.GetPostings(concept_id); !postings.empty())
+            {
+                prohibited.emplace_back(postings);
+            }
+        }
 
-        if (has_prohibited)
+        std::vector<PhraseMatcher> prohibited_phrases;
+        for (const Constraint& constraint: m_prohibited_constraints)
         {
-            for (const ConceptId concept_id: m_prohibited_concepts)
+            PhraseMatcher matcher(collection, positions, constraint.terms,
+                                  constraint.max_distance);
+            if (matcher.CanMatch())
             {
-                const std::span<const std::uint32_t> packed =
-                    collection.GetCompressedDocList(concept_id);
-                if (packed.empty())
-                {
-                    continue;
-                }
+                prohibited_phrases.push_back(std::move(matcher));
+            }
+        }
+
+        std::vector<PhraseMatcher> phrases;
+        for (const Constraint& constraint: m_constraints)
+        {
+            phrases.emplace_back(collection, positions, constraint.terms, constraint.max_distance);
+        }
 
-                const std::uint32_t header_word = packed[0];
-                const std::vector<std::uint32_t> doc_ids =
-                    DecompressSortedIds(packed, 0, doc_count);
+        // Documents are always visited in increasing doc ID order, so the prohibited and
+        // phrase cursors only ever move forward.
+        auto is_prohibited = [&prohibited, &prohibited_phrases](DocId doc_id)
+        {
+            return std::ranges::any_of(prohibited,
+                                       [doc_id](PostingCursor& cursor)
+                                       {
+                                           cursor.Advance(doc_id);
+                                           return cursor.Doc() == doc_id;
+                                       }) ||
+                   std::ranges::any_of(prohibited_phrases,
+                                       [doc_id](PhraseMatcher& matcher)
+                                       {
+                                           return matcher.Matches(doc_id);
+                                       });
+        };
+        auto phrases_match = [&phrases](DocId doc_id)
+        {
+            return std::ranges::all_of(phrases,
+                                       [doc_id](PhraseMatcher& matcher)
+                                       {
+                                           return matcher.Matches(doc_id);
+                                       });
+        };
 
-                for (const DocId doc_id: doc_ids)
+        // Every term whose cursor is on doc_id contributes to the score
+        auto score_doc = [&terms](DocId doc_id)
+        {
+            float score = 0.0F;
+            for (const ScoredTerm& term: terms)
+            {
+                if (term.cursor.Doc() == doc_id)
                 {
-                    prohibited_set.insert(doc_id);
-                    if (has_required)
-                    {
-                        candidate_set.erase(doc_id);
-                    }
+                    score += Score(term.cursor.CurrentWeight(), term.boost);
                 }
             }
-        }
+            return score;
+        };
 
-        // Phase D: Score only candidates
-        std::unordered_map<DocId, float> doc_scores;
+        TopResults top_results(max_results);
 
-        // Helper: accumulate score from a concept's doc list,
-        // skipping documents outside the candidate set.
-        auto accumulate_concept = [&](ConceptId concept_id, float boost)
+        if (!required_concepts.empty())
         {
-            const std::span<const std::uint32_t> packed_doc_list =
-                collection.GetCompressedDocList(concept_id);
-            if (packed_doc_list.empty())
+            // Phase B: Galloping intersection of the required terms, rarest first so that the
+            // longer lists are skipped through rather than walked.
+            std::vector<ScoredTerm*> required;
+            float optional_bound = 0.0F;
+            for (ScoredTerm& term: terms)
             {
-                return;
+                if (term.required)
+                {
+                    required.push_back(&term);
+                }
+                else
+                {
+                    optional_bound += term.upper_bound;
+                }
             }
+            std::ranges::sort(required,
+                              [](const ScoredTerm* lhs, const ScoredTerm* rhs)
+                              {
+                                  return lhs->size < rhs->size;
+                              });
 
-            const std::uint32_t header_word = packed_doc_list[0];
-
-            const std::vector<std::uint32_t> doc_ids =
-                DecompressSortedIds(packed_doc_list, 0, doc_count);
-
-            const double weight_scale = static_cast<double>(WT_ONE);
-            for (const DocId doc_id: doc_ids)
+            PostingCursor& lead = required.front()->cursor;
+            DocId candidate = lead.Doc();
+            while (candidate != END_OF_POSTINGS)
             {
-                if (has_required && !candidate_set.contains(doc_id))
+                bool matched = true;
+                for (std::size_t index = 1; index < required.size(); ++index)
                 {
-                    continue;
+                    PostingCursor& cursor = required[index]->cursor;
+                    cursor.Advance(candidate);
+                    if (cursor.Doc() != candidate)
+                    {
+                        matched = false;
+                        lead.Advance(cursor.Doc());
+                        candidate = lead.Doc();
+                        break;
+                    }
                 }
-                if (has_prohibited && prohibited_set.contains(doc_id))
+                if (!matched)
                 {
                     continue;
                 }
 
-                const Weight doc_weight = collection.GetDocWeight(concept_id, doc_id);
-                const float score =
-                    (static_cast<float>(doc_weight) / static_cast<float>(weight_scale)) * boost;
-                doc_scores[doc_id] += score;
-            }
-        };
+                // Phase C+D: Only score the optional terms if they could put the document in
+                // the results.
+                float bound = optional_bound;
+                for (const ScoredTerm* term: required)
+                {
+                    bound += Score(term->cursor.CurrentWeight(), term->boost);
+                }
+                // Positions are only checked once everything else says the document belongs in
+                // the results.
+                if (bound + kBoundSlack > top_results.Threshold() && !is_prohibited(candidate) &&
+                    phrases_match(candidate))
+                {
+                    for (ScoredTerm& term: terms)
+                    {
+                        if (!term.required)
+                        {
+                            term.cursor.Advance(candidate);
+                        }
+                    }
+                    top_results.Offer(candidate, score_doc(candidate));
+                }
 
-        // Process exact terms (optional / OR)
-        for (const auto& term: m_terms)
-        {
-            accumulate_concept(term.concept_id, term.boost);
-        }
+                lead.Next();
+                candidate = lead.Doc();
+            }
 
-        // Process required terms (AND) — also scored for ranking
-        for (const auto& term: m_required_terms)
-        {
-            accumulate_concept(term.concept_id, term.boost);
+            return top_results.Take();
         }
 
-        // Process prefix groups (OR semantics — any matching
-        // concept contributes)
-        for (const auto& group: m_prefix_groups)
+        if (terms.size() > kMaxWandTerms)
         {
-            for (const ConceptId concept_id: group.concepts)
+            DocId max_doc = 0;
+            for (const ScoredTerm& term: terms)
             {
-                accumulate_concept(concept_id, group.boost);
+                max_doc = std::max(max_doc, term.last_doc);
+            }
+            if (max_doc / kDenseScoreFactor <= collection.DocCount())
+            {
+                // Phase B-D: Accumulate one term at a time, in term order
+                std::vector<float> doc_scores(static_cast<std::size_t>(max_doc) + 1, 0.0F);
+                std::vector<bool> matched(static_cast<std::size_t>(max_doc) + 1, false);
+                for (ScoredTerm& term: terms)
+                {
+                    for (PostingCursor& cursor = term.cursor; cursor.Doc() != END_OF_POSTINGS;
+                         cursor.Next())
+                    {
+                        doc_scores[cursor.Doc()] += Score(cursor.CurrentWeight(), term.boost);
+                        matched[cursor.Doc()] = true;
+                    }
+                }
+                for (DocId doc_id = 0; doc_id <= max_doc; ++doc_id)
+                {
+                    if (matched[doc_id] && !is_prohibited(doc_id))
+                    {
+                        top_results.Offer(doc_id, doc_scores[doc_id]);
+                    }
+                }
+                return top_results.Take();
             }
         }
 
-        // Phase E: Sort by score descending
-        std::vector<QueryResult> results;
-        results.reserve(doc_scores.size());
-        for (const auto& [doc_id, score]: doc_scores)
+        // Phase B-D: WAND over the optional terms, refined with the per-block maximum
+        // weights. Once there are max_results results, a document is only scored if the upper
+        // bounds of the terms it could contain add up to more than the lowest score so far.
+        std::vector<ScoredTerm*> order;
+        order.reserve(terms.size());
+        for (ScoredTerm& term: terms)
         {
-            results.push_back({ doc_id, score, {} });
+            order.push_back(&term);
         }
-
-        std::ranges::sort(results,
-                          [](const auto& lhs, const auto& rhs)
+        std::ranges::sort(order, {},
+                          [](const ScoredTerm* term)
                           {
-                              return lhs.score > rhs.score;
+                              return term->cursor.Doc();
                           });
+        std::vector<ScoredTerm*> matched;
 
-        // Trim to max_results
-        if (results.size() > max_results)
+        for (;;)
         {
-            results.resize(max_results);
+            const float threshold = top_results.Threshold();
+
+            // Find the pivot: the first term in doc order at which the upper bounds of the terms
+            // so far could beat the threshold. No document before the pivot's can.
+            std::size_t pivot = order.size();
+            float bound = 0.0F;
+            for (std::size_t index = 0; index < order.size(); ++index)
+            {
+                if (order[index]->cursor.Doc() == END_OF_POSTINGS)
+                {
+                    break;
+                }
+                bound += order[index]->upper_bound;
+                if (bound + kBoundSlack > threshold)
+                {
+                    pivot = index;
+                    break;
+                }
+            }
+            if (pivot == order.size())
+            {
+                break;
+            }
+
+            const DocId pivot_doc = order[pivot]->cursor.Doc();
+            while (pivot + 1 < order.size() && order[pivot + 1]->cursor.Doc() == pivot_doc)
+            {
+                ++pivot;
+            }
+
+            // The block maximums give a tighter bound for pivot_doc, and for every document up
+            // to the end of the shortest of those blocks.
+            DocId next_doc =
+                (pivot + 1 < order.size()) ? order[pivot + 1]->cursor.Doc() : END_OF_POSTINGS;
+            float block_bound = 0.0F;
+            for (std::size_t index = 0; index <= pivot; ++index)
+            {
+                ScoredTerm& term = *order[index];
+                if (term.cursor.ShallowAdvance(pivot_doc))
+                {
+                    block_bound += std::max(Score(term.cursor.BlockMaxWeight(), term.boost), 0.0F);
+                    next_doc = std::min(next_doc, term.cursor.BlockLastDoc() + 1);
+                }
+            }
+            if (block_bound + kBoundSlack <= threshold)
+            {
+                for (std::size_t index = 0; index <= pivot; ++index)
+                {
+                    order[index]->cursor.Advance(next_doc);
+                }
+                ResortByDoc(order, pivot + 1);
+                continue;
+            }
+
+            if (order.front()->cursor.Doc() == pivot_doc)
+            {
+                if (!is_prohibited(pivot_doc))
+                {
+                    // Every term on pivot_doc is at or before the pivot -- sum them in term
+                    // order.
+                    matched.assign(order.begin(), order.begin() + pivot + 1);
+                    std::ranges::sort(matched, {}, &ScoredTerm::position);
+                    float score = 0.0F;
+                    for (const ScoredTerm* term: matched)
+                    {
+                        score += Score(term->cursor.CurrentWeight(), term->boost);
+                    }
+                    top_results.Offer(pivot_doc, score);
+                }
+                for (std::size_t index = 0; index <= pivot; ++index)
+                {
+                    order[index]->cursor.Next();
+                }
+            }
+            else
+            {
+                for (std::size_t index = 0; index <= pivot; ++index)
+                {
+                    order[index]->cursor.Advance(pivot_doc);
+                }
+            }
+            ResortByDoc(order, pivot + 1);
         }
 
-        return results;
+        return top_results.Take();
     }
 
 }  // namespace ftsrch
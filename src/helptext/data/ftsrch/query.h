@@ -9,6 +9,7 @@
 
 #include "collection.h"
 #include "dictionary.h"
+#include "positions.h"
 #include "types.h"
 
 #include <cstdint>
@@ -20,6 +21,12 @@ namespace ftsrch
 
     struct QueryResult;
 
+    struct PhraseTerm
+    {
+        ConceptId concept_id;
+        std::uint32_t offset;  // word position relative to the start of the phrase
+    };
+
     class Query
     {
     public:
@@ -27,7 +34,20 @@ namespace ftsrch
         void AddPrefixTerms(std::span<const ConceptId> concepts, float boost = 1.0F);
         void AddRequiredTerm(ConceptId concept_id, float boost = 1.0F);
         void AddProhibitedTerm(ConceptId concept_id);
+
+        // A document only matches if it contains every term at the given offsets from each
+        // other (or, if prohibited is true, it only matches if it doesn't). The terms are
+        // scored as required terms.
+        void AddPhrase(std::span<const PhraseTerm> terms, bool prohibited = false);
+
+        // A document only matches if it contains both terms within max_distance words of each
+        // other, in either order.
+        void AddNear(ConceptId first, ConceptId second, std::uint32_t max_distance);
+
+        // Phrase and NEAR constraints are checked against positions -- if it is empty, they
+        // only require every term to be in the document.
         std::vector<QueryResult> Execute(const Collection& collection, const Dictionary& dictionary,
+                                         const PositionIndex& positions,
                                          std::uint32_t max_results = 100);
 
     private:
@@ -43,10 +63,19 @@ namespace ftsrch
             float boost;
         };
 
+        struct Constraint
+        {
+            std::vector<PhraseTerm> terms;
+            // 0 for a phrase, otherwise the maximum distance between the two terms
+            std::uint32_t max_distance;
+        };
+
         std::vector<TermEntry> m_terms;
         std::vector<TermEntry> m_required_terms;
         std::vector<ConceptId> m_prohibited_concepts;
         std::vector<PrefixGroup> m_prefix_groups;
+        std::vector<Constraint> m_constraints;
+        std::vector<Constraint> m_prohibited_constraints;
     };
 
 }  // namespace ftsrch
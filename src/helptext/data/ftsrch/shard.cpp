@@ -0,0 +1,98 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Documents tokenized and stemmed on a worker thread for a later merge
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include "shard.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace ftsrch
+{
+
+    IndexShard::IndexShard(StemmerFn stemmer, bool store_positions) :
+        m_stemmer(std::move(stemmer)), m_store_positions(store_positions)
+    {
+    }
+
+    void IndexShard::AddDocument(DocId doc_id, std::string_view title, std::string_view text)
+    {
+        ShardDocument& document = m_documents.emplace_back();
+        document.doc_id = doc_id;
+        document.title = title;
+
+        document.title_word_count = AddWords(title, document);
+        AddWords(text, document);
+
+        for (const auto& [word_id, count]: document.word_counts)
+        {
+            m_count_slots[word_id] = NOT_COUNTED;
+        }
+
+        // Accumulate phrase table statistics
+        m_phrases.Scan(title);
+        m_phrases.Scan(text);
+    }
+
+    std::uint32_t IndexShard::AddWords(std::string_view text, ShardDocument& document)
+    {
+        std::uint32_t word_count = 0;
+        for (const Token& token: m_tokenizer.Tokenize(text))
+        {
+            if (token.type != TokenType::word)
+            {
+                continue;
+            }
+
+            const std::uint32_t word_id = WordId(token.text);
+            if (m_count_slots[word_id] == NOT_COUNTED)
+            {
+                m_count_slots[word_id] = static_cast<std::uint32_t>(document.word_counts.size());
+                document.word_counts.emplace_back(word_id, 0);
+            }
+            ++document.word_counts[m_count_slots[word_id]].second;
+
+            if (m_store_positions)
+            {
+                document.words.push_back(word_id);
+            }
+            ++word_count;
+        }
+        return word_count;
+    }
+
+    std::uint32_t IndexShard::WordId(std::string_view word)
+    {
+        std::string lowered_word = Tokenizer::ToLower(word);
+        if (const auto found = m_word_ids.find(lowered_word); found != m_word_ids.end())
+        {
+            return found->second;
+        }
+
+        std::string stemmed_word = m_stemmer ? m_stemmer(lowered_word) : lowered_word;
+        const auto word_id = static_cast<std::uint32_t>(m_words.size());
+        m_word_ids.emplace(lowered_word, word_id);
+        m_words.push_back({ std::move(lowered_word), std::move(stemmed_word) });
+        m_count_slots.push_back(NOT_COUNTED);
+        return word_id;
+    }
+
+    void IndexShard::SortDocuments()
+    {
+        std::ranges::stable_sort(m_documents, {}, &ShardDocument::doc_id);
+    }
+
+    void IndexShard::Release()
+    {
+        m_word_ids = {};
+        m_words = {};
+        m_documents = {};
+        m_phrases = {};
+        m_count_slots = {};
+        m_released = true;
+    }
+
+}  // namespace ftsrch
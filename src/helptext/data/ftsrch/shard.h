@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Documents tokenized and stemmed on a worker thread for a later merge
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// A shard does the part of AddDocument that doesn't depend on the rest of the index: it
+// tokenizes, lowercases and stems every word, counts the words of each document and scans
+// the phrase statistics. Words are numbered within the shard, and the merge (see MergeShards
+// in ftsrch.cpp) turns them into concept IDs by adding them to the index's dictionary in the
+// same order AddDocument would have, so that a merged index is identical to one built
+// serially.
+
+#include "phrase_table.h"
+#include "tokenizer.h"
+#include "types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ftsrch
+{
+
+    class IndexShard
+    {
+    public:
+        IndexShard(StemmerFn stemmer, bool store_positions);
+
+        struct ShardWord
+        {
+            std::string lowered;
+            std::string stemmed;
+        };
+
+        struct ShardDocument
+        {
+            DocId doc_id = 0;
+            std::string title;
+
+            // Every distinct word in the order it first appears, with the number of times it
+            // appears (wrapping the same way the collection's term frequencies do)
+            std::vector<std::pair<std::uint32_t, std::uint16_t>> word_counts;
+
+            // Every word in order -- only recorded if positions are stored
+            std::vector<std::uint32_t> words;
+            std::uint32_t title_word_count = 0;
+        };
+
+        void AddDocument(DocId doc_id, std::string_view title, std::string_view text);
+
+        std::span<const ShardWord> Words() const { return m_words; }
+        std::span<const ShardDocument> Documents() const { return m_documents; }
+        const PhraseTable& Phrases() const { return m_phrases; }
+        bool StorePositions() const { return m_store_positions; }
+
+        // Sorts the documents by doc ID, keeping documents with the same ID in the order they
+        // were added
+        void SortDocuments();
+
+        // Frees the documents once they have been merged into an index
+        void Release();
+        bool IsReleased() const { return m_released; }
+
+    private:
+        // Returns the number of words in text
+        std::uint32_t AddWords(std::string_view text, ShardDocument& document);
+        std::uint32_t WordId(std::string_view word);
+
+        StemmerFn m_stemmer;
+        Tokenizer m_tokenizer;
+        bool m_store_positions = false;
+        bool m_released = false;
+
+        std::unordered_map<std::string, std::uint32_t> m_word_ids;  // lowered word -> index
+        std::vector<ShardWord> m_words;
+        std::vector<ShardDocument> m_documents;
+        PhraseTable m_phrases;
+
+        // Index into the current document's word_counts for every word, or NOT_COUNTED
+        std::vector<std::uint32_t> m_count_slots;
+        static constexpr std::uint32_t NOT_COUNTED = 0xFFFF'FFFF;
+    };
+
+}  // namespace ftsrch
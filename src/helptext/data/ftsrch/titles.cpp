@@ -0,0 +1,130 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Document titles, looked up by doc ID
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include "titles.h"
+
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace ftsrch
+{
+
+    void TitleTable::Add(DocId doc_id, std::string_view title)
+    {
+        m_owned_records.push_back({ doc_id, static_cast<std::uint32_t>(m_owned_chars.size()),
+                                    static_cast<std::uint32_t>(title.size()) });
+        m_owned_chars.insert(m_owned_chars.end(), title.begin(), title.end());
+    }
+
+    void TitleTable::Finalize()
+    {
+        std::ranges::stable_sort(m_owned_records, {}, &TitleRecord::doc_id);
+        UseOwnedTitles();
+    }
+
+    void TitleTable::UseOwnedTitles()
+    {
+        m_records = m_owned_records;
+        m_chars = m_owned_chars;
+    }
+
+    std::string_view TitleTable::Find(DocId doc_id) const
+    {
+        const auto found = std::ranges::lower_bound(m_records, doc_id, {}, &TitleRecord::doc_id);
+        if (found == m_records.end() || found->doc_id != doc_id ||
+            static_cast<std::size_t>(found->offset) + found->length > m_chars.size())
+        {
+            return {};
+        }
+        return { m_chars.data() + found->offset, found->length };
+    }
+
+    std::vector<std::uint8_t> TitleTable::Serialize() const
+    {
+        // title_count, char_count, title records, characters
+        SectionWriter writer;
+        writer.WriteU32(static_cast<std::uint32_t>(m_records.size()));
+        writer.WriteU32(static_cast<std::uint32_t>(m_chars.size()));
+        for (const TitleRecord& record: m_records)
+        {
+            writer.WriteU32(record.doc_id);
+            writer.WriteU32(record.offset);
+            writer.WriteU32(record.length);
+        }
+        writer.WriteArray(m_chars);
+        return writer.Finish();
+    }
+
+    TitleTable TitleTable::Map(std::span<const std::byte> data)
+    {
+        static_assert(sizeof(TitleRecord) == 12 && alignof(TitleRecord) == 4);
+
+        TitleTable table;
+
+        SectionReader reader(data);
+        const std::uint32_t title_count = reader.ReadU32();
+        const std::uint32_t char_count = reader.ReadU32();
+        const std::span<const TitleRecord> records = reader.ReadArray<TitleRecord>(title_count);
+        const std::span<const char> chars = reader.ReadArray<char>(char_count);
+        if (!reader.ok())
+        {
+            return table;
+        }
+
+        table.m_records = records;
+        table.m_chars = chars;
+        return table;
+    }
+
+    TitleTable TitleTable::DeserializeV2(std::span<const std::byte> data)
+    {
+        TitleTable table;
+
+        const auto read_u32 = [](const std::byte* data_ptr) -> std::uint32_t
+        {
+            return static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data_ptr[0])) |
+                   (static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data_ptr[1])) << 8U) |
+                   (static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data_ptr[2])) << 16U) |
+                   (static_cast<std::uint32_t>(std::to_integer<std::uint8_t>(data_ptr[3])) << 24U);
+        };
+
+        if (data.size() < 4)
+        {
+            table.Finalize();
+            return table;
+        }
+
+        // title_count, then for each title: doc_id, length, characters
+        const std::uint32_t title_count = read_u32(data.data());
+        std::size_t position = 4;
+        for (std::uint32_t i = 0; i < title_count; ++i)
+        {
+            if (position + 8 > data.size())
+            {
+                break;
+            }
+
+            const DocId doc_id = read_u32(data.data() + position);
+            position += 4;
+            const std::uint32_t title_length = read_u32(data.data() + position);
+            position += 4;
+            if (position + title_length > data.size())
+            {
+                break;
+            }
+
+            table.Add(doc_id, { std::bit_cast<const char*>(data.data() + position), title_length });
+            position += title_length;
+        }
+
+        table.Finalize();
+        return table;
+    }
+
+}  // namespace ftsrch
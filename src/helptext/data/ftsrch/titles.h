@@ -0,0 +1,63 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Document titles, looked up by doc ID
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace ftsrch
+{
+
+    class TitleTable
+    {
+    public:
+        TitleTable() = default;
+
+        // Not copyable -- the views may point at the owned titles
+        TitleTable(TitleTable&&) = default;
+        TitleTable& operator=(TitleTable&&) = default;
+
+        // Build phase
+        void Add(DocId doc_id, std::string_view title);
+        void Finalize();
+
+        // Returns an empty string if doc_id doesn't have a title. Only valid after Finalize().
+        std::string_view Find(DocId doc_id) const;
+
+        // Map() reads the titles in place, so data must outlive the table; DeserializeV2()
+        // copies the titles of a version 2 index.
+        std::vector<std::uint8_t> Serialize() const;
+        static TitleTable Map(std::span<const std::byte> data);
+        static TitleTable DeserializeV2(std::span<const std::byte> data);
+
+    private:
+        // Sorted by doc ID. The title is length characters starting at offset.
+        struct TitleRecord
+        {
+            DocId doc_id = 0;
+            std::uint32_t offset = 0;
+            std::uint32_t length = 0;
+        };
+
+        // Points the views at the owned titles
+        void UseOwnedTitles();
+
+        std::vector<TitleRecord> m_owned_records;
+        std::vector<char> m_owned_chars;
+
+        // Either the owned vectors or a mapped index
+        std::span<const TitleRecord> m_records;
+        std::span<const char> m_chars;
+    };
+
+}  // namespace ftsrch
@@ -38,6 +38,7 @@ namespace ftsrch
     inline constexpr ConceptId STOP_WORD = std::numeric_limits<ConceptId>::max();
 
     inline constexpr char KFTS_SIGNATURE[4] = { 'K', 'F', 'T', 'S' };
-    inline constexpr uint32_t KFTS_VERSION = 1;
+    inline constexpr uint32_t KFTS_VERSION = 3;     // 3: sections read in place
+    inline constexpr uint32_t KFTS_VERSION_V2 = 2;  // 2: block-structured posting lists
 
 }  // namespace ftsrch
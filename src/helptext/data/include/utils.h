@@ -21,6 +21,9 @@ struct ParseOptions
     std::filesystem::path output_dir;
     bool verbose { false };
     bool no_fts { false };
+    // Only package the generated files into zip_path (which must be set) instead of
+    // also writing them to output_dir.
+    bool zip_only { false };
     std::optional<std::filesystem::path> single_file;
     std::optional<std::filesystem::path> zip_path;
 };
@@ -33,6 +36,11 @@ struct ParseOptions
 // extracted.  Prints per-entry results to stdout.  Returns 0 on success.
 [[nodiscard]] int RunZipTest(const std::filesystem::path& zip_path);
 
+// Rebuild the search index of a parser-produced ZIP archive from its markdown,
+// serially and from several shards, and verify that every build is
+// byte-identical to the archived index.  Returns 0 on success.
+[[nodiscard]] int RunFtsTest(const std::filesystem::path& zip_path);
+
 // ---------------------------------------------------------------------------
 //  Documentation archive reader (parser module)
 // ---------------------------------------------------------------------------
@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Verify that a sharded ftsrch build matches the serial build
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ..\LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include "ftsrch.h"
+#include "parser_reporter.h"
+#include "stemmer.h"
+#include "utils.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+    struct IndexedDocument
+    {
+        ftsrch::DocId doc_id { 0 };
+        std::string title;
+        std::string text;
+    };
+
+    // Parses the "  \"doc_id\": \"path\"" lines that RunParser writes to doc_map.json
+    std::vector<std::pair<ftsrch::DocId, std::string>> ParseDocMap(const std::string& json)
+    {
+        std::vector<std::pair<ftsrch::DocId, std::string>> doc_map;
+        std::istringstream lines(json);
+        std::string line;
+        while (std::getline(lines, line))
+        {
+            const std::size_t id_begin = line.find('"');
+            const std::size_t id_end = line.find('"', id_begin + 1);
+            const std::size_t path_begin = line.find('"', id_end + 1);
+            const std::size_t path_end = line.find('"', path_begin + 1);
+            if (path_end == std::string::npos)
+            {
+                continue;
+            }
+
+            ftsrch::DocId doc_id = 0;
+            const std::from_chars_result result =
+                std::from_chars(line.data() + id_begin + 1, line.data() + id_end, doc_id);
+            if (result.ec != std::errc())
+            {
+                continue;
+            }
+            doc_map.emplace_back(doc_id, line.substr(path_begin + 1, path_end - path_begin - 1));
+        }
+        return doc_map;
+    }
+
+    // Must match the index options RunParser uses
+    ftsrch::IndexPtr CreateDocIndex(ftsrch::SnowballStemmer& stemmer)
+    {
+        ftsrch::IndexOptions index_opts;
+        index_opts.stemmer = stemmer.AsFunction();
+        index_opts.store_positions = true;
+        return ftsrch::CreateIndex(std::move(index_opts));
+    }
+
+}  // namespace
+
+int RunFtsTest(const std::filesystem::path& zip_path)
+{
+    parser::AddResultMessage("fts-test: opening " + zip_path.string());
+
+    std::expected<std::shared_ptr<DocArchive>, std::string> archive_result =
+        OpenDocArchive(zip_path.string());
+    if (!archive_result)
+    {
+        parser::AddErrorMessage("FAIL: " + archive_result.error());
+        return 1;
+    }
+    const DocArchive& archive = **archive_result;
+
+    const std::expected<std::string, std::string> map_result =
+        ReadMarkdown(archive, "data/doc_map.json");
+    const std::expected<std::string, std::string> kfts_result =
+        ReadMarkdown(archive, "data/search_index.kfts");
+    if (!map_result || !kfts_result)
+    {
+        parser::AddErrorMessage("FAIL: archive has no search index (built with --no-fts?)");
+        return 1;
+    }
+
+    // The documents, in doc_id order, exactly as RunParser indexed them
+    std::vector<IndexedDocument> documents;
+    for (auto& [doc_id, doc_path]: ParseDocMap(*map_result))
+    {
+        std::expected<std::string, std::string> text_result = ReadMarkdown(archive, doc_path);
+        if (!text_result)
+        {
+            parser::AddErrorMessage("FAIL: " + text_result.error());
+            return 1;
+        }
+        documents.push_back(
+            { doc_id, fs::path(doc_path).stem().string(), std::move(*text_result) });
+    }
+    std::ranges::sort(documents, {}, &IndexedDocument::doc_id);
+
+    ftsrch::SnowballStemmer serial_stemmer("english");
+    ftsrch::IndexPtr serial_index = CreateDocIndex(serial_stemmer);
+    for (const IndexedDocument& document: documents)
+    {
+        if (!ftsrch::AddDocument(*serial_index, document.doc_id, document.title, document.text))
+        {
+            parser::AddErrorMessage("FAIL: could not index doc " + std::to_string(document.doc_id));
+            return 1;
+        }
+    }
+    const std::vector<std::uint8_t> serial_kfts = ftsrch::SerializeIndex(*serial_index);
+    parser::AddResultMessage(std::to_string(documents.size()) + " documents indexed serially (" +
+                             std::to_string(serial_kfts.size()) + " bytes).");
+
+    bool all_ok = true;
+
+    if (!std::ranges::equal(serial_kfts, *kfts_result,
+                            [](std::uint8_t serial_byte, char archive_byte)
+                            {
+                                return serial_byte == static_cast<std::uint8_t>(archive_byte);
+                            }))
+    {
+        parser::AddErrorMessage("FAIL: data/search_index.kfts differs from the serial build.");
+        all_ok = false;
+    }
+
+    // Deal the documents out to the shards unevenly, and in reverse order, so that the
+    // merge has to interleave them.
+    for (const std::size_t shard_count: { 1U, 3U, 8U })
+    {
+        ftsrch::SnowballStemmer index_stemmer("english");
+        ftsrch::IndexPtr sharded_index = CreateDocIndex(index_stemmer);
+
+        std::vector<std::optional<ftsrch::SnowballStemmer>> shard_stemmers(shard_count);
+        std::vector<ftsrch::IndexShardPtr> shards;
+        for (std::optional<ftsrch::SnowballStemmer>& shard_stemmer: shard_stemmers)
+        {
+            shard_stemmer.emplace("english");
+            shards.push_back(ftsrch::CreateShard(*sharded_index, shard_stemmer->AsFunction()));
+        }
+
+        for (std::size_t doc_index = documents.size(); doc_index-- > 0;)
+        {
+            const IndexedDocument& document = documents[doc_index];
+            const std::size_t shard_index = (doc_index * doc_index) % shard_count;
+            std::ignore = ftsrch::AddDocument(*shards[shard_index], document.doc_id,
+                                              document.title, document.text);
+        }
+
+        const bool merged = ftsrch::MergeShards(*sharded_index, shards).has_value();
+        if (!merged || ftsrch::SerializeIndex(*sharded_index) != serial_kfts)
+        {
+            parser::AddErrorMessage("FAIL: index built with " + std::to_string(shard_count) +
+                                    " shards differs from the serial build.");
+            all_ok = false;
+        }
+        else
+        {
+            parser::AddResultMessage("  OK: " + std::to_string(shard_count) + " shards");
+        }
+    }
+
+    if (!all_ok)
+    {
+        return 1;
+    }
+
+    parser::AddResultMessage("Sharded and serial indexes are byte-identical.");
+    return 0;
+}
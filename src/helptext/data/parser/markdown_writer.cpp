@@ -22,8 +22,8 @@
 #include <cassert>
 #include <cctype>
 #include <filesystem>
-#include <fstream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -1224,14 +1224,14 @@ namespace docparser
     }
 
     // ---------------------------------------------------------------------------
-    // WriteFile
+    // RenderFile
     // ---------------------------------------------------------------------------
 
-    std::vector<fs::path> WriteFile(const FileContent& content, const SymbolTable& symbols,
-                                    const fs::path& output_dir, const fs::path& source_rel_path,
-                                    const fs::path& input_dir)
+    std::vector<RenderedFile> RenderFile(const FileContent& content, const SymbolTable& symbols,
+                                         const fs::path& source_rel_path,
+                                         const fs::path& input_dir)
     {
-        // Guard: only header files should be written here. Assert to catch any
+        // Guard: only header files should be rendered here. Assert to catch any
         // unexpected source or markdown file routed through this function.
         assert(source_rel_path.extension() == ".h");
 
@@ -1243,41 +1243,21 @@ namespace docparser
                                              source_rel_path.generic_string() :
                                              (include_leaf / source_rel_path).generic_string();
 
-        // Ensure the output directory exists
-        {
-            std::error_code error_code;
-            std::ignore = fs::create_directories(output_dir, error_code);
-            if (error_code)
-            {
-                parser::AddErrorMessage("Error creating directory " + output_dir.string() + ": " +
-                                        error_code.message());
-                return {};
-            }
-        }
-
-        std::vector<fs::path> generated_files;
+        std::vector<RenderedFile> rendered_files;
 
-        // Write one .md file per class
+        // One .md file per class
         for (const ClassInfo& class_info: content.classes)
         {
-            const fs::path class_rel = fs::path(ClassNameToFile(class_info.name));
-            const fs::path class_abs = output_dir / class_rel;
-
-            std::ofstream output_stream(class_abs);
-            if (!output_stream)
-            {
-                parser::AddErrorMessage("Error: could not write to " + class_abs.string());
-                continue;
-            }
-
+            std::ostringstream output_stream;
             WriteClass(output_stream, class_info, symbols, include_hint);
             output_stream << "---\n*Generated from `" << content.filename << "`*\n";
 
-            generated_files.emplace_back(class_rel);
+            rendered_files.push_back(
+                { fs::path(ClassNameToFile(class_info.name)), std::move(output_stream).str() });
         }
 
-        // Write non-class content (enums, typedefs, defines, free functions) to a
-        // file named after the source header, written flat in the output root.
+        // Non-class content (enums, typedefs, defines, free functions) goes into a
+        // file named after the source header, placed flat in the output root.
         const bool has_non_class_content = !content.enums.empty() || !content.typedefs.empty() ||
                                            !content.defines.empty() ||
                                            !content.free_functions.empty();
@@ -1289,14 +1269,8 @@ namespace docparser
             // such as the FTS index, not for header conversions.
             fs::path non_class_rel = source_rel_path.filename();
             non_class_rel.replace_extension(".md");
-            const fs::path non_class_abs = output_dir / non_class_rel;
 
-            std::ofstream output_stream(non_class_abs);
-            if (!output_stream)
-            {
-                parser::AddErrorMessage("Error: could not write to " + non_class_abs.string());
-                return generated_files;
-            }
+            std::ostringstream output_stream;
 
             // Title: use source filename when there are no classes in this file
             if (content.classes.empty())
@@ -1307,10 +1281,10 @@ namespace docparser
             WriteNonClassContent(output_stream, content, symbols);
             output_stream << "---\n*Generated from `" << content.filename << "`*\n";
 
-            generated_files.emplace_back(non_class_rel);
+            rendered_files.push_back({ std::move(non_class_rel), std::move(output_stream).str() });
         }
 
-        return generated_files;
+        return rendered_files;
     }
 
 }  // namespace docparser
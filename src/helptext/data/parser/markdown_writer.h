@@ -11,6 +11,8 @@
 #include "symbol_table.h"
 
 #include <filesystem>
+#include <string>
+#include <vector>
 
 namespace docparser
 {
@@ -19,17 +21,23 @@ namespace docparser
     // Example: "wxButton" -> "wxButton.md"
     [[nodiscard]] std::string ClassNameToFile(const std::string& name);
 
-    // Write one .md file per class found in content, plus one .md for any non-class
+    // One generated markdown document, held in memory.
+    struct RenderedFile
+    {
+        std::filesystem::path out_rel;  // relative path within the output (e.g. "wxButton.md")
+        std::string text;
+    };
+
+    // Render one .md document per class found in content, plus one for any non-class
     // content (enums, typedefs, defines, free functions) keyed to source_rel_path.
+    // Nothing is written to disk -- the caller decides where the documents go.
     // 'input_dir' is the parser's scan root; its leaf name is prefixed to
     // source_rel_path to reconstruct the canonical '#include' path (e.g. "wx/foo.h").
     // When empty, the include path falls back to source_rel_path alone.
     // Asserts that source_rel_path has a .h extension.
-    // Returns the paths of all generated files, relative to output_dir.
-    [[nodiscard]] std::vector<std::filesystem::path>
-        WriteFile(const FileContent& content, const SymbolTable& symbols,
-                  const std::filesystem::path& output_dir,
-                  const std::filesystem::path& source_rel_path,
-                  const std::filesystem::path& input_dir = {});
+    [[nodiscard]] std::vector<RenderedFile>
+        RenderFile(const FileContent& content, const SymbolTable& symbols,
+                   const std::filesystem::path& source_rel_path,
+                   const std::filesystem::path& input_dir = {});
 
 }  // namespace docparser
@@ -7,10 +7,14 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <expected>
 #include <filesystem>
 #include <fstream>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
@@ -27,11 +31,97 @@
 
 namespace fs = std::filesystem;
 
-// Helper for packaging generated parser output into the ZIP archive
+// ---------------------------------------------------------------------------
+// File-scope result structs shared between RunParser and GenerateLists
+// ---------------------------------------------------------------------------
+
+// Raw DEFLATE data for one archive entry, compressed on a worker thread so that
+// packaging the ZIP archive only has to copy it.
+struct CompressedEntry
+{
+    std::vector<uint8_t> data;  // empty for an empty file (or if compression failed)
+    std::size_t uncompressed_size { 0 };
+    uint32_t crc32 { 0 };
+};
+
+struct GeneratedFile
+{
+    fs::path out_rel;             // relative path within output_dir (e.g. "wxButton.md")
+    std::string title;            // document title for FTS
+    std::string md_text;          // populated only when FTS indexing is enabled
+    CompressedEntry compressed;   // populated only when a ZIP archive is requested
+    ftsrch::DocId doc_id { 0 };   // assigned only when FTS indexing is enabled
+    bool indexed { false };       // set once the document has been added to its FTS shard
+};
+
+struct PerFileResult
+{
+    fs::path rel_path;                        // source .h relative path
+    std::vector<GeneratedFile> output_files;  // one entry per generated .md
+    std::size_t class_count { 0 };
+    std::size_t enum_count { 0 };
+    std::size_t function_count { 0 };
+    bool parsed_ok { false };
+    std::string error_message;
+};
+
+// A file generated after all headers have been parsed (welcome page, list files,
+// JSON maps, search index, logo).
+struct SupportFile
+{
+    fs::path out_rel;            // relative path within output_dir (e.g. "data/classes.md")
+    std::string content;
+    CompressedEntry compressed;  // populated only when a ZIP archive is requested
+};
+
+// Thread-safe: called from the parser workers.
+static CompressedEntry CompressEntry(std::string_view content)
+{
+    CompressedEntry entry;
+    entry.uncompressed_size = content.size();
+    entry.crc32 = ZipWriter::ComputeCrc32(content);
+    entry.data = ZipWriter::CompressForArchive(content);
+    return entry;
+}
+
+// Write content to output_dir / out_rel. The parent directory must already exist.
+static bool WriteOutputFile(const fs::path& output_dir, const fs::path& out_rel,
+                            std::string_view content)
+{
+    const fs::path out_path = output_dir / out_rel;
+    std::ofstream out_file(out_path, std::ios::binary);
+    out_file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    if (!out_file)
+    {
+        parser::AddErrorMessage("Error: could not write to " + out_path.string());
+        return false;
+    }
+    return true;
+}
+
+static std::expected<void, std::string> AddArchiveEntry(ZipWriter& zipper, const fs::path& out_rel,
+                                                        const CompressedEntry& compressed)
+{
+    const std::string archive_name = out_rel.generic_string();
+    if (compressed.uncompressed_size == 0)
+    {
+        // DEFLATE has nothing to do for an empty file (e.g. an empty list)
+        return zipper.AddFileUncompressed(archive_name, nullptr, 0);
+    }
+    if (compressed.data.empty())
+    {
+        return std::unexpected("Compression failed for: " + archive_name);
+    }
+    return zipper.AddPreCompressed(archive_name, compressed.data, compressed.uncompressed_size,
+                                   compressed.crc32);
+}
+
+// Helper for packaging generated parser output into the ZIP archive. Every entry
+// was compressed beforehand, so this only copies the compressed data.
 // Called by: RunParser()
-static bool PackageOutputArchive(const ParseOptions& opts, const fs::path& output_dir,
-                                 const std::vector<fs::path>& generated_files,
-                                 const fs::path& kfts_path, const bool has_fts)
+static bool PackageOutputArchive(const ParseOptions& opts,
+                                 const std::vector<PerFileResult>& results,
+                                 const std::vector<SupportFile>& support_files)
 {
     if (!opts.zip_path)
     {
@@ -60,82 +150,37 @@ static bool PackageOutputArchive(const ParseOptions& opts, const fs::path& outpu
         return false;
     }
 
-    bool zip_ok = true;
-
-    for (const fs::path& out_rel: generated_files)
-    {
-        const fs::path out_path = output_dir / out_rel;
-
-        if (fs::exists(out_path))
-        {
-            const std::string archive_name = out_rel.generic_string();
-            const std::expected<void, std::string> add_result =
-                zipper.AddDiskFile(archive_name, out_path);
-            if (!add_result)
-            {
-                parser::AddErrorMessage("ZIP error: " + add_result.error());
-                zip_ok = false;
-                break;
-            }
-        }
-    }
-
-    if (zip_ok && !opts.single_file)
+    const auto add_entry = [&zipper](const fs::path& out_rel, const CompressedEntry& compressed)
     {
-        const fs::path index_path = output_dir / "index.md";
-        if (fs::exists(index_path))
+        const std::expected<void, std::string> add_result =
+            AddArchiveEntry(zipper, out_rel, compressed);
+        if (!add_result)
         {
-            const std::expected<void, std::string> add_result =
-                zipper.AddDiskFile("index.md", index_path);
-            if (!add_result)
-            {
-                parser::AddErrorMessage("ZIP error: " + add_result.error());
-                zip_ok = false;
-            }
+            parser::AddErrorMessage("ZIP error: " + add_result.error());
+            return false;
         }
-    }
+        return true;
+    };
 
-    if (zip_ok && !kfts_path.empty() && fs::exists(kfts_path))
+    for (const PerFileResult& slot: results)
     {
-        std::ifstream kfts_file(kfts_path, std::ios::binary | std::ios::ate);
-        if (kfts_file)
+        for (const GeneratedFile& gen_file: slot.output_files)
         {
-            const std::streamsize kfts_size = kfts_file.tellg();
-            kfts_file.seekg(0, std::ios::beg);
-            std::vector<char> kfts_data(static_cast<std::size_t>(kfts_size));
-            if (kfts_file.read(kfts_data.data(), kfts_size))
+            if (!add_entry(gen_file.out_rel, gen_file.compressed))
             {
-                const std::expected<void, std::string> add_result = zipper.AddBinaryFile(
-                    "data/search_index.kfts", kfts_data.data(), kfts_data.size());
-                if (!add_result)
-                {
-                    parser::AddErrorMessage("ZIP error: " + add_result.error());
-                    zip_ok = false;
-                }
+                return false;
             }
         }
     }
 
-    if (zip_ok && has_fts)
+    for (const SupportFile& support_file: support_files)
     {
-        const fs::path map_path = output_dir / "data" / "doc_map.json";
-        if (fs::exists(map_path))
+        if (!add_entry(support_file.out_rel, support_file.compressed))
         {
-            const std::expected<void, std::string> add_result =
-                zipper.AddDiskFile("data/doc_map.json", map_path);
-            if (!add_result)
-            {
-                parser::AddErrorMessage("ZIP error: " + add_result.error());
-                zip_ok = false;
-            }
+            return false;
         }
     }
 
-    if (!zip_ok)
-    {
-        return false;
-    }
-
     const std::expected<void, std::string> finalize_result = zipper.Finalize();
     if (!finalize_result)
     {
@@ -151,29 +196,6 @@ static bool PackageOutputArchive(const ParseOptions& opts, const fs::path& outpu
     return true;
 }
 
-// ---------------------------------------------------------------------------
-// File-scope result structs shared between RunParser and GenerateLists
-// ---------------------------------------------------------------------------
-
-struct GeneratedFile
-{
-    fs::path out_rel;     // relative path within output_dir (e.g. "wxButton.md")
-    fs::path out_path;    // absolute path on disk
-    std::string title;    // document title for FTS
-    std::string md_text;  // populated only when FTS indexing is enabled
-};
-
-struct PerFileResult
-{
-    fs::path rel_path;                        // source .h relative path
-    std::vector<GeneratedFile> output_files;  // one entry per generated .md
-    std::size_t class_count { 0 };
-    std::size_t enum_count { 0 };
-    std::size_t function_count { 0 };
-    bool parsed_ok { false };
-    std::string error_message;
-};
-
 // ---------------------------------------------------------------------------
 // GenerateLists
 // ---------------------------------------------------------------------------
@@ -181,10 +203,8 @@ struct PerFileResult
 // Generate data/classes.md, data/events.md, data/overviews.md, data/functions.md.
 // Each file contains one entry per line: class name (no extension) for class/event
 // files, or relative path without extension for non-class content files.
-// Returns relative paths (under "data/") of the files written, for ZIP inclusion.
-static std::vector<fs::path> GenerateLists(const std::vector<PerFileResult>& results,
-                                           const docparser::SymbolTable& symbols,
-                                           const fs::path& output_dir)
+static std::vector<SupportFile> GenerateLists(const std::vector<PerFileResult>& results,
+                                              const docparser::SymbolTable& symbols)
 {
     std::vector<std::string> classes_list;
     std::vector<std::string> events_list;
@@ -239,41 +259,31 @@ static std::vector<fs::path> GenerateLists(const std::vector<PerFileResult>& res
     std::ranges::sort(overviews_list);
     std::ranges::sort(functions_list);
 
-    // Ensure the data/ directory exists (may already exist if FTS is enabled).
-    {
-        std::error_code error_code;
-        std::ignore = fs::create_directories(output_dir / "data", error_code);
-    }
+    std::vector<SupportFile> list_files;
 
-    std::vector<fs::path> written_files;
-
-    auto write_list = [&](const std::string& filename, const std::vector<std::string>& entries)
+    auto add_list = [&](const std::string& filename, const std::vector<std::string>& entries)
     {
-        const fs::path list_path = output_dir / "data" / filename;
-        std::ofstream list_out(list_path);
-        if (!list_out)
-        {
-            parser::AddErrorMessage("Error: could not write " + list_path.string());
-            return;
-        }
+        SupportFile list_file;
+        list_file.out_rel = fs::path("data") / filename;
         for (const std::string& entry: entries)
         {
-            list_out << entry << "\n";
+            list_file.content += entry;
+            list_file.content += '\n';
         }
-        written_files.emplace_back(fs::path("data") / filename);
+        list_files.emplace_back(std::move(list_file));
     };
 
-    write_list("classes.md", classes_list);
-    write_list("events.md", events_list);
-    write_list("overviews.md", overviews_list);
-    write_list("functions.md", functions_list);
+    add_list("classes.md", classes_list);
+    add_list("events.md", events_list);
+    add_list("overviews.md", overviews_list);
+    add_list("functions.md", functions_list);
 
-    return written_files;
+    return list_files;
 }
 
-// Copy the wx logo SVG to the output directory so it gets packaged into the
-// documentation ZIP archive.
-static void CopyLogoSvg(const std::filesystem::path& output_dir)
+// Read the wx logo SVG so it can be packaged with the documentation. Returns an
+// empty string if the SVG can't be found.
+static std::string ReadLogoSvg()
 {
     static constexpr std::string_view kSvgFile = "src/art_src/wxlogo.svg";
     static const fs::path candidates[] = {
@@ -286,23 +296,18 @@ static void CopyLogoSvg(const std::filesystem::path& output_dir)
     {
         if (fs::exists(candidate))
         {
-            std::error_code error_code;
-            const fs::path dest = output_dir / fs::path(kSvgFile).filename();
-            fs::copy_file(candidate, dest, fs::copy_options::overwrite_existing, error_code);
-            return;
+            std::ifstream svg_file(candidate, std::ios::binary);
+            return { std::istreambuf_iterator<char>(svg_file), std::istreambuf_iterator<char>() };
         }
     }
+    return {};
 }
 
 // Generate index.md — a welcome/home page modeled after the wxWidgets
 // documentation introduction at https://docs.wxwidgets.org/latest/ .
-static void GenerateWelcomePage(const docparser::SymbolTable& symbols,
-                                const std::vector<PerFileResult>& results,
-                                const std::filesystem::path& output_dir)
+static std::string RenderWelcomePage(const docparser::SymbolTable& symbols,
+                                     const std::vector<PerFileResult>& results)
 {
-    // Copy wxlogo.svg to the output directory so it gets packaged into the ZIP.
-    CopyLogoSvg(output_dir);
-
     // -- Compute statistics ------------------------------------------------
 
     const std::size_t class_count = symbols.ClassCount();
@@ -358,15 +363,9 @@ static void GenerateWelcomePage(const docparser::SymbolTable& symbols,
 
     std::ranges::sort(overview_paths);
 
-    // -- Write index.md ----------------------------------------------------
+    // -- Render index.md ---------------------------------------------------
 
-    const fs::path index_path = output_dir / "index.md";
-    std::ofstream index_file(index_path);
-    if (!index_file)
-    {
-        parser::AddErrorMessage("Error: could not write index.md");
-        return;
-    }
+    std::ostringstream index_file;
 
     index_file << "# wxWidgets Documentation\n\n";
 
@@ -404,24 +403,15 @@ static void GenerateWelcomePage(const docparser::SymbolTable& symbols,
     }
 
     index_file << "\n---\n*Generated documentation home page*\n";
+    return std::move(index_file).str();
 }
 
-// Write data/inheritance.json: per-class direct base and direct derived classes.
+// Render data/inheritance.json: per-class direct base and direct derived classes.
 // The viewer consumes this to render inheritance graphs on the fly. Classes with
 // neither bases nor derived are omitted to keep the file small.
-static void WriteInheritanceJson(const docparser::SymbolTable& symbols, const fs::path& output_dir)
+static std::string RenderInheritanceJson(const docparser::SymbolTable& symbols)
 {
-    {
-        std::error_code error_code;
-        std::ignore = fs::create_directories(output_dir / "data", error_code);
-    }
-    const fs::path json_path = output_dir / "data" / "inheritance.json";
-    std::ofstream out_stream(json_path);
-    if (!out_stream)
-    {
-        parser::AddErrorMessage("Error: could not write inheritance.json");
-        return;
-    }
+    std::ostringstream out_stream;
 
     const auto write_array = [&out_stream](const std::vector<std::string>& items)
     {
@@ -459,6 +449,7 @@ static void WriteInheritanceJson(const docparser::SymbolTable& symbols, const fs
         out_stream << '}';
     }
     out_stream << "\n}\n";
+    return std::move(out_stream).str();
 }
 
 int RunParser(const ParseOptions& opts)
@@ -472,6 +463,16 @@ int RunParser(const ParseOptions& opts)
         return 1;
     }
 
+    // Generated files are kept in memory; they are written to output_dir unless
+    // they are only wanted in the ZIP archive.
+    const bool write_files = !opts.zip_only;
+    const bool want_zip = opts.zip_path.has_value();
+    if (!write_files && !want_zip)
+    {
+        parser::AddErrorMessage("Error: ZIP-only output requested without a ZIP path");
+        return 1;
+    }
+
     if (opts.verbose)
     {
         parser::AddResultMessage("Input:  " + input_dir.string() +
@@ -496,13 +497,17 @@ int RunParser(const ParseOptions& opts)
     }
 
     // Pass 2: Parse files and generate markdown
-    std::error_code error_code;
-    const bool created_output_dir = fs::create_directories(output_dir, error_code);
-    if (!created_output_dir && error_code)
+    if (write_files)
     {
-        parser::AddErrorMessage("Error: cannot create output directory '" + output_dir.string() +
-                                "': " + error_code.message());
-        return 1;
+        // data/ holds the support files (lists, JSON maps, search index)
+        std::error_code error_code;
+        const bool created_output_dir = fs::create_directories(output_dir / "data", error_code);
+        if (!created_output_dir && error_code)
+        {
+            parser::AddErrorMessage("Error: cannot create output directory '" +
+                                    output_dir.string() + "': " + error_code.message());
+            return 1;
+        }
     }
 
     std::vector<fs::path> files_to_process;
@@ -526,6 +531,7 @@ int RunParser(const ParseOptions& opts)
         stemmer.emplace("english");
         ftsrch::IndexOptions index_opts;
         index_opts.stemmer = stemmer->AsFunction();
+        index_opts.store_positions = true;  // for phrase and NEAR queries in the help viewer
         fts_index = ftsrch::CreateIndex(std::move(index_opts));
     }
 
@@ -535,9 +541,9 @@ int RunParser(const ParseOptions& opts)
     const std::size_t total = files_to_process.size();
 
     // Per-file result collected by the parallel workers. The heavy lifting
-    // (ParseFile + markdown generation + disk write) runs on worker threads;
-    // the ftsrch index is populated serially afterwards so doc_ids remain
-    // deterministic and no locking is needed around AddDocument.
+    // (ParseFile + markdown generation + disk write + ZIP compression) runs on
+    // worker threads. Doc IDs are then assigned serially in source order, and a
+    // second pass indexes the documents into one ftsrch shard per worker.
 
     std::vector<PerFileResult> results(total);
 
@@ -581,28 +587,35 @@ int RunParser(const ParseOptions& opts)
                 const docparser::FileContent content =
                     docparser::ParseFile(abs_path, slot.rel_path);
 
-                // WriteFile creates per-class files plus a source-derived file for
-                // any non-class content; returns all generated relative paths.
-                const std::vector<fs::path> generated =
-                    docparser::WriteFile(content, symbols, output_dir, slot.rel_path, input_dir);
+                // RenderFile creates per-class documents plus a source-derived document
+                // for any non-class content, all held in memory.
+                std::vector<docparser::RenderedFile> rendered =
+                    docparser::RenderFile(content, symbols, slot.rel_path, input_dir);
 
                 slot.class_count = content.classes.size();
                 slot.enum_count = content.enums.size();
                 slot.function_count = content.free_functions.size();
 
-                for (const fs::path& out_rel: generated)
+                for (docparser::RenderedFile& document: rendered)
                 {
+                    if (write_files &&
+                        !WriteOutputFile(output_dir, document.out_rel, document.text))
+                    {
+                        continue;
+                    }
+
                     GeneratedFile gen_file;
-                    gen_file.out_rel = out_rel;
-                    gen_file.out_path = output_dir / out_rel;
+                    gen_file.out_rel = std::move(document.out_rel);
                     // Use stem as title (class name for class files, source stem for others)
-                    gen_file.title = out_rel.stem().string();
+                    gen_file.title = gen_file.out_rel.stem().string();
 
+                    if (want_zip)
+                    {
+                        gen_file.compressed = CompressEntry(document.text);
+                    }
                     if (want_fts)
                     {
-                        std::ifstream md_file(gen_file.out_path);
-                        gen_file.md_text.assign(std::istreambuf_iterator<char>(md_file),
-                                                std::istreambuf_iterator<char>());
+                        gen_file.md_text = std::move(document.text);
                     }
 
                     slot.output_files.emplace_back(std::move(gen_file));
@@ -659,135 +672,193 @@ int RunParser(const ParseOptions& opts)
         // std::jthread joins on scope exit
     }
 
-    // Serial FTS pass: adds one document per generated .md file in deterministic
-    // source-file order so doc_ids remain stable across runs.
-    // Also collects all generated file paths for ZIP packaging.
-    std::vector<fs::path> all_generated_files;
-    for (std::size_t i = 0; i < total; ++i)
+    // Assign doc IDs in deterministic source-file order so they remain stable
+    // across runs.
+    std::size_t generated_count = 0;
+    for (PerFileResult& slot: results)
     {
-        const PerFileResult& slot = results[i];
         if (!slot.parsed_ok)
         {
             ++error_count;
             continue;
         }
 
-        for (const GeneratedFile& gen_file: slot.output_files)
+        for (GeneratedFile& gen_file: slot.output_files)
         {
-            all_generated_files.emplace_back(gen_file.out_rel);
-
+            ++generated_count;
             if (fts_index)
             {
-                const ftsrch::DocId doc_id = next_doc_id++;
-                const std::expected<void, ftsrch::Error> fts_result =
-                    ftsrch::AddDocument(*fts_index, doc_id, gen_file.title, gen_file.md_text);
-                if (fts_result.has_value())
+                gen_file.doc_id = next_doc_id++;
+            }
+        }
+
+        ++success_count;
+    }
+
+    // FTS pass: every worker tokenizes and stems into its own shard (the Snowball
+    // stemmer isn't thread-safe, so each shard gets its own). MergeShards then
+    // adds the documents in doc_id order, which makes the index identical to one
+    // built by calling AddDocument serially.
+    if (fts_index)
+    {
+        std::vector<std::optional<ftsrch::SnowballStemmer>> shard_stemmers(worker_count);
+        std::vector<ftsrch::IndexShardPtr> shards(worker_count);
+        std::atomic<std::size_t> next_slot { 0 };
+        std::atomic<std::size_t> fts_warning_count { 0 };
+
+        auto index_worker = [&](unsigned worker_id)
+        {
+            shard_stemmers[worker_id].emplace("english");
+            shards[worker_id] =
+                ftsrch::CreateShard(*fts_index, shard_stemmers[worker_id]->AsFunction());
+            ftsrch::IndexShard& shard = *shards[worker_id];
+
+            while (true)
+            {
+                const std::size_t idx = next_slot.fetch_add(1, std::memory_order_relaxed);
+                if (idx >= total)
                 {
-                    doc_map.emplace_back(doc_id, gen_file.out_rel.generic_string());
+                    return;
                 }
-                else
+
+                for (GeneratedFile& gen_file: results[idx].output_files)
                 {
-                    parser::AddErrorMessage("Warning: FTS indexing failed for " +
-                                            gen_file.out_rel.generic_string());
-                    ++warning_count;
+                    const std::expected<void, ftsrch::Error> fts_result = ftsrch::AddDocument(
+                        shard, gen_file.doc_id, gen_file.title, gen_file.md_text);
+                    if (fts_result.has_value())
+                    {
+                        gen_file.indexed = true;
+                    }
+                    else
+                    {
+                        parser::AddErrorMessage("Warning: FTS indexing failed for " +
+                                                gen_file.out_rel.generic_string());
+                        fts_warning_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    // The text is no longer needed once it has been indexed
+                    gen_file.md_text = std::string();
                 }
             }
+        };
+
+        {
+            std::vector<std::jthread> pool;
+            pool.reserve(worker_count);
+            for (unsigned worker_id = 0; worker_id < worker_count; ++worker_id)
+            {
+                pool.emplace_back(index_worker, worker_id);
+            }
+            // std::jthread joins on scope exit
         }
 
-        ++success_count;
+        // Only documents that were indexed get a doc_map entry, in doc_id order
+        for (const PerFileResult& slot: results)
+        {
+            for (const GeneratedFile& gen_file: slot.output_files)
+            {
+                if (gen_file.indexed)
+                {
+                    doc_map.emplace_back(gen_file.doc_id, gen_file.out_rel.generic_string());
+                }
+            }
+        }
+
+        warning_count += fts_warning_count.load();
+        if (!ftsrch::MergeShards(*fts_index, shards).has_value())
+        {
+            parser::AddErrorMessage("Error merging FTS index shards");
+            ++error_count;
+        }
     }
 
+    std::vector<SupportFile> support_files;
+
     // Generate index.md (welcome page)
     if (!opts.single_file)
     {
-        GenerateWelcomePage(symbols, results, output_dir);
-        all_generated_files.emplace_back("wxlogo.svg");
-        if (opts.verbose)
+        support_files.push_back({ "index.md", RenderWelcomePage(symbols, results), {} });
+        if (std::string logo_svg = ReadLogoSvg(); !logo_svg.empty())
         {
-            parser::AddResultMessage("Generated index.md");
+            support_files.push_back({ "wxlogo.svg", std::move(logo_svg), {} });
         }
     }
 
-    // Save FTS index
-    fs::path kfts_path;  // stashed for ZIP packaging below
+    // Serialize the FTS index and doc_map.json
     if (fts_index)
     {
-        {
-            std::error_code error_code;
-            std::ignore = fs::create_directories(output_dir / "data", error_code);
-        }
-        kfts_path = output_dir / "data" / "search_index.kfts";
-        const std::expected<void, ftsrch::Error> save_result =
-            ftsrch::SaveIndex(*fts_index, kfts_path);
-        if (save_result.has_value())
-        {
-            parser::AddResultMessage("FTS index saved: " + kfts_path.generic_string());
-        }
-        else
-        {
-            parser::AddErrorMessage("Error saving FTS index");
-            ++error_count;
-        }
+        const std::vector<std::uint8_t> kfts_data = ftsrch::SerializeIndex(*fts_index);
+        support_files.push_back({ fs::path("data") / "search_index.kfts",
+                                  std::string(kfts_data.begin(), kfts_data.end()),
+                                  {} });
 
-        // Write doc_map.json
-        const fs::path map_path = output_dir / "data" / "doc_map.json";
-        std::ofstream map_out(map_path);
-        if (map_out)
+        std::ostringstream map_out;
+        map_out << "{\n";
+        for (std::size_t j = 0; j < doc_map.size(); ++j)
         {
-            map_out << "{\n";
-            for (std::size_t j = 0; j < doc_map.size(); ++j)
-            {
-                const auto& [doc_id, doc_path] = doc_map[j];
-                map_out << "  \"" << doc_id << "\": \"" << doc_path << "\"";
-                if (j + 1 < doc_map.size())
-                {
-                    map_out << ",";
-                }
-                map_out << "\n";
-            }
-            map_out << "}\n";
-            if (opts.verbose)
+            const auto& [doc_id, doc_path] = doc_map[j];
+            map_out << "  \"" << doc_id << "\": \"" << doc_path << "\"";
+            if (j + 1 < doc_map.size())
             {
-                const std::string doc_map_message = "Doc map saved: " + map_path.generic_string() +
-                                                    " (" + std::to_string(doc_map.size()) +
-                                                    " entries)";
-                parser::AddResultMessage(doc_map_message);
+                map_out << ",";
             }
+            map_out << "\n";
         }
-        else
+        map_out << "}\n";
+        support_files.push_back(
+            { fs::path("data") / "doc_map.json", std::move(map_out).str(), {} });
+    }
+
+    // data/inheritance.json (independent of FTS) for on-the-fly graphs, and the
+    // list files (classes, events, overviews, functions).
+    if (!opts.single_file)
+    {
+        support_files.push_back(
+            { fs::path("data") / "inheritance.json", RenderInheritanceJson(symbols), {} });
+
+        for (SupportFile& list_file: GenerateLists(results, symbols))
         {
-            parser::AddErrorMessage("Error: could not write doc_map.json");
-            ++error_count;
+            support_files.emplace_back(std::move(list_file));
         }
     }
 
-    // Write data/inheritance.json (independent of FTS) for on-the-fly graphs.
-    if (!opts.single_file)
+    // The search index dominates the remaining compression work, so each support
+    // file gets its own thread rather than going through the worker queue.
+    if (want_zip)
     {
-        WriteInheritanceJson(symbols, output_dir);
-        all_generated_files.emplace_back("data/inheritance.json");
+        std::vector<std::jthread> pool;
+        pool.reserve(support_files.size());
+        for (SupportFile& support_file: support_files)
+        {
+            pool.emplace_back(
+                [&support_file]()
+                {
+                    support_file.compressed = CompressEntry(support_file.content);
+                });
+        }
+        // std::jthread joins on scope exit
     }
 
-    // Generate list files (classes, events, overviews, functions) in data/.
-    if (!opts.single_file)
+    if (write_files)
     {
-        const std::vector<fs::path> list_files = GenerateLists(results, symbols, output_dir);
-#if defined(_WIN32)
-        all_generated_files.append_range(list_files);
-#else
-        // clang-20 on Ubuntu 24 (GitHub runner) does not support std::vector::append_range (C++23).
-        all_generated_files.insert(all_generated_files.end(), list_files.begin(), list_files.end());
-#endif
-        if (opts.verbose)
+        for (const SupportFile& support_file: support_files)
         {
-            parser::AddResultMessage("Generated list files: data/classes.md, data/events.md, "
-                                     "data/overviews.md, data/functions.md");
+            if (!WriteOutputFile(output_dir, support_file.out_rel, support_file.content))
+            {
+                ++error_count;
+            }
+            else if (opts.verbose || support_file.out_rel.extension() == ".kfts")
+            {
+                parser::AddResultMessage("Saved " +
+                                         (output_dir / support_file.out_rel).generic_string() +
+                                         " (" + std::to_string(support_file.content.size()) +
+                                         " bytes)");
+            }
         }
     }
 
     // Package into ZIP archive
-    if (!PackageOutputArchive(opts, output_dir, all_generated_files, kfts_path,
-                              (fts_index != nullptr)))
+    if (!PackageOutputArchive(opts, results, support_files))
     {
         ++error_count;
     }
@@ -799,7 +870,7 @@ int RunParser(const ParseOptions& opts)
         warning_count > 0 ? " (" + std::to_string(warning_count) + " warnings)" : "";
     const std::string summary_message = "Processed " + std::to_string(success_count) +
                                         " source files -> " +
-                                        std::to_string(all_generated_files.size()) +
+                                        std::to_string(generated_count) +
                                         " markdown files" + error_suffix + warning_suffix + ".";
     parser::AddResultMessage(summary_message);
 
@@ -269,3 +269,8 @@ std::vector<uint8_t> ZipWriter::CompressForArchive(std::span<const char> source_
     result.resize(compressed_size);
     return result;
 }
+
+uint32_t ZipWriter::ComputeCrc32(std::span<const char> source_data)
+{
+    return libdeflate_crc32(0, source_data.data(), source_data.size());
+}
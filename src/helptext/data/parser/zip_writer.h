@@ -78,6 +78,10 @@ public:
     static std::vector<uint8_t> CompressForArchive(std::span<const char> source_data,
                                                    int level = MAX_DEFLATE_LEVEL);
 
+    // CRC-32 of uncompressed data, as AddPreCompressed expects it.
+    // Thread-safe — operates only on local data with no shared state.
+    static uint32_t ComputeCrc32(std::span<const char> source_data);
+
     // Finalize the archive (writes central directory). Must be called before
     // destruction for the archive to be valid.
     [[nodiscard]] std::expected<void, std::string> Finalize();
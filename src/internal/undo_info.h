@@ -41,8 +41,10 @@ private:
 
     // Class member variables
 
+    wxStaticText* m_txt_memory_limit;
     wxStaticText* m_txt_redo_items;
     wxStaticText* m_txt_redo_memory;
+    wxStaticText* m_txt_spilled;
     wxStaticText* m_txt_undo_items;
     wxStaticText* m_txt_undo_memory;
 };
@@ -24,6 +24,7 @@
 
 #include "gen_common.h"                // Common component functions
 #include "gen_results.h"               // Code generation file writing functions
+#include "image_cache.h"               // image_cache::Initialize(), image_cache::Evict()
 #include "internal/msg_logging.h"      // MsgLogging -- Message logging class
 #include "internal/node_search_dlg.h"  // FindNodeByClassName
 #include "mainframe.h"                 // MainFrame -- Main window frame
@@ -227,7 +228,10 @@ int App::OnRun()
     #endif
 #endif
 
+    const auto init_start = std::chrono::steady_clock::now();
     NodeCreation.Initialize();
+    const std::chrono::duration<double, std::milli> init_elapsed =
+        std::chrono::steady_clock::now() - init_start;
 
     wxCmdLineParser parser(argc, argv);
     OnInitCmdLine(parser);
@@ -255,6 +259,10 @@ int App::OnRun()
 
     parser.AddLongOption("gen_all", "generate all language files and exit");
 
+    // Used with gen_* to generate forms concurrently. 0 uses every core, the default is 1.
+    parser.AddLongOption("jobs", "number of threads used to generate forms (0 = all cores)",
+                         wxCMD_LINE_VAL_NUMBER);
+
     // verify_* options generate code internally and compare against existing files on disk.
     // If differences are detected, the diff output is written to a .log file (same name as the
     // project file but with .log extension) and a non-zero exit code is returned.
@@ -357,9 +365,19 @@ int App::OnRun()
 
     parser.AddLongSwitch("data-version", "return current data_version", wxCMD_LINE_HIDDEN);
 
+    // Reports how long it takes to initialize every node declaration and create an empty
+    // project, then exits. Run it several times and compare the numbers between builds to
+    // measure startup performance.
+    parser.AddLongSwitch("bench_startup", "report startup time to an empty project and exit",
+                         wxCMD_LINE_HIDDEN);
+
     parser.AddLongOption("docview", "Open documentation viewer", wxCMD_LINE_VAL_STRING,
                          wxCMD_LINE_HIDDEN);
 
+    // Embedded images are normally compressed once and then read back from the user's cache
+    // directory (see image_cache.h). This forces every image to be compressed again.
+    parser.AddLongSwitch("no-image-cache", "do not use or update the embedded image cache");
+
     parser.Parse();
 
     // Return current data_version for AI tools and exit immediately
@@ -369,6 +387,19 @@ int App::OnRun()
         return 0;
     }
 
+    if (parser.Found("bench_startup"))
+    {
+        const auto project_start = std::chrono::steady_clock::now();
+        Project.NewProject(true, false);
+        const std::chrono::duration<double, std::milli> project_elapsed =
+            std::chrono::steady_clock::now() - project_start;
+        wxMessageOutput::Get()->Printf(
+            "NodeCreator::Initialize: %.2f ms\nEmpty project: %.2f ms\nTotal: %.2f ms\n",
+            init_elapsed.count(), project_elapsed.count(),
+            (init_elapsed + project_elapsed).count());
+        return 0;
+    }
+
     // --docview: launch standalone documentation viewer, skipping MainFrame and project loading
     if (wxString zip_str; parser.Found("docview", &zip_str))
     {
@@ -379,6 +410,8 @@ int App::OnRun()
         return wxApp::OnRun();
     }
 
+    image_cache::Initialize(!parser.Found("no-image-cache"));
+
 #if defined(INTERNAL_TESTING)
     m_TestingMenuEnabled = true;
 #endif
@@ -546,6 +579,8 @@ int App::OnRun()
 
 int App::OnExit()
 {
+    image_cache::Evict();
+
     if (g_pMsgLogging)
     {
         wxLog::SetActiveTarget(nullptr);
@@ -883,6 +918,7 @@ void App::GenerateAllLanguages(size_t generate_type, bool test_only, GenResults&
                 results.SetNodes(Project.get_ProjectNode());
             }
             results.SetLanguages(language);
+            results.SetJobs(wxGetApp().get_GenJobs());
 
             if (test_only)
             {
@@ -938,6 +974,11 @@ int App::Generate(wxCmdLineParser& parser, bool& is_project_loaded)
         m_form_filter = form_filter.ToStdString();
     }
 
+    if (long jobs = 1; parser.Found("jobs", &jobs))
+    {
+        m_gen_jobs = jobs > 0 ? static_cast<size_t>(jobs) : 0;
+    }
+
     auto [generate_type, test_only] = ParseGenerationType(parser);
 
     const wxString& filename_str = GetCommandLineFilename(parser);
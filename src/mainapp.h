@@ -105,6 +105,10 @@ public:
     [[nodiscard]] const std::string& get_FormFilter() const noexcept { return m_form_filter; }
     void set_FormFilter(std::string_view value) noexcept { m_form_filter = value; }
 
+    // Returns the number of threads to use when generating forms (--jobs). 0 means use every
+    // available core.
+    [[nodiscard]] size_t get_GenJobs() const noexcept { return m_gen_jobs; }
+
     // Add warning or error messages to this if is_Generating() is true (which means code is
     // being generated from the command line).
     wxue::StringVector& get_CmdLineLog() { return m_cmdline_log; }
@@ -173,6 +177,7 @@ private:
     };  // true if generating code for test coverage (--gen_coverage)
 
     std::string m_form_filter;  // if set, only generate code for this form class name
+    size_t m_gen_jobs { 1 };    // number of form generation threads (--jobs), 0 == all cores
 
 #if (DARK_MODE)
     bool m_isDarkMode { true };
@@ -249,6 +249,8 @@ MainFrame::MainFrame() :
     Bind(wxEVT_FIND_NEXT, &MainFrame::OnFind, this);
     Bind(wxEVT_FIND_CLOSE, &MainFrame::OnFindClose, this);
     Bind(wxEVT_TIMER, &MainFrame::OnGenerationTimer, this, m_generation_timer.GetId());
+    m_prop_change_timer.SetOwner(this);
+    Bind(wxEVT_TIMER, &MainFrame::OnPropChangeTimer, this, m_prop_change_timer.GetId());
 
     Bind(EVT_NodeSelected, &MainFrame::OnNodeSelected, this);
 
@@ -713,6 +715,7 @@ bool MainFrame::SelectNode(Node* node, size_t flags)
 
     if (flags & evt_flags::queue_event)
     {
+        FlushPropChangeEvents();
         const CustomEvent node_event(EVT_NodeSelected, m_selected_node.get());
         for (auto* handler: m_custom_event_handlers)
         {
@@ -860,7 +863,7 @@ void MainFrame::PasteNode(Node* parent)
                     {
                         tool_node_ptr->set_value(
                             iter.second->get_name(),
-                            new_node->get_PropPtr(iter.second->get_name())->get_value());
+                            new_node->get_PropPtr(iter.second->get_name())->as_string());
                     }
                 }
                 create_undo_event(tool_node_ptr);
@@ -891,7 +894,7 @@ void MainFrame::PasteNode(Node* parent)
                     {
                         menu_node_ptr->set_value(
                             iter.second->get_name(),
-                            new_node->get_PropPtr(iter.second->get_name())->get_value());
+                            new_node->get_PropPtr(iter.second->get_name())->as_string());
                     }
                 }
                 create_undo_event(menu_node_ptr);
@@ -1075,7 +1078,9 @@ void MainFrame::RemoveCustomEventHandler(wxEvtHandler* handler)
         if (*iter == handler)
         {
             m_custom_event_handlers.erase(iter);
-            return;
+            break;
         }
     }
+
+    std::erase(m_deferred_prop_handlers, handler);
 }
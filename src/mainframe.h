@@ -110,6 +110,16 @@ public:
     }
     void RemoveCustomEventHandler(wxEvtHandler* handler);
 
+    // EVT_NodePropChange events for handler (which must also have been added with
+    // AddCustomEventHandler()) are delayed briefly, and repeated changes to the same property are
+    // sent as a single event. This keeps typing in the property grid from regenerating code and
+    // recreating the Mockup after every character.
+    void DeferPropChangeEvents(wxEvtHandler* handler);
+
+    // Sends any delayed EVT_NodePropChange events now, to visible windows first. Every other
+    // custom event calls this first so that handlers still see events in the order they occurred.
+    void FlushPropChangeEvents();
+
     void FireChangeEventHandler(NodeEvent* evt_node);
     void FireCreatedEvent(Node* node);
     void FireDeletedEvent(Node* node);
@@ -377,6 +387,11 @@ private:
     void ShowGenerationResults(const GenResults& results);
     void UpdateGenerationStatus();
     void OnGenerationTimer(wxTimerEvent& event);
+    void OnPropChangeTimer(wxTimerEvent& event);
+
+    // Drops any delayed EVT_NodePropChange events -- only used when every handler is about to
+    // rebuild everything anyway.
+    void DiscardPropChangeEvents();
     static void CreateTestingMenuItems(MainFrame* frame);
 
     wxSplitterWindow* m_SecondarySplitter { nullptr };
@@ -439,6 +454,15 @@ private:
     // Custom events will be sent to each of these handlers
     std::vector<wxEvtHandler*> m_custom_event_handlers;
 
+    // Handlers whose EVT_NodePropChange events are delayed until m_prop_change_timer fires. As
+    // with m_custom_event_handlers, RemoveCustomEventHandler() only compares the pointers.
+    std::vector<wxEvtHandler*> m_deferred_prop_handlers;
+
+    // Properties changed since the last flush, in the order they first changed. The node is
+    // held so that the property remains valid even if the node is deleted before the flush.
+    std::vector<std::pair<NodeSharedPtr, NodeProperty*>> m_pending_prop_changes;
+    wxTimer m_prop_change_timer;
+
     UndoStack m_undo_stack;
     size_t m_undo_stack_size {
         0
@@ -730,6 +730,7 @@ void MainFrame::OnSaveAsProject(wxCommandEvent& /* event unused */)
             Project.set_ProjectPath(filename);
             ProjectSaved();
             FireProjectLoadedEvent();
+            m_undo_stack.SetFileCheckpoint(Project.get_ProjectFile());
         }
         else
         {
@@ -764,6 +765,7 @@ void MainFrame::OnSaveProject(wxCommandEvent& event)
         if (document.save_file(Project.get_ProjectFile(), "  ", pugi::format_indent_attributes))
         {
             m_isProject_modified = false;
+            m_undo_stack.SetFileCheckpoint(Project.get_ProjectFile());
             ProjectSaved();
         }
         else
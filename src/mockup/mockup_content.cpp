@@ -10,8 +10,12 @@
 // if we were the form. The notable exception is a MockupWizard -- in this case we create a
 // MockupWizard child which itself is a wxPanel that substitutes for the wxWizard form.
 
+#include <algorithm>
 #include <array>
+#include <iterator>
+#include <optional>
 #include <tuple>
+#include <vector>
 
 #include <wx/aui/auibook.h>       // wxaui: wx advanced user interface - notebook
 #include <wx/bookctrl.h>          // wxBookCtrlBase: common base class for wxList/Tree/Notebook
@@ -55,6 +59,7 @@ void MockupContent::RemoveNodes()
     SetSizer(nullptr);
 
     m_parent_sizer = nullptr;
+    m_created_windows = 0;
 
     if (m_variant != wxWINDOW_VARIANT_NORMAL)
     {
@@ -62,6 +67,166 @@ void MockupContent::RemoveNodes()
     }
 }
 
+bool MockupContent::RecreateNode(Node* node)
+{
+    // Only a node that was added to a parent sizer can be replaced in place -- pages, ribbon
+    // components, tools, etc. are added to their parent by the parent's generator.
+    Node* parent = node->get_Parent();
+    wxObject* old_object = Get_wxObject(node);
+    if (!parent || node->is_Form() || !old_object || !parent->is_Sizer())
+    {
+        return false;
+    }
+
+    wxSizer* parent_sizer = wxDynamicCast(Get_wxObject(parent), wxSizer);
+    wxWindow* parent_window = GetParentWindow(node);
+    if (!parent_sizer || !parent_window)
+    {
+        return false;
+    }
+
+    wxWindow* old_window =
+        node->is_StaticBoxSizer() ? nullptr : wxDynamicCast(old_object, wxWindow);
+    wxSizer* old_sizer = wxDynamicCast(old_object, wxSizer);
+
+    std::optional<size_t> old_index;
+    for (size_t index = 0; index < parent_sizer->GetItemCount(); ++index)
+    {
+        const wxSizerItem* item = parent_sizer->GetItem(index);
+        if ((old_window && item->GetWindow() == old_window) ||
+            (old_sizer && item->GetSizer() == old_sizer))
+        {
+            old_index = index;
+            break;
+        }
+    }
+    if (!old_index)
+    {
+        return false;
+    }
+
+    const wxWindowUpdateLocker lock(this);
+
+    // Tab order and radio button grouping follow the order of parent_window's children, so
+    // remember which child followed the windows being destroyed.
+    const wxWindowList& children = parent_window->GetChildren();
+    const std::vector<wxWindow*> old_children(children.begin(), children.end());
+
+    ForgetNode(node);
+    if (old_window)
+    {
+        std::ignore = parent_sizer->Detach(static_cast<int>(*old_index));
+        std::ignore = old_window->Destroy();
+    }
+    else
+    {
+        // Remove() deletes the sizer, and a wxStaticBoxSizer deletes its static box
+        old_sizer->DeleteWindows();
+        std::ignore = parent_sizer->Remove(static_cast<int>(*old_index));
+    }
+
+    wxWindow* next_window = nullptr;
+    bool found_destroyed = false;
+    for (wxWindow* child: old_children)
+    {
+        if (std::find(children.begin(), children.end(), child) == children.end())
+        {
+            found_destroyed = true;
+        }
+        else if (found_destroyed)
+        {
+            next_window = child;
+            break;
+        }
+    }
+
+    m_created_windows = 0;
+    const size_t item_count = parent_sizer->GetItemCount();
+    const size_t child_count = children.size();
+    CreateChildren(node, parent_window, Get_wxObject(parent));
+
+    // CreateChildren() appends the new item, so move it to where the old item was. The item
+    // itself is moved rather than detached and inserted again so that its minimum size and user
+    // data are kept. Items in a wxGridBagSizer are positioned by row and column, so the order
+    // doesn't matter.
+    if (!parent->is_Gen(gen_wxGridBagSizer) && parent_sizer->GetItemCount() == item_count + 1 &&
+        *old_index < item_count)
+    {
+        wxSizerItemList& items = parent_sizer->GetChildren();
+        wxSizerItem* new_item = parent_sizer->GetItem(item_count);
+        std::ignore = items.DeleteObject(new_item);
+        std::ignore = items.Insert(*old_index, new_item);
+    }
+
+    // The new windows were created after every other child, so move them back in front of the
+    // window that followed the old ones.
+    if (next_window)
+    {
+        const std::vector<wxWindow*> new_children(
+            std::next(children.begin(), static_cast<std::ptrdiff_t>(child_count)), children.end());
+        for (wxWindow* child: new_children)
+        {
+            child->MoveBeforeInTabOrder(next_window);
+        }
+    }
+
+    // Layout from the parent sizer up -- the caller is responsible for resizing the mockup
+    // itself.
+    parent_sizer->Layout();
+    for (wxWindow* window = parent_window; window && window != this; window = window->GetParent())
+    {
+        window->InvalidateBestSize();
+        std::ignore = window->Layout();
+    }
+    return true;
+}
+
+wxWindow* MockupContent::GetParentWindow(Node* node)
+{
+    // This needs to match how CreateChildren() passes the parent window down to each child
+    for (Node* parent = node->get_Parent(); parent; parent = parent->get_Parent())
+    {
+        // Note that the children of a PageCtrl's page aren't in the map, so they end up here
+        wxObject* parent_object = Get_wxObject(parent);
+        if (!parent_object)
+        {
+            if (parent->is_Form())
+            {
+                return m_wizard ? static_cast<wxWindow*>(m_wizard) : this;
+            }
+            return nullptr;
+        }
+
+        if (parent->is_StaticBoxSizer())
+        {
+            return wxStaticCast(parent_object, wxStaticBoxSizer)->GetStaticBox();
+        }
+        if (parent->is_Gen(gen_wxCollapsiblePane))
+        {
+            return wxStaticCast(parent_object, wxCollapsiblePane)->GetPane();
+        }
+        if (wxWindow* window = wxDynamicCast(parent_object, wxWindow); window)
+        {
+            return window;
+        }
+    }
+    return nullptr;
+}
+
+void MockupContent::ForgetNode(Node* node)
+{
+    if (const auto obj_iter = m_node_obj_pair.find(node); obj_iter != m_node_obj_pair.end())
+    {
+        m_obj_node_pair.erase(obj_iter->second);
+        m_node_obj_pair.erase(obj_iter);
+    }
+
+    for (const auto& child: node->get_ChildNodePtrs())
+    {
+        ForgetNode(child.get());
+    }
+}
+
 // This is called by MockupParent in order to create all child components
 void MockupContent::CreateAllGenerators()
 {
@@ -318,6 +483,11 @@ void MockupContent::CreateChildren(Node* node, wxWindow* parent, wxObject* paren
     m_obj_node_pair[created_object] = node;
     m_node_obj_pair[node] = created_object;
 
+    if (created_window)
+    {
+        ++m_created_windows;
+    }
+
     if (node->is_Type(type_images) || node->is_Type(type_data_list))
     {
         if (parent_sizer)
@@ -30,6 +30,14 @@ public:
 
     void RemoveNodes();
 
+    // Destroys and recreates the mockup objects for node and all of its children, leaving the
+    // rest of the form alone. Returns false if node can't be recreated in place -- in that case
+    // nothing has been changed and the caller needs to recreate the entire form.
+    bool RecreateNode(Node* node);
+
+    // Number of windows created since the mockup was last cleared or a node was last recreated
+    size_t GetCreatedWindowCount() const { return m_created_windows; }
+
     Node* getNode(wxObject* wxobject);
     wxObject* Get_wxObject(Node* node);
 
@@ -53,6 +61,13 @@ private:
     void SelectRibbonNode(Node* node);
     void ActivateRibbonPage(Node* ribbon_page_node);
 
+    // Returns the window CreateChildren() used as the parent for node, or nullptr if it can't be
+    // determined.
+    wxWindow* GetParentWindow(Node* node);
+
+    // Removes node and all of its children from m_obj_node_pair and m_node_obj_pair
+    void ForgetNode(Node* node);
+
     MockupParent* m_mockupParent;
     wxBoxSizer* m_parent_sizer { nullptr };
 
@@ -65,4 +80,6 @@ private:
     std::unordered_map<Node*, wxObject*> m_node_obj_pair;
 
     MockupWizard* m_wizard { nullptr };
+
+    size_t m_created_windows { 0 };
 };
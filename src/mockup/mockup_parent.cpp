@@ -17,6 +17,8 @@
 
 */
 
+#include <format>
+
 #include "gen_enums.h"
 
 #if defined(_WIN32)
@@ -132,6 +134,9 @@ MockupParent::MockupParent(wxWindow* parent, MainFrame* frame) : wxScrolled<wxPa
          });
 
     frame->AddCustomEventHandler(GetEventHandler());
+
+    // Recreating the content on every keystroke in the property grid is too slow
+    frame->DeferPropChangeEvents(GetEventHandler());
 }
 
 // This gets called when a different form is selected, a different project loaded, controls added
@@ -518,27 +523,7 @@ void MockupParent::OnNodePropModified(CustomEvent& event)
         if (generator && generator->OnPropertyChange(Get_wxObject(node), node, prop))
         {
             const wxWindowUpdateLocker freeze(this);
-            // You have to reset minimum size to allow the window to shrink
-            m_panelContent->SetMinSize(wxSize(-1, -1));
-            m_panelContent->Fit();
-
-            wxSize new_size = m_panelContent->GetSize();
-            // REVIEW: [Randalphwa - 04-16-2026] Currently, this is always true. It's only here in
-            // case we want to mockup a form without a title bar.
-            if (m_panelTitleBar)
-            {
-                const wxSize size_title = m_panelTitleBar->GetSize();
-                new_size.y += size_title.y;
-            }
-
-            // Need to be at least as large as any dimensions the user set.
-            new_size.IncTo(m_form->as_wxSize(prop_size));
-            new_size.IncTo(m_form->as_wxSize(prop_minimum_size));
-
-            new_size.DecToIfSpecified(m_form->as_wxSize(prop_maximum_size));
-
-            m_MockupWindow->SetSize(new_size);
-            m_MockupWindow->Refresh();
+            FitMockupWindow();
             is_updated = true;
         }
     }
@@ -548,8 +533,54 @@ void MockupParent::OnNodePropModified(CustomEvent& event)
         // We set m_isPropertyChanging so that we ignore generators calling our SelectNode() because
         // a page changed
         m_isPropertyChanging = true;
-        CreateContent();
+
+        // Recreating just the node whose property changed is much faster than recreating the
+        // entire form, which for a large dialog can take long enough to be noticeable while the
+        // user is typing in the property grid.
+        if (m_panelContent->RecreateNode(prop->getNode()))
+        {
+            const wxWindowUpdateLocker freeze(this);
+            FitMockupWindow();
+        }
+        else
+        {
+            CreateContent();
+        }
+
+#if defined(_DEBUG)
+        if (App::isFireCreationMsgs())
+        {
+            MSG_INFO(std::format("Mockup: {} windows recreated.",
+                                 m_panelContent->GetCreatedWindowCount()));
+        }
+#endif  // _DEBUG
+
         m_panelContent->OnNodeSelected(wxGetFrame().getSelectedNode());
         m_isPropertyChanging = false;
     }
 }
+
+void MockupParent::FitMockupWindow()
+{
+    // You have to reset minimum size to allow the window to shrink
+    m_panelContent->SetMinSize(wxSize(-1, -1));
+    m_panelContent->Fit();
+
+    wxSize new_size = m_panelContent->GetSize();
+    // REVIEW: [Randalphwa - 04-16-2026] Currently, this is always true. It's only here in
+    // case we want to mockup a form without a title bar.
+    if (m_panelTitleBar)
+    {
+        const wxSize size_title = m_panelTitleBar->GetSize();
+        new_size.y += size_title.y;
+    }
+
+    // Need to be at least as large as any dimensions the user set.
+    new_size.IncTo(m_form->as_wxSize(prop_size));
+    new_size.IncTo(m_form->as_wxSize(prop_minimum_size));
+
+    new_size.DecToIfSpecified(m_form->as_wxSize(prop_maximum_size));
+
+    m_MockupWindow->SetSize(new_size);
+    m_MockupWindow->Refresh();
+}
@@ -46,6 +46,9 @@ protected:
     void OnNodePropModified(CustomEvent& event);
 
 private:
+    // Resizes the mockup window to fit the current content
+    void FitMockupWindow();
+
     wxPanel* m_panelTitleBar;
     MockupContent* m_panelContent;
 
@@ -6,6 +6,7 @@
 /////////////////////////////////////////////////////////////////////////////
 // CR: [07-16-2026]
 
+#include <ranges>
 #include <sstream>
 
 #include <wx/animate.h>   // wxAnimation and wxAnimationCtrl
@@ -28,6 +29,7 @@
 #include "preferences.h"      // Preferences -- Stores user preferences
 #include "project_handler.h"  // ProjectHandler class
 #include "undo_cmds.h"        // Undoable command classes derived from UndoAction
+#include "unique_names.h"     // NameIndex -- Index of the variable names in use
 #include "utils.h"            // Miscellaneous utilities
 
 #include "wxue_namespace/wxue.h"         // wxue helpers for character classification
@@ -58,47 +60,6 @@ inline constexpr auto lst_form_types = std::to_array<GenType>({
 
 });
 
-const std::vector<std::string> reserved_names = {
-    "bitmaps",       // used for wxBitmapBundle
-    "_svg_string_",  // used for python SVG image processing
-
-    // Python variables
-    "_OK",
-    "_Yes",
-    "_Save",
-    "_Cancel",
-    "_No",
-    "_Close",
-    "_Help",
-    "_ContextHelp",
-
-    // Ruby variables
-    "_ok_btn",
-    "_yes_btn",
-    "_save_btn",
-    "_cancel_btn",
-    "_no_btn",
-    "_close_btn",
-    "_help_btn",
-    "_context_help_btn",
-
-    "bundle_list",  // used for wxBitmapBundle, primarily for books
-
-    // These are used when generating Python code for wxBitmapBundle
-    "bundle_1",
-    "bundle_2",
-    "bundle_3",
-    "bundle_4",
-    "bundle_5",
-    "bundle_6",
-    "bundle_7",
-    "bundle_8",
-    "bundle_9",
-
-    "idx",      // used for wxListItem
-    "info"      // used for wxListItem
-};
-
 // clang-format on
 
 bool Node::is_Form() const noexcept
@@ -110,22 +71,47 @@ bool Node::is_Form() const noexcept
                                });
 }
 
-Node::Node(NodeDeclaration* declaration) : m_declaration(declaration) {}
+Node::Node(NodeDeclaration* declaration) : m_declaration(declaration)
+{
+    // Reserving the exact size means the vectors won't carry any unused capacity
+    m_properties.reserve(declaration->get_NodePropCount());
+    m_events.reserve(declaration->get_NodeEventCount());
+}
+
+Node::~Node()
+{
+    for (const auto& child: m_children)
+    {
+        if (child->m_parent == this)
+        {
+            child->m_parent = nullptr;
+        }
+    }
+}
 
 NodeProperty* Node::get_PropPtr(PropName name)
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    return FindProp(name);
+}
+
+const NodeProperty* Node::FindAddedProp(PropName name) const noexcept
+{
+    // Search backwards since the last property added with a given name is the one to use
+    for (const auto& prop: std::views::reverse(m_properties))
     {
-        return &m_properties[result->second];
+        if (prop.get_name() == name)
+        {
+            return &prop;
+        }
     }
     return nullptr;
 }
 
 NodeEvent* Node::get_Event(std::string_view name)
 {
-    if (auto iter = m_map_events.find(name); iter != m_map_events.end())
+    if (const size_t slot = m_declaration->get_EventSlot(name); slot < m_events.size())
     {
-        return &iter->second;
+        return &m_events[slot];
     }
 
     return nullptr;
@@ -135,9 +121,9 @@ size_t Node::get_InUseEventCount() const
 {
     size_t count = 0;
 
-    for (const auto& iter: m_map_events)
+    for (const auto& iter: m_events)
     {
-        if (!iter.second.get_value().empty())
+        if (!iter.get_value().empty())
         {
             ++count;
         }
@@ -148,26 +134,31 @@ size_t Node::get_InUseEventCount() const
 
 NodeProperty* Node::AddNodeProperty(PropDeclaration* declaration)
 {
-    const NodeProperty& prop = m_properties.emplace_back(declaration, this);
-    m_prop_indices[prop.get_name()] = (m_properties.size() - 1);
-    return &m_properties[m_properties.size() - 1];
+    return &m_properties.emplace_back(declaration, this);
 }
 
 void Node::AddNodeEvent(const NodeEventInfo* info)
 {
-    m_map_events.emplace(info->get_name(), NodeEvent(info, this));
+    // A base class can declare the same event as a derived class -- only the first is used
+    if (get_Event(info->get_name()))
+    {
+        return;
+    }
+    ASSERT_MSG(m_declaration->get_EventSlot(info->get_name()) == m_events.size(),
+               "Events must be added in the same order as NodeDeclaration::BuildNodeLayout()");
+    m_events.emplace_back(info, this);
 }
 
 void Node::CopyEventsFrom(Node* from)
 {
     ASSERT(from);
-    for (auto& iter: from->m_map_events)
+    for (auto& iter: from->m_events)
     {
-        if (!iter.second.get_value().empty())
+        if (!iter.get_value().empty())
         {
-            if (auto* event = get_Event(iter.second.get_name()); event)
+            if (auto* event = get_Event(iter.get_name()); event)
             {
-                event->set_value(iter.second.get_value());
+                event->set_value(iter.get_value());
             }
         }
     }
@@ -221,11 +212,12 @@ Node* Node::get_ValidFormParent() noexcept
 
 bool Node::AdoptChild(const NodeSharedPtr& child)
 {
-    ASSERT_MSG(child != get_SharedPtr(), "A node can't adopt itself!");
+    ASSERT_MSG(child.get() != this, "A node can't adopt itself!");
     if (is_ChildAllowed(child))
     {
         m_children.push_back(child);
-        child->set_Parent(get_SharedPtr());
+        child->set_Parent(this);
+        NameIndex::Invalidate();
         return true;
     }
 
@@ -237,6 +229,7 @@ bool Node::AddChild(const NodeSharedPtr& node)
     if (is_ChildAllowed(node))
     {
         m_children.push_back(node);
+        NameIndex::Invalidate();
         return true;
     }
 
@@ -248,6 +241,7 @@ bool Node::AddChild(Node* node)
     if (is_ChildAllowed(node))
     {
         m_children.push_back(node->get_SharedPtr());
+        NameIndex::Invalidate();
         return true;
     }
 
@@ -259,6 +253,7 @@ bool Node::AddChild(size_t idx, const NodeSharedPtr& node)
     if (is_ChildAllowed(node) && idx <= m_children.size())
     {
         m_children.insert(m_children.begin() + static_cast<ptrdiff_t>(idx), node);
+        NameIndex::Invalidate();
         return true;
     }
 
@@ -270,6 +265,7 @@ bool Node::AddChild(size_t idx, Node* node)
     if (is_ChildAllowed(node) && idx <= m_children.size())
     {
         m_children.insert(m_children.begin() + static_cast<ptrdiff_t>(idx), node->get_SharedPtr());
+        NameIndex::Invalidate();
         return true;
     }
 
@@ -340,7 +336,12 @@ void Node::RemoveChild(Node* node)
     {
         if (child.get() == node)
         {
+            if (node->m_parent == this)
+            {
+                node->m_parent = nullptr;
+            }
             m_children.erase(m_children.begin() + static_cast<ptrdiff_t>(pos));
+            NameIndex::Invalidate();
             break;
         }
         ++pos;
@@ -354,7 +355,27 @@ void Node::RemoveChild(size_t index)
 
     const std::vector<NodeSharedPtr>::iterator iter =
         m_children.begin() + static_cast<ptrdiff_t>(index);
+    if ((*iter)->m_parent == this)
+    {
+        (*iter)->m_parent = nullptr;
+    }
     m_children.erase(iter);
+    NameIndex::Invalidate();
+}
+
+void Node::removeAllChildren()
+{
+    // A child may already have been adopted by another node, in which case its parent is left
+    // alone.
+    for (const auto& child: m_children)
+    {
+        if (child->m_parent == this)
+        {
+            child->m_parent = nullptr;
+        }
+    }
+    m_children.clear();
+    NameIndex::Invalidate();
 }
 
 size_t Node::get_ChildPosition(Node* node)
@@ -389,8 +410,10 @@ bool Node::ChangeChildPosition(const NodeSharedPtr& node, size_t pos)
         return true;
     }
 
+    // RemoveChild() clears the parent, but the node is staying with this parent
     RemoveChild(node);
     std::ignore = AddChild(pos, node);
+    node->set_Parent(this);
     return true;
 }
 
@@ -401,18 +424,18 @@ bool Node::is_Local() const noexcept
 
 bool Node::HasValue(PropName name) const
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return m_properties[result->second].HasValue();
+        return prop->HasValue();
     }
     return false;
 }
 
 bool Node::is_PropValue(PropName name, const char* value) const noexcept
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return (m_properties[result->second].as_string().is_sameas(value));
+        return (prop->as_string().is_sameas(value));
     }
 
     return false;
@@ -420,9 +443,9 @@ bool Node::is_PropValue(PropName name, const char* value) const noexcept
 
 bool Node::is_PropValue(PropName name, bool value) const noexcept
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return (m_properties[result->second].as_bool() == value);
+        return (prop->as_bool() == value);
     }
 
     return false;
@@ -430,9 +453,9 @@ bool Node::is_PropValue(PropName name, bool value) const noexcept
 
 bool Node::is_PropValue(PropName name, int value) const noexcept
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return (m_properties[result->second].as_int() == value);
+        return (prop->as_int() == value);
     }
 
     return false;
@@ -440,27 +463,27 @@ bool Node::is_PropValue(PropName name, int value) const noexcept
 
 int Node::as_mockup(PropName name, std::string_view prefix) const
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return m_properties[result->second].as_mockup(prefix);
+        return prop->as_mockup(prefix);
     }
     return 0;
 }
 
 std::vector<wxue::string> Node::as_ArrayString(PropName name) const
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return m_properties[result->second].as_ArrayString();
+        return prop->as_ArrayString();
     }
     return std::vector<wxue::string>();
 }
 
 wxue::string* Node::get_PropValuePtr(PropName name)
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return m_properties[result->second].as_raw_ptr();
+        return prop->as_raw_ptr();
     }
     return nullptr;
 }
@@ -468,45 +491,45 @@ wxue::string* Node::get_PropValuePtr(PropName name)
 wxue::string Node::get_PropId() const
 {
     wxue::string id_prop;
-    if (auto result = m_prop_indices.find(prop_id); result != m_prop_indices.end())
+    if (auto* prop = FindProp(prop_id); prop)
     {
-        id_prop = m_properties[result->second].get_PropId();
+        id_prop = prop->get_PropId();
     }
     return id_prop;
 }
 
 std::vector<NODEPROP_STATUSBAR_FIELD> Node::as_statusbar_fields(PropName name)
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return m_properties[result->second].as_statusbar_fields();
+        return prop->as_statusbar_fields();
     }
     return {};
 }
 
 std::vector<NODEPROP_CHECKLIST_ITEM> Node::as_checklist_items(PropName name)
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return m_properties[result->second].as_checklist_items();
+        return prop->as_checklist_items();
     }
     return {};
 }
 
 std::vector<NODEPROP_RADIOBOX_ITEM> Node::as_radiobox_items(PropName name)
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return m_properties[result->second].as_radiobox_items();
+        return prop->as_radiobox_items();
     }
     return {};
 }
 
 std::vector<NODEPROP_BMP_COMBO_ITEM> Node::as_bmp_combo_items(PropName name)
 {
-    if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+    if (auto* prop = FindProp(name); prop)
     {
-        return m_properties[result->second].as_bmp_combo_items();
+        return prop->as_bmp_combo_items();
     }
     return {};
 }
@@ -527,14 +550,13 @@ std::string_view Node::get_PropDefaultValue(PropName name)
 
 std::string_view Node::get_NodeName() const
 {
-    auto iter = m_prop_indices.find(prop_var_name);
-    if (iter != m_prop_indices.end())
+    if (const auto* prop = FindProp(prop_var_name); prop)
     {
-        return m_properties[iter->second].as_view();
+        return prop->as_view();
     }
-    if (iter = m_prop_indices.find(prop_class_name); iter != m_prop_indices.end())
+    if (const auto* prop = FindProp(prop_class_name); prop)
     {
-        return m_properties[iter->second].as_view();
+        return prop->as_view();
     }
     return {};
 }
@@ -1043,88 +1065,28 @@ void Node::ModifyProperty(NodeProperty* prop, wxue::string_view value)
 
 std::string Node::get_UniqueName(const std::string& proposed_name, PropName prop_name)
 {
-    std::string new_name(proposed_name);
     if (is_Form())
     {
         return {};
     }
 
-    Node* form = get_Form();
-    if (!form)
-    {
-        return {};
-    }
-
-    std::unordered_set<std::string> name_set;
-
-    if (prop_name == prop_var_name)
-    {
-        for (const auto& iter: reserved_names)
-        {
-            name_set.emplace(iter);
-        }
-
-        form->CollectUniqueNames(name_set, this, prop_name);
-    }
-    else if (is_Gen(gen_propGridItem) || is_Gen(gen_propGridCategory))
-    {
-        if (Node* parent = get_Parent(); parent)
-        {
-            if (parent->is_Gen(gen_propGridPage))
-            {
-                parent = parent->get_Parent();
-            }
-            if (parent)
-            {
-                parent->CollectUniqueNames(name_set, this, prop_name);
-            }
-        }
-    }
-    else
+    if (prop_name != prop_var_name &&
+        (prop_name != prop_label || (!is_Gen(gen_propGridItem) && !is_Gen(gen_propGridCategory))))
     {
         FAIL_MSG("unsupported prop_name");
-        return new_name;
+        return proposed_name;
     }
 
-    if (auto iter = name_set.find(new_name); iter != name_set.end())
+    auto* index = NameIndex::Get(this, prop_name);
+    if (!index)
     {
-        // We get here if the name has already been used.
-
-        std::string org_name(proposed_name);
-        while (wxue::is_digit(org_name.back()))
-        {
-            // remove any trailing digits
-            org_name.erase(org_name.size() - 1, 1);
-        }
-
-        if (org_name.empty())
-        {
-            return proposed_name;
-        }
-
-        for (int i = 2; iter != name_set.end(); iter = name_set.find(new_name), ++i)
-        {
-            if (org_name.back() == '_')
-            {
-                org_name.pop_back();
-            }
-            new_name = org_name + std::to_string(i);
-        }
+        return prop_name == prop_var_name ? std::string() : proposed_name;
     }
 
     // We return this name whether or not it has actually changed.
-    return new_name;
+    return index->MakeUnique(proposed_name, this, prop_name);
 }
 
-static constexpr auto s_var_names = std::to_array<PropName>({
-
-    prop_var_name,
-    prop_checkbox_var_name,
-    prop_radiobtn_var_name,
-    prop_validator_variable,
-
-});
-
 bool Node::FixDuplicateName()
 {
     if (is_Type(type_form) || is_Type(type_frame_form) || is_Type(type_menubar_form) ||
@@ -1135,244 +1097,84 @@ bool Node::FixDuplicateName()
         return false;
     }
 
-    Node* form = get_Form();
-    ASSERT(form || is_Folder());
-    if (!form)
+    ASSERT(get_Form() || is_Folder());
+    auto* index = NameIndex::Get(this, prop_var_name);
+    if (!index)
     {
         return false;
     }
 
-    std::unordered_set<std::string> name_set;
-    for (const auto& iter: reserved_names)
-    {
-        name_set.emplace(iter);
-    }
-
-    form->CollectUniqueNames(name_set, this);
-
-    bool replaced = false;
-    for (const auto& iter: s_var_names)
-    {
-        if (const auto& name = as_string(iter); !name.empty())
-        {
-            if (name_set.contains(name))
-            {
-                // We get here if the name has already been used.
-
-                std::string org_name(name);
-                while (wxue::is_digit(org_name.back()))
-                {
-                    // remove any trailing digits
-                    org_name.erase(org_name.size() - 1, 1);
-                }
-                if (org_name.empty())
-                {
-                    org_name = "_";
-                }
-                if (org_name.back() == '_')
-                {
-                    org_name.erase(org_name.size() - 1, 1);
-                }
-
-                std::string new_name(org_name);
-                for (int i = 2; name_set.contains(new_name); ++i)
-                {
-                    new_name.clear();
-                    new_name = org_name + std::to_string(i);
-                }
-
-                NodeProperty* fix_name = get_PropPtr(iter);
-                fix_name->set_value(new_name);
-                replaced = true;
-            }
-        }
-    }
-
-    if (is_Gen(gen_propGridItem) || is_Gen(gen_propGridCategory))
-    {
-        name_set.clear();
-        form->CollectUniqueNames(name_set, this, prop_label);
-
-        const std::string org_name(as_string(prop_label));
-        const std::string result = get_UniqueName(org_name, prop_label);
-        if (result != as_string(prop_label))
-        {
-            NodeProperty* fix_name = get_PropPtr(prop_label);
-            fix_name->set_value(result);
-        }
-    }
+    const bool replaced = FixDuplicateVariableNames(*index);
+    FixPropGridLabelIfNeeded();
 
     return replaced;
 }
 
 void Node::FixDuplicateNodeNames(Node* form)
 {
-    if (!form)
+    if (!form && is_Form())
     {
-        if (is_Form())
-        {
-            for (auto& child: get_ChildNodePtrs())
-            {
-                child->FixDuplicateNodeNames(this);
-            }
-            return;
-        }
-
-        form = get_Form();
-
-        ASSERT(form);
-        if (!form)
+        for (auto& child: get_ChildNodePtrs())
         {
-            return;
+            child->FixDuplicateNodeNames(this);
         }
+        return;
     }
 
-    // Collect all variable names except for those in the current node. Then check if any of
-    // the variable names in the current node are duplicated in other nodes, and if so fix
-    // them. Then step into each of the child nodes recursively until all nodes have been
-    // processed. The reason for collecting the names for each set is because there could be
-    // multiple identical names if the node was generated by one of the CreateNew functions.
-    // Even pasting in from wxSmith or wxFormBuilder could have multiple identical names if
-    // they didn't do their own name fixups correctly.
-
-    std::unordered_set<std::string> name_set;
-    InitializeNameSet(name_set);
-    form->CollectUniqueNames(name_set, this);
-
-    FixDuplicateVariableNames(name_set);
-    FixChildrenNodeNames(form);
-    FixPropGridLabelIfNeeded();
-}
-
-void Node::InitializeNameSet(std::unordered_set<std::string>& name_set)
-{
-    for (const auto& iter: reserved_names)
+    // Every node in the form shares one index, which is updated as each name is fixed. Nodes
+    // created by one of the CreateNew functions, or pasted in from wxSmith or wxFormBuilder,
+    // could have multiple identical names. Each node visited is given a numeric suffix if any
+    // other node in the form still uses its name, so nodes outside of this one keep their names,
+    // and within this node the last node with a given name keeps it.
+    auto* index = NameIndex::Get(this, prop_var_name);
+    ASSERT(index);
+    if (!index)
     {
-        name_set.emplace(iter);
+        return;
     }
+    FixNodeNames(*index);
 }
 
-std::string Node::GenerateUniqueNameFromBase(const std::string& base_name,
-                                             const std::unordered_set<std::string>& name_set)
+void Node::FixNodeNames(NameIndex& index)
 {
-    std::string org_name(base_name);
-    while (wxue::is_digit(org_name.back()))
-    {
-        // remove any trailing digits
-        org_name.erase(org_name.size() - 1, 1);
-    }
-    if (org_name.empty())
-    {
-        return base_name;
-    }
-    if (org_name.back() == '_')
-    {
-        org_name.erase(org_name.size() - 1, 1);
-    }
-
-    std::string new_name(org_name);
-    for (int i = 2; name_set.contains(new_name); ++i)
+    FixDuplicateVariableNames(index);
+    for (const auto& child: get_ChildNodePtrs())
     {
-        new_name.clear();
-        new_name = org_name + std::to_string(i);
+        child->FixNodeNames(index);
     }
-
-    return new_name;
+    FixPropGridLabelIfNeeded();
 }
 
-void Node::FixDuplicateVariableNames(const std::unordered_set<std::string>& name_set)
+bool Node::FixDuplicateVariableNames(NameIndex& index)
 {
-    for (const auto& iter: s_var_names)
+    bool replaced = false;
+    for (const auto prop_name: NameIndex::var_name_props)
     {
-        if (const wxue::string& name = as_string(iter); !name.empty())
+        if (const wxue::string& name = as_string(prop_name);
+            !name.empty() && index.is_Used(name, this, prop_name))
         {
-            if (name_set.contains(name))
-            {
-                // We get here if the name has already been used.
-                const std::string new_name = GenerateUniqueNameFromBase(name, name_set);
-                NodeProperty* fix_name = get_PropPtr(iter);
-                fix_name->set_value(new_name);
-            }
+            // We get here if the name has already been used.
+            index.Rename(this, prop_name, index.MakeUnique(name, this, prop_name, true));
+            replaced = true;
         }
     }
-}
-
-void Node::FixChildrenNodeNames(Node* form)
-{
-    for (const auto& child: get_ChildNodePtrs())
-    {
-        child->FixDuplicateNodeNames(form);
-    }
+    return replaced;
 }
 
 void Node::FixPropGridLabelIfNeeded()
 {
-    if (is_Gen(gen_propGridItem) || is_Gen(gen_propGridCategory))
+    if (!is_Gen(gen_propGridItem) && !is_Gen(gen_propGridCategory))
     {
-        std::unordered_set<std::string> name_set;
-        if (Node* parent = get_Parent(); parent)
-        {
-            if (parent && parent->is_Gen(gen_propGridPage))
-            {
-                parent = parent->get_Parent();
-            }
-
-            if (parent)
-            {
-                parent->CollectUniqueNames(name_set, this, prop_label);
-            }
-        }
-
-        const std::string org_name(as_string(prop_label));
-        const std::string result = get_UniqueName(org_name, prop_label);
-        if (result != as_string(prop_label))
-        {
-            NodeProperty* fix_name = get_PropPtr(prop_label);
-            fix_name->set_value(result);
-        }
+        return;
     }
-}
-
-void Node::CollectUniqueNames(std::unordered_set<std::string>& name_set, Node* cur_node,
-                              PropName prop_name)
-{
-    if (!is_Form() && cur_node != this && !is_Gen(gen_wxPropertyGrid) &&
-        !is_Gen(gen_wxPropertyGridManager))
+    if (auto* index = NameIndex::Get(this, prop_label); index)
     {
-        if (prop_name == prop_var_name)
+        if (const wxue::string& label = as_string(prop_label);
+            index->is_Used(label, this, prop_label))
         {
-            for (const auto& iter: s_var_names)
-            {
-                // First check the parent node
-                if (const wxue::string& name = as_string(iter); !name.empty())
-                {
-                    name_set.emplace(name);
-                }
-
-                // Now check the child node, skipping prop_var_name. This is needed in order to
-                // pick up validator names.
-                if (iter != prop_var_name)
-                {
-                    if (const wxue::string& name = cur_node->as_string(iter); !name.empty())
-                    {
-                        name_set.emplace(name);
-                    }
-                }
-            }
-        }
-        else
-        {
-            if (const wxue::string& name = as_string(prop_name); !name.empty())
-            {
-                name_set.emplace(name);
-            }
+            index->Rename(this, prop_label, index->MakeUnique(label, this, prop_label));
         }
     }
-
-    for (const auto& iter: get_ChildNodePtrs())
-    {
-        iter->CollectUniqueNames(name_set, cur_node, prop_name);
-    }
 }
 
 ptrdiff_t Node::FindInsertionPos(Node* child) const
@@ -1401,13 +1203,21 @@ size_t Node::get_NodeSize() const
         size += iter.get_PropSize();
     }
 
-    for (const auto& iter: m_map_events)
+    for (const auto& iter: m_events)
     {
-        size += iter.second.get_EventSize();
+        size += iter.get_EventSize();
     }
 
-    size += (m_prop_indices.size() * (sizeof(size_t) * 2));
+    return size;
+}
 
+size_t Node::get_TreeSize() const
+{
+    size_t size = get_NodeSize();
+    for (const auto& child: m_children)
+    {
+        size += child->get_TreeSize();
+    }
     return size;
 }
 
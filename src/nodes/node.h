@@ -34,8 +34,8 @@ class wxAnimation;
 struct ImageBundle;
 
 class Node;
+class NameIndex;
 using NodeSharedPtr = std::shared_ptr<Node>;
-using NodeMapEvents = std::unordered_map<std::string, NodeEvent, str_view_hash, std::equal_to<>>;
 
 using namespace GenEnum;
 
@@ -70,6 +70,10 @@ public:
 
     Node(NodeDeclaration* declaration);
 
+    // Clears the parent link of any child that outlives this node (e.g., a child held by the
+    // undo stack or the clipboard).
+    ~Node();
+
     // Use get_name() if you want the enum value.
     auto get_DeclName() const noexcept { return m_declaration->get_DeclName(); }
 
@@ -78,16 +82,21 @@ public:
     // Given a Node*, you can call this to get the std::shared_ptr<Node> for it.
     NodeSharedPtr get_SharedPtr() { return shared_from_this(); }
 
-    NodeSharedPtr get_ParentPtr() const noexcept { return m_parent; }
-    Node* get_Parent() const noexcept { return m_parent.get(); }
+    // The parent link is not an owning reference -- this returns nullptr if the node has no
+    // parent.
+    NodeSharedPtr get_ParentPtr() const
+    {
+        return m_parent ? m_parent->get_SharedPtr() : NodeSharedPtr();
+    }
+    Node* get_Parent() const noexcept { return m_parent; }
 
     NodeSharedPtr get_ChildPtr(size_t index) { return m_children.at(index); }
     Node* get_Child(size_t index) const noexcept { return m_children.at(index).get(); }
     std::vector<NodeSharedPtr>& get_ChildNodePtrs() { return m_children; }
     const std::vector<NodeSharedPtr>& get_ChildNodePtrs() const { return m_children; }
 
-    void set_Parent(NodeSharedPtr parent) { m_parent = std::move(parent); }
-    void set_Parent(Node* parent) { m_parent = parent->get_SharedPtr(); }
+    void set_Parent(const NodeSharedPtr& parent) noexcept { m_parent = parent.get(); }
+    void set_Parent(Node* parent) noexcept { m_parent = parent; }
 
     // --- Property Access ---
 
@@ -96,7 +105,7 @@ public:
     // --- Event Access ---
 
     NodeEvent* get_Event(std::string_view name);
-    NodeMapEvents& get_MapEvents() { return m_map_events; }
+    std::vector<NodeEvent>& get_Events() { return m_events; }
 
     auto get_PropertyCount() const { return m_properties.size(); }
     size_t get_InUseEventCount() const;
@@ -115,10 +124,12 @@ public:
     size_t get_ChildPosition(const NodeSharedPtr& node) { return get_ChildPosition(node.get()); }
     bool ChangeChildPosition(const NodeSharedPtr& node, size_t pos);
 
+    // These clear the parent of each removed child that still points to this node, so that a
+    // detached subtree never refers to a parent that is no longer keeping it alive.
     void RemoveChild(Node* node);
     void RemoveChild(const NodeSharedPtr& node) { RemoveChild(node.get()); }
     void RemoveChild(size_t index);
-    void removeAllChildren() { m_children.clear(); }
+    void removeAllChildren();
 
     auto get_ChildCount() const { return m_children.size(); }
 
@@ -255,7 +266,7 @@ public:
     bool HasValue(PropName name) const;
 
     // Returns true if the property exists
-    bool HasProp(PropName name) const { return (m_prop_indices.contains(name)); }
+    bool HasProp(PropName name) const { return (FindProp(name) != nullptr); }
 
     // --- Property Checks & Modification ---
 
@@ -305,9 +316,9 @@ public:
 
     bool as_bool(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return (m_properties[result->second].as_string().atoi() != 0);
+            return (prop->as_string().atoi() != 0);
         }
         return false;
     }
@@ -316,18 +327,18 @@ public:
     // (see NodeCreation.get_ConstantAsInt()). Otherwise, it calls atoi().
     int as_int(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_int();
+            return prop->as_int();
         }
         return 0;
     }
 
     const wxue::string& as_constant(PropName name, std::string_view prefix)
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_constant(prefix);
+            return prop->as_constant(prefix);
         }
         return wxue::wxue_empty_string;
     }
@@ -337,9 +348,9 @@ public:
     // Returns wxID_ANY if constant is not found
     int as_id(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_id();
+            return prop->as_id();
         }
 
         return wxID_ANY;
@@ -347,36 +358,36 @@ public:
 
     double as_double(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_float();
+            return prop->as_float();
         }
         return 0;
     }
 
     const wxue::string& as_string(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_string();
+            return prop->as_string();
         }
         return wxue::wxue_empty_string;
     }
 
     std::string_view as_view(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_view();
+            return prop->as_view();
         }
         return {};
     }
 
     const std::string& as_std(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_string();
+            return prop->as_string();
         }
         return wxue::wxue_empty_string;
     }
@@ -386,81 +397,81 @@ public:
     // The string will be empty if the property doesn't exist.
     wxString as_wxString(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_wxString();
+            return prop->as_wxString();
         }
         return {};
     }
 
     wxBitmapBundle as_wxBitmapBundle(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_bitmap_bundle();
+            return prop->as_bitmap_bundle();
         }
         return wxNullBitmap;
     }
 
     wxBitmap as_wxBitmap(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_bitmap();
+            return prop->as_bitmap();
         }
         return wxNullBitmap;
     }
 
     wxColour as_wxColour(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_color();
+            return prop->as_color();
         }
         return {};
     }
 
     wxFont as_wxFont(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_font();
+            return prop->as_font();
         }
         return *wxNORMAL_FONT;
     }
 
     FontProperty as_font_prop(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_font_prop();
+            return prop->as_font_prop();
         }
         return FontProperty(wxNORMAL_FONT);
     }
 
     wxPoint as_wxPoint(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_point();
+            return prop->as_point();
         }
         return wxDefaultPosition;
     }
 
     wxSize as_wxSize(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_size();
+            return prop->as_size();
         }
         return wxDefaultSize;
     }
 
     wxArrayString as_wxArrayString(PropName name) const
     {
-        if (auto result = m_prop_indices.find(name); result != m_prop_indices.end())
+        if (auto* prop = FindProp(name); prop)
         {
-            return m_properties[result->second].as_wxArrayString();
+            return prop->as_wxArrayString();
         }
         return {};
     }
@@ -530,13 +541,6 @@ public:
 
     bool FixDuplicateName();
 
-    // Collects all unique var_name, checkbox_var_name, radiobtn_var_name and
-    // validator_variable properties in the current form
-    //
-    // If prop_name is != prop_var_name, only that property is collected.
-    void CollectUniqueNames(std::unordered_set<std::string>& name_set, Node* cur_node,
-                            PropName prop_name = prop_var_name);
-
     // --- Insertion & Position ---
 
     ptrdiff_t FindInsertionPos(Node* child) const;
@@ -550,6 +554,9 @@ public:
     // Currently only called in debug builds, but available for release builds should we need it
     size_t get_NodeSize() const;
 
+    // get_NodeSize() of this node and all of its descendants
+    size_t get_TreeSize() const;
+
     // This writes XML files in the 1.1 layout using attributes for properties
     void AddNodeToDoc(pugi::xml_node& node, int& project_version);
 
@@ -589,6 +596,29 @@ protected:
     void FindAllChildProperties(std::vector<NodeProperty*>& list, PropName name);
 
 private:
+    // Returns nullptr if the node doesn't have the property
+    const NodeProperty* FindProp(PropName name) const noexcept
+    {
+        if (m_properties.size() == m_declaration->get_NodePropCount() &&
+            name < prop_name_array_size) [[likely]]
+        {
+            if (const size_t slot = m_declaration->get_PropSlots()[name];
+                slot < m_properties.size())
+            {
+                return &m_properties[slot];
+            }
+            return nullptr;
+        }
+        return FindAddedProp(name);
+    }
+    NodeProperty* FindProp(PropName name) noexcept
+    {
+        return const_cast<NodeProperty*>(std::as_const(*this).FindProp(name));
+    }
+
+    // Lookup used when an importer added properties that aren't part of the declaration
+    const NodeProperty* FindAddedProp(PropName name) const noexcept;
+
     static int GetBorderDirection(std::string_view border_settings);
     static void ApplyAlignment(wxSizerFlags& flags, const wxue::string& alignment);
     static void ApplyAdditionalFlags(wxSizerFlags& flags, const wxue::string& prop);
@@ -614,26 +644,24 @@ private:
     void PostProcessNewNode(NodeSharedPtr& new_node, GenName name);
 
     // Helper methods for FixDuplicateNodeNames to reduce complexity
-    static void InitializeNameSet(std::unordered_set<std::string>& name_set);
-    static std::string GenerateUniqueNameFromBase(const std::string& base_name,
-                                                  const std::unordered_set<std::string>& name_set);
-    void FixDuplicateVariableNames(const std::unordered_set<std::string>& name_set);
-    void FixChildrenNodeNames(Node* form);
+    void FixNodeNames(NameIndex& index);
+    bool FixDuplicateVariableNames(NameIndex& index);
     void FixPropGridLabelIfNeeded();
 
-    NodeSharedPtr m_parent;
+    // Children are owned by their parent's m_children, so the link back to the parent is a raw
+    // pointer. This keeps the tree free of reference cycles -- releasing the last reference to a
+    // node frees its entire subtree -- and means linking a child never touches the parent's
+    // reference count.
+    Node* m_parent { nullptr };
 
     // Properties and events are added when the node is created, and then never changed for the
     // life of the node -- only the value of the property or event is changed.
 
-    // The vector makes it possible to iterate through the properties in the order they were
-    // created in the XML file. The map gives us a fast lookup into the vector.
+    // Both vectors are in the order the declaration (and its base classes) declared them. The
+    // declaration's slot tables map a PropName or event name to an index in these vectors, so
+    // the node itself doesn't need any lookup structure.
     std::vector<NodeProperty> m_properties;
-    std::map<PropName, size_t> m_prop_indices;
-
-    // using NodeMapEvents = std::unordered_map<std::string, NodeEvent, str_view_hash,
-    // std::equal_to<>>;
-    std::unordered_map<std::string, NodeEvent, str_view_hash, std::equal_to<>> m_map_events;
+    std::vector<NodeEvent> m_events;
 
     std::vector<NodeSharedPtr> m_children;
     NodeDeclaration* m_declaration;
@@ -642,4 +670,3 @@ private:
     std::unique_ptr<std::vector<wxue::string>> m_internal_data;
 };
 
-using NodeMapEvents = std::unordered_map<std::string, NodeEvent, str_view_hash, std::equal_to<>>;
@@ -0,0 +1,63 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Monotonic arena for Node allocations
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include <utility>  // for std::exchange
+
+#include "node_arena.h"
+
+namespace
+{
+    thread_local std::shared_ptr<NodeArena> t_current_arena;
+}  // namespace
+
+NodeArena::NodeArena(size_t initial_size) : m_resource(initial_size, &m_upstream) {}
+
+auto NodeArena::Current() -> const std::shared_ptr<NodeArena>&
+{
+    return t_current_arena;
+}
+
+NodeArena::Scope::Scope(std::shared_ptr<NodeArena> arena) :
+    m_previous(std::exchange(t_current_arena, std::move(arena)))
+{
+}
+
+NodeArena::Scope::~Scope()
+{
+    t_current_arena = std::move(m_previous);
+}
+
+auto NodeArena::GetStats() -> Stats
+{
+    const std::scoped_lock lock(m_mutex);
+    return { m_allocations, m_bytes, m_upstream.m_blocks, m_upstream.m_bytes };
+}
+
+void* NodeArena::do_allocate(size_t bytes, size_t alignment)
+{
+    const std::scoped_lock lock(m_mutex);
+    ++m_allocations;
+    m_bytes += bytes;
+    return m_resource.allocate(bytes, alignment);
+}
+
+void NodeArena::do_deallocate(void* /* ptr */, size_t /* bytes */, size_t /* alignment */)
+{
+    // Nothing is freed until the arena itself is destroyed
+}
+
+void* NodeArena::BlockCounter::do_allocate(size_t bytes, size_t alignment)
+{
+    ++m_blocks;
+    m_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void NodeArena::BlockCounter::do_deallocate(void* ptr, size_t bytes, size_t alignment)
+{
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+}
@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Monotonic arena for Node allocations
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Loading a project or copying a subtree creates thousands of nodes at once, and closing the
+// project frees them all together. While a NodeArena::Scope is active on a thread,
+// NodeCreator allocates each Node (and its shared_ptr control block) from that scope's arena
+// rather than making a separate heap allocation for it.
+//
+// Every node allocated from an arena keeps the arena alive through the allocator stored in its
+// control block, so a node can safely outlive the project it was loaded with (e.g., in the undo
+// stack or the clipboard). Memory is only returned when the last such node is destroyed, at
+// which point the arena releases all of its blocks at once.
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+class NodeArena : public std::pmr::memory_resource
+{
+public:
+    // initial_size is the size of the first block -- each block after that is larger.
+    explicit NodeArena(size_t initial_size);
+
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    [[nodiscard]] static auto Create(size_t initial_size) -> std::shared_ptr<NodeArena>
+    {
+        return std::make_shared<NodeArena>(initial_size);
+    }
+
+    // Returns the arena set by the innermost Scope on this thread, or nullptr if there isn't
+    // one.
+    [[nodiscard]] static auto Current() -> const std::shared_ptr<NodeArena>&;
+
+    // Sets the current arena for this thread until the Scope is destroyed. Worker threads that
+    // create nodes for a project being loaded need their own Scope using the same arena.
+    class Scope
+    {
+    public:
+        explicit Scope(std::shared_ptr<NodeArena> arena);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::shared_ptr<NodeArena> m_previous;
+    };
+
+    struct Stats
+    {
+        size_t allocations;  // number of nodes (and control blocks) allocated from the arena
+        size_t bytes;        // total size of those allocations
+        size_t blocks;       // number of heap allocations the arena made
+        size_t block_bytes;  // total size of the heap allocations
+    };
+    [[nodiscard]] auto GetStats() -> Stats;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+        -> bool override
+    {
+        return this == &other;
+    }
+
+private:
+    // Counts the blocks that m_resource requests from the heap
+    class BlockCounter : public std::pmr::memory_resource
+    {
+    public:
+        size_t m_blocks { 0 };
+        size_t m_bytes { 0 };
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+        [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+            -> bool override
+        {
+            return this == &other;
+        }
+    };
+
+    BlockCounter m_upstream;
+    std::pmr::monotonic_buffer_resource m_resource;
+
+    // Forms are created in parallel when a project is loaded, so allocations must be serialized.
+    std::mutex m_mutex;
+
+    size_t m_allocations { 0 };
+    size_t m_bytes { 0 };
+};
+
+// Used with std::allocate_shared() -- the copy stored in the control block holds a reference
+// to the arena.
+template <typename T>
+class NodeArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit NodeArenaAllocator(std::shared_ptr<NodeArena> arena) : m_arena(std::move(arena)) {}
+
+    template <typename U>
+    NodeArenaAllocator(const NodeArenaAllocator<U>& other) : m_arena(other.get_Arena())
+    {
+    }
+
+    [[nodiscard]] auto allocate(size_t count) -> T*
+    {
+        return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* ptr, size_t count)
+    {
+        m_arena->deallocate(ptr, count * sizeof(T), alignof(T));
+    }
+
+    [[nodiscard]] auto get_Arena() const -> const std::shared_ptr<NodeArena>& { return m_arena; }
+
+    template <typename U>
+    auto operator==(const NodeArenaAllocator<U>& other) const -> bool
+    {
+        return m_arena == other.get_Arena();
+    }
+
+private:
+    std::shared_ptr<NodeArena> m_arena;
+};
@@ -7,12 +7,14 @@
 // CR: [07-16-2026]
 
 #include <format>
+#include <optional>
 
 #include "node_creator.h"
 
 #include "base_generator.h"   // BaseGenerator -- Base Generator class
 #include "gen_enums.h"        // Enumerations for nodes
 #include "node.h"             // Node class
+#include "node_arena.h"       // NodeArena -- Monotonic arena for Node allocations
 #include "project_handler.h"  // ProjectHandler class
 #include "prop_decl.h"        // PropChildDeclaration and PropDeclaration classes
 
@@ -35,9 +37,18 @@ NodeDeclaration* NodeCreator::get_NodeDeclaration(std::string_view class_name)
     return nullptr;
 }
 
+NodeSharedPtr NodeCreator::AllocateNode(NodeDeclaration* node_decl)
+{
+    if (const auto& arena = NodeArena::Current(); arena)
+    {
+        return std::allocate_shared<Node>(NodeArenaAllocator<Node>(arena), node_decl);
+    }
+    return std::make_shared<Node>(node_decl);
+}
+
 NodeSharedPtr NodeCreator::NewNode(NodeDeclaration* node_decl)
 {
-    auto node = std::make_shared<Node>(node_decl);
+    auto node = AllocateNode(node_decl);
 
     // Calling GetBaseClassCount() is expensive, so do it once and store the result
     auto node_info_base_count = node_decl->GetBaseClassCount();
@@ -49,19 +60,19 @@ NodeSharedPtr NodeCreator::NewNode(NodeDeclaration* node_decl)
         {
             auto* prop_declaration = class_info->get_PropDeclaration(index);
 
-            // Set the default value, either from the property info, or an override from this class
-            auto defaultValue = prop_declaration->getDefaultValue();
+            // Set the default value, either from the property info, or an override from this class.
+            // Both are in PropValuePool, so the property only stores a pointer to the value.
+            auto* prop = node->AddNodeProperty(prop_declaration);
             if (base > 0)
             {
-                auto result = node_decl->GetOverRideDefValue(prop_declaration->get_name());
-                if (result)
+                if (auto result = node_decl->GetOverRideDefValue(prop_declaration->get_name());
+                    result)
                 {
-                    defaultValue = result.value();
+                    prop->set_value(result.value());
+                    continue;
                 }
             }
-
-            auto* prop = node->AddNodeProperty(prop_declaration);
-            prop->set_value(defaultValue);
+            prop->set_value(prop_declaration->getDefaultValue());
         }
 
         for (size_t index = 0; index < class_info->get_EventCount(); ++index)
@@ -402,6 +413,14 @@ NodeSharedPtr NodeCreator::MakeCopy(Node* node, Node* parent)
 {
     ASSERT(node);
 
+    // The outermost call creates an arena for the entire copy -- recursive calls for the
+    // children (and copies made while a project is loading) use the current one.
+    std::optional<NodeArena::Scope> arena_scope;
+    if (!NodeArena::Current())
+    {
+        arena_scope.emplace(NodeArena::Create(copy_arena_size));
+    }
+
     auto copyObj = CreateToolCopy(node, parent);
     if (!copyObj)
     {
@@ -458,7 +477,7 @@ void NodeCreator::CopyProperties(Node* source, NodeSharedPtr& target)
     {
         if (auto* copyProp = target->get_PropPtr(iter.get_name()); copyProp)
         {
-            copyProp->set_value(iter.as_view());
+            copyProp->CopyValue(iter);
         }
     }
 }
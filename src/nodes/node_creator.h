@@ -10,7 +10,9 @@
 #include <array>
 #include <map>
 #include <unordered_set>
+#include <string>
 #include <utility>  // for std::pair
+#include <vector>
 
 #include "hash_map.h"  // Find std::string_view key in std::unordered_map
 
@@ -26,9 +28,32 @@ using namespace GenEnum;
 class Node;
 class NodeCategory;
 
+namespace node_tables
+{
+    struct Category;
+    struct File;
+    struct Generator;
+    struct Property;
+}  // namespace node_tables
+
 using NodeDeclarationArray = std::array<NodeDeclaration*, gen_name_array_size>;
 using NodeSharedPtr = std::shared_ptr<Node>;
 
+// CreateNodeFromXml() records anything that would otherwise update the project or display a
+// message here when it is creating a node on a worker thread.
+struct XmlLoadLog
+{
+    struct UnknownProperty
+    {
+        std::string class_name;
+        std::string prop_name;
+        std::string value;
+    };
+
+    std::vector<UnknownProperty> unknown_props;
+    bool project_updated { false };
+};
+
 // Contains definitions of all components
 class NodeCreator
 {
@@ -66,9 +91,11 @@ public:
     auto CreateNode(std::string_view name, Node* parent, bool verify_language_support = false)
         -> std::pair<NodeSharedPtr, Node::Validity>;
 
+    // If load_log is set, the node can be safely created on a worker thread as long as parent
+    // is nullptr or is only accessed by the same thread.
     auto CreateNodeFromXml(pugi::xml_node& xml_obj, Node* parent = nullptr,
-                           bool check_for_duplicates = false, bool allow_ui = true)
-        -> NodeSharedPtr;
+                           bool check_for_duplicates = false, bool allow_ui = true,
+                           XmlLoadLog* load_log = nullptr) -> NodeSharedPtr;
 
     // Only use this with .wxui projects -- it will fail on a .fbp project
     auto CreateProjectNode(pugi::xml_node* xml_obj, bool allow_ui = true) -> NodeSharedPtr;
@@ -76,6 +103,10 @@ public:
     // Creates an orphaned node.
     static auto NewNode(NodeDeclaration* node_decl) -> NodeSharedPtr;
 
+    // Allocates a Node without any properties or events, using the current NodeArena if there
+    // is one.
+    static auto AllocateNode(NodeDeclaration* node_decl) -> NodeSharedPtr;
+
     // Creates an orphaned node.
     auto NewNode(GenEnum::GenName get_GenName) -> NodeSharedPtr
     {
@@ -123,10 +154,9 @@ public:
     static auto CountChildrenWithSameType(Node* parent, GenType type) -> size_t;
 
 protected:
-    // This must
-    void ParseGeneratorFile(const char* xml_data);
-    void ParseProperties(pugi::xml_node& elem_obj, NodeDeclaration* node_declaration,
-                         NodeCategory& category);
+    void ParseGeneratorFile(const node_tables::File& file);
+    void ParseProperties(const node_tables::Category& table_category,
+                         NodeDeclaration* node_declaration, NodeCategory& category);
 
     auto get_NodeType(GenEnum::GenType type_name) -> NodeType*
     {
@@ -136,12 +166,21 @@ protected:
     void AddAllConstants();
 
 private:
+    // Initial block sizes for the NodeArena created by CreateProjectNode() and MakeCopy(). Most
+    // copies are a single widget or form, so that arena starts out small.
+    static constexpr size_t project_arena_size = 256 * 1024;
+    static constexpr size_t copy_arena_size = 4 * 1024;
+
     // Helper methods for MakeCopy
     auto CreateToolCopy(Node* node, Node* parent) -> NodeSharedPtr;
     static void CopyProperties(Node* source, NodeSharedPtr& target);
     auto ConvertFormToControl(NodesParentChild nodes) -> NodeSharedPtr;
     void CopyChildren(Node* source, NodeSharedPtr& target);
 
+    // Creates the forms and folders of a project, using BackgroundTasks to create them in
+    // parallel when the project is already in the current format.
+    void CreateProjectChildren(pugi::xml_node& xml_obj, Node* project, bool allow_ui);
+
     // Helper methods for CreateNode
     [[nodiscard]] auto ResolveNodeDeclaration(GenName name) const -> NodeDeclaration*;
     [[nodiscard]] static auto ValidateParentConstraints(GenName name, NodeDeclaration* node_decl,
@@ -155,15 +194,17 @@ private:
         -> bool;
 
     // Helper methods for ParseGeneratorFile
-    NodeDeclaration* ParseGenerator(pugi::xml_node& generator, bool is_interface);
-    void ProcessGeneratorInheritance(pugi::xml_node& elem_obj);
-    static void SetupGeneratorImage(pugi::xml_node& generator, NodeDeclaration* declaration);
-    static GenType DetermineGenType(pugi::xml_node& generator, bool is_interface);
+    NodeDeclaration* ParseGenerator(const node_tables::Generator& generator, bool is_interface);
+    void ProcessGeneratorInheritance(const node_tables::Generator& generator);
+    static void SetupGeneratorImage(const node_tables::Generator& generator,
+                                    NodeDeclaration* declaration);
+    static GenType DetermineGenType(const node_tables::Generator& generator, bool is_interface);
 
     // Helper methods for ParseProperties
-    static void ParseSingleProperty(pugi::xml_node& elem_prop, NodeDeclaration* node_declaration,
-                                    NodeCategory& category);
-    static void AddPropertyOptions(pugi::xml_node& elem_prop, PropDeclaration* prop_info);
+    static void ParseSingleProperty(const node_tables::Property& table_prop,
+                                    NodeDeclaration* node_declaration, NodeCategory& category);
+    static void AddPropertyOptions(const node_tables::Property& table_prop,
+                                   PropDeclaration* prop_info);
     static void AddVarNameRelatedProperties(NodeDeclaration* node_declaration,
                                             NodeCategory& category);
 
@@ -173,12 +214,6 @@ private:
     std::unordered_set<std::string, str_view_hash, std::equal_to<>> m_setOldHostTypes;
 
     std::unordered_map<std::string, int, str_view_hash, std::equal_to<>> m_map_constants;
-
-    // Contains the nodes that m_interfaces maps to -- valid only during Initialize()
-    pugi::xml_document* m_pdoc_interface { nullptr };
-
-    // Contains a map to every interface class -- valid only during Initialize()
-    std::map<std::string, pugi::xml_node, std::less<>> m_interfaces;
 };
 
 extern NodeCreator& NodeCreation;  // NOLINT (global variable) // cppcheck-suppress globalVariable
@@ -6,12 +6,15 @@
 /////////////////////////////////////////////////////////////////////////////
 // CR: [07-16-2026]
 
+#include <algorithm>
 #include <format>
 
 #include "node_decl.h"
 
 // BaseGenerator -- Base widget generator class
 #include "base_generator.h"  // IWYU pragma: keep
+#include "node_event.h"      // NodeEvent and NodeEventInfo classes
+#include "node_prop.h"       // PropValuePool
 #include "prop_decl.h"       // PropChildDeclaration and PropDeclaration classes
 
 NodeDeclaration::NodeDeclaration(wxue::string_view class_name, NodeType* type) :
@@ -81,6 +84,70 @@ const NodeEventInfo* NodeDeclaration::get_EventInfo(size_t idx) const
     return nullptr;
 }
 
+void NodeDeclaration::BuildNodeLayout()
+{
+    m_prop_slots.fill(no_slot);
+    m_node_prop_count = 0;
+    m_event_slots.clear();
+
+    // This must add properties and events in exactly the same order as NodeCreator::NewNode()
+    std::vector<const NodeDeclaration*> classes { this };
+    std::vector<NodeDeclaration*> base_classes;
+    GetBaseClasses(base_classes);
+    classes.insert(classes.end(), base_classes.begin(), base_classes.end());
+
+    size_t event_count = 0;
+    for (const auto* class_info: classes)
+    {
+        for (const auto& iter: class_info->m_properties)
+        {
+            // If a base class declares the same property, the node looks up the last one added
+            if (const auto name = iter.second->get_name(); name < prop_name_array_size)
+            {
+                m_prop_slots.at(name) = static_cast<std::uint16_t>(m_node_prop_count);
+            }
+            ++m_node_prop_count;
+        }
+
+        for (const auto& iter: class_info->m_events)
+        {
+            // Node::AddNodeEvent() doesn't add an event name a second time
+            std::string_view name = iter.second->get_name();
+            if (std::ranges::none_of(m_event_slots,
+                                     [name](const auto& slot)
+                                     {
+                                         return slot.first == name;
+                                     }))
+            {
+                m_event_slots.emplace_back(name, static_cast<std::uint16_t>(event_count++));
+            }
+        }
+    }
+
+    ASSERT_MSG(m_node_prop_count < no_slot && event_count < no_slot,
+               std::format("{} has too many properties or events", m_name));
+
+    std::ranges::sort(m_event_slots,
+                      [](const auto& lhs, const auto& rhs)
+                      {
+                          return lhs.first < rhs.first;
+                      });
+}
+
+auto NodeDeclaration::get_EventSlot(std::string_view name) const -> size_t
+{
+    auto iter = std::ranges::lower_bound(m_event_slots, name, std::less<> {},
+                                         [](const auto& slot)
+                                         {
+                                             return slot.first;
+                                         });
+    if (iter != m_event_slots.end() && iter->first == name)
+    {
+        return iter->second;
+    }
+    return no_slot;
+}
+
 NodeDeclaration* NodeDeclaration::GetBaseClass(size_t idx, bool inherited) const
 {
     if (inherited)
@@ -179,6 +246,25 @@ std::optional<wxue::string> NodeDeclaration::GetOverRideDefValue(GenEnum::PropNa
     return {};
 }
 
+void NodeDeclaration::AddValuesToPool()
+{
+    for (const auto& iter: m_properties)
+    {
+        auto* prop_declaration = iter.second;
+        prop_declaration->SetPooledDefault(
+            PropValuePool::Add(prop_declaration->getDefaultValue()));
+        for (const auto& option: prop_declaration->getOptions())
+        {
+            PropValuePool::Add(option.name);
+        }
+    }
+
+    for (const auto& iter: m_override_def_values)
+    {
+        PropValuePool::Add(iter.second);
+    }
+}
+
 wxBitmapBundle NodeDeclaration::GetBitmapBundle(int width, int height) const
 {
     if (m_bundle_function)
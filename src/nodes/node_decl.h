@@ -12,10 +12,13 @@
 #include <wx/bmpbndl.h>  // Declaration of wxBitmapBundle class.
 #include <wx/image.h>    // wxImage class
 
+#include <array>
+#include <cstdint>
 #include <map>
 #include <optional>
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "category.h"    // NodeCategory -- Node property categories
 #include "gen_enums.h"   // Enumerations for generators
@@ -32,9 +35,9 @@ using namespace GenEnum;
 using DeclPropMap = std::map<std::string, PropDeclaration*>;
 using DeclEventMap = std::map<std::string, NodeEventInfo*, std::less<>>;
 
-namespace pugi
+namespace node_tables
 {
-    class xml_node;
+    struct Category;
 }
 
 class NodeDeclaration
@@ -60,6 +63,29 @@ public:
     [[nodiscard]] const NodeEventInfo* get_EventInfo(wxue::string_view name) const;
     [[nodiscard]] const NodeEventInfo* get_EventInfo(size_t idx) const;
 
+    // Every node created from this declaration stores its properties and events in the same
+    // order (this class first, followed by each base class), so the lookup tables from a
+    // PropName or event name to a node's property or event index are shared by all of them.
+    // BuildNodeLayout() must be called once all of the declarations have been parsed.
+
+    static constexpr std::uint16_t no_slot = UINT16_MAX;
+    using PropSlots = std::array<std::uint16_t, GenEnum::prop_name_array_size>;
+
+    void BuildNodeLayout();
+
+    // Returns the index of each property in a node's property vector, or no_slot if the node
+    // doesn't have the property.
+    [[nodiscard]] auto get_PropSlots() const -> const PropSlots& { return m_prop_slots; }
+
+    // Returns the index of the event in a node's event vector, or no_slot if the node doesn't
+    // have the event.
+    [[nodiscard]] auto get_EventSlot(std::string_view name) const -> size_t;
+
+    // Number of properties and events that NodeCreator adds to a new node. Importers can add
+    // additional properties after that.
+    [[nodiscard]] auto get_NodePropCount() const -> size_t { return m_node_prop_count; }
+    [[nodiscard]] auto get_NodeEventCount() const -> size_t { return m_event_slots.size(); }
+
     auto GetPropInfoMap() -> auto& { return m_properties; }
     auto GetEventInfoMap() -> auto& { return m_events; }
 
@@ -98,7 +124,7 @@ public:
     void SetGenerator(BaseGenerator* generator) { m_generator = generator; }
     [[nodiscard]] BaseGenerator* get_Generator() const { return m_generator; }
 
-    void ParseEvents(pugi::xml_node& elem_obj, NodeCategory& category);
+    void ParseEvents(const node_tables::Category& table_category, NodeCategory& category);
 
     const std::string& GetGeneratorFlags() const { return m_internal_flags; }
     void SetGeneratorFlags(std::string_view flags) { m_internal_flags = flags; }
@@ -111,6 +137,10 @@ public:
     }
     std::optional<wxue::string> GetOverRideDefValue(GenEnum::PropName prop_name) const;
 
+    // Adds the default value and option names of every property this class declares, along
+    // with any overridden default values, to PropValuePool.
+    void AddValuesToPool();
+
     void HideProperty(GenEnum::PropName prop_name) { m_hide_properties.emplace(prop_name); }
     bool IsPropHidden(GenEnum::PropName prop_name) const
     {
@@ -138,6 +168,13 @@ private:
 
     std::vector<NodeDeclaration*> m_base;  // base classes
 
+    PropSlots m_prop_slots {};
+    size_t m_node_prop_count { 0 };
+
+    // Sorted by name so that get_EventSlot() can use a binary search. The name points into the
+    // NodeEventInfo which lives as long as the declaration does.
+    std::vector<std::pair<std::string_view, std::uint16_t>> m_event_slots;
+
     // Created by NodeCreator::InitGenerators(), destroyed by ~NodeDeclaration()
     BaseGenerator* m_generator { nullptr };
 
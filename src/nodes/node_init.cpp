@@ -7,7 +7,6 @@
 // CR: [07-16-2026]
 
 #include <format>
-#include <functional>
 
 #include <frozen/set.h>
 
@@ -18,34 +17,12 @@
 #include "gen_enums.h"       // Enumerations for generators
 #include "mainapp.h"         // App -- Main application class
 #include "node.h"            // Node class
+#include "node_tables.h"     // Node declaration tables generated from the XML files in src/xml/
 #include "node_types.h"      // NodeType -- Class for storing node types and allowable child count
 #include "prop_decl.h"       // PropChildDeclaration and PropDeclaration classes
-#include "wxue_data.h"       // Generated wxue_data strings and functions
-
-#include "pugixml.hpp"
 
 // clang-format off
 
-using namespace wxue_data;
-
-// These functions are declared in the wxue_data namespace, and retrieve the XML data as a string.
-// The data is compressed, so each function will decompress the data before returning it. See
-// wxue_data.h for the original xml file that was converted into a compressed string by wxUiEditor.
-const auto functionArray = std::to_array<std::function<std::string()>>({
-    get_bars,
-    get_boxes,
-    get_buttons,
-    get_containers,
-    get_data_ctrls,
-    get_forms,
-    get_mdi,
-    get_pickers,
-    get_project,
-    get_sizers,
-    get_text_ctrls,
-    get_widgets,
-});
-
 // var_names for these generators will default to "none" for class access
 // inline const GenName set_no_class_access[] = {
 constexpr auto set_no_class_access = frozen::make_set<GenName>({
@@ -455,6 +432,7 @@ void NodeCreator::Initialize()
     {
         GenEnum::rmap_PropNames[iter.second] = iter.first;
     }
+    GenEnum::InitPropNameHash();
 
     for (const auto& iter: map_PropMacros)
     {
@@ -480,61 +458,28 @@ void NodeCreator::Initialize()
         }
     }
 
+    // The declarations come from constexpr tables that build_resources generates from the XML
+    // files in src/xml/, so there is nothing to decompress or parse here. Interfaces are first
+    // in node_tables::files, so they exist before any other class inherits from them.
+    for (const auto& file: node_tables::files)
     {
-        // WARNING: m_pdoc_interface points to stack-local interface_doc. Must be
-        // cleared to nullptr before this block exits (see catch handler and lines
-        // 530-531). Any code added after this block must not access m_pdoc_interface.
-        pugi::xml_document interface_doc;
-        m_pdoc_interface = &interface_doc;
-
-        try
-        {
-            pugi::xml_parse_result const result =
-                interface_doc.load_string(wxue_data::get_interfaces());
-            if (!result)
-            {
-                FAIL_MSG("xml/interfaces.xml is corrupted!");
-                throw std::runtime_error("Internal XML file is corrupted.");
-            }
-
-            // Now parse the completed m_pdoc_interface document
-            ParseGeneratorFile("");
-
-            /*
-             [Randalphwa - 11-09-2025] I looked into turning this into threaded code, but it's not
-             really practical:
-
-            - XML decompression (in wxue_data functions) is already CPU-intensive and would saturate
-             cores
-            - Lock contention on m_a_declarations would serialize the critical sections anyway
-             - Memory allocation for NodeDeclaration objects has its own internal synchronization
-             overhead
-            - Only 12 iterations (based on functionArray size) - insufficient parallelism to
-             overcome threading overhead
+        ParseGeneratorFile(file);
+    }
 
-            */
+    InitGenerators();
 
-            for (const auto& iter: functionArray)
-            {
-                std::string const xml_data = iter();
-                if (!xml_data.empty())
-                {
-                    ParseGeneratorFile(xml_data.c_str());
-                }
-            }
-        }
-        catch (...)
+    // All base classes are known now, so every declaration can work out where its nodes will
+    // store each property and event. This is also the only time values are added to
+    // PropValuePool -- after this, the pool is read-only.
+    for (auto* declaration: m_a_declarations)
+    {
+        if (declaration)
         {
-            m_interfaces.clear();
-            m_pdoc_interface = nullptr;
-            throw;
+            declaration->BuildNodeLayout();
+            declaration->AddValuesToPool();
         }
-
-        m_interfaces.clear();
-        m_pdoc_interface = nullptr;
     }
-
-    InitGenerators();
+    PropValuePool::AddCommonValues();
 
     for (const auto& iter: fb_ImportTypes)
     {
@@ -542,39 +487,31 @@ void NodeCreator::Initialize()
     }
 }
 
-GenType NodeCreator::DetermineGenType(pugi::xml_node& generator, bool is_interface)
+GenType NodeCreator::DetermineGenType(const node_tables::Generator& generator, bool is_interface)
 {
     if (is_interface)
     {
         return type_interface;
     }
 
-    std::string_view type_name = generator.attribute("type").as_view();
-#if defined(_DEBUG)
-    if (is_interface && type_name != "interface")
-    {
-        ASSERT_MSG(type_name == "interface",
-                   "Don't put a non-interface class in an interface xml file!");
-    }
-#endif  // _DEBUG
-
     for (const auto& iter: map_GenTypes)
     {
-        if (type_name == iter.second)
+        if (generator.type == iter.second)
         {
             return iter.first;
         }
     }
 
 #if defined(_DEBUG)
-    ASSERT_MSG(false, std::format("Unrecognized class type -- {}", type_name));
+    ASSERT_MSG(false, std::format("Unrecognized class type -- {}", generator.type));
 #endif  // _DEBUG
     return gen_type_unknown;
 }
 
-void NodeCreator::SetupGeneratorImage(pugi::xml_node& generator, NodeDeclaration* declaration)
+void NodeCreator::SetupGeneratorImage(const node_tables::Generator& generator,
+                                      NodeDeclaration* declaration)
 {
-    std::string_view image_name = generator.attribute("image").as_view();
+    std::string_view image_name = generator.image;
     if (!image_name.empty())
     {
         if (auto bndl_function = GetSvgFunction(image_name); bndl_function)
@@ -609,13 +546,10 @@ void NodeCreator::SetupGeneratorImage(pugi::xml_node& generator, NodeDeclaration
     }
 }
 
-NodeDeclaration* NodeCreator::ParseGenerator(pugi::xml_node& generator, bool is_interface)
+NodeDeclaration* NodeCreator::ParseGenerator(const node_tables::Generator& generator,
+                                             bool is_interface)
 {
-    wxue::string class_name = generator.attribute("class").as_str();
-    if (class_name.starts_with("gen_"))
-    {
-        class_name.erase(0, sizeof("gen_") - 1);
-    }
+    std::string_view class_name = generator.class_name;
 
     if (wxGetApp().isTestingMenuEnabled())
     {
@@ -624,18 +558,15 @@ NodeDeclaration* NodeCreator::ParseGenerator(pugi::xml_node& generator, bool is_
             MSG_WARNING(std::format("{}{}",
                                     is_interface ? "Unrecognized interface name -- " :
                                                    "Unrecognized class name -- ",
-                                    class_name.c_str()));
+                                    class_name));
         }
     }
 
     // This code makes it possible to add `enable="internal"` to an XML class/interface to
     // prevent it from being used when not testing.
-    if (auto enable = generator.attribute("enable"); enable.as_view() == "internal")
+    if (generator.internal && !wxGetApp().isTestingMenuEnabled())
     {
-        if (!wxGetApp().isTestingMenuEnabled())
-        {
-            return nullptr;  // Skip this class if we're not testing
-        }
+        return nullptr;  // Skip this class if we're not testing
     }
 
     GenType const type = DetermineGenType(generator, is_interface);
@@ -644,44 +575,34 @@ NodeDeclaration* NodeCreator::ParseGenerator(pugi::xml_node& generator, bool is_
         return nullptr;
     }
 
-    if (is_interface)
-    {
-        m_interfaces[class_name] = generator;
-    }
-
     auto* declaration = new NodeDeclaration(class_name, get_NodeType(type));
     m_a_declarations.at(declaration->get_GenName()) = declaration;
 
-    if (auto flags = generator.attribute("flags").as_view(); !flags.empty())
+    if (!generator.flags.empty())
     {
-        declaration->SetGeneratorFlags(flags);
+        declaration->SetGeneratorFlags(generator.flags);
     }
 
+    const auto& category = node_tables::categories[generator.category];
     SetupGeneratorImage(generator, declaration);
-    ParseProperties(generator, declaration, declaration->GetCategory());
-    declaration->ParseEvents(generator, declaration->GetCategory());
+    ParseProperties(category, declaration, declaration->GetCategory());
+    declaration->ParseEvents(category, declaration->GetCategory());
 
     return declaration;
 }
 
-void NodeCreator::ProcessGeneratorInheritance(pugi::xml_node& elem_obj)
+void NodeCreator::ProcessGeneratorInheritance(const node_tables::Generator& generator)
 {
-    std::string_view class_name = elem_obj.attribute("class").as_view();
-    if (class_name.starts_with("gen_"))
-    {
-        class_name.remove_prefix(sizeof("gen_") - 1);
-    }
-
-    NodeDeclaration* class_info = get_NodeDeclaration(class_name);
+    NodeDeclaration* class_info = get_NodeDeclaration(generator.class_name);
     if (!class_info)
     {
         return;  // Corrupted or unsupported project file
     }
 
-    pugi::xml_node elem_base = elem_obj.child("inherits");
-    while (elem_base)
+    for (const auto& inherit:
+         node_tables::inherits.subspan(generator.first_inherit, generator.inherit_count))
     {
-        const std::string_view base_name = elem_base.attribute("class").as_view();
+        const std::string_view base_name = inherit.class_name;
         if (base_name == "Language Settings")
         {
             // NOLINTBEGIN(bugprone-unchecked-error-return)
@@ -696,116 +617,77 @@ void NodeCreator::ProcessGeneratorInheritance(pugi::xml_node& elem_obj)
             class_info->AddBaseClass(get_NodeDeclaration("kwxLuaJIT Settings"));
             class_info->AddBaseClass(get_NodeDeclaration("kwxTypeScript Settings"));
             // NOLINTEND(bugprone-unchecked-error-return)
-
-            elem_base = elem_base.next_sibling("inherits");
             continue;
         }
 
         NodeDeclaration* base_info = get_NodeDeclaration(base_name);
         if (!base_info)
         {
-            elem_base = elem_base.next_sibling("inherits");
             continue;
         }
 
         std::ignore = class_info->AddBaseClass(base_info);
 
-        pugi::xml_node inheritedProperty = elem_base.child("property");
-        while (inheritedProperty)
+        for (const auto& inherited_prop:
+             node_tables::overrides.subspan(inherit.first_override, inherit.override_count))
         {
             std::map<std::string_view, GenEnum::PropName, std::less<>>::const_iterator const
-                lookup_name = rmap_PropNames.find(inheritedProperty.attribute("name").as_view());
+                lookup_name = rmap_PropNames.find(inherited_prop.name);
             if (lookup_name == rmap_PropNames.end())
             {
                 MSG_ERROR(std::format("Unrecognized inherited property name -- {}",
-                                      inheritedProperty.attribute("name").as_view()));
-                inheritedProperty = inheritedProperty.next_sibling("property");
+                                      inherited_prop.name));
                 continue;
             }
-            class_info->SetOverRideDefValue(lookup_name->second,
-                                            inheritedProperty.text().as_view());
-            inheritedProperty = inheritedProperty.next_sibling("property");
+            class_info->SetOverRideDefValue(lookup_name->second, inherited_prop.value);
         }
 
-        inheritedProperty = elem_base.child("hide");
-        while (inheritedProperty)
+        for (const auto& hidden_name:
+             node_tables::hidden.subspan(inherit.first_hide, inherit.hide_count))
         {
             std::map<std::string_view, GenEnum::PropName, std::less<>>::const_iterator const
-                lookup_name = rmap_PropNames.find(inheritedProperty.attribute("name").as_view());
+                lookup_name = rmap_PropNames.find(hidden_name);
             if (lookup_name == rmap_PropNames.end())
             {
-                MSG_ERROR(std::format("Unrecognized inherited property name -- {}",
-                                      inheritedProperty.attribute("name").as_view()));
-                inheritedProperty = inheritedProperty.next_sibling("hide");
+                MSG_ERROR(
+                    std::format("Unrecognized inherited property name -- {}", hidden_name));
                 continue;
             }
             class_info->HideProperty(lookup_name->second);
-            inheritedProperty = inheritedProperty.next_sibling("hide");
         }
-
-        elem_base = elem_base.next_sibling("inherits");
     }
 }
 
-// The xml_data parameter is the char* pointer to the XML data. It will be empty when
-// processing an interface document.
-void NodeCreator::ParseGeneratorFile(const char* xml_data)
+void NodeCreator::ParseGeneratorFile(const node_tables::File& file)
 {
-    pugi::xml_document xml_doc;
-    pugi::xml_node root;
-    bool const is_interface = (xml_data == nullptr || !*xml_data);
-
-    if (!xml_data || !*xml_data)
-    {
-        root = m_pdoc_interface->child("GeneratorDefinitions");
-    }
-    else
-    {
-        pugi::xml_parse_result const result = xml_doc.load_string(xml_data);
-        if (!result)
-        {
-            FAIL_MSG("XML file is corrupted!");
-            throw std::runtime_error("Internal XML file is corrupted.");
-        }
-        root = xml_doc.child("GeneratorDefinitions");
-    }
-
-    if (!root)
+    const auto file_generators =
+        node_tables::generators.subspan(file.first_generator, file.generator_count);
+    for (const auto& generator: file_generators)
     {
-        FAIL_MSG("GeneratorDefinitions not found in XML file.");
-        throw std::runtime_error("Internal XML file is corrupted.");
+        std::ignore = ParseGenerator(generator, file.is_interface);
     }
 
-    pugi::xml_node generator = root.child("gen");
-    while (generator)
+    // Interfaces don't inherit from anything
+    if (!file.is_interface)
     {
-        std::ignore = ParseGenerator(generator, is_interface);
-        generator = generator.next_sibling("gen");
-    }
-
-    // Interface processing doesn't have xml_data
-    if (xml_data && *xml_data)
-    {
-        pugi::xml_node elem_obj = root.child("gen");
-        while (elem_obj)
+        for (const auto& generator: file_generators)
         {
-            ProcessGeneratorInheritance(elem_obj);
-            elem_obj = elem_obj.next_sibling("gen");
+            ProcessGeneratorInheritance(generator);
         }
     }
 }
 
-void NodeCreator::AddPropertyOptions(pugi::xml_node& elem_prop, PropDeclaration* prop_info)
+void NodeCreator::AddPropertyOptions(const node_tables::Property& table_prop,
+                                     PropDeclaration* prop_info)
 {
     std::vector<PropDeclaration::Options>& opts = prop_info->getOptions();
-    pugi::xml_node elem_opt = elem_prop.child("option");
-    while (elem_opt)
+    opts.reserve(table_prop.option_count);
+    for (const auto& option:
+         node_tables::options.subspan(table_prop.first_option, table_prop.option_count))
     {
         PropDeclaration::Options& opt = opts.emplace_back();
-        opt.name = elem_opt.attribute("name").as_view();
-        opt.help = elem_opt.attribute("help").as_view();
-
-        elem_opt = elem_opt.next_sibling("option");
+        opt.name = option.name;
+        opt.help = option.help;
     }
 }
 
@@ -862,65 +744,42 @@ void NodeCreator::AddVarNameRelatedProperties(NodeDeclaration* node_declaration,
         "self. prefix.\nIn wxPerl, item will have a $self-> prefix.";
 }
 
-/* static */ void NodeCreator::ParseSingleProperty(pugi::xml_node& elem_prop,
+/* static */ void NodeCreator::ParseSingleProperty(const node_tables::Property& table_prop,
                                                    NodeDeclaration* node_declaration,
                                                    NodeCategory& category)
 {
-    wxue::string name = elem_prop.attribute("name").as_str();
-    if (name.starts_with("prop_"))
-    {
-        name.erase(0, sizeof("prop_") - 1);
-    }
+    std::string_view name = table_prop.name;
 
     std::map<std::string_view, GenEnum::PropName, std::less<>>::const_iterator const lookup_name =
         rmap_PropNames.find(name);
     if (lookup_name == rmap_PropNames.end())
     {
-        MSG_ERROR(std::format("Unrecognized property name -- {}", name.c_str()));
+        MSG_ERROR(std::format("Unrecognized property name -- {}", name));
         return;
     }
     GenEnum::PropName const prop_name = lookup_name->second;
 
     category.addProperty(prop_name);
 
-    std::string_view const description = elem_prop.attribute("help").as_view();
-
-    std::string_view prop_type = elem_prop.attribute("type").as_view();
-    if (prop_type.starts_with("type_"))
-    {
-        prop_type.remove_prefix(sizeof("type_") - 1);
-    }
-
     GenEnum::PropType property_type { type_unknown };
 
-    if (auto result = umap_PropTypes.find(prop_type); result != umap_PropTypes.end())
+    if (auto result = umap_PropTypes.find(table_prop.type); result != umap_PropTypes.end())
     {
         property_type = result->second;
     }
 
     if (property_type == type_unknown)
     {
-        MSG_ERROR(std::format("Unrecognized property type -- {}", prop_type));
+        MSG_ERROR(std::format("Unrecognized property type -- {}", table_prop.type));
         return;
     }
 
-    wxString def_value;
-    if (auto lastChild = elem_prop.last_child(); lastChild && !lastChild.text().empty())
-    {
-        def_value = lastChild.text().get();
-        if (def_value.find('\n') != wxString::npos)
-        {
-            def_value.Trim(false);
-            def_value.Trim();
-        }
-    }
-
     auto* prop_info = new PropDeclaration(prop_name, property_type,
-                                          PropDeclaration::DefaultValue(def_value.ToStdString()),
-                                          PropDeclaration::HelpText(description));
-    node_declaration->GetPropInfoMap()[name] = prop_info;
+                                          PropDeclaration::DefaultValue(table_prop.def_value),
+                                          PropDeclaration::HelpText(table_prop.help));
+    node_declaration->GetPropInfoMap()[std::string(name)] = prop_info;
 
-    if (elem_prop.attribute("hide").as_bool())
+    if (table_prop.hide)
     {
         node_declaration->HideProperty(prop_name);
     }
@@ -928,78 +787,60 @@ void NodeCreator::AddVarNameRelatedProperties(NodeDeclaration* node_declaration,
     if (property_type == type_bitlist || property_type == type_option ||
         property_type == type_editoption)
     {
-        AddPropertyOptions(elem_prop, prop_info);
+        AddPropertyOptions(table_prop, prop_info);
     }
 
     // Any time there is a var_name property, it needs to be followed by a var_comment and
     // class_access property. Rather than add this to all the XML generator specifications, we
     // simply insert it here if it doesn't exist.
-    if (wxue::is_sameas(name, map_PropNames.at(prop_var_name)) &&
-        !node_declaration->is_Gen(gen_data_string) && !node_declaration->is_Gen(gen_data_xml))
+    if (prop_name == prop_var_name && !node_declaration->is_Gen(gen_data_string) &&
+        !node_declaration->is_Gen(gen_data_xml))
     {
         AddVarNameRelatedProperties(node_declaration, category);
     }
 }
 
-void NodeCreator::ParseProperties(pugi::xml_node& elem_obj, NodeDeclaration* node_declaration,
-                                  NodeCategory& category)
+void NodeCreator::ParseProperties(const node_tables::Category& table_category,
+                                  NodeDeclaration* node_declaration, NodeCategory& category)
 {
-    pugi::xml_node elem_category = elem_obj.child("category");
-    while (elem_category)
+    for (const auto& child: node_tables::categories.subspan(table_category.first_category,
+                                                            table_category.category_count))
     {
-        std::string_view const name = elem_category.attribute("name").as_view();
-        NodeCategory& new_cat = category.addCategory(name);
+        NodeCategory& new_cat = category.addCategory(child.name);
 
-        if (auto base_name = elem_category.attribute("base_name").value(); !base_name.empty())
-        {
-            if (auto node = m_interfaces.find(base_name); node != m_interfaces.end())
-            {
-                ParseProperties(node->second, node_declaration, new_cat);
-            }
-        }
-        else
-        {
-            ParseProperties(elem_category, node_declaration, new_cat);
-        }
-
-        elem_category = elem_category.next_sibling("category");
+        // A category with a base_name gets its properties from that interface
+        ParseProperties(child.base_category != node_tables::no_index ?
+                            node_tables::categories[child.base_category] :
+                            child,
+                        node_declaration, new_cat);
     }
 
-    pugi::xml_node elem_prop = elem_obj.child("property");
-    while (elem_prop)
+    for (const auto& table_prop: node_tables::properties.subspan(table_category.first_property,
+                                                                 table_category.property_count))
     {
-        ParseSingleProperty(elem_prop, node_declaration, category);
-        elem_prop = elem_prop.next_sibling("property");
+        ParseSingleProperty(table_prop, node_declaration, category);
     }
 }
 
-void NodeDeclaration::ParseEvents(pugi::xml_node& elem_obj, NodeCategory& category)
+void NodeDeclaration::ParseEvents(const node_tables::Category& table_category,
+                                  NodeCategory& category)
 {
-    pugi::xml_node elem_category = elem_obj.child("category");
-    while (elem_category)
+    for (const auto& child: node_tables::categories.subspan(table_category.first_category,
+                                                            table_category.category_count))
     {
         // Only create the category if there is at least one event.
-        if (elem_category.child("event"))
+        if (child.event_count)
         {
-            std::string_view const name = elem_category.attribute("name").as_view();
-            NodeCategory& new_cat = category.addCategory(name);
-
-            ParseEvents(elem_category, new_cat);
+            NodeCategory& new_cat = category.addCategory(child.name);
+            ParseEvents(child, new_cat);
         }
-        elem_category = elem_category.next_sibling("category");
     }
 
-    pugi::xml_node nodeEvent = elem_obj.child("event");
-    while (nodeEvent)
+    for (const auto& event:
+         node_tables::events.subspan(table_category.first_event, table_category.event_count))
     {
-        wxue::string const evt_name = nodeEvent.attribute("name").as_str();
-        category.addEvent(evt_name);
-
-        std::string_view const evt_class = nodeEvent.attribute("class").as_view("wxEvent");
-        std::string_view const description = nodeEvent.attribute("help").as_view();
-
-        m_events[evt_name] = new NodeEventInfo(evt_name, evt_class, description);
-
-        nodeEvent = nodeEvent.next_sibling("event");
+        category.addEvent(std::string(event.name));
+        m_events[std::string(event.name)] =
+            new NodeEventInfo(event.name, event.event_class, event.help);
     }
 }
@@ -9,6 +9,8 @@
 #include <array>
 #include <charconv>
 #include <cstdlib>
+#include <format>
+#include <unordered_map>
 
 #include <wx/animate.h>                // wxAnimation and wxAnimationCtrl
 #include <wx/propgrid/propgriddefs.h>  // wxPropertyGrid miscellaneous definitions
@@ -21,16 +23,173 @@
 #include "node.h"                               // Node -- Node class
 #include "node_creator.h"                       // NodeCreator class
 #include "project_handler.h"                    // ProjectHandler singleton class
+#include "unique_names.h"                       // NameIndex -- Index of the variable names in use
 #include "utils.h"                              // Utility functions that work with properties
 #include "wxue_namespace/wxue_string_vector.h"  // wxue::StringVector
 #include "wxue_namespace/wxue_view_vector.h"    // wxue::ViewVector
 
 using namespace GenEnum;
 
+namespace
+{
+    // The key views the string the value points to, so it stays valid for the life of the pool
+    std::unordered_map<std::string_view, std::unique_ptr<wxue::string>> s_value_pool;
+}  // namespace
+
+auto PropValuePool::Add(std::string_view value) -> const wxue::string*
+{
+    if (value.empty())
+    {
+        return &wxue::wxue_empty_string;
+    }
+    if (auto result = s_value_pool.find(value); result != s_value_pool.end())
+    {
+        return result->second.get();
+    }
+    auto pooled = std::make_unique<wxue::string>(value);
+    const auto* ptr = pooled.get();
+    s_value_pool.emplace(*ptr, std::move(pooled));
+    return ptr;
+}
+
+void PropValuePool::AddCommonValues()
+{
+    for (const auto& iter: g_friend_constant)
+    {
+        Add(iter.second);
+    }
+
+    constexpr auto common_values = std::to_array<std::string_view>({
+        "0", "1", "2", "3", "4", "5", "10", "-1", "-1,-1", "0,0", "true", "false", "wxID_ANY",
+        "wxID_OK", "wxID_CANCEL", "wxEXPAND", "wxALL", "wxLEFT", "wxRIGHT", "wxTOP", "wxBOTTOM",
+        "wxEXPAND|wxALL", "wxALIGN_CENTER", "wxALIGN_CENTER_VERTICAL", "wxVERTICAL",
+        "wxHORIZONTAL",
+    });
+    for (auto value: common_values)
+    {
+        Add(value);
+    }
+}
+
+auto PropValuePool::Find(std::string_view value) -> const wxue::string*
+{
+    if (value.empty())
+    {
+        return &wxue::wxue_empty_string;
+    }
+    if (auto result = s_value_pool.find(value); result != s_value_pool.end())
+    {
+        return result->second.get();
+    }
+    return nullptr;
+}
+
+auto PropValuePool::GetStats() -> std::pair<size_t, size_t>
+{
+    size_t bytes = 0;
+    for (const auto& iter: s_value_pool)
+    {
+        bytes += iter.first.size() + 1;
+    }
+    return { s_value_pool.size(), bytes };
+}
+
 NodeProperty::NodeProperty(PropDeclaration* declaration, Node* node) :
     m_declaration(declaration),
-    m_node(node)
+    m_node(node),
+    m_value(&wxue::wxue_empty_string)
+{
+}
+
+NodeProperty::NodeProperty(const NodeProperty& other) :
+    m_declaration(other.m_declaration),
+    m_node(other.m_node),
+    m_value(&wxue::wxue_empty_string)
+{
+    CopyValue(other);
+}
+
+NodeProperty& NodeProperty::operator=(const NodeProperty& other)
+{
+    if (this != &other)
+    {
+        m_declaration = other.m_declaration;
+        m_node = other.m_node;
+        CopyValue(other);
+    }
+    return *this;
+}
+
+auto NodeProperty::CopyValue(const NodeProperty& source) -> void
+{
+    if (&source == this)
+    {
+        return;
+    }
+    if (source.m_owned)
+    {
+        AssignValue(*source.m_owned);
+    }
+    else
+    {
+        m_value = source.m_value;
+        m_owned.reset();
+        if (NameIndex::is_IndexedProp(get_name()))
+        {
+            NameIndex::Invalidate();
+        }
+    }
+}
+
+auto NodeProperty::AssignValue(std::string_view value) -> void
+{
+    if (NameIndex::is_IndexedProp(get_name()))
+    {
+        NameIndex::Invalidate();
+    }
+
+    // value may point into m_owned, so it can't be released until a pooled copy has been found
+    const wxue::string* pooled = m_declaration->getPooledDefault();
+    if (!pooled || pooled->ToStdView() != value)
+    {
+        pooled = PropValuePool::Find(value);
+    }
+    if (pooled)
+    {
+        m_value = pooled;
+        m_owned.reset();
+        return;
+    }
+
+    if (m_owned)
+    {
+        if (value.data() != m_owned->data() || value.size() != m_owned->size())
+        {
+            // std::string::assign() handles value being a substring of itself
+            m_owned->assign(value);
+        }
+    }
+    else
+    {
+        m_owned = std::make_unique<wxue::string>(value);
+    }
+    m_value = m_owned.get();
+}
+
+auto NodeProperty::MakeValueUnique() -> wxue::string&
 {
+    // The caller may change the value
+    if (NameIndex::is_IndexedProp(get_name()))
+    {
+        NameIndex::Invalidate();
+    }
+
+    if (!m_owned)
+    {
+        m_owned = std::make_unique<wxue::string>(*m_value);
+        m_value = m_owned.get();
+    }
+    return *m_owned;
 }
 
 // The advantage of placing the one-line calls to PropDeclaration (m_declaration) here is that it
@@ -39,7 +198,11 @@ NodeProperty::NodeProperty(PropDeclaration* declaration, Node* node) :
 
 bool NodeProperty::isDefaultValue() const
 {
-    return m_value.is_sameas(m_declaration->getDefaultValue());
+    if (m_value == m_declaration->getPooledDefault())
+    {
+        return true;
+    }
+    return m_value->is_sameas(m_declaration->getDefaultValue());
 }
 
 int NodeProperty::as_int() const
@@ -49,12 +212,12 @@ int NodeProperty::as_int() const
         case type_editoption:
         case type_option:
         case type_id:
-            return NodeCreation.get_ConstantAsInt(m_value, 0);
+            return NodeCreation.get_ConstantAsInt(*m_value, 0);
 
         case type_bitlist:
             {
                 int result = 0;
-                const wxue::StringVector mstr(m_value, '|', wxue::TRIM::both);
+                const wxue::StringVector mstr(*m_value, '|', wxue::TRIM::both);
                 for (const auto& iter: mstr)
                 {
                     result |= NodeCreation.get_ConstantAsInt(iter);
@@ -63,13 +226,13 @@ int NodeProperty::as_int() const
             }
 
         default:
-            return m_value.atoi();  // this will return 0 if the m_value is an empty string
+            return m_value->atoi();  // this will return 0 if the m_value is an empty string
     }
 }
 
 int NodeProperty::as_id() const
 {
-    return NodeCreation.get_ConstantAsInt(m_value, wxID_ANY);
+    return NodeCreation.get_ConstantAsInt(*m_value, wxID_ANY);
 }
 
 // Static class function
@@ -93,7 +256,7 @@ wxue::string NodeProperty::get_PropId(const wxue::string& complete_id)
 
 wxue::string NodeProperty::get_PropId() const
 {
-    return get_PropId(m_value);
+    return get_PropId(*m_value);
 }
 
 int NodeProperty::as_mockup(std::string_view prefix) const
@@ -103,20 +266,20 @@ int NodeProperty::as_mockup(std::string_view prefix) const
         case type_editoption:
         case type_option:
         case type_id:
-            if (m_value.starts_with("wx"))
+            if (m_value->starts_with("wx"))
             {
-                return NodeCreation.get_ConstantAsInt(m_value, 0);
+                return NodeCreation.get_ConstantAsInt(*m_value, 0);
             }
             if (!prefix.empty())
             {
                 wxue::string name;
-                name << prefix << m_value;
+                name << prefix << *m_value;
                 if (auto result = g_friend_constant.find(name); result != g_friend_constant.end())
                 {
                     return NodeCreation.get_ConstantAsInt(result->second, 0);
                 }
             }
-            if (auto result = g_friend_constant.find(m_value); result != g_friend_constant.end())
+            if (auto result = g_friend_constant.find(*m_value); result != g_friend_constant.end())
             {
                 return NodeCreation.get_ConstantAsInt(result->second, 0);
             }
@@ -124,7 +287,7 @@ int NodeProperty::as_mockup(std::string_view prefix) const
 
         case type_bitlist:
             {
-                wxue::StringVector mstr(m_value, '|', wxue::TRIM::both);
+                wxue::StringVector mstr(*m_value, '|', wxue::TRIM::both);
                 int value = 0;
                 for (auto& iter: mstr)
                 {
@@ -149,62 +312,62 @@ int NodeProperty::as_mockup(std::string_view prefix) const
             }
 
         default:
-            return m_value.atoi();  // this will return 0 if the m_value is an empty string
+            return m_value->atoi();  // this will return 0 if the m_value is an empty string
     }
 }
 
 const wxue::string& NodeProperty::as_constant(std::string_view prefix)
 {
+    // Every g_friend_constant value is in PropValuePool, so the option types can return the
+    // pooled string instead of making a copy.
+    auto pooled_constant = [](std::string_view name) -> const wxue::string&
+    {
+        if (auto result = g_friend_constant.find(name); result != g_friend_constant.end())
+        {
+            if (const auto* pooled = PropValuePool::Find(result->second); pooled)
+            {
+                return *pooled;
+            }
+            FAIL_MSG(std::format("{} is missing from PropValuePool", result->second));
+        }
+        return wxue::wxue_empty_string;
+    };
+
     switch (type())
     {
         case type_editoption:
         case type_option:
         case type_id:
-            if (m_value.starts_with("wx"))
+            if (m_value->starts_with("wx"))
             {
-                return m_value;
+                return *m_value;
             }
             if (!prefix.empty())
             {
-                m_constant.clear();
-                m_constant << prefix << m_value;
-                if (auto result = g_friend_constant.find(m_constant);
-                    result != g_friend_constant.end())
-                {
-                    m_constant = result->second;
-                }
-                else
-                {
-                    m_constant.clear();
-                }
-            }
-            else
-            {
-                if (auto result = g_friend_constant.find(m_value);
-                    result != g_friend_constant.end())
-                {
-                    m_constant = result->second;
-                }
-                else
-                {
-                    m_constant.clear();
-                }
+                wxue::string name;
+                name << prefix << *m_value;
+                return pooled_constant(name);
             }
-            return m_constant;
+            return pooled_constant(*m_value);
 
         case type_bitlist:
             {
-                wxue::StringVector mstr(m_value, '|', wxue::TRIM::both);
-                m_constant.clear();
+                if (!m_constant)
+                {
+                    m_constant = std::make_unique<wxue::string>();
+                }
+                auto& constant = *m_constant;
+                wxue::StringVector mstr(*m_value, '|', wxue::TRIM::both);
+                constant.clear();
                 for (auto& iter: mstr)
                 {
                     if (iter.starts_with("wx"))
                     {
-                        if (!m_constant.empty())
+                        if (!constant.empty())
                         {
-                            m_constant << '|';
+                            constant << '|';
                         }
-                        m_constant << iter;
+                        constant << iter;
                     }
                     else
                     {
@@ -215,28 +378,28 @@ const wxue::string& NodeProperty::as_constant(std::string_view prefix)
                         if (auto result = g_friend_constant.find(iter);
                             result != g_friend_constant.end())
                         {
-                            if (!m_constant.empty())
+                            if (!constant.empty())
                             {
-                                m_constant << " | ";
+                                constant << " | ";
                             }
-                            m_constant << result->second;
+                            constant << result->second;
                         }
                     }
                 }
-                return m_constant;
+                return constant;
             }
 
         default:
-            return m_value;  // this will return 0 if the m_value is an empty string
+            return *m_value;  // this will return 0 if the m_value is an empty string
     }
 }
 
 wxPoint NodeProperty::as_point() const
 {
     wxPoint result { -1, -1 };
-    if (!m_value.empty())
+    if (!m_value->empty())
     {
-        wxue::ViewVector tokens(m_value, ',');
+        wxue::ViewVector tokens(*m_value, ',');
         if (!tokens.empty())
         {
             if (!tokens[0].empty())
@@ -256,9 +419,9 @@ wxPoint NodeProperty::as_point() const
 wxSize NodeProperty::as_size() const
 {
     wxSize result { -1, -1 };
-    if (!m_value.empty())
+    if (!m_value->empty())
     {
-        wxue::ViewVector tokens(m_value, ',');
+        wxue::ViewVector tokens(*m_value, ',');
         if (!tokens.empty())
         {
             if (!tokens[0].empty())
@@ -282,29 +445,29 @@ extern const std::map<std::string, std::string, std::less<>> kw_css_colors;
 // imported projects such as wxFormBuilder.
 wxColour NodeProperty::as_color() const
 {
-    if (m_value.empty())
+    if (m_value->empty())
     {
         return wxNullColour;
     }
     // check for system colour
-    if (m_value.starts_with("wx"))
+    if (m_value->starts_with("wx"))
     {
-        return wxSystemSettings::GetColour(ConvertToSystemColour(m_value));
+        return wxSystemSettings::GetColour(ConvertToSystemColour(*m_value));
     }
-    if (m_value.starts_with('#') || m_value.starts_with("RGB") || m_value.starts_with("rgb"))
+    if (m_value->starts_with('#') || m_value->starts_with("RGB") || m_value->starts_with("rgb"))
     {
-        return wxColour(m_value);
+        return wxColour(*m_value);
     }
-    if (wxue::is_alpha(m_value[0]))
+    if (wxue::is_alpha((*m_value)[0]))
     {
-        if (auto result = kw_css_colors.find(m_value); result != kw_css_colors.end())
+        if (auto result = kw_css_colors.find(*m_value); result != kw_css_colors.end())
         {
             return wxColour(result->second);
         }
-        MSG_ERROR(wxue::string("Unknown CSS color: ") << m_value);
+        MSG_ERROR(wxue::string("Unknown CSS color: ") << *m_value);
         return wxNullColour;
     }
-    const wxue::ViewVector mstr(m_value, ',');
+    const wxue::ViewVector mstr(*m_value, ',');
     unsigned long rgb_value = 0;
     size_t shift_value = 0;
     for (const auto& color: mstr)
@@ -327,21 +490,21 @@ wxColour NodeProperty::as_color() const
 
 wxFont NodeProperty::as_font() const
 {
-    return FontProperty(m_value.subview()).GetFont();
+    return FontProperty(m_value->subview()).GetFont();
 }
 
 FontProperty NodeProperty::as_font_prop() const
 {
-    FontProperty font_prop(m_value.subview());
+    FontProperty font_prop(m_value->subview());
     return font_prop;
 }
 
 wxBitmap NodeProperty::as_bitmap() const
 {
-    wxBitmap image = ProjectImages.GetImage(m_value);
+    wxBitmap image = ProjectImages.GetImage(*m_value);
     if (!image.IsOk())
     {
-        image = ProjectImages.GetImage(m_value);
+        image = ProjectImages.GetImage(*m_value);
         if (!image.IsOk())
         {
             return wxNullBitmap;
@@ -353,7 +516,7 @@ wxBitmap NodeProperty::as_bitmap() const
 
 wxBitmapBundle NodeProperty::as_bitmap_bundle() const
 {
-    const wxBitmapBundle bundle = ProjectImages.GetBitmapBundle(m_value);
+    const wxBitmapBundle bundle = ProjectImages.GetBitmapBundle(*m_value);
     if (!bundle.IsOk())
     {
         return wxNullBitmap;
@@ -363,14 +526,14 @@ wxBitmapBundle NodeProperty::as_bitmap_bundle() const
 
 void NodeProperty::as_animation(wxAnimation* p_animation) const
 {
-    ProjectImages.GetPropertyAnimation(m_value, p_animation);
+    ProjectImages.GetPropertyAnimation(*m_value, p_animation);
 }
 
 wxue::string NodeProperty::as_escape_text() const
 {
     wxue::string result;
 
-    for (auto character: m_value)
+    for (auto character: *m_value)
     {
         switch (character)
         {
@@ -402,12 +565,12 @@ wxue::string NodeProperty::as_escape_text() const
 std::vector<wxue::string> NodeProperty::as_vector() const
 {
     std::vector<wxue::string> array;
-    if (m_value.empty())
+    if (m_value->empty())
     {
         return array;
     }
     wxue::string parse;
-    std::string_view value = m_value;
+    std::string_view value = *m_value;
     size_t pos = parse.ExtractSubString(value);
     array.emplace_back(parse);
 
@@ -427,15 +590,15 @@ std::vector<wxue::string> NodeProperty::as_ArrayString(char separator) const
     {
         wxue::StringVector result;
 
-        if (!m_value.empty())
+        if (!m_value->empty())
         {
             if (type() == type_stringlist_semi)
             {
-                result.SetString(std::string_view(m_value), ";", wxue::TRIM::both);
+                result.SetString(std::string_view(*m_value), ";", wxue::TRIM::both);
             }
-            else if (type() == type_stringlist_escapes || m_value[0] == '"')
+            else if (type() == type_stringlist_escapes || (*m_value)[0] == '"')
             {
-                wxue::string_view view = m_value.view_substr(0, '"', '"');
+                wxue::string_view view = m_value->view_substr(0, '"', '"');
                 while (!view.empty())
                 {
                     result.emplace_back(view);
@@ -448,7 +611,7 @@ std::vector<wxue::string> NodeProperty::as_ArrayString(char separator) const
         return result;
     }
 
-    wxue::StringVector result(std::string_view(m_value), separator, wxue::TRIM::both);
+    wxue::StringVector result(std::string_view(*m_value), separator, wxue::TRIM::both);
     return result;
 }
 
@@ -456,12 +619,12 @@ wxArrayString NodeProperty::as_wxArrayString() const
 {
     wxArrayString result;
 
-    if (!m_value.empty())
+    if (!m_value->empty())
     {
-        if (m_value[0] == '"' &&
+        if ((*m_value)[0] == '"' &&
             !(type() == type_stringlist_semi && Project.get_OriginalProjectVersion() >= 18))
         {
-            wxue::string_view view = m_value.view_substr(0, '"', '"');
+            wxue::string_view view = m_value->view_substr(0, '"', '"');
             while (!view.empty())
             {
                 result.Add(view.wx());
@@ -472,7 +635,7 @@ wxArrayString NodeProperty::as_wxArrayString() const
         else
         {
             wxue::ViewVector array;
-            array.SetString(std::string_view(m_value), ";", wxue::TRIM::both);
+            array.SetString(std::string_view(*m_value), ";", wxue::TRIM::both);
             for (const auto& str: array)
             {
                 result.Add(str.wx());
@@ -485,7 +648,7 @@ wxArrayString NodeProperty::as_wxArrayString() const
 
 double NodeProperty::as_float() const
 {
-    return std::atof(m_value.c_str());
+    return std::atof(m_value->c_str());
 }
 
 void NodeProperty::set_value(double value)
@@ -494,36 +657,38 @@ void NodeProperty::set_value(double value)
     if (auto [ptr, ec] = std::to_chars(str.data(), str.data() + str.size(), value);
         ec == std::errc())
     {
-        m_value.assign(str.data(), ptr);
+        AssignValue(std::string_view(str.data(), ptr));
     }
     else
     {
-        m_value.clear();
+        AssignValue({});
     }
 }
 
 void NodeProperty::set_value(const wxColour& colour)
 {
-    m_value.clear();
-    m_value << colour.Red() << ',' << colour.Green() << ',' << colour.Blue();
+    wxue::string value;
+    value << colour.Red() << ',' << colour.Green() << ',' << colour.Blue();
+    AssignValue(value);
 }
 
 void NodeProperty::set_value(const wxPoint& point)
 {
-    m_value.clear();
-    m_value << point.x << ',' << point.y;
+    wxue::string value;
+    value << point.x << ',' << point.y;
+    AssignValue(value);
 }
 
 void NodeProperty::set_value(const wxSize& size)
 {
-    m_value.clear();
-    m_value << size.x << ',' << size.y;
+    wxue::string value;
+    value << size.x << ',' << size.y;
+    AssignValue(value);
 }
 
 void NodeProperty::set_value(const wxString& str)
 {
-    m_value.clear();
-    m_value << str.utf8_string();
+    AssignValue(str.utf8_string());
 }
 
 // All but one of the std::vector properties contain text which could have commas in it, so we need
@@ -616,7 +781,7 @@ std::vector<NODEPROP_STATUSBAR_FIELD> NodeProperty::as_statusbar_fields() const
         return result;
     }
 
-    const wxue::StringVector fields(m_value, ';');
+    const wxue::StringVector fields(*m_value, ';');
     for (auto& field: fields)
     {
         wxue::StringVector parts(field, '|');
@@ -645,7 +810,7 @@ std::vector<NODEPROP_CHECKLIST_ITEM> NodeProperty::as_checklist_items() const
 {
     std::vector<NODEPROP_CHECKLIST_ITEM> result;
 
-    if (!m_value.empty() && m_value[0] == '"' && wxGetApp().get_ProjectVersion() <= minRequiredVer)
+    if (!m_value->empty() && (*m_value)[0] == '"' && wxGetApp().get_ProjectVersion() <= minRequiredVer)
     {
         const std::vector<wxue::string> array = as_ArrayString();
         for (const auto& iter: array)
@@ -657,7 +822,7 @@ std::vector<NODEPROP_CHECKLIST_ITEM> NodeProperty::as_checklist_items() const
         return result;
     }
 
-    const wxue::StringVector fields(m_value, ';');
+    const wxue::StringVector fields(*m_value, ';');
     for (auto& field: fields)
     {
         NODEPROP_CHECKLIST_ITEM item;
@@ -680,7 +845,7 @@ std::vector<NODEPROP_BMP_COMBO_ITEM> NodeProperty::as_bmp_combo_items() const
 {
     std::vector<NODEPROP_BMP_COMBO_ITEM> result;
 
-    const wxue::StringVector fields(m_value, ';');
+    const wxue::StringVector fields(*m_value, ';');
     for (auto& field: fields)
     {
         NODEPROP_BMP_COMBO_ITEM item;
@@ -703,7 +868,7 @@ std::vector<NODEPROP_RADIOBOX_ITEM> NodeProperty::as_radiobox_items() const
 {
     std::vector<NODEPROP_RADIOBOX_ITEM> result;
 
-    const wxue::StringVector fields(m_value, ';');
+    const wxue::StringVector fields(*m_value, ';');
     for (auto& field: fields)
     {
         wxue::StringVector parts(field, '|');
@@ -736,7 +901,7 @@ std::vector<NODEPROP_RADIOBOX_ITEM> NodeProperty::as_radiobox_items() const
 
 bool NodeProperty::HasValue() const
 {
-    if (m_value.empty())
+    if (m_value->empty())
     {
         return false;
     }
@@ -750,18 +915,18 @@ bool NodeProperty::HasValue() const
             return (as_point() != wxDefaultPosition);
 
         case type_animation:
-            if (auto semicolonIndex = m_value.find_first_of(";"); wxue::is_found(semicolonIndex))
+            if (auto semicolonIndex = m_value->find_first_of(";"); wxue::is_found(semicolonIndex))
             {
                 return (semicolonIndex != 0);
             }
-            return !m_value.empty();
+            return !m_value->empty();
 
         case type_image:
-            if (auto semicolonIndex = m_value.find_first_of(";"); wxue::is_found(semicolonIndex))
+            if (auto semicolonIndex = m_value->find_first_of(";"); wxue::is_found(semicolonIndex))
             {
-                return (semicolonIndex != 0 && semicolonIndex + 2 < m_value.size());
+                return (semicolonIndex != 0 && semicolonIndex + 2 < m_value->size());
             }
-            return !m_value.empty();
+            return !m_value->empty();
 
         case type_bitlist:
             if (isProp(prop_window_style))
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "font_prop.h"  // FontProperty class
 #include "prop_decl.h"  // PropDeclaration -- PropChildDeclaration and PropDeclaration classes
 #include "wxue_namespace/wxue_string.h"         // wxue::string
@@ -15,6 +17,30 @@
 class wxAnimation;
 class Node;
 
+// Strings shared by every NodeProperty with the same value: every declaration's default value,
+// option names, the wxWidgets constants they map to, and a handful of other common values. Most
+// properties never change from their default, so most NodeProperty values point into this pool
+// instead of owning a copy.
+//
+// The pool is filled in by NodeCreator::Initialize() and never changes after that, which means
+// it can be read from any thread without locking.
+namespace PropValuePool
+{
+    // Returns the pooled copy of value (adding it if needed). Only call this during
+    // NodeCreator::Initialize().
+    auto Add(std::string_view value) -> const wxue::string*;
+
+    // Adds the wxWidgets constants that option names map to (see as_constant()) along with
+    // values that are commonly set in projects even though they aren't defaults.
+    void AddCommonValues();
+
+    // Returns nullptr if value isn't in the pool
+    [[nodiscard]] auto Find(std::string_view value) -> const wxue::string*;
+
+    // Number of strings in the pool, and the number of bytes they use
+    [[nodiscard]] auto GetStats() -> std::pair<size_t, size_t>;
+}  // namespace PropValuePool
+
 struct NODEPROP_STATUSBAR_FIELD
 {
     wxue::string style;
@@ -48,16 +74,26 @@ class NodeProperty
 public:
     NodeProperty(PropDeclaration* declaration, Node* node);
 
-    auto set_value(int integer) -> void { m_value = wxue::itoa(integer); };
+    NodeProperty(const NodeProperty& other);
+    NodeProperty& operator=(const NodeProperty& other);
+    NodeProperty(NodeProperty&&) noexcept = default;
+    NodeProperty& operator=(NodeProperty&&) noexcept = default;
+    ~NodeProperty() = default;
+
+    auto set_value(int integer) -> void { AssignValue(wxue::itoa(integer)); };
     auto set_value(double val) -> void;
     auto set_value(const wxColour& colour) -> void;
     auto set_value(const wxString& str) -> void;
     auto set_value(const wxPoint& point) -> void;
     auto set_value(const wxSize& size) -> void;
-    auto set_value(const char* val) -> void { m_value.assign(val); }
-    auto set_value(std::string_view val) -> void { m_value.assign(val); }
-    auto set_value(const wxue::string& val) -> void { m_value.assign(val); }
-    auto set_value(const std::string& val) -> void { m_value.assign(val); }
+    auto set_value(const char* val) -> void { AssignValue(val); }
+    auto set_value(std::string_view val) -> void { AssignValue(val); }
+    auto set_value(const wxue::string& val) -> void { AssignValue(val); }
+    auto set_value(const std::string& val) -> void { AssignValue(val); }
+
+    // Copies the value of another property. If that value is pooled, only the pointer to it is
+    // copied.
+    auto CopyValue(const NodeProperty& source) -> void;
 
     auto convert_statusbar_fields(std::vector<NODEPROP_STATUSBAR_FIELD>& fields) const
         -> wxue::string;
@@ -69,19 +105,19 @@ public:
 
     auto set_value(std::vector<NODEPROP_STATUSBAR_FIELD>& fields) -> void
     {
-        m_value = convert_statusbar_fields(fields);
+        AssignValue(convert_statusbar_fields(fields));
     }
     auto set_value(std::vector<NODEPROP_CHECKLIST_ITEM>& items) -> void
     {
-        m_value = convert_checklist_items(items);
+        AssignValue(convert_checklist_items(items));
     }
     auto set_value(std::vector<NODEPROP_RADIOBOX_ITEM>& items) -> void
     {
-        m_value = convert_radiobox_items(items);
+        AssignValue(convert_radiobox_items(items));
     }
     auto set_value(std::vector<NODEPROP_BMP_COMBO_ITEM>& items) -> void
     {
-        m_value = convert_bmp_combo_items(items);
+        AssignValue(convert_bmp_combo_items(items));
     }
 
     // By returnung a vector instead of the string, the way the property string gets formatted is
@@ -96,7 +132,13 @@ public:
     // Returns a non-const reference allowing you to modify the value. Do *NOT* use this for
     // the vector functions, as the formatting of the property string is entirely up to
     // NodeProperty.
-    auto get_value() -> wxue::string& { return m_value; }
+    //
+    // This gives the property its own copy of the value, so only call it on a non-const
+    // NodeProperty if you are going to change the value.
+    auto get_value() -> wxue::string& { return MakeValueUnique(); }
+
+    // Read-only access -- returns the pooled value without copying it.
+    auto get_value() const -> const wxue::string& { return *m_value; }
 
     // Returns string containing the property ID without any assignment if it is a custom id.
     auto get_PropId() const -> wxue::string;
@@ -104,7 +146,7 @@ public:
     // Returns a string containing the ID without any assignment if it is a custom id.
     static auto get_PropId(const wxue::string& complete_id) -> wxue::string;
 
-    const wxue::string& value() const { return m_value; }
+    const wxue::string& value() const { return *m_value; }
 
     [[nodiscard]] auto as_int() const -> int;
     [[nodiscard]] auto as_bool() const -> bool { return (as_int() != 0); };
@@ -116,7 +158,8 @@ public:
     [[nodiscard]] auto as_id() const -> int;
 
     // Use with caution! This allows you to modify the property string directly.
-    auto as_raw_ptr() { return &m_value; }
+    auto as_raw_ptr() { return &MakeValueUnique(); }
+    auto as_raw_ptr() const -> const wxue::string* { return m_value; }
 
     auto as_animation(wxAnimation* p_animation) const -> void;
     [[nodiscard]] auto as_bitmap() const -> wxBitmap;
@@ -134,12 +177,12 @@ public:
     [[nodiscard]] auto as_ArrayString(char separator = 0) const -> std::vector<wxue::string>;
 
     // On Windows this will first convert to UTF-16 unless wxUSE_UNICODE_UTF8 is set.
-    [[nodiscard]] auto as_wxString() const -> wxString { return wxue::string(m_value).wx(); }
+    [[nodiscard]] auto as_wxString() const -> wxString { return wxue::string(*m_value).wx(); }
 
     [[nodiscard]] auto as_bitmap_bundle() const -> wxBitmapBundle;
 
-    [[nodiscard]] auto as_string() const -> const wxue::string& { return m_value; }
-    [[nodiscard]] auto as_view() const -> wxue::string_view { return m_value; }
+    [[nodiscard]] auto as_string() const -> const wxue::string& { return *m_value; }
+    [[nodiscard]] auto as_view() const -> wxue::string_view { return *m_value; }
 
     // Converts friendly name to wxWidgets constant
     auto as_constant(std::string_view prefix) -> const wxue::string&;
@@ -155,7 +198,7 @@ public:
 
     operator bool() const { return (as_int() != 0); }
     operator int() const { return as_int(); }
-    operator const char*() const { return m_value.c_str(); }
+    operator const char*() const { return m_value->c_str(); }
 
     operator wxBitmap() const { return as_bitmap(); }
     operator wxColour() const { return as_color(); }
@@ -201,15 +244,30 @@ public:
 
     auto get_PropDeclaration() -> PropDeclaration* { return m_declaration; }
 
+    // Returns true if the value is shared with other properties rather than owned by this one
+    [[nodiscard]] auto is_ValuePooled() const noexcept -> bool { return !m_owned; }
+
     // Currently only called in debug builds, but available for release builds should we need it
     [[nodiscard]] auto get_PropSize() const -> size_t
     {
-        return sizeof(*this) + (m_value.size() + 1);
+        return sizeof(*this) + (m_owned ? m_owned->size() + 1 : 0) +
+               (m_constant ? m_constant->size() + 1 : 0);
     }
 
 private:
+    // Points to the pooled copy if there is one, otherwise stores the value in m_owned
+    auto AssignValue(std::string_view value) -> void;
+
+    // Moves the value into m_owned (if it isn't already) and returns it
+    auto MakeValueUnique() -> wxue::string&;
+
     PropDeclaration* m_declaration;
     Node* m_node;  // node this property is a child of
-    wxue::string m_value;
-    wxue::string m_constant;  // filled in by as_constant() if m_value is a friendly name
+
+    // Always valid -- points either into PropValuePool or to m_owned
+    const wxue::string* m_value;
+    std::unique_ptr<wxue::string> m_owned;
+
+    // Only allocated if as_constant() has to combine the constants of a bitlist
+    std::unique_ptr<wxue::string> m_constant;
 };
@@ -0,0 +1,3936 @@
+///////////////////////////////////////////////////////////////////////////////
+// <auto-generated>
+// Generated by build_resources --node-tables from the XML files in src/xml/
+// xml-sha256: 9e32394710cebc20e307f27dcf7197a38e00f43150408d43edab814783aa7380
+//
+// DO NOT EDIT THIS FILE! Change the XML files and re-run CMake instead.
+// </auto-generated>
+///////////////////////////////////////////////////////////////////////////////
+
+// clang-format off
+// NOLINTBEGIN
+// cppcheck-suppress-begin *
+
+#include "node_tables.h"
+
+using namespace node_tables;
+
+namespace
+{
+    constexpr File s_files[] = {
+        { "interfaces.xml", true, 0, 51 },
+        { "bars.xml", false, 51, 34 },
+        { "boxes.xml", false, 85, 8 },
+        { "buttons.xml", false, 93, 12 },
+        { "containers.xml", false, 105, 17 },
+        { "data_ctrls.xml", false, 122, 14 },
+        { "forms.xml", false, 136, 15 },
+        { "mdi.xml", false, 151, 11 },
+        { "pickers.xml", false, 162, 6 },
+        { "project.xml", false, 168, 10 },
+        { "sizers.xml", false, 178, 15 },
+        { "text_ctrls.xml", false, 193, 4 },
+        { "widgets.xml", false, 197, 17 },
+    };
+
+    constexpr Generator s_generators[] = {
+        { "Window Events", "interface", "", "", false, 0, 0, 0 },
+        { "wxTreeCtrlBase", "interface", "", "", false, 5, 0, 0 },
+        { "Bitmaps", "interface", "", "", false, 6, 0, 0 },
+        { "Command Bitmaps", "interface", "", "", false, 7, 0, 0 },
+        { "Dialog Window Settings", "interface", "", "", false, 8, 0, 0 },
+        { "Language Settings", "interface", "", "", false, 9, 0, 0 },
+        { "C++ Settings", "interface", "", "", false, 10, 0, 0 },
+        { "C++ Header Settings", "interface", "", "", false, 11, 0, 0 },
+        { "C++ Derived Class Settings", "interface", "", "", false, 12, 0, 0 },
+        { "wxPython Settings", "interface", "", "", false, 13, 0, 0 },
+        { "wxRuby Settings", "interface", "", "", false, 14, 0, 0 },
+        { "kwxFortran Settings", "interface", "", "", false, 15, 0, 0 },
+        { "kwxGO Settings", "interface", "", "", false, 16, 0, 0 },
+        { "kwxJulia Settings", "interface", "", "", false, 17, 0, 0 },
+        { "kwxLuaJIT Settings", "interface", "", "", false, 18, 0, 0 },
+        { "kwxTypeScript Settings", "interface", "", "", false, 19, 0, 0 },
+        { "XRC Settings", "interface", "", "", false, 20, 0, 0 },
+        { "C++", "interface", "", "", false, 21, 0, 0 },
+        { "XRC", "interface", "", "", false, 22, 0, 0 },
+        { "kwxFortran", "interface", "", "", false, 23, 0, 0 },
+        { "kwxGO", "interface", "", "", false, 24, 0, 0 },
+        { "kwxJulia", "interface", "", "", false, 25, 0, 0 },
+        { "kwxLuaJIT", "interface", "", "", false, 26, 0, 0 },
+        { "kwxTypeScript", "interface", "", "", false, 27, 0, 0 },
+        { "wxPython", "interface", "", "", false, 28, 0, 0 },
+        { "wxRuby", "interface", "", "", false, 29, 0, 0 },
+        { "Folder C++ Overrides", "interface", "", "", false, 30, 0, 0 },
+        { "Folder wxPython Overrides", "interface", "", "", false, 31, 0, 0 },
+        { "Folder wxRuby Overrides", "interface", "", "", false, 32, 0, 0 },
+        { "Folder wxFortran Overrides", "interface", "", "", false, 33, 0, 0 },
+        { "Folder wxGO Overrides", "interface", "", "", false, 34, 0, 0 },
+        { "Folder wxJulia Overrides", "interface", "", "", false, 35, 0, 0 },
+        { "Folder wxLuaJIT Overrides", "interface", "", "", false, 36, 0, 0 },
+        { "Folder kwxTypeScript Overrides", "interface", "", "", false, 37, 0, 0 },
+        { "Folder XRC Overrides", "interface", "", "", false, 38, 0, 0 },
+        { "sizer_child", "interface", "", "", false, 39, 0, 0 },
+        { "sizer_dimension", "interface", "", "", false, 40, 0, 0 },
+        { "sizeritem_settings", "interface", "", "", false, 41, 0, 0 },
+        { "flexgridsizerbase", "interface", "flex_grid_sizer", "", false, 42, 0, 0 },
+        { "Text Validator", "interface", "", "", false, 43, 0, 0 },
+        { "Boolean Validator", "interface", "", "", false, 44, 0, 0 },
+        { "CheckBoxState Validator", "interface", "", "", false, 45, 0, 0 },
+        { "Choice Validator", "interface", "", "", false, 46, 0, 0 },
+        { "Colour Validator", "interface", "", "", false, 47, 0, 0 },
+        { "DateTime Validator", "interface", "", "", false, 48, 0, 0 },
+        { "Integer Validator", "interface", "", "", false, 49, 0, 0 },
+        { "List Validator", "interface", "", "", false, 50, 0, 0 },
+        { "String Validator", "interface", "", "", false, 51, 0, 0 },
+        { "wxTopLevelWindow", "interface", "", "", false, 52, 0, 0 },
+        { "wxWindow", "interface", "", "", false, 53, 0, 0 },
+        { "wxMdiWindow", "interface", "", "", false, 54, 0, 0 },
+        { "ToolBar", "toolbar_form", "wxToolBar", "", false, 55, 0, 4 },
+        { "wxToolBar", "toolbar", "wxToolBar", "", false, 56, 4, 3 },
+        { "tool", "tool", "tool", "", false, 57, 7, 0 },
+        { "tool_dropdown", "tool_dropdown", "tool_dropdown", "", false, 58, 7, 0 },
+        { "toolSeparator", "tool_separator", "toolseparator", "", false, 59, 7, 0 },
+        { "toolStretchable", "tool", "toolStretchable", "", false, 60, 7, 0 },
+        { "AuiToolBar", "aui_toolbar_form", "auitoolbar", "", false, 61, 7, 4 },
+        { "wxAuiToolBar", "aui_toolbar", "auitoolbar", "", false, 62, 11, 3 },
+        { "auitool", "aui_tool", "tool", "", false, 63, 14, 0 },
+        { "auitool_label", "aui_tool", "wxStaticText", "", false, 64, 14, 0 },
+        { "auitool_spacer", "aui_tool", "toolspacer", "", false, 65, 14, 0 },
+        { "auitool_stretchable", "aui_tool", "toolStretchable", "", false, 66, 14, 0 },
+        { "wxStatusBar", "statusbar", "statusbar", "", false, 67, 14, 2 },
+        { "wxInfoBar", "widget", "infobar", "", false, 68, 16, 3 },
+        { "MenuBar", "menubar_form", "wxMenuBar", "", false, 69, 19, 4 },
+        { "PopupMenu", "popup_menu", "menu", "", false, 70, 23, 2 },
+        { "wxContextMenuEvent", "ctx_menu", "menu", "", false, 71, 25, 0 },
+        { "wxMenuBar", "menubar", "wxMenuBar", "", false, 72, 25, 2 },
+        { "wxMenu", "menu", "menu", "", false, 73, 27, 0 },
+        { "submenu", "submenu", "submenu", "", false, 74, 27, 0 },
+        { "wxMenuItem", "menuitem", "menuitem", "", false, 75, 27, 0 },
+        { "separator", "menuitem", "separator", "", false, 76, 27, 0 },
+        { "MdiFrameMenuBar", "mdi_menubar", "wxMenuBar", "", false, 77, 27, 2 },
+        { "MdiDocMenuBar", "doc_menubar", "wxMenuBar", "", false, 78, 29, 2 },
+        { "wxRibbonBar", "ribbonbar", "ribbon_bar", "", false, 79, 31, 3 },
+        { "wxRibbonPage", "ribbonpage", "ribbon_page", "", false, 80, 34, 2 },
+        { "wxRibbonPanel", "ribbonpanel", "ribbon_panel", "", false, 81, 36, 2 },
+        { "wxRibbonButtonBar", "ribbonbuttonbar", "ribbon_buttonbar", "", false, 82, 38, 2 },
+        { "ribbonButton", "ribbonbutton", "ribbon_button", "", false, 83, 40, 2 },
+        { "wxRibbonToolBar", "ribbontoolbar", "ribbon_buttonbar", "", false, 84, 42, 2 },
+        { "ribbonTool", "ribbontool", "ribbon_button", "", false, 85, 44, 0 },
+        { "wxRibbonGallery", "ribbongallery", "ribbon_gallery", "", false, 86, 44, 2 },
+        { "ribbonGalleryItem", "ribbongalleryitem", "ribbon_gallery_item", "", false, 87, 46, 2 },
+        { "ribbonSeparator", "ribbontool", "ribbon_separator", "", false, 88, 48, 0 },
+        { "wxComboBox", "widget", "wxComboBox", "", false, 89, 48, 4 },
+        { "wxBitmapComboBox", "widget", "bmp_combo_box", "", false, 90, 52, 4 },
+        { "wxChoice", "widget", "wxChoice", "", false, 91, 56, 4 },
+        { "wxListBox", "widget", "wxListBox", "", false, 92, 60, 4 },
+        { "wxSimpleHtmlListBox", "widget", "wxSimpleHtmlListBox", "", false, 93, 64, 3 },
+        { "wxCheckListBox", "widget", "wxCheckListBox", "", false, 94, 67, 4 },
+        { "wxRadioBox", "widget", "radio_box", "", false, 95, 71, 4 },
+        { "wxStaticBox", "staticbox", "wxStaticBoxSizer", "", false, 96, 75, 2 },
+        { "wxCheckBox", "widget", "wxCheckBox", "", false, 97, 77, 4 },
+        { "Check3State", "widget", "check3state", "", false, 98, 81, 4 },
+        { "wxRadioButton", "widget", "wxRadioButton", "", false, 99, 85, 4 },
+        { "wxButton", "widget", "wxButton", "", false, 100, 89, 5 },
+        { "CloseButton", "widget", "close_btn", "", false, 101, 94, 3 },
+        { "wxCommandLinkButton", "widget", "wxCommandLinkButton", "", false, 102, 97, 4 },
+        { "wxSpinCtrl", "widget", "spin_ctrl", "", false, 103, 101, 4 },
+        { "wxSpinCtrlDouble", "widget", "spin_ctrl_double", "", false, 104, 105, 3 },
+        { "wxSpinButton", "widget", "spinbtn", "", false, 105, 108, 4 },
+        { "wxToggleButton", "widget", "toggle_button", "", false, 106, 112, 5 },
+        { "wxBitmapToggleButton", "widget", "bitmap_toggle_button", "", false, 107, 117, 5 },
+        { "wxContextHelpButton", "widget", "ctx_help_btn", "", false, 108, 122, 2 },
+        { "wxPanel", "panel", "wxPanel", "", false, 109, 124, 3 },
+        { "wxSplitterWindow", "splitter", "wxSplitterWindow", "", false, 110, 127, 3 },
+        { "wxScrolledCanvas", "container", "wxScrolledWindow", "", false, 111, 130, 2 },
+        { "wxScrolledWindow", "container", "wxScrolledWindow", "", false, 112, 132, 2 },
+        { "wxCollapsiblePane", "container", "wxCollapsiblePane", "", false, 113, 134, 3 },
+        { "wxChoicebook", "choicebook", "notebook_choice", "", false, 114, 137, 3 },
+        { "wxListbook", "listbook", "notebook_list", "", false, 115, 140, 3 },
+        { "wxAuiNotebook", "notebook", "notebook_aui", "", false, 116, 143, 3 },
+        { "wxNotebook", "notebook", "notebook", "", false, 117, 146, 3 },
+        { "wxToolbook", "notebook", "wxToolbook", "", false, 118, 149, 3 },
+        { "wxTreebook", "notebook", "wxTreebook", "", false, 119, 152, 3 },
+        { "wxSimplebook", "simplebook", "wxSimplebook", "", false, 120, 155, 3 },
+        { "BookPage", "bookpage", "book_page", "", false, 121, 158, 3 },
+        { "PageCtrl", "page", "pagectrl", "", false, 122, 161, 0 },
+        { "oldbookpage", "oldbookpage", "", "", false, 123, 161, 0 },
+        { "wxListView", "widget", "wxListView", "", false, 124, 161, 3 },
+        { "wxEditableListBox", "widget", "wxEditListBox", "", false, 125, 164, 3 },
+        { "wxDataViewCtrl", "dataviewctrl", "dataviewtree_ctrl", "", false, 126, 167, 3 },
+        { "wxDataViewTreeCtrl", "dataviewtreectrl", "dataviewtree_ctrl", "", false, 127, 170, 3 },
+        { "wxDataViewListCtrl", "dataviewlistctrl", "dataviewlist_ctrl", "", false, 128, 173, 3 },
+        { "dataViewColumn", "dataviewcolumn", "dataviewlist_column", "", false, 129, 176, 0 },
+        { "dataViewListColumn", "dataviewlistcolumn", "dataviewlist_column", "", false, 130, 176, 0 },
+        { "wxGrid", "widget", "grid", "", false, 131, 176, 3 },
+        { "wxPropertyGrid", "propgrid", "wxPropertyGrid", "", false, 136, 179, 3 },
+        { "wxPropertyGridManager", "propgridman", "wxPropertyGridManager", "", false, 137, 182, 3 },
+        { "propGridPage", "propgridpage", "propgridpage", "", false, 138, 185, 0 },
+        { "propGridItem", "propgriditem", "propgriditem", "", false, 139, 185, 0 },
+        { "propGridCategory", "propgrid_category", "propgrid_cat", "", false, 140, 185, 0 },
+        { "wxTreeCtrl", "widget", "tree_ctrl", "", false, 141, 185, 4 },
+        { "wxTreeListCtrl", "treelistctrl", "treelistctrl", "", false, 142, 189, 3 },
+        { "TreeListCtrlColumn", "treelistctrlcolumn", "treelistctrlcolumn", "", false, 143, 192, 0 },
+        { "wxFrame", "frame_form", "wxFrame", "", false, 144, 192, 5 },
+        { "wxDocParentFrame", "frame_form", "wxFrame", "", false, 145, 197, 5 },
+        { "wxDocChildFrame", "frame_form", "wxFrame", "", false, 146, 202, 5 },
+        { "wxDocMDIParentFrame", "frame_form", "wxFrame", "", false, 147, 207, 5 },
+        { "wxDocMDIChildFrame", "frame_form", "wxFrame", "", false, 148, 212, 5 },
+        { "wxAuiMDIParentFrame", "frame_form", "wxFrame", "", false, 149, 217, 5 },
+        { "wxAuiMDIChildFrame", "frame_form", "wxFrame", "", false, 150, 222, 5 },
+        { "wxPopupWindow", "form", "popup_window", "", false, 151, 227, 1 },
+        { "wxPopupTransientWindow", "form", "popup_transient", "", false, 152, 228, 1 },
+        { "RibbonBar", "ribbonbar_form", "ribbon_bar", "", false, 153, 229, 4 },
+        { "wxDialog", "form", "wxDialog", "", false, 154, 233, 5 },
+        { "PanelForm", "panel_form", "wxPanel", "", false, 155, 238, 2 },
+        { "wxPropertySheetDialog", "propsheetform", "prop_sheet_dlg", "", false, 157, 240, 5 },
+        { "wxWizard", "wizard", "wxWizard", "", false, 159, 245, 5 },
+        { "wxWizardPageSimple", "wizardpagesimple", "wxWizardPageSimple", "", false, 160, 250, 2 },
+        { "DocViewApp", "DocViewApp", "wxFrame", "", false, 161, 252, 3 },
+        { "DocumentImage", "wx_document", "images", "", false, 162, 255, 1 },
+        { "DocumentRichTextCtrl", "wx_document", "richtextctrl", "", false, 163, 256, 1 },
+        { "DocumentSplitterWindow", "wx_document", "wxSplitterWindow", "", false, 164, 257, 1 },
+        { "DocumentStyledTextCtrl", "wx_document", "scintilla", "", false, 165, 258, 1 },
+        { "DocumentTextCtrl", "wx_document", "wxTextCtrl", "", false, 166, 259, 1 },
+        { "ViewImage", "wx_view", "images", "", false, 167, 260, 2 },
+        { "ViewRichTextCtrl", "wx_view", "", "", false, 168, 262, 2 },
+        { "ViewSplitterWindow", "wx_view", "wxSplitterWindow`", "", false, 169, 264, 2 },
+        { "ViewStyledTextCtrl", "wx_view", "scintilla", "", false, 170, 266, 2 },
+        { "ViewTextCtrl", "wx_view", "wxTextCtrl", "", false, 171, 268, 2 },
+        { "wxFilePickerCtrl", "widget", "filePicker", "", false, 172, 270, 3 },
+        { "wxDirPickerCtrl", "widget", "dirPicker", "", false, 173, 273, 3 },
+        { "wxFontPickerCtrl", "widget", "fontPicker", "", false, 174, 276, 3 },
+        { "wxColourPickerCtrl", "widget", "colourPickerIcon", "", false, 175, 279, 4 },
+        { "wxDatePickerCtrl", "widget", "datepicker", "", false, 176, 283, 4 },
+        { "wxTimePickerCtrl", "widget", "timepicker", "", false, 177, 287, 3 },
+        { "Project", "project", "project", "", false, 178, 290, 9 },
+        { "folder", "folder", "folder", "", false, 179, 299, 4 },
+        { "sub_folder", "sub_folder", "folder", "", false, 180, 303, 0 },
+        { "Images", "images", "images", "", false, 181, 303, 0 },
+        { "embedded_image", "embed_image", "bitmap", "", false, 182, 303, 0 },
+        { "wxTimer", "timer", "wxTimer", "", false, 183, 303, 0 },
+        { "Data", "data_list", "data_list", "", false, 184, 303, 0 },
+        { "data_folder", "data_folder", "folder", "", false, 185, 303, 0 },
+        { "data_string", "data_string", "text_file", "", false, 186, 303, 0 },
+        { "data_xml", "data_string", "xml_file", "", false, 187, 303, 0 },
+        { "sizeritem", "sizeritem", "", "", false, 188, 303, 1 },
+        { "gbsizeritem", "gbsizeritem", "", "", false, 189, 304, 1 },
+        { "splitteritem", "splitteritem", "", "", false, 190, 305, 0 },
+        { "wxBoxSizer", "sizer", "sizer_horizontal", "", false, 191, 305, 2 },
+        { "VerticalBoxSizer", "sizer", "sizer", "", false, 192, 307, 2 },
+        { "wxStaticBoxSizer", "sizer", "wxStaticBoxSizer", "", false, 193, 309, 2 },
+        { "StaticCheckboxBoxSizer", "sizer", "wxStaticCheckBoxSizer", "", false, 194, 311, 3 },
+        { "StaticRadioBtnBoxSizer", "sizer", "wxStaticRadioBtnSizer", "", false, 195, 314, 3 },
+        { "wxWrapSizer", "sizer", "wrap_sizer", "", false, 196, 317, 2 },
+        { "wxGridSizer", "sizer", "grid_sizer", "", false, 197, 319, 2 },
+        { "wxFlexGridSizer", "sizer", "flex_grid_sizer", "", false, 198, 321, 3 },
+        { "wxGridBagSizer", "gbsizer", "grid_bag_sizer", "", false, 199, 324, 3 },
+        { "TextSizer", "widget", "text_sizer", "", false, 200, 327, 1 },
+        { "spacer", "widget", "spacer", "", false, 201, 328, 1 },
+        { "wxStdDialogButtonSizer", "widget", "stddialogbuttonsizer", "", false, 202, 329, 2 },
+        { "wxStaticText", "widget", "wxStaticText", "", false, 205, 331, 4 },
+        { "wxTextCtrl", "widget", "wxTextCtrl", "", false, 206, 335, 4 },
+        { "wxRichTextCtrl", "widget", "richtextctrl", "", false, 207, 339, 2 },
+        { "wxStyledTextCtrl", "widget", "scintilla", "", false, 208, 341, 3 },
+        { "wxActivityIndicator", "widget", "wxActivityIndicator", "", false, 213, 344, 3 },
+        { "wxAnimationCtrl", "widget", "wxAnimation", "", false, 214, 347, 2 },
+        { "wxBannerWindow", "widget", "wxBannerWindow", "no_focus_events no_key_events", false, 215, 349, 3 },
+        { "CustomControl", "widget", "CustomControl", "", false, 216, 352, 3 },
+        { "wxRearrangeCtrl", "widget", "wxRearrangeCtrl", "", false, 217, 355, 4 },
+        { "wxStaticBitmap", "widget", "bitmap", "no_focus_events no_key_events", false, 218, 359, 3 },
+        { "wxStaticLine", "widget", "static_line", "", false, 219, 362, 2 },
+        { "wxSlider", "widget", "slider", "", false, 220, 364, 4 },
+        { "wxGauge", "widget", "gauge", "no_focus_events no_key_events", false, 221, 368, 4 },
+        { "wxScrollBar", "widget", "scrollbar", "", false, 222, 372, 4 },
+        { "wxHyperlinkCtrl", "widget", "hyperlink_ctrl", "no_focus_events no_key_events", false, 223, 376, 3 },
+        { "wxSearchCtrl", "widget", "search", "", false, 224, 379, 3 },
+        { "wxHtmlWindow", "widget", "htmlwin", "", false, 225, 382, 3 },
+        { "wxWebView", "widget", "webview", "", false, 226, 385, 2 },
+        { "wxCalendarCtrl", "widget", "calendar", "", false, 227, 387, 3 },
+        { "wxGenericDirCtrl", "widget", "genericdir_ctrl", "", false, 228, 390, 3 },
+        { "wxFileCtrl", "widget", "wxFileCtrl", "", false, 229, 393, 3 },
+    };
+
+    constexpr Category s_categories[] = {
+        { "", no_index, 1, 4, 0, 0, 0, 0 },
+        { "Focus Events", no_index, 5, 0, 0, 0, 0, 2 },
+        { "General Events", no_index, 5, 0, 0, 0, 2, 6 },
+        { "Keyboard Events", no_index, 5, 0, 0, 0, 8, 4 },
+        { "Mouse Events", no_index, 5, 0, 0, 0, 12, 19 },
+        { "", no_index, 6, 0, 0, 0, 31, 17 },
+        { "", no_index, 7, 0, 0, 7, 48, 0 },
+        { "", no_index, 8, 0, 7, 5, 48, 0 },
+        { "", no_index, 9, 0, 12, 11, 48, 0 },
+        { "", no_index, 10, 0, 23, 0, 48, 0 },
+        { "", no_index, 11, 0, 23, 8, 48, 0 },
+        { "", no_index, 12, 0, 31, 6, 48, 0 },
+        { "", no_index, 13, 0, 37, 9, 48, 0 },
+        { "", no_index, 14, 0, 46, 4, 48, 0 },
+        { "", no_index, 15, 0, 50, 4, 48, 0 },
+        { "", no_index, 16, 0, 54, 2, 48, 0 },
+        { "", no_index, 17, 0, 56, 2, 48, 0 },
+        { "", no_index, 18, 0, 58, 2, 48, 0 },
+        { "", no_index, 19, 0, 60, 2, 48, 0 },
+        { "", no_index, 20, 0, 62, 2, 48, 0 },
+        { "", no_index, 21, 0, 64, 1, 48, 0 },
+        { "", no_index, 22, 0, 65, 15, 48, 0 },
+        { "", no_index, 23, 0, 80, 8, 48, 0 },
+        { "", no_index, 24, 0, 88, 4, 48, 0 },
+        { "", no_index, 25, 0, 92, 4, 48, 0 },
+        { "", no_index, 26, 0, 96, 4, 48, 0 },
+        { "", no_index, 27, 0, 100, 4, 48, 0 },
+        { "", no_index, 28, 0, 104, 4, 48, 0 },
+        { "", no_index, 29, 0, 108, 4, 48, 0 },
+        { "", no_index, 30, 0, 112, 5, 48, 0 },
+        { "", no_index, 31, 0, 117, 5, 48, 0 },
+        { "", no_index, 32, 0, 122, 1, 48, 0 },
+        { "", no_index, 33, 0, 123, 1, 48, 0 },
+        { "", no_index, 34, 0, 124, 1, 48, 0 },
+        { "", no_index, 35, 0, 125, 1, 48, 0 },
+        { "", no_index, 36, 0, 126, 1, 48, 0 },
+        { "", no_index, 37, 0, 127, 1, 48, 0 },
+        { "", no_index, 38, 0, 128, 1, 48, 0 },
+        { "", no_index, 39, 0, 129, 2, 48, 0 },
+        { "", no_index, 40, 0, 131, 10, 48, 0 },
+        { "", no_index, 41, 0, 141, 1, 48, 0 },
+        { "", no_index, 42, 0, 142, 5, 48, 0 },
+        { "", no_index, 43, 0, 147, 6, 48, 0 },
+        { "", no_index, 44, 0, 153, 8, 48, 0 },
+        { "", no_index, 45, 0, 161, 3, 48, 0 },
+        { "", no_index, 46, 0, 164, 4, 48, 0 },
+        { "", no_index, 47, 0, 168, 4, 48, 0 },
+        { "", no_index, 48, 0, 172, 4, 48, 0 },
+        { "", no_index, 49, 0, 176, 4, 48, 0 },
+        { "", no_index, 50, 0, 180, 3, 48, 0 },
+        { "", no_index, 51, 0, 183, 3, 48, 0 },
+        { "", no_index, 52, 0, 186, 2, 48, 0 },
+        { "", no_index, 53, 0, 188, 0, 48, 10 },
+        { "", no_index, 54, 0, 188, 21, 58, 0 },
+        { "", no_index, 55, 0, 209, 4, 58, 0 },
+        { "", no_index, 56, 0, 213, 5, 58, 0 },
+        { "", no_index, 57, 0, 218, 5, 58, 0 },
+        { "", no_index, 58, 0, 223, 8, 58, 5 },
+        { "", no_index, 59, 0, 231, 6, 63, 2 },
+        { "", no_index, 60, 0, 237, 0, 65, 0 },
+        { "", no_index, 61, 0, 237, 0, 65, 0 },
+        { "", no_index, 62, 0, 237, 5, 65, 0 },
+        { "", no_index, 63, 0, 242, 5, 65, 0 },
+        { "", no_index, 64, 0, 247, 9, 65, 7 },
+        { "", no_index, 65, 0, 256, 4, 72, 6 },
+        { "", no_index, 66, 0, 260, 1, 78, 0 },
+        { "", no_index, 67, 0, 261, 1, 78, 0 },
+        { "", no_index, 68, 0, 262, 3, 78, 0 },
+        { "", no_index, 69, 0, 265, 4, 78, 0 },
+        { "", no_index, 70, 0, 269, 3, 78, 0 },
+        { "", no_index, 71, 0, 272, 1, 78, 0 },
+        { "", no_index, 72, 0, 273, 1, 78, 0 },
+        { "", no_index, 73, 0, 274, 2, 78, 0 },
+        { "", no_index, 74, 0, 276, 3, 78, 0 },
+        { "", no_index, 75, 0, 279, 3, 78, 0 },
+        { "", no_index, 76, 0, 282, 12, 78, 2 },
+        { "", no_index, 77, 0, 294, 1, 80, 0 },
+        { "", no_index, 78, 0, 295, 1, 80, 0 },
+        { "", no_index, 79, 0, 296, 1, 80, 0 },
+        { "", no_index, 80, 0, 297, 3, 80, 9 },
+        { "", no_index, 81, 0, 300, 4, 89, 0 },
+        { "", no_index, 82, 0, 304, 4, 89, 1 },
+        { "", no_index, 83, 0, 308, 1, 90, 2 },
+        { "", no_index, 84, 0, 309, 4, 92, 2 },
+        { "", no_index, 85, 0, 313, 3, 94, 2 },
+        { "", no_index, 86, 0, 316, 4, 96, 2 },
+        { "", no_index, 87, 0, 320, 2, 98, 4 },
+        { "", no_index, 88, 0, 322, 1, 102, 0 },
+        { "", no_index, 89, 0, 323, 0, 102, 0 },
+        { "", no_index, 90, 0, 323, 7, 102, 5 },
+        { "", no_index, 91, 0, 330, 7, 107, 3 },
+        { "", no_index, 92, 0, 337, 6, 110, 1 },
+        { "", no_index, 93, 0, 343, 7, 111, 2 },
+        { "", no_index, 94, 0, 350, 6, 113, 5 },
+        { "", no_index, 95, 0, 356, 7, 118, 3 },
+        { "", no_index, 96, 0, 363, 6, 121, 1 },
+        { "", no_index, 97, 0, 369, 2, 122, 0 },
+        { "", no_index, 98, 0, 371, 4, 122, 1 },
+        { "", no_index, 99, 0, 375, 4, 123, 1 },
+        { "", no_index, 100, 0, 379, 4, 124, 1 },
+        { "", no_index, 101, 0, 383, 6, 125, 1 },
+        { "", no_index, 102, 0, 389, 1, 126, 1 },
+        { "", no_index, 103, 0, 390, 5, 127, 1 },
+        { "", no_index, 104, 0, 395, 7, 128, 3 },
+        { "", no_index, 105, 0, 402, 8, 131, 3 },
+        { "", no_index, 106, 0, 410, 6, 134, 3 },
+        { "", no_index, 107, 0, 416, 5, 137, 1 },
+        { "", no_index, 108, 0, 421, 3, 138, 1 },
+        { "", no_index, 109, 0, 424, 1, 139, 1 },
+        { "", no_index, 110, 0, 425, 1, 140, 0 },
+        { "", no_index, 111, 0, 426, 8, 140, 4 },
+        { "", no_index, 112, 0, 434, 3, 144, 8 },
+        { "", no_index, 113, 0, 437, 3, 152, 8 },
+        { "", no_index, 114, 0, 440, 4, 160, 1 },
+        { "", no_index, 115, 0, 444, 3, 161, 2 },
+        { "", no_index, 116, 0, 447, 4, 163, 2 },
+        { "", no_index, 117, 0, 451, 7, 165, 15 },
+        { "", no_index, 118, 0, 458, 5, 180, 2 },
+        { "", no_index, 119, 0, 463, 2, 182, 2 },
+        { "", no_index, 120, 0, 465, 5, 184, 4 },
+        { "", no_index, 121, 0, 470, 4, 188, 2 },
+        { "", no_index, 122, 0, 474, 4, 190, 0 },
+        { "", no_index, 123, 0, 478, 3, 190, 0 },
+        { "", no_index, 124, 0, 481, 3, 190, 0 },
+        { "", no_index, 125, 0, 484, 5, 190, 20 },
+        { "", no_index, 126, 0, 489, 4, 210, 20 },
+        { "", no_index, 127, 0, 493, 2, 230, 18 },
+        { "", no_index, 128, 0, 495, 2, 248, 18 },
+        { "", no_index, 129, 0, 497, 2, 266, 18 },
+        { "", no_index, 130, 0, 499, 9, 284, 0 },
+        { "", no_index, 131, 0, 508, 8, 284, 0 },
+        { "", no_index, 132, 4, 516, 10, 284, 16 },
+        { "Labels", no_index, 136, 0, 526, 5, 300, 0 },
+        { "Cells", no_index, 136, 0, 531, 6, 300, 0 },
+        { "Columns", no_index, 136, 0, 537, 9, 300, 0 },
+        { "Rows", no_index, 136, 0, 546, 9, 300, 0 },
+        { "", no_index, 137, 0, 555, 4, 300, 13 },
+        { "", no_index, 138, 0, 559, 4, 313, 14 },
+        { "", no_index, 139, 0, 563, 3, 327, 0 },
+        { "", no_index, 140, 0, 566, 4, 327, 0 },
+        { "", no_index, 141, 0, 570, 3, 327, 0 },
+        { "", no_index, 142, 0, 573, 2, 327, 4 },
+        { "", no_index, 143, 0, 575, 2, 331, 7 },
+        { "", no_index, 144, 0, 577, 4, 338, 0 },
+        { "", no_index, 145, 0, 581, 8, 338, 1 },
+        { "", no_index, 146, 0, 589, 8, 339, 0 },
+        { "", no_index, 147, 0, 597, 8, 339, 0 },
+        { "", no_index, 148, 0, 605, 8, 339, 0 },
+        { "", no_index, 149, 0, 613, 8, 339, 0 },
+        { "", no_index, 150, 0, 621, 8, 339, 0 },
+        { "", no_index, 151, 0, 629, 8, 339, 0 },
+        { "", no_index, 152, 0, 637, 11, 339, 2 },
+        { "", no_index, 153, 0, 648, 11, 341, 2 },
+        { "", no_index, 154, 0, 659, 4, 343, 9 },
+        { "", no_index, 155, 0, 663, 8, 352, 1 },
+        { "", no_index, 156, 1, 671, 3, 353, 8 },
+        { "Window Settings", no_index, 157, 0, 674, 14, 361, 0 },
+        { "", no_index, 158, 1, 688, 13, 361, 1 },
+        { "Click Events", no_index, 159, 0, 701, 0, 362, 7 },
+        { "", no_index, 160, 0, 701, 10, 369, 8 },
+        { "", no_index, 161, 0, 711, 2, 377, 0 },
+        { "", no_index, 162, 0, 713, 4, 377, 0 },
+        { "", no_index, 163, 0, 717, 9, 377, 0 },
+        { "", no_index, 164, 0, 726, 9, 377, 0 },
+        { "", no_index, 165, 0, 735, 9, 377, 0 },
+        { "", no_index, 166, 0, 744, 9, 377, 0 },
+        { "", no_index, 167, 0, 753, 9, 377, 0 },
+        { "", no_index, 168, 0, 762, 4, 377, 1 },
+        { "", no_index, 169, 0, 766, 4, 378, 1 },
+        { "", no_index, 170, 0, 770, 4, 379, 1 },
+        { "", no_index, 171, 0, 774, 4, 380, 1 },
+        { "", no_index, 172, 0, 778, 4, 381, 1 },
+        { "", no_index, 173, 0, 782, 6, 382, 1 },
+        { "", no_index, 174, 0, 788, 5, 383, 1 },
+        { "", no_index, 175, 0, 793, 5, 384, 1 },
+        { "", no_index, 176, 0, 798, 3, 385, 3 },
+        { "", no_index, 177, 0, 801, 3, 388, 1 },
+        { "", no_index, 178, 0, 804, 2, 389, 1 },
+        { "", no_index, 179, 0, 806, 9, 390, 0 },
+        { "", no_index, 180, 0, 815, 2, 390, 0 },
+        { "", no_index, 181, 0, 817, 1, 390, 0 },
+        { "", no_index, 182, 0, 818, 5, 390, 0 },
+        { "", no_index, 183, 0, 823, 1, 390, 0 },
+        { "", no_index, 184, 0, 824, 5, 390, 1 },
+        { "", no_index, 185, 0, 829, 1, 391, 0 },
+        { "", no_index, 186, 0, 830, 1, 391, 0 },
+        { "", no_index, 187, 0, 831, 3, 391, 0 },
+        { "", no_index, 188, 0, 834, 3, 391, 0 },
+        { "", no_index, 189, 0, 837, 1, 391, 0 },
+        { "", no_index, 190, 0, 838, 4, 391, 0 },
+        { "", no_index, 191, 0, 842, 0, 391, 0 },
+        { "", no_index, 192, 0, 842, 3, 391, 0 },
+        { "", no_index, 193, 0, 845, 2, 391, 0 },
+        { "", no_index, 194, 0, 847, 7, 391, 1 },
+        { "", no_index, 195, 0, 854, 10, 392, 2 },
+        { "", no_index, 196, 0, 864, 9, 394, 2 },
+        { "", no_index, 197, 0, 873, 4, 396, 0 },
+        { "", no_index, 198, 0, 877, 6, 396, 0 },
+        { "", no_index, 199, 0, 883, 4, 396, 0 },
+        { "", no_index, 200, 0, 887, 3, 396, 0 },
+        { "", no_index, 201, 0, 890, 3, 396, 0 },
+        { "", no_index, 202, 0, 893, 4, 396, 0 },
+        { "", no_index, 203, 2, 897, 12, 396, 0 },
+        { "Click Events", no_index, 205, 0, 909, 0, 396, 9 },
+        { "Update Events", no_index, 205, 0, 909, 0, 405, 9 },
+        { "", no_index, 206, 0, 909, 5, 414, 0 },
+        { "", no_index, 207, 0, 914, 8, 414, 4 },
+        { "", no_index, 208, 0, 922, 5, 418, 22 },
+        { "", no_index, 209, 4, 927, 10, 440, 34 },
+        { "Margin Columns", no_index, 213, 0, 937, 19, 474, 0 },
+        { "Selections", no_index, 213, 0, 956, 6, 474, 0 },
+        { "Tabs and Indentation", no_index, 213, 0, 962, 6, 474, 0 },
+        { "Wrapping", no_index, 213, 0, 968, 5, 474, 0 },
+        { "", no_index, 214, 0, 973, 2, 474, 0 },
+        { "", no_index, 215, 0, 975, 6, 474, 0 },
+        { "", no_index, 216, 0, 981, 7, 474, 0 },
+        { "", no_index, 217, 0, 988, 8, 474, 0 },
+        { "", no_index, 218, 0, 996, 7, 474, 3 },
+        { "", no_index, 219, 0, 1003, 3, 477, 0 },
+        { "", no_index, 220, 0, 1006, 2, 477, 0 },
+        { "", no_index, 221, 0, 1008, 12, 477, 10 },
+        { "", no_index, 222, 0, 1020, 5, 487, 0 },
+        { "", no_index, 223, 0, 1025, 6, 487, 9 },
+        { "", no_index, 224, 0, 1031, 9, 496, 1 },
+        { "", no_index, 225, 0, 1040, 7, 497, 4 },
+        { "", no_index, 226, 0, 1047, 5, 501, 3 },
+        { "", no_index, 227, 0, 1052, 2, 504, 8 },
+        { "", no_index, 228, 0, 1054, 4, 512, 8 },
+        { "", no_index, 229, 0, 1058, 7, 520, 2 },
+        { "", no_index, 230, 0, 1065, 8, 522, 4 },
+    };
+
+    constexpr Property s_properties[] = {
+        { "bitmap", "image", "", "This is the bitmap shown in the default state. It will also be used for all other bitmaps if they are not explicitly set.", false, 0, 0 },
+        { "disabled_bmp", "image", "", "Bitmap shown when the button is disabled.", false, 0, 0 },
+        { "pressed_bmp", "image", "", "Bitmap shown when the button is pushed (e.g. while the user keeps the mouse button pressed on it).", false, 0, 0 },
+        { "focus_bmp", "image", "", "Bitmap shown when the button has keyboard focus but is not pressed.", false, 0, 0 },
+        { "current", "image", "", "Bitmap shown when the mouse is over the button (but it is not pressed). Notice that if hover bitmap is not specified but the current platform UI uses hover images for the buttons (such as Windows XP or GTK+), then the focus bitmap is used for the hover state as well. This makes it possible to set just the focus bitmap to get reasonably good behaviour on all platforms.", false, 0, 0 },
+        { "position", "option", "", "", false, 0, 5 },
+        { "margins", "wxSize", "", "The margins between the bitmap and the text of the button. This is currently only implemented under MSW. If it is not specified, a default margin is used around the bitmap.", false, 0, 0 },
+        { "bitmap", "image", "", "This is the bitmap shown in the default state. It will also be used for all other bitmaps if they are not explicitly set.", false, 0, 0 },
+        { "disabled_bmp", "image", "", "Bitmap shown when the button is disabled.", false, 0, 0 },
+        { "pressed_bmp", "image", "", "Bitmap shown when the button is pushed (e.g. while the user keeps the mouse button pressed on it).", false, 0, 0 },
+        { "focus_bmp", "image", "", "Bitmap shown when the button has keyboard focus but is not pressed.", false, 0, 0 },
+        { "current", "image", "", "Bitmap shown when the mouse is over the button (but it is not pressed). Notice that if hover bitmap is not specified but the current platform UI uses hover images for the buttons (such as Windows XP or GTK+), then the focus bitmap is used for the hover state as well. This makes it possible to set just the focus bitmap to get reasonably good behaviour on all platforms.", false, 0, 0 },
+        { "id", "id", "wxID_ANY", "The identifier for the dialog.", false, 0, 0 },
+        { "variant", "option", " normal ", "Chooses a different variant of the window display to use (calls SetWindowVariant).", false, 5, 4 },
+        { "pos", "wxPoint", "", "Sets the dialog position. The default is (-1, -1) which indicates that wxWidgets should generate a default position for the dialog.", false, 0, 0 },
+        { "size", "wxSize", "", "Sets the dialog size. The default is (-1, -1) which indicates that wxWidgets should generate a default size for the dialog, large enough to display all visible elements.", false, 0, 0 },
+        { "minimum_size", "wxSize", "", "Sets the minimum size of the dialog. The default is (-1, -1) which indicates wxWidgets should calculate a minimum size large enough to display all visible elements.", false, 0, 0 },
+        { "maximum_size", "wxSize", "", "Sets the maximum size of the dialog.", false, 0, 0 },
+        { "foreground_colour", "wxColour", "", "Sets the foreground colour of the dialog.", false, 0, 0 },
+        { "background_colour", "wxColour", "", "Sets the background colour of the dialog.", false, 0, 0 },
+        { "font", "wxFont", "", "Sets the font for the dialog. This should not be used if you don't want the font to be inherited by the dialog's children", false, 0, 0 },
+        { "window_name", "string_escapes", "", "Used to associate a name with the window, allowing the application user to set Motif resource values for individual dialog boxes.", false, 0, 0 },
+        { "subclass", "string", "", "If you have derived a class from wxDialog and you want to use your derived class, then specify that class name here. You will need to add the header file for your class to the base_hdr_includes property. Note that your base class must specify a constructor with no parameters to match a wxDialog() constructor.", false, 0, 0 },
+        { "base_file", "file", "", "The filename of the base class.", false, 0, 0 },
+        { "source_preamble", "code_edit", "", "This preamble is added in addition to any src_preamble specified for the entire project. It will be placed unchanged at the top of the generated base src file after any (optional) precompiled header file.", false, 0, 0 },
+        { "local_src_includes", "include_files", "", "Lists one or more local header files to include in the generated header file.", false, 0, 0 },
+        { "system_src_includes", "include_files", "", "Lists one or more system header files to include in the generated header file.", false, 0, 0 },
+        { "generate_ids", "bool", "1", "If checked, any non-wxWidgets ids will be created as an enumerated list unless you specifically assign the value of the id (e.g., myid=100).", false, 0, 0 },
+        { "initial_enum_string", "string", " wxID_HIGHEST + 1", "The first id in a generated enum will be set to this value.", false, 0, 0 },
+        { "class_decoration", "string", "", "This specifies the keyword or macro to add to the class declaration (such as __declspec(dllexport) ).", false, 0, 0 },
+        { "name_space", "string", "", "If specified, this will override any name_space specified for the entire project. Note that the class name must still be unique to the project in spite of using a name_space.", false, 0, 0 },
+        { "header_preamble", "code_edit", "", "This preamble is placed unchanged in the generated header file after all wx/ include files. It is commonly used to add forward class names needed by methods and members you add to the Derived Class Settings.", false, 0, 0 },
+        { "local_hdr_includes", "include_files", "", "Lists one or more local header files to include in the generated header file.", false, 0, 0 },
+        { "system_hdr_includes", "include_files", "", "Lists one or more system header files to include in the generated header file.", false, 0, 0 },
+        { "inserted_hdr_code", "code_edit", "", "Specify code to insert into the header file at the end of the public: section. You may add protected: and private: sections as needed for additional methods and member variables.", false, 0, 0 },
+        { "generate_const_values", "bool", "0", "If checked, each form's header file will have const values declared for some of the possible parameters. E.g., const int form_id = your_id. You can use this when creating multiple instances of a form with different construction parameters.", false, 0, 0 },
+        { "no_closing_brace", "bool", "0", "If checked no closing brace (};) will be generated at the end of the header file. This allows you to extend the class definition after the generated code block.", false, 0, 0 },
+        { "use_derived_class", "bool", "1", "Check this if you will be creating a derived class. If not checked, you can implement any event handlers below the generated file's final comment block.", false, 0, 0 },
+        { "pure_virtual_functions", "bool", " 0", "Check this if you want all event handler functions to be pure virtual ( = 0).", false, 0, 0 },
+        { "derived_class_name", "string", "", "The name of the derived class. Ignored if use_derived_class is unchecked.", false, 0, 0 },
+        { "derived_file", "file", "", "The filename of the derived class. You can leave this empty if you have already generated the file. Ignored if use_derived_class is unchecked.", false, 0, 0 },
+        { "additional_inheritance", "stringlist_escapes", "", "Additional classes to inherit from (these can be your own classes if you specified their header file in base_hdr_includes in the C++ Settings section above).", false, 0, 0 },
+        { "class_methods", "stringlist_escapes", "", "Additional public class methods to add (useful if you are *not* using a derived class.)", false, 0, 0 },
+        { "protected_class_methods", "stringlist_escapes", "", "Additional protected class methods to add (useful if you are *not* using a derived class.)", false, 0, 0 },
+        { "class_members", "stringlist_escapes", "", "Additional class variable members to add (useful if you are *not* using a derived class.)", false, 0, 0 },
+        { "private_members", "bool", "", "Check this to make all class member variables private: instead of protected:. This can only be done if you are *not* creating a derived class (use_derived_class is unchecked).", false, 0, 0 },
+        { "python_file", "file", "", "The filename to use if generating code for wxPython.", false, 0, 0 },
+        { "insert_python_code", "code_edit", "", "Specify the code to insert into the python file after the generated import statements. This is usually used to import additional modules, but can be any valid python code for use before the class definition.", false, 0, 0 },
+        { "python_import_list", "include_files", "", "Specifies the python modules that should be imported. These will be added using the import command.", false, 0, 0 },
+        { "python_inherit_name", "string", "", "The name to use for an inherited class. If specified, the Inherit tab in the Python panel will include a sample for creating an inherited class.", false, 0, 0 },
+        { "ruby_file", "file", "", "The filename to use if generating code for wxRuby3.", false, 0, 0 },
+        { "insert_ruby_code", "code_edit", "", "Specify the code to insert into the ruby file after the generated import statements. This can be any valid ruby code for use before the class definition.", false, 0, 0 },
+        { "relative_require_list", "include_files", "", "Specifies the ruby modules that are required by this module. These will be added using the relative_require command, and are relative to the location of this generated file.", false, 0, 0 },
+        { "ruby_inherit_name", "string", "", "The name to use for an inherited class. If specified, the Inherit tab in the Ruby panel will include a sample for creating an inherited class.", false, 0, 0 },
+        { "fortran_file", "file", "", "The filename to use if generating code for kwxFortran.", false, 0, 0 },
+        { "insert_fortran_code", "code_edit", "", "Specify the code to insert into the fortran file after the generated statements. This can be any valid fortran code for use before the program definition.", false, 0, 0 },
+        { "go_file", "file", "", "The filename to use if generating code for kwxGO.", false, 0, 0 },
+        { "insert_go_code", "code_edit", "", "Specify the code to insert into the go file after the generated import statements. This can be any valid go code for use before the class definition.", false, 0, 0 },
+        { "julia_file", "file", "", "The filename to use if generating code for kwxJulia.", false, 0, 0 },
+        { "insert_julia_code", "code_edit", "", "Specify the code to insert into the julia file after the generated import statements. This can be any valid julia code for use before the class definition.", false, 0, 0 },
+        { "luajit_file", "file", "", "The filename to use if generating code for kwxLuaJIT.", false, 0, 0 },
+        { "insert_luajit_code", "code_edit", "", "Specify the code to insert into the luajit file after the generated statements. This can be any valid luajit code for use before the class definition.", false, 0, 0 },
+        { "typescript_file", "file", "", "The filename to use if generating code for kwxTypeScript.", false, 0, 0 },
+        { "insert_typescript_code", "code_edit", "", "Specify the code to insert into the typescript file after the generated import statements. This can be any valid typescript code for use before the class definition.", false, 0, 0 },
+        { "xrc_file", "file", "", "The filename to use if generating XRC. This will be ignored if the project specifies combined XRC files.", false, 0, 0 },
+        { "wxWidgets_version", "option", "3.2.0", "If you specify a control or property that requires a wxWidgets version later than this number, then the code will be generated within a conditional block.", false, 9, 4 },
+        { "minimum_compiler", "option", "11", "The minimum compiler standard required for the generated code. This will affect some of the code that is generated.", false, 13, 2 },
+        { "base_directory", "path", "", "The generated base class output directory. If a form's base_file contains only a filename (without a path), the files will be generated in this directory. Leave blank to generate the in the same directory as the project file.", false, 0, 0 },
+        { "derived_directory", "path", "", "The generated derived class output directory. Leave blank to generate them in the same directory as the project file.", false, 0, 0 },
+        { "source_ext", "option", " .cpp ", "Specifies the file extension to use when creating C++ source files.", false, 15, 3 },
+        { "header_ext", "option", " .h ", "Specifies the file extension to use when creating C++ header files.", false, 18, 4 },
+        { "cpp_line_length", "uint", "110", "Specifies a guideline for generated code line length. Most lines will be wrapped so that they do not exceed this length.", false, 0, 0 },
+        { "trailing_return_type", "bool", "0", "If checked, this will generate functions with a trailing return type instead of a leading return type.", false, 0, 0 },
+        { "local_pch_file", "file", "", "The filename of a local precompiled header file. The file will be included in quotes.", false, 0, 0 },
+        { "src_preamble", "code_edit", "", "Code to generate at the top of all source files after the inclusion of any local precompiled header file. This can include header files, comments, macros, etc.", false, 0, 0 },
+        { "project_src_includes", "include_files", "", "Lists one or more local header files to include in all generated source files.", false, 0, 0 },
+        { "name_space", "string", "", "Namespace to enclose class declarations in. Separate nested namespaces with a double colon (e.g. company::app::subname)", false, 0, 0 },
+        { "generate_cmake", "bool", "0", "If checked, this will auto-generate a .cmake file whenever C++ code is generated.", false, 0, 0 },
+        { "cmake_file", "file", "wxui_code.cmake", "The filename of the cmake file to create. By default, this will be created in the same directory as the project file.", false, 0, 0 },
+        { "cmake_varname", "string", "wxue_generated_code", "The variable name to set in the .cmake file. This will contain paths to every generated class.", false, 0, 0 },
+        { "xrc_directory", "path", "", "The directory to generate xrc files in. Leave blank to generate them in the same directory as the project file.", false, 0, 0 },
+        { "xrc_add_var_comments", "bool", " 1", "If checked, any var_comments you add to controls will be added to the XRC file.", false, 0, 0 },
+        { "xrc_no_whitespace", "bool", " 0", "If checked, no leading whitespace will be used. This makes the file smaller, but less readable.", false, 0, 0 },
+        { "xrc_indent_attributes", "bool", "1", "If checked, attributes will be indented. This makes the file larger, but more readable. Ignored if xrc_no_whitespace is checked", false, 0, 0 },
+        { "xrc_indent_with_spaces", "bool", "0", "If checked, indentation will be done with 2 spaces instead of a single tab.", false, 0, 0 },
+        { "combine_all_forms", "bool", "1", "If checked, Export XRC (File menu) will create a single XRC file containing all forms.", false, 0, 0 },
+        { "combined_xrc_file", "file", "", "This filename will be used to write all XRC content to unless you unchecked the combine_all_forms property above.", false, 0, 0 },
+        { "xrc_art_directory", "path", "./", "The directory containing the images your XRC file will load.", false, 0, 0 },
+        { "kwxFortran_version", "option", " 0.9.0 ", "Specifies the minimum version of kwxFortran needed to run the generated code.", false, 22, 1 },
+        { "fortran_output_folder", "path", "", "If a folder name is specified, it will be used for all fortran code.", false, 0, 0 },
+        { "fortran_line_length", "uint", "80", "Specifies a guideline for generated code line length. Most lines will be wrapped so that they do not exceed this length.", false, 0, 0 },
+        { "fortran_project_preamble", "code_edit", "", "Code to generate at the top of every source file after the comment block.", false, 0, 0 },
+        { "kwxGO_version", "option", "0.90", "Specifies the minimum version of kwxGO needed to run the generated code.", false, 23, 2 },
+        { "go_output_folder", "path", "", "If a folder name is specified, it will be used for all go code.", false, 0, 0 },
+        { "go_line_length", "uint", "90", "Specifies a guideline for generated code line length. Most lines will be wrapped so that they do not exceed this length.", false, 0, 0 },
+        { "go_project_preamble", "code_edit", "", "Code to generate at the top of every source file after the comment block.", false, 0, 0 },
+        { "kwxJulia_version", "option", " 0.9.0 ", "Specifies the minimum version of kwxJulia needed to run the generated code.", false, 25, 1 },
+        { "julia_output_folder", "path", "", "If a folder name is specified, it will be used for all julia code.", false, 0, 0 },
+        { "julia_line_length", "uint", "92", "Specifies a guideline for generated code line length. Most lines will be wrapped so that they do not exceed this length.", false, 0, 0 },
+        { "julia_project_preamble", "code_edit", "", "Code to generate at the top of every source file after the comment block.", false, 0, 0 },
+        { "kwxLuaJIT_version", "option", " 0.9.0 ", "Specifies the minimum version of kwxLuaJIT needed to run the generated code.", false, 26, 1 },
+        { "lua_output_folder", "path", "", "If a folder name is specified, it will be used for all lua code.", false, 0, 0 },
+        { "lua_line_length", "uint", "80", "Specifies a guideline for generated code line length. Most lines will be wrapped so that they do not exceed this length.", false, 0, 0 },
+        { "lua_project_preamble", "code_edit", "", "Code to generate at the top of every source file after the comment block.", false, 0, 0 },
+        { "kwxTypeScript_version", "option", " 0.9.0 ", "Specifies the minimum version of kwxTypeScript needed to run the generated code.", false, 27, 1 },
+        { "typescript_output_folder", "path", "", "If a folder name is specified, it will be used for all typescript code.", false, 0, 0 },
+        { "typescript_line_length", "uint", "80", "Specifies a guideline for generated code line length. Most lines will be wrapped so that they do not exceed this length.", false, 0, 0 },
+        { "typescript_project_preamble", "code_edit", "", "Code to generate at the top of every source file after the comment block.", false, 0, 0 },
+        { "wxPython_version", "option", " 4.2.0 ", "Specifies the minimum version of wxPython needed to run the generated code.", false, 28, 1 },
+        { "python_output_folder", "path", "", "If a folder name is specified, it will be used for all python code.", false, 0, 0 },
+        { "python_line_length", "uint", "90", "Specifies a guideline for generated code line length. Most lines will be wrapped so that they do not exceed this length.", false, 0, 0 },
+        { "python_project_preamble", "code_edit", "", "Code to generate at the top of every source file after the comment block and before the first import statement.", false, 0, 0 },
+        { "wxRuby_version", "option", " 1.6.1 ", "Specifies the minimum version of wxRuby needed to run the generated code.", false, 29, 3 },
+        { "ruby_output_folder", "path", "", "If a folder name is specified, it will be used for all ruby code.", false, 0, 0 },
+        { "ruby_line_length", "uint", "80", "Specifies a guideline for generated code line length. Most lines will be wrapped so that they do not exceed this length.", false, 0, 0 },
+        { "disable_rubo_cop", "bool", " 0", "If checked, all RuboCop warnings will be disabled within the generated code.", false, 0, 0 },
+        { "ruby_project_preamble", "code_edit", "", "Code to generate at the top of every source file after the comment block and any disabled RuboCop warnings.", false, 0, 0 },
+        { "folder_base_directory", "path", "", "Overrides any project setting of generated base class output directory. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_derived_directory", "path", "", "Overrides any project setting of derived class output directory. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_namespace", "string", "", "Overrides any project setting of namespace to enclose class declarations in. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_cmake_file", "file", "", "Overrides any project setting of filename of the cmake file to create.  Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_cmake_varname", "string", "", "Overrides any project setting of the variable name to set in the .cmake file. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_python_output_folder", "path", "", "Overrides any project setting of the output folder used for all generated wxPython code. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_ruby_output_folder", "path", "", "Overrides any project setting of the output folder used for all generated wxRuby code. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_fortran_output_folder", "path", "", "Overrides any project setting of the output folder used for all generated wxFortran code. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_go_output_folder", "path", "", "Overrides any project setting of the output folder used for all generated wxGO code. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_julia_output_folder", "path", "", "Overrides any project setting of the output folder used for all generated wxJulia code. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_luajit_output_folder", "path", "", "Overrides any project setting of the output folder used for all generated wxLuaJIT code. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_typescript_output_folder", "path", "", "Overrides any project setting of the output folder used for all generated wxTypeScript code. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_xrc_directory", "path", "", "Overrides any project setting of the output folder used for all generated XRC code. Only affects the forms within this folder.", false, 0, 0 },
+        { "folder_combined_xrc_file", "file", "", "Overrides any project setting of the combined filename. Only affects the forms within this folder.", false, 0, 0 },
+        { "alignment", "bitlist", "", "", false, 32, 7 },
+        { "borders", "bitlist", " wxALL ", "", false, 39, 5 },
+        { "border_size", "uint", "5", "Sets the border size, if the flag parameter is set to include any border flag. The default value of 5 will be scaled on high DPI displays.", false, 0, 0 },
+        { "scale_border_size", "bool", "1", "If checked, the border size will be scaled on high DPI displays. Always scaled if size is 5, 10 or 15.", false, 0, 0 },
+        { "flags", "bitlist", "", "", false, 44, 4 },
+        { "proportion", "uint", "0", "How much this control will stretch in proportion to the other controls in the same sizer. Set to 0 to prevent stretching.", false, 0, 0 },
+        { "row", "int", "0", "Row for the item.", false, 0, 0 },
+        { "column", "int", "0", "Column for the item.", false, 0, 0 },
+        { "rowspan", "int", "1", "The number of rows that the item spans.", false, 0, 0 },
+        { "colspan", "int", "1", "The number of columns that the item spans.", false, 0, 0 },
+        { "minimum_size", "wxSize", "", "Normally, the sizer will calculate its minimal size based purely on how much space its children need. If the minimal size is > 0, 'GetMinSize' will return either the minimal size as requested by its children or the minimal size set here, depending on which is bigger.", false, 0, 0 },
+        { "alignment", "bitlist", "", "", false, 48, 7 },
+        { "borders", "bitlist", " wxALL ", "", false, 55, 5 },
+        { "border_size", "uint", "5", "Sets the border size, if the flag parameter is set to include any border flag. The default value of 5 will be scaled on high DPI displays.", false, 0, 0 },
+        { "scale_border_size", "bool", "1", "If checked, the border size will be scaled on high DPI displays. Always scaled if size is 5, 10 or 15.", false, 0, 0 },
+        { "flags", "bitlist", "", "", false, 60, 4 },
+        { "vgap", "uint", "0", "The vertical gap (in pixels) between the cells in the sizer.", false, 0, 0 },
+        { "hgap", "uint", "0", "The horizontal gap (in pixels) between cells in the sizer.", false, 0, 0 },
+        { "growablecols", "string_code_grow_columns", "", "Comma separated list of column indices (starting from zero, optional proportion appended after a colon) that should be grown if there is extra space available to the sizer.", false, 0, 0 },
+        { "growablerows", "string_code_grow_rows", "", "Comma separated list of row indices (starting from zero, optional proportion appended after a colon) that should be grown if there is extra space available to the sizer.", false, 0, 0 },
+        { "flexible_direction", "option", " wxBOTH ", "wxFlexGridSizer can size items equally in one direction but unequally ('flexibly') in the other", false, 64, 3 },
+        { "non_flexible_grow_mode", "option", "wxFLEX_GROWMODE_SPECIFIED", "If the sizer is only flexible in one direction (this can be changed using 'flexible_direction'), it needs to be decided how the sizer should grow in the other ('non flexible') direction in order to fill the available space.", false, 67, 3 },
+        { "validator_variable", "string", "", "Name of a member variable associated with the validator", false, 0, 0 },
+        { "validator_data_type", "option", " wxString ", "Data type of the member variable", false, 70, 12 },
+        { "get_function", "string", "", "Function name to get the value of the variable.", false, 0, 0 },
+        { "set_function", "string", "", "Function name to set the value of the variable.", false, 0, 0 },
+        { "minValue", "string", "", "Used by wxIntegerValidator and wxFloatingPointValidator, this is the minimum value accepted by the validator.\\n\\nIgnored unless maxValue is also set.", false, 0, 0 },
+        { "maxValue", "string", "", "Used by wxIntegerValidator and wxFloatingPointValidator, this is the maximum value accepted by the validator.\\n\\nIgnore unless minValue is also set.", false, 0, 0 },
+        { "precision", "int", "-1", "Used by wxFloatingPointValidator. The number of decimal digits after the decimal separator to show and accept. -1 uses the maximum precision possible.", false, 0, 0 },
+        { "validator_style", "bitlist", "wxFILTER_NONE", "Data filtering style for wxTextValidator or wxGenericValidator.", false, 82, 13 },
+        { "validator_variable", "string", "", "Name of a member variable associated with the validator", false, 0, 0 },
+        { "get_function", "string", "", "Optional public function to get the value of the variable.", false, 0, 0 },
+        { "set_function", "string", "", "Optional public function to set the value of the variable.", false, 0, 0 },
+        { "validator_variable", "string", "", "Name of a member variable associated with the validator. Requires wxWidgets 3.3 or later.", false, 0, 0 },
+        { "validator_data_type", "option", "wxCheckBoxState", "Data type of the member variable", false, 95, 1 },
+        { "get_function", "string", "", "Function name to get the value of the variable.", false, 0, 0 },
+        { "set_function", "string", "", "Function name to set the value of the variable.", false, 0, 0 },
+        { "validator_variable", "string", "", "Name of a member variable associated with the validator", false, 0, 0 },
+        { "validator_data_type", "option", "wxString ", "Data type of the member variable", false, 96, 2 },
+        { "get_function", "string", "", "Function name to get the value of the variable.", false, 0, 0 },
+        { "set_function", "string", "", "Function name to set the value of the variable.", false, 0, 0 },
+        { "validator_variable", "string", "", "Name of a member variable associated with the validator. Requires wxWidgets 3.3 or later.", false, 0, 0 },
+        { "validator_data_type", "option", "wxColour", "Data type of the member variable", false, 98, 1 },
+        { "get_function", "string", "", "Function name to get the value of the variable.", false, 0, 0 },
+        { "set_function", "string", "", "Function name to set the value of the variable.", false, 0, 0 },
+        { "validator_variable", "string", "", "Name of a member variable associated with the validator", false, 0, 0 },
+        { "validator_data_type", "option", "wxDateTime", "Data type of the member variable", false, 99, 1 },
+        { "get_function", "string", "", "Function name to get the value of the variable.", false, 0, 0 },
+        { "set_function", "string", "", "Function name to set the value of the variable.", false, 0, 0 },
+        { "validator_variable", "string", "", "Name of a member variable associated with the validator", false, 0, 0 },
+        { "get_function", "string", "", "Function name to get the value of the variable.", false, 0, 0 },
+        { "set_function", "string", "", "Function name to set the value of the variable.", false, 0, 0 },
+        { "validator_variable", "string", "", "Name of a member variable associated with the validator", false, 0, 0 },
+        { "get_function", "string", "", "Function name to get the value of the variable.", false, 0, 0 },
+        { "set_function", "string", "", "Function name to set the value of the variable.", false, 0, 0 },
+        { "validator_variable", "string", "", "Name of a member variable associated with the validator", false, 0, 0 },
+        { "set_function", "string", "", "Function name to set the value of the variable.", false, 0, 0 },
+        { "id", "id", "wxID_ANY", "Specifies the window identifier. When generating Python code, a non wx.Widgets id will be global unless prefixed with self.", false, 0, 0 },
+        { "variant", "option", " normal ", "Chooses a different variant of the window display to use (calls SetWindowVariant).", false, 100, 4 },
+        { "minimum_size", "wxSize", "", "Sets the minimum size of the window. Any positive value will override the automatic size calculation that would normally be done.", false, 0, 0 },
+        { "maximum_size", "wxSize", "", "Sets the maximum allowable size of the window.", false, 0, 0 },
+        { "pos", "wxPoint", "", "Specifies the position to pass to the constructor for the window. A -1 indicates that the value should be calculated automatically.", false, 0, 0 },
+        { "size", "wxSize", "", "Specifies the size to pass to the constructor for the window. A -1 indicates that the value should be calculated automatically. Automatic layout (such as calling SetSizerAndFit) may override these values.", false, 0, 0 },
+        { "window_style", "bitlist", "", "", false, 104, 15 },
+        { "window_extra_style", "bitlist", "", "", false, 119, 5 },
+        { "tooltip", "string_edit_escapes", "", "Attach a tooltip to the window.", false, 0, 0 },
+        { "disabled", "bool", "0", "Disable the window for user input. Note that when a parent window is disabled, all of its children are disabled as well and they are reenabled again when the parent is.", false, 0, 0 },
+        { "hidden", "bool", "0", "Shows or hides the window.", false, 0, 0 },
+        { "foreground_colour", "wxColour", "", "Sets the foreground colour of the window.", false, 0, 0 },
+        { "background_colour", "wxColour", "", "Sets the background colour of the window.", false, 0, 0 },
+        { "font", "wxFont", "", "Sets the font for this window. This should not be used for a parent window if you don't want its font to be inherited by its children", false, 0, 0 },
+        { "context_help", "string_escapes", "", "Sets the help text to be used as context-sensitive help for this window.", false, 0, 0 },
+        { "subclass", "string", "", "If you have derived a class from a wxWidget class and you want this component to use your subclass, then specify that class name here. You will need to add the header file for your class to the subclass_header property.", false, 0, 0 },
+        { "subclass_params", "string_escapes", "", "Specifies additional parameters to insert before the normal wxWidget parameters when Create() is called.", false, 0, 0 },
+        { "subclass_header", "file", "", "Specify the name of the header file that declares your subclass.", false, 0, 0 },
+        { "window_name", "string_escapes", "", "", false, 0, 0 },
+        { "platforms", "bitlist", " Windows|Unix|Mac ", "", false, 124, 3 },
+        { "disable_language", "bitlist", "", "", false, 127, 8 },
+        { "id", "id", "wxID_ANY", "Specifies the window identifier. When generating Python code, a non wx.Widgets id will be global unless prefixed with self.", false, 0, 0 },
+        { "pos", "wxPoint", "", "Specifies the position to pass to the constructor for the window. A -1 indicates that the value should be calculated automatically.", false, 0, 0 },
+        { "size", "wxSize", "", "Specifies the size to pass to the constructor for the window. A -1 indicates that the value should be calculated automatically. Automatic layout (such as calling SetSizerAndFit) may override these values.", false, 0, 0 },
+        { "window_name", "string_escapes", "", "", false, 0, 0 },
+        { "class_name", "string", "MyToolBarBase", "The name of the base class.", false, 0, 0 },
+        { "margins", "wxSize", "", "Values to be used as margins for the toolbar.", false, 0, 0 },
+        { "packing", "uint", "1", "Value used for spacing tools. The packing is used for spacing in the vertical direction if the toolbar is horizontal, and for spacing in the horizontal direction if the toolbar is vertical.", false, 0, 0 },
+        { "separation", "uint", "5", "The default separator size. This is the size between each toolbar tool.", false, 0, 0 },
+        { "style", "bitlist", " wxTB_HORIZONTAL ", "", false, 135, 10 },
+        { "var_name", "string", "m_toolBar", "", false, 0, 0 },
+        { "margins", "wxSize", "", "Values to be used as margins for the toolbar.", false, 0, 0 },
+        { "packing", "uint", "1", "Value used for spacing tools. The packing is used for spacing in the vertical direction if the toolbar is horizontal, and for spacing in the horizontal direction if the toolbar is vertical.", false, 0, 0 },
+        { "separation", "uint", "5", "The default separator size. This is the size between each toolbar tool.", false, 0, 0 },
+        { "style", "bitlist", " wxTB_HORIZONTAL ", "", false, 145, 13 },
+        { "var_name", "string", "tool", "", false, 0, 0 },
+        { "label", "string_escapes", "", "", false, 0, 0 },
+        { "bitmap", "image", "", "The primary tool bitmap.", false, 0, 0 },
+        { "kind", "option", "wxITEM_NORMAL", "", false, 158, 4 },
+        { "disabled", "bool", "0", "Creates the tool in a disabled state. Some platforms will change the visible state of the tool to indicate that it is disabled.", false, 0, 0 },
+        { "tooltip", "string_edit", "", "String to display in the tooltip.", false, 0, 0 },
+        { "statusbar", "string_edit", "", "This string is shown in the statusbar (if any) of the parent frame when the mouse pointer is inside the tool.", false, 0, 0 },
+        { "id", "id", "wxID_ANY", "Specifies the tool identifier. When generating Python code, a non wx.Widgets id will be global unless prefixed with self.", false, 0, 0 },
+        { "var_name", "string", "tool_dropdown", "", false, 0, 0 },
+        { "label", "string_escapes", "", "", false, 0, 0 },
+        { "bitmap", "image", "", "Tool bitmap.", false, 0, 0 },
+        { "tooltip", "string_edit", "", "String to display in the tooltip.", false, 0, 0 },
+        { "statusbar", "string_edit", "", "This string is shown in the statusbar (if any) of the parent frame when the mouse pointer is inside the tool.", false, 0, 0 },
+        { "id", "id", "wxID_ANY", "Specifies the tool identifier. When generating Python code, a non wx.Widgets id will be global unless prefixed with self.", false, 0, 0 },
+        { "class_name", "string", "MyAuiToolBarBase", "The name of the base class.", false, 0, 0 },
+        { "margins", "wxSize", "", "Values to be used as margins for the toolbar.", false, 0, 0 },
+        { "packing", "uint", "1", "Value used for spacing tools. The packing is used for spacing in the vertical direction if the toolbar is horizontal, and for spacing in the horizontal direction if the toolbar is vertical.", false, 0, 0 },
+        { "separation", "uint", "5", "The default separator size. This is the size between each toolbar tool set.", false, 0, 0 },
+        { "style", "bitlist", " wxAUI_TB_DEFAULT_STYLE|wxAUI_TB_PLAIN_BACKGROUND ", "", false, 162, 12 },
+        { "var_name", "string", "m_auiToolBar", "", false, 0, 0 },
+        { "margins", "wxSize", "", "Values to be used as margins for the toolbar.", false, 0, 0 },
+        { "packing", "uint", "1", "Value used for spacing tools. The packing is used for spacing in the vertical direction if the toolbar is horizontal, and for spacing in the horizontal direction if the toolbar is vertical.", false, 0, 0 },
+        { "separation", "uint", "5", "The default separator size. This is the size between each toolbar tool set.", false, 0, 0 },
+        { "style", "bitlist", " wxAUI_TB_DEFAULT_STYLE|wxAUI_TB_PLAIN_BACKGROUND ", "", false, 174, 12 },
+        { "var_name", "string", "tool", "", false, 0, 0 },
+        { "label", "string_escapes", "", "", false, 0, 0 },
+        { "bitmap", "image", "", "The primary tool bitmap.", false, 0, 0 },
+        { "kind", "option", "wxITEM_NORMAL", "", false, 186, 4 },
+        { "initial_state", "bitlist", " wxAUI_BUTTON_STATE_NORMAL ", "", false, 190, 6 },
+        { "context_menu", "bool", "0", "Specifies that a drop-down menu button will appear next to the tool button. Used only with wxAuiToolBar.", false, 0, 0 },
+        { "tooltip", "string_edit", "", "Help string used in the tooltip.", false, 0, 0 },
+        { "statusbar", "string_edit", "", "This string is shown in the statusbar (if any) of the parent frame when the mouse pointer is inside the tool.", false, 0, 0 },
+        { "id", "id", "wxID_ANY", "Specifies the tool identifier. When generating Python code, a non wx.Widgets id will be global unless prefixed with self.", false, 0, 0 },
+        { "var_name", "string", "tool", "", false, 0, 0 },
+        { "label", "string_escapes", "My Label", "", false, 0, 0 },
+        { "width", "int", "-1", "", false, 0, 0 },
+        { "id", "id", "wxID_ANY", "Specifies the label identifier. When generating Python code, a non wx.Widgets id will be global unless prefixed with self.", false, 0, 0 },
+        { "width", "uint", "10", "", false, 0, 0 },
+        { "proportion", "uint", "1", "", false, 0, 0 },
+        { "var_name", "string", "m_statusBar", "", false, 0, 0 },
+        { "fields", "statbar_fields", "1", "Number of fields in the statusbar.", false, 0, 0 },
+        { "style", "bitlist", "wxSTB_DEFAULT_STYLE", "", false, 196, 6 },
+        { "var_name", "string", "m_infoBar", "", false, 0, 0 },
+        { "show_effect", "option", " no effects ", "Set the effects to use when showing the bar.", false, 202, 11 },
+        { "hide_effect", "option", " no effects ", "Set the effects to use when hiding the bar. ", false, 213, 11 },
+        { "duration", "int", "500", "Set the duration of the animation (in milliseconds) used when showing or hiding the bar.", false, 0, 0 },
+        { "class_name", "string", "MyMenuBarBase", "The name of the base class.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 224, 1 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Menu Bar's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyPopupMenuBase", "The name of the base class.", false, 0, 0 },
+        { "handler_name", "string", "OnContextMenu", "This is the handler name that will be used in the parent's wxEVT_CONTEXT_MENU. If you change this name, it will automatically be changed in the parent as well.", false, 0, 0 },
+        { "var_name", "string", "m_menubar", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 225, 1 },
+        { "var_name", "string", "m_menu", "", false, 0, 0 },
+        { "stock_id", "option", " none ", "", false, 226, 4 },
+        { "label", "string_escapes", "MyMenu", "", false, 0, 0 },
+        { "var_name", "string", "submenu", "", false, 0, 0 },
+        { "label", "string_escapes", "MySubMenu", "", false, 0, 0 },
+        { "bitmap", "image", "", "Bitmap for the submenu item.", false, 0, 0 },
+        { "var_name", "string", "menu_item", "", false, 0, 0 },
+        { "stock_id", "option", " none ", "", false, 230, 35 },
+        { "label", "string_escapes", "MyMenuItem", "Text for the menu item, as shown on the menu. An accelerator key can be specified using the ampersand \"&\" character.", false, 0, 0 },
+        { "shortcut", "string_escapes", "", "Optional keyboard shortcut. The syntax is any combination of \"CTRL\", \"ALT\" and \"SHIFT\" strings (case doesn't matter) separated by either '-' or '+' characters and followed by the accelerator itself. The accelerator may be any alphanumeric character, or any function key (from F1 to F12)", false, 0, 0 },
+        { "extra_accels", "stringlist_escapes", "", "Additional accelerators. The syntax is any combination of \"CTRL\", \"ALT\" and \"SHIFT\" strings (case doesn't matter) separated by either '-' or '+' characters and followed by the accelerator itself. The accelerator may be any alphanumeric character, or any function key (from F1 to F12)", false, 0, 0 },
+        { "help", "string_edit", "", "Optional string that will be shown on the status bar.", false, 0, 0 },
+        { "id", "id", "wxID_ANY", "Specifies the menu item identifier. When generating Python code, a non wx.Widgets id will be global unless prefixed with self.", false, 0, 0 },
+        { "bitmap", "image", "", "Bitmap for the menu item. This doubles as the checked bitmap if the menu item is wxITEM_CHECK.", false, 0, 0 },
+        { "unchecked_bitmap", "image", "", "Unchecked bitmap for the menu item. This will be shown if the menu item is wxITEM_CHECK and it is currently unchecked. (Windows only)", false, 0, 0 },
+        { "checked", "bool", "0", "", false, 0, 0 },
+        { "disabled", "bool", "0", "", false, 0, 0 },
+        { "kind", "option", "wxITEM_NORMAL", "", false, 265, 3 },
+        { "var_name", "string", "separator", "", false, 0, 0 },
+        { "var_name", "string", "m_default_menubar", "", false, 0, 0 },
+        { "var_name", "string", "m_doc_menubar", "", false, 0, 0 },
+        { "var_name", "string", "m_rbnBar", "", false, 0, 0 },
+        { "theme", "option", " Default ", "Select the RibbonBar theme.", false, 268, 3 },
+        { "style", "bitlist", "wxRIBBON_BAR_DEFAULT_STYLE", "", false, 271, 10 },
+        { "var_name", "string", "rbnPage", "", false, 0, 0 },
+        { "label", "string_escapes", "MyRibbonPage", "", false, 0, 0 },
+        { "bitmap", "image", "", "wxRibbonPage bitmap.", false, 0, 0 },
+        { "select", "bool", "0", "Select this ribbon page when adding.", false, 0, 0 },
+        { "var_name", "string", "rbnPanel", "", false, 0, 0 },
+        { "label", "string_escapes", "MyRibbonPanel", "", false, 0, 0 },
+        { "bitmap", "image", "", "wxRibbonPanel bitmap.", false, 0, 0 },
+        { "style", "bitlist", "wxRIBBON_PANEL_DEFAULT_STYLE", "", false, 281, 6 },
+        { "var_name", "string", "rbnBtnBar", "", false, 0, 0 },
+        { "label", "string_escapes", "MyRibbonButton", "", false, 0, 0 },
+        { "bitmap", "image", "", "ribbonButton bitmap.", false, 0, 0 },
+        { "help", "string_escapes", "", "ribbonButton", false, 0, 0 },
+        { "kind", "option", "wxRIBBON_BUTTON_NORMAL", "", false, 287, 4 },
+        { "var_name", "string", "rbnToolBar", "", false, 0, 0 },
+        { "min_rows", "int", "1", "Minimum number of rows.", false, 0, 0 },
+        { "max_rows", "int", "-1", "Maximum number of rows. -1 defaults to minimum number of rows.", false, 0, 0 },
+        { "id", "id", "", "The identifier of the tool (used for event callbacks). When generating Python code, a non wx.Widgets id will be global unless prefixed with self.", false, 0, 0 },
+        { "bitmap", "image", "", "ribbonTool bitmap.", false, 0, 0 },
+        { "help", "string_escapes", "", "ribbonTool", false, 0, 0 },
+        { "kind", "option", "wxRIBBON_BUTTON_NORMAL", "", false, 291, 4 },
+        { "var_name", "string", "rbnGallery", "", false, 0, 0 },
+        { "gallery_size", "wxSize", "", "Specifies the common size of every image in the gallery. Images that are not this size will be scaled to match the common size.", false, 0, 0 },
+        { "bitmap", "image", "", "The bitmap to display for the item. Note that all items must have equally sized bitmaps. ", false, 0, 0 },
+        { "var_name", "string", "m_comboBox", "", false, 0, 0 },
+        { "hint", "string_escapes", "", "Sets a hint to be shown when the text field is empty and does not have the focus.", false, 0, 0 },
+        { "contents", "stringlist", "", "Contents of the Combo Box", false, 0, 0 },
+        { "selection_string", "string_escapes", "", "Selects the item with the specified string in the control. Note that this is case-insensitive, i.e. the string is compared with all the elements of the control case-insensitively and the first matching entry is selected, even if it doesn't have exactly the same case as this string and there is an exact match afterwards.", false, 0, 0 },
+        { "selection_int", "int", "-1", "Sets the selection to the value unless it is -1. Ignored if the selection_string property contains a value.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 295, 5 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_bmpComboBox", "", false, 0, 0 },
+        { "hint", "string_escapes", "", "Sets a hint to be shown when the text field is empty and does not have the focus.", false, 0, 0 },
+        { "contents", "stringlist", "", "Contents of the Combo Box", false, 0, 0 },
+        { "selection_string", "string_escapes", "", "Selects the item with the specified string in the control. Note that this is case-insensitive, i.e. the string is compared with all the elements of the control case-insensitively and the first matching entry is selected, even if it doesn't have exactly the same case as this string and there is an exact match afterwards.", false, 0, 0 },
+        { "selection_int", "int", "-1", "Sets the selection to the value unless it is -1. Ignored if the selection_string property contains a value.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 300, 3 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_choice", "", false, 0, 0 },
+        { "contents", "stringlist", "", "Array of strings used to initialize the choice control.", false, 0, 0 },
+        { "selection_string", "string_escapes", "", "Selects the item with the specified string in the control. Note that this is case-insensitive, i.e. the string is compared with all the elements of the control case-insensitively and the first matching entry is selected, even if it doesn't have exactly the same case as this string and there is an exact match afterwards.", false, 0, 0 },
+        { "selection_int", "int", "-1", "Sets the selection to the value unless it is -1. Ignored if the selection_string property contains a value.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 303, 1 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_listbox", "", false, 0, 0 },
+        { "contents", "stringlist", "", "Contents of the List Box.", false, 0, 0 },
+        { "selection_string", "string_escapes", "", "Selects the item with the specified string in the control. Note that this is case-insensitive, i.e. the string is compared with all the elements of the control case-insensitively and the first matching entry is selected, even if it doesn't have exactly the same case as this string and there is an exact match afterwards.", false, 0, 0 },
+        { "selection_int", "int", "-1", "Sets the selection to the value unless it is -1. Ignored if the selection_string property contains a value.", false, 0, 0 },
+        { "type", "option", "wxLB_SINGLE", "", false, 304, 3 },
+        { "style", "bitlist", "", "", false, 307, 5 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_html_listbox", "", false, 0, 0 },
+        { "contents", "stringlist", "", "Contents of the HTML list box.", false, 0, 0 },
+        { "selection_string", "string_escapes", "", "Selects the item with the specified string in the control. Note that this is case-insensitive, i.e. the string is compared with all the elements of the control case-insensitively and the first matching entry is selected, even if it doesn't have exactly the same case as this string and there is an exact match afterwards.", false, 0, 0 },
+        { "selection_int", "int", "-1", "Sets the selection to the value unless it is -1. Ignored if the selection_string property contains a value.", false, 0, 0 },
+        { "style", "bitlist", " wxHLB_DEFAULT_STYLE ", "", false, 312, 2 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_checkList", "", false, 0, 0 },
+        { "selection_string", "string_escapes", "", "Selects the item with the specified string in the control. Note that this is case-insensitive, i.e. the string is compared with all the elements of the control case-insensitively and the first matching entry is selected, even if it doesn't have exactly the same case as this string and there is an exact match afterwards.", false, 0, 0 },
+        { "selection_int", "int", "-1", "Sets the selection to the value unless it is -1. Ignored if the selection_string property contains a value.", false, 0, 0 },
+        { "contents", "checklist_item", "", "List of default values and their checked state.", false, 0, 0 },
+        { "type", "option", "wxLB_SINGLE", "", false, 314, 3 },
+        { "style", "bitlist", "", "", false, 317, 5 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_radioBox", "", false, 0, 0 },
+        { "label", "string_escapes", "My Radio Box", "", false, 0, 0 },
+        { "contents", "stringlist", "\"Radio Button \"", "Contents of the Radio Box. On Windows, the last character may be clipped unless you include a trailing space.", false, 0, 0 },
+        { "selection", "uint", "0", "Zero-based position of the selected button.", false, 0, 0 },
+        { "majorDimension", "uint", "0", "Specifies the maximum number of rows (if style contains wxRA_SPECIFY_ROWS) or columns (if style contains wxRA_SPECIFY_COLS) for a two-dimensional radiobox. A value of zero will use as many rows or columns as there are radio buttons.", false, 0, 0 },
+        { "style", "option", " columns ", "", false, 322, 2 },
+        { "var_name", "string", "m_static_box", "", false, 0, 0 },
+        { "label", "string_escapes", "label", "", false, 0, 0 },
+        { "var_name", "string", "m_checkBox", "", false, 0, 0 },
+        { "label", "string_escapes", "My Checkbox", "", false, 0, 0 },
+        { "checked", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 324, 1 },
+        { "var_name", "string", "m_checkBox", "", false, 0, 0 },
+        { "label", "string_escapes", "My Checkbox", "", false, 0, 0 },
+        { "initial_state", "option", "wxCHK_UNCHECKED", "", false, 325, 3 },
+        { "style", "bitlist", "", "", false, 328, 2 },
+        { "var_name", "string", "m_radioBtn", "", false, 0, 0 },
+        { "label", "string_escapes", "My RadioBtn", "", false, 0, 0 },
+        { "checked", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 330, 3 },
+        { "var_name", "string", "m_btn", "", false, 0, 0 },
+        { "label", "string_escapes", "MyButton", "Leave this property blank if you are using a stock id. A stock id will automatically display a label matching the id.", false, 0, 0 },
+        { "markup", "bool", "0", "This can be used to apply fonts or colours to different parts of the label.", false, 0, 0 },
+        { "default", "bool", "0", "Set the button to be the default item in its top-level window", false, 0, 0 },
+        { "auth_needed", "bool", "0", "Sets whether an authentication needed symbol should be displayed on the button. This method doesn't do anything if the platform is not Windows Vista or newer.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 333, 7 },
+        { "var_name", "string", "close_btn", "", false, 0, 0 },
+        { "var_name", "string", "m_btn", "", false, 0, 0 },
+        { "main_label", "string_edit", "MyButton", "First line of text on the button, typically the label of an action that will be made when the button is pressed.", false, 0, 0 },
+        { "note", "string_edit_escapes", "my note", "Second line of text describing the action performed when the button is pressed.", false, 0, 0 },
+        { "default", "bool", "0", "If true, this will be the default button (it will be depressed when the return key is pressed)", false, 0, 0 },
+        { "auth_needed", "bool", "0", "Sets whether an authentication needed symbol should be displayed on the button. This method doesn't do anything if the platform is not Windows Vista or newer.", false, 0, 0 },
+        { "var_name", "string", "m_spinCtrl", "", false, 0, 0 },
+        { "min", "int", "0", "Minimal value.", false, 0, 0 },
+        { "max", "int", "100", "Maximal value.", false, 0, 0 },
+        { "initial", "int", "0", "Initial value.", false, 0, 0 },
+        { "inc", "int", "1", "Increment value.", false, 0, 0 },
+        { "style", "bitlist", "wxSP_ARROW_KEYS", "", false, 340, 6 },
+        { "hexadecimal", "bool", "0", "Use hexadecimal as the base to display and enter numbers.", false, 0, 0 },
+        { "var_name", "string", "m_spinCtrlDouble", "", false, 0, 0 },
+        { "value", "string_escapes", "", "", false, 0, 0 },
+        { "min", "float", "0", "Minimal value.", false, 0, 0 },
+        { "max", "float", "100", "Maximal value.", false, 0, 0 },
+        { "initial", "float", "0", "Initial value.", false, 0, 0 },
+        { "inc", "float", "1", "Increment value.", false, 0, 0 },
+        { "digits", "uint", "0", "The number of digits in the display.", false, 0, 0 },
+        { "style", "bitlist", "wxSP_ARROW_KEYS", "", false, 346, 6 },
+        { "var_name", "string", "m_spinBtn", "", false, 0, 0 },
+        { "min", "int", "0", "Minimal value.", false, 0, 0 },
+        { "max", "int", "10", "Maximal value.", false, 0, 0 },
+        { "initial", "int", "0", "Initial value.", false, 0, 0 },
+        { "inc", "int", "1", "Increment value.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 352, 4 },
+        { "var_name", "string", "m_toggleBtn", "", false, 0, 0 },
+        { "label", "string_escapes", "MyToggleButton", "", false, 0, 0 },
+        { "markup", "bool", "0", "This can be used to apply fonts or colours to different parts of the label.", false, 0, 0 },
+        { "pressed", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 356, 7 },
+        { "var_name", "string", "m_bmp_toggle_btn", "", false, 0, 0 },
+        { "pressed", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 363, 2 },
+        { "var_name", "string", "m_ctx_help_btn", "", false, 0, 0 },
+        { "var_name", "string", "panel", "", false, 0, 0 },
+        { "var_name", "string", "m_splitter", "", false, 0, 0 },
+        { "splitmode", "option", " wxSPLIT_VERTICAL ", "", false, 365, 2 },
+        { "sashpos", "int", "0", "The initial sash position.", false, 0, 0 },
+        { "sashsize", "int", "-1", "Overrides platform metrics if greater than -1", false, 0, 0 },
+        { "sashgravity", "float", "0.0", "Gravity determines how much the left or top pane will grow while resizing.", false, 0, 0 },
+        { "min_pane_size", "uint", "150", "Minimum size for the panes.", false, 0, 0 },
+        { "persist_name", "string", "", "If a name is specified, wxPersistenceManager will be used to save/restore the sash position.", false, 0, 0 },
+        { "style", "bitlist", " wxSP_3D ", "", false, 367, 10 },
+        { "var_name", "string", "m_scroll_canvas", "", false, 0, 0 },
+        { "scroll_rate_x", "uint", "5", "Set the horizontal scrolling increment.", false, 0, 0 },
+        { "scroll_rate_y", "uint", "5", "Set the vertical scrolling increment.", false, 0, 0 },
+        { "var_name", "string", "m_scroll_panel", "", false, 0, 0 },
+        { "scroll_rate_x", "uint", "5", "Set the horizontal scrolling increment.", false, 0, 0 },
+        { "scroll_rate_y", "uint", "5", "Set the vertical scrolling increment.", false, 0, 0 },
+        { "var_name", "string", "m_collapsible_pane", "", false, 0, 0 },
+        { "label", "string_escapes", "collapsible", "", false, 0, 0 },
+        { "collapsed", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", "wxCP_DEFAULT_STYLE", "", false, 377, 2 },
+        { "var_name", "string", "m_choicebook", "", false, 0, 0 },
+        { "persist_name", "string", "", "If a name is specified, wxPersistenceManager will be used to save/restore the currently selected page.", false, 0, 0 },
+        { "style", "option", " wxCHB_DEFAULT ", "", false, 379, 5 },
+        { "var_name", "string", "m_listbook", "", false, 0, 0 },
+        { "display_images", "bool", "1", "If true, will display an image on the tab in addition to any text.", false, 0, 0 },
+        { "persist_name", "string", "", "If a name is specified, wxPersistenceManager will be used to save/restore the currently selected page.", false, 0, 0 },
+        { "style", "option", " wxBK_DEFAULT ", "", false, 384, 5 },
+        { "var_name", "string", "m_notebook", "", false, 0, 0 },
+        { "display_images", "bool", "1", "If true, will display an image on the tab in addition to any text. The image to use for each tab is specified in the individual pages.", false, 0, 0 },
+        { "persist_name", "string", "", "If a name is specified, wxPersistenceManager will be used to save/restore the currently selected page.", false, 0, 0 },
+        { "art_provider", "option", "", "", false, 389, 3 },
+        { "selected_tab_font", "wxFont", "", "The font to use for the selected tab.", false, 0, 0 },
+        { "non_selected_tab_font", "wxFont", "", "The font to use for the non-selected tabs.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 392, 12 },
+        { "var_name", "string", "m_notebook", "", false, 0, 0 },
+        { "display_images", "bool", "1", "If true, will display an image on the tab in addition to any text.", false, 0, 0 },
+        { "persist_name", "string", "", "If a name is specified, wxPersistenceManager will be used to save/restore the currently selected page.", false, 0, 0 },
+        { "tab_position", "option", "wxBK_DEFAULT", "", false, 404, 5 },
+        { "style", "bitlist", "", "", false, 409, 3 },
+        { "var_name", "string", "m_toolbook", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 412, 1 },
+        { "var_name", "string", "m_treebook", "", false, 0, 0 },
+        { "display_images", "bool", "1", "If true, will display an image on the tab in addition to any text.", false, 0, 0 },
+        { "persist_name", "string", "", "If a name is specified, wxPersistenceManager will be used to save/restore the currently selected page and the expand/collapse state of sub pages.", false, 0, 0 },
+        { "tab_position", "option", " wxBK_DEFAULT ", "", false, 413, 5 },
+        { "style", "bitlist", "", "", false, 418, 1 },
+        { "var_name", "string", "m_simplebook", "", false, 0, 0 },
+        { "show_effect", "option", " no effects ", "Set the effects to use when showing a page.", false, 419, 11 },
+        { "hide_effect", "option", " no effects ", "Set the effects to use when hiding a page. ", false, 430, 11 },
+        { "duration", "int", "", "Set the duration of the animation (in milliseconds) used when showing or hiding a page.", false, 0, 0 },
+        { "var_name", "string", "page", "", false, 0, 0 },
+        { "label", "string_escapes", "page", "", false, 0, 0 },
+        { "select", "bool", "0", "Select Page when Adding", false, 0, 0 },
+        { "bitmap", "image", "", "Page Image (not all books use this)", false, 0, 0 },
+        { "label", "string_escapes", "page", "", false, 0, 0 },
+        { "select", "bool", "0", "Select Page when Adding", false, 0, 0 },
+        { "bitmap", "image", "", "Page Image (optional)", false, 0, 0 },
+        { "label", "string_escapes", "", "", false, 0, 0 },
+        { "bitmap", "image", "", "", false, 0, 0 },
+        { "select", "bool", "", "", false, 0, 0 },
+        { "var_name", "string", "m_listview", "", false, 0, 0 },
+        { "column_labels", "stringlist_semi", "", "Labels to use as column headers. Only used if the mode is set to wxLC_REPORT.", false, 0, 0 },
+        { "contents", "stringlist", "", "Array of strings used to initialize the list view. Each string is a row, with text for individual columns separated by a ';' character. Only valid if column_labels has been initialized and the mode is set to wxLC_REPORT.", false, 0, 0 },
+        { "mode", "option", " wxLC_REPORT ", "", false, 441, 4 },
+        { "style", "bitlist", "", "", false, 445, 11 },
+        { "var_name", "string", "m_edit_listbox", "", false, 0, 0 },
+        { "label", "string_escapes", "My Editable ListBox", "The text shown just before the list control.", false, 0, 0 },
+        { "contents", "stringlist", "", "Array of strings used to initialize the list box.", false, 0, 0 },
+        { "style", "bitlist", "wxEL_ALLOW_NEW|wxEL_ALLOW_EDIT|wxEL_ALLOW_DELETE", "", false, 456, 4 },
+        { "var_name", "string", "m_dataViewCtrl", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 460, 7 },
+        { "var_name", "string", "m_dataViewTreeCtrl", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 467, 7 },
+        { "var_name", "string", "m_dataViewListCtrl", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 474, 7 },
+        { "var_name", "string", "m_dataViewColumn", "", false, 0, 0 },
+        { "label", "string_escapes", "Name", "", false, 0, 0 },
+        { "model_column", "uint", "0", "", false, 0, 0 },
+        { "type", "option", " Text ", "", false, 481, 6 },
+        { "mode", "option", "wxDATAVIEW_CELL_INERT", "", false, 487, 3 },
+        { "width", "int", "-1", "", false, 0, 0 },
+        { "align", "bitlist", " wxALIGN_LEFT ", "", false, 490, 7 },
+        { "flags", "bitlist", " wxDATAVIEW_COL_RESIZABLE ", "", false, 497, 4 },
+        { "ellipsize", "option", "", "", false, 501, 5 },
+        { "var_name", "string", "m_dataViewListColumn", "", false, 0, 0 },
+        { "label", "string_escapes", "Name", "", false, 0, 0 },
+        { "type", "option", " Text ", "", false, 506, 4 },
+        { "mode", "option", "wxDATAVIEW_CELL_INERT", "", false, 510, 3 },
+        { "width", "int", "-1", "", false, 0, 0 },
+        { "align", "bitlist", " wxALIGN_LEFT ", "", false, 513, 7 },
+        { "flags", "bitlist", " wxDATAVIEW_COL_RESIZABLE ", "", false, 520, 4 },
+        { "ellipsize", "option", "", "", false, 524, 5 },
+        { "var_name", "string", "m_grid", "", false, 0, 0 },
+        { "rows", "uint", "5", "Number of Rows.", false, 0, 0 },
+        { "cols", "uint", "5", "Number of Columns.", false, 0, 0 },
+        { "editing", "bool", "1", "Allow editing grid contents.", false, 0, 0 },
+        { "grid_lines", "bool", "1", "Show grid lines.", false, 0, 0 },
+        { "grid_line_color", "wxColour", "", "The colour used to draw grid lines.", false, 0, 0 },
+        { "drag_grid_size", "bool", "0", "Allow sizing rows and columns by dragging gridlines.", false, 0, 0 },
+        { "margin_width", "uint", "0", "Sets the extra width to display arouned the grid.", false, 0, 0 },
+        { "margin_height", "uint", "0", "Sets the extra height to displaye around the grid.", false, 0, 0 },
+        { "selection_mode", "option", "wxGridSelectCells", "", false, 529, 5 },
+        { "native_col_header", "bool", "0", "If true, a wxHeaderCtrl is used instead to display the column labels instead of drawing them in wxGrid code itself.", false, 0, 0 },
+        { "native_col_labels", "bool", "", "If true, column labels use a native look by calling wxRendererNative::DrawHeaderButton() internally. This option is ignored if native_col_header is set to true.", false, 0, 0 },
+        { "label_bg", "wxColour", "", "Background color for row and column labels.", false, 0, 0 },
+        { "label_font", "wxFont", "", "Font for row and column labels.", false, 0, 0 },
+        { "label_text", "wxColour", "", "Colour for row and column label text.", false, 0, 0 },
+        { "cell_bg", "wxColour", "", "Default cell background color.", false, 0, 0 },
+        { "cell_fit", "option", " overflow ", "Specifies the default behaviour of the cell contents if it doesn't fit into the available space.", false, 534, 3 },
+        { "cell_font", "wxFont", "", "Default cell font.", false, 0, 0 },
+        { "cell_text", "wxColour", "", "Default cell text color.", false, 0, 0 },
+        { "cell_horiz_alignment", "option", " wxALIGN_LEFT ", "Default horizontal alignment of cell values.", false, 537, 3 },
+        { "cell_vert_alignment", "option", " wxALIGN_TOP ", "Default vertical alignment of cell values.", false, 540, 3 },
+        { "col_label_values", "stringlist_semi", "", "List of column labels.", false, 0, 0 },
+        { "column_sizes", "stringlist_semi", "", "List of column sizes.", false, 0, 0 },
+        { "default_col_size", "int", "-1", "Sets the default width for columns in the grid. Ignored unless a positive value is set.", false, 0, 0 },
+        { "autosize_cols", "bool", "0", "Automatically sizes all columns to fit their contents. Ignored if default_col_size is set to a positive value", false, 0, 0 },
+        { "drag_col_move", "bool", "0", "Allow moving columns by dragging.", false, 0, 0 },
+        { "drag_col_size", "bool", "1", "Allow sizing columns by dragging.", false, 0, 0 },
+        { "col_label_size", "int", "-1", "Height of column labels. If height equals -1 then height is calculated automatically so that no label is truncated.", false, 0, 0 },
+        { "col_label_horiz_alignment", "option", " wxALIGN_CENTER ", "Horizontal alignment of column label text.", false, 543, 3 },
+        { "col_label_vert_alignment", "option", " wxALIGN_CENTER ", "Vertical alignment of column label text.", false, 546, 3 },
+        { "row_label_values", "stringlist_semi", "", "List of row labels.", false, 0, 0 },
+        { "row_sizes", "stringlist_semi", "", "List of row sizes.", false, 0, 0 },
+        { "default_row_size", "int", "-1", "Sets the default height for rows in the grid. Ignored unless a positive value is set.", false, 0, 0 },
+        { "autosize_rows", "bool", "0", "Automatically sizes all rows to fit their contents. Ignored if default_row_size is set to a positive value", false, 0, 0 },
+        { "drag_row_size", "bool", "1", "Allow sizing rows by dragging with the mouse.", false, 0, 0 },
+        { "row_label_size", "int", "-1", "Width of row labels. If width equals -1 then width is calculated automatically so that no label is truncated.", false, 0, 0 },
+        { "row_label_horiz_alignment", "option", " wxALIGN_CENTER ", "Horizontal alignment of row label text.", false, 549, 3 },
+        { "row_label_vert_alignment", "option", " wxALIGN_CENTER ", "Vertical alignment of row label text.", false, 552, 3 },
+        { "tab_behaviour", "option", " Tab_Stop ", "", false, 555, 3 },
+        { "var_name", "string", "m_propertyGrid", "", false, 0, 0 },
+        { "bitmap", "image", "", "This is the bitmap shown in the default state, it must be always valid while all the other bitmaps are optional and don't have to be set.", false, 0, 0 },
+        { "style", "bitlist", "wxPG_DEFAULT_STYLE", "", false, 558, 12 },
+        { "extra_style", "bitlist", "", "", false, 570, 7 },
+        { "var_name", "string", "m_propertyGridManager", "", false, 0, 0 },
+        { "show_header", "bool", "0", "Show or hide the property grid header control.", false, 0, 0 },
+        { "style", "bitlist", "wxPGMAN_DEFAULT_STYLE", "", false, 577, 16 },
+        { "extra_style", "bitlist", " wxPG_EX_MODE_BUTTONS ", "", false, 593, 12 },
+        { "var_name", "string", "m_propertyGridPage", "Instance name.", false, 0, 0 },
+        { "label", "string_escapes", "", "Label shown as a tooltip of the manager's tool button.", false, 0, 0 },
+        { "bitmap", "image", "", "Bitmap shown in the property manager's header.", false, 0, 0 },
+        { "var_name", "string", "m_propertyGridItem", "Instance name and an internal name of the property item.", false, 0, 0 },
+        { "label", "string_escapes", "Name", "Label shown in parent property grid/page.", false, 0, 0 },
+        { "type", "option", "String", "Type of the property item.", false, 605, 20 },
+        { "help", "string_escapes", "", "Text to display in help description box.", false, 0, 0 },
+        { "var_name", "string", "m_propertyGridItem", "Instance name and an internal name of the property category.", false, 0, 0 },
+        { "label", "string_escapes", "CategoryName", "Label shown in parent property grid or page.", false, 0, 0 },
+        { "help", "string_escapes", "", "Text to display in help description box.", false, 0, 0 },
+        { "var_name", "string", "m_treeCtrl", "", false, 0, 0 },
+        { "style", "bitlist", "wxTR_DEFAULT_STYLE", "", false, 625, 13 },
+        { "var_name", "string", "m_treeListCtrl", "", false, 0, 0 },
+        { "style", "bitlist", " wxTL_DEFAULT_STYLE ", "", false, 638, 7 },
+        { "label", "string_escapes", "Column", "The column label.", false, 0, 0 },
+        { "width", "int", "-2", "The width of the column in pixels or the special -2 value indicating that the column should adjust to its contents. Notice that the first column is special and will be always resized to fill all the space not taken by the other columns, i.e. the width specified here is ignored for it.", false, 0, 0 },
+        { "alignment", "option", " wxALIGN_LEFT ", "Alignment of both the column header and its items.", false, 645, 3 },
+        { "flags", "bitlist", " wxCOL_RESIZABLE ", "", false, 648, 4 },
+        { "class_name", "string", "MyFrameBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the frame's title bar.", false, 0, 0 },
+        { "persist", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", " wxDEFAULT_FRAME_STYLE ", "", false, 652, 15 },
+        { "extra_style", "bitlist", "", "", false, 667, 2 },
+        { "center", "option", " wxBOTH ", "Centers the window on the desktop in the chosen direction.", false, 669, 4 },
+        { "icon", "image", "", "Specifies the image to display in the title bar of the frame.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Frame's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyDocParentBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the frame's title bar.", false, 0, 0 },
+        { "persist", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", " wxDEFAULT_FRAME_STYLE ", "", false, 673, 15 },
+        { "extra_style", "bitlist", "", "", false, 688, 2 },
+        { "center", "option", " wxBOTH ", "Centers the window on the desktop in the chosen direction.", false, 690, 4 },
+        { "icon", "image", "", "Specifies the image to display in the title bar of the frame.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Frame's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyDocChildFrameBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the frame's title bar.", false, 0, 0 },
+        { "persist", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", " wxDEFAULT_FRAME_STYLE ", "", false, 694, 15 },
+        { "extra_style", "bitlist", "", "", false, 709, 2 },
+        { "center", "option", " wxBOTH ", "Centers the window on the desktop in the chosen direction.", false, 711, 4 },
+        { "icon", "image", "", "Specifies the image to display in the title bar of the frame.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Frame's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyDocMDIParentBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the frame's title bar.", false, 0, 0 },
+        { "persist", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", " wxDEFAULT_FRAME_STYLE ", "", false, 715, 15 },
+        { "extra_style", "bitlist", "", "", false, 730, 2 },
+        { "center", "option", " wxBOTH ", "Centers the window on the desktop in the chosen direction.", false, 732, 4 },
+        { "icon", "image", "", "Specifies the image to display in the title bar of the frame.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Frame's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyDocMDIChildFrameBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the frame's title bar.", false, 0, 0 },
+        { "persist", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", " wxDEFAULT_FRAME_STYLE ", "", false, 736, 15 },
+        { "extra_style", "bitlist", "", "", false, 751, 2 },
+        { "center", "option", " wxBOTH ", "Centers the window on the desktop in the chosen direction.", false, 753, 4 },
+        { "icon", "image", "", "Specifies the image to display in the title bar of the frame.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Frame's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyAuiMDIParentBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the frame's title bar.", false, 0, 0 },
+        { "persist", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", " wxDEFAULT_FRAME_STYLE ", "", false, 757, 15 },
+        { "extra_style", "bitlist", "", "", false, 772, 2 },
+        { "center", "option", " wxBOTH ", "Centers the window on the desktop in the chosen direction.", false, 774, 4 },
+        { "icon", "image", "", "Specifies the image to display in the title bar of the frame.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Frame's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyAuiMdiChildFrameBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the frame's title bar.", false, 0, 0 },
+        { "persist", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", " wxDEFAULT_FRAME_STYLE ", "", false, 778, 15 },
+        { "extra_style", "bitlist", "", "", false, 793, 2 },
+        { "center", "option", " wxBOTH ", "Centers the window on the desktop in the chosen direction.", false, 795, 4 },
+        { "icon", "image", "", "Specifies the image to display in the title bar of the frame.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Frame's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyPopupBase", "The name of the base class.", false, 0, 0 },
+        { "border", "option", "wxBORDER_NONE", "Specifies the type of border to use for the window.", false, 799, 5 },
+        { "style", "bitlist", "", "", false, 804, 1 },
+        { "variant", "option", "normal", "Chooses a different variant of the window display to use (calls SetWindowVariant).", false, 805, 4 },
+        { "size", "wxSize", "", "Specifies the size of the window. A -1 indicates that the value should be calculated automatically via a top level sizer.", false, 0, 0 },
+        { "minimum_size", "wxSize", "", "Sets the minimum size of the window. Any positive value will override the automatic size calculation that would normally be done.", false, 0, 0 },
+        { "maximum_size", "wxSize", "", "Sets the maximum allowable size of the window (limits automatic sizing).", false, 0, 0 },
+        { "foreground_colour", "wxColour", "", "Sets the foreground colour of the window.", false, 0, 0 },
+        { "background_colour", "wxColour", "", "Sets the background colour of the window.", false, 0, 0 },
+        { "font", "wxFont", "", "Sets the font for this window. This should not be used for a parent window if you don't want its font to be inherited by its children", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Window's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyPopupTransientBase", "The name of the base class.", false, 0, 0 },
+        { "border", "option", "wxBORDER_NONE", "Specifies the type of border to use for the window.", false, 809, 5 },
+        { "style", "bitlist", "", "", false, 814, 1 },
+        { "variant", "option", "normal", "Chooses a different variant of the window display to use (calls SetWindowVariant).", false, 815, 4 },
+        { "size", "wxSize", "", "Specifies the size of the window. A -1 indicates that the value should be calculated automatically via a top level sizer.", false, 0, 0 },
+        { "minimum_size", "wxSize", "", "Sets the minimum size of the window. Any positive value will override the automatic size calculation that would normally be done.", false, 0, 0 },
+        { "maximum_size", "wxSize", "", "Sets the maximum allowable size of the window (limits automatic sizing).", false, 0, 0 },
+        { "foreground_colour", "wxColour", "", "Sets the foreground colour of the window.", false, 0, 0 },
+        { "background_colour", "wxColour", "", "Sets the background colour of the window.", false, 0, 0 },
+        { "font", "wxFont", "", "Sets the font for this window. This should not be used for a parent window if you don't want its font to be inherited by its children", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Window's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyRibbonBarBase", "The name of the base class.", false, 0, 0 },
+        { "theme", "option", " Default ", "Select the RibbonBar theme.", false, 819, 3 },
+        { "style", "bitlist", "wxRIBBON_BAR_DEFAULT_STYLE", "", false, 822, 10 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the RibbonBar's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyDialogBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the dialog's title bar.", false, 0, 0 },
+        { "persist", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", "wxDEFAULT_DIALOG_STYLE", "", false, 832, 11 },
+        { "extra_style", "bitlist", "", "", false, 843, 6 },
+        { "center", "option", " wxBOTH ", "Centers the dialog box on the display in the chosen direction.", false, 849, 4 },
+        { "icon", "image", "", "Specifies the image to display in the title bar of the dialog.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Dialog's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyPanelBase", "The name of the base class.", false, 0, 0 },
+        { "mockup_size", "wxSize", "200,\n            200", "This is the minimum size to display the panel in the Mockup Panel. It does not affect the actual size of the panel in your compiled code. Note that for a wxRibbonBar this needs to be as wide as the widest ribbon panel or you will see a question mark for the wxRibbonPage.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Panel's generated code.", false, 0, 0 },
+        { "id", "id", "wxID_ANY", "The identifier for the panel.", false, 0, 0 },
+        { "variant", "option", "normal", "Chooses a different variant of the window display to use (calls SetWindowVariant).", false, 853, 4 },
+        { "pos", "wxPoint", "", "Window position. The default is (-1, -1) which indicates that wxWidgets should generate a default position for the window.", false, 0, 0 },
+        { "size", "wxSize", "", "Sets the panel size. The default is (-1, -1) which indicates that wxWidgets should generate a default size for the panel, large enough to display all visible elements.", false, 0, 0 },
+        { "minimum_size", "wxSize", "", "Sets the minimum size of the panel. The default is (-1, -1) which indicates wxWidgets should calculate a minimum size large enough to display all visible elements.", false, 0, 0 },
+        { "maximum_size", "wxSize", "", "Sets the maximum size of the panel.", false, 0, 0 },
+        { "window_style", "bitlist", "wxTAB_TRAVERSAL", "", false, 857, 7 },
+        { "window_extra_style", "bitlist", "", "", false, 864, 4 },
+        { "disabled", "bool", "0", "Disable the window for user input. Note that when a parent window is disabled, all of its children are disabled as well and they are reenabled again when the parent is.", false, 0, 0 },
+        { "hidden", "bool", "0", "Shows or hides the window.", false, 0, 0 },
+        { "background_colour", "wxColour", "", "Sets the background colour of the window. Use \"Window\" to let wxWidgets choose the color, otherwise specify one of the system colors in the list.", false, 0, 0 },
+        { "font", "wxFont", "", "Sets the font for the panel. This should not be used if you don't want the font to be inherited by its children.", false, 0, 0 },
+        { "window_name", "string_escapes", "", "", false, 0, 0 },
+        { "subclass", "string", "", "If you have derived a class from wxPanel and you want to use your derived class, then specify that class name here. You will need to add the header file for your class to the base_hdr_includes property.", false, 0, 0 },
+        { "class_name", "string", "MyPropSheetDlgBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the PropertySheet's title bar.", false, 0, 0 },
+        { "book_type", "option", "wxPROPSHEET_NOTEBOOK", "The type of book to use.", false, 868, 5 },
+        { "shrink_to_fit", "bool", "0", "Shrinks the dialog window to fit the currently selected page (common behaviour for property sheets on macOS).", false, 0, 0 },
+        { "buttons", "bitlist", "wxOK|wxCANCEL", "Specifies the standard buttons to create.", false, 873, 7 },
+        { "outer_border", "int", "-1", "Sets the border around the book control only. Size is in dialog units -- ignored if set to -1 (default).", false, 0, 0 },
+        { "inner_border", "int", "-1", "Sets the border around the whole dialog. Size is in dialog units -- ignored if set to -1 (default).", false, 0, 0 },
+        { "persist", "bool", "0", "", false, 0, 0 },
+        { "style", "bitlist", "wxDEFAULT_DIALOG_STYLE", "", false, 880, 10 },
+        { "extra_style", "bitlist", "", "", false, 890, 6 },
+        { "center", "option", "wxBOTH", "Centers the dialog box on the display in the chosen direction.", false, 896, 4 },
+        { "icon", "image", "", "Specifies the image to display in the title bar of the dialog.", false, 0, 0 },
+        { "cpp_conditional", "string_code_single", "", "In C++ code, any value in this property will be used to place a conditional (#if/#endif) block around the Dialog's generated code.", false, 0, 0 },
+        { "class_name", "string", "MyWizardBase", "The name of the base class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the Wizard's title bar.", false, 0, 0 },
+        { "style", "bitlist", "wxDEFAULT_DIALOG_STYLE", "", false, 900, 9 },
+        { "extra_style", "bitlist", "", "", false, 909, 1 },
+        { "border", "int", "", "Sets the width of the border around the page area.", false, 0, 0 },
+        { "center", "option", " wxBOTH ", "Centers the dialog box on the display in the chosen direction.", false, 910, 4 },
+        { "bitmap", "image", "", "Bitmap to display on the left side of the wizard (default: none).", false, 0, 0 },
+        { "bmp_placement", "bitlist", "", "", false, 914, 7 },
+        { "bmp_min_width", "int", "-1", "Sets the minimum width for the bitmap that will be constructed to contain the actual wizard or page bitmap if a non-zero bitmap placement flag has been set. If this is not set when using bitmap placement, the initial layout may be incorrect.", false, 0, 0 },
+        { "bmp_background_colour", "wxColour", "", "Sets the colour that should be used to fill the area not taken up by the wizard or page bitmap, if a non-zero bitmap placement flag has been set.", false, 0, 0 },
+        { "var_name", "string", "wizPage", "", false, 0, 0 },
+        { "bitmap", "image", "", "Page-specific bitmap (default: none).", false, 0, 0 },
+        { "class_name", "string", "DocViewAppBase", "The name of the class.", false, 0, 0 },
+        { "title", "string_escapes", "", "The text to display on the frame's title bar.", false, 0, 0 },
+        { "kind", "option", "", "", false, 921, 2 },
+        { "style", "bitlist", "wxDEFAULT_FRAME_STYLE", "", false, 923, 17 },
+        { "class_name", "string", "DocumentImageBase", "The name of the class.", false, 0, 0 },
+        { "mdi_class_name", "string", "DocViewAppBase", "The name of the DocViewApp class.", false, 0, 0 },
+        { "template_description", "string", "", "A short description of what the template is for. This string will be displayed in the file filter list of Windows file selectors. ", false, 0, 0 },
+        { "template_filter", "string", "", "An appropriate file filter such as *.txt", false, 0, 0 },
+        { "template_directory", "string", "", "The default directory to use for file selectors.", false, 0, 0 },
+        { "template_extension", "string", "", "The default file extension (such as txt).", false, 0, 0 },
+        { "template_doc_name", "string", "", "A name that should be unique for a given type of document, used for gathering a list of views relevant to a particular document.", false, 0, 0 },
+        { "template_view_name", "string", "", "A name that should be unique for a given view.", false, 0, 0 },
+        { "template_visible", "bool", "1", "The template may be displayed to the user in dialogs.", false, 0, 0 },
+        { "class_name", "string", "DocumentRichTextCtrl", "The name of the class.", false, 0, 0 },
+        { "mdi_class_name", "string", "DocViewAppBase", "The name of the DocViewApp class.", false, 0, 0 },
+        { "template_description", "string", "", "A short description of what the template is for. This string will be displayed in the file filter list of Windows file selectors. ", false, 0, 0 },
+        { "template_filter", "string", "", "An appropriate file filter such as *.txt", false, 0, 0 },
+        { "template_directory", "string", "", "The default directory to use for file selectors.", false, 0, 0 },
+        { "template_extension", "string", "", "The default file extension (such as txt).", false, 0, 0 },
+        { "template_doc_name", "string", "", "A name that should be unique for a given type of document, used for gathering a list of views relevant to a particular document.", false, 0, 0 },
+        { "template_view_name", "string", "", "A name that should be unique for a given view.", false, 0, 0 },
+        { "template_visible", "bool", "1", "The template may be displayed to the user in dialogs.", false, 0, 0 },
+        { "class_name", "string", "DocumentSplitterWindow", "The name of the class.", false, 0, 0 },
+        { "mdi_class_name", "string", "DocViewAppBase", "The name of the DocViewApp class.", false, 0, 0 },
+        { "template_description", "string", "", "A short description of what the template is for. This string will be displayed in the file filter list of Windows file selectors. ", false, 0, 0 },
+        { "template_filter", "string", "", "An appropriate file filter such as *.txt", false, 0, 0 },
+        { "template_directory", "string", "", "The default directory to use for file selectors.", false, 0, 0 },
+        { "template_extension", "string", "", "The default file extension (such as txt).", false, 0, 0 },
+        { "template_doc_name", "string", "", "A name that should be unique for a given type of document, used for gathering a list of views relevant to a particular document.", false, 0, 0 },
+        { "template_view_name", "string", "", "A name that should be unique for a given view.", false, 0, 0 },
+        { "template_visible", "bool", "1", "The template may be displayed to the user in dialogs.", false, 0, 0 },
+        { "class_name", "string", "DocumentStyledTextCtrl", "The name of the class.", false, 0, 0 },
+        { "mdi_class_name", "string", "DocViewAppBase", "The name of the DocViewApp class.", false, 0, 0 },
+        { "template_description", "string", "", "A short description of what the template is for. This string will be displayed in the file filter list of Windows file selectors. ", false, 0, 0 },
+        { "template_filter", "string", "", "An appropriate file filter such as *.txt", false, 0, 0 },
+        { "template_directory", "string", "", "The default directory to use for file selectors.", false, 0, 0 },
+        { "template_extension", "string", "", "The default file extension (such as txt).", false, 0, 0 },
+        { "template_doc_name", "string", "", "A name that should be unique for a given type of document, used for gathering a list of views relevant to a particular document.", false, 0, 0 },
+        { "template_view_name", "string", "", "A name that should be unique for a given view.", false, 0, 0 },
+        { "template_visible", "bool", "1", "The template may be displayed to the user in dialogs.", false, 0, 0 },
+        { "class_name", "string", "DocumentTextCtrlBase", "The name of the class.", false, 0, 0 },
+        { "mdi_class_name", "string", "DocViewAppBase", "The name of the DocViewApp class.", false, 0, 0 },
+        { "template_description", "string", "", "A short description of what the template is for. This string will be displayed in the file filter list of Windows file selectors. ", false, 0, 0 },
+        { "template_filter", "string", "", "An appropriate file filter such as *.txt", false, 0, 0 },
+        { "template_directory", "string", "", "The default directory to use for file selectors.", false, 0, 0 },
+        { "template_extension", "string", "", "The default file extension (such as txt).", false, 0, 0 },
+        { "template_doc_name", "string", "", "A name that should be unique for a given type of document, used for gathering a list of views relevant to a particular document.", false, 0, 0 },
+        { "template_view_name", "string", "", "A name that should be unique for a given view.", false, 0, 0 },
+        { "template_visible", "bool", "1", "The template may be displayed to the user in dialogs.", false, 0, 0 },
+        { "class_name", "string", "ViewImageBase", "The name of the class.", false, 0, 0 },
+        { "mdi_doc_name", "string", "", "The name of the Document class to view.", false, 0, 0 },
+        { "spellcheck", "bitlist", "", "", false, 940, 2 },
+        { "style", "bitlist", "", "", false, 942, 2 },
+        { "class_name", "string", "ViewRichTextCtrlBase", "The name of the class.", false, 0, 0 },
+        { "mdi_doc_name", "string", "", "The name of the Document class to view.", false, 0, 0 },
+        { "spellcheck", "bitlist", "", "", false, 944, 2 },
+        { "style", "bitlist", "", "", false, 946, 2 },
+        { "class_name", "string", "ViewSplitterBase", "The name of the class.", false, 0, 0 },
+        { "mdi_doc_name", "string", "", "The name of the Document class to view.", false, 0, 0 },
+        { "spellcheck", "bitlist", "", "", false, 948, 2 },
+        { "style", "bitlist", "", "", false, 950, 2 },
+        { "class_name", "string", "ViewStyledTextCtrlBase", "The name of the class.", false, 0, 0 },
+        { "mdi_doc_name", "string", "", "The name of the Document class to view.", false, 0, 0 },
+        { "spellcheck", "bitlist", "", "", false, 952, 2 },
+        { "style", "bitlist", "", "", false, 954, 2 },
+        { "class_name", "string", "ViewTextCtrlBase", "The name of the class.", false, 0, 0 },
+        { "mdi_doc_name", "string", "", "The name of the Document class to view.", false, 0, 0 },
+        { "spellcheck", "bitlist", "", "", false, 956, 2 },
+        { "style", "bitlist", "", "", false, 958, 2 },
+        { "var_name", "string", "m_filePicker", "", false, 0, 0 },
+        { "initial_path", "path", "", "", false, 0, 0 },
+        { "message", "string_escapes", "", "", false, 0, 0 },
+        { "wildcard", "string_escapes", "", "", false, 0, 0 },
+        { "style", "bitlist", "wxFLP_USE_TEXTCTRL|wxFLP_OPEN|wxFLP_FILE_MUST_EXIST", "", false, 960, 7 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_dirPicker", "", false, 0, 0 },
+        { "initial_path", "path", "", "", false, 0, 0 },
+        { "message", "string_escapes", "", "", false, 0, 0 },
+        { "style", "bitlist", "wxDIRP_DEFAULT_STYLE", "", false, 967, 5 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_fontPicker", "", false, 0, 0 },
+        { "initial_font", "wxFont", "", "", false, 0, 0 },
+        { "min_point_size", "uint", "0", "Sets the minimum point size value allowed for the user-chosen font", false, 0, 0 },
+        { "max_point_size", "uint", "100", "Sets the maximum point size value allowed for the user-chosen font. The default value is 100. Note that big fonts can require a lot of memory and CPU time both for creation and for rendering; thus, specially because the user has the option to specify the fontsize through a text control (see wxFNTP_USE_TEXTCTRL), it's a good idea to put a limit to the maximum font size when huge fonts do not make much sense.", false, 0, 0 },
+        { "style", "bitlist", "wxFNTP_FONTDESC_AS_LABEL|wxFNTP_USEFONT_FOR_LABEL", "", false, 972, 3 },
+        { "var_name", "string", "m_colourPicker", "", false, 0, 0 },
+        { "colour", "wxColour", "", "Sets the initial colour.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 975, 3 },
+        { "var_name", "string", "m_datePicker", "", false, 0, 0 },
+        { "style", "bitlist", "wxDP_DEFAULT|wxDP_SHOWCENTURY", "", false, 978, 5 },
+        { "null_text", "string", "", "If wxDP_ALLOWNONE style is set, this will set the string displayed when the control doesn't have any valid value. Currently this is only actually used under MSW, where it can be used to override the previous value which is still displayed by the control in this case, and ignored elsewhere.\\n\\nNotably, text can be empty to completely hide the date if no valid date is specified.", false, 0, 0 },
+        { "var_name", "string", "m_timePicker", "", false, 0, 0 },
+        { "style", "bitlist", " wxTP_DEFAULT ", "", false, 983, 1 },
+        { "code_preference", "option", "C++", "Specify the code you prefer to generate. This can affect default settings for variable names, various initial UI states, and the UI display in the Mockup panel.", false, 984, 9 },
+        { "generate_languages", "bitlist", "C++", "Specify the programming languages you might want to view or generate from this project. The code preference language above will always be available when this project is loaded.", false, 993, 9 },
+        { "art_directory", "path", "./", "The directory containing your images (png, ico, xpm, etc.).", false, 0, 0 },
+        { "dialog_units", "bool", "1", "When checked, dimensions will default to using dialog units. You can turn on or off dialog units for each individual dimension -- this just sets the default for new dimensions.", false, 0, 0 },
+        { "internationalize", "bool", "0", "Wrap strings in a _() macro.", false, 0, 0 },
+        { "help_provider", "option", "none", "The class of help provider to use for context-sensitive help.", false, 1002, 3 },
+        { "id_prefixes", "stringlist_semi", "", "Optional prefixes to apply before a custom id. These can be added in the ID Editor dialog.", false, 0, 0 },
+        { "id_suffixes", "stringlist_semi", "", "Optional suffixes to apply after a custom id. These can be added in the ID Editor dialog.", false, 0, 0 },
+        { "optional_comments", "bool", "0", "Add some explanatory comments to the generated code.", false, 0, 0 },
+        { "label", "string", "my_forms", "The name of the folder.", false, 0, 0 },
+        { "code_preference", "option", "C++", "Specify the code you prefer to generate. This can affect default settings for variable names, various initial UI states, and the UI display in the Mockup panel.", false, 1005, 9 },
+        { "label", "string", "my_forms", "The name of the folder.", false, 0, 0 },
+        { "base_file", "file", "my_images", "The C++ filename to store all the embedded images in.", false, 0, 0 },
+        { "python_file", "file", "images", "The Python filename to store all the embedded images in.", false, 0, 0 },
+        { "ruby_file", "file", "images", "The Ruby filename to store all the embedded images in.", false, 0, 0 },
+        { "add_externs", "bool", "0", "If checked, each image data array will be added to the header file as an extern.", false, 0, 0 },
+        { "auto_add", "bool", "0", "If checked, then whenever you add an image file to a control, it will automatically be added to the Images List.", false, 0, 0 },
+        { "bitmap", "image", "", "", false, 0, 0 },
+        { "var_name", "string", "m_timer", "", false, 0, 0 },
+        { "interval", "int", "1000", "Specifies the number of milliseconds between timer events.", false, 0, 0 },
+        { "auto_start", "bool", "0", "If checked, this will start start the timer in the parent class Create function.", false, 0, 0 },
+        { "one_shot", "bool", "0", "If checked, this will start a one shot timer (ignored if auto_start isn't checked).", false, 0, 0 },
+        { "id", "id", "wxID_ANY", "Specifies the timer's identifier.", false, 0, 0 },
+        { "output_file", "file", "wxue_data", "The C++ filename to store all the data strings in.", false, 0, 0 },
+        { "label", "string", "my_data_files", "The name of the folder.", false, 0, 0 },
+        { "var_name", "string", "my_data_string", "", false, 0, 0 },
+        { "data_file", "file", "", "", false, 0, 0 },
+        { "no_compression", "bool", "0", "If checked, the file will not be compressed. Check this when adding a binary file that has already been         compressed. If unchecked, the file will be compressed using zlib.", false, 0, 0 },
+        { "var_name", "string", "my_xml_string", "", false, 0, 0 },
+        { "data_file", "file", "", "", false, 0, 0 },
+        { "xml_condensed_format", "bool", "1", "If checked, the file is parsed and rewritten, removing all line breaks, indetation and comments. This will speed up parsing if the string is passed to an XML parser.", false, 0, 0 },
+        { "proportion", "uint", "0", "", false, 0, 0 },
+        { "row", "int", "0", "", false, 0, 0 },
+        { "column", "int", "0", "", false, 0, 0 },
+        { "rowspan", "int", "1", "", false, 0, 0 },
+        { "colspan", "int", "1", "", false, 0, 0 },
+        { "var_name", "string", "box_sizer", "", false, 0, 0 },
+        { "orientation", "option", " wxHORIZONTAL ", "", false, 1014, 2 },
+        { "hide_children", "bool", "0", "Hides all of the sizer's children.", false, 0, 0 },
+        { "var_name", "string", "box_sizer", "", false, 0, 0 },
+        { "orientation", "option", "0", "", false, 1016, 2 },
+        { "var_name", "string", "static_box", "", false, 0, 0 },
+        { "label", "string_escapes", "label", "", false, 0, 0 },
+        { "orientation", "option", " wxVERTICAL ", "", false, 1018, 2 },
+        { "id", "id", "wxID_ANY", "", false, 0, 0 },
+        { "disabled", "bool", "0", "Disable all of the sizer's children.", false, 0, 0 },
+        { "hidden", "bool", "0", "Hides the sizer and it's children.", false, 0, 0 },
+        { "hide_children", "bool", "0", "Hides all of the sizer's children.", true, 0, 0 },
+        { "var_name", "string", "static_box", "", false, 0, 0 },
+        { "checkbox_var_name", "string", "m_checkBox", "", false, 0, 0 },
+        { "label", "string_escapes", "label", "", false, 0, 0 },
+        { "checked", "bool", "1", "", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 1020, 1 },
+        { "orientation", "option", " wxVERTICAL ", "", false, 1021, 2 },
+        { "id", "id", "wxID_ANY", "", false, 0, 0 },
+        { "tooltip", "string_edit_escapes", "", "Attach a tooltip to the checkbox label.", false, 0, 0 },
+        { "disabled", "bool", "0", "Disable all of the sizer's children, but not the checkbox label.", false, 0, 0 },
+        { "hidden", "bool", "0", "Hides the sizer and it's children.", false, 0, 0 },
+        { "var_name", "string", "static_box", "", false, 0, 0 },
+        { "radiobtn_var_name", "string", "m_radioBtn", "", false, 0, 0 },
+        { "label", "string_escapes", "label", "", false, 0, 0 },
+        { "checked", "bool", "1", "", false, 0, 0 },
+        { "orientation", "option", " wxVERTICAL ", "", false, 1023, 2 },
+        { "id", "id", "wxID_ANY", "", false, 0, 0 },
+        { "tooltip", "string_edit_escapes", "", "Attach a tooltip to the radio button label.", false, 0, 0 },
+        { "disabled", "bool", "0", "Disable all of the sizer's children, but not the radio button label.", false, 0, 0 },
+        { "hidden", "bool", "0", "Hides the sizer and it's children.", false, 0, 0 },
+        { "var_name", "string", "wrap_sizer", "", false, 0, 0 },
+        { "orientation", "option", " wxHORIZONTAL ", "", false, 1025, 2 },
+        { "wrap_flags", "bitlist", "wxEXTEND_LAST_ON_EACH_LINE|wxREMOVE_LEADING_SPACES", "", false, 1027, 2 },
+        { "hide_children", "bool", "0", "Hides all of the sizer's children.", false, 0, 0 },
+        { "var_name", "string", "grid_sizer", "", false, 0, 0 },
+        { "rows", "uint", "0", "Number of Rows. If '0', wxWidgets will automatically calculate the number of rows required to hold the supplied items.", false, 0, 0 },
+        { "cols", "uint", "2", "Number of Columns. If row is not zero, cols can be set to '0' to have wxWidgets automtaically calculate the number of columns required.", false, 0, 0 },
+        { "vgap", "uint", "0", "The vertical gap (in pixels) between the cells in the sizer.", false, 0, 0 },
+        { "hgap", "uint", "0", "The horizontal gap (in pixels) between cells in the sizer.", false, 0, 0 },
+        { "hide_children", "bool", "0", "Hides all of the sizer's children.", false, 0, 0 },
+        { "var_name", "string", "flex_grid_sizer", "", false, 0, 0 },
+        { "rows", "uint", "0", "Number of Rows. '0' tells wxWidgets to calculate the number of rows required to hold the supplied items. If you choose to fix the row number, set the 'cols' figure to zero instead.", false, 0, 0 },
+        { "cols", "uint", "2", "Number of Columns", false, 0, 0 },
+        { "hide_children", "bool", "0", "Hides all of the sizer's children.", false, 0, 0 },
+        { "var_name", "string", "grid_bag_sizer", "", false, 0, 0 },
+        { "empty_cell_size", "wxSize", "", "The size used for cells in the grid with no item.", false, 0, 0 },
+        { "hide_children", "bool", "0", "Hides all of the sizer's children.", false, 0, 0 },
+        { "var_name", "string", "sizer_text", "", false, 0, 0 },
+        { "text", "string_edit_escapes", "MyText", "Splits text up at newlines and places the lines into wxStaticText objects with the specified maximum width in a vertical wxBoxSizer.", false, 0, 0 },
+        { "width", "int", "-1", "Specifies the text's maximum width.", false, 0, 0 },
+        { "width", "uint", "0", "The width of the spacer. Ignored if proportion is non-zero or the sizer is aligned vertically.", false, 0, 0 },
+        { "height", "uint", "0", "The height of the spacer. Ignored if proportion is non-zero or the sizer is aligned horizontally.", false, 0, 0 },
+        { "add_default_border", "bool", "0", "If checked, 5 is added to the spacer size on normal displays, and on Windows, 10 is added on a high DPI display. Ignored if stretch is non-zero.", false, 0, 0 },
+        { "proportion", "uint", "0", "If non-zero, the spacer is stretched in proportion to the other controls in the sizer.", false, 0, 0 },
+        { "var_name", "string", "stdBtn", "", false, 0, 0 },
+        { "OK", "bool", "1", "Create a 'OK' button. Cannot be combined with Yes or Save buttons.", false, 0, 0 },
+        { "Yes", "bool", "0", "Create a 'Yes' button. Cannot be combined with OK or Save buttons.", false, 0, 0 },
+        { "Save", "bool", "0", "Create a 'Save' button. Cannot be combined with OK or Yes buttons.", false, 0, 0 },
+        { "Apply", "bool", "0", "Create a 'Apply' button", false, 0, 0 },
+        { "No", "bool", "0", "Create a 'No' button", false, 0, 0 },
+        { "Cancel", "bool", "1", "Create a 'Cancel' button. Cannot be combined with Close button.", false, 0, 0 },
+        { "Close", "bool", "0", "Create a 'Close' button. Cannot be combined with Cancel button.", false, 0, 0 },
+        { "Help", "bool", "0", "Create a 'Help' button.", false, 0, 0 },
+        { "ContextHelp", "bool", "0", "Create a 'ContextHelp' button.", false, 0, 0 },
+        { "default_button", "option", " OK ", "The default button", false, 1029, 7 },
+        { "static_line", "bool", "1", "Creates a sizer with standard buttons separated from the rest of the dialog contents by a horizontal wxStaticLine. It will add a separating static line only if it conforms to the current platform convention (currently it is not added under Mac where the use of static lines for grouping is discouraged and is added elsewhere). This can only be used in a dialog.", false, 0, 0 },
+        { "var_name", "string", "m_staticText", "", false, 0, 0 },
+        { "label", "string_edit_escapes", "MyLabel", "", false, 0, 0 },
+        { "markup", "bool", "0", "Simple markup can be used to apply different fonts or colours to different parts of the control label when supported. If markup is not supported by the control or platform, it is simply stripped and SetLabel() is used with the resulting string.\\n\\nSample: This is <i>italic</i> and this is <span fgcolor='red'>red</span>", false, 0, 0 },
+        { "wrap", "int", "-1", "Wraps the control's label so that each of its lines becomes at most this many pixels wide if possible (the lines are broken at words boundaries so it might not be the case if words are too long). If width is negative, no wrapping is done.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 1036, 7 },
+        { "var_name", "string", "m_textCtrl", "", false, 0, 0 },
+        { "value", "string_edit_escapes", "", "Sets the initial contents of the control.", false, 0, 0 },
+        { "hint", "string_escapes", "", "Sets a hint to be shown when the control is empty and does not have the focus.", false, 0, 0 },
+        { "maxlength", "string", "", "The maximum length of user-entered text. 0 means no limit. Note that in wxGTK this function may only be used with single line text controls.", false, 0, 0 },
+        { "auto_complete", "stringlist_semi", "", "If one or more strings are entered, they will be used to initialize autocomplete.", false, 0, 0 },
+        { "spellcheck", "bitlist", "", "", false, 1043, 2 },
+        { "style", "bitlist", "", "", false, 1045, 17 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_richText", "", false, 0, 0 },
+        { "value", "string_escapes", "", "Sets the initial contents of the control.", false, 0, 0 },
+        { "hint", "string_escapes", "", "Sets a hint to be shown when the control is empty and does not have the focus.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 1062, 2 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_scintilla", "", false, 0, 0 },
+        { "lexer", "option", "CPP", "", false, 1064, 120 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "read_only", "bool", "0", "Set ReadOnly Mode. Disables editing if set to true.", false, 0, 0 },
+        { "eol_mode", "option", " \\n (LF) ", "Sets the characters that are added into the document when the user presses the Enter key.", false, 1184, 3 },
+        { "left_margin_width", "int", "5", "Sets the width of the blank margin to the left of the text. If this is set to 5, then it will automatically scale on high DPI displays.", false, 0, 0 },
+        { "right_margin_width", "int", "5", "Sets the width of the blank margin to the right of the text. If this is set to 5, then it will automatically scale on high DPI displays.", false, 0, 0 },
+        { "view_eol", "bool", "0", "Show end of line characters.", false, 0, 0 },
+        { "view_whitespace", "option", " invisible ", "Set whether white space is visible. Space characters appear as small centered dots and tab characters as light arrows pointing to the right.", false, 1187, 4 },
+        { "view_tab_strikeout", "bool", "0", "By default, if whitespace is visible, tab charcers are drawn as light arrows pointing to the right. If strikeout is checked, then tabs are drawn as a horizontal line stretching until the tabstop.", false, 0, 0 },
+        { "select_wrapped_line", "bool", "1", "If checked, the entire wrapped line is selected when clicking in the margin. If not checked, only the subline will be selected.", false, 0, 0 },
+        { "line_margin", "option", " none ", "Specify the margin you want line numbers to appear in.", false, 1191, 6 },
+        { "line_digits", "option", " 5 ", "The number of digits needed to display the largest line. The  width of the margin will be calculated based on this number of digits.", false, 1197, 5 },
+        { "fold_margin", "option", " none ", "Specify the margin you want folding symbols to appear in.", false, 1202, 6 },
+        { "fold_width", "int", "16", "A margin with zero width is invisible.", false, 0, 0 },
+        { "fold_marker_style", "option", "arrow", "Specify the style of marker to use for folders.", false, 1208, 4 },
+        { "fold_marker_colour", "wxColour", "", "Sets the background colour of the markers.", false, 0, 0 },
+        { "automatic_folding", "bitlist", "", "", false, 1212, 3 },
+        { "fold_flags", "bitlist", "", "In addition to showing markers in the folding margin, you can indicate folds to the user by drawing lines in the text area.", false, 1215, 6 },
+        { "separator_margin", "option", " none ", "Specify the margin you want a vertical separator line to appear in.", false, 1221, 6 },
+        { "separator_width", "int", "1", "Note: a margin with zero width is invisible.", false, 0, 0 },
+        { "symbol_margin", "option", " none ", "Specify the margin you want non-folding symbols to appear in.", false, 1227, 6 },
+        { "symbol_mouse_sensitive", "bool", "0", "If checked, clicking in the margin will send a wxEVT_STC_MARGINCLICK or wxEVT_STC_MARGIN_RIGHT_CLICK event. If not checked, the margin can be used to select a range of lines.", false, 0, 0 },
+        { "custom_margin", "option", " none ", "Specify the margin you want to fully customize", false, 1233, 6 },
+        { "custom_width", "int", "16", "A margin with zero width is invisible. 16 is normally used if the margin type is set to \"symbol\".", false, 0, 0 },
+        { "custom_type", "option", " symbol ", "", false, 1239, 7 },
+        { "custom_colour", "wxColour", "", "Sets the margin colour if custom_type is set to \"colour\".", false, 0, 0 },
+        { "custom_mask_folders", "bool", "0", "Only used if custom_type is set to \"symbol\". If checked, a mask for the 7 logical symbols used to denote folding is used. Otherwise, a mask for all non-folding symbols is used.", false, 0, 0 },
+        { "custom_mouse_sensitive", "bool", "0", "If checked, clicking in the margin will send a wxEVT_STC_MARGINCLICK or wxEVT_STC_MARGIN_RIGHT_CLICK event. If not checked, the margin can be used to select a range of lines.", false, 0, 0 },
+        { "allow_mouse_rectangle", "bool", "0", "Sets whether switching to rectangular mode while selecting with the mouse is allowed.", false, 0, 0 },
+        { "multiple_selections", "bool", "0", "Sets whether multiple selections can be made.", false, 0, 0 },
+        { "multiple_selection_typing", "bool", "0", "Sets whether typing can be performed into multiple selections.", false, 0, 0 },
+        { "additional_carets_visible", "bool", "1", "Sets whether additional carets in a multiple selection are visible.", false, 0, 0 },
+        { "additional_carets_blink", "bool", "0", "Sets whether multiple selection carets blink.", false, 0, 0 },
+        { "paste_multiple", "bool", "0", "If checked, pasted text will be added to each multiple section.", false, 0, 0 },
+        { "use_tabs", "bool", "1", "Use tabs for indenting, instead of spaces.", false, 0, 0 },
+        { "tab_width", "string", "4", "The number of spaces per tab character.", false, 0, 0 },
+        { "indentation_guides", "option", "", "", false, 1246, 4 },
+        { "indentation_size", "int", "", "Sets the size of indentation in terms of the width of a space. If you set a width of 0, the indent size is the same as the tab size. There are no limits on indent sizes, but values less than 0 or large values may have undesirable effects.", false, 0, 0 },
+        { "tab_indents", "bool", "1", "If checked, then inside indentation white space, the tab key will indent rather than insert a tab character.", false, 0, 0 },
+        { "backspace_unindents", "bool", "1", "If checked, then inside indentation white space the backspace key will unindent rather than deleting one space.", false, 0, 0 },
+        { "wrap_mode", "option", " no wrapping ", "", false, 1250, 4 },
+        { "wrap_visual_flag", "bitlist", "", "", false, 1254, 3 },
+        { "wrap_visual_location", "bitlist", "", "", false, 1257, 2 },
+        { "wrap_indent_mode", "option", "fixed", "", false, 1259, 3 },
+        { "wrap_start_indent", "int", "", "If wrap_indent_mode is set to \"fixed\" this sets the size of indentation of sublines for wrapped lines in terms of the average character width. There are no limits on indent sizes, but values less than 0 or large values may have undesirable effects. The indention of sublines is independent of visual flags, but if wrap_visual_flag is set to str start then an indent of at least 1 is used. ", false, 0, 0 },
+        { "var_name", "string", "m_indicator", "", false, 0, 0 },
+        { "auto_start", "bool", "", "", false, 0, 0 },
+        { "var_name", "string", "m_animation_ctrl", "", false, 0, 0 },
+        { "play", "bool", "", "If checked, Play() will be called as soon as the control is created.", false, 0, 0 },
+        { "style", "bitlist", "wxAC_DEFAULT_STYLE", "", false, 1262, 2 },
+        { "use_generic", "bool", "", "If checked, wxGenericAnimationCtrl will be used instead of wxAnimationCtrl.", true, 0, 0 },
+        { "animation", "animation", "", "", false, 0, 0 },
+        { "inactive_bitmap", "image", "", "", false, 0, 0 },
+        { "var_name", "string", "m_banner", "", false, 0, 0 },
+        { "title", "string_escapes", "", "Title is rendered in bold and should be a single line.", false, 0, 0 },
+        { "message", "string_edit_escapes", "", "The message can have multiple lines but is not wrapped automatically. Include explicit line breaks in the string if you want to have multiple lines.", false, 0, 0 },
+        { "bitmap", "image", "", "Specifies a bitmap to use as the background.", false, 0, 0 },
+        { "start_colour", "wxColour", "", "Specifies the starting colour of a gradient. Ignored if a bitmap is specified.", false, 0, 0 },
+        { "end_colour", "wxColour", "", "Specifies the ending colour of a gradient. Ignored if a bitmap is specified", false, 0, 0 },
+        { "direction", "option", " wxTOP ", "Determines the placement of the banner and the direction of any text.", false, 1264, 4 },
+        { "var_name", "string", "m_custom", "", false, 0, 0 },
+        { "header", "code_edit", "", "The header file that declares the class. If the first line does not start with #include then the entire contents will be placed in quotes and prefixed with #include. Python and Ruby code should use python_import_list and ruby_require_list instead of this property.", false, 0, 0 },
+        { "namespace", "string", "", "C++ namespace the class is declared in. This property is ignored in any language besides C++.", false, 0, 0 },
+        { "class_name", "string", "CustomClass", "The name of the custom class.", false, 0, 0 },
+        { "construction", "code_edit", "", "Optional code to construct the control instead of having wxUiEditor construct it. After this code is placed into the generated file, the var_name property will be used to access the control.", false, 0, 0 },
+        { "parameters", "string_code_cstm_param", "(this)", "The parameters to use when the class is constructed. The macros ${id}, ${pos}, ${size}, ${window_extra_style}, ${window_name}, and ${window_style} will be replaced with the matching property. In Python, this will be replaced with self.", false, 0, 0 },
+        { "settings_code", "code_edit", "", "Additional code to include after the class is constructed.", false, 0, 0 },
+        { "custom_mockup", "custom_mockup", "wxBitmap;-1;-1", "Set how you want your custom control represented in the Mockup panel. This will have no effect on the code generated for your control. If both width and height are set to -1, then the control will be set to the size property in the Window Settings section.", false, 0, 0 },
+        { "var_name", "string", "m_rearrange", "", false, 0, 0 },
+        { "selection_string", "string_escapes", "", "Selects the item with the specified string in the control. Note that this is case-insensitive, i.e. the string is compared with all the elements of the control case-insensitively and the first matching entry is selected, even if it doesn't have exactly the same case as this string and there is an exact match afterwards.", false, 0, 0 },
+        { "selection_int", "int", "-1", "Sets the selection to the value unless it is -1. Ignored if the selection_string property contains a value.", false, 0, 0 },
+        { "contents", "checklist_item", "", "List of default values and their checked state.", false, 0, 0 },
+        { "type", "option", "wxLB_SINGLE", "", false, 1268, 3 },
+        { "style", "bitlist", "", "", false, 1271, 5 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "bmp", "", false, 0, 0 },
+        { "scale_mode", "option", "None", "", false, 1276, 4 },
+        { "bitmap", "image", "", "", false, 0, 0 },
+        { "var_name", "string", "static_line", "", false, 0, 0 },
+        { "style", "option", " wxLI_HORIZONTAL ", "", false, 1280, 2 },
+        { "var_name", "string", "m_slider", "", false, 0, 0 },
+        { "position", "int", "50", "Initial position for the slider.", false, 0, 0 },
+        { "minValue", "int", "0", "Minimum slider position.", false, 0, 0 },
+        { "maxValue", "int", "100", "Maximum slider position.", false, 0, 0 },
+        { "sel_start", "int", "-1", "Selection starting position. Only usable on Windows.", false, 0, 0 },
+        { "sel_end", "int", "-1", "Selection starting position. Only usable on Windows.", false, 0, 0 },
+        { "line_size", "int", "0", "If >0, sets the number of steps the slider moves when the user moves up or down a line.", false, 0, 0 },
+        { "page_size", "int", "0", "If >0, sets the number of steps the slider moves when the user pages up or down.", false, 0, 0 },
+        { "tick_frequency", "int", "0", "If >0, sets tick frequency and position. Only usable on Windows.", false, 0, 0 },
+        { "thumb_length", "int", "0", "If >0, sets the slider thumb length. Only usable on Windows.", false, 0, 0 },
+        { "orientation", "option", " wxSL_HORIZONTAL ", "", false, 1282, 2 },
+        { "style", "bitlist", "", "", false, 1284, 11 },
+        { "var_name", "string", "m_gauge", "", false, 0, 0 },
+        { "position", "uint", "0", "Initial position for the gauge.", false, 0, 0 },
+        { "range", "uint", "100", "Integer range (maximum value) of the gauge.", false, 0, 0 },
+        { "orientation", "option", " wxGA_HORIZONTAL ", "", false, 1295, 2 },
+        { "style", "bitlist", "", "", false, 1297, 1 },
+        { "var_name", "string", "m_scrollBar", "", false, 0, 0 },
+        { "position", "uint", "0", "The position of the scrollbar in scroll units.", false, 0, 0 },
+        { "range", "uint", "100", "The maximum position of the scrollbar.", false, 0, 0 },
+        { "thumbsize", "uint", "1", "The size of the thumb, or visible portion of the scrollbar, in scroll units.", false, 0, 0 },
+        { "pagesize", "uint", "1", "This is the number of scroll units that will be scrolled when the user pages up or down.", false, 0, 0 },
+        { "style", "option", " wxSB_HORIZONTAL ", "", false, 1298, 2 },
+        { "var_name", "string", "m_hyperlink", "", false, 0, 0 },
+        { "label", "string_escapes", "Hyperlink", "Text of the hyperlink", false, 0, 0 },
+        { "url", "string_escapes", "", "Target of the hyperlink", false, 0, 0 },
+        { "hover_color", "wxColour", "", "The colour used to print the label of the hyperlink when the mouse is over the control.", false, 0, 0 },
+        { "normal_color", "wxColour", "", "The colour used to print the label when the link has never been clicked before (i.e. the link has not been visited) and the mouse is not over the control.", false, 0, 0 },
+        { "visited_color", "wxColour", "", "The colour used to print the label when the mouse is not over the control and the link has already been clicked before (i.e. the link has been visited).", false, 0, 0 },
+        { "underlined", "bool", "1", "If checked, the text will be underlined. If not checked, a wxGenericHyperlinkCtrl is used instead (not available for wxPython), and a non-underlined default GUI font will be used to display the text. On Windows, colors cannot be set unless a wxGenericHyperlinkCtrl is used (underline is unchecked).", false, 0, 0 },
+        { "sync_hover_colour", "bool", "0", "If checked, hover colour will be set to the same value as normal colour. If the above underlined property is unchecked, then check this to prevent the hover colour from being set to red. Ignored if hover_colour is already set.", false, 0, 0 },
+        { "style", "bitlist", "wxHL_DEFAULT_STYLE", "", false, 1300, 5 },
+        { "var_name", "string", "m_searchCtrl", "", false, 0, 0 },
+        { "value", "string_escapes", "", "Initial value", false, 0, 0 },
+        { "hint", "string_escapes", "", "Sets a hint to be shown when the control is empty and does not have the focus.", false, 0, 0 },
+        { "search_button", "bool", "1", "Shows or hides the search button.", false, 0, 0 },
+        { "cancel_button", "bool", "0", "Shows or hides the cancel button.", false, 0, 0 },
+        { "style", "bitlist", "", "", false, 1305, 6 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_htmlWin", "", false, 0, 0 },
+        { "style", "bitlist", " wxHW_SCROLLBAR_AUTO ", "", false, 1311, 3 },
+        { "html_borders", "int", "-1", "Specifies the space between the window and the contents in DPI-independent pixels. -1 indicates that a default border size should be used.", false, 0, 0 },
+        { "html_content", "html_edit", "", "The HTML contents to be displayed.", false, 0, 0 },
+        { "html_url", "string_edit_single", "", "The URL to load and display. Note that https: protocol is not currently supported (but http: is). You can specify a local file with or without a file:/// prefix.", false, 0, 0 },
+        { "var_name", "string", "m_webview", "", false, 0, 0 },
+        { "url", "string_escapes", "", "", false, 0, 0 },
+        { "var_name", "string", "m_calendar", "", false, 0, 0 },
+        { "style", "bitlist", " wxCAL_SHOW_HOLIDAYS ", "", false, 1314, 8 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "use_generic", "bool", "0", "If checked, wxGenericCalendarCtrl will be used instead of wxCalendarCtrl.", false, 0, 0 },
+        { "var_name", "string", "m_genericDirCtrl", "", false, 0, 0 },
+        { "defaultfolder", "string_escapes", "", "Initial Directory.", false, 0, 0 },
+        { "filter", "string_escapes", "", "A filter string, using the same syntax as that for wxFileDialog. This may be empty if filters are not being used. Example: \"All files (*.*)|*.*|JPEG files (*.jpg)|*.jpg\".", false, 0, 0 },
+        { "defaultfilter", "uint", "0", "The zero-indexed default filter setting.", false, 0, 0 },
+        { "show_hidden", "bool", "0", "Show hidden files", false, 0, 0 },
+        { "style", "bitlist", " wxDIRCTRL_3D_INTERNAL ", "", false, 1322, 6 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+        { "var_name", "string", "m_fileCtrl", "", false, 0, 0 },
+        { "initial_folder", "path", "", "Initial folder.", false, 0, 0 },
+        { "initial_filename", "file", "", "Initial file name.", false, 0, 0 },
+        { "wildcard", "string_escapes", "", "Sets the wildcard, which can contain multiple file types, for example: \"BMP files (*.bmp)|*.bmp|GIF files (*.gif)|*.gif\".", false, 0, 0 },
+        { "filter_index", "uint", "", "Sets the current filter (wildcard) index, starting from zero.", false, 0, 0 },
+        { "show_hidden", "bool", "0", "Show hidden files", false, 0, 0 },
+        { "style", "bitlist", " wxFC_OPEN ", "", false, 1328, 4 },
+        { "focus", "bool", "0", "When checked, this control will be set to receive keyboard input when the parent form is first created.", false, 0, 0 },
+    };
+
+    constexpr Option s_options[] = {
+        { "", "" },
+        { "wxLEFT", "Positions the bitmap at the left" },
+        { "wxRIGHT", "Positions the bitmap at the right" },
+        { "wxTOP", "Positions the bitmap at the top" },
+        { "wxBOTTOM", "Positions the bitmap at the bottom" },
+        { "normal", "Normal size" },
+        { "small", "About 25% smaller than normal." },
+        { "mini", "About 33% smaller than normal." },
+        { "large", "About 35% larger than normal." },
+        { "3.2.0", "" },
+        { "3.3.0", "" },
+        { "3.4.0", "" },
+        { "3.5.0", "" },
+        { "11", "" },
+        { "17", "" },
+        { ".cpp", "" },
+        { ".cc", "" },
+        { ".cxx", "" },
+        { ".h", "" },
+        { ".hh", "" },
+        { ".hpp", "" },
+        { ".hxx", "" },
+        { "0.9.0", "" },
+        { "0.90", "" },
+        { "1.00", "" },
+        { "0.9.0", "" },
+        { "0.9.0", "" },
+        { "0.9.0", "" },
+        { "4.2.0", "" },
+        { "1.5.0", "" },
+        { "1.5.5", "" },
+        { "1.6.1", "" },
+        { "wxALIGN_LEFT", "Align the item to the left of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_TOP", "Align the item to the top of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_RIGHT", "Align the item to the right of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_BOTTOM", "Align the item to the bottom of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_CENTER", "Align the item to the center of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_CENTER_HORIZONTAL", "Align the item to the horizontal center of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_CENTER_VERTICAL", "Align the item to the vertical center of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALL", "Enable all borders" },
+        { "wxLEFT", "Enable the left border" },
+        { "wxRIGHT", "Enable the right border" },
+        { "wxTOP", "Enable the top border" },
+        { "wxBOTTOM", "Enable the bottom border" },
+        { "wxEXPAND", "The item will be expanded to fill the space assigned to the item." },
+        { "wxSHAPED", "The item will be expanded as much as possible while also maintaining its aspect ratio." },
+        { "wxFIXED_MINSIZE", "Normally wxSizers will use GetAdjustedBestSize to determine what the minimal size of window items should be, and will use that size to calculate the layout. This allows layouts to adjust when an item changes and its best size becomes different. If you would rather have a window item stay the size it started with then use wxFIXED_MINSIZE." },
+        { "wxRESERVE_SPACE_EVEN_IF_HIDDEN", "Normally wxSizers don't allocate space for hidden windows or other items. This flag overrides this behaviour so that sufficient space is allocated for the window even if it isn't visible. This makes it possible to dynamically show and hide controls without resizing the parent window." },
+        { "wxALIGN_LEFT", "Align the item to the left of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_TOP", "Align the item to the top of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_RIGHT", "Align the item to the right of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_BOTTOM", "Align the item to the bottom of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_CENTER", "Align the item to the center of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_CENTER_HORIZONTAL", "Align the item to the horizontal center of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALIGN_CENTER_VERTICAL", "Align the item to the vertical center of the space allotted to it by the sizer, adjusted for the border if any." },
+        { "wxALL", "Enable all borders" },
+        { "wxLEFT", "Enable the left border" },
+        { "wxRIGHT", "Enable the right border" },
+        { "wxTOP", "Enable the top border" },
+        { "wxBOTTOM", "Enable the bottom border" },
+        { "wxEXPAND", "The item will be expanded to fill the space assigned to the item." },
+        { "wxSHAPED", "The item will be expanded as much as possible while also maintaining its aspect ratio." },
+        { "wxFIXED_MINSIZE", "Normally wxSizers will use GetAdjustedBestSize to determine what the minimal size of window items should be, and will use that size to calculate the layout. This allows layouts to adjust when an item changes and its best size becomes different. If you would rather have a window item stay the size it started with then use wxFIXED_MINSIZE." },
+        { "wxRESERVE_SPACE_EVEN_IF_HIDDEN", "Normally wxSizers don't allocate space for hidden windows or other items. This flag overrides this behaviour so that sufficient space is allocated for the window even if it isn't visible. This makes it possible to dynamically show and hide controls without resizing the parent window." },
+        { "wxVERTICAL", "Rows are flexibly sized." },
+        { "wxHORIZONTAL", "Columns are flexibly sized." },
+        { "wxBOTH", "Both rows and columns are flexibly sized (this is the default value)." },
+        { "wxFLEX_GROWMODE_NONE", "Sizer doesn't grow in the non flexible direction." },
+        { "wxFLEX_GROWMODE_SPECIFIED", "Sizer honors growable columns/rows set with AddGrowableCol and AddGrowableRow. In this case equal sizing applies to minimum sizes of columns or rows (this is the default value)." },
+        { "wxFLEX_GROWMODE_ALL", "Sizer equally stretches all columns or rows in the non flexible direction, whether they are growable or not in the flexible direction." },
+        { "wxString", "String value." },
+        { "wxFileName", "Only use this with a wxGenericValidator type." },
+        { "short", "Only use this with a wxIntegerValidator type." },
+        { "int", "Only use this with a wxIntegerValidator type." },
+        { "long", "Only use this with a wxIntegerValidator type." },
+        { "long long", "Only use this with a wxIntegerValidator type." },
+        { "unsigned short", "Only use this with a wxIntegerValidator type." },
+        { "unsigned int", "Only use this with a wxIntegerValidator type." },
+        { "unsigned long", "Only use this with a wxIntegerValidator type." },
+        { "unsigned long long", "Only use this with a wxIntegerValidator type." },
+        { "double", "Only use this with a wxFloatingPointValidator type." },
+        { "float", "Only use this with a wxFloatingPointValidator type." },
+        { "wxFILTER_NONE", "No filtering takes place." },
+        { "wxFILTER_ASCII", "Non-ASCII characters are filtered out." },
+        { "wxFILTER_ALPHA", "Non-alpha characters are filtered out." },
+        { "wxFILTER_ALPHANUMERIC", "Non-alphanumeric characters are filtered out." },
+        { "wxFILTER_DIGITS", "Non-numeric characters are filtered out. Uses isdigit() to perform the check." },
+        { "wxFILTER_NUMERIC", "Non-numeric characters are filtered out, but allows decimal points, minus/plus signs and the 'e' or 'E' character." },
+        { "wxFILTER_INCLUDE_LIST", "Use an include list. The validator checks if the user input is on the list, complaining if not. See wxTextValidator::SetIncludes." },
+        { "wxFILTER_EXCLUDE_LIST", "Use an exclude list. The validator checks if the user input is on the list, complaining if it is. See wxTextValidator::SetExcludes." },
+        { "wxFILTER_INCLUDE_CHAR_LIST", "Use an include list. The validator checks if each input character is in the list (one character per list element), complaining if not. See wxTextValidator::SetIncludes." },
+        { "wxFILTER_EXCLUDE_CHAR_LIST", "Use an include list. The validator checks if each input character is in the list (one character per list element), complaining if it is. See wxTextValidator::SetExcludes." },
+        { "wxNUM_VAL_THOUSANDS_SEPARATOR", "Used by wxIntegerValidator. When this style is used, numbers are formatted using the thousands separators after validating the user entry (if the current locale uses the thousands separators character)." },
+        { "wxNUM_VAL_ZERO_AS_BLANK", "Used by wxIntegerValidator and wxFloatingPointValidator. With this style a value of zero in the associated variable is translated to an empty string and an empty value of the control is translated to a value of zero." },
+        { "wxNUM_VAL_NO_TRAILING_ZEROES", "Used by wxFloatingPointValidator. Indicates that trailing zeroes should be removed from the control text when it is validated. By default, as many zeroes as needed to satisfy the precision used when creating the validator will be appended." },
+        { "wxCheckBoxState", "Only use this with a wxGenericValidator type." },
+        { "wxString", "String value." },
+        { "int", "Integer value." },
+        { "wxColour", "Only use this with a wxGenericValidator type." },
+        { "wxDateTime", "Only use this with a wxGenericValidator type." },
+        { "normal", "Normal size" },
+        { "small", "About 25% smaller than normal." },
+        { "mini", "About 33% smaller than normal." },
+        { "large", "About 35% larger than normal." },
+        { "wxBORDER_DEFAULT", "The window class will decide the kind of border to show, if any." },
+        { "wxBORDER_SIMPLE", "Displays a thin border around the window. wxSIMPLE_BORDER is the old name for this style." },
+        { "wxBORDER_SUNKEN", "Displays a sunken border. wxSUNKEN_BORDER is the old name for this style." },
+        { "wxBORDER_RAISED", "Displays a raised border. wxRAISED_BORDER is the old name for this style." },
+        { "wxBORDER_STATIC", "Displays a border suitable for a static control. wxSTATIC_BORDER is the old name for this style. Windows only." },
+        { "wxBORDER_THEME", "Displays a native border suitable for a control, on the current platform. On Windows XP or Vista, this will be a themed border; on most other platforms a sunken border will be used. For more information for themed borders on Windows, please see Themed borders on Windows." },
+        { "wxBORDER_NONE", "Displays no border, overriding the default border style for the window." },
+        { "wxTRANSPARENT_WINDOW", "The window is transparent, that is, it will not receive paint events. Windows only." },
+        { "wxTAB_TRAVERSAL", "Setting this will cause the tab key to traverse child windows." },
+        { "wxWANTS_CHARS", "Use this to indicate that the window wants to get all char/key events for all keys - even for keys like TAB or ENTER which are usually used for dialog navigation and which wouldn't be generated without this style. If you need to use this style in order to get the arrows or etc., but would still like to have normal keyboard navigation take place, you should call Navigate in response to the key events for Tab and Shift-Tab." },
+        { "wxVSCROLL", "Use this style to enable a vertical scrollbar. Notice that this style cannot be used with native controls which don't support scrollbars nor with top-level windows in most ports." },
+        { "wxHSCROLL", "Use this style to enable a horizontal scrollbar. The same limitations as for wxVSCROLL apply to this style." },
+        { "wxALWAYS_SHOW_SB", "If a window has scrollbars, disable them instead of hiding them when they are not needed (i.e. when the size of the window is big enough to not require the scrollbars to navigate it). This style is currently implemented for wxMSW, wxGTK and wxUniversal and does nothing on the other platforms." },
+        { "wxCLIP_CHILDREN", "Use this style to eliminate flicker caused by the background being repainted, then children being painted over them. Windows only." },
+        { "wxFULL_REPAINT_ON_RESIZE", "Use this style to force a complete redraw of the window whenever it is resized instead of redrawing just the part of the window affected by resizing. Currently this style applies on GTK+ 2 and Windows only, and full repainting is always done on other platforms." },
+        { "wxWS_EX_VALIDATE_RECURSIVELY", "By default, Validate/TransferDataTo/FromWindow() only work on direct children of the window (compatible behaviour). Set this flag to make them recursively descend into all subwindows." },
+        { "wxWS_EX_BLOCK_EVENTS", "wxCommandEvents are propagated upward to the parent window, it's parent window, etc. Setting this flag blocks this propagation at this window, preventing events from being propagated further upwards." },
+        { "wxWS_EX_TRANSIENT", "Don't use this window as an implicit parent for the other windows: this must be used with transient windows as otherwise there is the risk of creating a dialog/frame with this window as a parent which would lead to a crash if the parent is destroyed before the child." },
+        { "wxWS_EX_PROCESS_IDLE", "This window should always process idle events, even if the mode set by wxIdleEvent::SetMode is wxIDLE_PROCESS_SPECIFIED." },
+        { "wxWS_EX_PROCESS_UI_UPDATES", "This window should always process UI update events, even if the mode set by wxUpdateUIEvent::SetMode is wxUPDATE_UI_PROCESS_SPECIFIED." },
+        { "Windows", "Create this control when running on Windows." },
+        { "Unix", "Create this control when running on Unix." },
+        { "Mac", "Create this control when running on Mac." },
+        { "C++", "Disable C++ code for this control (ignored if project doesn't generate C++ code)." },
+        { "wxPython", "Disable wxPython code for this control (ignored if project doesn't generate wxPython code)." },
+        { "wxRuby", "Disable wxRuby code for this control (ignored if project doesn't generate wxRuby code)." },
+        { "Fortran", "Disable Fortran code for this control (ignored if project doesn't generate Fortran code)." },
+        { "GO", "Disable GO code for this control (ignored if project doesn't generate GO code)." },
+        { "LuaJIT", "Disable LuaJIT code for this control (ignored if project doesn't generate LuaJIT code)." },
+        { "Julia", "Disable Julia code for this control (ignored if project doesn't generate Julia code)." },
+        { "TypeScript", "Disable TypeScript code for this control (ignored if project doesn't generate TypeScript code)." },
+        { "wxTB_FLAT", "Gives the toolbar a flat look (Windows and GTK only)." },
+        { "wxTB_DOCKABLE", "Makes the toolbar floatable and dockable (GTK only)." },
+        { "wxTB_HORIZONTAL", "Specifies horizontal layout." },
+        { "wxTB_VERTICAL", "Specifies vertical layout." },
+        { "wxTB_TEXT", "Shows the text in the toolbar buttons; by default only icons are shown." },
+        { "wxTB_NOICONS", "Specifies no icons in the toolbar buttons; by default they are shown." },
+        { "wxTB_NODIVIDER", "Specifies no divider (border) above the toolbar (Windows only)." },
+        { "wxTB_NOALIGN", "Specifies no alignment with the parent window (Windows only, not very useful)." },
+        { "wxTB_HORZ_LAYOUT", "Shows the text and the icons alongside, not vertically stacked (Windows and GTK 2 only). This style must be used with wxTB_TEXT." },
+        { "wxTB_HORZ_TEXT", "Combination of wxTB_HORZ_LAYOUT and wxTB_TEXT." },
+        { "wxTB_FLAT", "Gives the toolbar a flat look (Windows and GTK only)." },
+        { "wxTB_DOCKABLE", "Makes the toolbar floatable and dockable (GTK only)." },
+        { "wxTB_HORIZONTAL", "Specifies horizontal layout (default)." },
+        { "wxTB_VERTICAL", "Specifies vertical layout." },
+        { "wxTB_TEXT", "Shows the text in the toolbar buttons; by default only icons are shown." },
+        { "wxTB_NOICONS", "Specifies no icons in the toolbar buttons; by default they are shown." },
+        { "wxTB_NODIVIDER", "Specifies no divider (border) above the toolbar (Windows only)." },
+        { "wxTB_NOALIGN", "Specifies no alignment with the parent window (Windows only, not very useful)." },
+        { "wxTB_HORZ_LAYOUT", "Shows the text and the icons alongside, not vertically stacked (Windows and GTK 2 only). This style must be used with wxTB_TEXT." },
+        { "wxTB_HORZ_TEXT", "Combination of wxTB_HORZ_LAYOUT and wxTB_TEXT." },
+        { "wxTB_NO_TOOLTIPS", "Don't show the short help tooltips for the tools when the mouse hovers over them." },
+        { "wxTB_BOTTOM", "Align the toolbar at the bottom of parent window." },
+        { "wxTB_RIGHT", "Align the toolbar at the right side of parent window." },
+        { "wxITEM_NORMAL", "A normal toolbar button." },
+        { "wxITEM_CHECK", "A checkable tool (stays pressed after it has been toggled)." },
+        { "wxITEM_DROPDOWN", "Creates a normal tool button with a dropdown arrow next to it." },
+        { "wxITEM_RADIO", "A checkable tool which makes part of a radio group of tools each of which is automatically unchecked whenever another button in the group is checked." },
+        { "wxAUI_TB_TEXT", "Shows the text in the toolbar buttons; by default only icons are shown. " },
+        { "wxAUI_TB_NO_TOOLTIPS", "Don't show tooltips on wxAuiToolBar items." },
+        { "wxAUI_TB_NO_AUTORESIZE", "Do not auto-resize the wxAuiToolBar." },
+        { "wxAUI_TB_GRIPPER", "Shows a gripper on the wxAuiToolBar." },
+        { "wxAUI_TB_OVERFLOW", "The wxAuiToolBar can contain overflow items." },
+        { "wxAUI_TB_VERTICAL", "Using this style forces the toolbar to be vertical and be only dockable to the left or right sides of the window whereas by default it can be horizontal or vertical and be docked anywhere." },
+        { "wxAUI_TB_HORZ_LAYOUT", "Shows the text and the icons alongside, not vertically stacked. This style must be used with wxAUI_TB_TEXT" },
+        { "wxAUI_TB_HORIZONTAL", "Analogous to wxAUI_TB_VERTICAL, but forces the toolbar to be horizontal, docking to the top or bottom of the window." },
+        { "wxAUI_TB_PLAIN_BACKGROUND", "Draw a plain background (based on parent) instead of the default gradient background." },
+        { "wxAUI_TB_HORZ_TEXT", "Shows the text alongside the icons, not vertically stacked." },
+        { "wxAUI_ORIENTATION_MASK ", "Shows the text in the toolbar buttons. By default only icons are shown." },
+        { "wxAUI_TB_DEFAULT_STYLE", "By default only icons are shown." },
+        { "wxAUI_TB_TEXT", "Shows the text in the toolbar buttons; by default only icons are shown. " },
+        { "wxAUI_TB_NO_TOOLTIPS", "Don't show tooltips on wxAuiToolBar items." },
+        { "wxAUI_TB_NO_AUTORESIZE", "Do not auto-resize the wxAuiToolBar." },
+        { "wxAUI_TB_GRIPPER", "Shows a gripper on the wxAuiToolBar." },
+        { "wxAUI_TB_OVERFLOW", "The wxAuiToolBar can contain overflow items." },
+        { "wxAUI_TB_VERTICAL", "Using this style forces the toolbar to be vertical and be only dockable to the left or right sides of the window whereas by default it can be horizontal or vertical and be docked anywhere." },
+        { "wxAUI_TB_HORZ_LAYOUT", "Shows the text and the icons alongside, not vertically stacked. This style must be used with wxAUI_TB_TEXT" },
+        { "wxAUI_TB_HORIZONTAL", "Analogous to wxAUI_TB_VERTICAL, but forces the toolbar to be horizontal, docking to the top or bottom of the window." },
+        { "wxAUI_TB_PLAIN_BACKGROUND", "Draw a plain background (based on parent) instead of the default gradient background." },
+        { "wxAUI_TB_HORZ_TEXT", "Shows the text alongside the icons, not vertically stacked." },
+        { "wxAUI_ORIENTATION_MASK ", "Shows the text in the toolbar buttons. By default only icons are shown." },
+        { "wxAUI_TB_DEFAULT_STYLE", "By default only icons are shown." },
+        { "wxITEM_NORMAL", "A normal toolbar button." },
+        { "wxITEM_CHECK", "A checkable tool (stays pressed after it has been toggled)." },
+        { "wxITEM_DROPDOWN", "Creates a normal tool button with a dropdown arrow next to it." },
+        { "wxITEM_RADIO", "A checkable tool which makes part of a radio group of tools each of which is automatically unchecked whenever another button in the group is checked." },
+        { "wxAUI_BUTTON_STATE_NORMAL", "Normal button state." },
+        { "wxAUI_BUTTON_STATE_HOVER", "Hovered button state." },
+        { "wxAUI_BUTTON_STATE_PRESSED", "Pressed button state." },
+        { "wxAUI_BUTTON_STATE_DISABLED", "Disabled button state." },
+        { "wxAUI_BUTTON_STATE_HIDDEN", "Hidden button state." },
+        { "wxAUI_BUTTON_STATE_CHECKED", "Checked button state." },
+        { "wxSTB_SIZEGRIP", "Displays a gripper at the right-hand side of the status bar which can be used to resize the parent window." },
+        { "wxSTB_SHOW_TIPS", "Displays tooltips for those panes whose status text has been ellipsized/truncated because the status text doesn't fit the pane width. Note that this style has effect only on wxGTK (with GTK+ >= 2.12) currently." },
+        { "wxSTB_ELLIPSIZE_START", "Replace the beginning of the status texts with an ellipsis when the status text widths exceed the status bar pane's widths (uses wxControl::Ellipsize)." },
+        { "wxSTB_ELLIPSIZE_MIDDLE", "Replace the middle of the status texts with an ellipsis when the status text widths exceed the status bar pane's widths (uses wxControl::Ellipsize)." },
+        { "wxSTB_ELLIPSIZE_END", "Replace the end of the status texts with an ellipsis when the status text widths exceed the status bar pane's widths (uses wxControl::Ellipsize)." },
+        { "wxSTB_DEFAULT_STYLE", "The default style: includes wxSTB_SIZEGRIP | wxSTB_SHOW_TIPS | wxSTB_ELLIPSIZE_END | wxFULL_REPAINT_ON_RESIZE" },
+        { "no effects", "No effect, equivalent to normal wxWindow::Show() or Hide() call." },
+        { "roll to left", "Roll window to the left." },
+        { "roll to right", "Roll window to the right." },
+        { "roll to top", "Roll window to the top." },
+        { "roll to bottom", "Roll window to the bottom." },
+        { "slide to left", "Slide window to the left." },
+        { "slide to right", "Slide window to the right." },
+        { "slide to top", "Slide window to the top." },
+        { "slide to bottom", "Slide window to the bottom." },
+        { "blend", "Fade in or out effect." },
+        { "expand", "Expanding or collapsing effect." },
+        { "no effects", "No effect, equivalent to normal wxWindow::Show() or Hide() call." },
+        { "roll to left", "Roll window to the left." },
+        { "roll to right", "Roll window to the right." },
+        { "roll to top", "Roll window to the top." },
+        { "roll to bottom", "Roll window to the bottom." },
+        { "slide to left", "Slide window to the left." },
+        { "slide to right", "Slide window to the right." },
+        { "slide to top", "Slide window to the top." },
+        { "slide to bottom", "Slide window to the bottom." },
+        { "blend", "Fade in or out effect." },
+        { "expand", "Expanding or collapsing effect." },
+        { "wxMB_DOCKABLE", "Allows the menu bar to be detached (wxGTK only)." },
+        { "wxMB_DOCKABLE", "Allows the menu bar to be detached (wxGTK only)." },
+        { "none", "" },
+        { "wxID_FILE", "Use wxGetStockLabel(wxID_FILE) to retrieve the label." },
+        { "wxID_EDIT", "Use wxGetStockLabel(wxID_EDIT) to retrieve the label." },
+        { "wxID_HELP", "Use wxGetStockLabel(wxID_HELP) to retrieve the label." },
+        { "none", "" },
+        { "wxID_ABOUT", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_ADD", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_CLEAR", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_CLOSE", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_CONVERT", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_COPY", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_CUT", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_DELETE", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_EDIT", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_EXIT", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_FIND", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_FIRST", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_HELP", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_INDEX", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_INDENT", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_INFO", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_LAST", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_NEW", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_NEW", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_OPEN", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_PASTE", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_PREFERENCES", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_PREVIEW", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_PRINT", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_PROPERTIES", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_REDO", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_REMOVE", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_REPLACE", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_SAVE", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_SAVEAS", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_SELECTALL", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_UNDELETE", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_UNDO", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxID_UNINDENT", "Sets the label and help text, and changes the id to the stock id." },
+        { "wxITEM_NORMAL", "Creates a normal menu item." },
+        { "wxITEM_CHECK", "Creates a checkable menu item." },
+        { "wxITEM_RADIO", "Creates a radio menu item. Consecutive radio items form a radio group such that exactly one button in the group is selected at any moment." },
+        { "Default", "Use Default theme." },
+        { "Generic", "Use Generic theme." },
+        { "MSW", "Use MSW theme." },
+        { "wxRIBBON_BAR_DEFAULT_STYLE", "Defined as wxRIBBON_BAR_FLOW_HORIZONTAL | wxRIBBON_BAR_SHOW_PAGE_LABELS | wxRIBBON_BAR_SHOW_PANEL_EXT_BUTTONS | wxRIBBON_BAR_SHOW_TOGGLE_BUTTON | wxRIBBON_BAR_SHOW_HELP_BUTTON." },
+        { "wxRIBBON_BAR_FOLDBAR_STYLE", "Defined as wxRIBBON_BAR_FLOW_VERTICAL | wxRIBBON_BAR_SHOW_PAGE_ICONS | wxRIBBON_BAR_SHOW_PANEL_EXT_BUTTONS | wxRIBBON_BAR_SHOW_PANEL_MINIMISE_BUTTONS." },
+        { "wxRIBBON_BAR_SHOW_PAGE_LABELS", "Causes labels to be shown on the tabs in the ribbon bar." },
+        { "wxRIBBON_BAR_SHOW_PAGE_ICONS", "Causes icons to be shown on the tabs in the ribbon bar." },
+        { "wxRIBBON_BAR_FLOW_HORIZONTAL", "Causes panels within pages to stack horizontally." },
+        { "wxRIBBON_BAR_FLOW_VERTICAL", "Causes panels within pages to stack vertically." },
+        { "wxRIBBON_BAR_SHOW_PANEL_EXT_BUTTONS", "Causes extension buttons to be shown on panels (where the panel has such a button)." },
+        { "wxRIBBON_BAR_SHOW_PANEL_MINIMISE_BUTTONS", "Causes minimise buttons to be shown on panels (where the panel has such a button)." },
+        { "wxRIBBON_BAR_SHOW_TOGGLE_BUTTON", "Causes a toggle button to appear on the ribbon bar at top-right corner." },
+        { "wxRIBBON_BAR_SHOW_HELP_BUTTON", "Causes a help button to appear on the ribbon bar at the top-right corner." },
+        { "wxRIBBON_PANEL_DEFAULT_STYLE", "Defined as no other flags set." },
+        { "wxRIBBON_PANEL_NO_AUTO_MINIMISE", "Prevents the panel from automatically minimizing to conserve screen space." },
+        { "wxRIBBON_PANEL_EXT_BUTTON", "Causes an extension button to be shown in the panel's chrome (if the bar in which it is contained has wxRIBBON_BAR_SHOW_PANEL_EXT_BUTTONS set). The behaviour of this button is application controlled, but typically will show an extended drop-down menu relating to the panel." },
+        { "wxRIBBON_PANEL_MINIMISE_BUTTON", "Causes a (de)minimise button to be shown in the panel's chrome (if the bar in which it is contained has the wxRIBBON_BAR_SHOW_PANEL_MINIMISE_BUTTONS style set). This flag is typically combined with wxRIBBON_PANEL_NO_AUTO_MINIMISE to make a panel which the user always has manual control over when it minimizes." },
+        { "wxRIBBON_PANEL_STRETCH", "Stretches a single panel to fit the parent page." },
+        { "wxRIBBON_PANEL_FLEXIBLE", "Allows the panel to size in both directions; currently only useful when a single wxRibbonToolBar is the child of the panel, particularly in vertical orientation where the number of rows is dependent on the amount of horizontal space available. Set the minimum and maximum toolbar rows to take full advantage of this wrapping behaviour." },
+        { "wxRIBBON_BUTTON_NORMAL", "Normal button or tool with a clickable area which causes some generic action." },
+        { "wxRIBBON_BUTTON_DROPDOWN", "Dropdown button or tool with a clickable area which typically causes a dropdown menu." },
+        { "wxRIBBON_BUTTON_HYBRID", "Button or tool with two clickable areas - one which causes a dropdown menu, and one which causes a generic action." },
+        { "wxRIBBON_BUTTON_TOGGLE", "Normal button or tool with a clickable area which toggles the button between a pressed and unpressed state." },
+        { "wxRIBBON_BUTTON_NORMAL", "Normal button or tool with a clickable area which causes some generic action." },
+        { "wxRIBBON_BUTTON_DROPDOWN", "Dropdown button or tool with a clickable area which typically causes a dropdown menu." },
+        { "wxRIBBON_BUTTON_HYBRID", "Button or tool with two clickable areas - one which causes a dropdown menu, and one which causes a generic action." },
+        { "wxRIBBON_BUTTON_TOGGLE", "Normal button or tool with a clickable area which toggles the button between a pressed and unpressed state." },
+        { "wxCB_SIMPLE", "Creates a combobox with a permanently displayed list. Windows only." },
+        { "wxCB_DROPDOWN", "Creates a combobox with a drop-down list. Windows and Motif only." },
+        { "wxCB_READONLY", "A combobox with this style behaves like a wxChoice (and may look in the same way as well, although this is platform-dependent). It allows the user to choose from the list of options but doesn't allow the user to enter a value not present in the list." },
+        { "wxCB_SORT", "Sorts the entries alphabetically." },
+        { "wxTE_PROCESS_ENTER", "The control will generate the event wxEVT_TEXT_ENTER (otherwise pressing Enter key is either processed internally by the control or used for navigation between dialog controls)." },
+        { "wxCB_READONLY", "Creates a combobox without a text editor. On some platforms the control may appear very different when this style is used." },
+        { "wxCB_SORT", "Sorts the entries alphabetically." },
+        { "wxTE_PROCESS_ENTER", "The control will generate the event wxEVT_TEXT_ENTER (otherwise pressing Enter key is either processed internally by the control or used for navigation between dialog controls). Windows only." },
+        { "wxCB_SORT", "Sorts the entries alphabetically." },
+        { "wxLB_SINGLE", "Single-selection list." },
+        { "wxLB_MULTIPLE", "Multiple-selection list: the user can toggle multiple items on and off. This is the same as wxLB_EXTENDED in wxGTK2 port." },
+        { "wxLB_EXTENDED", "Extended-selection list: the user can extend the selection by using SHIFT or CTRL keys together with the cursor movement keys or the mouse." },
+        { "wxLB_HSCROLL", "Create a horizontal scrollbar if contents are too wide (Windows only)." },
+        { "wxLB_ALWAYS_SB", "Always show a vertical scrollbar." },
+        { "wxLB_NEEDED_SB", "Only create a vertical scrollbar if needed." },
+        { "wxLB_NO_SB", "Don't create a vertical scrollbar (Windows only)." },
+        { "wxLB_SORT", "The listbox contents are sorted in alphabetical order." },
+        { "wxHLB_DEFAULT_STYLE", "The default style: wxBORDER_SUNKEN." },
+        { "wxHLB_MULTIPLE", "Multiple-selection list: the user can toggle multiple items on and off." },
+        { "wxLB_SINGLE", "Single-selection list." },
+        { "wxLB_MULTIPLE", "Multiple-selection list: the user can toggle multiple items on and off. This is the same as wxLB_EXTENDED in wxGTK2 port." },
+        { "wxLB_EXTENDED", "Extended-selection list: the user can extend the selection by using SHIFT or CTRL keys together with the cursor movement keys or the mouse." },
+        { "wxLB_HSCROLL", "Create a horizontal scrollbar if contents are too wide (Windows only)." },
+        { "wxLB_ALWAYS_SB", "Always show a vertical scrollbar." },
+        { "wxLB_NEEDED_SB", "Only create a vertical scrollbar if needed." },
+        { "wxLB_NO_SB", "Don't create a vertical scrollbar (Windows only)." },
+        { "wxLB_SORT", "The listbox contents are sorted in alphabetical order." },
+        { "rows", "Buttons are arranged vertically (in rows)." },
+        { "columns", "Buttons are arranged horizontally (in columns).." },
+        { "wxALIGN_RIGHT", "Aligns the checkbox to the right of the text instead of the left." },
+        { "wxCHK_UNCHECKED", "The checkbox is unchecked." },
+        { "wxCHK_CHECKED", "The checkbox is checked." },
+        { "wxCHK_UNDETERMINED", "The checkbox is undetermined." },
+        { "wxALIGN_RIGHT", "Aligns the checkbox to the right of the text instead of the left." },
+        { "wxCHK_ALLOW_3RD_STATE_FOR_USER", "If selected, the user can set the checkbox to the third state by clicking." },
+        { "wxRB_GROUP", "Marks the beginning of a new group of radio buttons." },
+        { "wxRB_SINGLE", "Creates a radio button which is not part of any radio button group. When this style is used, no other radio buttons will be turned off automatically when this button is checked." },
+        { "wxALIGN_RIGHT", "Aligns the radio button to the right of the text instead of the left." },
+        { "wxBU_BOTTOM", "Aligns the label to the bottom of the button. Windows and GTK+ only." },
+        { "wxBU_LEFT", "Left-justifies the label. Windows and GTK+ only." },
+        { "wxBU_RIGHT", "Right-justifies the bitmap label. Windows and GTK+ only." },
+        { "wxBU_TOP", "Aligns the label to the top of the button. Windows and GTK+ only." },
+        { "wxBU_EXACTFIT", "By default, all buttons are made of at least the standard button size, even if their contents is small enough to fit into a smaller size. This is done for consistency as most platforms use buttons of the same size in the native dialogs, but can be overridden by specifying this flag. If it is given, the button will be made just big enough for its contents. Notice that under MSW the button will still have at least the standard height, even with this style, if it has a non-empty label." },
+        { "wxBU_NOTEXT", "Disables the display of the text label in the button even if it has one or its id is one of the standard stock ids with an associated label: without using this style a button which is only supposed to show a bitmap but uses a standard id would display a label too." },
+        { "wxBORDER_NONE", "Creates a button without border. This is currently implemented in MSW, GTK2 and OSX/Cocoa and OSX/Carbon ports. In OSX/Carbon this only applies to buttons with bitmaps and using bitmap of one of the standard sizes only, namely 128*128, 48*48, 24*24 or 16*16. In all the other cases wxBORDER_NONE is ignored under OSX/Carbon (these restrictions don't exist in OSX/Cocoa however)." },
+        { "wxSP_ARROW_KEYS", "The user can use arrow keys to change the value." },
+        { "wxSP_WRAP", "The value wraps at the minimum and maximum." },
+        { "wxTE_PROCESS_ENTER", "The control will generate the event wxEVT_TEXT_ENTER (otherwise pressing Enter key is either processed internally by the control or used for navigation between dialog controls)." },
+        { "wxALIGN_LEFT", "Same as wxTE_LEFT for wxTextCtrl: the text is left aligned." },
+        { "wxALIGN_CENTER_HORIZONTAL", "Same as wxTE_CENTER for wxTextCtrl: the text is centered." },
+        { "wxALIGN_RIGHT", "Same as wxTE_RIGHT for wxTextCtrl: the text is right aligned (this is the default)." },
+        { "wxSP_ARROW_KEYS", "The user can use arrow keys to change the value." },
+        { "wxSP_WRAP", "The value wraps at the minimum and maximum." },
+        { "wxTE_PROCESS_ENTER", "The control will generate the event wxEVT_TEXT_ENTER (otherwise pressing Enter key is either processed internally by the control or used for navigation between dialog controls)." },
+        { "wxALIGN_LEFT", "Same as wxTE_LEFT for wxTextCtrl: the text is left aligned." },
+        { "wxALIGN_CENTER_HORIZONTAL", "Same as wxTE_CENTER for wxTextCtrl: the text is centered." },
+        { "wxALIGN_RIGHT", "Same as wxTE_RIGHT for wxTextCtrl: the text is right aligned (this is the default)." },
+        { "wxSP_HORIZONTAL", "Specifies a horizontal spin button (note that this style is not supported in wxGTK)." },
+        { "wxSP_VERTICAL", "Specifies a vertical spin button." },
+        { "wxSP_ARROW_KEYS", "The user can use arrow keys to change the value." },
+        { "wxSP_WRAP", "The value wraps at the minimum and maximum." },
+        { "wxBU_LEFT", "Left-justifies the label. Windows and GTK+ only." },
+        { "wxBU_TOP", "Aligns the label to the top of the button. Windows and GTK+ only." },
+        { "wxBU_RIGHT", "Right-justifies the bitmap label. Windows and GTK+ only." },
+        { "wxBU_BOTTOM", "Aligns the label to the bottom of the button. Windows and GTK+ only." },
+        { "wxBU_EXACTFIT", "By default, all buttons are made of at least the standard button size, even if their contents is small enough to fit into a smaller size. This is done for consistency as most platforms use buttons of the same size in the native dialogs, but can be overridden by specifying this flag. If it is given, the button will be made just big enough for its contents. Notice that under MSW the button will still have at least the standard height, even with this style, if it has a non-empty label." },
+        { "wxBU_NOTEXT", "Disables the display of the text label in the button even if it has one or its id is one of the standard stock ids with an associated label: without using this style a button which is only supposed to show a bitmap but uses a standard id would display a label too." },
+        { "wxBORDER_NONE", "Creates a button without border. This is currently implemented in MSW, GTK2 and OSX/Cocoa and OSX/Carbon ports but in the latter only applies to buttons with bitmaps and using bitmap of one of the standard sizes only, namely 128*128, 48*48, 24*24 or 16*16. In all the other cases wxBORDER_NONE is ignored under OSX/Carbon (these restrictions don't exist in OSX/Cocoa however)." },
+        { "wxBU_EXACTFIT", "If specified, the button will be made just big enough for its contents." },
+        { "wxBORDER_NONE", "Creates a button without a border. This is currently implemented in MSW, GTK2 and OSX/Cocoa and OSX/Carbon ports. In OSX it only applies to bitmaps of one of the standard sizes, namely 128*128, 48*48, 24*24 or 16*16. In all the other cases wxBORDER_NONE is ignored under OSX/Carbon (these restrictions don't exist in OSX/Cocoa however)." },
+        { "wxSPLIT_VERTICAL", "Specifies a vertical split window." },
+        { "wxSPLIT_HORIZONTAL", "Specifies a horizontal split window." },
+        { "wxSP_3D", "Draws a 3D effect border and sash." },
+        { "wxSP_3DSASH", "Draws a 3D effect sash (part of default style)." },
+        { "wxSP_3DBORDER", "Synonym for wxSP_BORDER." },
+        { "wxSP_BORDER", "Draws a standard border." },
+        { "wxSP_NOBORDER", "No border (default)." },
+        { "wxSP_NOSASH", "Sets the sash to be invisible, even when the window is split. This prevents the user to resize the windows." },
+        { "wxSP_THIN_SASH", "Draws a thin sash." },
+        { "wxSP_NO_XP_THEME", "Under Windows XP, switches off the attempt to draw the splitter using Windows XP theming, so the borders and sash will take on the pre-XP look." },
+        { "wxSP_PERMIT_UNSPLIT", "Always allow to unsplit, even with the minimum pane size other than zero." },
+        { "wxSP_LIVE_UPDATE", "Don't draw XOR line but resize the child windows immediately." },
+        { "wxCP_DEFAULT_STYLE", "The default style. It includes wxTAB_TRAVERSAL and wxBORDER_NONE." },
+        { "wxCP_NO_TLW_RESIZE", "By default wxCollapsiblePane resizes the top level window containing it when its own size changes. This allows you to implement dialogs containing an optionally shown part. Set this flag to disable the automatic resizing of the parent." },
+        { "wxCHB_DEFAULT", "Choose the default location for the labels depending on the current platform (but currently it's the same everywhere, namely wxCHB_TOP)." },
+        { "wxCHB_TOP", "Place labels above the page area." },
+        { "wxCHB_LEFT", "Place labels on the left side." },
+        { "wxCHB_RIGHT", "Place labels on the right side." },
+        { "wxCHB_BOTTOM", "Place labels below the page area." },
+        { "wxBK_DEFAULT", "Default location for the labels depending on the current platform (left everywhere except Mac where it is top)." },
+        { "wxBK_TOP", "Place labels above the page area." },
+        { "wxBK_LEFT", "Place labels on the left side." },
+        { "wxBK_RIGHT", "Place labels on the right side." },
+        { "wxBK_BOTTOM", "Place labels below the page area." },
+        { "wxAuiDefaultTabArt", "Use bitmap art and a colour scheme that is adapted to the major platforms' look." },
+        { "wxAuiGenericTabArt", "Use platform-specific bitmap art and colour schemes on MSW and GTK, and wxAuiDefaultTabArt on Mac." },
+        { "wxAuiSimpleTabArt", "Use a simple art and colour scheme with a slanted left side for the tabs." },
+        { "wxAUI_NB_CLOSE_BUTTON", "Adds a close button on the tab bar." },
+        { "wxAUI_NB_CLOSE_ON_ACTIVE_TAB", "Adds a close button on the active tab." },
+        { "wxAUI_NB_CLOSE_ON_ALL_TABS", "Adds a close button on all tabs." },
+        { "wxAUI_NB_MIDDLE_CLICK_CLOSE", "With this style, middle click on a tab closes the tab." },
+        { "wxAUI_NB_SCROLL_BUTTONS", "Display left and right scroll buttons." },
+        { "wxAUI_NB_TAB_EXTERNAL_MOVE", "Allows a tab to be moved to another tab control." },
+        { "wxAUI_NB_TAB_FIXED_WIDTH", "Display all tabs with the same width." },
+        { "wxAUI_NB_TAB_MOVE", "Allows a tab to be moved horizontally by dragging." },
+        { "wxAUI_NB_TAB_SPLIT", "Allows the tab control to be split by dragging a tab." },
+        { "wxAUI_NB_BOTTOM", "Place tabs under instead of above the book pages. Cannot be combined with wxAUI_NB_TOP." },
+        { "wxAUI_NB_TOP", "Place tabs on the top side. Cannot be combined with wxAUI_NB_BOTTOM." },
+        { "wxAUI_NB_WINDOWLIST_BUTTON", "With this style, a drop-down list of tabs is available. This menu can be displayed by calling ShowWindowMenu()." },
+        { "wxBK_DEFAULT", "Default placement of tabs (currently top on all platforms)." },
+        { "wxBK_TOP", "Place tabs on the top side." },
+        { "wxBK_BOTTOM", "Place tabs under instead of above the book pages." },
+        { "wxBK_LEFT", "Place tabs on the left side." },
+        { "wxBK_RIGHT", "Place tabs on the right side." },
+        { "wxNB_FIXEDWIDTH", "All tabs will have same width. (Windows only)" },
+        { "wxNB_MULTILINE", "There can be several rows of tabs. (Windows only)" },
+        { "wxNB_NOPAGETHEME", "Display a solid colour on notebook pages, and not a gradient, which can reduce performance. (Windows only)" },
+        { "wxTBK_HORZ_LAYOUT", "Shows the text and the icons alongside, not vertically stacked (only implement under Windows and GTK 2 platforms as it relies on wxTB_HORZ_LAYOUT flag support)." },
+        { "wxBK_DEFAULT", "Default placement of tab (currently, positioned on the left)." },
+        { "wxBK_TOP", "Place tab on the top side." },
+        { "wxBK_BOTTOM", "Place tab under instead of above the book pages." },
+        { "wxBK_LEFT", "Place tabs on the left side." },
+        { "wxBK_RIGHT", "Place tab on the right side." },
+        { "wxNB_NOPAGETHEME", "Display a solid colour on treebook pages, and not a gradient, which can reduce performance. (Windows only)" },
+        { "no effects", "No effect, equivalent to normal wxWindow::Show() or Hide() call." },
+        { "roll to left", "Roll window to the left." },
+        { "roll to right", "Roll window to the right." },
+        { "roll to top", "Roll window to the top." },
+        { "roll to bottom", "Roll window to the bottom." },
+        { "slide to left", "Slide window to the left." },
+        { "slide to right", "Slide window to the right." },
+        { "slide to top", "Slide window to the top." },
+        { "slide to bottom", "Slide window to the bottom." },
+        { "blend", "Fade in or out effect." },
+        { "expand", "Expanding or collapsing effect." },
+        { "no effects", "No effect, equivalent to normal wxWindow::Show() or Hide() call." },
+        { "roll to left", "Roll window to the left." },
+        { "roll to right", "Roll window to the right." },
+        { "roll to top", "Roll window to the top." },
+        { "roll to bottom", "Roll window to the bottom." },
+        { "slide to left", "Slide window to the left." },
+        { "slide to right", "Slide window to the right." },
+        { "slide to top", "Slide window to the top." },
+        { "slide to bottom", "Slide window to the bottom." },
+        { "blend", "Fade in or out effect." },
+        { "expand", "Expanding or collapsing effect." },
+        { "wxLC_ICON", "Large icon view, with optional labels." },
+        { "wxLC_SMALL_ICON", "Small icon view, with optional labels." },
+        { "wxLC_LIST", "Multicolumn list view, with optional small icons. Columns are computed automatically, i.e. you don't set columns as in wxLC_REPORT. In other words, the list wraps, unlike a wxListBox." },
+        { "wxLC_REPORT", "Single or multicolumn report view, with optional header." },
+        { "wxLC_VIRTUAL", "The application provides items text on demand. May only be used with wxLC_REPORT." },
+        { "wxLC_ALIGN_TOP", "Icons align to the top. Win32 default, Win32 only." },
+        { "wxLC_ALIGN_LEFT", "Icons align to the left." },
+        { "wxLC_AUTOARRANGE", "Icons arrange themselves. Win32 only." },
+        { "wxLC_EDIT_LABELS", "Labels are editable: the application will be notified when editing starts." },
+        { "wxLC_NO_HEADER", "No header in report mode." },
+        { "wxLC_SINGLE_SEL", "Single selection (default is multiple)." },
+        { "wxLC_SORT_ASCENDING", "Sort in ascending order. (You must still supply a comparison callback in wxListView::SortItems.)" },
+        { "wxLC_SORT_DESCENDING", "Sort in descending order. (You must still supply a comparison callback in wxListView::SortItems.)" },
+        { "wxLC_HRULES", "Draws light horizontal rules between rows in report mode." },
+        { "wxLC_VRULES", "Draws light vertical rules between columns in report mode." },
+        { "wxEL_ALLOW_NEW", "Allows the user to enter new strings." },
+        { "wxEL_ALLOW_EDIT", "Allows the user to edit existing strings." },
+        { "wxEL_ALLOW_DELETE", "Allows the user to delete existing strings." },
+        { "wxEL_NO_REORDER", "Does not allow the user to reorder the strings. " },
+        { "wxDV_SINGLE", "Single selection mode. This is the default." },
+        { "wxDV_MULTIPLE", "Multiple selection mode." },
+        { "wxDV_ROW_LINES", "Use alternating colours for rows if supported by platform and theme. Currently only supported by the native GTK and OS X implementations but not by the generic one." },
+        { "wxDV_HORIZ_RULES", "Display the separator lines between rows" },
+        { "wxDV_VERT_RULES", "Display the separator lines between columns." },
+        { "wxDV_VARIABLE_LINE_HEIGHT", "Allow variable line heights. This can be inefficient when displaying large number of items." },
+        { "wxDV_NO_HEADER", "Do not show column headers (which are shown by default)." },
+        { "wxDV_SINGLE", "Single selection mode. This is the default." },
+        { "wxDV_MULTIPLE", "Multiple selection mode." },
+        { "wxDV_ROW_LINES", "Use alternating colours for rows if supported by platform and theme. Currently only supported by the native GTK and OS X implementations but not by the generic one." },
+        { "wxDV_HORIZ_RULES", "Display the separator lines between rows" },
+        { "wxDV_VERT_RULES", "Display the separator lines between columns." },
+        { "wxDV_VARIABLE_LINE_HEIGHT", "Allow variable line heights. This can be inefficient when displaying large number of items." },
+        { "wxDV_NO_HEADER", "Do not show column headers (which are shown by default)." },
+        { "wxDV_SINGLE", "Single selection mode. This is the default." },
+        { "wxDV_MULTIPLE", "Multiple selection mode." },
+        { "wxDV_ROW_LINES", "Use alternating colours for rows if supported by platform and theme. Currently only supported by the native GTK and OS X implementations but not by the generic one." },
+        { "wxDV_HORIZ_RULES", "Display the separator lines between rows" },
+        { "wxDV_VERT_RULES", "Display the separator lines between columns." },
+        { "wxDV_VARIABLE_LINE_HEIGHT", "Allow variable line heights. This can be inefficient when displaying large number of items." },
+        { "wxDV_NO_HEADER", "Do not show column headers (which are shown by default)." },
+        { "Text", "Appends a text column to the control and the store." },
+        { "Bitmap", "Appends a column for rendering a bitmap." },
+        { "Date", "Appends a column for rendering a date." },
+        { "Toggle", "Appends a toggle column to the control and the store." },
+        { "Progress", "Appends a progress column to the control and the store." },
+        { "IconText", "Appends an icon-and-text column to the control and the store." },
+        { "wxDATAVIEW_CELL_INERT", "The cell only displays information and cannot be manipulated or otherwise interacted with in any way." },
+        { "wxDATAVIEW_CELL_ACTIVATABLE", "Indicates that the cell can be activated by clicking it or using keyboard." },
+        { "wxDATAVIEW_CELL_EDITABLE", "Indicates that the user can edit the data in-place in an inline editor control that will show up when the user wants to edit the cell." },
+        { "wxALIGN_LEFT", "Align the item to the left." },
+        { "wxALIGN_TOP", "Align the item to the top." },
+        { "wxALIGN_RIGHT", "Align the item to the right." },
+        { "wxALIGN_BOTTOM", "Align the item to the bottom." },
+        { "wxALIGN_CENTER", "Align the item to the center." },
+        { "wxALIGN_CENTER_HORIZONTAL", "Align the item to the horizontal center." },
+        { "wxALIGN_CENTER_VERTICAL", "Align the item to the vertical." },
+        { "wxDATAVIEW_COL_RESIZABLE", "Column can be resized." },
+        { "wxDATAVIEW_COL_SORTABLE", "Column can be clicked to toggle the sort order by its contents." },
+        { "wxDATAVIEW_COL_REORDERABLE", "Column can be dragged to change its order." },
+        { "wxDATAVIEW_COL_HIDDEN", "Column is not shown at all." },
+        { "", "" },
+        { "wxELLIPSIZE_NONE", "Don't ellipsize the text at all." },
+        { "wxELLIPSIZE_START", "Put the ellipsis at the start of the string, if the string needs ellipsization." },
+        { "wxELLIPSIZE_MIDDLE", "Put the ellipsis in the middle of the string, if the string needs ellipsization." },
+        { "wxELLIPSIZE_END", "Put the ellipsis at the end of the string, if the string needs ellipsization." },
+        { "Text", "Appends a text column to the control and the store." },
+        { "Toggle", "Appends a toggle column to the control and the store." },
+        { "Progress", "Appends a progress column to the control and the store." },
+        { "IconText", "Appends an icon-and-text column to the control and the store." },
+        { "wxDATAVIEW_CELL_INERT", "The cell only displays information and cannot be manipulated or otherwise interacted with in any way." },
+        { "wxDATAVIEW_CELL_ACTIVATABLE", "Indicates that the cell can be activated by clicking it or using keyboard." },
+        { "wxDATAVIEW_CELL_EDITABLE", "Indicates that the user can edit the data in-place in an inline editor control that will show up when the user wants to edit the cell." },
+        { "wxALIGN_LEFT", "Align the item to the left." },
+        { "wxALIGN_TOP", "Align the item to the top." },
+        { "wxALIGN_RIGHT", "Align the item to the right." },
+        { "wxALIGN_BOTTOM", "Align the item to the bottom." },
+        { "wxALIGN_CENTER", "Align the item to the center." },
+        { "wxALIGN_CENTER_HORIZONTAL", "Align the item to the horizontal center." },
+        { "wxALIGN_CENTER_VERTICAL", "Align the item to the vertical." },
+        { "wxDATAVIEW_COL_RESIZABLE", "Column can be resized." },
+        { "wxDATAVIEW_COL_SORTABLE", "Column can be clicked to toggle the sort order by its contents." },
+        { "wxDATAVIEW_COL_REORDERABLE", "Column can be dragged to change its order." },
+        { "wxDATAVIEW_COL_HIDDEN", "Column is not shown at all." },
+        { "", "" },
+        { "wxELLIPSIZE_NONE", "Don't ellipsize the text at all." },
+        { "wxELLIPSIZE_START", "Put the ellipsis at the start of the string, if the string needs ellipsization." },
+        { "wxELLIPSIZE_MIDDLE", "Put the ellipsis in the middle of the string, if the string needs ellipsization." },
+        { "wxELLIPSIZE_END", "Put the ellipsis at the end of the string, if the string needs ellipsization." },
+        { "wxGridSelectCells", "Select individual cells as well as of the entire rows and columns. This is the default." },
+        { "wxGridSelectColumns", "Select entire columns only." },
+        { "wxGridSelectRows", "Select entire rows only." },
+        { "wxGridSelectRowsOrColumns", "Select either the entire columns or the entire rows but not individual cells nor blocks." },
+        { "wxGridSelectNone", "No selections can be made. The user won't be able to select any cells in this mode." },
+        { "clip", "" },
+        { "ellipsize", "" },
+        { "overflow", "" },
+        { "wxALIGN_LEFT", "Align left." },
+        { "wxALIGN_CENTER", "Align centered." },
+        { "wxALIGN_RIGHT", "Align right." },
+        { "wxALIGN_TOP", "Align top." },
+        { "wxALIGN_CENTER", "Align centered." },
+        { "wxALIGN_BOTTOM", "Align bottom." },
+        { "wxALIGN_LEFT", "Align labels left." },
+        { "wxALIGN_CENTER", "Align labels centered." },
+        { "wxALIGN_RIGHT", "Align labels right." },
+        { "wxALIGN_TOP", "Align labels top." },
+        { "wxALIGN_CENTER", "Align labels centered." },
+        { "wxALIGN_BOTTOM", "Align labels bottom." },
+        { "wxALIGN_LEFT", "Align labels left." },
+        { "wxALIGN_CENTER", "Align labels centered." },
+        { "wxALIGN_RIGHT", "Align labels right." },
+        { "wxALIGN_TOP", "Align labels top." },
+        { "wxALIGN_CENTER", "Align labels centered." },
+        { "wxALIGN_BOTTOM", "Align labels bottom." },
+        { "Tab_Stop", "Do nothing. This is the default." },
+        { "Tab_Wrap", "Move to the beginning of the next (or the end of the previous) row." },
+        { "Tab_Leave", "Move to the next (or the previous) control after the grid." },
+        { "wxPG_AUTO_SORT", "This will cause Sort() automatically after an item is added. When inserting a lot of items in this mode, it may make sense to use Freeze() before operations and Thaw() afterwards to increase performance." },
+        { "wxPG_HIDE_CATEGORIES", "Categories are not initially shown (even if added)." },
+        { "wxPG_ALPHABETIC_MODE", "This style combines non-categoric mode and automatic sorting." },
+        { "wxPG_BOLD_MODIFIED", "Modified values are shown in bold font." },
+        { "wxPG_SPLITTER_AUTO_CENTER", "When wxPropertyGrid is resized, splitter moves to the center. This behaviour stops once the user manually moves the splitter." },
+        { "wxPG_TOOLTIPS", "Display tooltips for cell text that cannot be shown completely. If wxUSE_TOOLTIPS is 0, then this doesn't have any effect." },
+        { "wxPG_HIDE_MARGIN", "Disables margin and hides all expand/collapse buttons that would appear outside the margin (for sub-properties). Toggling this style automatically expands all collapsed items." },
+        { "wxPG_STATIC_SPLITTER", "This style prevents user from moving the splitter." },
+        { "wxPG_STATIC_LAYOUT", "Combination of other styles that make it impossible for user to modify the layout." },
+        { "wxPG_LIMITED_EDITING", "Disables wxTextCtrl based editors for properties which can be edited in another way." },
+        { "wxPG_DEFAULT_STYLE", "Combines various styles." },
+        { "wxTAB_TRAVERSAL", "wxTAB_TRAVERSAL allows using Tab/Shift-Tab to travel between properties in grid. Traveling forwards from last property will navigate to the next control, and backwards from first will navigate to the previous one." },
+        { "wxPG_EX_INIT_NOCAT", "Speeds up switching to wxPG_HIDE_CATEGORIES mode. Initially, if wxPG_HIDE_CATEGORIES is not defined, the non-categorized data storage is not activated, and switching the mode first time becomes somewhat slower. wxPG_EX_INIT_NOCAT activates the non-categorized data storage right away. IMPORTANT NOTE: If you do plan not switching to non-categoric mode, or if you don't plan to use categories at all, then using this style will result in waste of resources." },
+        { "wxPG_EX_HELP_AS_TOOLTIPS", "Show property help strings as tool tips instead as text on the status bar." },
+        { "wxPG_EX_NATIVE_DOUBLE_BUFFERING", "Allows relying on native double-buffering." },
+        { "wxPG_EX_AUTO_UNSPECIFIED_VALUES", "Set this style to let user have ability to set values of properties to unspecified state. Same as setting wxPG_PROP_AUTO_UNSPECIFIED for all properties." },
+        { "wxPG_EX_WRITEONLY_BUILTIN_ATTRIBUTES", "If this style is used, built-in attributes (such as wxPG_FLOAT_PRECISION and wxPG_STRING_PASSWORD) are not stored into property's attribute storage (thus they are not readable). Note that this option is global, and applies to all wxPG property containers." },
+        { "wxPG_EX_MULTIPLE_SELECTION", "Allows multiple properties to be selected by user (by pressing SHIFT when clicking on a property, or by dragging with left mouse button down)." },
+        { "wxPG_EX_ENABLE_TLP_TRACKING", "This enables top-level window tracking which allows wxPropertyGrid to notify the application of last-minute property value changes by user. This style is not enabled by default because it may cause crashes when wxPropertyGrid is used with wxAUI or similar system. If you are not in fact using any system that may change wxPropertyGrid's top-level parent window on its own, then it is recommended to enable this style." },
+        { "wxPG_AUTO_SORT", "This will cause Sort() automatically after an item is added. When inserting a lot of items in this mode, it may make sense to use Freeze() before operations and Thaw() afterwards to increase performance." },
+        { "wxPG_HIDE_CATEGORIES", "Categories are not initially shown (even if added)." },
+        { "wxPG_ALPHABETIC_MODE", "This style combines non-categoric mode and automatic sorting." },
+        { "wxPG_BOLD_MODIFIED", "Modified values are shown in bold font." },
+        { "wxPG_SPLITTER_AUTO_CENTER", "When wxPropertyGrid is resized, splitter moves to the center. This behaviour stops once the user manually moves the splitter." },
+        { "wxPG_TOOLTIPS", "Display tooltips for cell text that cannot be shown completely. If wxUSE_TOOLTIPS is 0, then this doesn't have any effect." },
+        { "wxPG_HIDE_MARGIN", "Disables margin and hides all expand/collapse buttons that would appear outside the margin (for sub-properties). Toggling this style automatically expands all collapsed items." },
+        { "wxPG_STATIC_SPLITTER", "This style prevents user from moving the splitter." },
+        { "wxPG_STATIC_LAYOUT", "Combination of other styles that make it impossible for user to modify the layout." },
+        { "wxPG_LIMITED_EDITING", "Disables wxTextCtrl based editors for properties which can be edited in another way." },
+        { "wxTAB_TRAVERSAL", "wxTAB_TRAVERSAL allows using Tab/Shift-Tab to travel between properties in grid. Traveling forwards from last property will navigate to the next control, and backwards from first will navigate to the previous one." },
+        { "wxPG_COMPACTOR", "Show compactor button that toggles hidden state of low-priority properties." },
+        { "wxPGMAN_DEFAULT_STYLE", "Currently the default is for no styles to be set." },
+        { "wxPG_DESCRIPTION", "Show adjustable text box showing description or help text, if available, for currently selected property." },
+        { "wxPG_TOOLBAR", "Show toolbar for mode and page selection." },
+        { "wxPG_NO_INTERNAL_BORDER", "Don't show an internal border around the property grid. Recommended if you use a header." },
+        { "wxPG_EX_INIT_NOCAT", "Speeds up switching to wxPG_HIDE_CATEGORIES mode. Initially, if wxPG_HIDE_CATEGORIES is not defined, the non-categorized data storage is not activated, and switching the mode first time becomes somewhat slower. wxPG_EX_INIT_NOCAT activates the non-categorized data storage right away. IMPORTANT NOTE: If you do plan not switching to non-categoric mode, or if you don't plan to use categories at all, then using this style will result in waste of resources." },
+        { "wxPG_EX_NO_FLAT_TOOLBAR", "Extended window style that sets wxPropertyGridManager toolbar to not use flat style." },
+        { "wxPG_EX_MODE_BUTTONS", "Shows alphabetic/categoric mode buttons from toolbar." },
+        { "wxPG_EX_HELP_AS_TOOLTIPS", "Show property help strings as tool tips instead as text on the status bar." },
+        { "wxPG_EX_NATIVE_DOUBLE_BUFFERING", "Allows relying on native double-buffering." },
+        { "wxPG_EX_AUTO_UNSPECIFIED_VALUES", "Set this style to let user have ability to set values of properties to unspecified state. Same as setting wxPG_PROP_AUTO_UNSPECIFIED for all properties." },
+        { "wxPG_EX_WRITEONLY_BUILTIN_ATTRIBUTES", "If this style is used, built-in attributes (such as wxPG_FLOAT_PRECISION and wxPG_STRING_PASSWORD) are not stored into property's attribute storage (thus they are not readable). Note that this option is global, and applies to all wxPG property containers." },
+        { "wxPG_EX_HIDE_PAGE_BUTTONS", "Hides page selection buttons from tool bar." },
+        { "wxPG_EX_MULTIPLE_SELECTION", "Allows multiple properties to be selected by user (by pressing SHIFT when clicking on a property, or by dragging with left mouse button down)." },
+        { "wxPG_EX_ENABLE_TLP_TRACKING", "This enables top-level window tracking which allows wxPropertyGrid to notify the application of last-minute property value changes by user. This style is not enabled by default because it may cause crashes when wxPropertyGrid is used in with wxAUI or similar system. If you are not in fact using any system that may change wxPropertyGrid's top-level parent window on its own, then you are recommended to enable this style." },
+        { "wxPG_EX_NO_TOOLBAR_DIVIDER", "Don't show divider above toolbar, on Windows." },
+        { "wxPG_EX_TOOLBAR_SEPARATOR", "Show a separator below the toolbar." },
+        { "Category", "Append properties category." },
+        { "ArrayString", "Property that manages a list of strings. Allows editing of a list of strings in wxTextCtrl and in a separate dialog." },
+        { "Bool", "Represents a boolean value. wxChoice is used as editor control, by default." },
+        { "Colour", "Represents wxColour. wxButton is used to trigger a colour picker dialog." },
+        { "Cursor", "Represents a wxCursor. wxChoice is used to edit the value." },
+        { "Date", "Represents wxDateTime. Default editor is DatePickerCtrl, although TextCtrl should work as well." },
+        { "Dir", "Represents wxString. Button triggers a directory selector." },
+        { "EditEnum", "Represents a string that can be freely edited or selected from list of choices" },
+        { "Enum", "Represents a single selection from a list of choices - wxOwnerDrawnComboBox is used to edit the value." },
+        { "File", "Represents wxString. Button triggers a file selector." },
+        { "Flags", "Represents a bit set that fits in a long integer." },
+        { "Float", "Represents a double-precision floating point." },
+        { "Font", "Represents wxFont. Various sub-properties are used to edit individual subvalues." },
+        { "ImageFile", "Represents an image file(name). It displays a thumbnail of the image in front of the filename" },
+        { "Int", "Represents a signed long integer. Seamlessly supports 64-bit integers (i.e. wxLongLong) on overflow." },
+        { "LongString", "Represents wxString. Has a button that triggers a small text editor dialog." },
+        { "MultiChoice", "Represents wxArrayString. Allows editing a multiple selection from a list of strings." },
+        { "String", "Represents wxString" },
+        { "SystemColour", "Represents wxColour and a system colour index. wxChoice is used to edit the value." },
+        { "UInt", "Represents an unsigned long integer. Seamlessly supports 64-bit integers (i.e. wxLongLong) on overflow." },
+        { "wxTR_EDIT_LABELS", "Use this style if you wish the user to be able to edit labels in the tree control." },
+        { "wxTR_NO_BUTTONS", "For convenience to document that no buttons are to be drawn." },
+        { "wxTR_HAS_BUTTONS", "Use this style to show + and - buttons to the left of parent items." },
+        { "wxTR_TWIST_BUTTONS", "Selects alternative style of +/- buttons and shows rotating (\"twisting\") arrows instead. Currently this style is only implemented under Microsoft Windows Vista and later Windows versions and is ignored under the other platforms. Notice that under Vista this style results in the same appearance as used by the tree control in Explorer and other built-in programs and so using it may be preferable to the default style." },
+        { "wxTR_NO_LINES", "Use this style to hide vertical level connectors." },
+        { "wxTR_FULL_ROW_HIGHLIGHT", "Use this style to have the background colour and the selection highlight extend over the entire horizontal row of the tree control window. (This flag is ignored under Windows unless you specify wxTR_NO_LINES as well.)" },
+        { "wxTR_LINES_AT_ROOT", "Use this style to show lines between root nodes. Only applicable if wxTR_HIDE_ROOT is set and wxTR_NO_LINES is not set." },
+        { "wxTR_HIDE_ROOT", "Use this style to suppress the display of the root node, effectively causing the first-level nodes to appear as a series of root nodes." },
+        { "wxTR_ROW_LINES", "Use this style to draw a contrasting border between displayed rows." },
+        { "wxTR_HAS_VARIABLE_ROW_HEIGHT", "Use this style to cause row heights to be just big enough to fit the content. If not set, all rows use the largest row height. The default is that this flag is unset. Generic only." },
+        { "wxTR_SINGLE", "For convenience to document that only one item may be selected at a time. Selecting another item causes the current selection, if any, to be deselected. This is the default." },
+        { "wxTR_MULTIPLE", "Use this style to allow a range of items to be selected. If a second range is selected, the current range, if any, is deselected." },
+        { "wxTR_DEFAULT_STYLE", "The set of flags that are closest to the defaults for the native control for a particular toolkit." },
+        { "wxTL_SINGLE", "Single selection, this is the default." },
+        { "wxTL_MULTIPLE", "Allow multiple selection." },
+        { "wxTL_CHECKBOX", "Show the usual, 2 state, checkboxes for the items in the first column." },
+        { "wxTL_3STATE", "Show the checkboxes that can possibly be set by the program, but not the user, to a third, undetermined, state, for the items in the first column. Implies wxTL_CHECKBOX." },
+        { "wxTR_TWIST_BUTTONS", "Selects alternative style of +/- buttons and shows rotating (\"twisting\") arrows instead. Currently this style is only implemented under Microsoft Windows Vista and later Windows versions and is ignored under the other platforms. Notice that under Vista this style results in the same appearance as used by the tree control in Explorer and other built-in programs and so using it may be preferable to the default style." },
+        { "wxTL_USER_3STATE", "Same as wxTL_3STATE but the user can also set the checkboxes to the undetermined state. Implies wxTL_3STATE." },
+        { "wxTL_DEFAULT_STYLE", "Style used by the control by default, just wxTL_SINGLE currently." },
+        { "wxALIGN_LEFT", "Align the item to the left." },
+        { "wxALIGN_RIGHT", "Align the item to the right." },
+        { "wxALIGN_CENTER", "Align the item to the center." },
+        { "wxCOL_RESIZABLE", "Column can be resized (included in default flags)." },
+        { "wxCOL_SORTABLE", "Column can be clicked to toggle the sort order by its contents." },
+        { "wxCOL_REORDERABLE", "Column can be dragged to change its order (included in default). Currently, this is only implemented in GTK and ignored on other platforms." },
+        { "wxCOL_HIDDEN", "Column is not shown at all." },
+        { "wxDEFAULT_FRAME_STYLE", "Defined as wxMINIMIZE_BOX | wxMAXIMIZE_BOX | wxRESIZE_BORDER | wxSYSTEM_MENU | wxCAPTION | wxCLOSE_BOX | wxCLIP_CHILDREN" },
+        { "wxCAPTION", "Puts a caption on the frame." },
+        { "wxCLOSE_BOX", "Displays a close box on the frame." },
+        { "wxFRAME_TOOL_WINDOW", "Causes a frame with a small titlebar to be created; the frame does not appear in the taskbar under Windows or GTK+." },
+        { "wxFRAME_NO_TASKBAR", "Creates an otherwise normal frame but it does not appear in the taskbar under Windows or GTK+ (note that it will minimize to the desktop window under Windows which may seem strange to the users and thus it might be better to use this style only without wxMINIMIZE_BOX style). In wxGTK, the flag is respected only if GTK+ is at least version 2.2 and the window manager supports _NET_WM_STATE_SKIP_TASKBAR hint. Has no effect under other platforms." },
+        { "wxFRAME_FLOAT_ON_PARENT", "The frame will always be on top of its parent (unlike wxSTAY_ON_TOP). A frame created with this style must have a non-NULL parent." },
+        { "wxFRAME_SHAPED", "Windows with this style are allowed to have their shape changed with the SetShape method." },
+        { "wxICONIZE", "Display the frame iconized (minimized). Windows only." },
+        { "wxMAXIMIZE", "Displays the frame maximized. Windows only." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the frame." },
+        { "wxMINIMIZE", "Identical to wxICONIZE. Windows only." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the frame." },
+        { "wxRESIZE_BORDER", "Displays a resizeable border around the window." },
+        { "wxSTAY_ON_TOP", "Stay on top of all other windows, see also wxFRAME_FLOAT_ON_PARENT." },
+        { "wxSYSTEM_MENU", "Displays a system menu." },
+        { "wxFRAME_EX_CONTEXTHELP", "Under Windows, puts a query button on the caption. When pressed, Windows will go into a context-sensitive help mode and wxWidgets will send a wxEVT_HELP event if the user clicked on an application window. You cannot use this style together with wxMAXIMIZE_BOX or wxMINIMIZE_BOX." },
+        { "wxFRAME_EX_METAL", "On Mac OS X, frames with this style will be shown with a metallic look." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "wxDEFAULT_FRAME_STYLE", "Defined as wxMINIMIZE_BOX | wxMAXIMIZE_BOX | wxRESIZE_BORDER | wxSYSTEM_MENU | wxCAPTION | wxCLOSE_BOX | wxCLIP_CHILDREN" },
+        { "wxCAPTION", "Puts a caption on the frame." },
+        { "wxCLOSE_BOX", "Displays a close box on the frame." },
+        { "wxFRAME_TOOL_WINDOW", "Causes a frame with a small titlebar to be created; the frame does not appear in the taskbar under Windows or GTK+." },
+        { "wxFRAME_NO_TASKBAR", "Creates an otherwise normal frame but it does not appear in the taskbar under Windows or GTK+ (note that it will minimize to the desktop window under Windows which may seem strange to the users and thus it might be better to use this style only without wxMINIMIZE_BOX style). In wxGTK, the flag is respected only if GTK+ is at least version 2.2 and the window manager supports _NET_WM_STATE_SKIP_TASKBAR hint. Has no effect under other platforms." },
+        { "wxFRAME_FLOAT_ON_PARENT", "The frame will always be on top of its parent (unlike wxSTAY_ON_TOP). A frame created with this style must have a non-NULL parent." },
+        { "wxFRAME_SHAPED", "Windows with this style are allowed to have their shape changed with the SetShape method." },
+        { "wxICONIZE", "Display the frame iconized (minimized). Windows only." },
+        { "wxMAXIMIZE", "Displays the frame maximized. Windows only." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the frame." },
+        { "wxMINIMIZE", "Identical to wxICONIZE. Windows only." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the frame." },
+        { "wxRESIZE_BORDER", "Displays a resizeable border around the window." },
+        { "wxSTAY_ON_TOP", "Stay on top of all other windows, see also wxFRAME_FLOAT_ON_PARENT." },
+        { "wxSYSTEM_MENU", "Displays a system menu." },
+        { "wxFRAME_EX_CONTEXTHELP", "Under Windows, puts a query button on the caption. When pressed, Windows will go into a context-sensitive help mode and wxWidgets will send a wxEVT_HELP event if the user clicked on an application window. You cannot use this style together with wxMAXIMIZE_BOX or wxMINIMIZE_BOX." },
+        { "wxFRAME_EX_METAL", "On Mac OS X, frames with this style will be shown with a metallic look." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "wxDEFAULT_FRAME_STYLE", "Defined as wxMINIMIZE_BOX | wxMAXIMIZE_BOX | wxRESIZE_BORDER | wxSYSTEM_MENU | wxCAPTION | wxCLOSE_BOX | wxCLIP_CHILDREN" },
+        { "wxCAPTION", "Puts a caption on the frame." },
+        { "wxCLOSE_BOX", "Displays a close box on the frame." },
+        { "wxFRAME_TOOL_WINDOW", "Causes a frame with a small titlebar to be created; the frame does not appear in the taskbar under Windows or GTK+." },
+        { "wxFRAME_NO_TASKBAR", "Creates an otherwise normal frame but it does not appear in the taskbar under Windows or GTK+ (note that it will minimize to the desktop window under Windows which may seem strange to the users and thus it might be better to use this style only without wxMINIMIZE_BOX style). In wxGTK, the flag is respected only if GTK+ is at least version 2.2 and the window manager supports _NET_WM_STATE_SKIP_TASKBAR hint. Has no effect under other platforms." },
+        { "wxFRAME_FLOAT_ON_PARENT", "The frame will always be on top of its parent (unlike wxSTAY_ON_TOP). A frame created with this style must have a non-NULL parent." },
+        { "wxFRAME_SHAPED", "Windows with this style are allowed to have their shape changed with the SetShape method." },
+        { "wxICONIZE", "Display the frame iconized (minimized). Windows only." },
+        { "wxMAXIMIZE", "Displays the frame maximized. Windows only." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the frame." },
+        { "wxMINIMIZE", "Identical to wxICONIZE. Windows only." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the frame." },
+        { "wxRESIZE_BORDER", "Displays a resizeable border around the window." },
+        { "wxSTAY_ON_TOP", "Stay on top of all other windows, see also wxFRAME_FLOAT_ON_PARENT." },
+        { "wxSYSTEM_MENU", "Displays a system menu." },
+        { "wxFRAME_EX_CONTEXTHELP", "Under Windows, puts a query button on the caption. When pressed, Windows will go into a context-sensitive help mode and wxWidgets will send a wxEVT_HELP event if the user clicked on an application window. You cannot use this style together with wxMAXIMIZE_BOX or wxMINIMIZE_BOX." },
+        { "wxFRAME_EX_METAL", "On Mac OS X, frames with this style will be shown with a metallic look." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "wxDEFAULT_FRAME_STYLE", "Defined as wxMINIMIZE_BOX | wxMAXIMIZE_BOX | wxRESIZE_BORDER | wxSYSTEM_MENU | wxCAPTION | wxCLOSE_BOX | wxCLIP_CHILDREN" },
+        { "wxCAPTION", "Puts a caption on the frame." },
+        { "wxCLOSE_BOX", "Displays a close box on the frame." },
+        { "wxFRAME_TOOL_WINDOW", "Causes a frame with a small titlebar to be created; the frame does not appear in the taskbar under Windows or GTK+." },
+        { "wxFRAME_NO_TASKBAR", "Creates an otherwise normal frame but it does not appear in the taskbar under Windows or GTK+ (note that it will minimize to the desktop window under Windows which may seem strange to the users and thus it might be better to use this style only without wxMINIMIZE_BOX style). In wxGTK, the flag is respected only if GTK+ is at least version 2.2 and the window manager supports _NET_WM_STATE_SKIP_TASKBAR hint. Has no effect under other platforms." },
+        { "wxFRAME_FLOAT_ON_PARENT", "The frame will always be on top of its parent (unlike wxSTAY_ON_TOP). A frame created with this style must have a non-NULL parent." },
+        { "wxFRAME_SHAPED", "Windows with this style are allowed to have their shape changed with the SetShape method." },
+        { "wxICONIZE", "Display the frame iconized (minimized). Windows only." },
+        { "wxMAXIMIZE", "Displays the frame maximized. Windows only." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the frame." },
+        { "wxMINIMIZE", "Identical to wxICONIZE. Windows only." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the frame." },
+        { "wxRESIZE_BORDER", "Displays a resizeable border around the window." },
+        { "wxSTAY_ON_TOP", "Stay on top of all other windows, see also wxFRAME_FLOAT_ON_PARENT." },
+        { "wxSYSTEM_MENU", "Displays a system menu." },
+        { "wxFRAME_EX_CONTEXTHELP", "Under Windows, puts a query button on the caption. When pressed, Windows will go into a context-sensitive help mode and wxWidgets will send a wxEVT_HELP event if the user clicked on an application window. You cannot use this style together with wxMAXIMIZE_BOX or wxMINIMIZE_BOX." },
+        { "wxFRAME_EX_METAL", "On Mac OS X, frames with this style will be shown with a metallic look." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "wxDEFAULT_FRAME_STYLE", "Defined as wxMINIMIZE_BOX | wxMAXIMIZE_BOX | wxRESIZE_BORDER | wxSYSTEM_MENU | wxCAPTION | wxCLOSE_BOX | wxCLIP_CHILDREN" },
+        { "wxCAPTION", "Puts a caption on the frame." },
+        { "wxCLOSE_BOX", "Displays a close box on the frame." },
+        { "wxFRAME_TOOL_WINDOW", "Causes a frame with a small titlebar to be created; the frame does not appear in the taskbar under Windows or GTK+." },
+        { "wxFRAME_NO_TASKBAR", "Creates an otherwise normal frame but it does not appear in the taskbar under Windows or GTK+ (note that it will minimize to the desktop window under Windows which may seem strange to the users and thus it might be better to use this style only without wxMINIMIZE_BOX style). In wxGTK, the flag is respected only if GTK+ is at least version 2.2 and the window manager supports _NET_WM_STATE_SKIP_TASKBAR hint. Has no effect under other platforms." },
+        { "wxFRAME_FLOAT_ON_PARENT", "The frame will always be on top of its parent (unlike wxSTAY_ON_TOP). A frame created with this style must have a non-NULL parent." },
+        { "wxFRAME_SHAPED", "Windows with this style are allowed to have their shape changed with the SetShape method." },
+        { "wxICONIZE", "Display the frame iconized (minimized). Windows only." },
+        { "wxMAXIMIZE", "Displays the frame maximized. Windows only." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the frame." },
+        { "wxMINIMIZE", "Identical to wxICONIZE. Windows only." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the frame." },
+        { "wxRESIZE_BORDER", "Displays a resizeable border around the window." },
+        { "wxSTAY_ON_TOP", "Stay on top of all other windows, see also wxFRAME_FLOAT_ON_PARENT." },
+        { "wxSYSTEM_MENU", "Displays a system menu." },
+        { "wxFRAME_EX_CONTEXTHELP", "Under Windows, puts a query button on the caption. When pressed, Windows will go into a context-sensitive help mode and wxWidgets will send a wxEVT_HELP event if the user clicked on an application window. You cannot use this style together with wxMAXIMIZE_BOX or wxMINIMIZE_BOX." },
+        { "wxFRAME_EX_METAL", "On Mac OS X, frames with this style will be shown with a metallic look." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "wxDEFAULT_FRAME_STYLE", "Defined as wxMINIMIZE_BOX | wxMAXIMIZE_BOX | wxRESIZE_BORDER | wxSYSTEM_MENU | wxCAPTION | wxCLOSE_BOX | wxCLIP_CHILDREN" },
+        { "wxCAPTION", "Puts a caption on the frame." },
+        { "wxCLOSE_BOX", "Displays a close box on the frame." },
+        { "wxFRAME_TOOL_WINDOW", "Causes a frame with a small titlebar to be created; the frame does not appear in the taskbar under Windows or GTK+." },
+        { "wxFRAME_NO_TASKBAR", "Creates an otherwise normal frame but it does not appear in the taskbar under Windows or GTK+ (note that it will minimize to the desktop window under Windows which may seem strange to the users and thus it might be better to use this style only without wxMINIMIZE_BOX style). In wxGTK, the flag is respected only if GTK+ is at least version 2.2 and the window manager supports _NET_WM_STATE_SKIP_TASKBAR hint. Has no effect under other platforms." },
+        { "wxFRAME_FLOAT_ON_PARENT", "The frame will always be on top of its parent (unlike wxSTAY_ON_TOP). A frame created with this style must have a non-NULL parent." },
+        { "wxFRAME_SHAPED", "Windows with this style are allowed to have their shape changed with the SetShape method." },
+        { "wxICONIZE", "Display the frame iconized (minimized). Windows only." },
+        { "wxMAXIMIZE", "Displays the frame maximized. Windows only." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the frame." },
+        { "wxMINIMIZE", "Identical to wxICONIZE. Windows only." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the frame." },
+        { "wxRESIZE_BORDER", "Displays a resizeable border around the window." },
+        { "wxSTAY_ON_TOP", "Stay on top of all other windows, see also wxFRAME_FLOAT_ON_PARENT." },
+        { "wxSYSTEM_MENU", "Displays a system menu." },
+        { "wxFRAME_EX_CONTEXTHELP", "Under Windows, puts a query button on the caption. When pressed, Windows will go into a context-sensitive help mode and wxWidgets will send a wxEVT_HELP event if the user clicked on an application window. You cannot use this style together with wxMAXIMIZE_BOX or wxMINIMIZE_BOX." },
+        { "wxFRAME_EX_METAL", "On Mac OS X, frames with this style will be shown with a metallic look." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "wxDEFAULT_FRAME_STYLE", "Defined as wxMINIMIZE_BOX | wxMAXIMIZE_BOX | wxRESIZE_BORDER | wxSYSTEM_MENU | wxCAPTION | wxCLOSE_BOX | wxCLIP_CHILDREN" },
+        { "wxCAPTION", "Puts a caption on the frame." },
+        { "wxCLOSE_BOX", "Displays a close box on the frame." },
+        { "wxFRAME_TOOL_WINDOW", "Causes a frame with a small titlebar to be created; the frame does not appear in the taskbar under Windows or GTK+." },
+        { "wxFRAME_NO_TASKBAR", "Creates an otherwise normal frame but it does not appear in the taskbar under Windows or GTK+ (note that it will minimize to the desktop window under Windows which may seem strange to the users and thus it might be better to use this style only without wxMINIMIZE_BOX style). In wxGTK, the flag is respected only if GTK+ is at least version 2.2 and the window manager supports _NET_WM_STATE_SKIP_TASKBAR hint. Has no effect under other platforms." },
+        { "wxFRAME_FLOAT_ON_PARENT", "The frame will always be on top of its parent (unlike wxSTAY_ON_TOP). A frame created with this style must have a non-NULL parent." },
+        { "wxFRAME_SHAPED", "Windows with this style are allowed to have their shape changed with the SetShape method." },
+        { "wxICONIZE", "Display the frame iconized (minimized). Windows only." },
+        { "wxMAXIMIZE", "Displays the frame maximized. Windows only." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the frame." },
+        { "wxMINIMIZE", "Identical to wxICONIZE. Windows only." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the frame." },
+        { "wxRESIZE_BORDER", "Displays a resizeable border around the window." },
+        { "wxSTAY_ON_TOP", "Stay on top of all other windows, see also wxFRAME_FLOAT_ON_PARENT." },
+        { "wxSYSTEM_MENU", "Displays a system menu." },
+        { "wxFRAME_EX_CONTEXTHELP", "Under Windows, puts a query button on the caption. When pressed, Windows will go into a context-sensitive help mode and wxWidgets will send a wxEVT_HELP event if the user clicked on an application window. You cannot use this style together with wxMAXIMIZE_BOX or wxMINIMIZE_BOX." },
+        { "wxFRAME_EX_METAL", "On Mac OS X, frames with this style will be shown with a metallic look." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "wxBORDER_NONE", "No border will be displayed." },
+        { "wxBORDER_RAISED", "Displays a raised border." },
+        { "wxBORDER_SIMPLE", "Displays a thin border around the window." },
+        { "wxBORDER_SUNKEN", "Displays a sunken border." },
+        { "wxBORDER_THEME", "Displays a native border suitable for a control, on the current platform. On Windows, this will be a themed border; on most other platforms a sunken border will be used." },
+        { "wxPU_CONTAINS_CONTROLS", "By default in wxMSW, a popup window will not take focus from its parent window. However many standard controls, including common ones such as wxTextCtrl, need focus to function correctly and will not work when placed on a default popup. This flag can be used to make the popup take focus and let all controls work but at the price of not allowing the parent window to keep focus while the popup is shown, which can also be sometimes desirable. This style is currently only implemented in MSW and simply does nothing under the other platforms." },
+        { "normal", "Normal size" },
+        { "small", "About 25% smaller than normal." },
+        { "mini", "About 33% smaller than normal." },
+        { "large", "About 35% larger than normal." },
+        { "wxBORDER_NONE", "No border will be displayed." },
+        { "wxBORDER_RAISED", "Displays a raised border." },
+        { "wxBORDER_SIMPLE", "Displays a thin border around the window." },
+        { "wxBORDER_SUNKEN", "Displays a sunken border." },
+        { "wxBORDER_THEME", "Displays a native border suitable for a control, on the current platform. On Windows, this will be a themed border; on most other platforms a sunken border will be used." },
+        { "wxPU_CONTAINS_CONTROLS", "By default in wxMSW, a popup window will not take focus from its parent window. However many standard controls, including common ones such as wxTextCtrl, need focus to function correctly and will not work when placed on a default popup. This flag can be used to make the popup take focus and let all controls work but at the price of not allowing the parent window to keep focus while the popup is shown, which can also be sometimes desirable. This style is currently only implemented in MSW and simply does nothing under the other platforms." },
+        { "normal", "Normal size" },
+        { "small", "About 25% smaller than normal." },
+        { "mini", "About 33% smaller than normal." },
+        { "large", "About 35% larger than normal." },
+        { "Default", "Use Default theme." },
+        { "Generic", "Use Generic theme." },
+        { "MSW", "Use MSW theme." },
+        { "wxRIBBON_BAR_DEFAULT_STYLE", "Defined as wxRIBBON_BAR_FLOW_HORIZONTAL | wxRIBBON_BAR_SHOW_PAGE_LABELS | wxRIBBON_BAR_SHOW_PANEL_EXT_BUTTONS | wxRIBBON_BAR_SHOW_TOGGLE_BUTTON | wxRIBBON_BAR_SHOW_HELP_BUTTON." },
+        { "wxRIBBON_BAR_FOLDBAR_STYLE", "Defined as wxRIBBON_BAR_FLOW_VERTICAL | wxRIBBON_BAR_SHOW_PAGE_ICONS | wxRIBBON_BAR_SHOW_PANEL_EXT_BUTTONS | wxRIBBON_BAR_SHOW_PANEL_MINIMISE_BUTTONS." },
+        { "wxRIBBON_BAR_SHOW_PAGE_LABELS", "Causes labels to be shown on the tabs in the ribbon bar." },
+        { "wxRIBBON_BAR_SHOW_PAGE_ICONS", "Causes icons to be shown on the tabs in the ribbon bar." },
+        { "wxRIBBON_BAR_FLOW_HORIZONTAL", "Causes panels within pages to stack horizontally." },
+        { "wxRIBBON_BAR_FLOW_VERTICAL", "Causes panels within pages to stack vertically." },
+        { "wxRIBBON_BAR_SHOW_PANEL_EXT_BUTTONS", "Causes extension buttons to be shown on panels (where the panel has such a button)." },
+        { "wxRIBBON_BAR_SHOW_PANEL_MINIMISE_BUTTONS", "Causes minimise buttons to be shown on panels (where the panel has such a button)." },
+        { "wxRIBBON_BAR_SHOW_TOGGLE_BUTTON", "Causes a toggle button to appear on the ribbon bar at top-right corner." },
+        { "wxRIBBON_BAR_SHOW_HELP_BUTTON", "Causes a help button to appear on the ribbon bar at the top-right corner." },
+        { "wxCAPTION", "Puts a caption on the dialog box." },
+        { "wxCLOSE_BOX", "Displays a close box on the dialog." },
+        { "wxDEFAULT_DIALOG_STYLE", "Equivalent to a combination of wxCAPTION, wxCLOSE_BOX and wxSYSTEM_MENU (the last one is not used under Unix)" },
+        { "wxDIALOG_NO_PARENT", "By default, a dialog created with a NULL parent window will be given the application's top level window as parent. Use this style to prevent this from happening and create an orphan dialog. Not recommended for modal dialogs." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the dialog." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the dialog." },
+        { "wxRESIZE_BORDER", "Display a resizeable frame around the window." },
+        { "wxSTAY_ON_TOP", "The dialog stays on top of all other windows." },
+        { "wxSYSTEM_MENU", "Display a system menu." },
+        { "wxWANTS_CHARS", "Use this to indicate that the window wants to get all char/key events for all keys - even for keys like TAB or ENTER which are usually used for dialog navigation and which wouldn't be generated without this style. If you need to use this style in order to get the arrows or etc., but would still like to have normal keyboard navigation take place, you should call Navigate in response to the key events for Tab and Shift-Tab." },
+        { "wxFULL_REPAINT_ON_RESIZE", "Use this style to force a complete redraw of the window whenever it is resized instead of redrawing just the part of the window affected by resizing. Currently this style applies on GTK+ 2 and Windows only, and full repainting is always done on other platforms." },
+        { "wxDIALOG_EX_CONTEXTHELP", "Under Windows, puts a query button on the caption. When pressed, Windows will go into a context-sensitive help mode and wxWidgets will send a wxEVT_HELP event if the user clicked on an application window. Note: The Project's \"help_provider\" property must be set for context-sensitive help to work." },
+        { "wxDIALOG_EX_METAL", "On Mac OS X, frames with this style will be shown with a metallic look." },
+        { "wxWS_EX_BLOCK_EVENTS", "wxCommandEvents are propagated upward to the parent window, it's parent window, etc. Setting this flag blocks this propagation at this window, preventing events from being propagated further upwards." },
+        { "wxWS_EX_PROCESS_IDLE", "The dialog should always process idle events, even if the mode set by wxIdleEvent::SetMode is wxIDLE_PROCESS_SPECIFIED." },
+        { "wxWS_EX_PROCESS_UI_UPDATES", "The dialog should always process UI update events, even if the mode set by wxUpdateUIEvent::SetMode is   wxUPDATE_UI_PROCESS_SPECIFIED." },
+        { "wxWS_EX_VALIDATE_RECURSIVELY", "By default, Validate/TransferDataTo/FromWindow() only work on direct children of the window (compatible behaviour). Set this flag to make them recursively descend into all subwindows." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "normal", "Normal size" },
+        { "small", "About 25% smaller than normal." },
+        { "mini", "About 33% smaller than normal." },
+        { "large", "About 35% larger than normal." },
+        { "wxTRANSPARENT_WINDOW", "The window is transparent, that is, it will not receive paint events. Windows only." },
+        { "wxTAB_TRAVERSAL", "Setting this will cause the tab key to traverse child windows." },
+        { "wxWANTS_CHARS", "Use this to indicate that the window wants to get all char/key events for all keys - even for keys like TAB or ENTER which are usually used for dialog navigation and which wouldn't be generated without this style. If you need to use this style in order to get the arrows or etc., but would still like to have normal keyboard navigation take place, you should call Navigate in response to the key events for Tab and Shift-Tab." },
+        { "wxVSCROLL", "Use this style to enable a vertical scrollbar. Notice that this style cannot be used with native controls which don't support scrollbars nor with top-level windows in most ports." },
+        { "wxHSCROLL", "Use this style to enable a horizontal scrollbar. The same limitations as for wxVSCROLL apply to this style." },
+        { "wxCLIP_CHILDREN", "Use this style to eliminate flicker caused by the background being repainted, then children being painted over them. Windows only." },
+        { "wxFULL_REPAINT_ON_RESIZE", "Use this style to force a complete redraw of the window whenever it is resized instead of redrawing just the part of the window affected by resizing. Currently this style applies on GTK+ 2 and Windows only, and full repainting is always done on other platforms." },
+        { "wxWS_EX_VALIDATE_RECURSIVELY", "By default, Validate/TransferDataTo/FromWindow() only work on direct children of the window (compatible behaviour). Set this flag to make them recursively descend into all subwindows." },
+        { "wxWS_EX_BLOCK_EVENTS", "wxCommandEvents are propagated upward to the parent window, it's parent window, etc. Setting this flag blocks this propagation at this window, preventing events from being propagated further upwards." },
+        { "wxWS_EX_PROCESS_IDLE", "This window should always process idle events, even if the mode set by wxIdleEvent::SetMode is wxIDLE_PROCESS_SPECIFIED." },
+        { "wxWS_EX_PROCESS_UI_UPDATES", "This window should always process UI update events, even if the mode set by wxUpdateUIEvent::SetMode is   wxUPDATE_UI_PROCESS_SPECIFIED." },
+        { "wxPROPSHEET_NOTEBOOK", "" },
+        { "wxPROPSHEET_CHOICEBOOK", "" },
+        { "wxPROPSHEET_LISTBOOK", "" },
+        { "wxPROPSHEET_TOOLBOOK", "" },
+        { "wxPROPSHEET_TREEBOOK", "" },
+        { "wxOK", "Create a 'OK' button. Cannot be combined with Yes button." },
+        { "wxYES", "Create a 'Yes' button. Cannot be combined with OK button." },
+        { "wxAPPLY", "Create a 'Apply' button." },
+        { "wxNO", "Create a 'No' button." },
+        { "wxCANCEL", "Create a 'Cancel' button. Cannot be combined with Close button." },
+        { "wxCLOSE", "Create a 'Close' button. Cannot be combined with Cancel button." },
+        { "wxHELP", "Create a 'Help' button." },
+        { "wxCAPTION", "Puts a caption on the dialog box." },
+        { "wxCLOSE_BOX", "Displays a close box on the dialog." },
+        { "wxDEFAULT_DIALOG_STYLE", "Equivalent to a combination of wxCAPTION, wxCLOSE_BOX and wxSYSTEM_MENU (the last one is not used on Unix)." },
+        { "wxDIALOG_NO_PARENT", "By default, a dialog created with a NULL parent window will be given the application's top level window as parent. Use this style to prevent this from happening and create an orphan dialog. Not recommended for modal dialogs." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the dialog." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the dialog." },
+        { "wxRESIZE_BORDER", "Display a resizable frame around the dialog." },
+        { "wxSTAY_ON_TOP", "The dialog stays on top of all other windows." },
+        { "wxSYSTEM_MENU", "Display a system menu." },
+        { "wxWANTS_CHARS", "Use this to indicate that the window wants to get all char/key events for all keys - even for keys like TAB or ENTER which are usually used for dialog navigation and which wouldn't be generated without this style. If you need to use this style in order to get the arrows or etc., but would still like to have normal keyboard navigation take place, you should call Navigate in response to the key events for Tab and Shift-Tab." },
+        { "wxDIALOG_EX_CONTEXTHELP", "Under Windows, puts a query button on the caption. When pressed, Windows will go into a context-sensitive help mode and wxWidgets will send a wxEVT_HELP event if the user clicked on an application window. Note: The Project's \"help_provider\" property must be set for context-sensitive help to work." },
+        { "wxDIALOG_EX_METAL", "On Mac OS X, frames with this style will be shown with a metallic look." },
+        { "wxWS_EX_BLOCK_EVENTS", "wxCommandEvents are propagated upward to the parent window, it's parent window, etc. Setting this flag blocks this propagation at this window, preventing events from being propagated further upwards." },
+        { "wxWS_EX_PROCESS_IDLE", "The dialog should always process idle events, even if the mode set by wxIdleEvent::SetMode is wxIDLE_PROCESS_SPECIFIED." },
+        { "wxWS_EX_PROCESS_UI_UPDATES", "The dialog should always process UI update events, even if the mode set by wxUpdateUIEvent::SetMode is wxUPDATE_UI_PROCESS_SPECIFIED." },
+        { "wxWS_EX_VALIDATE_RECURSIVELY", "By default, Validate/TransferDataTo/FromWindow() only work on direct children of the window (compatible behaviour). Set this flag to make them recursively descend into all subwindows." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "wxCAPTION", "Puts a caption on the dialog box." },
+        { "wxDEFAULT_DIALOG_STYLE", "Equivalent to a combination of wxCAPTION, wxCLOSE_BOX and wxSYSTEM_MENU (the last one is not used under Unix)" },
+        { "wxRESIZE_BORDER", "Display a resizeable frame around the window." },
+        { "wxSYSTEM_MENU", "Display a system menu." },
+        { "wxCLOSE_BOX", "Displays a close box on the dialog." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the dialog." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the dialog." },
+        { "wxSTAY_ON_TOP", "The dialog stays on top of all other windows." },
+        { "wxDIALOG_NO_PARENT", "By default, a dialog created with a NULL parent window will be given the application's top level window as parent. Use this style to prevent this from happening and create an orphan dialog. This is not recommended for modal dialogs." },
+        { "wxWIZARD_EX_HELPBUTTON", "Shows a Help button using wxID_HELP." },
+        { "no", "" },
+        { "wxHORIZONTAL", "" },
+        { "wxVERTICAL", "" },
+        { "wxBOTH", "" },
+        { "wxWIZARD_VALIGN_TOP", "The bitmap is vertically aligned at the top." },
+        { "wxWIZARD_VALIGN_CENTRE", "The bitmap is centered vertically." },
+        { "wxWIZARD_VALIGN_BOTTOM", "The bitmap is vertically aligned at the bottom." },
+        { "wxWIZARD_HALIGN_LEFT", "The bitmap is horizontally aligned to the left." },
+        { "wxWIZARD_HALIGN_CENTRE", "The bitmap is horizontally aligned in the center." },
+        { "wxWIZARD_HALIGN_RIGHT", "The bitmap is horizontally aligned to the right." },
+        { "wxWIZARD_TILE", "The bitmap is tiled." },
+        { "AUI", "Create a wxAuiMDIParentFrame" },
+        { "MDI", "Create a wxDocMDIParentFrame" },
+        { "wxDEFAULT_FRAME_STYLE", "Defined as wxMINIMIZE_BOX | wxMAXIMIZE_BOX | wxRESIZE_BORDER | wxSYSTEM_MENU | wxCAPTION | wxCLOSE_BOX | wxCLIP_CHILDREN" },
+        { "wxCAPTION", "Puts a caption on the frame." },
+        { "wxCLOSE_BOX", "Displays a close box on the frame." },
+        { "wxFRAME_TOOL_WINDOW", "Causes a frame with a small titlebar to be created; the frame does not appear in the taskbar under Windows or GTK+." },
+        { "wxFRAME_NO_TASKBAR", "Creates an otherwise normal frame but it does not appear in the taskbar under Windows or GTK+ (note that it will minimize to the desktop window under Windows which may seem strange to the users and thus it might be better to use this style only without wxMINIMIZE_BOX style). In wxGTK, the flag is respected only if GTK+ is at least version 2.2 and the window manager supports _NET_WM_STATE_SKIP_TASKBAR hint. Has no effect under other platforms." },
+        { "wxFRAME_FLOAT_ON_PARENT", "The frame will always be on top of its parent (unlike wxSTAY_ON_TOP). A frame created with this style must have a non-NULL parent." },
+        { "wxFRAME_SHAPED", "Windows with this style are allowed to have their shape changed with the SetShape method." },
+        { "wxICONIZE", "Display the frame iconized (minimized). Windows only." },
+        { "wxMAXIMIZE", "Displays the frame maximized. Windows only." },
+        { "wxMAXIMIZE_BOX", "Displays a maximize box on the frame." },
+        { "wxMINIMIZE", "Identical to wxICONIZE. Windows only." },
+        { "wxMINIMIZE_BOX", "Displays a minimize box on the frame." },
+        { "wxRESIZE_BORDER", "Displays a resizeable border around the window." },
+        { "wxSTAY_ON_TOP", "Stay on top of all other windows, see also wxFRAME_FLOAT_ON_PARENT." },
+        { "wxSYSTEM_MENU", "Displays a system menu." },
+        { "wxVSCROLL", "Use this style to enable a vertical scrollbar." },
+        { "wxHSCROLL", "Use this style to enable a horizontal scrollbar." },
+        { "enabled", "Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "grammar", "Enables grammar checking in addition to spell checking. Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "wxTE_RICH", "Use rich text control under Windows. This allows having more than 64KB of text in the control. This style is ignored under other platforms." },
+        { "wxTE_RICH2", "Use rich text control version 2.0 or 3.0 under Windows. This style is ignored under other platforms." },
+        { "enabled", "Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "grammar", "Enables grammar checking in addition to spell checking. Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "wxTE_RICH", "Use rich text control under Windows. This allows having more than 64KB of text in the control. This style is ignored under other platforms." },
+        { "wxTE_RICH2", "Use rich text control version 2.0 or 3.0 under Windows. This style is ignored under other platforms." },
+        { "enabled", "Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "grammar", "Enables grammar checking in addition to spell checking. Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "wxTE_RICH", "Use rich text control under Windows. This allows having more than 64KB of text in the control. This style is ignored under other platforms." },
+        { "wxTE_RICH2", "Use rich text control version 2.0 or 3.0 under Windows. This style is ignored under other platforms." },
+        { "enabled", "Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "grammar", "Enables grammar checking in addition to spell checking. Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "wxTE_RICH", "Use rich text control under Windows. This allows having more than 64KB of text in the control. This style is ignored under other platforms." },
+        { "wxTE_RICH2", "Use rich text control version 2.0 or 3.0 under Windows. This style is ignored under other platforms." },
+        { "enabled", "Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "grammar", "Enables grammar checking in addition to spell checking. Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "wxTE_RICH", "Use rich text control under Windows. This allows having more than 64KB of text in the control. This style is ignored under other platforms." },
+        { "wxTE_RICH2", "Use rich text control version 2.0 or 3.0 under Windows. This style is ignored under other platforms." },
+        { "wxFLP_USE_TEXTCTRL", "Creates a text control to the left of the picker button which is completely managed by the wxFilePickerCtrl and which can be used by the user to specify a path (see SetPath). The text control is automatically synchronized with button's value. Use functions defined in wxPickerBase to modify the text control." },
+        { "wxFLP_OPEN", "Creates a picker which allows the user to select a file to open." },
+        { "wxFLP_SAVE", "Creates a picker which allows the user to select a file to save." },
+        { "wxFLP_OVERWRITE_PROMPT", "Can be combined with wxFLP_SAVE only: ask confirmation to the user before selecting a file." },
+        { "wxFLP_FILE_MUST_EXIST", "Can be combined with wxFLP_OPEN only: the selected file must be an existing file." },
+        { "wxFLP_CHANGE_DIR", "Change current working directory on each user file selection change." },
+        { "wxFLP_SMALL", "Use smaller version of the control with a small \"...\" button instead of the normal \"Browse\" one." },
+        { "wxDIRP_DEFAULT_STYLE", "The default style is wxDIRP_DIR_MUST_EXIST and wxDIRP_USE_TEXTCTRL." },
+        { "wxDIRP_USE_TEXTCTRL", "Creates a text control to the left of the picker button which is completely managed by the wxDirPickerCtrl and which can be used by the user to specify a path (see SetPath). The text control is automatically synchronized with button's value. Use functions defined in wxPickerBase to modify the text control." },
+        { "wxDIRP_DIR_MUST_EXIST", "Creates a picker which allows to select only existing directories. wxGTK control always adds this flag internally as it does not support its absence." },
+        { "wxDIRP_CHANGE_DIR", "Change current working directory on each user directory selection change." },
+        { "wxDIRP_SMALL", "Use smaller version of the control with a small \"...\" button instead of the normal \"Browse\" one." },
+        { "wxFNTP_USE_TEXTCTRL", "Creates a text control to the left of the picker button which is completely managed by the wxFontPickerCtrl and which can be used by the user to specify a font (see SetSelectedFont). The text control is automatically synchronized with button's value. Use functions defined in wxPickerBase to modify the text control." },
+        { "wxFNTP_FONTDESC_AS_LABEL", "Keeps the label of the button updated with the fontface name and the font size. E.g. choosing \"Times New Roman bold, italic with size 10\" from the fontdialog, will update the label (overwriting any previous label) with the \"Times New Roman, 10\" text." },
+        { "wxFNTP_USEFONT_FOR_LABEL", "Uses the currently selected font to draw the label of the button." },
+        { "wxCLRP_USE_TEXTCTRL", "Creates a text control to the left of the picker button which is completely managed by the wxColourPickerCtrl and which can be used by the user to specify a colour. The text control is automatically synchronized with button's value. Use functions defined in wxPickerBase to modify the text control." },
+        { "wxCLRP_SHOW_LABEL", "Shows the colour in HTML form (AABBCC) as colour button label (instead of no label at all)." },
+        { "wxCLRP_SHOW_ALPHA", "Allows selecting opacity in the colour-chooser (effective under wxGTK and wxOSX). " },
+        { "wxDP_SPIN", "Creates a control without a month calendar drop down but with spin-control-like arrows to change individual date components. This style is not supported by the generic version." },
+        { "wxDP_DROPDOWN", "Creates a control with a month calendar drop-down part from which the user can select a date. This style is not supported in OSX/Cocoa native version." },
+        { "wxDP_SHOWCENTURY", "Forces display of the century in the default date format. Without this style the century could be displayed, or not, depending on the default date representation in the system. This style is not supported in OSX/Cocoa native version currently." },
+        { "wxDP_ALLOWNONE", "With this style, the control allows the user to not enter any valid date at all. Without it - the default - the control always has some valid date. This style is not supported in OSX/Cocoa native version." },
+        { "wxDP_DEFAULT", "Creates a control with the style that is best supported for the current platform (currently wxDP_SPIN under Windows and OSX/Cocoa and wxDP_DROPDOWN elsewhere)." },
+        { "wxTP_DEFAULT", "Currently no special styles are defined for wxTimePickerCtrl." },
+        { "C++", "" },
+        { "Python", "" },
+        { "Ruby", "" },
+        { "Fortran", "" },
+        { "GO", "" },
+        { "LuaJIT", "" },
+        { "Julia", "" },
+        { "TypeScript", "" },
+        { "XRC", "" },
+        { "C++", "" },
+        { "Python", "" },
+        { "Ruby", "" },
+        { "Fortran", "" },
+        { "GO", "" },
+        { "Julia", "" },
+        { "LuaJIT", "" },
+        { "TypeScript", "" },
+        { "XRC", "" },
+        { "none", "No support for context-sensitive help." },
+        { "wxSimpleHelpProvider", "Use wxSimpleHelpProvider to provide context-sensitive help." },
+        { "wxHelpControllerHelpProvider", "Use wxHelpControllerHelpProvider to provide context-sensitive help." },
+        { "C++", "" },
+        { "Python", "" },
+        { "Ruby", "" },
+        { "GO", "" },
+        { "Fortran", "" },
+        { "Julia", "" },
+        { "LuaJIT", "" },
+        { "TypeScript", "" },
+        { "XRC", "" },
+        { "wxVERTICAL", "Align items vertically" },
+        { "wxHORIZONTAL", "Align items horizontally" },
+        { "wxVERTICAL", "Align items vertically" },
+        { "wxHORIZONTAL", "Align items horizontally" },
+        { "wxVERTICAL", "Align items vertically" },
+        { "wxHORIZONTAL", "Align items horizontally" },
+        { "wxALIGN_RIGHT", "Aligns the checkbox to the right of the text instead of the left." },
+        { "wxVERTICAL", "Align items vertically" },
+        { "wxHORIZONTAL", "Align items horizontally" },
+        { "wxVERTICAL", "Align items vertically" },
+        { "wxHORIZONTAL", "Align items horizontally" },
+        { "wxVERTICAL", "Align items vertically" },
+        { "wxHORIZONTAL", "Align items horizontally" },
+        { "wxEXTEND_LAST_ON_EACH_LINE", "The last item on each line will use any remaining space on that line" },
+        { "wxREMOVE_LEADING_SPACES", "Removes any spacer elements from the beginning of a row" },
+        { "none", "Don't use a default button" },
+        { "OK", "Default is the 'OK' button" },
+        { "Yes", "Default is the 'Yes' button" },
+        { "Save", "Default is the 'Save' button" },
+        { "No", "Default is the 'No' button" },
+        { "Cancel", "Default is the 'Cancel' button" },
+        { "Close", "Default is the 'Close' button" },
+        { "wxALIGN_LEFT", "Align the text to the left." },
+        { "wxALIGN_RIGHT", "Align the text to the right." },
+        { "wxALIGN_CENTER_HORIZONTAL", "Center the text (horizontally)." },
+        { "wxST_NO_AUTORESIZE", "By default, the control will adjust its size to exactly fit to the size of the text when SetLabel() is called. If this style flag is given, the control will not change its size (this style is especially useful with controls which also have the wxALIGN_RIGHT or the wxALIGN_CENTER_HORIZONTAL style because otherwise they won't make sense any longer after a call to SetLabel())." },
+        { "wxST_ELLIPSIZE_START", "If the labeltext width exceeds the control width, replace the beginning of the label with an ellipsis; uses wxControl::Ellipsize." },
+        { "wxST_ELLIPSIZE_MIDDLE", "If the label text width exceeds the control width, replace the middle of the label with an ellipsis; uses wxControl::Ellipsize." },
+        { "wxST_ELLIPSIZE_END", "If the label text width exceeds the control width, replace the end of the label with an ellipsis; uses wxControl::Ellipsize." },
+        { "enabled", "Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "grammar", "Enables grammar checking in addition to spell checking. Currently this is supported in wxMSW (when running under Windows 8 or later), wxGTK when using GTK 3 and wxOSX. In addition, wxMSW requires that the text control has the wxTE_RICH2 style set, while wxOSX requires that the control has the wxTE_MULTILINE style." },
+        { "wxTE_PROCESS_ENTER", "The control will generate the event wxEVT_TEXT_ENTER (otherwise pressing Enter key is either processed internally by the control or used for navigation between dialog controls)." },
+        { "wxTE_PROCESS_TAB", "The control will receive wxEVT_CHAR events for TAB pressed - normally, TAB is used for passing to the next control in a dialog instead. For the control created with this style, you can still use Ctrl-Enter to pass to the next control from the keyboard." },
+        { "wxTE_MULTILINE", "The text control allows multiple lines." },
+        { "wxTE_PASSWORD", "The text will be echoed as asterisks." },
+        { "wxTE_READONLY", "The text will not be user-editable." },
+        { "wxTE_RICH", "Use rich text control under Windows. This allows having more than 64KB of text in the control. This style is ignored under other platforms." },
+        { "wxTE_RICH2", "Use rich text control version 2.0 or 3.0 under Windows. This style is ignored under other platforms." },
+        { "wxTE_AUTO_URL", "Highlight the URLs and generate the wxTextUrlEvents when mouse events occur over them. This style is only supported for wxTE_RICH Win32 and multi-line wxGTK2 text controls." },
+        { "wxTE_NOHIDESEL", "By default, the Windows text control doesn't show the selection when it doesn't have focus - use this style to force it to always show it. This style is ignored under other platforms." },
+        { "wxTE_NO_VSCROLL", "For multiline controls only: a vertical scrollbar will never be created. This limits the amount of text which can be entered into the control to what can be displayed in it under MSW but not under GTK2. Currently not implemented for the other platforms." },
+        { "wxTE_LEFT", "The text in the control will be left-justified (default)." },
+        { "wxTE_CENTER", "The text in the control will be centered (currently Windows and wxGTK2 only)." },
+        { "wxTE_RIGHT", "The text in the control will be right-justified (currently Windows and wxGTK2 only)." },
+        { "wxTE_DONTWRAP", "Same as wxHSCROLL style: don't wrap at all, show horizontal scrollbar instead." },
+        { "wxTE_CHARWRAP", "Wrap the lines too long to be shown entirely at any position (wxUniv and wxGTK2 only)." },
+        { "wxTE_WORDWRAP", "Wrap the lines too long to be shown entirely at word boundaries (wxUniv and wxGTK2 only)." },
+        { "wxTE_BESTWRAP", "Wrap the lines at word boundaries or at any other character if there are words longer than the window width (this is the default)." },
+        { "wxRE_CENTRE_CARET", "The control will try to keep the caret line centered vertically while editing." },
+        { "wxRE_READONLY", "The text will not be editable." },
+        { "A68K", "" },
+        { "ABAQUS", "" },
+        { "ADA", "" },
+        { "APDL", "" },
+        { "AS", "" },
+        { "ASM", "" },
+        { "ASN1", "" },
+        { "ASYMPTOTE", "" },
+        { "AU3", "" },
+        { "AVE", "" },
+        { "AVS", "" },
+        { "BAAN", "" },
+        { "BASH", "" },
+        { "BATCH", "" },
+        { "BIBTEX", "" },
+        { "BLITZBASIC", "" },
+        { "BULLANT", "" },
+        { "CAML", "" },
+        { "CLW", "" },
+        { "CLWNOCASE", "" },
+        { "CMAKE", "" },
+        { "COBOL", "" },
+        { "COFFEESCRIPT", "" },
+        { "CONF", "" },
+        { "CONTAINER", "" },
+        { "CPP", "" },
+        { "CPPNOCASE", "" },
+        { "CSOUND", "" },
+        { "CSS", "" },
+        { "D", "" },
+        { "DIFF", "" },
+        { "DMAP", "" },
+        { "DMIS", "" },
+        { "ECL", "" },
+        { "EDIFACT", "" },
+        { "EIFFEL", "" },
+        { "EIFFELKW", "" },
+        { "ERLANG", "" },
+        { "ERRORLIST", "" },
+        { "ESCRIPT", "" },
+        { "F77", "" },
+        { "FLAGSHIP", "" },
+        { "FORTH", "" },
+        { "FORTRAN", "" },
+        { "FREEBASIC", "" },
+        { "GAP", "" },
+        { "GUI4CLI", "" },
+        { "HASKELL", "" },
+        { "HTML", "" },
+        { "IHEX", "" },
+        { "INNOSETUP", "" },
+        { "JSON", "" },
+        { "KIX", "" },
+        { "KVIRC", "" },
+        { "LATEX", "" },
+        { "LISP", "" },
+        { "LITERATEHASKELL", "" },
+        { "LOT", "" },
+        { "LOUT", "" },
+        { "LUA", "" },
+        { "MAGIK", "" },
+        { "MAKEFILE", "" },
+        { "MARKDOWN", "" },
+        { "MATLAB", "" },
+        { "METAPOST", "" },
+        { "MMIXAL", "" },
+        { "MODULA", "" },
+        { "MSSQL", "" },
+        { "MYSQL", "" },
+        { "NIMROD", "" },
+        { "NNCRONTAB", "" },
+        { "NSIS", "" },
+        { "NULL", "" },
+        { "OCTAVE", "" },
+        { "OPAL", "" },
+        { "OSCRIPT", "" },
+        { "PASCAL", "" },
+        { "PERL", "" },
+        { "PHPSCRIPT", "" },
+        { "PLM", "" },
+        { "PO", "" },
+        { "POV", "" },
+        { "POWERBASIC", "" },
+        { "POWERPRO", "" },
+        { "POWERSHELL", "" },
+        { "PROGRESS", "" },
+        { "PROPERTIES", "" },
+        { "PS", "" },
+        { "PUREBASIC", "" },
+        { "PYTHON", "" },
+        { "R", "" },
+        { "REBOL", "" },
+        { "REGISTRY", "" },
+        { "RUBY", "" },
+        { "RUST", "" },
+        { "SCRIPTOL", "" },
+        { "SMALLTALK", "" },
+        { "SML", "" },
+        { "SORCUS", "" },
+        { "SPECMAN", "" },
+        { "SPICE", "" },
+        { "SQL", "" },
+        { "SREC", "" },
+        { "STTXT", "" },
+        { "TACL", "" },
+        { "TADS3", "" },
+        { "TAL", "" },
+        { "TCL", "" },
+        { "TCMD", "" },
+        { "TEHEX", "" },
+        { "TEX", "" },
+        { "TXT2TAGS", "" },
+        { "VB", "" },
+        { "VBSCRIPT", "" },
+        { "VERILOG", "" },
+        { "VHDL", "" },
+        { "VISUALPROLOG", "" },
+        { "XCODE", "" },
+        { "XML", "" },
+        { "YAML", "" },
+        { "\\r\\n (CR/LF)", "" },
+        { "\\r (CR)", "" },
+        { "\\n (LF)", "" },
+        { "invisible", "" },
+        { "always visible", "" },
+        { "visible after indent", "" },
+        { "only indent visible", "" },
+        { "none", "" },
+        { "0", "" },
+        { "1", "" },
+        { "2", "" },
+        { "3", "" },
+        { "4", "" },
+        { "2", "" },
+        { "3", "" },
+        { "4", "" },
+        { "5", "" },
+        { "6", "" },
+        { "none", "" },
+        { "0", "" },
+        { "1", "" },
+        { "2", "" },
+        { "3", "" },
+        { "4", "" },
+        { "arrow", "" },
+        { "plus/minus", "" },
+        { "circle tree", "" },
+        { "box tree", "" },
+        { "show_lines", "Automatically show lines as needed." },
+        { "margin_clicks", "Handle clicks in fold margin automatically." },
+        { "show_changes", "Show lines as needed when fold structure is changed." },
+        { "before if expanded", "Draw above if expanded." },
+        { "before if contracted", "Draw above if not expanded." },
+        { "after if expanded", "Draw below if expanded." },
+        { "after if contracted", "Draw below if not expanded." },
+        { "debug hex levels", "Display hexadecimal fold levels in line margin to aid debugging of folding." },
+        { "debug line state", "Display hexadecimal line state in line margin to aid debugging of lexing and folding. Cannot be used with \"debug hex levels\"." },
+        { "none", "" },
+        { "0", "" },
+        { "1", "" },
+        { "2", "" },
+        { "3", "" },
+        { "4", "" },
+        { "none", "" },
+        { "0", "" },
+        { "1", "" },
+        { "2", "" },
+        { "3", "" },
+        { "4", "" },
+        { "none", "" },
+        { "0", "" },
+        { "1", "" },
+        { "2", "" },
+        { "3", "" },
+        { "4", "" },
+        { "symbol", "Symbol" },
+        { "number", "Line number" },
+        { "background", "Symbol using background colour" },
+        { "foreground", "Symbol using foreground colour" },
+        { "text", "Application defined text" },
+        { "right-aligned text", "Right aligned application text" },
+        { "colour", "Use a custom colour for the background of the margin." },
+        { "no guides", "No indentation guides are shown." },
+        { "real", "Indentation guides are shown inside real indentation white space." },
+        { "forward", "Indentation guides are shown beyond the actual indentation up to the level of the next non-empty line. If the previous non-empty line was a fold header then indentation guides are shown for one more level of indent than that line. This setting is good for Python." },
+        { "both", "  Indentation guides are shown beyond the actual indentation up to the level of the next non-empty line or previous non-empty line whichever is the greater. This setting is good for most languages." },
+        { "no wrapping", "Lines are not wrapped." },
+        { "word", "Wrap on word or style boundaries." },
+        { "character", "Wrap between any characters. This is the preferred mode to use Asian languages where there is no white space between words." },
+        { "whitespace", "Wrap on any whitespace" },
+        { "end", "Visual flag at end of subline of a wrapped line." },
+        { "start", "Visual flag at begin of subline of a wrapped line. Subline is indented by at least 1 to make room for the flag." },
+        { "margin", "Visual flag in line number margin." },
+        { "end_text", "Visual flag at end of subline drawn near text." },
+        { "start_text", "Visual flag at beginning of subline drawn near text." },
+        { "fixed", "Wrapped sublines aligned to left of window plus amount set by wrap_start_indent" },
+        { "same", "Wrapped sublines are aligned to first subline indent." },
+        { "indent", "Wrapped sublines are aligned to first subline indent plus one more level of indentation." },
+        { "wxAC_DEFAULT_STYLE", "The default style: wxBORDER_NONE." },
+        { "wxAC_NO_AUTORESIZE", "By default, the control will adjust its size to exactly fit the size of the animation. If this style flag is set, the control will not change its size." },
+        { "wxTOP", "" },
+        { "wxBOTTOM", "" },
+        { "wxLEFT", "" },
+        { "wxRIGHT", "" },
+        { "wxLB_SINGLE", "Single-selection list." },
+        { "wxLB_MULTIPLE", "Multiple-selection list: the user can toggle multiple items on and off. This is the same as wxLB_EXTENDED in wxGTK2 port." },
+        { "wxLB_EXTENDED", "Extended-selection list: the user can extend the selection by using SHIFT or CTRL keys together with the cursor movement keys or the mouse." },
+        { "wxLB_HSCROLL", "Create a horizontal scrollbar if contents are too wide (Windows only)." },
+        { "wxLB_ALWAYS_SB", "Always show a vertical scrollbar." },
+        { "wxLB_NEEDED_SB", "Only create a vertical scrollbar if needed." },
+        { "wxLB_NO_SB", "Don't create a vertical scrollbar (Windows only)." },
+        { "wxLB_SORT", "The listbox contents are sorted in alphabetical order." },
+        { "None", "Do not scale the image." },
+        { "Fill", "Scale the bitmap to fill the size of the control." },
+        { "AspectFit", "Scale the bitmap to fit the size of the control by maintaining the aspect ratio." },
+        { "AspectFill", "Scale the bitmap to fit the size of the control by changing the aspect ratio of the bitmap if necessary." },
+        { "wxLI_HORIZONTAL", "Creates a horizontal line." },
+        { "wxLI_VERTICAL", "Creates a vertical line." },
+        { "wxSL_HORIZONTAL", "Create a horizontal gauge." },
+        { "wxSL_VERTICAL", "Create a vertical gauge." },
+        { "wxSL_AUTOTICKS", "Displays tick marks when running on Windows." },
+        { "wxSL_MIN_MAX_LABELS", "Displays minimum, maximum labels." },
+        { "wxSL_VALUE_LABEL", "Displays value label." },
+        { "wxSL_LABELS", "Displays minimum, maximum and value labels (same as wxSL_VALUE_LABEL and wxSL_MIN_MAX_LABELS together)." },
+        { "wxSL_LEFT", "Displays ticks on the left and forces the slider to be vertical." },
+        { "wxSL_RIGHT", "Displays ticks on the right and forces the slider to be vertical." },
+        { "wxSL_TOP", "Displays ticks on the top." },
+        { "wxSL_BOTTOM", "Displays ticks on the bottom (this is the default)." },
+        { "wxSL_BOTH", "Displays ticks on both sides." },
+        { "wxSL_SELRANGE", "Allows the user to select a range on the slider. Windows only." },
+        { "wxSL_INVERSE", "Inverses the minimum and maximum endpoints on the slider. Not compatible with wxSL_SELRANGE." },
+        { "wxGA_HORIZONTAL", "Create a horizontal gauge." },
+        { "wxGA_VERTICAL", "Create a vertical gauge." },
+        { "wxGA_SMOOTH", "Create a smooth progress bar with one pixel wide update step (not supported by all platforms)." },
+        { "wxSB_HORIZONTAL", "Specifies a horizontal scrollbar." },
+        { "wxSB_VERTICAL", "Specifies a vertical scrollbar." },
+        { "wxHL_ALIGN_LEFT", "Align the text to the left." },
+        { "wxHL_ALIGN_RIGHT", "Align the text to the right." },
+        { "wxHL_ALIGN_CENTRE", "Center the text (horizontally)." },
+        { "wxHL_CONTEXTMENU", "Pop up a context menu when the hyperlink is right-clicked. The context menu contains a \"Copy URL\" menu item which is automatically handled by the hyperlink and which just copies in the clipboard the URL (not the label) of the control." },
+        { "wxHL_DEFAULT_STYLE", "The default style for wxHyperlinkCtrl: wxBORDER_NONE | wxHL_CONTEXTMENU | wxHL_ALIGN_CENTRE." },
+        { "wxTE_PROCESS_ENTER", "The control will generate the event wxEVT_TEXT_ENTER (otherwise pressing Enter key is either processed internally by the control or used for navigation between dialog controls)." },
+        { "wxTE_PROCESS_TAB", "The control will receive wxEVT_CHAR events for TAB pressed - normally, TAB is used for passing to the next control in a dialog instead. For the control created with this style, you can still use Ctrl-Enter to pass to the next control from the keyboard." },
+        { "wxTE_NOHIDESEL", "By default, the Windows text control doesn't show the selection when it doesn't have focus - use this style to force it to always show it. It doesn't do anything under other platforms." },
+        { "wxTE_LEFT", "The text in the control will be left-justified (default)." },
+        { "wxTE_CENTER", "The text in the control will be centered (currently wxMSW and wxGTK2 only). " },
+        { "wxTE_RIGHT", "The text in the control will be right-justified (currently wxMSW and wxGTK2 only)." },
+        { "wxHW_SCROLLBAR_NEVER", "Never display scrollbars, not even when the page is larger than the window." },
+        { "wxHW_SCROLLBAR_AUTO", "Display scrollbars only if page's size exceeds window's size." },
+        { "wxHW_NO_SELECTION", "Don't allow the user to select text." },
+        { "wxCAL_SUNDAY_FIRST", "Show Sunday as the first day in the week (not in wxGTK)" },
+        { "wxCAL_MONDAY_FIRST", "Show Monday as the first day in the week (not in wxGTK)" },
+        { "wxCAL_SHOW_HOLIDAYS", "Highlight holidays in the calendar (only generic)" },
+        { "wxCAL_NO_YEAR_CHANGE", "Disable the year changing (deprecated, only generic)" },
+        { "wxCAL_NO_MONTH_CHANGE", "Disable the month (and, implicitly, the year) changing" },
+        { "wxCAL_SHOW_SURROUNDING_WEEKS", "Show the neighboring weeks in the previous and next months (only generic, always on for the native controls)" },
+        { "wxCAL_SEQUENTIAL_MONTH_SELECTION", "Use alternative, more compact, style for the month and year selection controls (only generic)" },
+        { "wxCAL_SHOW_WEEK_NUMBERS", "Show week numbers on the left side of the calendar (not in generic)" },
+        { "wxDIRCTRL_DIR_ONLY", "Only show directories, and not files." },
+        { "wxDIRCTRL_3D_INTERNAL", "Use 3D borders for internal controls." },
+        { "wxDIRCTRL_SELECT_FIRST", "When setting the default path, select the first file in the directory." },
+        { "wxDIRCTRL_SHOW_FILTERS", "Show the drop-down filter list." },
+        { "wxDIRCTRL_EDIT_LABELS", "Allow the folder and file labels to be editable." },
+        { "wxDIRCTRL_MULTIPLE", "Allows multiple files and folders to be selected simultaneously" },
+        { "wxFC_OPEN", "Creates a file control suitable for opening files. Cannot be used with wxFC_SAVE." },
+        { "wxFC_SAVE", "Creates an file control suitable for saving files. Cannot be used with wxFC_OPEN." },
+        { "wxFC_MULTIPLE", "For wxFC_OPEN control only. Allows selecting multiple files. Cannot be combined with wxFC_SAVE." },
+        { "wxFC_NOSHOWHIDDEN", "Hides the \"Show Hidden Files\" checkbox. Ignored on wxGTK" },
+    };
+
+    constexpr Event s_events[] = {
+        { "wxEVT_KILL_FOCUS", "wxFocusEvent", "" },
+        { "wxEVT_SET_FOCUS", "wxFocusEvent", "" },
+        { "wxEVT_CONTEXT_MENU", "wxContextMenuEvent", "" },
+        { "wxEVT_ERASE_BACKGROUND", "wxEraseEvent", "" },
+        { "wxEVT_HELP", "wxHelpEvent", "" },
+        { "wxEVT_PAINT", "wxPaintEvent", "" },
+        { "wxEVT_SIZE", "wxSizeEvent", "" },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_CHAR", "wxKeyEvent", "" },
+        { "wxEVT_CHAR_HOOK", "wxKeyEvent", "Unlike all the other key events, this event is propagated upwards the window hierarchy which allows intercepting it in the parent window of the focused window to which it is sent initially (if there is no focused window, this event is sent to the wxApp global object). It is also generated before any other key events and so gives the parent window an opportunity to modify the keyboard handling of its children, e.g. it is used internally by wxWidgets in some ports to intercept pressing Esc key in any child of a dialog to close the dialog itself when it's pressed. By default, if this event is handled, i.e. the handler doesn't call wxEvent::Skip(), neither wxEVT_KEY_DOWN nor wxEVT_CHAR events will be generated (although wxEVT_KEY_UP still will be), i.e. it replaces the normal key events. However by calling the special DoAllowNextEvent() method you can handle wxEVT_CHAR_HOOK and still allow normal events generation. This is something that is rarely useful but can be required if you need to prevent a parent wxEVT_CHAR_HOOK handler from running without suppressing the normal key events. Finally notice that this event is not generated when the mouse is captured as it is considered that the window which has the capture should receive all the keyboard events too without allowing its parent wxTopLevelWindow to interfere with their processing." },
+        { "wxEVT_KEY_DOWN", "wxKeyEvent", "Generated when any key has been pressed. If this event is handled and not skipped, wxEVT_CHAR will not be generated at all for this key press (but wxEVT_KEY_UP will be)." },
+        { "wxEVT_KEY_UP", "wxKeyEvent", "Generated when any key has been released." },
+        { "wxEVT_ENTER_WINDOW", "wxMouseEvent", "" },
+        { "wxEVT_LEAVE_WINDOW", "wxMouseEvent", "" },
+        { "wxEVT_LEFT_DCLICK", "wxMouseEvent", "" },
+        { "wxEVT_LEFT_DOWN", "wxMouseEvent", "" },
+        { "wxEVT_LEFT_UP", "wxMouseEvent", "" },
+        { "wxEVT_MIDDLE_DCLICK", "wxMouseEvent", "" },
+        { "wxEVT_MIDDLE_DOWN", "wxMouseEvent", "" },
+        { "wxEVT_MIDDLE_UP", "wxMouseEvent", "" },
+        { "wxEVT_RIGHT_DCLICK", "wxMouseEvent", "" },
+        { "wxEVT_RIGHT_DOWN", "wxMouseEvent", "" },
+        { "wxEVT_RIGHT_UP", "wxMouseEvent", "" },
+        { "wxEVT_AUX1_DCLICK", "wxMouseEvent", "" },
+        { "wxEVT_AUX1_DOWN", "wxMouseEvent", "" },
+        { "wxEVT_AUX1_UP", "wxMouseEvent", "" },
+        { "wxEVT_AUX2_DCLICK", "wxMouseEvent", "" },
+        { "wxEVT_AUX2_DOWN", "wxMouseEvent", "" },
+        { "wxEVT_AUX2_UP", "wxMouseEvent", "" },
+        { "wxEVT_MOTION", "wxMouseEvent", "" },
+        { "wxEVT_MOUSEWHEEL", "wxMouseEvent", "" },
+        { "wxEVT_TREE_BEGIN_DRAG", "wxTreeEvent", "Generated when beginning to drag with the left mouse button." },
+        { "wxEVT_TREE_BEGIN_RDRAG", "wxTreeEvent", "Generated when beginning to drag with the right mouse button." },
+        { "wxEVT_TREE_END_DRAG", "wxTreeEvent", "Generated when ending dragging with the left or right mouse button." },
+        { "wxEVT_TREE_BEGIN_LABEL_EDIT", "wxTreeEvent", "This can be prevented by calling Veto()." },
+        { "wxEVT_TREE_END_LABEL_EDIT", "wxTreeEvent", "This can be prevented by calling Veto()." },
+        { "wxEVT_TREE_DELETE_ITEM", "wxTreeEvent", "" },
+        { "wxEVT_TREE_ITEM_ACTIVATED", "wxTreeEvent", "" },
+        { "wxEVT_TREE_ITEM_COLLAPSED", "wxTreeEvent", "" },
+        { "wxEVT_TREE_ITEM_COLLAPSING", "wxTreeEvent", "This can be prevented by calling Veto()." },
+        { "wxEVT_TREE_ITEM_EXPANDED", "wxTreeEvent", "" },
+        { "wxEVT_TREE_ITEM_EXPANDING", "wxTreeEvent", "This can be prevented by calling Veto()." },
+        { "wxEVT_TREE_ITEM_RIGHT_CLICK", "wxTreeEvent", "" },
+        { "wxEVT_TREE_ITEM_MIDDLE_CLICK", "wxTreeEvent", "" },
+        { "wxEVT_TREE_SEL_CHANGED", "wxTreeEvent", "" },
+        { "wxEVT_TREE_SEL_CHANGING", "wxTreeEvent", "This can be prevented by calling Veto()." },
+        { "wxEVT_TREE_KEY_DOWN", "wxTreeEvent", "" },
+        { "wxEVT_TREE_ITEM_MENU", "wxTreeEvent", "Generated when the context menu for the selected item has been requested, either by a right click or by using the menu key." },
+        { "wxEVT_ACTIVATE", "wxActivateEvent", "An activate event is sent when a window or application is being activated or deactivated." },
+        { "wxEVT_CLOSE_WINDOW", "wxCloseEvent", "Sent when the user has tried to close a a frame or dialog box using the window manager (X) or system menu (Windows)" },
+        { "wxEVT_ICONIZE", "wxIconizeEvent", "Only available for the wxMSW, wxGTK ports." },
+        { "wxEVT_MAXIMIZE", "wxMaximizeEvent", "Sent when a top level window is maximized." },
+        { "wxEVT_MOVE", "wxMoveEvent", "Generated when a window is moved." },
+        { "wxEVT_MOVING", "wxMoveEvent", "Generated while the user is moving the window. These events are currently only generated by wxMSW port." },
+        { "wxEVT_MOVE_START", "wxMoveEvent", "Generated when the user starts to move or size a window. These events are currently only generated by wxMSW port." },
+        { "wxEVT_MOVE_END", "wxMoveEvent", "Generated when the user stops moving or sizing a window. These events are currently only generated by wxMSW port." },
+        { "wxEVT_SHOW", "wxShowEvent", "Sent when the window is shown or hidden. Notice that the event is not triggered when the application is iconized (minimized) or restored under wxMSW." },
+        { "wxEVT_IDLE", "wxIdleEvent", "Generated when the system becomes idle." },
+        { "wxEVT_TOOL", "wxCommandEvent", "" },
+        { "wxEVT_TOOL_DROPDOWN", "wxCommandEvent", "" },
+        { "wxEVT_TOOL_RCLICKED", "wxCommandEvent", "" },
+        { "wxEVT_TOOL_ENTER", "wxCommandEvent", "This uses the tools parent ID, the ToolBar, so be sure you set it to something that is not the default. The value of wxCommandEvent::GetSelection is the tool id, or -1 if the mouse cursor has moved off a tool." },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_TOOL_DROPDOWN", "wxCommandEvent", "" },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_TOOL", "wxCommandEvent", "Same as wxEVT_MENU -- generated when the item is chosen in the toolbar or menu (if the same id was added to a menu)." },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_AUITOOLBAR_TOOL_DROPDOWN", "wxAuiToolBarEvent", "" },
+        { "wxEVT_AUITOOLBAR_OVERFLOW_CLICK", "wxAuiToolBarEvent", "" },
+        { "wxEVT_AUITOOLBAR_RIGHT_CLICK", "wxAuiToolBarEvent", "" },
+        { "wxEVT_AUITOOLBAR_MIDDLE_CLICK", "wxAuiToolBarEvent", "" },
+        { "wxEVT_AUITOOLBAR_BEGIN_DRAG", "wxAuiToolBarEvent", "" },
+        { "wxEVT_TOOL", "wxCommandEvent", "Same as wxEVT_MENU -- generated when the item is chosen in the toolbar or menu (if the same id was added to a menu)." },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_AUITOOLBAR_OVERFLOW_CLICK", "wxAuiToolBarEvent", "" },
+        { "wxEVT_AUITOOLBAR_RIGHT_CLICK", "wxAuiToolBarEvent", "" },
+        { "wxEVT_AUITOOLBAR_MIDDLE_CLICK", "wxAuiToolBarEvent", "" },
+        { "wxEVT_AUITOOLBAR_BEGIN_DRAG", "wxAuiToolBarEvent", "" },
+        { "wxEVT_MENU", "wxCommandEvent", "" },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_RIBBONBAR_PAGE_CHANGED", "wxRibbonBarEvent", "Triggered after the transition from one page being active to a different page being active." },
+        { "wxEVT_RIBBONBAR_PAGE_CHANGING", "wxRibbonBarEvent", "Triggered prior to the transition from one page being active to a different page being active, and can veto the change." },
+        { "wxEVT_RIBBONBAR_TAB_MIDDLE_DOWN", "wxRibbonBarEvent", "Triggered when the middle mouse button is pressed on a tab." },
+        { "wxEVT_RIBBONBAR_TAB_MIDDLE_UP", "wxRibbonBarEvent", "Triggered when the middle mouse button is released on a tab." },
+        { "wxEVT_RIBBONBAR_TAB_RIGHT_DOWN", "wxRibbonBarEvent", "Triggered when the right mouse button is pressed on a tab." },
+        { "wxEVT_RIBBONBAR_TAB_RIGHT_UP", "wxRibbonBarEvent", "Triggered when the right mouse button is released on a tab." },
+        { "wxEVT_RIBBONBAR_TAB_LEFT_DCLICK", "wxRibbonBarEvent", "Triggered when the left mouse button is double clicked on a tab." },
+        { "wxEVT_RIBBONBAR_TOGGLED", "wxRibbonBarEvent", "Triggered when the button triggering the ribbon bar is clicked." },
+        { "wxEVT_RIBBONBAR_HELP_CLICKED", "wxRibbonBarEvent", "Triggered when the help button is clicked." },
+        { "wxEVT_RIBBONPANEL_EXTBUTTON_ACTIVATED", "wxRibbonPanelEvent", "Triggered when the user activate the panel extension button." },
+        { "EVT_RIBBONBUTTONBAR_CLICKED", "wxRibbonToolBarEvent", "Triggered when the normal (non-dropdown) region of a button on the button bar is clicked." },
+        { "EVT_RIBBONBUTTONBAR_DROPDOWN_CLICKED", "wxRibbonToolBarEvent", "Triggered when the dropdown region of a button on the button bar is clicked. wxRibbonButtonBarEvent::PopupMenu() should be called by the event handler if it wants to display a popup menu (which is what most dropdown buttons should be doing)." },
+        { "wxEVT_RIBBONBUTTON_CLICKED", "wxRibbonButtonBarEvent", "Triggered when the normal (non-dropdown) region of a button on the button bar is clicked." },
+        { "wxEVT_RIBBONBUTTON_DROPDOWN_CLICKED", "wxRibbonButtonBarEvent", "Triggered when the dropdown region of a button on the button bar is clicked. wxRibbonButtonBarEvent::PopupMenu() should be called by the event handler if it wants to display a popup menu (which is what most dropdown buttons should be doing)." },
+        { "wxEVT_RIBBONTOOLBAR_CLICKED", "wxRibbonToolBarEvent", "Triggered when the normal (non-dropdown) region of a tool on the tool bar is clicked." },
+        { "wxEVT_RIBBONTOOLBAR_DROPDOWN_CLICKED", "wxRibbonToolBarEvent", "Triggered when the dropdown region of a tool on the tool bar is clicked. wxRibbonToolBarEvent::PopupMenu() should be called by the event handler if it wants to display a popup menu (which is what most dropdown tools should be doing)." },
+        { "wxEVT_RIBBONTOOLBAR_CLICKED", "wxRibbonToolBarEvent", "Triggered when the normal (non-dropdown) region of a tool on the tool bar is clicked." },
+        { "wxEVT_RIBBONTOOLBAR_DROPDOWN_CLICKED", "wxRibbonToolBarEvent", "Triggered when the dropdown region of a tool on the tool bar is clicked. wxRibbonToolBarEvent::PopupMenu() should be called by the event handler if it wants to display a popup menu (which is what most dropdown tools should be doing)." },
+        { "wxEVT_RIBBONGALLERY_SELECTED", "wxRibbonGalleryEvent", "Triggered when the user selects an item from the gallery." },
+        { "wxEVT_RIBBONGALLERY_CLICKED", "wxRibbonGalleryEvent", "Similar to EVT_RIBBONGALLERY_SELECTED but triggered every time a gallery item is clicked, even if it is already selected." },
+        { "wxEVT_RIBBONGALLERY_HOVER_CHANGED", "wxRibbonGalleryEvent", "Triggered when the item being hovered over by the user changes. The item in the event will be the new item being hovered, or NULL if there is no longer an item being hovered." },
+        { "wxEVT_BUTTON", "wxCommandEvent", "Triggered when the extension button of the gallery is pressed." },
+        { "wxEVT_COMBOBOX", "wxCommandEvent", "Generated when an item on the list is selected. Call GetValue() to return the new value of the selection." },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the combobox text changes." },
+        { "wxEVT_TEXT_ENTER", "wxCommandEvent", "Generated when <RETURN> is pressed in the combobox." },
+        { "wxEVT_COMBOBOX_DROPDOWN", "wxCommandEvent", "Generated when the list box part of the combo box is shown (drops down). Notice that this event is only supported by Windows, wxGTK with GTK+ 2.10 or later, and wxOSX/Cocoa." },
+        { "wxEVT_COMBOBOX_CLOSEUP", "wxCommandEvent", "Generated when the list box of the combo box closes up. This event is only generated for the same platforms as wxEVT_COMBOBOX_DROPDOWN above. Also note that only Windows and wxOSX/Cocoa support adding or deleting items in this event." },
+        { "wxEVT_COMBOBOX", "wxCommandEvent", "Generated when an item in the list is selected. Calling GetValue() to return the new value of the selection." },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the combobox text changes." },
+        { "wxEVT_TEXT_ENTER", "wxCommandEvent", "Generated when <RETURN> is pressed in the combobox." },
+        { "wxEVT_CHOICE", "wxCommandEvent", "Generated when an item in the list is selected." },
+        { "wxEVT_LISTBOX", "wxCommandEvent", "Generated when an item in the list is selected." },
+        { "wxEVT_LISTBOX_DCLICK", "wxCommandEvent", "Generated when the listbox is double-clicked." },
+        { "wxEVT_LISTBOX", "wxCommandEvent", "Generated when an item in the list is selected." },
+        { "wxEVT_LISTBOX_DCLICK", "wxCommandEvent", "Generated when the listbox is double-clicked." },
+        { "EVT_HTML_CELL_CLICKED", "wxHtmlCellEvent", "A wxHtmlCell was clicked." },
+        { "EVT_HTML_CELL_HOVER", "wxHtmlCellEvent", "The mouse passed over a wxHtmlCell." },
+        { "EVT_HTML_LINK_CLICKED", "wxHtmlCellEvent", "A wxHtmlCell which contains a hyperlink was clicked." },
+        { "wxEVT_CHECKLISTBOX", "wxCommandEvent", "Generated when an item in the check list box is checked or unchecked." },
+        { "wxEVT_LISTBOX", "wxCommandEvent", "Generated when an item in the list is selected." },
+        { "wxEVT_LISTBOX_DCLICK", "wxCommandEvent", "Generated when the listbox is double-clicked." },
+        { "wxEVT_RADIOBOX", "wxCommandEvent", "Generated when a radio button in the box is clicked." },
+        { "wxEVT_CHECKBOX", "wxCommandEvent", "Generated when the checkbox is clicked." },
+        { "wxEVT_CHECKBOX", "wxCommandEvent", "Generated when the checkbox is clicked." },
+        { "wxEVT_RADIOBUTTON", "wxCommandEvent", "Generated when the radio button is clicked." },
+        { "wxEVT_BUTTON", "wxCommandEvent", "Generated when the button is clicked" },
+        { "wxEVT_BUTTON", "wxCommandEvent", "Generated when the button is clicked" },
+        { "wxEVT_BUTTON", "wxCommandEvent", "Generated when the button is clicked" },
+        { "wxEVT_SPINCTRL", "wxSpinEvent", "Generated whenever the numeric value of the spinctrl is updated." },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated whenever the user modifies the text in the edit part of the spin control directly." },
+        { "wxEVT_TEXT_ENTER", "wxCommandEvent", "Generated when enter is pressed in the edit part of the spin control (which must have wxTE_PROCESS_ENTER style for this event to be generated)." },
+        { "wxEVT_SPINCTRLDOUBLE", "wxSpinDoubleEvent", "Generated whenever the numeric value of the control is updated." },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated whenever the user modifies the text in the edit part of the spin control directly." },
+        { "wxEVT_TEXT_ENTER", "wxCommandEvent", "Generated when enter is pressed in the edit part of the spin control (which must have wxTE_PROCESS_ENTER style for this event to be generated)." },
+        { "wxEVT_SPIN", "wxSpinEvent", "Generated whenever an arrow is pressed." },
+        { "wxEVT_SPIN_UP", "wxSpinEvent", "Generated when left/up arrow is pressed." },
+        { "wxEVT_SPIN_DOWN", "wxSpinEvent", "Generated when right/down arrow is pressed." },
+        { "wxEVT_TOGGLEBUTTON", "wxCommandEvent", "" },
+        { "wxEVT_TOGGLEBUTTON", "wxCommandEvent", "" },
+        { "wxEVT_HELP", "wxHelpEvent", "Generated when the button is clicked" },
+        { "wxEVT_SPLITTER_SASH_POS_CHANGING", "wxSplitterEvent", "The sash position is in the process of being changed. May be used to modify the position of the tracking bar to properly reflect the position that would be set if the drag were to be completed at this point." },
+        { "wxEVT_SPLITTER_SASH_POS_CHANGED", "wxSplitterEvent", "The sash position was changed. May be used to modify the sash position before it is set, or to prevent the change from taking place." },
+        { "wxEVT_SPLITTER_UNSPLIT", "wxSplitterEvent", "The splitter has been just unsplit." },
+        { "wxEVT_SPLITTER_DOUBLECLICKED", "wxSplitterEvent", "The sash was double clicked. The default behaviour is to unsplit the window when this happens (unless the minimum pane size has been set to a value greater than zero)." },
+        { "wxEVT_SCROLLWIN_TOP", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_BOTTOM", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_LINEUP", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_LINEDOWN", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_PAGEUP", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_PAGEDOWN", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_THUMBTRACK", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_THUMBRELEASE", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_TOP", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_BOTTOM", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_LINEUP", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_LINEDOWN", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_PAGEUP", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_PAGEDOWN", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_THUMBTRACK", "wxScrollWinEvent", "" },
+        { "wxEVT_SCROLLWIN_THUMBRELEASE", "wxScrollWinEvent", "" },
+        { "wxEVT_COLLAPSIBLEPANE_CHANGED", "wxCollapsiblePaneEvent", "The user expanded or collapsed the collapsible pane." },
+        { "wxEVT_CHOICEBOOK_PAGE_CHANGED", "wxBookCtrlEvent", "The page selection was changed." },
+        { "wxEVT_CHOICEBOOK_PAGE_CHANGING", "wxBookCtrlEvent", "The page selection is about to be changed. This event can be vetoed (using wxNotifyEvent::Veto())." },
+        { "wxEVT_LISTBOOK_PAGE_CHANGED", "wxBookCtrlEvent", "The page selection was changed." },
+        { "wxEVT_LISTBOOK_PAGE_CHANGING", "wxBookCtrlEvent", "The page selection is about to be changed. This event can be vetoed." },
+        { "wxEVT_AUINOTEBOOK_PAGE_CLOSE", "wxAuiNotebookEvent", "A page is about to be closed." },
+        { "wxEVT_AUINOTEBOOK_PAGE_CLOSED", "wxAuiNotebookEvent", "A page has been closed." },
+        { "wxEVT_AUINOTEBOOK_PAGE_CHANGING", "wxAuiNotebookEvent", "The page selection is about to be changed. This event can be vetoed." },
+        { "wxEVT_AUINOTEBOOK_PAGE_CHANGED", "wxAuiNotebookEvent", "The page selection was changed." },
+        { "wxEVT_AUINOTEBOOK_BUTTON", "wxAuiNotebookEvent", "The window list button has been pressed." },
+        { "wxEVT_AUINOTEBOOK_BEGIN_DRAG", "wxAuiNotebookEvent", "Dragging is about to begin." },
+        { "wxEVT_AUINOTEBOOK_END_DRAG", "wxAuiNotebookEvent", "Dragging has ended." },
+        { "wxEVT_AUINOTEBOOK_DRAG_MOTION", "wxAuiNotebookEvent", "Emitted during a drag and drop operation." },
+        { "wxEVT_AUINOTEBOOK_ALLOW_DND", "wxAuiNotebookEvent", "Whether to allow a tab to be dropped. This event must be specially allowed." },
+        { "wxEVT_AUINOTEBOOK_DRAG_DONE", "wxAuiNotebookEvent", "The tab has been dragged." },
+        { "wxEVT_AUINOTEBOOK_TAB_MIDDLE_DOWN", "wxAuiNotebookEvent", "The middle mouse button is pressed on a tab." },
+        { "wxEVT_AUINOTEBOOK_TAB_MIDDLE_UP", "wxAuiNotebookEvent", "The middle mouse button is released on a tab." },
+        { "wxEVT_AUINOTEBOOK_TAB_RIGHT_DOWN", "wxAuiNotebookEvent", "The right mouse button is pressed on a tab." },
+        { "wxEVT_AUINOTEBOOK_TAB_RIGHT_UP", "wxAuiNotebookEvent", "The right mouse button is released on a tab." },
+        { "wxEVT_AUINOTEBOOK_BG_DCLICK", "wxAuiNotebookEvent", "Double clicked on the tabs background area." },
+        { "wxEVT_NOTEBOOK_PAGE_CHANGED", "wxBookCtrlEvent", "The page selection was changed." },
+        { "wxEVT_NOTEBOOK_PAGE_CHANGING", "wxBookCtrlEvent", "The page selection is about to be changed. This event can be vetoed." },
+        { "wxEVT_TOOLBOOK_PAGE_CHANGED", "wxBookCtrlEvent", "The page selection was changed." },
+        { "wxEVT_TOOLBOOK_PAGE_CHANGING", "wxBookCtrlEvent", "The page selection is about to be changed. This event can be vetoed." },
+        { "wxEVT_TREEBOOK_PAGE_CHANGED", "wxBookCtrlEvent", "The page selection was changed." },
+        { "wxEVT_TREEBOOK_PAGE_CHANGING", "wxBookCtrlEvent", "The page selection is about to be changed. This event can be vetoed." },
+        { "wxEVT_TREEBOOK_NODE_COLLAPSED", "wxBookCtrlEvent", "Generated when the page node is going to be collapsed." },
+        { "wxEVT_TREEBOOK_NODE_EXPANDED", "wxBookCtrlEvent", "Generated when the page node is going to be collapsed." },
+        { "wxEVT_BOOKCTRL_PAGE_CHANGED", "wxBookCtrlEvent", "The page selection was changed." },
+        { "wxEVT_BOOKCTRL_PAGE_CHANGING", "wxBookCtrlEvent", "The page selection is about to be changed. This event can be vetoed." },
+        { "wxEVT_LIST_BEGIN_DRAG", "wxListEvent", "Begin dragging with the left mouse button." },
+        { "wxEVT_LIST_BEGIN_RDRAG", "wxListEvent", "Begin dragging with the right mouse button." },
+        { "wxEVT_LIST_BEGIN_LABEL_EDIT", "wxListEvent", "Begin editing a label. This can be prevented by calling Veto()." },
+        { "wxEVT_LIST_END_LABEL_EDIT", "wxListEvent", "Finish editing a label. This can be prevented by calling Veto()." },
+        { "wxEVT_LIST_DELETE_ITEM", "wxListEvent", "Delete an item." },
+        { "wxEVT_LIST_DELETE_ALL_ITEMS", "wxListEvent", "Delete all items." },
+        { "wxEVT_LIST_ITEM_SELECTED", "wxListEvent", "The item has been selected." },
+        { "wxEVT_LIST_ITEM_DESELECTED", "wxListEvent", "The item has been deselected." },
+        { "wxEVT_LIST_ITEM_ACTIVATED", "wxListEvent", "The item has been activated (ENTER or double click)." },
+        { "wxEVT_LIST_ITEM_FOCUSED", "wxListEvent", "The currently focused item has changed." },
+        { "wxEVT_LIST_ITEM_MIDDLE_CLICK", "wxListEvent", "The middle mouse button has been clicked on an item." },
+        { "wxEVT_LIST_ITEM_RIGHT_CLICK", "wxListEvent", "The right mouse button has been clicked on an item." },
+        { "wxEVT_LIST_KEY_DOWN", "wxListEvent", "A key has been pressed." },
+        { "wxEVT_LIST_INSERT_ITEM", "wxListEvent", "An item has been inserted." },
+        { "wxEVT_LIST_COL_CLICK", "wxListEvent", "A column (m_col) has been left-clicked." },
+        { "wxEVT_LIST_COL_RIGHT_CLICK", "wxListEvent", "A column (m_col) has been right-clicked." },
+        { "wxEVT_LIST_COL_BEGIN_DRAG", "wxListEvent", "The user started resizing a column - can be vetoed." },
+        { "wxEVT_LIST_COL_DRAGGING", "wxListEvent", "The divider between columns is being dragged." },
+        { "wxEVT_LIST_COL_END_DRAG", "wxListEvent", "A column has been resized by the user." },
+        { "wxEVT_LIST_CACHE_HINT", "wxListEvent", "Prepare cache for a virtual list control." },
+        { "wxEVT_LIST_BEGIN_DRAG", "wxListEvent", "Begin dragging with the left mouse button." },
+        { "wxEVT_LIST_BEGIN_RDRAG", "wxListEvent", "Begin dragging with the right mouse button." },
+        { "wxEVT_LIST_BEGIN_LABEL_EDIT", "wxListEvent", "Begin editing a label. This can be prevented by calling Veto()." },
+        { "wxEVT_LIST_END_LABEL_EDIT", "wxListEvent", "Finish editing a label. This can be prevented by calling Veto()." },
+        { "wxEVT_LIST_DELETE_ITEM", "wxListEvent", "Delete an item." },
+        { "wxEVT_LIST_DELETE_ALL_ITEMS", "wxListEvent", "Delete all items." },
+        { "wxEVT_LIST_ITEM_SELECTED", "wxListEvent", "The item has been selected." },
+        { "wxEVT_LIST_ITEM_DESELECTED", "wxListEvent", "The item has been deselected." },
+        { "wxEVT_LIST_ITEM_ACTIVATED", "wxListEvent", "The item has been activated (ENTER or double click)." },
+        { "wxEVT_LIST_ITEM_FOCUSED", "wxListEvent", "The currently focused item has changed." },
+        { "wxEVT_LIST_ITEM_MIDDLE_CLICK", "wxListEvent", "The middle mouse button has been clicked on an item." },
+        { "wxEVT_LIST_ITEM_RIGHT_CLICK", "wxListEvent", "The right mouse button has been clicked on an item." },
+        { "wxEVT_LIST_KEY_DOWN", "wxListEvent", "A key has been pressed." },
+        { "wxEVT_LIST_INSERT_ITEM", "wxListEvent", "An item has been inserted." },
+        { "wxEVT_LIST_COL_CLICK", "wxListEvent", "A column (m_col) has been left-clicked." },
+        { "wxEVT_LIST_COL_RIGHT_CLICK", "wxListEvent", "A column (m_col) has been right-clicked." },
+        { "wxEVT_LIST_COL_BEGIN_DRAG", "wxListEvent", "The user started resizing a column - can be vetoed." },
+        { "wxEVT_LIST_COL_DRAGGING", "wxListEvent", "The divider between columns is being dragged." },
+        { "wxEVT_LIST_COL_END_DRAG", "wxListEvent", "A column has been resized by the user." },
+        { "wxEVT_LIST_CACHE_HINT", "wxListEvent", "Prepare cache for a virtual list control." },
+        { "wxEVT_DATAVIEW_SELECTION_CHANGED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_ACTIVATED", "wxDataViewEvent", "This event is triggered by double clicking an item or pressing some special key (usually 'Enter') when it is focused." },
+        { "wxEVT_DATAVIEW_ITEM_START_EDITING", "wxDataViewEvent", "This event can be vetoed in order to prevent editing on an item by item basis." },
+        { "wxEVT_DATAVIEW_ITEM_EDITING_STARTED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_EDITING_DONE", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_COLLAPSING", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_COLLAPSED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_EXPANDING", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_EXPANDED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_VALUE_CHANGED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_CONTEXT_MENU", "wxDataViewEvent", "Generated when the user right clicks inside the control. Notice that this menu is generated even if the click didn't occur on any valid item, in this case wxDataViewEvent::GetItem() simply returns an invalid item." },
+        { "wxEVT_DATAVIEW_COLUMN_HEADER_CLICK", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_COLUMN_HEADER_RIGHT_CLICK", "wxDataViewEvent", "Notice that currently this event is not generated in the native OS X versions of the control." },
+        { "wxEVT_DATAVIEW_COLUMN_SORTED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_COLUMN_REORDERED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_BEGIN_DRAG", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_DROP_POSSIBLE", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_DROP", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_SELECTION_CHANGED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_ACTIVATED", "wxDataViewEvent", "This event is triggered by double clicking an item or pressing some special key (usually 'Enter') when it is focused." },
+        { "wxEVT_DATAVIEW_ITEM_START_EDITING", "wxDataViewEvent", "This event can be vetoed in order to prevent editing on an item by item basis." },
+        { "wxEVT_DATAVIEW_ITEM_EDITING_STARTED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_EDITING_DONE", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_COLLAPSING", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_COLLAPSED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_EXPANDING", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_EXPANDED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_VALUE_CHANGED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_CONTEXT_MENU", "wxDataViewEvent", "Generated when the user right clicks inside the control. Notice that this menu is generated even if the click didn't occur on any valid item, in this case wxDataViewEvent::GetItem() simply returns an invalid item." },
+        { "wxEVT_DATAVIEW_COLUMN_HEADER_CLICK", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_COLUMN_HEADER_RIGHT_CLICK", "wxDataViewEvent", "Notice that currently this event is not generated in the native OS X versions of the control." },
+        { "wxEVT_DATAVIEW_COLUMN_SORTED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_COLUMN_REORDERED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_BEGIN_DRAG", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_DROP_POSSIBLE", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_DROP", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_SELECTION_CHANGED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_ACTIVATED", "wxDataViewEvent", "This event is triggered by double clicking an item or pressing some special key (usually 'Enter') when it is focused." },
+        { "wxEVT_DATAVIEW_ITEM_START_EDITING", "wxDataViewEvent", "This event can be vetoed in order to prevent editing on an item by item basis." },
+        { "wxEVT_DATAVIEW_ITEM_EDITING_STARTED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_EDITING_DONE", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_COLLAPSING", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_COLLAPSED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_EXPANDING", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_EXPANDED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_VALUE_CHANGED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_CONTEXT_MENU", "wxDataViewEvent", "Generated when the user right clicks inside the control. Notice that this menu is generated even if the click didn't occur on any valid item, in this case wxDataViewEvent::GetItem() simply returns an invalid item." },
+        { "wxEVT_DATAVIEW_COLUMN_HEADER_CLICK", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_COLUMN_HEADER_RIGHT_CLICK", "wxDataViewEvent", "Notice that currently this event is not generated in the native OS X versions of the control." },
+        { "wxEVT_DATAVIEW_COLUMN_SORTED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_COLUMN_REORDERED", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_BEGIN_DRAG", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_DROP_POSSIBLE", "wxDataViewEvent", "" },
+        { "wxEVT_DATAVIEW_ITEM_DROP", "wxDataViewEvent", "" },
+        { "wxEVT_GRID_CELL_LEFT_CLICK", "wxGridEvent", "The user clicked a cell with the left mouse button." },
+        { "wxEVT_GRID_CELL_RIGHT_CLICK", "wxGridEvent", "The user clicked a cell with the right mouse button." },
+        { "wxEVT_GRID_CELL_LEFT_DCLICK", "wxGridEvent", "The user double-clicked a cell with the left mouse button." },
+        { "wxEVT_GRID_CELL_RIGHT_DCLICK", "wxGridEvent", "The user double-clicked a cell with the right mouse button." },
+        { "wxEVT_GRID_LABEL_LEFT_CLICK", "wxGridEvent", "The user clicked a label with the left mouse button." },
+        { "wxEVT_GRID_LABEL_RIGHT_CLICK", "wxGridEvent", "The user clicked a label with the right mouse button." },
+        { "wxEVT_GRID_LABEL_LEFT_DCLICK", "wxGridEvent", "The user double-clicked a label with the left mouse button." },
+        { "wxEVT_GRID_LABEL_RIGHT_DCLICK", "wxGridEvent", "The user double-clicked a label with the right mouse button." },
+        { "wxEVT_GRID_CELL_CHANGED", "wxGridEvent", "The user changed the data in a cell." },
+        { "wxEVT_GRID_SELECT_CELL", "wxGridEvent", "The user moved to, and selected a cell." },
+        { "wxEVT_GRID_EDITOR_HIDDEN", "wxGridEvent", "The editor for a cell was hidden." },
+        { "wxEVT_GRID_EDITOR_SHOWN", "wxGridEvent", "The editor for a cell was shown." },
+        { "wxEVT_GRID_COL_SIZE", "wxGridSizeEvent", "The user resized a column by dragging it." },
+        { "wxEVT_GRID_ROW_SIZE", "wxGridSizeEvent", "The user resized a row by dragging it." },
+        { "wxEVT_GRID_RANGE_SELECT", "wxGridRangeSelectEvent", "The user selected a group of contiguous cells." },
+        { "wxEVT_GRID_EDITOR_CREATED", "wxGridEditorCreatedEvent", "The editor for a cell was created." },
+        { "wxEVT_PG_SELECTED", "wxPropertyGridEvent", "Generated when a property selection has been changed." },
+        { "wxEVT_PG_CHANGING", "wxPropertyGridEvent", "Property value is about to be changed. Use wxPropertyGridEvent::GetValue() to take a peek at the pending value, and wxPropertyGridEvent::Veto() to prevent change from taking place, if necessary." },
+        { "wxEVT_PG_CHANGED", "wxPropertyGridEvent", "Property value is modified." },
+        { "wxEVT_PG_HIGHLIGHTED", "wxPropertyGridEvent", "Generated when mouse moves over a property." },
+        { "wxEVT_PG_RIGHT_CLICK", "wxPropertyGridEvent", "Generated when a property is clicked with the right mouse button." },
+        { "wxEVT_PG_DOUBLE_CLICK", "wxPropertyGridEvent", "Generated when a property is double-clicked with the left mouse button." },
+        { "wxEVT_PG_ITEM_COLLAPSED", "wxPropertyGridEvent", "Generated when a user collapses a property or category." },
+        { "wxEVT_PG_ITEM_EXPANDED", "wxPropertyGridEvent", "Generated when a user expands a property or category." },
+        { "wxEVT_PG_LABEL_EDIT_BEGIN", "wxPropertyGridEvent", "Generated when a user is about to begin editing a property label. You can veto this event to prevent the action." },
+        { "wxEVT_PG_LABEL_EDIT_ENDING", "wxPropertyGridEvent", "Generated when a user is about to end editing a property label. You can veto this event to prevent the action." },
+        { "wxEVT_PG_COL_BEGIN_DRAG", "wxPropertyGridEvent", "Generated when a user starts resizing a column. You can veto this event to prevent the action." },
+        { "wxEVT_PG_COL_DRAGGING", "wxPropertyGridEvent", "Generated when a column resize by the user is in progress. This event is also generated when a user double-clicks the splitter in order to recenter it." },
+        { "wxEVT_PG_COL_END_DRAG", "wxPropertyGridEvent", "Generated when a user finishes resizing a column." },
+        { "wxEVT_PG_SELECTED", "wxPropertyGridEvent", "Generated when a property selection has been changed." },
+        { "wxEVT_PG_CHANGING", "wxPropertyGridEvent", "Property value is about to be changed. Use wxPropertyGridEvent::GetValue() to take a peek at the pending value, and wxPropertyGridEvent::Veto() to prevent change from taking place, if necessary." },
+        { "wxEVT_PG_CHANGED", "wxPropertyGridEvent", "Property value is modified." },
+        { "wxEVT_PG_HIGHLIGHTED", "wxPropertyGridEvent", "Generated when mouse moves over a property." },
+        { "wxEVT_PG_RIGHT_CLICK", "wxPropertyGridEvent", "Generated when a property is clicked with the right mouse button." },
+        { "wxEVT_PG_DOUBLE_CLICK", "wxPropertyGridEvent", "Generated when a property is double-clicked with the left mouse button." },
+        { "wxEVT_PG_ITEM_COLLAPSED", "wxPropertyGridEvent", "Generated when a user collapses a property or category." },
+        { "wxEVT_PG_ITEM_EXPANDED", "wxPropertyGridEvent", "Generated when a user expands a property or category." },
+        { "wxEVT_PG_LABEL_EDIT_BEGIN", "wxPropertyGridEvent", "Generated when a user is about to begin editing a property label. You can veto this event to prevent the action." },
+        { "wxEVT_PG_LABEL_EDIT_ENDING", "wxPropertyGridEvent", "Generated when a user is about to end editing a property label. You can veto this event to prevent the action." },
+        { "wxEVT_PG_PAGE_CHANGED", "wxPropertyGridEvent", "Generated when a property manager page is changed" },
+        { "wxEVT_PG_COL_BEGIN_DRAG", "wxPropertyGridEvent", "Generated when a user starts resizing a column. You can veto this event to prevent the action." },
+        { "wxEVT_PG_COL_DRAGGING", "wxPropertyGridEvent", "Generated when a column resize by the user is in progress. This event is also generated when a user double-clicks the splitter in order to recenter it." },
+        { "wxEVT_PG_COL_END_DRAG", "wxPropertyGridEvent", "Generated when a user finishes resizing a column." },
+        { "wxEVT_TREE_GET_INFO", "wxTreeEvent", "Request information from the application." },
+        { "wxEVT_TREE_SET_INFO", "wxTreeEvent", "Information is being supplied." },
+        { "wxEVT_TREE_ITEM_GETTOOLTIP", "wxTreeEvent", "The opportunity to set the item tooltip is being given to the application (call wxTreeEvent::SetToolTip). Windows only." },
+        { "wxEVT_TREE_STATE_IMAGE_CLICK", "wxTreeEvent", "The state image has been clicked. Windows only." },
+        { "wxEVT_TREELIST_SELECTION_CHANGED", "wxTreeListEvent", "In the single selection case the item indicated by the event has been selected and previously selected item, if any, was deselected. In multiple selection case, the selection of this item has just changed (it may have been either selected or deselected) but notice that the selection of other items could have changed as well, use wxTreeListCtrl::GetSelections() to retrieve the new selection if necessary." },
+        { "wxEVT_TREELIST_ITEM_EXPANDING", "wxTreeListEvent", "This event is sent before the expansion occurs and can be vetoed to prevent it from happening." },
+        { "wxEVT_TREELIST_ITEM_EXPANDED", "wxTreeListEvent", "This event is sent after the expansion occurs and can't be vetoed." },
+        { "wxEVT_TREELIST_ITEM_CHECKED", "wxTreeListEvent", "You can use wxTreeListCtrl::GetCheckedState() to retrieve the new item state and wxTreeListEvent::GetOldCheckedState() to get the previous one." },
+        { "wxEVT_TREELIST_ITEM_ACTIVATED", "wxTreeListEvent", "Generated when the user double clicks the item or activating it from the keyboard." },
+        { "wxEVT_TREELIST_ITEM_CONTEXT_MENU", "wxTreeListEvent", "" },
+        { "wxEVT_TREELIST_COLUMN_SORTED", "wxTreeListEvent", "The event doesn't carry the sort direction, use GetSortColumn() method if you need to know it." },
+        { "wxEVT_MENU_HIGHLIGHT", "wxMenuEvent", "" },
+        { "wxEVT_CONTEXT_MENU", "wxContextMenuEvent", "Either provide your own handler function, or add a wxContextMenuEvent to create a popup menu." },
+        { "wxEVT_DESTROY", "wxWindowDestroyEvent", "Sent from the class destructor just before the window is destroyed." },
+        { "wxEVT_CONTEXT_MENU", "wxContextMenuEvent", "Either provide your own handler function, or add a wxContextMenuEvent to create a popup menu." },
+        { "wxEVT_DESTROY", "wxWindowDestroyEvent", "Sent from the class destructor just before the window is destroyed." },
+        { "wxEVT_RIBBONBAR_PAGE_CHANGED", "wxRibbonBarEvent", "Triggered after the transition from one page being active to a different page being active." },
+        { "wxEVT_RIBBONBAR_PAGE_CHANGING", "wxRibbonBarEvent", "Triggered prior to the transition from one page being active to a different page being active, and can veto the change." },
+        { "wxEVT_RIBBONBAR_TAB_MIDDLE_DOWN", "wxRibbonBarEvent", "Triggered when the middle mouse button is pressed on a tab." },
+        { "wxEVT_RIBBONBAR_TAB_MIDDLE_UP", "wxRibbonBarEvent", "Triggered when the middle mouse button is released on a tab." },
+        { "wxEVT_RIBBONBAR_TAB_RIGHT_DOWN", "wxRibbonBarEvent", "Triggered when the right mouse button is pressed on a tab." },
+        { "wxEVT_RIBBONBAR_TAB_RIGHT_UP", "wxRibbonBarEvent", "Triggered when the right mouse button is released on a tab." },
+        { "wxEVT_RIBBONBAR_TAB_LEFT_DCLICK", "wxRibbonBarEvent", "Triggered when the left mouse button is double clicked on a tab." },
+        { "wxEVT_RIBBONBAR_TOGGLED", "wxRibbonBarEvent", "Triggered when the button triggering the ribbon bar is clicked." },
+        { "wxEVT_RIBBONBAR_HELP_CLICKED", "wxRibbonBarEvent", "Triggered when the help button is clicked." },
+        { "wxEVT_INIT_DIALOG", "wxInitDialogEvent", "Generated when the dialog is being initialized." },
+        { "wxEVT_INIT_DIALOG", "wxInitDialogEvent", "Generated when the panel is being initialized." },
+        { "wxEVT_CONTEXT_MENU", "wxContextMenuEvent", "" },
+        { "wxEVT_ERASE_BACKGROUND", "wxEraseEvent", "" },
+        { "wxEVT_IDLE", "wxIdleEvent", "Generated when the system becomes idle." },
+        { "wxEVT_SHOW", "wxShowEvent", "Sent when the panel is shown or hidden." },
+        { "wxEVT_PAINT", "wxPaintEvent", "" },
+        { "wxEVT_SIZE", "wxSizeEvent", "" },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_INIT_DIALOG", "wxInitDialogEvent", "Generated when the dialog is being initialized." },
+        { "OKButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the OK button is clicked" },
+        { "YesButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Yes button is clicked" },
+        { "ApplyButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Apply the button is clicked" },
+        { "NoButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the No button is clicked" },
+        { "CancelButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Cancel button is clicked" },
+        { "CloseButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Close button is clicked" },
+        { "HelpButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Help button is clicked" },
+        { "wxEVT_INIT_DIALOG", "wxInitDialogEvent", "Generated when the Wizard is being initialized." },
+        { "wxEVT_WIZARD_PAGE_CHANGED", "wxWizardEvent", "This event cannot be vetoed." },
+        { "wxEVT_WIZARD_PAGE_CHANGING", "wxWizardEvent", "This event can be vetoed." },
+        { "wxEVT_WIZARD_BEFORE_PAGE_CHANGED", "wxWizardEvent", "Generated after Next is clicked but before GetNext is called. Unlike wxEVT_WIZARD_PAGE_CHANGING, the handler for this function can change state that might affect the return value of GetNext. This event can be vetoed." },
+        { "wxEVT_WIZARD_PAGE_SHOWN", "wxWizardEvent", "The page was shown and laid out (this event cannot be vetoed)." },
+        { "wxEVT_WIZARD_CANCEL", "wxWizardEvent", "The user attempted to cancel the wizard (this event may be vetoed)." },
+        { "wxEVT_WIZARD_HELP", "wxWizardEvent", "Generated when the help button is pressed. " },
+        { "wxEVT_WIZARD_FINISHED", "wxWizardEvent", "Generated when the finish button is pressed." },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the text changes. Notice that this event will always be generated when the text controls contents changes - whether this is due to user input or comes from the program itself (for example, if SetValue() is called.)" },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the text changes. Notice that this event will always be generated when the text controls contents changes - whether this is due to user input or comes from the program itself (for example, if SetValue() is called.)" },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the text changes. Notice that this event will always be generated when the text controls contents changes - whether this is due to user input or comes from the program itself (for example, if SetValue() is called.)" },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the text changes. Notice that this event will always be generated when the text controls contents changes - whether this is due to user input or comes from the program itself (for example, if SetValue() is called.)" },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the text changes. Notice that this event will always be generated when the text controls contents changes - whether this is due to user input or comes from the program itself (for example, if SetValue() is called.)" },
+        { "wxEVT_FILEPICKER_CHANGED", "wxFileDirPickerEvent", "Generated when the user changes the file selected in the control either using the button or using text control (see wxFLP_USE_TEXTCTRL; note that in this case the event is fired only if the user's input is valid, e.g. an existing file path if wxFLP_FILE_MUST_EXIST was given)." },
+        { "wxEVT_DIRPICKER_CHANGED", "wxFileDirPickerEvent", "Generated when the user changes the directory selected in the control either using the button or using text control (see wxDIRP_USE_TEXTCTRL; note that in this case the event is fired only if the user's input is valid, e.g. an existing directory path)." },
+        { "wxEVT_FONTPICKER_CHANGED", "wxFontPickerEvent", "Generated when the user changs the font selected in the control either using the button or using text control (see wxFNTP_USE_TEXTCTRL; note that in this case the event is fired only if the user's input is valid, i.e. recognizable)." },
+        { "wxEVT_COLOURPICKER_CHANGED", "wxColourPickerEvent", "Generated when the user changes the colour selected in the control either using the button or the text control (see wxCLRP_USE_TEXTCTRL. Note that in this case the event is fired only if the user's input is valid)." },
+        { "wxEVT_COLOURPICKER_CURRENT_CHANGED", "wxColourPickerEvent", "Generated when the user changes the currently selected colour in the dialog associated with the control.Currently only works on Windows." },
+        { "EVT_COLOURPICKER_DIALOG_CANCELLED", "wxColourPickerEvent", "Generated if the user cancels the dialog associated with the control. Currently only works on Windows." },
+        { "wxEVT_DATE_CHANGED", "wxDateEvent", "Generated when the user changes the current selection in the control." },
+        { "wxEVT_TIME_CHANGED", "wxDateEvent", "Generated when the user changes the current selection in the control." },
+        { "wxEVT_TIMER", "wxTimerEvent", "Timer event that will be sent to the parent form's class." },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_CHECKBOX", "wxCommandEvent", "Generated when the checkbox is clicked." },
+        { "wxEVT_UPDATE_UI", "wxUpdateUIEvent", "" },
+        { "wxEVT_RADIOBUTTON", "wxCommandEvent", "Generated when the radio button is clicked." },
+        { "OKButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the OK button is clicked" },
+        { "YesButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Yes button is clicked" },
+        { "SaveButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Save button is clicked" },
+        { "ApplyButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Apply the button is clicked" },
+        { "NoButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the No button is clicked" },
+        { "CancelButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Cancel button is clicked" },
+        { "CloseButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Close button is clicked" },
+        { "HelpButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the Help button is clicked" },
+        { "ContextHelpButtonClicked", "wxCommandEvent", "Process a wxEVT_BUTTON event when the ContextHelp button is clicked" },
+        { "OKButton", "wxUpdateUIEvent", "Process a wxEVT_UPDATE_UI event for the OK button." },
+        { "YesButton", "wxUpdateUIEvent", "Process a wxEVT_UPDATE_UI for the Yes button." },
+        { "SaveButton", "wxUpdateUIEvent", "Process a wxEVT_UPDATE_UI for the Save button." },
+        { "ApplyButton", "wxUpdateUIEvent", "Process a wxEVT_UPDATE_UI for the Apply the button." },
+        { "NoButton", "wxUpdateUIEvent", "Process a wxEVT_UPDATE_UI for the No button." },
+        { "CancelButton", "wxUpdateUIEvent", "Process a wxEVT_UPDATE_UI for the Cancel button." },
+        { "CloseButton", "wxUpdateUIEvent", "Process a wxEVT_UPDATE_UI for the Close button." },
+        { "HelpButton", "wxUpdateUIEvent", "Process a wxEVT_UPDATE_UI for the Help button." },
+        { "ContextHelpButton", "wxEVT_BUTTON", "Process a wxEVT_UPDATE_UI for the ContextHelp button." },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the text changes. Notice that this event will always be generated when the text controls contents changes - whether this is due to user input or comes from the program itself (for example, if SetValue() is called.)" },
+        { "wxEVT_TEXT_ENTER", "wxCommandEvent", "Generated when enter is pressed in a text control (which must have wxTE_PROCESS_ENTER style for this event to be generated)." },
+        { "wxEVT_TEXT_URL", "wxTextUrlEvent", "Generated when the a mouse event occurred over an URL in the text control (Windows and wxGTK2 only)." },
+        { "wxEVT_TEXT_MAXLEN", "wxCommandEvent", "Generated when the user tries to enter more text into the control than the limit set by SetMaxLength." },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the text changes. Notice that this event will always be sent when the text controls contents changes - whether this is due to user input or comes from the program itself (for example, if SetValue() is called)" },
+        { "wxEVT_TEXT_ENTER", "wxCommandEvent", "Generated when enter is pressed in a text control (which must have wxTE_PROCESS_ENTER style for this event to be generated)." },
+        { "wxEVT_TEXT_URL", "wxTextUrlEvent", "Generated when a mouse event occurs over a URL in the text control (wxMSW and wxGTK2 only)" },
+        { "wxEVT_RICHTEXT_LEFT_CLICK", "wxRichTextEvent", "Generated when the user releases the left mouse button over an object." },
+        { "wxEVT_RICHTEXT_RIGHT_CLICK", "wxRichTextEvent", "Generated when the user releases the right mouse button over an object." },
+        { "wxEVT_RICHTEXT_MIDDLE_CLICK", "wxRichTextEvent", "Generated when the user releases the middle mouse button over an object." },
+        { "EVT_RICHTEXT_LEFT_DCLICK", "wxRichTextEvent", "Generated when the user double-clicks an object." },
+        { "wxEVT_RICHTEXT_CHARACTER", "wxRichTextEvent", "Generated when the user presses a character key. Valid event functions: GetFlags, GetPosition, GetCharacter." },
+        { "wxEVT_RICHTEXT_CONSUMING_CHARACTER", "wxRichTextEvent", "Generated when the user presses a character key but before it is processed and inserted into the control. Call Veto to prevent normal processing." },
+        { "wxEVT_RICHTEXT_DELETE", "wxRichTextEvent", "Generated when the user presses the backspace or delete key. Valid event functions: GetFlags, GetPosition." },
+        { "wxEVT_RICHTEXT_RETURN", "wxRichTextEvent", "Generated when the user presses the return key. Valid event functions: GetFlags, GetPosition." },
+        { "wxEVT_RICHTEXT_STYLESHEET_CHANGING", "wxRichTextEvent", "Generated when the control's stylesheet is about to change." },
+        { "wxEVT_RICHTEXT_STYLESHEET_CHANGED", "wxRichTextEvent", "Generated when the control's stylesheet has changed, for example the user added, edited or deleted a style. Valid event functions: GetRange, GetPosition." },
+        { "wxEVT_RICHTEXT_STYLESHEET_REPLACING", "wxRichTextEvent", "Generated when the control's stylesheet is about to be replaced, for example when a file is loaded into the control. Valid event functions: Veto, GetOldStyleSheet, GetNewStyleSheet." },
+        { "wxEVT_RICHTEXT_STYLESHEET_REPLACED", "wxRichTextEvent", "Generated when the control's stylesheet has been replaced, for example when a file is loaded into the control. Valid event functions: GetOldStyleSheet, GetNewStyleSheet." },
+        { "wxEVT_RICHTEXT_PROPERTIES_CHANGED", "wxRichTextEvent", "Generated when properties have been applied to the control. Valid event functions: GetPosition, GetRange." },
+        { "wxEVT_RICHTEXT_STYLE_CHANGED", "wxRichTextEvent", "Generated when styling has been applied to the control. Valid event functions: GetPosition, GetRange." },
+        { "wxEVT_RICHTEXT_CONTENT_INSERTED", "wxRichTextEvent", "Generated when content has been inserted into the control. Valid event functions: GetPosition, GetRange." },
+        { "wxEVT_RICHTEXT_CONTENT_DELETED", "wxRichTextEvent", "Generated when content has been deleted from the control. Valid event functions: GetPosition, GetRange." },
+        { "wxEVT_RICHTEXT_BUFFER_RESET ", "wxRichTextEvent", "Generated when the buffer has been reset by deleting all content. You can use this to set a default style for the first new paragraph." },
+        { "wxEVT_RICHTEXT_SELECTION_CHANGED", "wxRichTextEvent", "Generated when the selection range has changed." },
+        { "wxEVT_RICHTEXT_FOCUS_OBJECT_CHANGED", "wxRichTextEvent", "Generated when the current focus object has changed." },
+        { "wxEVT_STC_AUTOCOMP_CANCELLED", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_AUTOCOMP_CHAR_DELETED", "wxStyledTextEvent", "Generated when the user deleted a character while autocompletion list was active." },
+        { "wxEVT_STC_AUTOCOMP_COMPLETED", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_AUTOCOMP_SELECTION", "wxStyledTextEvent", "Generated when the user has selected an item in an autocompletion list. The event is sent before the selection is inserted." },
+        { "wxEVT_STC_AUTOCOMP_SELECTION_CHANGE", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_CALLTIP_CLICK", "wxStyledTextEvent", "Generated when the user clicks on a calltip. This event can be used to display the next function prototype when a function name is overloaded with different arguments." },
+        { "wxEVT_STC_CHANGE", "wxStyledTextEvent", "Generated when the text (not the style) of the document changes. " },
+        { "wxEVT_STC_CHARADDED", "wxStyledTextEvent", "Generated when the user types an ordinary text character (as opposed to a command character) that is entered into the text. You can use this to decide to display a call tip or an auto completion list." },
+        { "wxEVT_STC_CLIPBOARD_COPY", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_CLIPBOARD_PASTE", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_DOUBLECLICK", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_DO_DROP", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_DRAG_OVER", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_DWELLEND", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_DWELLSTART", "wxStyledTextEvent", "Generated when the user keeps the mouse in one position for the dwell period." },
+        { "wxEVT_STC_HOTSPOT_CLICK", "wxStyledTextEvent", "Generated when the user clicks on text that is in a style with the hotspot attribute set." },
+        { "wxEVT_STC_HOTSPOT_DCLICK", "wxStyledTextEvent", "Generated when the user double clicks on text that is in a style with the hotspot attribute set." },
+        { "wxEVT_STC_HOTSPOT_RELEASE_CLICK", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_INDICATOR_CLICK", "wxStyledTextEvent", "Generated when the user clicks the mouse on text that has an indicator." },
+        { "wxEVT_STC_INDICATOR_RELEASE", "wxStyledTextEvent", "Generated when the user releases the mouse on text that has an indicator." },
+        { "wxEVT_STC_MACRORECORD", "wxStyledTextEvent", "Generated each time a recordable change occurs," },
+        { "wxEVT_STC_MARGINCLICK", "wxStyledTextEvent", "Generated when the mouse was clicked inside a margin that was marked as sensitive." },
+        { "wxEVT_STC_MARGIN_RIGHT_CLICK", "wxStyledTextEvent", "Generated when the mouse was right clicked inside a margin that was marked as sensitive." },
+        { "wxEVT_STC_MODIFIED", "wxStyledTextEvent", "Generated when the text or styling of the document changes or is about to change." },
+        { "wxEVT_STC_NEEDSHOWN", "wxStyledTextEvent", "Generated when a range of lines that is currently invisible should be made visible. " },
+        { "wxEVT_STC_PAINTED", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_ROMODIFYATTEMPT", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_SAVEPOINTLEFT", "wxStyledTextEvent", "Generated when the save point is left." },
+        { "wxEVT_STC_SAVEPOINTREACHED", "wxStyledTextEvent", "Generated when the save point is entered." },
+        { "wxEVT_STC_START_DRAG", "wxStyledTextEvent", "" },
+        { "wxEVT_STC_STYLENEEDED", "wxStyledTextEvent", "Generated when about to display or print text that requires styling." },
+        { "wxEVT_STC_UPDATEUI", "wxStyledTextEvent", "Generated when either the text or styling of the document has changed or the selection range or scroll position has changed." },
+        { "wxEVT_STC_USERLISTSELECTION", "wxStyledTextEvent", "Generated when the user has selected an item in a user list. " },
+        { "wxEVT_STC_ZOOM", "wxStyledTextEvent", "Generated when the user zooms the display using the keyboard." },
+        { "wxEVT_CHECKLISTBOX", "wxCommandEvent", "Generated when an item in the check list box is checked or unchecked." },
+        { "wxEVT_LISTBOX", "wxCommandEvent", "Generated when an item in the list is selected." },
+        { "wxEVT_LISTBOX_DCLICK", "wxCommandEvent", "Generated when the listbox is double-clicked." },
+        { "wxEVT_SLIDER", "wxCommandEvent", "Generated after any change of wxSlider position." },
+        { "wxEVT_SCROLL_TOP", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_BOTTOM", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_LINEUP", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_LINEDOWN", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_PAGEUP", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_PAGEDOWN", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_THUMBTRACK", "wxScrollEvent", "Generated as the user drags the thumbtrack." },
+        { "wxEVT_SCROLL_THUMBRELEASE", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_CHANGED", "wxScrollEvent", "Generated on Windows only." },
+        { "wxEVT_SCROLL_TOP", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_BOTTOM", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_LINEUP", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_LINEDOWN", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_PAGEUP", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_PAGEDOWN", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_THUMBTRACK", "wxScrollEvent", "Generated as the user drags the thumbtrack." },
+        { "wxEVT_SCROLL_THUMBRELEASE", "wxScrollEvent", "" },
+        { "wxEVT_SCROLL_CHANGED", "wxScrollEvent", "Generated on Windows only." },
+        { "wxEVT_HYPERLINK", "wxHyperlinkEvent", "If this event is not handled (or it's skipped; see wxEvent::Skip), then a call to wxLaunchDefaultBrowser is done with the hyperlink's URL." },
+        { "wxEVT_TEXT", "wxCommandEvent", "Generated when the text changes. Notice that this event will always be sent when the text controls contents changes - whether this is due to user input or comes from the program itself (for example, if SetValue() is called)" },
+        { "wxEVT_TEXT_ENTER", "wxCommandEvent", "Generated when enter is pressed in a text control (which must have wxTE_PROCESS_ENTER style for this event to be generated)." },
+        { "wxEVT_SEARCHCTRL_SEARCH_BTN", "wxCommandEvent", "Generated when the search button is clicked. Note that this does not initiate a search on its own, you need to perform the appropriate action in your event handler. You may use event.GetString() to retrieve the string to search for in the event handler code." },
+        { "wxEVT_SEARCHCTRL_CANCEL_BTN", "wxCommandEvent", "Generated when the cancel button is clicked." },
+        { "wxEVT_HTML_CELL_CLICKED", "wxHtmlCellEvent", "" },
+        { "wxEVT_HTML_CELL_HOVER", "wxHtmlCellEvent", "" },
+        { "wxEVT_HTML_LINK_CLICKED", "wxHtmlLinkEvent", "" },
+        { "wxEVT_WEBVIEW_NAVIGATING", "wxWebViewEvent", "Generated before trying to get a resource." },
+        { "wxEVT_WEBVIEW_NAVIGATED", "wxWebViewEvent", "Generated after it was confirmed that a resource would be requested." },
+        { "wxEVT_WEBVIEW_LOADED", "wxWebViewEvent", "Generated when the document is fully loaded and displayed." },
+        { "wxEVT_WEBVIEW_ERROR", "wxWebViewEvent", "Generated when a navigation error occurs." },
+        { "wxEVT_WEBVIEW_NEWWINDOW", "wxWebViewEvent", "Generated when a new window is created." },
+        { "wxEVT_WEBVIEW_TITLE_CHANGED", "wxWebViewEvent", "Generated when the page title changes." },
+        { "wxEVT_WEBVIEW_FULL_SCREEN_CHANGED", "wxWebViewEvent", "Generated when the page wants to enter or leave fullscreen." },
+        { "wxEVT_WEBVIEW_SCRIPT_MESSAGE_RECEIVED", "wxWebViewEvent", "" },
+        { "wxEVT_CALENDAR_DOUBLECLICKED", "wxCalendarEvent", "A day was double clicked in the calendar." },
+        { "wxEVT_CALENDAR_SEL_CHANGED", "wxCalendarEvent", "The selected date changed." },
+        { "wxEVT_CALENDAR_PAGE_CHANGED", "wxCalendarEvent", "The selected month (and/or year) changed." },
+        { "wxEVT_CALENDAR_DAY_CHANGED", "wxCalendarEvent", "The selected day changed." },
+        { "wxEVT_CALENDAR_MONTH_CHANGED", "wxCalendarEvent", "The selected month changed." },
+        { "wxEVT_CALENDAR_YEAR_CHANGED", "wxCalendarEvent", "The selected year changed." },
+        { "EVT_CALENDAR_WEEK_CLICKED", "wxCalendarEvent", "User clicked on the week day header (only generic)." },
+        { "wxEVT_CALENDAR_WEEK_CLICKED", "wxCalendarEvent", "User clicked on the week of the year number (only generic)." },
+        { "wxEVT_DIRCTRL_SELECTIONCHANGED", "wxCommandEvent", "Selected directory has changed. Notice that this event is generated even for the changes done by the program itself and not only those done by the user." },
+        { "wxEVT_DIRCTRL_FILEACTIVATED", "wxCommandEvent", "The user activated a file by double-clicking or pressing Enter." },
+        { "wxEVT_FILECTRL_FILEACTIVATED", "wxCommandEvent", "The user activated a file(by double-clicking or pressing Enter)." },
+        { "wxEVT_FILECTRL_SELECTIONCHANGED", "wxCommandEvent", "The user changed the current selection(by selecting or deselecting a file) ." },
+        { "wxEVT_FILECTRL_FOLDERCHANGED", "wxCommandEvent", "The current folder of the file control has been changed." },
+        { "wxEVT_FILECTRL_FILTERCHANGED", "wxCommandEvent", "The current file filter of the file control has been changed." },
+    };
+
+    constexpr Inherit s_inherits[] = {
+        { "Language Settings", 0, 0, 0, 0 },
+        { "XRC Settings", 0, 0, 0, 0 },
+        { "wxWindow", 0, 0, 0, 5 },
+        { "Window Events", 0, 0, 5, 0 },
+        { "wxWindow", 0, 0, 5, 4 },
+        { "Window Events", 0, 0, 9, 0 },
+        { "sizer_child", 0, 0, 9, 0 },
+        { "Language Settings", 0, 0, 9, 0 },
+        { "XRC Settings", 0, 0, 9, 0 },
+        { "wxWindow", 0, 0, 9, 5 },
+        { "Window Events", 0, 0, 14, 0 },
+        { "wxWindow", 0, 0, 14, 4 },
+        { "Window Events", 0, 0, 18, 0 },
+        { "sizer_child", 0, 0, 18, 0 },
+        { "wxWindow", 0, 0, 18, 0 },
+        { "Window Events", 0, 0, 18, 0 },
+        { "wxWindow", 0, 0, 18, 0 },
+        { "Window Events", 0, 0, 18, 0 },
+        { "sizer_child", 0, 0, 18, 0 },
+        { "Language Settings", 0, 0, 18, 0 },
+        { "XRC Settings", 0, 0, 18, 0 },
+        { "wxWindow", 0, 0, 18, 1 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "Language Settings", 0, 0, 19, 0 },
+        { "XRC Settings", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "sizer_child", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "Choice Validator", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "sizer_child", 0, 0, 19, 0 },
+        { "Choice Validator", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "sizer_child", 0, 0, 19, 0 },
+        { "Choice Validator", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "sizer_child", 0, 0, 19, 0 },
+        { "List Validator", 0, 0, 19, 0 },
+        { "wxWindow", 0, 0, 19, 0 },
+        { "Window Events", 0, 0, 19, 0 },
+        { "sizer_child", 0, 0, 19, 0 },
+        { "wxWindow", 0, 2, 19, 0 },
+        { "Window Events", 2, 0, 19, 0 },
+        { "sizer_child", 2, 0, 19, 0 },
+        { "List Validator", 2, 0, 19, 0 },
+        { "wxWindow", 2, 0, 19, 0 },
+        { "Window Events", 2, 0, 19, 0 },
+        { "sizer_child", 2, 0, 19, 0 },
+        { "Integer Validator", 2, 0, 19, 0 },
+        { "wxWindow", 2, 0, 19, 0 },
+        { "Window Events", 2, 0, 19, 0 },
+        { "sizer_child", 2, 0, 19, 0 },
+        { "wxWindow", 2, 0, 19, 0 },
+        { "sizer_child", 2, 0, 19, 0 },
+        { "Boolean Validator", 2, 0, 19, 0 },
+        { "wxWindow", 2, 0, 19, 0 },
+        { "Window Events", 2, 0, 19, 0 },
+        { "sizer_child", 2, 0, 19, 0 },
+        { "CheckBoxState Validator", 2, 0, 19, 0 },
+        { "wxWindow", 2, 0, 19, 0 },
+        { "Window Events", 2, 0, 19, 0 },
+        { "sizer_child", 2, 0, 19, 0 },
+        { "Boolean Validator", 2, 0, 19, 0 },
+        { "wxWindow", 2, 0, 19, 0 },
+        { "Window Events", 2, 0, 19, 0 },
+        { "sizer_child", 2, 0, 19, 0 },
+        { "Bitmaps", 2, 0, 19, 0 },
+        { "wxWindow", 2, 0, 19, 0 },
+        { "Window Events", 2, 0, 19, 0 },
+        { "String Validator", 2, 0, 19, 0 },
+        { "sizer_child", 2, 0, 19, 0 },
+        { "wxWindow", 2, 0, 19, 5 },
+        { "Window Events", 2, 0, 24, 0 },
+        { "sizer_child", 2, 0, 24, 0 },
+        { "Command Bitmaps", 2, 0, 24, 0 },
+        { "wxWindow", 2, 0, 24, 0 },
+        { "Window Events", 2, 0, 24, 0 },
+        { "sizer_child", 2, 0, 24, 0 },
+        { "Integer Validator", 2, 0, 24, 0 },
+        { "wxWindow", 2, 0, 24, 0 },
+        { "Window Events", 2, 0, 24, 0 },
+        { "sizer_child", 2, 0, 24, 0 },
+        { "wxWindow", 2, 0, 24, 0 },
+        { "Window Events", 2, 0, 24, 0 },
+        { "sizer_child", 2, 0, 24, 0 },
+        { "Integer Validator", 2, 0, 24, 0 },
+        { "wxWindow", 2, 0, 24, 0 },
+        { "Window Events", 2, 0, 24, 0 },
+        { "sizer_child", 2, 0, 24, 0 },
+        { "Bitmaps", 2, 0, 24, 0 },
+        { "wxWindow", 2, 0, 24, 0 },
+        { "Window Events", 2, 0, 24, 0 },
+        { "Boolean Validator", 2, 0, 24, 0 },
+        { "sizer_child", 2, 0, 24, 0 },
+        { "Bitmaps", 2, 0, 24, 0 },
+        { "wxWindow", 2, 0, 24, 0 },
+        { "Window Events", 2, 0, 24, 0 },
+        { "Boolean Validator", 2, 0, 24, 0 },
+        { "sizer_child", 2, 0, 24, 0 },
+        { "wxWindow", 2, 0, 24, 0 },
+        { "sizer_child", 2, 0, 24, 0 },
+        { "Window Events", 2, 0, 24, 0 },
+        { "wxWindow", 2, 1, 24, 0 },
+        { "sizer_child", 3, 0, 24, 0 },
+        { "wxWindow", 3, 0, 24, 0 },
+        { "Window Events", 3, 0, 24, 0 },
+        { "sizer_child", 3, 0, 24, 0 },
+        { "wxWindow", 3, 1, 24, 0 },
+        { "sizer_child", 4, 0, 24, 0 },
+        { "wxWindow", 4, 1, 24, 0 },
+        { "sizer_child", 5, 0, 24, 0 },
+        { "wxWindow", 5, 0, 24, 0 },
+        { "Window Events", 5, 0, 24, 0 },
+        { "sizer_child", 5, 0, 24, 0 },
+        { "wxWindow", 5, 0, 24, 0 },
+        { "Window Events", 5, 0, 24, 0 },
+        { "sizer_child", 5, 0, 24, 0 },
+        { "wxWindow", 5, 0, 24, 0 },
+        { "Window Events", 5, 0, 24, 0 },
+        { "sizer_child", 5, 0, 24, 0 },
+        { "wxWindow", 5, 0, 24, 0 },
+        { "Window Events", 5, 0, 24, 0 },
+        { "sizer_child", 5, 0, 24, 0 },
+        { "wxWindow", 5, 0, 24, 0 },
+        { "Window Events", 5, 0, 24, 0 },
+        { "sizer_child", 5, 0, 24, 0 },
+        { "wxWindow", 5, 0, 24, 0 },
+        { "Window Events", 5, 0, 24, 0 },
+        { "sizer_child", 5, 0, 24, 0 },
+        { "wxWindow", 5, 0, 24, 0 },
+        { "Window Events", 5, 0, 24, 0 },
+        { "sizer_child", 5, 0, 24, 0 },
+        { "wxWindow", 5, 0, 24, 0 },
+        { "Window Events", 5, 0, 24, 0 },
+        { "sizer_child", 5, 0, 24, 0 },
+        { "Window Events", 5, 0, 24, 0 },
+        { "wxWindow", 5, 1, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxTreeCtrlBase", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "sizer_child", 6, 0, 24, 0 },
+        { "Language Settings", 6, 0, 24, 0 },
+        { "XRC Settings", 6, 0, 24, 0 },
+        { "wxTopLevelWindow", 6, 0, 24, 0 },
+        { "Window Events", 6, 0, 24, 0 },
+        { "wxWindow", 6, 0, 24, 1 },
+        { "Language Settings", 6, 0, 25, 0 },
+        { "XRC Settings", 6, 0, 25, 0 },
+        { "wxTopLevelWindow", 6, 0, 25, 0 },
+        { "Window Events", 6, 0, 25, 0 },
+        { "wxWindow", 6, 0, 25, 1 },
+        { "Language Settings", 6, 0, 26, 0 },
+        { "XRC Settings", 6, 0, 26, 0 },
+        { "wxTopLevelWindow", 6, 0, 26, 0 },
+        { "Window Events", 6, 0, 26, 0 },
+        { "wxWindow", 6, 0, 26, 1 },
+        { "Language Settings", 6, 0, 27, 0 },
+        { "XRC Settings", 6, 0, 27, 0 },
+        { "wxTopLevelWindow", 6, 0, 27, 0 },
+        { "Window Events", 6, 0, 27, 0 },
+        { "wxWindow", 6, 0, 27, 1 },
+        { "Language Settings", 6, 0, 28, 0 },
+        { "XRC Settings", 6, 0, 28, 0 },
+        { "wxTopLevelWindow", 6, 0, 28, 0 },
+        { "Window Events", 6, 0, 28, 0 },
+        { "wxWindow", 6, 0, 28, 1 },
+        { "Language Settings", 6, 0, 29, 0 },
+        { "XRC Settings", 6, 0, 29, 0 },
+        { "wxTopLevelWindow", 6, 0, 29, 0 },
+        { "Window Events", 6, 0, 29, 0 },
+        { "wxWindow", 6, 0, 29, 1 },
+        { "Language Settings", 6, 0, 30, 0 },
+        { "XRC Settings", 6, 0, 30, 0 },
+        { "wxTopLevelWindow", 6, 0, 30, 0 },
+        { "Window Events", 6, 0, 30, 0 },
+        { "wxWindow", 6, 0, 30, 1 },
+        { "Language Settings", 6, 0, 31, 0 },
+        { "Language Settings", 6, 0, 31, 0 },
+        { "Language Settings", 6, 0, 31, 0 },
+        { "XRC Settings", 6, 0, 31, 0 },
+        { "wxWindow", 6, 0, 31, 1 },
+        { "Window Events", 6, 0, 32, 0 },
+        { "Dialog Window Settings", 6, 0, 32, 0 },
+        { "Language Settings", 6, 0, 32, 0 },
+        { "XRC Settings", 6, 0, 32, 0 },
+        { "wxTopLevelWindow", 6, 0, 32, 0 },
+        { "Window Events", 6, 0, 32, 0 },
+        { "Language Settings", 6, 0, 32, 0 },
+        { "XRC Settings", 6, 0, 32, 0 },
+        { "Dialog Window Settings", 6, 0, 32, 5 },
+        { "Language Settings", 6, 0, 37, 0 },
+        { "XRC Settings", 6, 0, 37, 0 },
+        { "wxTopLevelWindow", 6, 0, 37, 0 },
+        { "Window Events", 6, 0, 37, 0 },
+        { "Language Settings", 6, 0, 37, 0 },
+        { "XRC Settings", 6, 0, 37, 0 },
+        { "wxTopLevelWindow", 6, 0, 37, 0 },
+        { "wxWindow", 6, 0, 37, 3 },
+        { "Window Events", 6, 0, 40, 0 },
+        { "wxWindow", 6, 0, 40, 0 },
+        { "Window Events", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "wxMdiWindow", 6, 0, 40, 0 },
+        { "Window Events", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "wxMdiWindow", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "wxMdiWindow", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "wxMdiWindow", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "wxMdiWindow", 6, 0, 40, 0 },
+        { "Language Settings", 6, 0, 40, 0 },
+        { "wxMdiWindow", 6, 0, 40, 0 },
+        { "wxWindow", 6, 0, 40, 0 },
+        { "Window Events", 6, 0, 40, 0 },
+        { "sizer_child", 6, 0, 40, 0 },
+        { "wxWindow", 6, 0, 40, 0 },
+        { "Window Events", 6, 0, 40, 0 },
+        { "sizer_child", 6, 0, 40, 0 },
+        { "wxWindow", 6, 0, 40, 0 },
+        { "Window Events", 6, 0, 40, 0 },
+        { "sizer_child", 6, 0, 40, 0 },
+        { "Colour Validator", 6, 0, 40, 0 },
+        { "wxWindow", 6, 0, 40, 1 },
+        { "Window Events", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "DateTime Validator", 6, 0, 41, 0 },
+        { "wxWindow", 6, 0, 41, 0 },
+        { "Window Events", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "wxWindow", 6, 0, 41, 0 },
+        { "Window Events", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "C++", 6, 0, 41, 0 },
+        { "wxPython", 6, 0, 41, 0 },
+        { "wxRuby", 6, 0, 41, 0 },
+        { "kwxFortran", 6, 0, 41, 0 },
+        { "kwxGO", 6, 0, 41, 0 },
+        { "kwxLuaJIT", 6, 0, 41, 0 },
+        { "kwxJulia", 6, 0, 41, 0 },
+        { "kwxTypeScript", 6, 0, 41, 0 },
+        { "XRC", 6, 0, 41, 0 },
+        { "Folder C++ Overrides", 6, 0, 41, 0 },
+        { "Folder wxPython Overrides", 6, 0, 41, 0 },
+        { "Folder wxRuby Overrides", 6, 0, 41, 0 },
+        { "Folder XRC Overrides", 6, 0, 41, 0 },
+        { "sizeritem_settings", 6, 0, 41, 0 },
+        { "sizeritem_settings", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "Boolean Validator", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "Boolean Validator", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "flexgridsizerbase", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "flexgridsizerbase", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "sizer_dimension", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "wxWindow", 6, 0, 41, 0 },
+        { "Window Events", 6, 0, 41, 0 },
+        { "String Validator", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "Text Validator", 6, 0, 41, 0 },
+        { "wxWindow", 6, 0, 41, 0 },
+        { "Window Events", 6, 0, 41, 0 },
+        { "sizer_child", 6, 0, 41, 0 },
+        { "wxWindow", 6, 2, 41, 0 },
+        { "sizer_child", 8, 0, 41, 0 },
+        { "wxWindow", 8, 0, 41, 0 },
+        { "Window Events", 8, 0, 41, 0 },
+        { "sizer_child", 8, 0, 41, 0 },
+        { "wxWindow", 8, 0, 41, 2 },
+        { "Window Events", 8, 0, 43, 0 },
+        { "sizer_child", 8, 0, 43, 0 },
+        { "wxWindow", 8, 0, 43, 6 },
+        { "sizer_child", 8, 0, 49, 0 },
+        { "wxWindow", 8, 0, 49, 4 },
+        { "Window Events", 8, 0, 53, 0 },
+        { "sizer_child", 8, 0, 53, 0 },
+        { "wxWindow", 8, 0, 53, 2 },
+        { "Window Events", 8, 0, 55, 0 },
+        { "sizer_child", 8, 0, 55, 0 },
+        { "List Validator", 8, 0, 55, 0 },
+        { "wxWindow", 8, 0, 55, 0 },
+        { "Window Events", 8, 0, 55, 0 },
+        { "sizer_child", 8, 0, 55, 0 },
+        { "wxWindow", 8, 0, 55, 5 },
+        { "Window Events", 8, 0, 60, 0 },
+        { "sizer_child", 8, 0, 60, 0 },
+        { "wxWindow", 8, 0, 60, 9 },
+        { "sizer_child", 8, 0, 69, 0 },
+        { "Integer Validator", 8, 0, 69, 0 },
+        { "wxWindow", 8, 0, 69, 0 },
+        { "Window Events", 8, 0, 69, 0 },
+        { "sizer_child", 8, 0, 69, 0 },
+        { "Integer Validator", 8, 0, 69, 0 },
+        { "wxWindow", 8, 0, 69, 5 },
+        { "Window Events", 8, 0, 74, 0 },
+        { "sizer_child", 8, 0, 74, 0 },
+        { "Integer Validator", 8, 0, 74, 0 },
+        { "wxWindow", 8, 0, 74, 0 },
+        { "Window Events", 8, 0, 74, 0 },
+        { "sizer_child", 8, 0, 74, 0 },
+        { "wxWindow", 8, 0, 74, 0 },
+        { "Window Events", 8, 0, 74, 0 },
+        { "sizer_child", 8, 0, 74, 0 },
+        { "wxWindow", 8, 0, 74, 0 },
+        { "Window Events", 8, 0, 74, 0 },
+        { "sizer_child", 8, 0, 74, 0 },
+        { "wxWindow", 8, 0, 74, 0 },
+        { "Window Events", 8, 0, 74, 0 },
+        { "sizer_child", 8, 0, 74, 0 },
+        { "wxWindow", 8, 2, 74, 0 },
+        { "sizer_child", 10, 0, 74, 0 },
+        { "wxWindow", 10, 0, 74, 3 },
+        { "Window Events", 10, 0, 77, 0 },
+        { "sizer_child", 10, 0, 77, 0 },
+        { "wxWindow", 10, 0, 77, 3 },
+        { "Window Events", 10, 0, 80, 0 },
+        { "sizer_child", 10, 0, 80, 0 },
+        { "wxWindow", 10, 0, 80, 3 },
+        { "Window Events", 10, 0, 83, 0 },
+        { "sizer_child", 10, 0, 83, 0 },
+    };
+
+    constexpr Override s_overrides[] = {
+        { "proportion", "1" },
+        { "flags", "wxEXPAND" },
+        { "window_style", "wxTAB_TRAVERSAL" },
+        { "window_style", "wxHSCROLL | wxVSCROLL" },
+        { "window_style", "wxHSCROLL | wxVSCROLL" },
+        { "window_style", "wxTAB_TRAVERSAL" },
+        { "window_style", "wxVSCROLL|wxHSCROLL|wxWANTS_CHARS" },
+        { "minimum_size", "\n                400,250" },
+        { "proportion", "1" },
+        { "flags", "wxEXPAND" },
+    };
+
+    constexpr std::string_view s_hidden[] = {
+        "foreground_colour",
+        "background_colour",
+        "window_style",
+        "window_extra_style",
+        "platforms",
+        "foreground_colour",
+        "background_colour",
+        "window_style",
+        "window_extra_style",
+        "foreground_colour",
+        "background_colour",
+        "window_style",
+        "window_extra_style",
+        "platforms",
+        "foreground_colour",
+        "background_colour",
+        "window_style",
+        "window_extra_style",
+        "platforms",
+        "variant",
+        "foreground_colour",
+        "background_colour",
+        "font",
+        "window_name",
+        "platforms",
+        "platforms",
+        "platforms",
+        "platforms",
+        "platforms",
+        "platforms",
+        "platforms",
+        "platforms",
+        "pos",
+        "size",
+        "foreground_colour",
+        "maximum_size",
+        "minimum_size",
+        "minimum_size",
+        "maximum_size",
+        "size",
+        "variant",
+        "foreground_colour",
+        "font",
+        "variant",
+        "window_style",
+        "window_extra_style",
+        "disabled",
+        "foreground_colour",
+        "font",
+        "window_style",
+        "window_extra_style",
+        "disabled",
+        "background_colour",
+        "subclass",
+        "subclass_header",
+        "variant",
+        "window_extra_style",
+        "disabled",
+        "foreground_colour",
+        "font",
+        "variant",
+        "tooltip",
+        "window_style",
+        "window_extra_style",
+        "disabled",
+        "foreground_colour",
+        "background_colour",
+        "context_help",
+        "font",
+        "variant",
+        "disabled",
+        "foreground_colour",
+        "background_colour",
+        "font",
+        "variant",
+        "foreground_colour",
+        "font",
+        "variant",
+        "foreground_colour",
+        "font",
+        "variant",
+        "foreground_colour",
+        "font",
+    };
+}  // namespace
+
+const std::span<const File> node_tables::files { s_files, 13 };
+const std::span<const Generator> node_tables::generators { s_generators, 214 };
+const std::span<const Category> node_tables::categories { s_categories, 230 };
+const std::span<const Property> node_tables::properties { s_properties, 1073 };
+const std::span<const Option> node_tables::options { s_options, 1332 };
+const std::span<const Event> node_tables::events { s_events, 526 };
+const std::span<const Inherit> node_tables::inherits { s_inherits, 396 };
+const std::span<const Override> node_tables::overrides { s_overrides, 10 };
+const std::span<const std::string_view> node_tables::hidden { s_hidden, 83 };
+
+// cppcheck-suppress-end *
+// NOLINTEND
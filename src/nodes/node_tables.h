@@ -0,0 +1,120 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Node declaration tables generated from the XML files in src/xml/
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+// node_tables.cpp is generated by running:
+//
+//     build_resources --node-tables src/nodes/node_tables.cpp --srcdir src/xml
+//
+// CMake does this automatically at configure time whenever one of the XML files is newer than
+// node_tables.cpp (see cmake/build_node_tables.cmake).
+//
+// Every table is constant-initialized, so NodeCreator::Initialize() can create all of the
+// NodeDeclaration and PropDeclaration objects without decompressing or parsing any XML.
+//
+// All of the first_* and *_count members are indices into one of the spans below. Child
+// categories, properties, options, events, inherits, overrides and hidden properties that
+// belong to the same parent are always stored contiguously.
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace node_tables
+{
+    inline constexpr std::uint16_t no_index = UINT16_MAX;
+
+    struct Option
+    {
+        std::string_view name;
+        std::string_view help;
+    };
+
+    struct Property
+    {
+        std::string_view name;  // without the prop_ prefix
+        std::string_view type;  // without the type_ prefix
+        std::string_view def_value;
+        std::string_view help;
+        bool hide;
+        std::uint16_t first_option;
+        std::uint16_t option_count;
+    };
+
+    struct Event
+    {
+        std::string_view name;
+        std::string_view event_class;
+        std::string_view help;
+    };
+
+    // Either a <category> or the <gen> element itself (which has an empty name)
+    struct Category
+    {
+        std::string_view name;
+
+        // If the XML specified a base_name, this is the root category of that interface, and the
+        // properties come from that category instead of this one. Events always come from this
+        // category.
+        std::uint16_t base_category;
+
+        std::uint16_t first_category;
+        std::uint16_t category_count;
+        std::uint16_t first_property;
+        std::uint16_t property_count;
+        std::uint16_t first_event;
+        std::uint16_t event_count;
+    };
+
+    // A <property> element within an <inherits> element
+    struct Override
+    {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    struct Inherit
+    {
+        std::string_view class_name;
+        std::uint16_t first_override;
+        std::uint16_t override_count;
+        std::uint16_t first_hide;
+        std::uint16_t hide_count;
+    };
+
+    struct Generator
+    {
+        std::string_view class_name;  // without the gen_ prefix
+        std::string_view type;
+        std::string_view image;
+        std::string_view flags;
+        bool internal;  // enable="internal"
+        std::uint16_t category;
+        std::uint16_t first_inherit;
+        std::uint16_t inherit_count;
+    };
+
+    // One of the XML files. Interfaces come first since the other files inherit from them.
+    struct File
+    {
+        std::string_view name;
+        bool is_interface;
+        std::uint16_t first_generator;
+        std::uint16_t generator_count;
+    };
+
+    extern const std::span<const File> files;
+    extern const std::span<const Generator> generators;
+    extern const std::span<const Category> categories;
+    extern const std::span<const Property> properties;
+    extern const std::span<const Option> options;
+    extern const std::span<const Event> events;
+    extern const std::span<const Inherit> inherits;
+    extern const std::span<const Override> overrides;
+    extern const std::span<const std::string_view> hidden;  // <hide> names within <inherits>
+}  // namespace node_tables
@@ -11,6 +11,11 @@
 
 #include "gen_enums.h"  // Enumerations for generators
 
+namespace wxue
+{
+    class string;
+}
+
 using namespace GenEnum;
 
 // class PropDeclaration : public PropChildDeclaration
@@ -49,6 +54,14 @@ public:
     {
         return m_def_value;
     }
+    // The PropValuePool copy of the default value, or nullptr before NodeCreator::Initialize()
+    // has filled in the pool.
+    [[nodiscard]] auto getPooledDefault() const noexcept -> const wxue::string*
+    {
+        return m_pooled_default;
+    }
+    void SetPooledDefault(const wxue::string* pooled) { m_pooled_default = pooled; }
+
     [[nodiscard]] auto getDescription() const noexcept -> const std::string& { return m_help; }
 
     [[nodiscard]] auto get_name() const noexcept -> PropName { return m_name_enum; }
@@ -71,6 +84,7 @@ public:
 private:
     std::string m_def_value;
     std::string m_help;
+    const wxue::string* m_pooled_default { nullptr };
 
     GenEnum::PropType m_prop_type;
     GenEnum::PropName m_name_enum;  // enumeration value for the name
@@ -0,0 +1,337 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Index of the variable names and property grid labels in use
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include <charconv>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include <frozen/set.h>
+
+#include "unique_names.h"
+
+#include "node.h"  // Node class
+
+#include "wxue_namespace/wxue.h"  // wxue helpers for character classification
+
+namespace
+{
+    // Names used by the generated code
+    constexpr auto reserved_names = frozen::make_set<std::string_view>({
+        "bitmaps",       // used for wxBitmapBundle
+        "_svg_string_",  // used for python SVG image processing
+
+        // Python variables
+        "_OK",
+        "_Yes",
+        "_Save",
+        "_Cancel",
+        "_No",
+        "_Close",
+        "_Help",
+        "_ContextHelp",
+
+        // Ruby variables
+        "_ok_btn",
+        "_yes_btn",
+        "_save_btn",
+        "_cancel_btn",
+        "_no_btn",
+        "_close_btn",
+        "_help_btn",
+        "_context_help_btn",
+
+        "bundle_list",  // used for wxBitmapBundle, primarily for books
+
+        // These are used when generating Python code for wxBitmapBundle
+        "bundle_1",
+        "bundle_2",
+        "bundle_3",
+        "bundle_4",
+        "bundle_5",
+        "bundle_6",
+        "bundle_7",
+        "bundle_8",
+        "bundle_9",
+
+        "idx",   // used for wxListItem
+        "info",  // used for wxListItem
+    });
+
+    // Cached indexes, keyed by scope. Only valid while s_cache_generation matches
+    // NameIndex::s_generation.
+    std::map<std::pair<Node*, PropName>, std::unique_ptr<NameIndex>> s_indexes;
+    std::uint64_t s_cache_generation { 0 };
+
+    // Splits name into the part before any trailing digits (without a trailing underscore)
+    // and the value of those digits. suffix is -1 if there are no trailing digits.
+    auto SplitSuffix(std::string_view name, int& suffix) -> std::string_view
+    {
+        size_t digits = name.size();
+        while (digits > 0 && wxue::is_digit(name[digits - 1]))
+        {
+            --digits;
+        }
+        suffix = -1;
+        if (digits < name.size())
+        {
+            const auto* last = name.data() + name.size();
+            if (std::from_chars(name.data() + digits, last, suffix).ptr != last)
+            {
+                suffix = -1;
+            }
+        }
+        auto base = name.substr(0, digits);
+        if (!base.empty() && base.back() == '_')
+        {
+            base.remove_suffix(1);
+        }
+        return base;
+    }
+}  // namespace
+
+auto NameIndex::Get(Node* node, PropName prop_name) -> NameIndex*
+{
+    Node* scope = nullptr;
+    if (prop_name == prop_label)
+    {
+        scope = node->get_Parent();
+        if (scope && scope->is_Gen(gen_propGridPage))
+        {
+            scope = scope->get_Parent();
+        }
+    }
+    else if (!node->is_Form())
+    {
+        prop_name = prop_var_name;
+        scope = node->get_Form();
+    }
+    if (!scope)
+    {
+        return nullptr;
+    }
+
+    if (const auto generation = s_generation.load(std::memory_order_relaxed);
+        generation != s_cache_generation)
+    {
+        s_indexes.clear();
+        s_cache_generation = generation;
+    }
+
+    auto& index = s_indexes[{ scope, prop_name }];
+    if (!index)
+    {
+        index = std::make_unique<NameIndex>(scope, prop_name);
+    }
+    return index.get();
+}
+
+NameIndex::NameIndex(Node* scope, PropName prop_name) : m_scope(scope), m_prop_name(prop_name)
+{
+    Collect(scope);
+}
+
+auto NameIndex::is_Indexed(const Node* node) const -> bool
+{
+    if (node->is_Form() || node->is_Gen(gen_wxPropertyGrid) ||
+        node->is_Gen(gen_wxPropertyGridManager))
+    {
+        return false;
+    }
+    for (const Node* parent = node->get_Parent(); parent; parent = parent->get_Parent())
+    {
+        if (parent == m_scope)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void NameIndex::Collect(const Node* node)
+{
+    if (!node->is_Form() && !node->is_Gen(gen_wxPropertyGrid) &&
+        !node->is_Gen(gen_wxPropertyGridManager))
+    {
+        if (m_prop_name == prop_var_name)
+        {
+            for (const auto prop_name: var_name_props)
+            {
+                Add(node->as_string(prop_name));
+            }
+        }
+        else
+        {
+            Add(node->as_string(m_prop_name));
+        }
+    }
+
+    for (const auto& child: node->get_ChildNodePtrs())
+    {
+        Collect(child.get());
+    }
+}
+
+auto NameIndex::get_Count(std::string_view name) const -> size_t
+{
+    if (auto iter = m_counts.find(name); iter != m_counts.end())
+    {
+        return iter->second;
+    }
+    return 0;
+}
+
+void NameIndex::Add(std::string_view name)
+{
+    if (!name.empty())
+    {
+        ++m_counts[std::string(name)];
+    }
+}
+
+void NameIndex::Remove(std::string_view name)
+{
+    auto iter = m_counts.find(name);
+    if (iter == m_counts.end())
+    {
+        return;
+    }
+    if (--iter->second > 0)
+    {
+        return;
+    }
+    m_counts.erase(iter);
+
+    // The name is available again, so the next search for its base name has to start here
+    int suffix = -1;
+    const auto base = SplitSuffix(name, suffix);
+    if (suffix >= 2)
+    {
+        if (auto next = m_next_suffix.find(base);
+            next != m_next_suffix.end() && suffix < next->second)
+        {
+            next->second = suffix;
+        }
+    }
+}
+
+auto NameIndex::is_Used(std::string_view name, Node* node, PropName prop_name) const -> bool
+{
+    if (name.empty())
+    {
+        return false;
+    }
+    if (m_prop_name == prop_var_name && reserved_names.contains(name))
+    {
+        return true;
+    }
+
+    size_t count = get_Count(name);
+    const bool indexed = is_Indexed(node);
+    if (m_prop_name == prop_var_name)
+    {
+        for (const auto var_prop: var_name_props)
+        {
+            if (node->as_string(var_prop) != name)
+            {
+                continue;
+            }
+            if (var_prop == prop_name)
+            {
+                // The node's own name never conflicts with itself
+                count -= indexed ? 1 : 0;
+            }
+            else
+            {
+                // A variable name can't be the same as one of the node's other variable names
+                count += indexed ? 0 : 1;
+            }
+        }
+    }
+    else if (indexed && node->as_string(m_prop_name) == name)
+    {
+        --count;
+    }
+    return count > 0;
+}
+
+auto NameIndex::MakeUnique(std::string_view name, Node* node, PropName prop_name, bool try_base)
+    -> std::string
+{
+    if (!is_Used(name, node, prop_name))
+    {
+        return std::string(name);
+    }
+
+    int suffix = -1;
+    const std::string base(SplitSuffix(name, suffix));
+    if (base.empty())
+    {
+        return std::string(name);
+    }
+    if (try_base && !is_Used(base, node, prop_name))
+    {
+        return base;
+    }
+
+    int& next = m_next_suffix.try_emplace(base, 2).first->second;
+
+    // Every suffix below next is used by some node, but if that node is this one, its current
+    // name is still the best choice.
+    const auto& current = node->as_string(prop_name);
+    if (int current_suffix = -1; SplitSuffix(current, current_suffix) == base &&
+                                 current_suffix >= 2 && current_suffix < next &&
+                                 current == base + std::to_string(current_suffix) &&
+                                 !is_Used(current, node, prop_name))
+    {
+        return current;
+    }
+
+    std::string candidate;
+    for (int cur_suffix = next;; ++cur_suffix)
+    {
+        candidate = base + std::to_string(cur_suffix);
+        if (!is_Used(candidate, node, prop_name))
+        {
+            break;
+        }
+        if (cur_suffix == next && get_Count(candidate) > 0)
+        {
+            ++next;
+        }
+    }
+    return candidate;
+}
+
+void NameIndex::Rename(Node* node, PropName prop_name, std::string_view new_name)
+{
+    auto* prop = node->get_PropPtr(prop_name);
+    if (!prop)
+    {
+        return;
+    }
+
+    // Renaming a node in this index can't change any other index, so if the cache was current
+    // before the property was changed, it still is.
+    const bool is_current = (s_cache_generation == s_generation.load(std::memory_order_relaxed));
+
+    const bool indexed = is_Indexed(node);
+    if (indexed)
+    {
+        Remove(std::string(prop->as_string()));
+    }
+    prop->set_value(new_name);
+    if (indexed)
+    {
+        Add(new_name);
+    }
+
+    if (is_current)
+    {
+        s_cache_generation = s_generation.load(std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Index of the variable names and property grid labels in use
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Every name check -- creating or pasting a widget, importing a project, or fixing duplicates
+// after a load -- goes through NameIndex. An index counts how many times each name is used in
+// one scope: the variable names (var_name_props) of every node in a form, or the prop_label of
+// every item in a wxPropertyGrid. Lookups are a single hash probe, and the next free numeric
+// suffix for a name is remembered, so fixing the names of a large pasted subtree is linear
+// rather than quadratic.
+//
+// Indexes are cached until anything outside of NameIndex::Rename() adds or removes a node or
+// changes one of the indexed properties. Node and NodeProperty call Invalidate() when that
+// happens, which may be on a worker thread while a project is loading. Everything else must
+// only be called from the main thread.
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "gen_enums.h"  // Enumerations for generators
+#include "hash_map.h"   // Find std::string_view key in std::unordered_map
+
+using namespace GenEnum;
+
+class Node;
+
+class NameIndex
+{
+public:
+    // Variable names that must be unique among all the nodes of a form
+    static constexpr std::array<PropName, 4> var_name_props = {
+        prop_var_name,
+        prop_checkbox_var_name,
+        prop_radiobtn_var_name,
+        prop_validator_variable,
+    };
+
+    [[nodiscard]] static auto is_IndexedProp(PropName prop_name) noexcept -> bool
+    {
+        return prop_name == prop_var_name || prop_name == prop_checkbox_var_name ||
+               prop_name == prop_radiobtn_var_name || prop_name == prop_validator_variable ||
+               prop_name == prop_label;
+    }
+
+    // Discards every cached index
+    static void Invalidate() noexcept { s_generation.fetch_add(1, std::memory_order_relaxed); }
+
+    // Returns the index node should be checked against for prop_name (either prop_var_name or
+    // prop_label), or nullptr if node isn't in a form (or for prop_label, in a property grid).
+    [[nodiscard]] static auto Get(Node* node, PropName prop_name) -> NameIndex*;
+
+    // Returns true if name is used by any node other than node, by node itself in a different
+    // variable name property, or is reserved for use by generated code.
+    [[nodiscard]] auto is_Used(std::string_view name, Node* node, PropName prop_name) const
+        -> bool;
+
+    // Returns name if it isn't used. Otherwise any trailing digits (and then a trailing
+    // underscore) are removed and the result is returned with the first unused suffix starting
+    // with 2. If try_base is true, the name without any suffix is tried first.
+    [[nodiscard]] auto MakeUnique(std::string_view name, Node* node, PropName prop_name,
+                                  bool try_base = false) -> std::string;
+
+    // Sets the property to new_name and updates the index -- this does not invalidate any
+    // cached index.
+    void Rename(Node* node, PropName prop_name, std::string_view new_name);
+
+    NameIndex(Node* scope, PropName prop_name);
+
+private:
+    [[nodiscard]] auto is_Indexed(const Node* node) const -> bool;
+    [[nodiscard]] auto get_Count(std::string_view name) const -> size_t;
+
+    void Collect(const Node* node);
+    void Add(std::string_view name);
+    void Remove(std::string_view name);
+
+    Node* m_scope;
+    PropName m_prop_name;
+
+    std::unordered_map<std::string, size_t, str_view_hash, std::equal_to<>> m_counts;
+
+    // For each base name, every suffix from 2 up to (but not including) this value is in use.
+    std::unordered_map<std::string, int, str_view_hash, std::equal_to<>> m_next_suffix;
+
+    static inline std::atomic<std::uint64_t> s_generation { 0 };
+};
@@ -130,55 +130,50 @@ BasePanel::BasePanel(wxWindow* parent, MainFrame* frame, GenLang panel_type) : w
     Bind(wxEVT_FIND, &BasePanel::OnFind, this);
     Bind(wxEVT_FIND_NEXT, &BasePanel::OnFind, this);
 
-    Bind(EVT_EventHandlerChanged,
-         [this](wxEvent&)
-         {
-             GenerateBaseClass();
-         });
+    // These events only affect the code of the form containing the event's node
+    Bind(EVT_EventHandlerChanged, &BasePanel::OnCodeChangingEvent, this);
+    Bind(EVT_NodeCreated, &BasePanel::OnCodeChangingEvent, this);
+    Bind(EVT_NodePropChange, &BasePanel::OnCodeChangingEvent, this);
+    Bind(EVT_PositionChanged, &BasePanel::OnCodeChangingEvent, this);
+
+    // These events can change more than one form, or leave dangling form pointers in the cache
     Bind(EVT_GridBagAction,
          [this](wxEvent&)
          {
-             GenerateBaseClass();
-         });
-    Bind(EVT_NodeCreated,
-         [this](wxEvent&)
-         {
+             InvalidateCodeCache();
              GenerateBaseClass();
          });
     Bind(EVT_NodeDeleted,
          [this](wxEvent&)
          {
-             GenerateBaseClass();
-         });
-    Bind(EVT_NodePropChange,
-         [this](wxEvent&)
-         {
+             InvalidateCodeCache();
              GenerateBaseClass();
          });
     Bind(EVT_ParentChanged,
          [this](wxEvent&)
          {
-             GenerateBaseClass();
-         });
-    Bind(EVT_PositionChanged,
-         [this](wxEvent&)
-         {
+             InvalidateCodeCache();
              GenerateBaseClass();
          });
     Bind(EVT_ProjectUpdated,
          [this](wxEvent&)
          {
+             InvalidateCodeCache();
              GenerateBaseClass();
          });
     Bind(EVT_MultiPropChange,
          [this](wxEvent&)
          {
+             InvalidateCodeCache();
              GenerateBaseClass();
          });
 
     Bind(EVT_NodeSelected, &BasePanel::OnNodeSelected, this);
 
     frame->AddCustomEventHandler(GetEventHandler());
+
+    // Regenerating the code on every keystroke in the property grid is too slow
+    frame->DeferPropChangeEvents(GetEventHandler());
 }
 
 BasePanel::~BasePanel()
@@ -308,29 +303,47 @@ void BasePanel::GenerateBaseClass()
     const wxWindowUpdateLocker freeze(this);
 
     PANEL_PAGE panel_page = PANEL_PAGE::SOURCE_PANEL;
+    CodeDisplay* display = m_source_panel;
     if (auto* page = m_notebook->GetCurrentPage(); page)
     {
         if (page == m_hdr_info_panel)
         {
             panel_page = PANEL_PAGE::HDR_INFO_PANEL;
+            display = m_hdr_info_panel;
         }
         else if (page == m_derived_src_panel)
         {
             panel_page = PANEL_PAGE::DERIVED_SRC_PANEL;
+            display = m_derived_src_panel;
         }
         else if (page == m_derived_hdr_panel)
         {
             panel_page = PANEL_PAGE::DERIVED_HDR_PANEL;
+            display = m_derived_hdr_panel;
         }
     }
 
+    // Any event that changes the code of this form will have already removed it from the cache
+    const auto cache_key = std::make_pair(m_cur_form, panel_page);
+    if (auto iter = m_code_cache.find(cache_key); iter != m_code_cache.end())
+    {
+        display->ShowCode(iter->second);
+        if (panel_page == PANEL_PAGE::SOURCE_PANEL || panel_page == PANEL_PAGE::DERIVED_SRC_PANEL)
+        {
+            display->OnNodeSelected(wxGetFrame().getSelectedNode());
+        }
+        return;
+    }
+
     // All languages except C++ derived panels use GenResults for unified code generation
     // C++ base class panels (SOURCE_PANEL, HDR_INFO_PANEL) also use GenResults
     if (m_panel_type != GenLang::cplusplus || panel_page == PANEL_PAGE::SOURCE_PANEL ||
         panel_page == PANEL_PAGE::HDR_INFO_PANEL)
     {
-        m_source_panel->Clear();
-        m_hdr_info_panel->Clear();
+        // ResetBuffer() rather than Clear() so that only the lines that changed get replaced in
+        // scintilla.
+        m_source_panel->ResetBuffer();
+        m_hdr_info_panel->ResetBuffer();
 
         GenResults results;
         if (results.SetDisplayTarget(m_cur_form, m_panel_type, m_source_panel, m_hdr_info_panel,
@@ -350,6 +363,7 @@ void BasePanel::GenerateBaseClass()
             {
                 m_hdr_info_panel->CodeGenerationComplete();
             }
+            m_code_cache[cache_key] = display->GetDisplayedCode();
         }
         return;
     }
@@ -359,8 +373,8 @@ void BasePanel::GenerateBaseClass()
     ASSERT(panel_page == PANEL_PAGE::DERIVED_SRC_PANEL ||
            panel_page == PANEL_PAGE::DERIVED_HDR_PANEL);
 
-    m_derived_src_panel->Clear();
-    m_derived_hdr_panel->Clear();
+    m_derived_src_panel->ResetBuffer();
+    m_derived_hdr_panel->ResetBuffer();
 
     CppCodeGenerator code_generator(m_cur_form);
     code_generator.SetSrcWriteCode(m_derived_src_panel);
@@ -376,6 +390,32 @@ void BasePanel::GenerateBaseClass()
     {
         m_derived_hdr_panel->CodeGenerationComplete();
     }
+    m_code_cache[cache_key] = display->GetDisplayedCode();
+}
+
+void BasePanel::InvalidateForm(Node* node)
+{
+    Node* form = node ? node->get_Form() : nullptr;
+
+    // Project and folder properties, images and data lists can all change the code of other
+    // forms.
+    if (!form || form->is_Gen(gen_Images) || form->is_Gen(gen_Data))
+    {
+        InvalidateCodeCache();
+        return;
+    }
+
+    std::erase_if(m_code_cache,
+                  [form](const auto& iter)
+                  {
+                      return iter.first.first == form;
+                  });
+}
+
+void BasePanel::OnCodeChangingEvent(CustomEvent& event)
+{
+    InvalidateForm(event.getNode());
+    GenerateBaseClass();
 }
 
 void BasePanel::OnNodeSelected(CustomEvent& event)
@@ -8,6 +8,9 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
 
 #include <wx/panel.h>  // Base header for wxPanel
 
@@ -51,7 +54,17 @@ public:
     void SetColor(int style, const wxColour& color);
     void SetCodeFont(const wxFont& font);
 
+    // Call this when something other than a node change (e.g., a preference) alters the
+    // generated code.
+    void InvalidateCodeCache() { m_code_cache.clear(); }
+
 protected:
+    // Removes the cached code of the form containing node. If that could affect the code of
+    // other forms, the entire cache is cleared.
+    void InvalidateForm(Node* node);
+
+    void OnCodeChangingEvent(CustomEvent& event);
+
 private:
     CodeDisplay* m_source_panel;
     CodeDisplay* m_hdr_info_panel;  // Header, inherit, info panel
@@ -60,5 +73,9 @@ private:
     wxAuiNotebook* m_notebook;
     Node* m_cur_form { nullptr };
 
+    // Code last displayed for each form and page. Switching between forms that haven't
+    // changed only requires copying the cached code rather than regenerating it.
+    std::map<std::pair<Node*, PANEL_PAGE>, std::string> m_code_cache;
+
     GenLang m_panel_type;
 };
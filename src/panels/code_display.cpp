@@ -6,6 +6,8 @@
 /////////////////////////////////////////////////////////////////////////////
 // CR: [07-01-2026]
 
+#include <ranges>
+
 #include <wx/aui/auibook.h>  // wxaui: wx advanced user interface - notebook
 #include <wx/fdrepdlg.h>     // wxFindReplaceDialog class
 #include <wx/msgdlg.h>       // common header and base class for wxMessageDialog
@@ -26,6 +28,8 @@
 #include "utils.h"             // Miscellaneous utility functions
 #include "wxue_view_vector.h"  // wxue::ViewVector
 
+#include "../tools/compare/diff.h"  // Diff -- Line-based diff algorithm
+
 #ifndef SCI_SETKEYWORDS
     #define SCI_SETKEYWORDS 4005
 #endif
@@ -41,6 +45,31 @@ extern const char* g_xrc_keywords;
 
 const int node_marker = 1;
 
+namespace
+{
+    // Unlike ViewVector, each line includes its trailing '\n' so that every line points into
+    // text and the offset of a line is simply its distance from the start of text.
+    auto SplitDisplayLines(std::string_view text) -> std::vector<std::string_view>
+    {
+        std::vector<std::string_view> lines;
+        for (size_t start = 0; start < text.size();)
+        {
+            auto end = text.find('\n', start);
+            end = (end == std::string_view::npos) ? text.size() : end + 1;
+            lines.emplace_back(text.substr(start, end - start));
+            start = end;
+        }
+        return lines;
+    }
+
+    auto LineOffset(const std::vector<std::string_view>& lines, std::string_view text, size_t line)
+        -> size_t
+    {
+        return (line < lines.size()) ? static_cast<size_t>(lines[line].data() - text.data()) :
+                                       text.size();
+    }
+}  // namespace
+
 CodeDisplay::CodeDisplay(wxWindow* parent, GenLang panel_type) :
     CodeDisplayBase(parent),
     m_panel_type(panel_type)
@@ -106,10 +135,18 @@ void CodeDisplay::Clear()
     m_view.clear();
     m_view.GetBuffer().clear();
 
+    m_displayed.clear();
+
     m_scintilla->SetReadOnly(false);
     m_scintilla->ClearAll();
 }
 
+void CodeDisplay::ResetBuffer()
+{
+    m_view.clear();
+    m_view.GetBuffer().clear();
+}
+
 void CodeDisplay::doWrite(std::string_view code)
 {
     m_view.GetBuffer() += code;
@@ -117,7 +154,17 @@ void CodeDisplay::doWrite(std::string_view code)
 
 void CodeDisplay::CodeGenerationComplete()
 {
-    m_scintilla->AddTextRaw(m_view.GetBuffer().data(), (to_int) m_view.GetBuffer().size());
+    if (m_displayed.empty() || m_scintilla->GetLength() != (to_int) m_displayed.size())
+    {
+        m_scintilla->SetReadOnly(false);
+        m_scintilla->ClearAll();
+        m_scintilla->AddTextRaw(m_view.GetBuffer().data(), (to_int) m_view.GetBuffer().size());
+    }
+    else if (m_displayed != m_view.GetBuffer())
+    {
+        PatchChangedLines();
+    }
+    m_displayed = m_view.GetBuffer();
     m_scintilla->SetReadOnly(true);
 
     // Find doesn't work correctly unless there's a selection to start the search from.
@@ -126,6 +173,41 @@ void CodeDisplay::CodeGenerationComplete()
     m_view.ParseBuffer();
 }
 
+void CodeDisplay::ShowCode(std::string_view code)
+{
+    ResetBuffer();
+    m_view.GetBuffer().assign(code);
+    CodeGenerationComplete();
+}
+
+void CodeDisplay::PatchChangedLines()
+{
+    const std::string_view new_code = m_view.GetBuffer();
+    const auto old_lines = SplitDisplayLines(m_displayed);
+    const auto new_lines = SplitDisplayLines(new_code);
+    const auto ranges = Diff::FindChangedRanges(old_lines, new_lines);
+
+    m_scintilla->SetReadOnly(false);
+
+    // Working from the bottom up means the offsets of the ranges that haven't been patched yet
+    // still match the text in scintilla.
+    for (const auto& range: std::views::reverse(ranges))
+    {
+        const auto old_start = LineOffset(old_lines, m_displayed, range.start_original);
+        const auto old_end =
+            LineOffset(old_lines, m_displayed, range.start_original + range.count_original);
+        const auto new_start = LineOffset(new_lines, new_code, range.start_modified);
+        const auto new_end =
+            LineOffset(new_lines, new_code, range.start_modified + range.count_modified);
+
+        m_scintilla->SetTargetRange((to_int) old_start, (to_int) old_end);
+        m_scintilla->ReplaceTargetRaw(new_code.data() + new_start, (to_int) (new_end - new_start));
+    }
+
+    // The markers are reset by OnNodeSelected(), and may now be on the wrong line
+    m_scintilla->MarkerDeleteAll(node_marker);
+}
+
 void CodeDisplay::OnNodeSelected(Node* node)
 {
     if (node->is_Gen(gen_embedded_image))
@@ -178,10 +260,9 @@ void CodeDisplay::OnNodeSelected(Node* node)
         }
         else
         {
-            const NodeMapEvents map_events = node->get_MapEvents();
-            for (auto& iter: map_events)
+            for (const auto& iter: node->get_Events())
             {
-                const std::string value = iter.second.get_value();
+                const std::string value = iter.get_value();
                 if (value.empty())
                 {
                     continue;
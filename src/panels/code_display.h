@@ -35,10 +35,21 @@ public:
     // Clears scintilla and internal buffer, removes read-only flag in scintilla
     void Clear() override;
 
+    // Clears the internal buffer but leaves scintilla unchanged so that
+    // CodeGenerationComplete() can patch just the lines that changed.
+    void ResetBuffer();
+
     // Transfers code from buffer to scintilla, sets scintilla markers to current node, marks
-    // scintilla as read-only
+    // scintilla as read-only. If scintilla is already displaying code, only the lines that
+    // differ from the new code are replaced.
     void CodeGenerationComplete();
 
+    // Replaces the buffer with code that was previously generated, and displays it
+    void ShowCode(std::string_view code);
+
+    // Returns the code most recently transferred to scintilla
+    [[nodiscard]] auto GetDisplayedCode() const -> const std::string& { return m_displayed; }
+
     void OnNodeSelected(Node* node);
 
     wxStyledTextCtrl* GetTextCtrl() { return m_scintilla; };
@@ -53,6 +64,13 @@ protected:
     void doWrite(std::string_view code) override;
 
 private:
+    // Replaces only the lines of scintilla that differ between m_displayed and the buffer
+    void PatchChangedLines();
+
     wxue::ViewVector m_view;
+
+    // Exact copy of the text in scintilla, used to find the lines that need to be patched
+    std::string m_displayed;
+
     GenLang m_panel_type;
 };
@@ -117,6 +117,7 @@ NavigationPanel::NavigationPanel(wxWindow* parent) : wxPanel(parent)
     Bind(wxEVT_TREE_ITEM_RIGHT_CLICK, &NavigationPanel::OnRightClick, this);
     Bind(wxEVT_TREE_BEGIN_DRAG, &NavigationPanel::OnBeginDrag, this);
     Bind(wxEVT_TREE_END_DRAG, &NavigationPanel::OnEndDrag, this);
+    Bind(wxEVT_TREE_ITEM_EXPANDING, &NavigationPanel::OnItemExpanding, this);
 
     Bind(EVT_NodePropChange, &NavigationPanel::OnNodePropChange, this);
     Bind(EVT_MultiPropChange, &NavigationPanel::OnMultiPropChange, this);
@@ -210,40 +211,31 @@ void NavigationPanel::OnProjectUpdated()
     m_tree_ctrl->DeleteAllItems();
     m_tree_node_map.clear();
     m_node_tree_map.clear();
+    m_display_names.clear();
 
-    const wxTreeItemId root = m_tree_ctrl->AddRoot(GetDisplayName(Project.get_ProjectNode()),
-                                                   GetImageIndex(Project.get_ProjectNode()), -1);
+    const wxTreeItemId root =
+        m_tree_ctrl->AddRoot(GetCachedDisplayName(Project.get_ProjectNode()),
+                             GetImageIndex(Project.get_ProjectNode()), -1);
     m_node_tree_map[Project.get_ProjectNode()] = root;
     m_tree_node_map[root] = Project.get_ProjectNode();
 
-    AddAllChildren(Project.get_ProjectNode());
-
-    // First we expand everything, then we collapse all forms and folders
-    ExpandAllNodes(Project.get_ProjectNode());
-
-    std::vector<Node*> forms;
-    Project.CollectForms(forms);
+    // Forms and folders start out collapsed, and the items within them aren't created until they
+    // are expanded. For large projects, this is what keeps opening the project fast.
+    PopulateExpanded(Project.get_ProjectNode());
+    m_tree_ctrl->Expand(root);
+}
 
-    for (const auto& form: forms)
+void NavigationPanel::OnItemExpanding(wxTreeEvent& event)
+{
+    const wxTreeItemId tree_item = event.GetItem();
+    Node* node = GetNode(tree_item);
+    if (!node || !node->get_ChildCount() || m_tree_ctrl->GetChildrenCount(tree_item, false))
     {
-        if (const NodeTreeMap::iterator result = m_node_tree_map.find(form);
-            result != m_node_tree_map.end())
-        {
-            m_tree_ctrl->Collapse(result->second);
-        }
+        return;
     }
 
-    for (const auto& folder: Project.get_ChildNodePtrs())
-    {
-        if (folder->is_Gen(gen_folder))
-        {
-            if (const NodeTreeMap::iterator result = m_node_tree_map.find(folder.get());
-                result != m_node_tree_map.end())
-            {
-                m_tree_ctrl->Collapse(result->second);
-            }
-        }
-    }
+    const wxWindowUpdateLocker freeze(this);
+    PopulateExpanded(node);
 }
 
 void NavigationPanel::OnSelChanged(wxTreeEvent& event)
@@ -509,22 +501,32 @@ void NavigationPanel::InsertNode(Node* node)
     Node* node_parent = node->get_Parent();
     ASSERT(node_parent);
     const auto it_parent = m_node_tree_map.find(node_parent);
-    ASSERT(it_parent != m_node_tree_map.end());
     if (it_parent == m_node_tree_map.end())
     {
+        // The parent doesn't have a tree item yet, so node will get one along with all of its
+        // siblings once the parent is displayed.
         return;
     }
     const wxTreeItemId tree_parent = it_parent->second;
     ASSERT(tree_parent);
+    if (m_tree_ctrl->GetChildrenCount(tree_parent, false) + 1 < node_parent->get_ChildCount())
+    {
+        // The siblings haven't been added yet, so node will be added with them the first time
+        // the parent is expanded.
+        m_tree_ctrl->SetItemHasChildren(tree_parent, true);
+        return;
+    }
+
     const wxTreeItemId new_item =
         m_tree_ctrl->InsertItem(tree_parent, node_parent->get_ChildPosition(node),
-                                GetDisplayName(node).wx(), GetImageIndex(node), -1);
+                                GetCachedDisplayName(node), GetImageIndex(node), -1);
     m_node_tree_map[node] = new_item;
     m_tree_node_map[new_item] = node;
 
     if (node->get_ChildCount())
     {
-        AddAllChildren(node);
+        // A pasted or duplicated node can have a large subtree -- ExpandAllNodes() adds all of
+        // it in a single frozen batch.
         ExpandAllNodes(node);
     }
     else if (node->get_Parent() && (node->get_Parent()->is_Type(type_toolbar) ||
@@ -537,8 +539,9 @@ void NavigationPanel::InsertNode(Node* node)
 
 void NavigationPanel::AddAllChildren(Node* node_parent)
 {
+    // If the parent doesn't have a tree item yet, its children will be added when it gets one
+    // and is expanded.
     const auto it_parent = m_node_tree_map.find(node_parent);
-    ASSERT(it_parent != m_node_tree_map.end());
     if (it_parent == m_node_tree_map.end())
     {
         return;
@@ -550,18 +553,79 @@ void NavigationPanel::AddAllChildren(Node* node_parent)
     {
         Node* node = iter_child.get();
         const wxTreeItemId new_item = m_tree_ctrl->AppendItem(
-            tree_parent, GetDisplayName(node).wx(), GetImageIndex(node), -1);
+            tree_parent, GetCachedDisplayName(node), GetImageIndex(node), -1);
 
         m_node_tree_map[node] = new_item;
         m_tree_node_map[new_item] = node;
 
         if (node->get_ChildCount())
         {
-            AddAllChildren(node);
+            // Display the expand button -- the child items are added by OnItemExpanding()
+            m_tree_ctrl->SetItemHasChildren(new_item, true);
+        }
+    }
+}
+
+wxTreeItemId NavigationPanel::PopulateChildren(Node* node)
+{
+    const NodeTreeMap::iterator result = m_node_tree_map.find(node);
+    if (result == m_node_tree_map.end())
+    {
+        return {};
+    }
+
+    if (node->get_ChildCount() && !m_tree_ctrl->GetChildrenCount(result->second, false))
+    {
+        AddAllChildren(node);
+    }
+    return result->second;
+}
+
+void NavigationPanel::PopulateExpanded(Node* node)
+{
+    std::ignore = PopulateChildren(node);
+    for (const auto& child: node->get_ChildNodePtrs())
+    {
+        if (child->get_ChildCount() && !child->is_Form() && !child->is_Gen(gen_folder))
+        {
+            PopulateExpanded(child.get());
+            if (const NodeTreeMap::iterator result = m_node_tree_map.find(child.get());
+                result != m_node_tree_map.end())
+            {
+                m_tree_ctrl->Expand(result->second);
+            }
         }
     }
 }
 
+wxTreeItemId NavigationPanel::EnsureTreeItem(Node* node)
+{
+    if (!node)
+    {
+        return {};
+    }
+    if (const NodeTreeMap::iterator result = m_node_tree_map.find(node);
+        result != m_node_tree_map.end())
+    {
+        return result->second;
+    }
+
+    Node* parent = node->get_Parent();
+    if (!parent || !EnsureTreeItem(parent).IsOk())
+    {
+        return {};
+    }
+
+    const wxWindowUpdateLocker freeze(this);
+    std::ignore = PopulateChildren(parent);
+    if (const NodeTreeMap::iterator result = m_node_tree_map.find(node);
+        result != m_node_tree_map.end())
+    {
+        return result->second;
+    }
+    return {};
+}
+
 int NavigationPanel::GetImageIndex(Node* node)
 {
     GenName name = node->get_GenName();
@@ -595,7 +659,18 @@ int NavigationPanel::GetImageIndex(Node* node)
 
 void NavigationPanel::UpdateDisplayName(wxTreeItemId tree_item, Node* node)
 {
-    m_tree_ctrl->SetItemText(tree_item, GetDisplayName(node).wx());
+    m_display_names.erase(node);
+    m_tree_ctrl->SetItemText(tree_item, GetCachedDisplayName(node));
+}
+
+const wxString& NavigationPanel::GetCachedDisplayName(Node* node)
+{
+    if (const NodeNameMap::iterator result = m_display_names.find(node);
+        result != m_display_names.end())
+    {
+        return result->second;
+    }
+    return m_display_names.emplace(node, GetDisplayName(node).wx()).first->second;
 }
 
 wxue::string NavigationPanel::GetDisplayName(Node* node) const
@@ -682,13 +757,15 @@ wxue::string NavigationPanel::GetDisplayName(Node* node) const
 void NavigationPanel::ExpandAllNodes(Node* node)
 {
     const wxWindowUpdateLocker freeze(this);
-    if (const NodeTreeMap::iterator item_it = m_node_tree_map.find(node);
-        item_it != m_node_tree_map.end())
+    const wxTreeItemId tree_item = PopulateChildren(node);
+    if (!tree_item.IsOk())
     {
-        if (m_tree_ctrl->ItemHasChildren(item_it->second))
-        {
-            m_tree_ctrl->Expand(item_it->second);
-        }
+        // None of the children can have a tree item either
+        return;
+    }
+    if (m_tree_ctrl->ItemHasChildren(tree_item))
+    {
+        m_tree_ctrl->Expand(tree_item);
     }
 
     for (const auto& child: node->get_ChildNodePtrs())
@@ -726,6 +803,7 @@ void NavigationPanel::EraseAllMaps(Node* node)
         // Don't erase this until the iterator is no longer needed
         m_node_tree_map.erase(node);
     }
+    m_display_names.erase(node);
 }
 void NavigationPanel::OnNodeSelected(CustomEvent& event)
 {
@@ -753,11 +831,10 @@ void NavigationPanel::OnNodeSelected(CustomEvent& event)
         return;
     }
 
-    if (const NodeTreeMap::iterator iter = m_node_tree_map.find(node);
-        iter != m_node_tree_map.end())
+    if (const wxTreeItemId tree_item = EnsureTreeItem(node); tree_item.IsOk())
     {
-        m_tree_ctrl->EnsureVisible(iter->second);
-        m_tree_ctrl->SelectItem(iter->second);
+        m_tree_ctrl->EnsureVisible(tree_item);
+        m_tree_ctrl->SelectItem(tree_item);
     }
     else
     {
@@ -787,6 +864,9 @@ void NavigationPanel::OnNodePropChange(CustomEvent& event)
 {
     NodeProperty* prop = event.GetNodeProperty();
 
+    // The node may not have a tree item to update, but its cached name could still be stale
+    m_display_names.erase(prop->getNode());
+
     if (prop->isProp(prop_var_name) || prop->isProp(prop_label) || prop->isProp(prop_class_name) ||
         prop->isProp(prop_bitmap))
     {
@@ -907,11 +987,11 @@ void NavigationPanel::OnParentChange(CustomEvent& event)
     InsertNode(undo_cmd->getNode());
     m_isSelChangeSuspended = false;
 
-    if (const NodeTreeMap::iterator iter = m_node_tree_map.find(m_pMainFrame->getSelectedNode());
-        iter != m_node_tree_map.end())
+    if (const wxTreeItemId tree_item = EnsureTreeItem(m_pMainFrame->getSelectedNode());
+        tree_item.IsOk())
     {
-        m_tree_ctrl->EnsureVisible(iter->second);
-        m_tree_ctrl->SelectItem(iter->second);
+        m_tree_ctrl->EnsureVisible(tree_item);
+        m_tree_ctrl->SelectItem(tree_item);
     }
 }
 
@@ -932,11 +1012,11 @@ void NavigationPanel::OnPositionChange(CustomEvent& event)
     InsertNode(undo_cmd->getNode());
     m_isSelChangeSuspended = false;
 
-    if (const NodeTreeMap::iterator iter = m_node_tree_map.find(m_pMainFrame->getSelectedNode());
-        iter != m_node_tree_map.end())
+    if (const wxTreeItemId tree_item = EnsureTreeItem(m_pMainFrame->getSelectedNode());
+        tree_item.IsOk())
     {
-        m_tree_ctrl->EnsureVisible(iter->second);
-        m_tree_ctrl->SelectItem(iter->second);
+        m_tree_ctrl->EnsureVisible(tree_item);
+        m_tree_ctrl->SelectItem(tree_item);
     }
 }
 
@@ -947,6 +1027,20 @@ void NavigationPanel::ChangeExpansion(Node* node, ExpansionFlag flags)
         return (static_cast<unsigned int>(value) & static_cast<unsigned int>(flag)) != 0;
     };
 
+    if (has_flags(flags, ExpansionFlag::expand))
+    {
+        // Create the tree items that need to be expanded if they haven't been created yet
+        if (EnsureTreeItem(node).IsOk())
+        {
+            std::ignore = PopulateChildren(node);
+        }
+    }
+    else if (!m_node_tree_map.contains(node))
+    {
+        // Nothing below node can have a tree item, so there's nothing to collapse
+        return;
+    }
+
     if (has_flags(flags, ExpansionFlag::include_children))
     {
         for (const auto& child: node->get_ChildNodePtrs())
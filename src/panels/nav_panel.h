@@ -48,7 +48,12 @@ public:
                                                            ExpansionFlag::expand);
 
     void EraseAllMaps(Node* node);
+
+    // Adds tree items for the immediate children of node_parent. Grandchildren are added the
+    // first time their parent is expanded.
     void AddAllChildren(Node* node_parent);
+
+    // Adds any missing tree items below node, and expands all of them.
     void ExpandAllNodes(Node* node);
 
     // Call this to refresh all the children of the specified parent, e.g. after all the
@@ -70,6 +75,20 @@ protected:
     wxue::string GetDisplayName(Node* node) const;
     void UpdateDisplayName(wxTreeItemId tree_item, Node* node);
 
+    // Returns the display name of node, calling GetDisplayName() only if it isn't cached.
+    const wxString& GetCachedDisplayName(Node* node);
+
+    // Returns the tree item for node, creating it and any missing ancestors if needed. Returns
+    // an invalid item if node isn't part of the project.
+    wxTreeItemId EnsureTreeItem(Node* node);
+
+    // Adds the children of node if they haven't been added yet. Returns node's tree item, or an
+    // invalid item if node doesn't have one.
+    wxTreeItemId PopulateChildren(Node* node);
+
+    // Adds the children of node and expands everything below it except for forms and folders.
+    void PopulateExpanded(Node* node);
+
     // Event handlers without parameters are called by lambda's, which means the function can also
     // be called directly without needing an event.
 
@@ -79,6 +98,7 @@ protected:
 
     void OnBeginDrag(wxTreeEvent& event);
     void OnEndDrag(wxTreeEvent& event);
+    void OnItemExpanding(wxTreeEvent& event);
     void OnRightClick(wxTreeEvent& event);
     void OnSelChanged(wxTreeEvent& event);
 
@@ -99,6 +119,7 @@ private:
     using NodeTreeMap = std::map<Node*, wxTreeItemId>;
     using TreeNodeMap = std::map<wxTreeItemId, Node*>;
     using IconIndexMap = std::map<GenName, int>;
+    using NodeNameMap = std::map<Node*, wxString>;
 
     MainFrame* m_pMainFrame { nullptr };
 
@@ -110,6 +131,10 @@ private:
     NodeTreeMap m_node_tree_map;
     TreeNodeMap m_tree_node_map;
 
+    // A node's tree item is recreated whenever the node is moved or its parent is refreshed, so
+    // the display names are cached rather than being recalculated each time.
+    NodeNameMap m_display_names;
+
     IconIndexMap m_icon_index;
 
     wxTreeCtrl* m_tree_ctrl { nullptr };
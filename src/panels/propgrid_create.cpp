@@ -56,28 +56,40 @@ void PropGridPanel::Create()
     {
         const wxWindowUpdateLocker freeze(this);
 
-#if defined(_DEBUG)
-        if (wxGetApp().isFireCreationMsgs())
-        {
-            MSG_INFO("Property window recreated.");
-        }
-#endif  // _DEBUG
-
         wxGetMainFrame()->SetStatusText(wxEmptyString, 2);
 
         m_currentSel = node;
         m_preferred_lang = Project.get_CodePreference(node);
 
-        wxString pageName;
         if (const int pageNumber = m_prop_grid->GetSelectedPage(); pageNumber != wxNOT_FOUND)
         {
-            pageName = m_prop_grid->GetPageName(pageNumber);
+            m_pageName = m_prop_grid->GetPageName(pageNumber);
+        }
+        else
+        {
+            m_pageName.clear();
         }
 
-        InitializePropertyGrids(pageName);
+        m_property_map.clear();
+        m_event_map.clear();
 
-        if (auto* declaration = node->get_NodeDeclaration(); declaration)
+        auto* declaration = node->get_NodeDeclaration();
+        if (!declaration)
         {
+            InitializePropertyGrids();
+        }
+        else if (const LayoutKey key = GetLayoutKey(node, declaration);
+                 !BindCachedLayout(key, node))
+        {
+#if defined(_DEBUG)
+            if (wxGetApp().isFireCreationMsgs())
+            {
+                MSG_INFO("Property window recreated.");
+            }
+#endif  // _DEBUG
+
+            AddLayoutPages(key);
+
             // These sets are used to prevent trying to add a duplicate property or event to the
             // property grid. In Debug builds, attempting to do so will generate an assert message
             // telling you the name of the duplicate and the node declaration it occurs in. In
@@ -100,7 +112,8 @@ void PropGridPanel::Create()
 
             AddLayoutCategoryIfNeeded(node);
 
-            RestoreSelectedPage(m_pageName);
+            m_prop_grid->SetPropertyAttributeAll(wxPG_BOOL_USE_CHECKBOX, (long) 1);
+            CacheLayout();
         }
 
         ReselectItem();
@@ -190,9 +203,7 @@ void PropGridPanel::CreateLayoutCategory(Node* node)
             }
 
             wxPGProperty* id_prop = m_prop_grid->Append(CreatePGProperty(prop));
-
-            wxString description = GetPropHelp(prop);
-            m_prop_grid->SetPropertyHelpString(id_prop, description);
+            InitGridProperty(id_prop, prop);
 
             m_property_map[id_prop] = prop;
             if (prop->isProp(prop_alignment))
@@ -204,9 +215,7 @@ void PropGridPanel::CreateLayoutCategory(Node* node)
         if (NodeProperty* prop = node->get_PropPtr(prop_proportion); prop)
         {
             wxPGProperty* id_prop = m_prop_grid->Append(CreatePGProperty(prop));
-
-            wxString description = GetPropHelp(prop);
-            m_prop_grid->SetPropertyHelpString(id_prop, description);
+            InitGridProperty(id_prop, prop);
 
             m_property_map[id_prop] = prop;
         }
@@ -222,9 +231,7 @@ void PropGridPanel::CreateLayoutCategory(Node* node)
             }
 
             wxPGProperty* id_prop = m_prop_grid->Append(CreatePGProperty(prop));
-
-            wxString description = GetPropHelp(prop);
-            m_prop_grid->SetPropertyHelpString(id_prop, description);
+            InitGridProperty(id_prop, prop);
 
             m_property_map[id_prop] = prop;
         }
@@ -417,9 +424,6 @@ wxPGProperty* PropGridPanel::CreatePGProperty(NodeProperty* prop)
             {
                 PropDeclaration* propInfo = prop->get_PropDeclaration();
 
-                std::string value = prop->as_string();
-                std::string_view help_text = {};
-
                 wxPGChoices constants;
                 int i = 0;
                 if (prop->get_name() == prop_code_preference && !wxGetApp().isTestingSwitch())
@@ -431,10 +435,6 @@ wxPGProperty* PropGridPanel::CreatePGProperty(NodeProperty* prop)
                             continue;
                         }
                         constants.Add(wxString(iter.name), i++);
-                        if (iter.name == value)
-                        {
-                            help_text = iter.help;
-                        }
                     }
                 }
                 else
@@ -442,10 +442,6 @@ wxPGProperty* PropGridPanel::CreatePGProperty(NodeProperty* prop)
                     for (auto& iter: propInfo->getOptions())
                     {
                         constants.Add(wxString(iter.name), i++);
-                        if (iter.name == value)
-                        {
-                            help_text = iter.help;
-                        }
                     }
                 }
 
@@ -460,27 +456,8 @@ wxPGProperty* PropGridPanel::CreatePGProperty(NodeProperty* prop)
                         new wxEnumProperty(wxString(prop->get_DeclName()), wxPG_LABEL, constants);
                 }
 
-                new_pg_property->SetValueFromString(value);
-
-                wxue::string description = GetPropHelp(prop);
-                if (description.empty())
-                {
-                    description << value;
-                }
-                else
-                {
-                    description << "\n\n" << value;
-                }
-                if (!help_text.empty())
-                {
-                    if (!description.empty())
-                    {
-                        description << "\n\n";
-                    }
-                    description << help_text;
-                }
-
-                new_pg_property->SetHelpString(description.wx());
+                new_pg_property->SetValueFromString(prop->as_string());
+                new_pg_property->SetHelpString(GetOptionHelp(prop));
             }
             return new_pg_property;
 
@@ -657,6 +634,44 @@ wxPGProperty* PropGridPanel::CreatePGProperty(NodeProperty* prop)
     }  // end switch (type)
 }
 
+wxString PropGridPanel::GetOptionHelp(NodeProperty* prop) const
+{
+    const std::string& value = prop->as_string();
+    std::string_view help_text = {};
+    for (auto& iter: prop->get_PropDeclaration()->getOptions())
+    {
+        if (iter.name == value)
+        {
+            if (prop->get_name() != prop_code_preference || wxGetApp().isTestingSwitch() ||
+                supported_languages.contains(iter.name))
+            {
+                help_text = iter.help;
+            }
+            break;
+        }
+    }
+
+    wxue::string description = GetPropHelp(prop);
+    if (description.empty())
+    {
+        description << value;
+    }
+    else
+    {
+        description << "\n\n" << value;
+    }
+    if (!help_text.empty())
+    {
+        if (!description.empty())
+        {
+            description << "\n\n";
+        }
+        description << help_text;
+    }
+
+    return description.wx();
+}
+
 void PropGridPanel::CreatePropCategory(wxue::string_view name, Node* node,
                                        NodeDeclaration* declaration, PropNameSet& prop_set)
 {
@@ -900,18 +915,14 @@ void PropGridPanel::CreatePropCategory(wxue::string_view name, Node* node,
     }
 }
 
-void PropGridPanel::InitializePropertyGrids(const wxString& current_page_name)
+void PropGridPanel::InitializePropertyGrids()
 {
-    m_pageName = current_page_name;
-
-    // Note that AddPage() won't actually add a page, it simply sets an internal flag to
-    // indicate there is one page. That's required for m_prop_grid->Clear() to work -- because
-    // Clear() *only* clears pages.
+    // Clear() *only* clears pages, which is why AddLayoutPages() always adds a page before any
+    // properties are appended. The first AddPage() after Clear() reuses the grid's default page.
 
     m_prop_grid->Clear();
-    m_prop_grid->AddPage();
     m_event_grid->Clear();
-    m_event_grid->AddPage();
+    m_layouts.clear();
 
     m_property_map.clear();
     m_event_map.clear();
@@ -1063,20 +1074,3 @@ void PropGridPanel::AddLayoutCategoryIfNeeded(Node* node)
         CreateLayoutCategory(node);
     }
 }
-
-void PropGridPanel::RestoreSelectedPage(const wxString& page_name)
-{
-    if (m_prop_grid->GetPageCount() > 0)
-    {
-        const int pageIndex = m_prop_grid->GetPageByName(page_name);
-        if (wxNOT_FOUND != pageIndex)
-        {
-            m_prop_grid->SelectPage(pageIndex);
-        }
-        else
-        {
-            m_prop_grid->SelectPage(0);
-        }
-    }
-    m_prop_grid->SetPropertyAttributeAll(wxPG_BOOL_USE_CHECKBOX, (long) 1);
-}
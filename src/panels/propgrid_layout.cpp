@@ -0,0 +1,203 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   PropGridPanel cache of property and event grid layouts
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+// Selecting a node used to clear both grids and create every category and property again, even
+// when the previously selected node had the identical layout (e.g., clicking through the tools
+// in a toolbar). Instead, each layout gets its own page in both grids, and selecting a node with
+// a layout that has already been built just selects those pages and updates their values.
+
+#include <algorithm>  // std::ranges::find
+#include <tuple>      // for std::ignore
+
+#include <wx/propgrid/manager.h>   // wxPropertyGridManager
+#include <wx/propgrid/propgrid.h>  // wxPropertyGrid
+
+#include "propgrid_panel.h"
+
+#include "node.h"             // Node class
+#include "node_event.h"       // NodeEvent and NodeEventInfo classes
+#include "node_prop.h"        // NodeProperty -- NodeProperty class
+#include "project_handler.h"  // ProjectHandler class
+
+#include "../customprops/evt_string_prop.h"  // EventStringProperty -- dialog for editing event handlers
+
+auto PropGridPanel::GetLayoutKey(Node* node, NodeDeclaration* declaration) const -> LayoutKey
+{
+    LayoutKey key;
+    key.declaration = declaration;
+    key.preferred_lang = Project.get_CodePreference(node);
+    key.project_lang = Project.get_CodePreference();
+    key.generate_languages = Project.get_GenerateLanguages();
+    key.cpp_version = Project.get_LangVersion(GenLang::cplusplus);
+    key.is_sizer_child = node->get_Parent() && node->get_Parent()->is_Sizer();
+    key.is_gridbag_child = node->is_Parent(gen_wxGridBagSizer);
+    return key;
+}
+
+bool PropGridPanel::BindCachedLayout(const LayoutKey& key, Node* node)
+{
+    auto layout = std::ranges::find(m_layouts, key, &PropGridLayout::key);
+    if (layout == m_layouts.end())
+    {
+        return false;
+    }
+    m_layouts.splice(m_layouts.begin(), m_layouts, layout);
+
+    m_prop_grid->SelectPage(m_prop_grid->GetPageByState(layout->prop_page));
+    m_event_grid->SelectPage(m_event_grid->GetPageByState(layout->event_page));
+
+    RebindProperties(*layout, node);
+    RebindEvents(*layout, node);
+    return true;
+}
+
+void PropGridPanel::AddLayoutPages(const LayoutKey& key)
+{
+    while (m_layouts.size() >= PROP_LAYOUT_CACHE_SIZE)
+    {
+        const PropGridLayout& oldest = m_layouts.back();
+        m_prop_grid->RemovePage(m_prop_grid->GetPageByState(oldest.prop_page));
+        m_event_grid->RemovePage(m_event_grid->GetPageByState(oldest.event_page));
+        m_layouts.pop_back();
+    }
+
+    PropGridLayout& layout = m_layouts.emplace_front();
+    layout.key = key;
+    layout.prop_page = m_prop_grid->AddPage();
+    layout.event_page = m_event_grid->AddPage();
+
+    m_prop_grid->SelectPage(m_prop_grid->GetPageByState(layout.prop_page));
+    m_event_grid->SelectPage(m_event_grid->GetPageByState(layout.event_page));
+}
+
+void PropGridPanel::CacheLayout()
+{
+    PropGridLayout& layout = m_layouts.front();
+    for (const auto& [grid_prop, prop]: m_property_map)
+    {
+        layout.properties.emplace_back(grid_prop, prop->get_name());
+    }
+    for (const auto& [grid_prop, event]: m_event_map)
+    {
+        layout.events.emplace_back(grid_prop, event->get_name());
+    }
+}
+
+void PropGridPanel::RebindProperties(PropGridLayout& layout, Node* node)
+{
+    // When the grid is created, every property starts out enabled and the generator then
+    // disables whatever doesn't apply to the node's current values.
+    for (auto iter = layout.prop_page->GetIterator(wxPG_ITERATE_ALL); !iter.AtEnd(); iter.Next())
+    {
+        iter.GetProperty()->Enable(true);
+    }
+
+    for (auto& [grid_prop, prop_name]: layout.properties)
+    {
+        NodeProperty* prop = node->get_PropPtr(prop_name);
+        ASSERT_MSG(prop, "A node with the same declaration is missing a property.");
+        if (!prop)
+        {
+            continue;
+        }
+
+        switch (prop->type())
+        {
+            case type_int:
+            case type_uint:
+            case type_bool:
+            case type_float:
+            case type_string:
+            case type_string_escapes:
+            case type_string_edit:
+            case type_string_edit_escapes:
+            case type_bitlist:
+            case type_stringlist_semi:
+            case type_stringlist_escapes:
+            case type_uintpairlist:
+                SetGridPropertyValue(grid_prop, prop);
+                break;
+
+            case type_option:
+            case type_editoption:
+                SetGridPropertyValue(grid_prop, prop);
+                grid_prop->SetHelpString(GetOptionHelp(prop));
+                break;
+
+            default:
+                {
+                    // The remaining grid properties either keep a pointer to the NodeProperty
+                    // they were created for, or have attributes that depend on its value, so
+                    // they get replaced rather than reused.
+                    const wxColour colour = m_prop_grid->GetPropertyBackgroundColour(grid_prop);
+                    grid_prop = m_prop_grid->ReplaceProperty(grid_prop, CreatePGProperty(prop));
+                    m_prop_grid->SetPropertyBackgroundColour(grid_prop, colour);
+                }
+                break;
+        }
+
+        InitGridProperty(grid_prop, prop);
+        m_property_map[grid_prop] = prop;
+    }
+
+    for (const auto& [grid_prop, prop]: m_property_map)
+    {
+        ChangeEnableState(prop);
+    }
+
+    for (auto iter = layout.prop_page->GetIterator(wxPG_ITERATE_CATEGORIES); !iter.AtEnd();
+         iter.Next())
+    {
+        std::ignore = RestoreExpansion(m_prop_grid, iter.GetProperty());
+    }
+}
+
+void PropGridPanel::RebindEvents(PropGridLayout& layout, Node* node)
+{
+    for (const auto& [grid_prop, event_name]: layout.events)
+    {
+        NodeEvent* event = node->get_Event(event_name);
+        auto* event_prop = dynamic_cast<EventStringProperty*>(grid_prop);
+        ASSERT_MSG(event && event_prop, "A node with the same declaration is missing an event.");
+        if (!event || !event_prop)
+        {
+            continue;
+        }
+
+        event_prop->SetNodeEvent(event);
+        event_prop->SetValueFromString(event->get_value());
+        m_event_map[grid_prop] = event;
+    }
+
+    for (auto iter = layout.event_page->GetIterator(wxPG_ITERATE_CATEGORIES); !iter.AtEnd();
+         iter.Next())
+    {
+        if (!RestoreExpansion(m_event_grid, iter.GetProperty()))
+        {
+            SetEventCategoryExpansion(iter.GetProperty(), node);
+        }
+    }
+}
+
+bool PropGridPanel::RestoreExpansion(wxPropertyGridManager* grid, wxPGProperty* category)
+{
+    const auto found_iter = m_expansion_map.find(category->GetName().ToStdString());
+    if (found_iter == m_expansion_map.end())
+    {
+        return false;
+    }
+
+    if (found_iter->second)
+    {
+        grid->Expand(category);
+    }
+    else
+    {
+        grid->Collapse(category);
+    }
+    return true;
+}
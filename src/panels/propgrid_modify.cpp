@@ -6,6 +6,8 @@
 /////////////////////////////////////////////////////////////////////////////
 // CR: [07-01-2026]
 
+#include <wx/propgrid/advprops.h>  // wxPropertyGrid Advanced Properties (font, colour, etc.)
+
 #include "prop_decl.h"
 #include "propgrid_panel.h"
 
@@ -59,6 +61,87 @@ void PropGridPanel::ModifyProperty(NodeProperty* prop, const wxString& str)
     m_isPropChangeSuspended = false;
 }
 
+void PropGridPanel::SetGridPropertyValue(wxPGProperty* grid_property, NodeProperty* prop)
+{
+    switch (prop->type())
+    {
+        case type_float:
+            grid_property->SetValue(WXVARIANT(prop->as_float()));
+            break;
+
+        case type_int:
+        case type_uint:
+            grid_property->SetValueFromString(prop->as_string());
+            break;
+
+        case type_string:
+        case type_string_edit:
+            grid_property->SetValueFromString(prop->as_string());
+            break;
+
+        case type_string_edit_escapes:
+        case type_string_escapes:
+        case type_stringlist_escapes:
+            grid_property->SetValueFromString(prop->as_escape_text().wx());
+            break;
+
+        case type_id:
+        case type_option:
+        case type_editoption:
+            grid_property->SetValueFromString(prop->as_escape_text());
+            break;
+
+        case type_bool:
+            grid_property->SetValueFromInt(prop->as_string() == "0" ? 0 : 1);
+            break;
+
+        case type_bitlist:
+            {
+                wxString value = prop->as_wxString();
+                value.Replace("|", ", ", true);
+                if (value == "0")
+                {
+                    value = "";
+                }
+                grid_property->SetValueFromString(value);
+            }
+            break;
+
+        case type_wxPoint:
+            {
+                // m_prop_grid->SetPropertyValue( grid_property, prop->GetValue() );
+                wxString aux_value = prop->as_wxString();
+                aux_value.Replace(",", ";");
+                grid_property->SetValueFromString(aux_value);
+            }
+            break;
+
+        case type_wxSize:
+            {
+                // m_prop_grid->SetPropertyValue( grid_property, prop->GetValue() );
+                wxString aux_value = prop->as_wxString();
+                aux_value.Replace(",", ";");
+                grid_property->SetValueFromString(aux_value);
+            }
+            break;
+
+        case type_wxColour:
+            {
+                wxColourPropertyValue def_value(wxPG_COLOUR_CUSTOM, prop->as_color());
+                m_prop_grid->SetPropertyValue(grid_property, def_value);
+            }
+            break;
+
+        case type_animation:
+        case type_image:
+            break;
+
+        default:
+            grid_property->SetValueFromString(prop->as_wxString(),
+                                              wxPGPropValFormatFlags::FullValue);
+    }
+}
+
 void PropGridPanel::ModifyBitlistProperty(NodeProperty* node_prop, wxPGProperty* grid_prop)
 {
     Node* node = node_prop->getNode();
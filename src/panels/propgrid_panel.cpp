@@ -9,7 +9,8 @@
 // See propgrid_events.cpp for event handlers for this class
 // See progrid_modify.cpp for functions that modify properties in the property grid
 
-#include <utility>  // std::to_underlying
+#include <algorithm>  // std::ranges::any_of
+#include <utility>    // std::to_underlying
 
 #include <wx/arrstr.h>             // wxArrayString class
 #include <wx/aui/auibook.h>        // wxaui: wx advanced user interface - notebook
@@ -110,6 +111,9 @@ PropGridPanel::PropGridPanel(wxWindow* parent, MainFrame* frame) : wxPanel(paren
     Bind(EVT_ProjectUpdated,
          [this](CustomEvent&)
          {
+             // Project settings can change which categories get displayed, so none of the
+             // cached layouts can be reused.
+             InitializePropertyGrids();
              Create();
          });
     Bind(EVT_MultiPropChange,
@@ -197,50 +201,7 @@ void PropGridPanel::AddProperties(wxue::string_view name, Node* node, NodeCatego
             }
 
             wxPGProperty* grid_prop = m_prop_grid->Append(CreatePGProperty(prop));
-            auto propType = prop->type();
-            if (propType != type_option)
-            {
-                if (BaseGenerator* gen = node->get_Generator(); gen)
-                {
-                    if (auto result = gen->GetHint(prop); result)
-                    {
-                        m_prop_grid->SetPropertyAttribute(grid_prop, wxPG_ATTR_HINT, result->wx());
-                    }
-                }
-                m_prop_grid->SetPropertyHelpString(grid_prop, GetPropHelp(prop));
-
-                if (propType == type_id)
-                {
-                    if (prop->isProp(prop_id))
-                    {
-                        m_prop_grid->SetPropertyAttribute(grid_prop, wxPG_ATTR_AUTOCOMPLETE,
-                                                          m_astr_wx_ids);
-                    }
-                }
-                if (propType == type_image || propType == type_animation)
-                {
-                    m_prop_grid->Expand(grid_prop);
-                    if (UserPrefs.is_DarkMode())
-                    {
-                        m_prop_grid->SetPropertyBackgroundColour(grid_prop, wxColour("#996900"));
-                    }
-                    else
-                    {
-                        m_prop_grid->SetPropertyBackgroundColour(grid_prop, wxColour("#fff1d2"));
-                    }
-
-                    // This causes it to display the bitmap in the image/id property
-                    grid_prop->RefreshChildren();
-                }
-                if (propType == type_string)
-                {
-                    if (prop->isProp(prop_class_decoration))
-                    {
-                        m_prop_grid->SetPropertyAttribute(grid_prop, wxPG_ATTR_AUTOCOMPLETE,
-                                                          m_astr_wx_decorations);
-                    }
-                }
-            }
+            InitGridProperty(grid_prop, prop);
 
             if (name.is_sameas("wxWindow") || name.is_sameas("wxMdiWindow") ||
                 category.GetName().Contains("Window Settings"))
@@ -255,29 +216,6 @@ void PropGridPanel::AddProperties(wxue::string_view name, Node* node, NodeCatego
                 }
             }
 
-            // Automatically collapse properties that are rarely used
-            if (prop_name == prop_unchecked_bitmap)
-            {
-                m_prop_grid->Collapse(grid_prop);
-            }
-
-            auto prop_name_iter = map_PropNames.find(prop_name);
-            if (prop_name_iter != map_PropNames.end())
-            {
-                if (auto found_iter = m_expansion_map.find(std::string(prop_name_iter->second));
-                    found_iter != m_expansion_map.end())
-                {
-                    if (found_iter->second)
-                    {
-                        m_prop_grid->Expand(grid_prop);
-                    }
-                    else
-                    {
-                        m_prop_grid->Collapse(grid_prop);
-                    }
-                }
-            }
-
             prop_set.emplace(prop_name);
             m_property_map[grid_prop] = prop;
         }
@@ -341,6 +279,82 @@ void PropGridPanel::AddProperties(wxue::string_view name, Node* node, NodeCatego
     }
 }
 
+void PropGridPanel::InitGridProperty(wxPGProperty* grid_prop, NodeProperty* prop)
+{
+    auto propType = prop->type();
+    if (propType != type_option)
+    {
+        if (BaseGenerator* gen = prop->getNode()->get_Generator(); gen)
+        {
+            if (auto result = gen->GetHint(prop); result)
+            {
+                m_prop_grid->SetPropertyAttribute(grid_prop, wxPG_ATTR_HINT, result->wx());
+            }
+            else if (!grid_prop->GetAttribute(wxPG_ATTR_HINT).IsNull())
+            {
+                // A cached grid property may still have the hint from a previous node
+                m_prop_grid->SetPropertyAttribute(grid_prop, wxPG_ATTR_HINT, wxVariant());
+            }
+        }
+        m_prop_grid->SetPropertyHelpString(grid_prop, GetPropHelp(prop));
+
+        if (propType == type_id)
+        {
+            if (prop->isProp(prop_id))
+            {
+                m_prop_grid->SetPropertyAttribute(grid_prop, wxPG_ATTR_AUTOCOMPLETE,
+                                                  m_astr_wx_ids);
+            }
+        }
+        if (propType == type_image || propType == type_animation)
+        {
+            m_prop_grid->Expand(grid_prop);
+            if (UserPrefs.is_DarkMode())
+            {
+                m_prop_grid->SetPropertyBackgroundColour(grid_prop, wxColour("#996900"));
+            }
+            else
+            {
+                m_prop_grid->SetPropertyBackgroundColour(grid_prop, wxColour("#fff1d2"));
+            }
+
+            // This causes it to display the bitmap in the image/id property
+            grid_prop->RefreshChildren();
+        }
+        if (propType == type_string)
+        {
+            if (prop->isProp(prop_class_decoration))
+            {
+                m_prop_grid->SetPropertyAttribute(grid_prop, wxPG_ATTR_AUTOCOMPLETE,
+                                                  m_astr_wx_decorations);
+            }
+        }
+    }
+
+    // Automatically collapse properties that are rarely used
+    if (prop->isProp(prop_unchecked_bitmap))
+    {
+        m_prop_grid->Collapse(grid_prop);
+    }
+
+    auto prop_name_iter = map_PropNames.find(prop->get_name());
+    if (prop_name_iter != map_PropNames.end())
+    {
+        if (auto found_iter = m_expansion_map.find(std::string(prop_name_iter->second));
+            found_iter != m_expansion_map.end())
+        {
+            if (found_iter->second)
+            {
+                m_prop_grid->Expand(grid_prop);
+            }
+            else
+            {
+                m_prop_grid->Collapse(grid_prop);
+            }
+        }
+    }
+}
+
 // clang-format off
 inline constexpr const char* lst_key_events[] = {
 
@@ -486,47 +500,43 @@ void PropGridPanel::AddEvents(wxue::string_view name, Node* node, NodeCategory&
         }
         else
         {
-            // Keyboard and Mouse events aren't used a lot, but are quite lengthy, so we collapse
-            // them by default.
+            SetEventCategoryExpansion(catId, node);
+        }
+    }
+}
 
-            if (nextCat.getName() == "Keyboard Events")
-            {
-                bool has_event { false };
-                for (const auto& iter: lst_key_events)
-                {
-                    if (NodeEvent* event = node->get_Event(iter);
-                        event && !event->get_value().empty())
-                    {
-                        has_event = true;
-                        break;
-                    }
-                }
+void PropGridPanel::SetEventCategoryExpansion(wxPGProperty* category, Node* node)
+{
+    // Keyboard and Mouse events aren't used a lot, but are quite lengthy, so we collapse them
+    // unless the node has a handler for one of them.
 
-                if (!has_event)
-                {
-                    m_event_grid->Collapse(catId);
-                }
-            }
+    const auto has_event = [node](const auto& event_names)
+    {
+        return std::ranges::any_of(event_names,
+                                   [node](const char* event_name)
+                                   {
+                                       NodeEvent* event = node->get_Event(event_name);
+                                       return event && !event->get_value().empty();
+                                   });
+    };
 
-            else if (nextCat.getName() == "Mouse Events")
-            {
-                bool has_event { false };
-                for (const auto& iter: lst_mouse_events)
-                {
-                    if (NodeEvent* event = node->get_Event(iter);
-                        event && !event->get_value().empty())
-                    {
-                        has_event = true;
-                        break;
-                    }
-                }
+    bool expand = true;
+    if (category->GetName() == "Keyboard Events")
+    {
+        expand = has_event(lst_key_events);
+    }
+    else if (category->GetName() == "Mouse Events")
+    {
+        expand = has_event(lst_mouse_events);
+    }
 
-                if (!has_event)
-                {
-                    m_event_grid->Collapse(catId);
-                }
-            }
-        }
+    if (expand)
+    {
+        m_event_grid->Expand(category);
+    }
+    else
+    {
+        m_event_grid->Collapse(category);
     }
 }
 
@@ -7,8 +7,13 @@
 
 #pragma once
 
+#include <compare>
+#include <list>
 #include <map>
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <wx/aui/auibook.h>       // wxaui: wx advanced user interface - notebook
 #include <wx/propgrid/manager.h>  // wxPropertyGridManager
@@ -70,6 +75,9 @@ protected:
     void AddProperties(wxue::string_view name, Node* node, NodeCategory& category,
                        PropNameSet& prop_set, bool is_child_cat = false);
 
+    // Expands or collapses an event category based on whether node has any of its events
+    void SetEventCategoryExpansion(wxPGProperty* category, Node* node);
+
     void ReplaceDerivedName(const wxue::string& formName, NodeProperty* propType);
     void ReplaceDerivedFile(const wxue::string& formName, NodeProperty* propType);
 
@@ -79,6 +87,17 @@ protected:
 
     auto CreatePGProperty(NodeProperty* prop) -> wxPGProperty*;
 
+    // Sets the hint, help string, and other attributes of a grid property that depend on the
+    // node property it displays.
+    void InitGridProperty(wxPGProperty* grid_prop, NodeProperty* prop);
+
+    // Returns the help string for a type_option or type_editoption property, which includes
+    // the help for the property's current value.
+    auto GetOptionHelp(NodeProperty* prop) const -> wxString;
+
+    // Sets the value of an existing grid property to the value of prop
+    void SetGridPropertyValue(wxPGProperty* grid_property, NodeProperty* prop);
+
     // Called after a property has been modified, this checks to see if various property
     // items need to be enabled or disabled based on the current value of the changed
     // property.
@@ -117,18 +136,73 @@ protected:
     void OnAuiNotebookPageChanged(wxAuiNotebookEvent& event);
 
 private:
+    // Everything other than the node's values that determines which properties and categories
+    // Create() adds to the grids, and how they are initially expanded.
+    struct LayoutKey
+    {
+        NodeDeclaration* declaration { nullptr };
+        GenLang preferred_lang { GenLang::cplusplus };
+        GenLang project_lang { GenLang::cplusplus };
+        GenLang generate_languages { GenLang::none };
+        int cpp_version { 0 };
+        bool is_sizer_child { false };
+        bool is_gridbag_child { false };
+
+        auto operator<=>(const LayoutKey&) const = default;
+    };
+
+    // A pair of property and event grid pages built by Create(), which can be rebound to any
+    // node with the same LayoutKey.
+    struct PropGridLayout
+    {
+        LayoutKey key;
+        wxPropertyGridPage* prop_page { nullptr };
+        wxPropertyGridPage* event_page { nullptr };
+        std::vector<std::pair<wxPGProperty*, PropName>> properties;
+        std::vector<std::pair<wxPGProperty*, std::string>> events;
+    };
+
+    // Maximum number of grid layouts to keep -- the least recently used layout is removed when
+    // a new one is added.
+    static constexpr size_t PROP_LAYOUT_CACHE_SIZE = 16;
+
+    auto GetLayoutKey(Node* node, NodeDeclaration* declaration) const -> LayoutKey;
+
+    // If a layout matching key has been cached, this selects its pages and rebinds them to
+    // node's properties and events. Returns false if there is no cached layout.
+    auto BindCachedLayout(const LayoutKey& key, Node* node) -> bool;
+
+    // Adds and selects new pages for Create() to add a node's properties and events to
+    void AddLayoutPages(const LayoutKey& key);
+
+    // Records the properties and events Create() added to the pages from AddLayoutPages(),
+    // removing the least recently used layout if the cache is full.
+    void CacheLayout();
+
+    void RebindProperties(PropGridLayout& layout, Node* node);
+    void RebindEvents(PropGridLayout& layout, Node* node);
+
+    // Expands or collapses category to match m_expansion_map. Returns false if the category
+    // isn't in the map.
+    auto RestoreExpansion(wxPropertyGridManager* grid, wxPGProperty* category) -> bool;
+
     // Helper functions for Create()
-    void InitializePropertyGrids(const wxString& current_page_name);
+
+    // Removes all pages from both grids, including all cached layouts
+    void InitializePropertyGrids();
     void ProcessFormLanguageCategories(Node* node, NodeDeclaration* declaration,
                                        PropNameSet& prop_set, EventSet& event_set);
     void ProcessStandardBaseClasses(Node* node, NodeDeclaration* declaration, PropNameSet& prop_set,
                                     EventSet& event_set);
     void AddLayoutCategoryIfNeeded(Node* node);
-    void RestoreSelectedPage(const wxString& page_name);
 
     std::map<wxPGProperty*, NodeProperty*> m_property_map;
     std::map<wxPGProperty*, NodeEvent*> m_event_map;
 
+    // Most recently used layout first. There are few enough layouts that a linear search is
+    // faster than maintaining a separate lookup map.
+    std::list<PropGridLayout> m_layouts;
+
     Node* m_currentSel { nullptr };
 
     wxString m_selected_prop_name;
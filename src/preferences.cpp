@@ -80,6 +80,7 @@ void Prefs::ReadConfig()
     m_perl_line_length = config->Read("perl_line_length", 80);
 
     m_icon_size = config->Read("icon_size", 20);
+    m_undo_memory_limit = config->Read("undo_memory_limit", 128);
 
     m_code_display_font = config->Read("code_display_font", "");
 
@@ -136,6 +137,7 @@ void Prefs::WriteConfig()
     config->Write("ruby_line_length", m_ruby_line_length);
 
     config->Write("icon_size", m_icon_size);
+    config->Write("undo_memory_limit", m_undo_memory_limit);
 
     if (m_dark_mode_pending & PENDING_DARK_MODE_ENABLE)
     {
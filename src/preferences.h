@@ -84,6 +84,11 @@ public:
     int get_IconSize() const { return m_icon_size; }
     void set_IconSize(int size) { m_icon_size = size; }
 
+    // Maximum memory (in MB) the undo stack may use before older entries are collapsed into
+    // project checkpoints stored in a temporary file.
+    int get_UndoMemoryLimit() const { return m_undo_memory_limit; }
+    void set_UndoMemoryLimit(int limit) { m_undo_memory_limit = limit; }
+
     // Use this string to construct a FontProperty() to get the values
     const wxue::string& get_CodeDisplayFont() const { return m_code_display_font; }
 
@@ -244,6 +249,7 @@ private:
     int m_perl_line_length { 80 };
 
     int m_icon_size { 20 };
+    int m_undo_memory_limit { 128 };  // MB
 
     bool m_sizers_all_borders { true };
     bool m_sizers_always_expand { true };
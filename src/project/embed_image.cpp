@@ -8,7 +8,6 @@
 
 #include <wx/image.h>
 #include <wx/mstream.h>   // For wxMemoryInputStream
-#include <wx/wfstream.h>  // For wxFileInputStream
 #include <wx/zstream.h>   // For wxZlibInputStream
 
 #include <sstream>  // For std::ostringstream
@@ -16,9 +15,10 @@
 
 #include "embed_image.h"
 
-#include "mainframe.h"  // for wxGetMainFrame()
-#include "pugixml.hpp"  // For XML parsing of SVG files
-#include "utils.h"      // For FileNameToVarName()
+#include "image_encoder.h"  // image_encoder::Encode()
+#include "mainframe.h"      // for wxGetMainFrame()
+#include "pugixml.hpp"      // For XML parsing of SVG files
+#include "utils.h"          // For FileNameToVarName()
 #include "wxue_namespace/wxue_string.h"
 
 EmbeddedImage::EmbeddedImage(wxue::string_view path, Node* form)
@@ -210,75 +210,16 @@ bool EmbeddedImage::UpdateImage(ImageInfo& image_info)
         return true;
     }
 
-    wxFFileInputStream stream(image_info.filename);
-    if (!stream.IsOk())
+    // image_encoder uses the same conversion as when the image was first added, and will find
+    // the result in image_cache if the file was changed back to a previous version.
+    auto encoded = image_encoder::Encode(image_info.filename, ImageEncoding::raster);
+    if (!encoded.is_ok())
     {
         return false;
     }
-
-    wxImageHandler* handler = nullptr;
-    const wxList& list = wxImage::GetHandlers();
-    for (wxList::compatibility_iterator node = list.GetFirst(); node; node = node->GetNext())
-    {
-        handler = wxStaticCast(node->GetData(), wxImageHandler);
-        if (handler->CanRead(stream))
-        {
-            wxImage image;
-            if (handler->LoadFile(&image, stream))
-            {
-                image_info.file_time = image_info.filename.last_write_time();
-
-                // If possible, convert the file to a PNG -- even if the original file is a PNG,
-                // since we might end up with better compression.
-
-                if (isConvertibleMime(handler->GetMimeType()))
-                {
-                    image_info.type = wxBITMAP_TYPE_PNG;
-
-                    wxMemoryOutputStream save_stream;
-
-                    // Maximize compression
-                    image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_LEVEL, 9);
-                    image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_MEM_LEVEL, 9);
-                    image.SaveFile(save_stream, "image/png");
-
-                    const wxStreamBuffer* read_stream = save_stream.GetOutputStreamBuffer();
-                    stream.SeekI(0);
-                    if (read_stream->GetBufferSize() <= (to_size_t) stream.GetLength())
-                    {
-                        image_info.array_size = read_stream->GetBufferSize();
-                        image_info.array_data.resize(image_info.array_size);
-                        memcpy(image_info.array_data.data(), read_stream->GetBufferStart(),
-                               image_info.array_size);
-                    }
-                    else
-                    {
-                        const wxFileOffset file_size = stream.GetSize();
-                        if (file_size < 0)
-                        {
-                            wxMessageDialog(wxGetMainFrame()->getWindow(),
-                                            "The image file cannot be read and appears to be "
-                                            "invalid.",
-                                            "Invalid Image File", wxOK | wxICON_ERROR)
-                                .ShowModal();
-                            return false;
-                        }
-                        image_info.array_size = static_cast<uint64_t>(file_size);
-                        image_info.array_data.resize(image_info.array_size);
-                        stream.Read(image_info.array_data.data(), image_info.array_size);
-                    }
-                }
-                else
-                {
-                    stream.SeekI(0);
-                    image_info.array_size = stream.GetSize();
-                    image_info.array_data.resize(image_info.array_size);
-                    stream.Read(image_info.array_data.data(), image_info.array_size);
-                }
-
-                return true;
-            }
-        }
-    }
-    return false;
+    image_info.file_time = image_info.filename.last_write_time();
+    image_info.type = encoded.type;
+    image_info.array_size = encoded.array_size;
+    image_info.array_data = std::move(encoded.array_data);
+    return true;
 }
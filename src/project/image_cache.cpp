@@ -0,0 +1,277 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Persistent cache of encoded embedded images
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>      // for std::rotl
+#include <cstring>  // for std::memcpy
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <wx/stdpaths.h>  // wxStandardPaths
+#include <wx/utils.h>     // wxGetProcessId
+
+#include "image_cache.h"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // Only written by Initialize() before any image is encoded, so workers can read it freely.
+    fs::path s_cache_dir;
+    std::atomic<bool> s_enabled { false };
+
+    // Bytes written to the cache this session -- Evict() does nothing if this is zero.
+    std::atomic<std::uintmax_t> s_stored_bytes { 0 };
+
+    // Entries larger than this are assumed to be corrupt
+    constexpr std::uint64_t max_entry_size = 256 * 1024 * 1024;
+
+    constexpr std::array<char, 8> entry_magic = { 'W', 'X', 'U', 'E', 'I', 'M', 'G', 'C' };
+
+    // Each cache file is this header followed by data_size bytes of EncodedImage::array_data.
+    // The cache is never shared between machines, so the header is written in native byte
+    // order.
+    struct EntryHeader
+    {
+        std::array<char, 8> magic;
+        std::uint64_t source_size;
+        std::uint32_t type;
+        std::int32_t width;
+        std::int32_t height;
+        std::uint32_t reserved;
+        std::uint64_t array_size;
+        std::uint64_t data_size;
+    };
+
+    // splitmix64 finalizer
+    constexpr auto Mix(std::uint64_t value) -> std::uint64_t
+    {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ULL;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebULL;
+        value ^= value >> 31;
+        return value;
+    }
+
+    // Returns the cache filename for source. The name is two independent 64-bit hashes of the
+    // contents (FNV-1a over each byte, and a multiply-rotate hash over each 8-byte word), both
+    // seeded with the encoding, the cache format and the size of the source.
+    auto EntryPath(std::span<const unsigned char> source, ImageEncoding encoding) -> fs::path
+    {
+        const std::uint64_t seed = Mix((static_cast<std::uint64_t>(encoding) << 32) |
+                                       image_cache::cache_format_version) ^
+                                   Mix(source.size());
+
+        std::uint64_t fnv = 0xcbf29ce484222325ULL ^ seed;
+        for (const auto byte: source)
+        {
+            fnv ^= byte;
+            fnv *= 0x100000001b3ULL;
+        }
+
+        std::uint64_t words = Mix(seed + 0x9e3779b97f4a7c15ULL);
+        size_t pos = 0;
+        for (; pos + sizeof(std::uint64_t) <= source.size(); pos += sizeof(std::uint64_t))
+        {
+            std::uint64_t word = 0;
+            std::memcpy(&word, source.data() + pos, sizeof(word));
+            words = std::rotl(words ^ Mix(word), 27) * 0x9fb21c651e98df25ULL;
+        }
+        if (pos < source.size())
+        {
+            std::uint64_t tail = 0;
+            std::memcpy(&tail, source.data() + pos, source.size() - pos);
+            words ^= tail;
+        }
+        words = Mix(words);
+
+        return s_cache_dir / std::format("{:016x}{:016x}.img", Mix(fnv), words);
+    }
+}  // namespace
+
+void image_cache::Initialize(bool enabled)
+{
+    s_enabled = false;
+    if (!enabled)
+    {
+        return;
+    }
+
+    const wxString cache_dir = wxStandardPaths::Get().GetUserDir(wxStandardPaths::Dir_Cache);
+    if (cache_dir.empty())
+    {
+        return;
+    }
+    s_cache_dir = fs::path(cache_dir.ToStdWstring()) / "wxUiEditor" / "images";
+
+    std::error_code error;
+    fs::create_directories(s_cache_dir, error);
+    s_enabled = !error;
+}
+
+auto image_cache::IsEnabled() -> bool
+{
+    return s_enabled;
+}
+
+auto image_cache::Find(std::span<const unsigned char> source, ImageEncoding encoding,
+                       EncodedImage& encoded) -> bool
+{
+    if (!s_enabled)
+    {
+        return false;
+    }
+
+    const auto path = EntryPath(source, encoding);
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    EntryHeader header {};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != entry_magic || header.source_size != source.size() ||
+        header.data_size > max_entry_size)
+    {
+        return false;
+    }
+
+    std::vector<unsigned char> data(header.data_size);
+    if (!file.read(reinterpret_cast<char*>(data.data()),
+                   static_cast<std::streamsize>(data.size())))
+    {
+        return false;
+    }
+
+    encoded.array_data = std::move(data);
+    encoded.array_size = header.array_size;
+    encoded.type = static_cast<wxBitmapType>(header.type);
+    encoded.size = { header.width, header.height };
+    encoded.error.clear();
+
+    // The file time is what Evict() uses to decide which entries were least recently used.
+    std::error_code error;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), error);
+
+    return true;
+}
+
+void image_cache::Store(std::span<const unsigned char> source, ImageEncoding encoding,
+                        const EncodedImage& encoded)
+{
+    if (!s_enabled || !encoded.is_ok())
+    {
+        return;
+    }
+
+    const auto path = EntryPath(source, encoding);
+    std::error_code error;
+    if (fs::exists(path, error))
+    {
+        return;
+    }
+
+    EntryHeader header {};
+    header.magic = entry_magic;
+    header.source_size = source.size();
+    header.type = static_cast<std::uint32_t>(encoded.type);
+    header.width = encoded.size.x;
+    header.height = encoded.size.y;
+    header.array_size = encoded.array_size;
+    header.data_size = encoded.array_data.size();
+
+    // Another thread or another instance of wxUiEditor may be storing the same image, so the
+    // entry is written to a temporary file named after the process and thread, which is then
+    // renamed.
+    auto temp_path = path;
+    temp_path += std::format(".{:x}.{:x}.tmp", wxGetProcessId(),
+                             std::hash<std::thread::id> {}(std::this_thread::get_id()));
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(encoded.array_data.data()),
+                   static_cast<std::streamsize>(encoded.array_data.size()));
+        if (!file)
+        {
+            file.close();
+            fs::remove(temp_path, error);
+            return;
+        }
+    }
+
+    fs::rename(temp_path, path, error);
+    if (error)
+    {
+        fs::remove(temp_path, error);
+        return;
+    }
+    s_stored_bytes += sizeof(header) + encoded.array_data.size();
+}
+
+void image_cache::Evict()
+{
+    if (!s_enabled || s_stored_bytes == 0)
+    {
+        return;
+    }
+
+    struct Entry
+    {
+        fs::path path;
+        std::uintmax_t size;
+        fs::file_time_type time;
+    };
+    std::vector<Entry> entries;
+    std::uintmax_t total_size = 0;
+
+    std::error_code error;
+    for (fs::directory_iterator iter(s_cache_dir, error), end; !error && iter != end;
+         iter.increment(error))
+    {
+        // Anything else in the directory (including a .tmp file left by a crash) is also an
+        // eviction candidate.
+        if (!iter->is_regular_file(error))
+        {
+            continue;
+        }
+        Entry entry { iter->path(), iter->file_size(error), iter->last_write_time(error) };
+        if (error)
+        {
+            error.clear();
+            continue;
+        }
+        total_size += entry.size;
+        entries.push_back(std::move(entry));
+    }
+
+    if (total_size <= image_cache::max_cache_size)
+    {
+        return;
+    }
+
+    std::ranges::sort(entries, {}, &Entry::time);
+    for (const auto& entry: entries)
+    {
+        if (total_size <= image_cache::max_cache_size / 4 * 3)
+        {
+            break;
+        }
+        if (fs::remove(entry.path, error))
+        {
+            total_size -= entry.size;
+        }
+    }
+    s_stored_bytes = 0;
+}
@@ -0,0 +1,49 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Persistent cache of encoded embedded images
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// The cache stores the result of image_encoder in the user's cache directory (e.g.
+// ~/.cache/wxUiEditor/images), so that the same PNG, SVG or XPM file is only compressed once no
+// matter how many sessions or checkouts use it. Entries are keyed by a 128-bit hash of the
+// source file's contents, the ImageEncoding, and cache_format_version -- the filename and file
+// time play no part, so a fresh checkout of a project still gets cache hits.
+//
+// Find() and Store() may be called from any thread. Initialize() and Evict() must only be
+// called from the main thread.
+
+#include <cstdint>
+#include <span>
+
+#include "image_encoder.h"  // EncodedImage, ImageEncoding
+
+namespace image_cache
+{
+    // Increase this whenever image_encoder changes the data it produces (compression level,
+    // SVG cleanup, etc.) so that entries created by an older version are never used.
+    inline constexpr std::uint32_t cache_format_version = 1;
+
+    // Once the cache exceeds this size, Evict() removes the least recently used entries.
+    inline constexpr std::uintmax_t max_cache_size = 256 * 1024 * 1024;
+
+    // Sets the cache directory. If enabled is false (--no-image-cache) or the directory
+    // cannot be created, Find() and Store() do nothing for the rest of the session.
+    void Initialize(bool enabled);
+
+    [[nodiscard]] auto IsEnabled() -> bool;
+
+    // Returns true if source was found in the cache, in which case encoded contains the result.
+    [[nodiscard]] auto Find(std::span<const unsigned char> source, ImageEncoding encoding,
+                            EncodedImage& encoded) -> bool;
+
+    void Store(std::span<const unsigned char> source, ImageEncoding encoding,
+               const EncodedImage& encoded);
+
+    // If anything was stored during this session and the cache is larger than max_cache_size,
+    // this removes the least recently used entries until it is under 3/4 of that size.
+    void Evict();
+}  // namespace image_cache
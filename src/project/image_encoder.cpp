@@ -0,0 +1,270 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Decode and compress image files for EmbeddedImage
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>  // for std::memcpy
+#include <format>
+#include <sstream>  // For std::ostringstream
+#include <tuple>    // for std::ignore
+
+#include <wx/file.h>      // wxFile - encapsulates low-level "file descriptor"
+#include <wx/image.h>     // wxImage class
+#include <wx/mstream.h>   // Memory stream classes
+#include <wx/zstream.h>   // zlib stream classes
+
+#include "image_encoder.h"
+
+#include "image_cache.h"                        // image_cache::Find(), image_cache::Store()
+#include "pugixml.hpp"                          // xml parser
+#include "utils.h"                              // isConvertibleMime(), CopyStreamData()
+#include "wxue_namespace/wxue_string_vector.h"  // wxue::StringVector
+
+namespace
+{
+    // Compresses data with zlib, storing the original size in the upper 32 bits of array_size
+    auto CompressInto(wxInputStream& stream, EncodedImage& result) -> bool
+    {
+        const uint64_t org_size = (stream.GetLength() & 0xFFFFFFFF);
+
+        wxMemoryOutputStream memory_stream;
+        wxZlibOutputStream save_stream(memory_stream, wxZ_BEST_COMPRESSION);
+        if (!CopyStreamData(&stream, &save_stream, stream.GetLength()))
+        {
+            return false;
+        }
+        save_stream.Close();
+        auto compressed_size = static_cast<uint64_t>(memory_stream.TellO());
+
+        const auto* read_stream = memory_stream.GetOutputStreamBuffer();
+        result.array_size = (compressed_size | (org_size << 32));
+        result.array_data.resize(compressed_size);
+        std::memcpy(result.array_data.data(), read_stream->GetBufferStart(), compressed_size);
+        return true;
+    }
+}  // namespace
+
+auto image_encoder::ReadSource(const wxue::string& path, std::vector<unsigned char>& source)
+    -> bool
+{
+    wxFile file;
+    if (!file.Open(path.wx(), wxFile::read))
+    {
+        return false;
+    }
+    const wxFileOffset file_size = file.Length();
+    if (file_size < 0)
+    {
+        return false;
+    }
+    source.resize(static_cast<size_t>(file_size));
+    return file.Read(source.data(), source.size()) == static_cast<ssize_t>(source.size());
+}
+
+auto image_encoder::Encode(const wxue::string& path, ImageEncoding encoding) -> EncodedImage
+{
+    EncodedImage result;
+    std::vector<unsigned char> source;
+    if (!ReadSource(path, source))
+    {
+        result.error = "Unable to read the file";
+        return result;
+    }
+    if (source.empty())
+    {
+        result.error = "The file is empty";
+        return result;
+    }
+
+    if (image_cache::Find(source, encoding, result))
+    {
+        return result;
+    }
+
+    switch (encoding)
+    {
+        case ImageEncoding::svg:
+            result = EncodeSvg(source, path);
+            break;
+        case ImageEncoding::xpm:
+            result = EncodeXpm(source);
+            break;
+        default:
+            result = EncodeRaster(source);
+            break;
+    }
+
+    image_cache::Store(source, encoding, result);
+    return result;
+}
+
+auto image_encoder::EncodeRaster(std::span<const unsigned char> source) -> EncodedImage
+{
+    EncodedImage result;
+    wxMemoryInputStream stream(source.data(), source.size());
+
+    const wxList& list = wxImage::GetHandlers();
+    for (wxList::compatibility_iterator node = list.GetFirst(); node; node = node->GetNext())
+    {
+        auto* handler = dynamic_cast<wxImageHandler*>(node->GetData());
+        if (!handler->CanRead(stream))
+        {
+            continue;
+        }
+        wxImage image;
+        if (!handler->LoadFile(&image, stream))
+        {
+            stream.SeekI(0);
+            continue;
+        }
+        result.size = image.GetSize();
+
+        // If possible, convert the file to a PNG -- even if the original file is a PNG, since we
+        // might end up with better compression.
+
+        if (isConvertibleMime(handler->GetMimeType()))
+        {
+            wxMemoryOutputStream save_stream;
+
+            // Maximize compression
+            image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_LEVEL, 9);
+            image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_MEM_LEVEL, 9);
+            image.SaveFile(save_stream, "image/png");
+
+            const auto* read_stream = save_stream.GetOutputStreamBuffer();
+            if (read_stream->GetBufferSize() <= source.size())
+            {
+                result.type = wxBITMAP_TYPE_PNG;
+                result.array_size = read_stream->GetBufferSize();
+                result.array_data.resize(result.array_size);
+                std::memcpy(result.array_data.data(), read_stream->GetBufferStart(),
+                            result.array_size);
+                return result;
+            }
+        }
+
+        result.type = handler->GetType();
+        result.array_size = source.size();
+        result.array_data.assign(source.begin(), source.end());
+        return result;
+    }
+
+    return result;
+}
+
+auto image_encoder::EncodeSvg(std::span<const unsigned char> source, const wxue::string& path)
+    -> EncodedImage
+{
+    EncodedImage result;
+
+    // Run the file through an XML parser so that we can remove content that isn't used, as well as
+    // removing line breaks, leading spaces, etc.
+    pugi::xml_document doc;
+    if (auto parse_result = doc.load_buffer(source.data(), source.size()); !parse_result)
+    {
+        result.error = parse_result.detailed_msg;
+        return result;
+    }
+
+    // The InkScape program adds a lot of extra stuff that is not used when rendering the SVG.
+
+    auto root = doc.first_child();  // this should be the <svg> element.
+    if (root.name() == "svg")
+    {
+        root.remove_attribute("inkscape:version");
+        root.remove_attribute("sodipodi:docname");
+        root.remove_attribute("xml:space");
+        root.remove_attribute("xmlns");
+        root.remove_attribute("xmlns:inkscape");
+        root.remove_attribute("xmlns:sodipodi");
+        root.remove_attribute("xmlns:svg");
+        root.remove_attribute("xmlns:xlink");
+    }
+
+    // Remove some inkscape nodes that we don't need
+    root.remove_child("sodipodi:namedview");
+    root.remove_child("metadata");
+    root.remove_child("title");
+
+    std::ostringstream xml_stream;
+    doc.save(xml_stream, "", pugi::format_raw | pugi::format_no_declaration);
+    const std::string str = xml_stream.str();
+
+    // Include the trailing zero -- we need to read this back as a string, not a data array
+    wxMemoryInputStream stream(str.c_str(), str.size() + 1);
+    if (!CompressInto(stream, result))
+    {
+        return result;
+    }
+    result.type = wxBITMAP_TYPE_SVG;
+
+    // We don't actually use this size, but we set it here just in case we want it later.
+    if (auto width_attribute = root.attribute("width"); width_attribute)
+    {
+        result.size.x = width_attribute.as_int();
+        if (auto height_attribute = root.attribute("height"); height_attribute)
+        {
+            result.size.y = height_attribute.as_int();
+        }
+    }
+    else if (auto viewBox_attribute = root.attribute("viewBox"); viewBox_attribute)
+    {
+        wxue::StringVector parts(viewBox_attribute.as_sview(), ' ', wxue::TRIM::left);
+        if (parts.size() == 4)
+        {
+            result.size.x = parts[2].atoi();
+            result.size.y = parts[3].atoi();
+        }
+    }
+
+    while (result.size.x > 256 || result.size.y > 256)
+    {
+        result.size.x /= 2;
+        result.size.y /= 2;
+    }
+
+#if defined(_DEBUG)
+    const uint64_t compressed_size = result.array_size & 0xFFFFFFFF;
+    int percent = 0;
+    const uint64_t original_size = source.size();
+    if (compressed_size > 0 && original_size >= compressed_size)
+    {
+        const uint64_t ratio = original_size / compressed_size;
+        percent = (100 - (100 / static_cast<int>(ratio)));
+    }
+    const std::string size_comparison =
+        std::format(std::locale(""), "{} -- Original: {:L}, compressed: {:L}, {} percent",
+                    path.filename().ToStdString(), original_size, compressed_size, percent);
+    // Enable line below to show results for every file
+    // MSG_INFO(size_comparison)
+#else
+    std::ignore = path;
+#endif
+
+    return result;
+}
+
+auto image_encoder::EncodeXpm(std::span<const unsigned char> source) -> EncodedImage
+{
+    EncodedImage result;
+    wxMemoryInputStream stream(source.data(), source.size());
+
+    wxImage image;
+    if (!image.LoadFile(stream, wxBITMAP_TYPE_XPM))
+    {
+        return result;
+    }
+    result.size = image.GetSize();
+
+    stream.SeekI(0);
+    if (!CompressInto(stream, result))
+    {
+        // TODO: [KeyWorks - 03-16-2022] This would be really bad, though it should be impossible
+        return result;
+    }
+    result.type = wxBITMAP_TYPE_XPM;
+
+    return result;
+}
@@ -0,0 +1,70 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Decode and compress image files for EmbeddedImage
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// These functions do the expensive part of embedding an image -- reading the file, decoding it,
+// and then either re-encoding it as a PNG or cleaning up and zlib-compressing SVG and XPM files.
+// They don't touch ImageHandler, the project, or any UI, so they can be run on a worker thread.
+// ImageHandler uses the result to fill in the ImageInfo of an EmbeddedImage.
+//
+// Encode() consults image_cache first, so a file whose contents have been encoded before (in
+// any session, from any project) is never decoded or compressed again.
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <wx/bitmap.h>  // wxBitmapType
+#include <wx/gdicmn.h>  // wxSize
+
+#include "wxue_namespace/wxue_string.h"  // wxue::string
+
+enum class ImageEncoding : std::uint8_t
+{
+    raster,  // any format wxImage can read -- converted to PNG if that is smaller
+    svg,
+    xpm,
+};
+
+struct EncodedImage
+{
+    // Same layout as ImageInfo::array_data and ImageInfo::array_size
+    std::vector<unsigned char> array_data;
+    uint64_t array_size { 0 };
+
+    wxBitmapType type { wxBITMAP_TYPE_INVALID };
+
+    // Dimensions of the decoded image. For SVG files this is the size specified in the file,
+    // reduced to no more than 256 pixels.
+    wxSize size { -1, -1 };
+
+    // If the file could not be read, was empty or could not be parsed, this contains the reason.
+    // It is only left empty if a valid file could not be compressed.
+    std::string error;
+
+    [[nodiscard]] auto is_ok() const -> bool { return type != wxBITMAP_TYPE_INVALID; }
+};
+
+namespace image_encoder
+{
+    // Reads path and encodes it, returning a copy from image_cache if the same file contents
+    // have been encoded before.
+    [[nodiscard]] auto Encode(const wxue::string& path, ImageEncoding encoding) -> EncodedImage;
+
+    // Reads the entire file into source
+    [[nodiscard]] auto ReadSource(const wxue::string& path, std::vector<unsigned char>& source)
+        -> bool;
+
+    // These encode the contents of a file that has already been read. path is only used for
+    // diagnostic messages.
+    [[nodiscard]] auto EncodeRaster(std::span<const unsigned char> source) -> EncodedImage;
+    [[nodiscard]] auto EncodeSvg(std::span<const unsigned char> source, const wxue::string& path)
+        -> EncodedImage;
+    [[nodiscard]] auto EncodeXpm(std::span<const unsigned char> source) -> EncodedImage;
+}  // namespace image_encoder
@@ -15,10 +15,12 @@
 #include <vector>
 
 #include <wx/animate.h>   // wxAnimation and wxAnimationCtrl
+#include <wx/app.h>       // wxAppBase class
 #include <wx/artprov.h>   // wxArtProvider class
 #include <wx/dirdlg.h>    // wxDirDialog base class
 #include <wx/filename.h>  // wxFileName - encapsulates a file path
 #include <wx/mstream.h>   // Memory stream classes
+#include <wx/thread.h>    // wxThread::IsMain()
 #include <wx/wfstream.h>  // File stream classes
 #include <wx/zstream.h>   // zlib stream classes
 
@@ -26,6 +28,7 @@
 
 #include "bitmaps.h"                          // Contains various images handling functions
 #include "mainframe.h"                        // MainFrame -- Main window frame
+#include "mockup_parent.h"                    // MockupParent -- Top-level MockUp Parent window
 #include "node.h"                             // Node class
 #include "project_handler.h"                  // ProjectHandler -- Project class
 #include "pugixml.hpp"                        // xml parser
@@ -41,6 +44,23 @@ namespace wxue_img
     extern const unsigned char pulsing_unknown_gif[377];
 }
 
+namespace
+{
+    // Image paths in a project are relative to the project file. Files are read through the
+    // returned path rather than by changing the working directory, which every thread shares.
+    auto ProjectFile(wxue::string_view path) -> wxue::string
+    {
+        wxFileName filename(path.wx());
+        filename.MakeAbsolute(Project.get_ProjectPath().wx());
+        return filename.GetFullPath().utf8_string();
+    }
+
+    auto ProjectFileExists(wxue::string_view path) -> bool
+    {
+        return ProjectFile(path).file_exists();
+    }
+}  // namespace
+
 wxue::string ImageHandler::ConvertToLookup(const wxue::string& description)
 {
     wxue::ViewVector parts(description, ';', wxue::TRIM::both);
@@ -67,10 +87,62 @@ void ImageHandler::Initialize(NodeSharedPtr project, bool allow_ui)
     m_bundles.clear();
     m_images.clear();
     m_map_embedded.clear();
+    ClearQueuedImages();
+    m_bundles_pending = false;
+    m_placeholder_shown = false;
+}
+
+void ImageHandler::DeferCollectBundles()
+{
+    // Without a UI there is nothing to keep responsive, so collect now rather than making the
+    // first code generation worker wait for it.
+    if (!m_allow_ui)
+    {
+        CollectBundles();
+        return;
+    }
+
+    m_bundles_pending = true;
+
+    // Start decoding the images now so that most of them are ready by the time they are needed
+    QueueProjectImages();
+
+    wxTheApp->CallAfter(
+        [this]
+        {
+            EnsureBundlesCollected();
+        });
+}
+
+void ImageHandler::EnsureBundlesCollected()
+{
+    if (!m_bundles_pending.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    if (!wxThread::IsMain())
+    {
+        // CollectBundles() can show a busy cursor and error dialogs, so a worker never runs it.
+        std::unique_lock lock(m_collect_mutex);
+        m_collect_cv.wait(lock,
+                          [this]
+                          {
+                              return !m_bundles_pending.load(std::memory_order_acquire);
+                          });
+        return;
+    }
+
+    if (!m_collecting)
+    {
+        CollectBundles();
+    }
 }
 
 bool ImageHandler::UpdateEmbedNodes()
 {
+    EnsureBundlesCollected();
+
     bool is_changed = false;
     std::vector<Node*> forms;
     Project.CollectForms(forms);
@@ -87,6 +159,8 @@ bool ImageHandler::UpdateEmbedNodes()
 
 EmbeddedImage* ImageHandler::FindEmbedded(std::string_view filename)
 {
+    EnsureBundlesCollected();
+
     if (auto result = m_map_embedded.find(filename); result != m_map_embedded.end())
     {
         return result->second.get();
@@ -224,6 +298,8 @@ bool ImageHandler::AddNewEmbeddedBundle(const wxue::string& description, std::st
 // Primary caller is ProcessBundleProperty() for retrieving all the images in a bundle.
 wxImage ImageHandler::GetPropertyBitmap(const wxue::StringVector* parts, bool check_image)
 {
+    EnsureBundlesCollected();
+
     if (parts->size() <= IndexImage || (*parts)[IndexImage].empty())
     {
         return GetInternalImage("unknown");
@@ -258,7 +334,7 @@ wxImage ImageHandler::GetPropertyBitmap(const wxue::StringVector* parts, bool ch
     }
     else if ((*parts)[IndexType].contains("Embed"))
     {
-        if (!path.file_exists())
+        if (!ProjectFileExists(path))
         {
             path = m_project_node->as_string(prop_art_directory);
             path.append_filename((*parts)[IndexImage]);
@@ -284,7 +360,7 @@ wxImage ImageHandler::GetPropertyBitmap(const wxue::StringVector* parts, bool ch
     }
     else
     {
-        if (!path.file_exists())
+        if (!ProjectFileExists(path))
         {
             path = m_project_node->as_string(prop_art_directory);
             path.append_filename((*parts)[IndexImage]);
@@ -299,12 +375,12 @@ wxImage ImageHandler::GetPropertyBitmap(const wxue::StringVector* parts, bool ch
         {
             if (path.has_extension(".h_img") || path.has_extension(".h"))
             {
-                image = GetHeaderImage(path);
+                image = GetHeaderImage(ProjectFile(path));
             }
             else
             {
                 // Note that this will load an XPM file
-                image.LoadFile(path);
+                image.LoadFile(ProjectFile(path));
             }
         }
     }
@@ -327,6 +403,8 @@ wxImage ImageHandler::GetPropertyBitmap(const wxue::StringVector* parts, bool ch
 
 EmbeddedImage* ImageHandler::GetEmbeddedImage(wxue::string_view path)
 {
+    EnsureBundlesCollected();
+
     if (auto result = m_map_embedded.find(path.filename()); result != m_map_embedded.end())
     {
         return result->second.get();
@@ -339,13 +417,15 @@ EmbeddedImage* ImageHandler::GetEmbeddedImage(wxue::string_view path)
 // found that was not previously loaded.
 bool ImageHandler::AddEmbeddedImage(wxue::string path, Node* form, bool is_animation)
 {
-    if (!path.file_exists())
+    EnsureBundlesCollected();
+
+    if (!ProjectFileExists(path))
     {
         if (m_project_node->HasValue(prop_art_directory))
         {
             wxue::string art_path = m_project_node->as_string(prop_art_directory);
             art_path.append_filename(path);
-            if (!art_path.file_exists())
+            if (!ProjectFileExists(art_path))
             {
                 return false;
             }
@@ -375,12 +455,12 @@ bool ImageHandler::AddEmbeddedImage(wxue::string path, Node* form, bool is_anima
         if (path.contains("_16x16."))
         {
             std::ignore = path.Replace("_16x16.", "_24x24.");
-            if (path.file_exists())
+            if (ProjectFileExists(path))
             {
                 std::ignore = AddNewEmbeddedImage(path, form);
             }
             std::ignore = path.Replace("_24x24.", "_32x32.");
-            if (path.file_exists())
+            if (ProjectFileExists(path))
             {
                 std::ignore = AddNewEmbeddedImage(path, form);
             }
@@ -388,12 +468,12 @@ bool ImageHandler::AddEmbeddedImage(wxue::string path, Node* form, bool is_anima
         else if (path.contains("_24x24."))
         {
             std::ignore = path.Replace("_24x24.", "_36x36.");
-            if (path.file_exists())
+            if (ProjectFileExists(path))
             {
                 std::ignore = AddNewEmbeddedImage(path, form);
             }
             std::ignore = path.Replace("_36x36.", "_48x48.");
-            if (path.file_exists())
+            if (ProjectFileExists(path))
             {
                 std::ignore = AddNewEmbeddedImage(path, form);
             }
@@ -401,22 +481,22 @@ bool ImageHandler::AddEmbeddedImage(wxue::string path, Node* form, bool is_anima
         else
         {
             path.insert(pos, "_1_25x");
-            if (path.file_exists())
+            if (ProjectFileExists(path))
             {
                 std::ignore = AddNewEmbeddedImage(path, form);
             }
             std::ignore = path.Replace("_1_25x", "_1_5x");
-            if (path.file_exists())
+            if (ProjectFileExists(path))
             {
                 std::ignore = AddNewEmbeddedImage(path, form);
             }
             std::ignore = path.Replace("_1_5x", "_1_75x");
-            if (path.file_exists())
+            if (ProjectFileExists(path))
             {
                 std::ignore = AddNewEmbeddedImage(path, form);
             }
             std::ignore = path.Replace("_1_75x", "_2x");
-            if (path.file_exists())
+            if (ProjectFileExists(path))
             {
                 std::ignore = AddNewEmbeddedImage(path, form);
             }
@@ -428,111 +508,232 @@ bool ImageHandler::AddEmbeddedImage(wxue::string path, Node* form, bool is_anima
 
 bool ImageHandler::AddNewEmbeddedImage(const wxue::string& path, Node* form)
 {
-    wxFFileInputStream stream(path.wx());
-    if (!stream.IsOk())
+    auto encoded = GetEncodedImage(path, ImageEncoding::raster);
+    if (!encoded.is_ok())
     {
         return false;
     }
 
-    wxImageHandler* handler = nullptr;
-    const wxList& list = wxImage::GetHandlers();
-    for (wxList::compatibility_iterator node = list.GetFirst(); node; node = node->GetNext())
+    StoreEncodedImage(encoded, CreateEmbeddedImage(path, form)->base_image());
+    return true;
+}
+
+// This gets called whenever a project is loaded or imported.
+void ImageHandler::CollectBundles()
+{
+    ASSERT_MSG(wxThread::IsMain(), "Bundles must only be collected on the main thread")
+    m_collecting = true;
+
+    if (m_allow_ui)
     {
-        handler = dynamic_cast<wxImageHandler*>(node->GetData());
-        if (handler->CanRead(stream))
+        const wxBusyCursor wait;
+    }
+
+    QueueProjectImages();
+
+    std::vector<Node*> forms;
+    Project.CollectForms(forms);
+
+    for (const auto& form: forms)
+    {
+        CollectNodeBundles(form, form);
+
+        if (form->HasProp(prop_icon) && form->HasValue(prop_icon))
         {
-            wxImage image;
-            if (handler->LoadFile(&image, stream))
+            if (!m_bundles.contains(ConvertToLookup(form->as_string(prop_icon))))
             {
-                const wxue::string filename = path.filename().as_str();
-                m_map_embedded[filename] = std::make_unique<EmbeddedImage>(path, form);
-                auto* embed = m_map_embedded[filename].get();
+                ProcessBundleProperty(form->as_string(prop_icon), form);
+            }
+        }
+    }
+
+    // Anything left over was a variant filename that turned out not to be part of a bundle
+    ClearQueuedImages();
+
+    // Only cleared now so that workers keep waiting in EnsureBundlesCollected() until the
+    // bundle maps are complete.
+    m_collecting = false;
+    {
+        const std::scoped_lock lock(m_collect_mutex);
+        m_bundles_pending.store(false, std::memory_order_release);
+    }
+    m_collect_cv.notify_all();
 
-                // If possible, convert the file to a PNG -- even if the original file is a PNG,
-                // since we might end up with better compression.
+    if (m_placeholder_shown.exchange(false))
+    {
 
-                if (isConvertibleMime(handler->GetMimeType()))
+        // This can be called while the mockup is being created, so the mockup can't be rebuilt
+        // until that has finished.
+        wxTheApp->CallAfter(
+            []
+            {
+                if (auto* mockup = wxGetFrame().getMockup(); mockup)
                 {
-                    embed->base_image().type = wxBITMAP_TYPE_PNG;
+                    mockup->CreateContent();
+                }
+            });
+    }
+}
 
-                    wxMemoryOutputStream save_stream;
+void ImageHandler::QueueProjectImages()
+{
+    std::vector<Node*> forms;
+    Project.CollectForms(forms);
+    for (const auto& form: forms)
+    {
+        QueueNodeImages(form);
+    }
+}
 
-                    // Maximize compression
-                    image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_LEVEL, 9);
-                    image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_MEM_LEVEL, 9);
-                    image.SaveFile(save_stream, "image/png");
+void ImageHandler::QueueNodeImages(Node* node)
+{
+    for (auto& iter: node->get_PropsVector())
+    {
+        if (!iter.HasValue() || (iter.type() != type_image && iter.type() != type_animation))
+        {
+            continue;
+        }
 
-                    auto* read_stream = save_stream.GetOutputStreamBuffer();
-                    stream.SeekI(0);
-                    if (read_stream->GetBufferSize() <= (to_size_t) stream.GetLength())
-                    {
-                        embed->base_image().array_size = read_stream->GetBufferSize();
-                        embed->base_image().array_data.resize(embed->base_image().array_size);
-                        memcpy(embed->base_image().array_data.data(), read_stream->GetBufferStart(),
-                               embed->base_image().array_size);
-                    }
-                    else
-                    {
-#if defined(_DEBUG)
-                        const size_t org_size = (to_size_t) stream.GetLength();
-                        const size_t png_size = read_stream->GetBufferSize();
-                        const std::string size_comparison = std::format(
-                            std::locale(""), "Original: {:L}, new: {:L}", org_size, png_size);
-                        std::ignore = size_comparison;
-#endif  // _DEBUG
-
-                        embed->base_image().type = handler->GetType();
-                        embed->base_image().array_size = stream.GetSize();
-                        embed->base_image().array_data.resize(embed->base_image().array_size);
-                        stream.Read(embed->base_image().array_data.data(),
-                                    embed->base_image().array_size);
-                    }
-                }
-                else
-                {
-                    embed->base_image().type = handler->GetType();
+        wxue::StringVector parts(iter.as_string(), BMP_PROP_SEPARATOR, wxue::TRIM::both);
+        if (parts.size() <= IndexImage || parts[IndexImage].empty())
+        {
+            continue;
+        }
 
-                    stream.SeekI(0);
-                    embed->base_image().array_size = stream.GetSize();
-                    embed->base_image().array_data.resize(embed->base_image().array_size);
-                    stream.Read(embed->base_image().array_data.data(),
-                                embed->base_image().array_size);
-                }
+        wxue::string path = parts[IndexImage];
+        if (!ResolveBundlePath(path))
+        {
+            continue;
+        }
 
-                return true;
+        if (parts[IndexType].starts_with("SVG"))
+        {
+            QueueImage(path, ImageEncoding::svg);
+        }
+        else if (parts[IndexType].starts_with("XPM"))
+        {
+            QueueImage(path, ImageEncoding::xpm);
+        }
+        else if (parts[IndexType].starts_with("Embed"))
+        {
+            QueueImage(path, ImageEncoding::raster);
+            if (iter.type() == type_image)
+            {
+                QueueBundleVariants(path);
             }
         }
     }
 
-    return false;
+    for (const auto& child: node->get_ChildNodePtrs())
+    {
+        QueueNodeImages(child.get());
+    }
 }
 
-// This gets called whenever a project is loaded or imported.
-void ImageHandler::CollectBundles()
+// Queues every file that AddFixedSizeBundleVariants() or AddScalableBundleVariants() might add
+// to the bundle for path.
+void ImageHandler::QueueBundleVariants(const wxue::string& path)
 {
-    if (m_allow_ui)
+    auto queue_if_exists = [this](const wxue::string& variant)
     {
-        const wxBusyCursor wait;
+        if (ProjectFileExists(variant))
+        {
+            QueueImage(variant, ImageEncoding::raster);
+        }
+    };
+
+    wxue::string variant(path);
+    if (path.contains("_16x16."))
+    {
+        std::ignore = variant.Replace("_16x16.", "_24x24.");
+        queue_if_exists(variant);
+        std::ignore = variant.Replace("_24x24.", "_32x32.");
+        queue_if_exists(variant);
+        return;
+    }
+    if (path.contains("_24x24."))
+    {
+        std::ignore = variant.Replace("_24x24.", "_36x36.");
+        queue_if_exists(variant);
+        std::ignore = variant.Replace("_36x36.", "_48x48.");
+        queue_if_exists(variant);
+        return;
+    }
+
+    const wxue::string extension(path.extension());
+    wxue::string stem(path);
+    stem.remove_extension();
+    for (const auto* suffix: suffixes)
+    {
+        if (stem.ends_with(suffix))
+        {
+            stem.erase(stem.size() - std::char_traits<char>::length(suffix));
+            break;
+        }
+    }
+    for (const auto* suffix: suffixes)
+    {
+        variant = stem;
+        variant << suffix << extension;
+        queue_if_exists(variant);
     }
+}
 
-    const wxue::SaveCwd save_cwd(wxue::restore_cwd);
-    Project.get_ProjectPath().ChangeDir();
+void ImageHandler::QueueImage(const wxue::string& path, ImageEncoding encoding)
+{
+    const auto filename = path.filename();
+    if (m_queued_images.contains(filename) || m_map_embedded.contains(filename))
+    {
+        return;
+    }
 
-    std::vector<Node*> forms;
-    Project.CollectForms(forms);
+    QueuedImage queued;
+    queued.path = ProjectFile(path);
+    queued.encoding = encoding;
+    queued.result = std::make_shared<EncodedImage>();
+    queued.task = BackgroundTasks.Submit("EncodeImage",
+                                         [path = queued.path, encoding, result = queued.result]
+                                         {
+                                             *result = image_encoder::Encode(path, encoding);
+                                         });
+    m_queued_images.emplace(filename, std::move(queued));
+}
 
-    for (const auto& form: forms)
+void ImageHandler::ClearQueuedImages()
+{
+    for (auto& [filename, queued]: m_queued_images)
     {
-        CollectNodeBundles(form, form);
+        queued.task.detach();
+    }
+    m_queued_images.clear();
+}
 
-        if (form->HasProp(prop_icon) && form->HasValue(prop_icon))
+auto ImageHandler::GetEncodedImage(const wxue::string& path, ImageEncoding encoding)
+    -> EncodedImage
+{
+    if (auto found = m_queued_images.find(path.filename()); found != m_queued_images.end())
+    {
+        auto& queued = found->second;
+        if (queued.encoding == encoding && queued.path == ProjectFile(path))
         {
-            if (!m_bundles.contains(ConvertToLookup(form->as_string(prop_icon))))
+            if (queued.task.joinable())
             {
-                ProcessBundleProperty(form->as_string(prop_icon), form);
+                queued.task.join();
             }
+
+            // The entry is kept rather than moved since AddEmbeddedBundleImage() can ask for the
+            // same file twice.
+            return *queued.result;
         }
     }
+    return image_encoder::Encode(ProjectFile(path), encoding);
+}
+
+void ImageHandler::StoreEncodedImage(const EncodedImage& encoded, ImageInfo& image_info)
+{
+    image_info.type = encoded.type;
+    image_info.array_size = encoded.array_size;
+    image_info.array_data = encoded.array_data;
 }
 
 void ImageHandler::CollectNodeBundles(Node* node, Node* form)
@@ -655,7 +856,7 @@ bool ImageHandler::AddNewEmbeddedBundle(const wxue::StringVector* parts, std::st
 
 bool ImageHandler::ResolveBundlePath(wxue::string& path)
 {
-    if (path.file_exists())
+    if (ProjectFileExists(path))
     {
         return true;
     }
@@ -667,7 +868,7 @@ bool ImageHandler::ResolveBundlePath(wxue::string& path)
 
     wxue::string art_path = m_project_node->as_string(prop_art_directory);
     art_path.append_filename(path);
-    if (!art_path.file_exists())
+    if (!ProjectFileExists(art_path))
     {
         return false;
     }
@@ -682,7 +883,7 @@ void ImageHandler::AddFixedSizeBundleVariants(wxue::string& path, Node* form, Em
     if (path.contains("_16x16."))
     {
         std::ignore = path.Replace("_16x16.", "_24x24.");
-        if (path.file_exists())
+        if (ProjectFileExists(path))
         {
             if (auto* added = AddEmbeddedBundleImage(path, form, embed); added)
             {
@@ -690,7 +891,7 @@ void ImageHandler::AddFixedSizeBundleVariants(wxue::string& path, Node* form, Em
             }
         }
         std::ignore = path.Replace("_24x24.", "_32x32.");
-        if (path.file_exists())
+        if (ProjectFileExists(path))
         {
             if (auto* added = AddEmbeddedBundleImage(path, form, embed); added)
             {
@@ -701,7 +902,7 @@ void ImageHandler::AddFixedSizeBundleVariants(wxue::string& path, Node* form, Em
     else if (path.contains("_24x24."))
     {
         std::ignore = path.Replace("_24x24.", "_36x36.");
-        if (path.file_exists())
+        if (ProjectFileExists(path))
         {
             if (auto* added = AddEmbeddedBundleImage(path, form, embed); added)
             {
@@ -709,7 +910,7 @@ void ImageHandler::AddFixedSizeBundleVariants(wxue::string& path, Node* form, Em
             }
         }
         std::ignore = path.Replace("_36x36.", "_48x48.");
-        if (path.file_exists())
+        if (ProjectFileExists(path))
         {
             if (auto* added = AddEmbeddedBundleImage(path, form, embed); added)
             {
@@ -747,7 +948,7 @@ void ImageHandler::AddScalableBundleVariants(wxue::string& path, Node* form, Emb
                 additional_path.erase(erase_pos);
             }
             additional_path << map_pos->first << file_extension;
-            if (additional_path.file_exists())
+            if (ProjectFileExists(additional_path))
             {
                 if (auto* added = AddEmbeddedBundleImage(additional_path, form, embed); added)
                 {
@@ -765,7 +966,7 @@ void ImageHandler::AddScalableBundleVariants(wxue::string& path, Node* form, Emb
         // If we have a map position, then we have found a suffix, so we now try to find the
         // next matching filename.
         std::ignore = additional_path.Replace(map_pos->first, map_pos->second);
-        if (additional_path.file_exists())
+        if (ProjectFileExists(additional_path))
         {
             if (auto* added = AddEmbeddedBundleImage(additional_path, form, embed); added)
             {
@@ -786,122 +987,56 @@ void ImageHandler::AddScalableBundleVariants(wxue::string& path, Node* form, Emb
 EmbeddedImage* ImageHandler::AddEmbeddedBundleImage(wxue::string& path, Node* form,
                                                     EmbeddedImage* embed)
 {
-    wxFFileInputStream stream(path.wx());
-    if (!stream.IsOk())
+    auto encoded = GetEncodedImage(path, ImageEncoding::raster);
+    if (!encoded.is_ok())
     {
         return nullptr;
     }
-    wxImageHandler* handler = nullptr;
-    const wxList& list = wxImage::GetHandlers();
-    for (wxList::compatibility_iterator node = list.GetFirst(); node; node = node->GetNext())
+
+    if (embed)
+    {
+        embed->add_ImageInfo();
+    }
+    const size_t idx = embed ? embed->get_ImageInfos().size() - 1 : 0;
+    if (!embed)
+    {
+        embed = CreateEmbeddedImage(path, form);
+        embed->set_wxSize(encoded.size);
+    }
+    else if (idx != 0)
     {
-        handler = dynamic_cast<wxImageHandler*>(node->GetData());
-        if (handler->CanRead(stream))
+        embed->get_ImageInfo(idx).filename = path;
+        embed->get_ImageInfo(idx).file_time = ProjectFile(path).last_write_time();
+        if (auto result = FileNameToVarName(path.filename()); result)
         {
-            wxImage image;
-            if (handler->LoadFile(&image, stream))
-            {
-                if (embed)
-                {
-                    embed->add_ImageInfo();
-                }
-                const size_t idx = embed ? embed->get_ImageInfos().size() - 1 : 0;
-                if (!embed)
-                {
-                    m_map_embedded[path.filename().as_str()] =
-                        std::make_unique<EmbeddedImage>(path, form);
-                    embed = m_map_embedded[path.filename().as_str()].get();
-                    embed->SetEmbedSize(image);
-                }
-                else if (idx != 0)
-                {
-                    embed->get_ImageInfo(idx).filename = path;
-                    embed->get_ImageInfo(idx).file_time =
-                        embed->get_ImageInfo(idx).filename.last_write_time();
-                    if (auto result = FileNameToVarName(path.filename()); result)
-                    {
-                        embed->get_ImageInfo(idx).array_name = result.value();
-                    }
-                    else
-                    {
-                        embed->get_ImageInfo(idx).array_name = embed->base_image().array_name;
-                        embed->get_ImageInfo(idx).array_name << "_" << idx;
-                    }
-                }
-
-                // If possible, convert the file to a PNG -- even if the original file is a PNG,
-                // since we might end up with better compression.
-
-                if (isConvertibleMime(handler->GetMimeType()))
-                {
-                    embed->get_ImageInfo(idx).type = wxBITMAP_TYPE_PNG;
-
-                    wxMemoryOutputStream save_stream;
-
-                    // Maximize compression
-                    image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_LEVEL, 9);
-                    image.SetOption(wxIMAGE_OPTION_PNG_COMPRESSION_MEM_LEVEL, 9);
-                    image.SaveFile(save_stream, "image/png");
-
-                    auto* read_stream = save_stream.GetOutputStreamBuffer();
-                    stream.SeekI(0);
-                    if (read_stream->GetBufferSize() <= (to_size_t) stream.GetLength())
-                    {
-                        embed->get_ImageInfo(idx).array_size = read_stream->GetBufferSize();
-                        embed->get_ImageInfo(idx).array_data.resize(
-                            embed->get_ImageInfo(idx).array_size);
-                        memcpy(embed->get_ImageInfo(idx).array_data.data(),
-                               read_stream->GetBufferStart(), embed->get_ImageInfo(idx).array_size);
-                    }
-                    else
-                    {
-#if defined(_DEBUG)
-                        const size_t org_size = (to_size_t) stream.GetLength();
-                        const size_t png_size = read_stream->GetBufferSize();
-                        const std::string size_comparison = std::format(
-                            std::locale(""), "Original: {:L}, new: {:L}", org_size, png_size);
-                        std::ignore = size_comparison;
-#endif
-
-                        embed->get_ImageInfo(idx).type = handler->GetType();
-                        embed->get_ImageInfo(idx).array_size = stream.GetSize();
-                        embed->get_ImageInfo(idx).array_data.resize(
-                            embed->get_ImageInfo(idx).array_size);
-                        stream.Read(embed->get_ImageInfo(idx).array_data.data(),
-                                    embed->get_ImageInfo(idx).array_size);
-                    }
-                }
-                else
-                {
-                    embed->get_ImageInfo(idx).type = handler->GetType();
-
-                    stream.SeekI(0);
-                    embed->get_ImageInfo(idx).array_size = stream.GetSize();
-                    embed->get_ImageInfo(idx).array_data.resize(
-                        embed->get_ImageInfo(idx).array_size);
-                    stream.Read(embed->get_ImageInfo(idx).array_data.data(),
-                                embed->get_ImageInfo(idx).array_size);
-                }
+            embed->get_ImageInfo(idx).array_name = result.value();
+        }
+        else
+        {
+            embed->get_ImageInfo(idx).array_name = embed->base_image().array_name;
+            embed->get_ImageInfo(idx).array_name << "_" << idx;
+        }
+    }
 
-                // REVIEW: [Randalphwa - 03-14-2024] Recursive call ensures m_bundles entry
-                // is created for multi-image embeds. The call overwrites the entry with the
-                // EmbeddedImage from the recursive AddNewEmbeddedBundleImage, then the outer
-                // return accesses the now-populated m_bundles[lookup_str]. Safe because
-                // GetEmbeddedImage(path) in the recursive call returns the same map entry.
-                if (embed->get_ImageInfos().size() > 1)
-                {
-                    std::ignore = AddEmbeddedBundleImage(path, form);
-                }
+    StoreEncodedImage(encoded, embed->get_ImageInfo(idx));
 
-                return embed;
-            }
-        }
+    // REVIEW: [Randalphwa - 03-14-2024] Recursive call ensures m_bundles entry
+    // is created for multi-image embeds. The call overwrites the entry with the
+    // EmbeddedImage from the recursive AddNewEmbeddedBundleImage, then the outer
+    // return accesses the now-populated m_bundles[lookup_str]. Safe because
+    // GetEmbeddedImage(path) in the recursive call returns the same map entry.
+    if (embed->get_ImageInfos().size() > 1)
+    {
+        std::ignore = AddEmbeddedBundleImage(path, form);
     }
-    return nullptr;
+
+    return embed;
 }
 
 ImageBundle* ImageHandler::ProcessBundleProperty(const wxue::StringVector* parts, Node* node)
 {
+    EnsureBundlesCollected();
+
     ASSERT(parts->size() > 1)
 
     auto lookup_str = ConvertToLookup(parts);
@@ -974,7 +1109,7 @@ ImageBundle* ImageHandler::ProcessBundleProperty(const wxue::StringVector* parts
 
 bool ImageHandler::TryResolvePathWithArtDir(wxue::string& path)
 {
-    if (path.file_exists())
+    if (ProjectFileExists(path))
     {
         return true;
     }
@@ -986,7 +1121,7 @@ bool ImageHandler::TryResolvePathWithArtDir(wxue::string& path)
 
     wxue::string art_path = m_project_node->as_string(prop_art_directory);
     art_path.append_filename(path);
-    if (art_path.file_exists())
+    if (ProjectFileExists(art_path))
     {
         path = art_path;
         return true;
@@ -1009,7 +1144,7 @@ void ImageHandler::AddNonEmbeddedFixedSizeVariants(const wxue::StringVector* par
 
         // Note that path may now contain the prop_art_directory prefix
         path.Replace("_24x24.", "_32x32.");
-        if (path.file_exists())
+        if (ProjectFileExists(path))
         {
             img_bundle.lst_filenames.emplace_back(path);
         }
@@ -1025,7 +1160,7 @@ void ImageHandler::AddNonEmbeddedFixedSizeVariants(const wxue::StringVector* par
 
         // Note that path may now contain the prop_art_directory prefix
         path.Replace("_36x36.", "_48x48.");
-        if (path.file_exists())
+        if (ProjectFileExists(path))
         {
             img_bundle.lst_filenames.emplace_back(path);
         }
@@ -1050,6 +1185,8 @@ void ImageHandler::AddNonEmbeddedScalableVariants(const wxue::StringVector* part
 
 void ImageHandler::UpdateBundle(const wxue::StringVector* parts, Node* node)
 {
+    EnsureBundlesCollected();
+
     if (parts->size() < 2 || node->is_FormParent())
     {
         return;
@@ -1092,6 +1229,16 @@ wxBitmapBundle ImageHandler::GetPropertyBitmapBundle(wxue::string_view descripti
         return wxue_img::bundle_unknown_svg(32, 32);
     }
 
+    // Until the project's images have been collected, the UI gets a placeholder rather than
+    // waiting for every image to be decoded. CollectBundles() rebuilds the mockup once they
+    // are ready.
+    if (m_bundles_pending && m_allow_ui && !parts[IndexType].contains("Art"))
+    {
+        m_placeholder_shown = true;
+        return wxue_img::bundle_unknown_svg(32, 32);
+    }
+    EnsureBundlesCollected();
+
     if (auto* embed = FindEmbedded(parts[IndexImage].filename()); embed)
     {
         return embed->get_bundle(parts.size() > 2 ? GetSizeInfo(parts[IndexSize]) : wxDefaultSize);
@@ -1120,6 +1267,8 @@ wxBitmapBundle ImageHandler::GetPropertyBitmapBundle(wxue::string_view descripti
 
 const ImageBundle* ImageHandler::GetPropertyImageBundle(const wxue::StringVector* parts, Node* node)
 {
+    EnsureBundlesCollected();
+
     if (parts->size() < 2)
     {
         return nullptr;
@@ -1139,6 +1288,8 @@ const ImageBundle* ImageHandler::GetPropertyImageBundle(const wxue::StringVector
 
 void ImageHandler::GetPropertyAnimation(const wxue::string& description, wxAnimation* p_animation)
 {
+    EnsureBundlesCollected();
+
     wxue::ViewVector parts(description, BMP_PROP_SEPARATOR, wxue::TRIM::both);
 
     if (parts.size() <= IndexImage || parts[IndexImage].empty())
@@ -1150,7 +1301,7 @@ void ImageHandler::GetPropertyAnimation(const wxue::string& description, wxAnima
     }
 
     wxue::string path = parts[IndexImage];
-    if (!path.file_exists())
+    if (!ProjectFileExists(path))
     {
         if (path == Project.as_string(prop_art_directory))
         {
@@ -1185,14 +1336,18 @@ void ImageHandler::GetPropertyAnimation(const wxue::string& description, wxAnima
 
 bool ImageHandler::AddSvgBundleImage(wxue::string& path, Node* form)
 {
-    // Run the file through an XML parser so that we can remove content that isn't used, as well as
-    // removing line breaks, leading spaces, etc.
-    pugi::xml_document doc;
-    if (auto result = doc.load_file_string(path); !result)
+    auto encoded = GetEncodedImage(path, ImageEncoding::svg);
+    if (!encoded.is_ok())
     {
-        if (!wxGetApp().is_Generating())
+        // Encode() reports unreadable, empty and unparsable files in error, so an empty error
+        // means that compressing a valid file failed.
+        if (encoded.error.empty())
+        {
+            FAIL_MSG(wxue::string() << "Failed to copy stream data");
+        }
+        else if (!wxGetApp().is_Generating())
         {
-            wxMessageDialog(wxGetMainFrame()->getWindow(), result.detailed_msg, "Parsing Error",
+            wxMessageDialog(wxGetMainFrame()->getWindow(), encoded.error, "Parsing Error",
                             wxOK | wxICON_ERROR)
                 .ShowModal();
         }
@@ -1200,152 +1355,45 @@ bool ImageHandler::AddSvgBundleImage(wxue::string& path, Node* form)
         {
             wxGetApp().get_CmdLineLog().emplace_back(std::string("Error parsing '") +
                                                      path.filename().ToStdString() +
-                                                     "': " + result.detailed_msg);
+                                                     "': " + encoded.error);
         }
         return false;
     }
 
-    // The InkScape program adds a lot of extra stuff that is not used when rendering the SVG.
-
-    auto root = doc.first_child();  // this should be the <svg> element.
-    if (root.name() == "svg")
-    {
-        root.remove_attribute("inkscape:version");
-        root.remove_attribute("sodipodi:docname");
-        root.remove_attribute("xml:space");
-        root.remove_attribute("xmlns");
-        root.remove_attribute("xmlns:inkscape");
-        root.remove_attribute("xmlns:sodipodi");
-        root.remove_attribute("xmlns:svg");
-        root.remove_attribute("xmlns:xlink");
-    }
-
-    // Remove some inkscape nodes that we don't need
-    root.remove_child("sodipodi:namedview");
-    root.remove_child("metadata");
-    root.remove_child("title");
-
-    std::ostringstream xml_stream;
-    doc.save(xml_stream, "", pugi::format_raw | pugi::format_no_declaration);
-    std::string str = xml_stream.str();
-
-    // Include the trailing zero -- we need to read this back as a string, not a data array
-    wxMemoryInputStream stream(str.c_str(), str.size() + 1);
-
-    wxMemoryOutputStream memory_stream;
-    wxZlibOutputStream save_stream(memory_stream, wxZ_BEST_COMPRESSION);
-    m_map_embedded[path.filename().as_str()] = std::make_unique<EmbeddedImage>(path, form);
-    auto* embed = m_map_embedded[path.filename().as_str()].get();
-
-    uint64_t org_size = (stream.GetLength() & 0xFFFFFFFF);
-
-    if (!CopyStreamData(&stream, &save_stream, stream.GetLength()))
-    {
-        FAIL_MSG(wxue::string() << "Failed to copy stream data");
-        return false;
-    }
-    save_stream.Close();
-    auto compressed_size = static_cast<uint64_t>(memory_stream.TellO());
-
-    auto* read_stream = memory_stream.GetOutputStreamBuffer();
-    embed->base_image().type = wxBITMAP_TYPE_SVG;
-    embed->base_image().array_size = (compressed_size | (org_size << 32));
-    embed->base_image().array_data.resize(compressed_size);
-    memcpy(embed->base_image().array_data.data(), read_stream->GetBufferStart(), compressed_size);
-
-    // We don't actually use this size, but we set it here just in case we want it later.
-    wxSize size { -1, -1 };
-    if (auto width_attribute = root.attribute("width"); width_attribute)
-    {
-        size.x = width_attribute.as_int();
-        if (auto height_attribute = root.attribute("height"); height_attribute)
-        {
-            size.y = height_attribute.as_int();
-        }
-    }
-    else if (auto viewBox_attribute = root.attribute("viewBox"); viewBox_attribute)
-    {
-        wxue::StringVector parts(viewBox_attribute.as_sview(), ' ', wxue::TRIM::left);
-        if (parts.size() == 4)
-        {
-            size.x = parts[2].atoi();
-            size.y = parts[3].atoi();
-        }
-    }
-
-    while (size.x > 256 || size.y > 256)
-    {
-        size.x /= 2;
-        size.y /= 2;
-    }
-    embed->set_wxSize(size);
-
-#if defined(_DEBUG)
-    const wxFile file_original(path.wx(), wxFile::read);
-    if (file_original.IsOpened())
-    {
-        const wxFileOffset file_size = file_original.Length();
-        wxue::string size_comparison;
-        int percent = 0;
-        const auto original_size = static_cast<uint64_t>(file_size);
-        if (compressed_size > 0 && original_size >= compressed_size)
-        {
-            const uint64_t ratio = original_size / compressed_size;
-            percent = (100 - (100 / static_cast<int>(ratio)));
-        }
-        size_comparison =
-            std::format(std::locale(""), "{} -- Original: {:L}, compressed: {:L}, {} percent",
-                        path.filename().ToStdString(), file_size, compressed_size, percent);
-        // Enable line below to show results for every file
-        // MSG_INFO(size_comparison)
-    }
-#endif
+    auto* embed = CreateEmbeddedImage(path, form);
+    StoreEncodedImage(encoded, embed->base_image());
+    embed->set_wxSize(encoded.size);
 
     return true;
 }
 
-bool ImageHandler::AddXpmBundleImage(const wxue::string& path, Node* form)
+auto ImageHandler::CreateEmbeddedImage(const wxue::string& path, Node* form) -> EmbeddedImage*
 {
-    wxFFileInputStream stream(path.wx());
-    if (!stream.IsOk())
-    {
-        return false;
-    }
-    uint64_t org_size = (stream.GetLength() & 0xFFFFFFFF);
-
-    wxImage image;
-    if (!image.LoadFile(stream, wxBITMAP_TYPE_XPM))
-    {
-        return false;
-    }
-
-    m_map_embedded[path.filename().as_str()] = std::make_unique<EmbeddedImage>(path, form);
-    auto* embed = m_map_embedded[path.filename().as_str()].get();
-    embed->SetEmbedSize(image);
-
-    wxMemoryOutputStream memory_stream;
-    wxZlibOutputStream save_stream(memory_stream, wxZ_BEST_COMPRESSION);
-    stream.SeekI(0);
+    auto& embed = m_map_embedded[path.filename().as_str()];
+    embed = std::make_unique<EmbeddedImage>(path, form);
+    embed->base_image().file_time = ProjectFile(path).last_write_time();
+    return embed.get();
+}
 
-    if (!CopyStreamData(&stream, &save_stream, stream.GetLength()))
+bool ImageHandler::AddXpmBundleImage(const wxue::string& path, Node* form)
+{
+    auto encoded = GetEncodedImage(path, ImageEncoding::xpm);
+    if (!encoded.is_ok())
     {
-        // TODO: [KeyWorks - 03-16-2022] This would be really bad, though it should be impossible
         return false;
     }
-    save_stream.Close();
-    auto compressed_size = memory_stream.TellO();
 
-    auto* read_stream = memory_stream.GetOutputStreamBuffer();
-    embed->base_image().type = wxBITMAP_TYPE_XPM;
-    embed->base_image().array_size = (compressed_size | (org_size << 32));
-    embed->base_image().array_data.resize(compressed_size);
-    memcpy(embed->base_image().array_data.data(), read_stream->GetBufferStart(), compressed_size);
+    auto* embed = CreateEmbeddedImage(path, form);
+    embed->set_wxSize(encoded.size);
+    StoreEncodedImage(encoded, embed->base_image());
 
     return true;
 }
 
 wxue::string ImageHandler::GetBundleFuncName(const wxue::string& description)
 {
+    EnsureBundlesCollected();
+
     wxue::string name;
 
     for (const auto& form: Project.get_ChildNodePtrs())
@@ -1406,6 +1454,8 @@ wxue::string ImageHandler::GetBundleFuncName(const wxue::string& description)
 
 wxue::string ImageHandler::GetBundleFuncName(const wxue::StringVector* parts)
 {
+    EnsureBundlesCollected();
+
     wxue::string name;
 
     for (const auto& form: Project.get_ChildNodePtrs())
@@ -1480,6 +1530,8 @@ wxue::string ImageHandler::GetBundleFuncName(const EmbeddedImage* embed, wxSize
 
 bool ImageHandler::ArtFolderChanged()
 {
+    EnsureBundlesCollected();
+
     wxFileName path;
     path.Assign(Project.as_string(prop_art_directory));
     if (!path.DirExists())
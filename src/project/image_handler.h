@@ -25,23 +25,32 @@
 //    - SVG files: XML parsing removes metadata, zlib compression
 //    - XPM files: zlib compression
 //    - PNG files: Re-compressed if smaller than original
+//    - The decoding and compression is done by image_encoder on BackgroundTasks worker threads,
+//      queued as soon as a project is loaded. m_map_embedded and m_bundles are only ever
+//      updated on the main thread.
 //
 // 5. Form Association:
 //    - Each EmbeddedImage tracks which form node first uses it
 //    - Images List (gen_Images) nodes can contain shared embedded images
 //
 // Key Methods:
-//    - CollectBundles(): Scans entire project to build bundle maps (called on project load)
+//    - CollectBundles(): Scans entire project to build bundle maps (deferred on project load)
 //    - ProcessBundleProperty(): Creates/updates bundles for a specific property
 //    - GetPropertyBitmapBundle(): Retrieves cached bundle for UI display
 //    - AddEmbeddedImage(): Adds new image and auto-detects multi-resolution variants
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include <wx/bmpbndl.h>  // includes wx/bitmap.h, wxBitmapBundle class interface
 
 #include "embed_image.h"                        // EmbeddedImage class
+#include "image_encoder.h"                      // EncodedImage, ImageEncoding
+#include "task_pool.h"                          // PoolTask, BackgroundTasks
 #include "wxue_namespace/wxue_string.h"         // wxue::string, wxue::string_view
 #include "wxue_namespace/wxue_string_vector.h"  // wxue::StringVector
 
@@ -67,7 +76,7 @@ public:
     ImageHandler& operator=(ImageHandler const&) = delete;
     ImageHandler& operator=(ImageHandler&&) = delete;
 
-    ~ImageHandler() = default;
+    ~ImageHandler() { ClearQueuedImages(); }
 
     static ImageHandler& getInstance()
     {
@@ -133,6 +142,18 @@ public:
     // m_map_embedded for every image.
     void CollectBundles();
 
+    // Same as CollectBundles(), except that the project is scanned once the UI is idle, or
+    // sooner if anything on the main thread asks for an image before then.
+    void DeferCollectBundles();
+
+    // Collects the bundles now if DeferCollectBundles() is still waiting to. Every method that
+    // reads m_bundles, m_images or m_map_embedded calls this first.
+    //
+    // Bundles are only ever collected on the main thread -- a worker that gets here first waits
+    // for the main thread to finish. Call this on the main thread before submitting work that
+    // reads images so that no worker has to wait.
+    void EnsureBundlesCollected();
+
     // Returns nullptr if the image is not found
     EmbeddedImage* FindEmbedded(std::string_view);
 
@@ -176,6 +197,23 @@ private:
                                    ImageBundle& img_bundle);
 
     bool TryResolvePathWithArtDir(wxue::string& path);
+
+    // Adds path to m_map_embedded, reading its file time relative to the project file
+    auto CreateEmbeddedImage(const wxue::string& path, Node* form) -> EmbeddedImage*;
+
+    // The Queue* functions start decoding every image file the project embeds on BackgroundTasks.
+    // Add*Image() calls GetEncodedImage() which waits for the queued result, or encodes the file
+    // itself if it wasn't queued.
+    void QueueProjectImages();
+    void QueueNodeImages(Node* node);
+    void QueueBundleVariants(const wxue::string& path);
+    void QueueImage(const wxue::string& path, ImageEncoding encoding);
+
+    // Discards every queued image. The encoding tasks only use their own copies of the path and
+    // the shared result, so they are detached rather than waited for.
+    void ClearQueuedImages();
+    auto GetEncodedImage(const wxue::string& path, ImageEncoding encoding) -> EncodedImage;
+    static void StoreEncodedImage(const EncodedImage& encoded, ImageInfo& image_info);
     void AddNonEmbeddedFixedSizeVariants(const wxue::StringVector* parts, ImageBundle& img_bundle);
     void AddNonEmbeddedScalableVariants(const wxue::StringVector* parts, ImageBundle& img_bundle);
 
@@ -195,6 +233,33 @@ private:
 
     bool m_allow_ui { true };
 
+    // Set by DeferCollectBundles() until CollectBundles() has finished. It is only cleared with
+    // m_collect_mutex held, and m_collect_cv is notified once it is.
+    std::atomic<bool> m_bundles_pending { false };
+    std::mutex m_collect_mutex;
+    std::condition_variable m_collect_cv;
+
+    // Only accessed on the main thread. Set while CollectBundles() runs so that it doesn't
+    // recurse back into itself through EnsureBundlesCollected().
+    bool m_collecting { false };
+
+    // Set if GetPropertyBitmapBundle() returned a placeholder while m_bundles_pending was set
+    std::atomic<bool> m_placeholder_shown { false };
+
+    struct QueuedImage
+    {
+        wxue::string path;  // absolute path
+        ImageEncoding encoding;
+        PoolTask task;
+
+        // Shared with the task so that it remains valid even if the queue is cleared before
+        // the task runs.
+        std::shared_ptr<EncodedImage> result;
+    };
+
+    // std::string is path.filename()
+    std::map<std::string, QueuedImage, std::less<>> m_queued_images;
+
     static constexpr std::array<std::pair<std::string_view, std::string_view>, 6>
         map_bundle_extensions = { { { "@1_25x", "@1_5x" },
                                     { "@1_5x", "@1_75x" },
@@ -10,8 +10,11 @@
 #include <wx/stc/stc.h>   // A wxWidgets implementation of Scintilla.
 #include <wx/utils.h>     // Miscellaneous utilities
 
-#include <format>  // for std::format
-#include <tuple>   // for std::ignore
+#include <exception>  // for std::exception_ptr
+#include <format>     // for std::format
+#include <optional>
+#include <tuple>      // for std::ignore
+#include <vector>
 
 #include "wxue_namespace/wxue.h"
 #include "wxue_namespace/wxue_string.h"
@@ -24,10 +27,12 @@
 #include "image_handler.h"        // ProjectImage class
 #include "mainframe.h"            // MainFrame -- Main window frame
 #include "node.h"                 // Node class
+#include "node_arena.h"           // NodeArena -- Monotonic arena for Node allocations
 #include "node_creator.h"         // NodeCreator class
 #include "preferences.h"          // Prefs -- Set/Get wxUiEditor preferences
 #include "project_handler.h"      // ProjectHandler class
 #include "pugixml.hpp"            // pugixml parser
+#include "task_pool.h"            // TaskPool -- Process-wide task pool
 #include "version.h"              // Version information for wxUiEditor and wxWidgets
 
 #include <frozen/map.h>
@@ -179,9 +184,9 @@ bool ProjectHandler::LoadProject(const wxue::string& file, bool allow_ui)
     }
 
     // Calling this will also initialize the ImageHandler class
-    Project.Initialize(project);
+    Project.Initialize(project, allow_ui);
     Project.set_ProjectFile(file);
-    ProjectImages.CollectBundles();
+    ProjectImages.DeferCollectBundles();
 
     // Imported projects start with an older version so that they pass through the old project
     // fixups.
@@ -193,7 +198,7 @@ bool ProjectHandler::LoadProject(const wxue::string& file, bool allow_ui)
     // We need to ensure any Images List is sorted (in case it's an old project or the user
     // hand-edited the project file)
     img_list::UpdateImagesList(m_ProjectVersion);
-    FixDuplicateVarNames(allow_ui);
+    const bool is_names_fixed = FixDuplicateVarNames(allow_ui);
 
     if (allow_ui)
     {
@@ -208,6 +213,11 @@ bool ProjectHandler::LoadProject(const wxue::string& file, bool allow_ui)
         {
             wxGetFrame().setModified();
         }
+        else if (!is_names_fixed)
+        {
+            // Nothing was changed while loading, so the undo stack can use the file itself
+            wxGetFrame().getUndoStack().SetFileCheckpoint(file);
+        }
     }
     return true;
 }
@@ -425,8 +435,42 @@ static void FixupImportProperty(NodeProperty* prop, pugi::xml_attribute& iter, N
     }
 }
 
+// Worker threads can't change the project version, so when there is a load_log the update is
+// recorded there and applied by CreateProjectChildren() on the main thread.
+// Called by: CreateNodeFromXml
+static void MarkProjectUpdated(XmlLoadLog* load_log)
+{
+    if (load_log)
+    {
+        load_log->project_updated = true;
+        return;
+    }
+    Project.set_ProjectUpdated();
+    Project.ForceProjectVersion(curSupportedVer);
+}
+
+// Called by: CreateNodeFromXml, CreateProjectChildren
+static void ReportUnknownProperty(std::string_view class_name, std::string_view prop_name,
+                                  std::string_view prop_value)
+{
+    MSG_WARNING(std::format("Unrecognized property: {} in class: {}", prop_name, class_name));
+
+    wxMessageBox(wxString::Format(
+        "The property named \"%s\" of class \"%s\" is not supported by this "
+        "version of wxUiEditor.\n\n"
+        "If your project file was just converted from an older version, then the "
+        "conversion was not "
+        "complete. Otherwise, this project is from a newer version of "
+        "wxUiEditor.\n\n"
+        "The property's value is: %s\n\n"
+        "If you save this project, YOU WILL LOSE DATA",
+        std::string(prop_name).c_str(), std::string(class_name).c_str(),
+        std::string(prop_value).c_str()));
+}
+
 NodeSharedPtr NodeCreator::CreateNodeFromXml(pugi::xml_node& xml_obj, Node* parent,
-                                             bool check_for_duplicates, bool allow_ui)
+                                             bool check_for_duplicates, bool allow_ui,
+                                             XmlLoadLog* load_log)
 {
     std::string class_name = xml_obj.attribute("class").as_str();
     if (class_name.empty())
@@ -465,9 +509,9 @@ NodeSharedPtr NodeCreator::CreateNodeFromXml(pugi::xml_node& xml_obj, Node* pare
         }
 
         NodeProperty* prop = nullptr;
-        if (auto find_prop = rmap_PropNames.find(iter.name()); find_prop != rmap_PropNames.end())
+        if (const auto prop_name = LookupPropName(iter.name()); prop_name != prop_unknown)
         {
-            prop = new_node->get_PropPtr(find_prop->second);
+            prop = new_node->get_PropPtr(prop_name);
 
             if (prop)
             {
@@ -553,36 +597,31 @@ NodeSharedPtr NodeCreator::CreateNodeFromXml(pugi::xml_node& xml_obj, Node* pare
             {
                 // In version 1.3.0, the wxWindow property derived class property names have been
                 // replaced with subclass names.
-                if (find_prop->second == prop_derived_class)
+                if (prop_name == prop_derived_class)
                 {
                     new_node->set_value(prop_subclass, iter.value());
-                    Project.set_ProjectUpdated();
-                    Project.ForceProjectVersion(curSupportedVer);
+                    MarkProjectUpdated(load_log);
                 }
-                else if (find_prop->second == prop_derived_header)
+                else if (prop_name == prop_derived_header)
                 {
                     new_node->set_value(prop_subclass_header, iter.value());
-                    Project.set_ProjectUpdated();
-                    Project.ForceProjectVersion(curSupportedVer);
+                    MarkProjectUpdated(load_log);
                 }
-                else if (find_prop->second == prop_derived_params)
+                else if (prop_name == prop_derived_params)
                 {
                     new_node->set_value(prop_subclass_params, iter.value());
-                    Project.set_ProjectUpdated();
-                    Project.ForceProjectVersion(curSupportedVer);
+                    MarkProjectUpdated(load_log);
                 }
 
-                else if (find_prop->second == prop_base_hdr_includes)
+                else if (prop_name == prop_base_hdr_includes)
                 {
                     new_node->set_value(prop_header_preamble, iter.value());
-                    Project.set_ProjectUpdated();
-                    Project.ForceProjectVersion(curSupportedVer);
+                    MarkProjectUpdated(load_log);
                 }
-                else if (find_prop->second == prop_base_src_includes)
+                else if (prop_name == prop_base_src_includes)
                 {
                     new_node->set_value(prop_source_preamble, iter.value());
-                    Project.set_ProjectUpdated();
-                    Project.ForceProjectVersion(curSupportedVer);
+                    MarkProjectUpdated(load_log);
                 }
             }
         }
@@ -646,23 +685,14 @@ NodeSharedPtr NodeCreator::CreateNodeFromXml(pugi::xml_node& xml_obj, Node* pare
                 // We also need to flag the project file as unsaveable (only SaveAs can be used. See
                 // https://github.com/KeyWorksRW/wxUiEditor/issues/385 ).
 
-                if (allow_ui)
+                if (load_log)
                 {
-                    MSG_WARNING(std::format("Unrecognized property: {} in class: {}", iter.name(),
-                                            class_name));
-
-                    const std::string prop_name(iter.name());
-                    const std::string prop_value(iter.value());
-                    wxMessageBox(wxString::Format(
-                        "The property named \"%s\" of class \"%s\" is not supported by this "
-                        "version of wxUiEditor.\n\n"
-                        "If your project file was just converted from an older version, then the "
-                        "conversion was not "
-                        "complete. Otherwise, this project is from a newer version of "
-                        "wxUiEditor.\n\n"
-                        "The property's value is: %s\n\n"
-                        "If you save this project, YOU WILL LOSE DATA",
-                        prop_name.c_str(), class_name.c_str(), prop_value.c_str()));
+                    load_log->unknown_props.emplace_back(class_name, std::string(iter.name()),
+                                                         std::string(value));
+                }
+                else if (allow_ui)
+                {
+                    ReportUnknownProperty(class_name, iter.name(), value);
                 }
             }
         }
@@ -681,7 +711,7 @@ NodeSharedPtr NodeCreator::CreateNodeFromXml(pugi::xml_node& xml_obj, Node* pare
 
     for (pugi::xml_node child = xml_obj.child("node"); child; child = child.next_sibling("node"))
     {
-        CreateNodeFromXml(child, new_node.get(), false, allow_ui);
+        CreateNodeFromXml(child, new_node.get(), false, allow_ui, load_log);
     }
 
     if (new_node->is_Gen(gen_wxGridBagSizer))
@@ -694,8 +724,17 @@ NodeSharedPtr NodeCreator::CreateNodeFromXml(pugi::xml_node& xml_obj, Node* pare
 
 NodeSharedPtr NodeCreator::CreateProjectNode(pugi::xml_node* xml_obj, bool allow_ui)
 {
+    // Every node in the project is allocated from one arena so that loading and closing the
+    // project don't make (or free) a separate heap allocation for each node. The arena is only
+    // current while the project is being created -- nodes added later use the heap.
+    std::optional<NodeArena::Scope> arena_scope;
+    if (!NodeArena::Current())
+    {
+        arena_scope.emplace(NodeArena::Create(project_arena_size));
+    }
+
     NodeDeclaration* node_decl = m_a_declarations[gen_Project];
-    auto new_node = std::make_shared<Node>(node_decl);
+    auto new_node = AllocateNode(node_decl);
 
     // Calling GetBaseClassCount() is expensive, so do it once and store the result
     const size_t node_info_base_count = m_a_declarations[gen_Project]->GetBaseClassCount();
@@ -748,9 +787,9 @@ NodeSharedPtr NodeCreator::CreateProjectNode(pugi::xml_node* xml_obj, bool allow
         }
 
         NodeProperty* prop = nullptr;
-        if (auto find_prop = rmap_PropNames.find(iter.name()); find_prop != rmap_PropNames.end())
+        if (const auto prop_name = LookupPropName(iter.name()); prop_name != prop_unknown)
         {
-            prop = new_node->get_PropPtr(find_prop->second);
+            prop = new_node->get_PropPtr(prop_name);
 
             if (prop)
             {
@@ -797,17 +836,95 @@ NodeSharedPtr NodeCreator::CreateProjectNode(pugi::xml_node* xml_obj, bool allow
         }
     }
 
-    for (pugi::xml_node child = xml_obj->child("node"); child; child = child.next_sibling("node"))
+    CreateProjectChildren(*xml_obj, new_node.get(), allow_ui);
+
+    return new_node;
+}
+
+void NodeCreator::CreateProjectChildren(pugi::xml_node& xml_obj, Node* project, bool allow_ui)
+{
+    std::vector<pugi::xml_node> children;
+    for (pugi::xml_node child = xml_obj.child("node"); child; child = child.next_sibling("node"))
     {
-        CreateNodeFromXml(child, new_node.get(), false, allow_ui);
+        children.emplace_back(child);
     }
 
-    if (new_node->is_Gen(gen_wxGridBagSizer))
+    // Older projects go through fixups that change the project version, and the dialog unit
+    // conversion needs the main window, so they are always created on this thread.
+    if (children.size() < 2 || Project.get_OriginalProjectVersion() != curSupportedVer)
     {
-        GridBag::GridBagSort(new_node.get());
+        for (auto& child: children)
+        {
+            CreateNodeFromXml(child, project, false, allow_ui);
+        }
+        return;
     }
 
-    return new_node;
+    // Each form and folder is created without a parent so that no two workers ever touch the
+    // same node. They are adopted by the project in file order once every worker has finished.
+    std::vector<NodeSharedPtr> nodes(children.size());
+    std::vector<XmlLoadLog> load_logs(children.size());
+    std::vector<PoolTask> tasks;
+    tasks.reserve(children.size());
+    for (size_t idx = 0; idx < children.size(); ++idx)
+    {
+        tasks.emplace_back(BackgroundTasks.Submit(
+            "CreateNodeFromXml",
+            [this, &children, &nodes, &load_logs, idx, arena = NodeArena::Current()]
+            {
+                const NodeArena::Scope arena_scope(arena);
+                nodes[idx] =
+                    CreateNodeFromXml(children[idx], nullptr, false, false, &load_logs[idx]);
+            }));
+    }
+
+    // Every task must be joined before an exception can be rethrown, since the tasks reference
+    // the vectors above.
+    std::exception_ptr error;
+    for (auto& task: tasks)
+    {
+        try
+        {
+            task.join();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    {
+        if (!nodes[idx])
+        {
+            continue;
+        }
+        if (!project->AdoptChild(nodes[idx]))
+        {
+            FAIL_MSG(std::format("Invalid project file: could not add {} to the project",
+                                 nodes[idx]->get_DeclName()));
+            throw std::runtime_error("Invalid project file");
+        }
+
+        if (load_logs[idx].project_updated)
+        {
+            MarkProjectUpdated(nullptr);
+        }
+        if (allow_ui)
+        {
+            for (const auto& [class_name, prop_name, value]: load_logs[idx].unknown_props)
+            {
+                ReportUnknownProperty(class_name, prop_name, value);
+            }
+        }
+    }
 }
 
 enum class ImportFileType : std::uint8_t
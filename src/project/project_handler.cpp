@@ -1159,7 +1159,7 @@ static int CountValidatorDuplicatesInForm(Node* form)
     return dup_count;
 }
 
-void ProjectHandler::FixDuplicateVarNames(bool allow_ui)
+bool ProjectHandler::FixDuplicateVarNames(bool allow_ui)
 {
     // Step A: Fix local variables per-form.
     int total_local_fixes = 0;
@@ -1256,8 +1256,10 @@ void ProjectHandler::FixDuplicateVarNames(bool allow_ui)
     }
 
     // Step E: Mark modified if any fixes were applied.
-    if ((total_local_fixes > 0 || total_validator_fixes > 0) && allow_ui)
+    const bool is_fixed = (total_local_fixes > 0 || total_validator_fixes > 0);
+    if (is_fixed && allow_ui)
     {
         wxGetFrame().setModified();
     }
+    return is_fixed;
 }
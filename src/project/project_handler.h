@@ -170,7 +170,9 @@ public:
     // Local variables (var_name, checkbox_var_name, radiobtn_var_name) are checked
     // per-form and auto-fixed. validator_variable duplicates are checked project-wide
     // and the user is given the option to fix them.
-    void FixDuplicateVarNames(bool allow_ui);
+    //
+    // Returns true if any names were changed.
+    bool FixDuplicateVarNames(bool allow_ui);
 
     [[nodiscard]] int get_ProjectVersion() const { return m_ProjectVersion; }
     [[nodiscard]] int get_OriginalProjectVersion() const { return m_OriginalProjectVersion; }
@@ -109,12 +109,12 @@ void Node::AddNodeToDoc(pugi::xml_node& node, int& project_version)
         }
     }
 
-    for (auto& iter: m_map_events)
+    for (auto& iter: m_events)
     {
-        const wxue::string& value = iter.second.get_value();
+        const wxue::string& value = iter.get_value();
         if (!value.empty())
         {
-            node.append_attribute(iter.second.get_name()) = value;
+            node.append_attribute(iter.get_name()) = value;
         }
     }
 
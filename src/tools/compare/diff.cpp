@@ -1,5 +1,5 @@
 /////////////////////////////////////////////////////////////////////////////
-// Purpose:   Simple diff algorithm for comparing text files
+// Purpose:   Line-based diff algorithm for comparing text files
 // Author:    Ralph Walden
 // Copyright: Copyright (c) 2025 KeyWorks Software (Ralph Walden)
 // License:   Apache License -- see ..\..\LICENSE
@@ -8,12 +8,241 @@
 #include "diff.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
 
 #include "wxue_namespace/wxue_view_vector.h"
 
-auto Diff::SplitLines(std::string_view text) -> std::vector<std::string>
+namespace
 {
-    std::vector<std::string> lines;
+    // Myers' O(ND) difference algorithm using the linear-space "middle snake" refinement
+    // (E. Myers, "An O(ND) Difference Algorithm and Its Variations", 1986). Lines are compared
+    // as integer ids so that each line's text is only hashed once.
+    //
+    // Memory use is O(N+M) -- the previous LCS table was O(N*M), which limited diffs to small
+    // files.
+    class MyersDiff
+    {
+    public:
+        MyersDiff(const std::vector<uint32_t>& orig_ids, const std::vector<uint32_t>& mod_ids,
+                  std::vector<bool>& orig_changed, std::vector<bool>& mod_changed) :
+            m_orig(orig_ids),
+            m_mod(mod_ids),
+            m_orig_changed(orig_changed),
+            m_mod_changed(mod_changed),
+            m_offset(static_cast<std::ptrdiff_t>(mod_ids.size()) + 1),
+            m_fwd(orig_ids.size() + mod_ids.size() + 3),
+            m_bwd(orig_ids.size() + mod_ids.size() + 3)
+        {
+            // Same limit GNU diff uses: roughly the square root of the total number of lines,
+            // but never less than 4096.
+            m_max_cost = 1;
+            for (auto total = orig_ids.size() + mod_ids.size(); total != 0; total >>= 2)
+            {
+                m_max_cost <<= 1;
+            }
+            m_max_cost = std::max<std::ptrdiff_t>(m_max_cost, 4096);
+        }
+
+        void Run()
+        {
+            CompareRange(0, static_cast<std::ptrdiff_t>(m_orig.size()), 0,
+                         static_cast<std::ptrdiff_t>(m_mod.size()));
+        }
+
+    private:
+        // Marks the lines in original[orig_begin, orig_end) and modified[mod_begin, mod_end)
+        // that are not part of a longest common subsequence.
+        void CompareRange(std::ptrdiff_t orig_begin, std::ptrdiff_t orig_end, std::ptrdiff_t mod_begin,
+                          std::ptrdiff_t mod_end)
+        {
+            // Matching lines at either end are never part of the edit script
+            while (orig_begin < orig_end && mod_begin < mod_end &&
+                   m_orig[orig_begin] == m_mod[mod_begin])
+            {
+                ++orig_begin;
+                ++mod_begin;
+            }
+            while (orig_end > orig_begin && mod_end > mod_begin &&
+                   m_orig[orig_end - 1] == m_mod[mod_end - 1])
+            {
+                --orig_end;
+                --mod_end;
+            }
+
+            if (orig_begin == orig_end)
+            {
+                for (auto idx = mod_begin; idx < mod_end; ++idx)
+                {
+                    m_mod_changed[idx] = true;
+                }
+                return;
+            }
+            if (mod_begin == mod_end)
+            {
+                for (auto idx = orig_begin; idx < orig_end; ++idx)
+                {
+                    m_orig_changed[idx] = true;
+                }
+                return;
+            }
+
+            auto [orig_mid, mod_mid] = FindMiddleSnake(orig_begin, orig_end, mod_begin, mod_end);
+            CompareRange(orig_begin, orig_mid, mod_begin, mod_mid);
+            CompareRange(orig_mid, orig_end, mod_mid, mod_end);
+        }
+
+        // Runs the forward and backward searches simultaneously until they overlap, and
+        // returns the point where they meet. Both ranges must be non-empty, and must not start
+        // or end with matching lines.
+        auto FindMiddleSnake(std::ptrdiff_t orig_begin, std::ptrdiff_t orig_end, std::ptrdiff_t mod_begin,
+                             std::ptrdiff_t mod_end) -> std::pair<std::ptrdiff_t, std::ptrdiff_t>
+        {
+            // Diagonal k contains the points where orig_pos - mod_pos == k. m_fwd[k] is the
+            // furthest orig_pos reached on diagonal k by the forward search, m_bwd[k] the
+            // smallest orig_pos reached by the backward search.
+            auto fwd = [this](std::ptrdiff_t diag) -> std::ptrdiff_t&
+            {
+                return m_fwd[diag + m_offset];
+            };
+            auto bwd = [this](std::ptrdiff_t diag) -> std::ptrdiff_t&
+            {
+                return m_bwd[diag + m_offset];
+            };
+
+            const std::ptrdiff_t diag_min = orig_begin - mod_end;
+            const std::ptrdiff_t diag_max = orig_end - mod_begin;
+            const std::ptrdiff_t fwd_mid = orig_begin - mod_begin;
+            const std::ptrdiff_t bwd_mid = orig_end - mod_end;
+            const bool is_odd = ((fwd_mid - bwd_mid) & 1) != 0;
+
+            std::ptrdiff_t fwd_min = fwd_mid;
+            std::ptrdiff_t fwd_max = fwd_mid;
+            std::ptrdiff_t bwd_min = bwd_mid;
+            std::ptrdiff_t bwd_max = bwd_mid;
+            fwd(fwd_mid) = orig_begin;
+            bwd(bwd_mid) = orig_end;
+
+            std::ptrdiff_t cost = 0;
+
+            for (;;)
+            {
+                // Extend the forward search by one edit
+                if (fwd_min > diag_min)
+                {
+                    fwd(--fwd_min - 1) = -1;
+                }
+                else
+                {
+                    ++fwd_min;
+                }
+                if (fwd_max < diag_max)
+                {
+                    fwd(++fwd_max + 1) = -1;
+                }
+                else
+                {
+                    --fwd_max;
+                }
+                for (std::ptrdiff_t diag = fwd_max; diag >= fwd_min; diag -= 2)
+                {
+                    const std::ptrdiff_t from_lo = fwd(diag - 1);
+                    const std::ptrdiff_t from_hi = fwd(diag + 1);
+                    std::ptrdiff_t orig_pos = (from_lo >= from_hi) ? from_lo + 1 : from_hi;
+                    std::ptrdiff_t mod_pos = orig_pos - diag;
+                    while (orig_pos < orig_end && mod_pos < mod_end &&
+                           m_orig[orig_pos] == m_mod[mod_pos])
+                    {
+                        ++orig_pos;
+                        ++mod_pos;
+                    }
+                    fwd(diag) = orig_pos;
+                    if (is_odd && bwd_min <= diag && diag <= bwd_max && bwd(diag) <= orig_pos)
+                    {
+                        return { orig_pos, mod_pos };
+                    }
+                }
+
+                // Extend the backward search by one edit
+                if (bwd_min > diag_min)
+                {
+                    bwd(--bwd_min - 1) = std::numeric_limits<std::ptrdiff_t>::max();
+                }
+                else
+                {
+                    ++bwd_min;
+                }
+                if (bwd_max < diag_max)
+                {
+                    bwd(++bwd_max + 1) = std::numeric_limits<std::ptrdiff_t>::max();
+                }
+                else
+                {
+                    --bwd_max;
+                }
+                for (std::ptrdiff_t diag = bwd_max; diag >= bwd_min; diag -= 2)
+                {
+                    const std::ptrdiff_t from_lo = bwd(diag - 1);
+                    const std::ptrdiff_t from_hi = bwd(diag + 1);
+                    std::ptrdiff_t orig_pos = (from_lo < from_hi) ? from_lo : from_hi - 1;
+                    std::ptrdiff_t mod_pos = orig_pos - diag;
+                    while (orig_pos > orig_begin && mod_pos > mod_begin &&
+                           m_orig[orig_pos - 1] == m_mod[mod_pos - 1])
+                    {
+                        --orig_pos;
+                        --mod_pos;
+                    }
+                    bwd(diag) = orig_pos;
+                    if (!is_odd && fwd_min <= diag && diag <= fwd_max && orig_pos <= fwd(diag))
+                    {
+                        return { orig_pos, mod_pos };
+                    }
+                }
+
+                // Files that have almost nothing in common would take O(N*M) to diff exactly.
+                // Once the search gets too expensive, split at the furthest point the forward
+                // search has reached. The result is still a valid diff, just not a minimal one.
+                if (++cost >= m_max_cost)
+                {
+                    std::ptrdiff_t best_orig = -1;
+                    std::ptrdiff_t best_mod = -1;
+                    for (std::ptrdiff_t diag = fwd_max; diag >= fwd_min; diag -= 2)
+                    {
+                        const std::ptrdiff_t orig_pos = std::min(fwd(diag), orig_end);
+                        const std::ptrdiff_t mod_pos = orig_pos - diag;
+                        if (mod_pos <= mod_end && orig_pos + mod_pos > best_orig + best_mod)
+                        {
+                            best_orig = orig_pos;
+                            best_mod = mod_pos;
+                        }
+                    }
+                    if (best_orig >= 0 && best_orig + best_mod > orig_begin + mod_begin &&
+                        best_orig + best_mod < orig_end + mod_end)
+                    {
+                        return { best_orig, best_mod };
+                    }
+                }
+            }
+        }
+
+        const std::vector<uint32_t>& m_orig;
+        const std::vector<uint32_t>& m_mod;
+        std::vector<bool>& m_orig_changed;
+        std::vector<bool>& m_mod_changed;
+
+        std::ptrdiff_t m_offset;  // Added to a diagonal to get its index in m_fwd/m_bwd
+        std::ptrdiff_t m_max_cost;  // Edit distance at which FindMiddleSnake() gives up on minimal
+        std::vector<std::ptrdiff_t> m_fwd;
+        std::vector<std::ptrdiff_t> m_bwd;
+    };
+}  // namespace
+
+auto Diff::SplitLines(std::string_view text) -> std::vector<std::string_view>
+{
+    std::vector<std::string_view> lines;
     std::string_view::size_type start = 0;
     std::string_view::size_type end = 0;
 
@@ -39,86 +268,81 @@ auto Diff::SplitLines(std::string_view text) -> std::vector<std::string>
     return lines;
 }
 
-auto Diff::ComputeLCS(const std::vector<std::string>& original,
-                      const std::vector<std::string>& modified) -> std::vector<std::vector<size_t>>
+void Diff::ComputeEdits(const std::vector<std::string_view>& original,
+                        const std::vector<std::string_view>& modified,
+                        std::vector<bool>& orig_changed, std::vector<bool>& mod_changed)
 {
-    const size_t orig_size = original.size();
-    const size_t mod_size = modified.size();
-
-    // Create LCS table
-    std::vector<std::vector<size_t>> lcs(orig_size + 1, std::vector<size_t>(mod_size + 1, 0));
+    orig_changed.assign(original.size(), false);
+    mod_changed.assign(modified.size(), false);
 
-    // Fill LCS table using dynamic programming
-    for (size_t orig_idx = 1; orig_idx <= orig_size; ++orig_idx)
+    // Give every distinct line an id so that the diff compares integers rather than strings
+    std::unordered_map<std::string_view, uint32_t> line_ids;
+    line_ids.reserve(original.size() + modified.size());
+    auto ToIds = [&line_ids](const std::vector<std::string_view>& lines)
     {
-        for (size_t mod_idx = 1; mod_idx <= mod_size; ++mod_idx)
+        std::vector<uint32_t> ids;
+        ids.reserve(lines.size());
+        for (const auto& line: lines)
         {
-            if (original[orig_idx - 1] == modified[mod_idx - 1])
-            {
-                lcs[orig_idx][mod_idx] = lcs[orig_idx - 1][mod_idx - 1] + 1;
-            }
-            else
-            {
-                lcs[orig_idx][mod_idx] =
-                    std::max(lcs[orig_idx - 1][mod_idx], lcs[orig_idx][mod_idx - 1]);
-            }
+            ids.push_back(
+                line_ids.try_emplace(line, static_cast<uint32_t>(line_ids.size())).first->second);
         }
-    }
+        return ids;
+    };
+    const auto orig_ids = ToIds(original);
+    const auto mod_ids = ToIds(modified);
 
-    return lcs;
+    MyersDiff(orig_ids, mod_ids, orig_changed, mod_changed).Run();
 }
 
-void Diff::BuildDiff(const std::vector<std::string>& original,
-                     const std::vector<std::string>& modified,
-                     const std::vector<std::vector<size_t>>& lcs, DiffResult& result,
-                     size_t context_lines)
+void Diff::BuildDiff(const std::vector<std::string_view>& original,
+                     const std::vector<std::string_view>& modified,
+                     const std::vector<bool>& orig_changed, const std::vector<bool>& mod_changed,
+                     DiffResult& result, size_t context_lines)
 {
-    size_t orig_idx = original.size();
-    size_t mod_idx = modified.size();
+    size_t orig_idx = 0;
+    size_t mod_idx = 0;
 
     std::vector<DiffLine> temp_left;
     std::vector<DiffLine> temp_right;
+    temp_left.reserve(std::max(original.size(), modified.size()));
+    temp_right.reserve(std::max(original.size(), modified.size()));
 
-    // Backtrack through LCS table to build diff
-    while (orig_idx > 0 || mod_idx > 0)
+    // Within a block of changes, deleted lines are listed before added lines
+    while (orig_idx < original.size() || mod_idx < modified.size())
     {
-        if (orig_idx > 0 && mod_idx > 0 && original[orig_idx - 1] == modified[mod_idx - 1])
+        if (orig_idx < original.size() && orig_changed[orig_idx])
         {
-            // Lines are the same
+            // Line was deleted
+            const size_t new_line = mod_idx > 0 ? mod_idx - 1 : 0;
             temp_left.push_back(
-                { original[orig_idx - 1], DiffType::unchanged, orig_idx - 1, mod_idx - 1 });
-            temp_right.push_back(
-                { modified[mod_idx - 1], DiffType::unchanged, orig_idx - 1, mod_idx - 1 });
-            --orig_idx;
-            --mod_idx;
+                { std::string(original[orig_idx]), DiffType::deleted, orig_idx, new_line });
+            temp_right.push_back({ "", DiffType::deleted, orig_idx, new_line });
+            result.has_differences = true;
+            ++orig_idx;
         }
-        else if (mod_idx > 0 &&
-                 (orig_idx == 0 || lcs[orig_idx][mod_idx - 1] >= lcs[orig_idx - 1][mod_idx]))
+        else if (mod_idx < modified.size() && mod_changed[mod_idx])
         {
             // Line was added
-            temp_left.push_back(
-                { "", DiffType::added, orig_idx > 0 ? orig_idx - 1 : 0, mod_idx - 1 });
-            temp_right.push_back({ modified[mod_idx - 1], DiffType::added,
-                                   orig_idx > 0 ? orig_idx - 1 : 0, mod_idx - 1 });
+            const size_t original_line = orig_idx > 0 ? orig_idx - 1 : 0;
+            temp_left.push_back({ "", DiffType::added, original_line, mod_idx });
+            temp_right.push_back(
+                { std::string(modified[mod_idx]), DiffType::added, original_line, mod_idx });
             result.has_differences = true;
-            --mod_idx;
+            ++mod_idx;
         }
-        else if (orig_idx > 0)
+        else
         {
-            // Line was deleted
-            temp_left.push_back({ original[orig_idx - 1], DiffType::deleted, orig_idx - 1,
-                                  mod_idx > 0 ? mod_idx - 1 : 0 });
+            // Lines are the same
+            temp_left.push_back(
+                { std::string(original[orig_idx]), DiffType::unchanged, orig_idx, mod_idx });
             temp_right.push_back(
-                { "", DiffType::deleted, orig_idx - 1, mod_idx > 0 ? mod_idx - 1 : 0 });
-            result.has_differences = true;
-            --orig_idx;
+                { std::string(modified[mod_idx]), DiffType::unchanged, orig_idx, mod_idx });
+            ++orig_idx;
+            ++mod_idx;
         }
     }
 
-    // Reverse to get correct order
-    std::reverse(temp_left.begin(), temp_left.end());
-    std::reverse(temp_right.begin(), temp_right.end());
-
     // Apply context filtering: only include lines near changes
     if (context_lines > 0 && result.has_differences)
     {
@@ -144,8 +368,8 @@ void Diff::BuildDiff(const std::vector<std::string>& original,
         {
             if (include[idx])
             {
-                result.left_lines.push_back(temp_left[idx]);
-                result.right_lines.push_back(temp_right[idx]);
+                result.left_lines.push_back(std::move(temp_left[idx]));
+                result.right_lines.push_back(std::move(temp_right[idx]));
             }
         }
     }
@@ -157,52 +381,85 @@ void Diff::BuildDiff(const std::vector<std::string>& original,
     }
 }
 
-auto Diff::Compare(std::string_view original, std::string_view modified, size_t context_lines)
+auto Diff::CompareLines(const std::vector<std::string_view>& original,
+                        const std::vector<std::string_view>& modified, size_t context_lines)
     -> DiffResult
 {
     DiffResult result;
 
-    auto original_lines = SplitLines(original);
-    auto modified_lines = SplitLines(modified);
-
-    if (original_lines.empty() && modified_lines.empty())
+    if (original.empty() && modified.empty())
     {
         return result;
     }
 
-    auto lcs = ComputeLCS(original_lines, modified_lines);
-    BuildDiff(original_lines, modified_lines, lcs, result, context_lines);
+    std::vector<bool> orig_changed;
+    std::vector<bool> mod_changed;
+    ComputeEdits(original, modified, orig_changed, mod_changed);
+    BuildDiff(original, modified, orig_changed, mod_changed, result, context_lines);
 
     return result;
 }
 
-auto Diff::Compare(const wxue::ViewVector& original, const wxue::ViewVector& modified,
-                   size_t context_lines) -> DiffResult
+auto Diff::FindChangedRanges(const std::vector<std::string_view>& original,
+                             const std::vector<std::string_view>& modified)
+    -> std::vector<DiffRange>
 {
-    DiffResult result;
-
+    std::vector<DiffRange> ranges;
     if (original.empty() && modified.empty())
     {
-        return result;
+        return ranges;
     }
 
-    // Convert ViewVector to vector<string> for LCS algorithm
-    std::vector<std::string> original_lines;
-    original_lines.reserve(original.size());
-    for (const auto& line: original)
-    {
-        original_lines.emplace_back(line);
-    }
+    std::vector<bool> orig_changed;
+    std::vector<bool> mod_changed;
+    ComputeEdits(original, modified, orig_changed, mod_changed);
 
-    std::vector<std::string> modified_lines;
-    modified_lines.reserve(modified.size());
-    for (const auto& line: modified)
+    size_t orig_idx = 0;
+    size_t mod_idx = 0;
+    while (orig_idx < original.size() || mod_idx < modified.size())
     {
-        modified_lines.emplace_back(line);
+        if (orig_idx < original.size() && mod_idx < modified.size() && !orig_changed[orig_idx] &&
+            !mod_changed[mod_idx])
+        {
+            ++orig_idx;
+            ++mod_idx;
+            continue;
+        }
+
+        DiffRange range { orig_idx, 0, mod_idx, 0 };
+        while (orig_idx < original.size() && orig_changed[orig_idx])
+        {
+            ++orig_idx;
+            ++range.count_original;
+        }
+        while (mod_idx < modified.size() && mod_changed[mod_idx])
+        {
+            ++mod_idx;
+            ++range.count_modified;
+        }
+        if (range.count_original == 0 && range.count_modified == 0)
+        {
+            break;  // only possible if the edit script is inconsistent
+        }
+        ranges.push_back(range);
     }
 
-    auto lcs = ComputeLCS(original_lines, modified_lines);
-    BuildDiff(original_lines, modified_lines, lcs, result, context_lines);
+    return ranges;
+}
 
-    return result;
+auto Diff::Compare(std::string_view original, std::string_view modified, size_t context_lines)
+    -> DiffResult
+{
+    return CompareLines(SplitLines(original), SplitLines(modified), context_lines);
+}
+
+auto Diff::Compare(const wxue::ViewVector& original, const wxue::ViewVector& modified,
+                   size_t context_lines) -> DiffResult
+{
+    // The ViewVector entries already point into the caller's buffers, so this only copies the
+    // views, not the text.
+    const std::vector<std::string_view> original_lines(original.begin(), original.end());
+    const std::vector<std::string_view> modified_lines(modified.begin(), modified.end());
+
+    return CompareLines(original_lines, modified_lines, context_lines);
 }
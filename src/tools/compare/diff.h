@@ -1,5 +1,5 @@
 /////////////////////////////////////////////////////////////////////////////
-// Purpose:   Simple diff algorithm for comparing text files
+// Purpose:   Line-based diff algorithm for comparing text files
 // Author:    Ralph Walden
 // Copyright: Copyright (c) 2025 KeyWorks Software (Ralph Walden)
 // License:   Apache License -- see ..\..\LICENSE
@@ -32,6 +32,16 @@ struct DiffLine
     size_t new_line;       // Line number in new file (0-based)
 };
 
+// A single block of changed lines: count_original lines starting at start_original were replaced
+// by count_modified lines starting at start_modified. Either count can be zero.
+struct DiffRange
+{
+    size_t start_original;
+    size_t count_original;
+    size_t start_modified;
+    size_t count_modified;
+};
+
 struct DiffResult
 {
     std::vector<DiffLine> left_lines;   // Original file lines with context
@@ -69,18 +79,35 @@ public:
                                       const wxue::ViewVector& modified, size_t context_lines = 3)
         -> DiffResult;
 
+    // Returns only the blocks of lines that differ, in ascending order. Unlike Compare(), no
+    // line text is copied, which makes this suitable for patching a control that already
+    // displays the original lines.
+    [[nodiscard]] static auto FindChangedRanges(const std::vector<std::string_view>& original,
+                                                const std::vector<std::string_view>& modified)
+        -> std::vector<DiffRange>;
+
 private:
     // Split text into lines
-    [[nodiscard]] static auto SplitLines(std::string_view text) -> std::vector<std::string>;
+    [[nodiscard]] static auto SplitLines(std::string_view text) -> std::vector<std::string_view>;
 
-    // Compute Longest Common Subsequence using dynamic programming
-    [[nodiscard]] static auto ComputeLCS(const std::vector<std::string>& original,
-                                         const std::vector<std::string>& modified)
-        -> std::vector<std::vector<size_t>>;
+    // Computes an edit script using Myers' linear-space O(ND) algorithm. The script is minimal
+    // as long as the edit distance stays below the cost limit. Past the limit, the remaining
+    // lines are split heuristically, so more lines may be marked as changed than necessary.
+    // On return, orig_changed[i] is true if original[i] was deleted, and mod_changed[j] is
+    // true if modified[j] was added.
+    static void ComputeEdits(const std::vector<std::string_view>& original,
+                             const std::vector<std::string_view>& modified,
+                             std::vector<bool>& orig_changed, std::vector<bool>& mod_changed);
 
-    // Build diff result from LCS table
-    static void BuildDiff(const std::vector<std::string>& original,
-                          const std::vector<std::string>& modified,
-                          const std::vector<std::vector<size_t>>& lcs, DiffResult& result,
+    // Build diff result from the edit script
+    static void BuildDiff(const std::vector<std::string_view>& original,
+                          const std::vector<std::string_view>& modified,
+                          const std::vector<bool>& orig_changed,
+                          const std::vector<bool>& mod_changed, DiffResult& result,
                           size_t context_lines);
+
+    // Computes the edit script for two sets of lines and builds the result
+    [[nodiscard]] static auto CompareLines(const std::vector<std::string_view>& original,
+                                           const std::vector<std::string_view>& modified,
+                                           size_t context_lines) -> DiffResult;
 };
@@ -1088,6 +1088,17 @@ void PreferencesDlg::OnOK(wxCommandEvent& /* event unused */)
 
     UserPrefs.WriteConfig();
 
+    // Line lengths and other preferences change the generated code, so none of the code the
+    // panels have cached can be reused.
+    for (auto* panel: { wxGetFrame().GetCppPanel(), wxGetFrame().GetPythonPanel(),
+                        wxGetFrame().GetRubyPanel(), wxGetFrame().GetXrcPanel() })
+    {
+        if (panel)
+        {
+            panel->InvalidateCodeCache();
+        }
+    }
+
     if (is_prop_grid_changed || is_dark_changed || is_icon_size_changed)
     {
         wxue::string msg("You must close and reopen wxUiEditor for");
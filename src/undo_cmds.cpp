@@ -21,6 +21,17 @@
 #include "project_handler.h"      // ProjectHandler class
 #include "utils.h"                // Utility functions that work with properties
 
+// A node without a parent is no longer part of the project, so the undo stack is the only thing
+// keeping it (and all of its children) alive.
+static size_t DetachedSize(const NodeSharedPtr& node)
+{
+    if (!node || node->get_Parent() || node->is_Gen(gen_Project))
+    {
+        return 0;
+    }
+    return node->get_TreeSize();
+}
+
 ///////////////////////////////// InsertNodeAction ////////////////////////////////////
 
 InsertNodeAction::InsertNodeAction(Node* node, Node* parent, std::string_view undo_str, int pos) :
@@ -96,6 +107,11 @@ void InsertNodeAction::Revert()
     }
 }
 
+size_t InsertNodeAction::GetMemorySize()
+{
+    return sizeof(*this) + DetachedSize(m_node);
+}
+
 ///////////////////////////////// RemoveNodeAction ////////////////////////////////////
 
 RemoveNodeAction::RemoveNodeAction(Node* node, std::string_view undo_str, bool AddToClipboard) :
@@ -154,6 +170,11 @@ void RemoveNodeAction::Revert()
     }
 }
 
+size_t RemoveNodeAction::GetMemorySize()
+{
+    return sizeof(*this) + DetachedSize(m_node);
+}
+
 ///////////////////////////////// ModifyPropertyAction ////////////////////////////////////
 
 ModifyPropertyAction::ModifyPropertyAction(NodeProperty* prop, std::string_view value) :
@@ -318,6 +339,11 @@ void ChangePositionAction::Revert()
 
 ///////////////////////////////// ChangeSizerType ////////////////////////////////////
 
+size_t ChangeSizerType::GetMemorySize()
+{
+    return sizeof(*this) + DetachedSize(m_old_node) + DetachedSize(m_node);
+}
+
 ChangeSizerType::ChangeSizerType(Node* node, GenEnum::GenName new_sizer) :
     m_new_gen_sizer(new_sizer)
 {
@@ -453,16 +479,14 @@ static void CopyCommonProperties(Node* old_node, Node* new_node)
 
     if (old_node->is_Gen(gen_wxComboBox) && new_node->is_Gen(gen_wxChoice))
     {
-        NodeMapEvents map_old_events = old_node->get_MapEvents();
-        if (const NodeMapEvents::iterator event = map_old_events.find("wxEVT_COMBOBOX");
-            event != map_old_events.end())
+        if (const NodeEvent* event = old_node->get_Event("wxEVT_COMBOBOX"); event)
         {
-            if (!event->second.get_value().empty())
+            if (!event->get_value().empty())
             {
                 NodeEvent* new_event = new_node->get_Event("wxEVT_CHOICE");
                 if (new_event)
                 {
-                    new_event->set_value(event->second.get_value());
+                    new_event->set_value(event->get_value());
                 }
             }
         }
@@ -472,6 +496,11 @@ static void CopyCommonProperties(Node* old_node, Node* new_node)
     new_node->CopyEventsFrom(old_node);
 }
 
+size_t ChangeNodeType::GetMemorySize()
+{
+    return sizeof(*this) + DetachedSize(m_old_node) + DetachedSize(m_node);
+}
+
 ChangeNodeType::ChangeNodeType(Node* node, GenEnum::GenName new_node)
 {
     m_undo_string << "change widget type";
@@ -690,6 +719,11 @@ void AppendGridBagAction::Revert()
     }
 }
 
+size_t AppendGridBagAction::GetMemorySize()
+{
+    return sizeof(*this) + DetachedSize(m_node);
+}
+
 ///////////////////////////////// GridBagAction ////////////////////////////////////
 
 GridBagAction::GridBagAction(Node* cur_gbsizer, std::string_view undo_str) : UndoAction(undo_str)
@@ -789,6 +823,12 @@ void GridBagAction::Update()
     nav_panel->Thaw();
 }
 
+size_t GridBagAction::GetMemorySize()
+{
+    // m_old_gbsizer is always a copy
+    return sizeof(*this) + m_old_gbsizer->get_TreeSize();
+}
+
 ///////////////////////////////// SortProjectAction ////////////////////////////////////
 
 static bool CompareClassNames(NodeSharedPtr node_a, NodeSharedPtr node_b)
@@ -826,7 +866,19 @@ SortProjectAction::SortProjectAction()
 
     m_undo_string = "Sort Project";
 
-    m_old_project = NodeCreation.MakeCopy(Project.get_ProjectNode());
+    SaveOrder(Project.get_ProjectNode());
+}
+
+void SortProjectAction::SaveOrder(Node* folder)
+{
+    m_old_order.emplace_back(folder->get_SharedPtr(), folder->get_ChildNodePtrs());
+    for (const auto& iter: folder->get_ChildNodePtrs())
+    {
+        if (iter->is_Gen(gen_folder) || iter->is_Gen(gen_sub_folder))
+        {
+            SaveOrder(iter.get());
+        }
+    }
 }
 
 void SortProjectAction::Change()
@@ -865,10 +917,9 @@ void SortProjectAction::SortFolder(Node* folder)
 
 void SortProjectAction::Revert()
 {
-    Project.get_ProjectNode()->removeAllChildren();
-    for (const auto& child: m_old_project->get_ChildNodePtrs())
+    for (const auto& [folder, children]: m_old_order)
     {
-        Project.get_ProjectNode()->AdoptChild(NodeCreation.MakeCopy(child.get()));
+        folder->get_ChildNodePtrs() = children;
     }
 
     wxGetFrame().FireProjectUpdatedEvent();
@@ -877,3 +928,13 @@ void SortProjectAction::Revert()
         wxGetFrame().SelectNode(Project.get_ProjectNode());
     }
 }
+
+size_t SortProjectAction::GetMemorySize()
+{
+    size_t total = sizeof(*this);
+    for (const auto& [folder, children]: m_old_order)
+    {
+        total += sizeof(folder) + sizeof(children) + children.size() * sizeof(NodeSharedPtr);
+    }
+    return total;
+}
@@ -32,7 +32,7 @@ public:
     // Set this to true if you created the node without firing a created event.
     void SetFireCreatedEvent(bool fire) { m_fire_created_event = fire; }
 
-    size_t GetMemorySize() override { return sizeof(*this); }
+    size_t GetMemorySize() override;
 
 private:
     NodeSharedPtr m_parent;
@@ -54,7 +54,7 @@ public:
     // Called when Undo is requested
     void Revert() override;
 
-    size_t GetMemorySize() override { return sizeof(*this); }
+    size_t GetMemorySize() override;
 
 private:
     NodeSharedPtr m_parent;
@@ -191,7 +191,7 @@ public:
     [[nodiscard]] NodeSharedPtr GetOldNode() override { return m_old_node; }
     [[nodiscard]] Node* getNode() { return m_node.get(); }
 
-    size_t GetMemorySize() override { return sizeof(*this); }
+    size_t GetMemorySize() override;
 
 private:
     NodeSharedPtr m_old_node;
@@ -210,7 +210,7 @@ public:
     [[nodiscard]] NodeSharedPtr GetOldNode() override { return m_old_node; }
     [[nodiscard]] Node* getNode() { return m_node.get(); }
 
-    size_t GetMemorySize() override { return sizeof(*this); }
+    size_t GetMemorySize() override;
 
 private:
     NodeSharedPtr m_old_node;
@@ -226,7 +226,7 @@ public:
     void Change() override;
     void Revert() override;
 
-    size_t GetMemorySize() override { return sizeof(*this); }
+    size_t GetMemorySize() override;
 
 private:
     NodeSharedPtr m_parent;
@@ -252,7 +252,7 @@ public:
     [[nodiscard]] Node* GetOldSizerNode() const { return m_old_gbsizer.get(); }
     [[nodiscard]] Node* GetCurSizerNode() const { return m_cur_gbsizer.get(); }
 
-    size_t GetMemorySize() override { return sizeof(*this); }
+    size_t GetMemorySize() override;
 
 private:
     NodeSharedPtr m_cur_gbsizer;
@@ -269,12 +269,14 @@ public:
     void Change() override;
     void Revert() override;
 
-    size_t GetMemorySize() override { return sizeof(*this); }
-    [[nodiscard]] NodeSharedPtr GetOldNode() override { return m_old_project; }
+    size_t GetMemorySize() override;
 
 protected:
     void SortFolder(Node* folder);
+    void SaveOrder(Node* folder);
 
 private:
-    NodeSharedPtr m_old_project;
+    // The original order of the children of the project and of every folder within it. Only the
+    // order is saved -- Revert() puts the same nodes back rather than copies of them.
+    std::vector<std::pair<NodeSharedPtr, std::vector<NodeSharedPtr>>> m_old_order;
 };
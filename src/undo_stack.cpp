@@ -6,21 +6,308 @@
 /////////////////////////////////////////////////////////////////////////////
 // CR: [07-12-2026]
 
+#include <algorithm>
+#include <cstring>  // for std::memcpy
+#include <mutex>
+#include <sstream>  // for std::ostringstream
+#include <tuple>    // for std::ignore
+
+#include <wx/file.h>      // wxFile - encapsulates low-level "file descriptor"
+#include <wx/filename.h>  // wxFileName - encapsulates a file path
+#include <wx/mstream.h>   // Memory stream classes
+#include <wx/wupdlock.h>  // wxWindowUpdateLocker prevents window redrawing
+#include <wx/zstream.h>   // zlib stream classes
+
 #include "undo_stack.h"  // UndoStack
 
-#include "mainframe.h"  // MainFrame -- Main window frame
-#include "node.h"       // Node class
+#include "mainframe.h"        // MainFrame -- Main window frame
+#include "node.h"             // Node class
+#include "node_creator.h"     // NodeCreator -- Class used to create nodes
+#include "preferences.h"      // Prefs -- Set/Get wxUiEditor preferences
+#include "project_handler.h"  // ProjectHandler class
+
+#include "pugixml.hpp"
+
+///////////////////////////////// UndoSpillFile ////////////////////////////////////
+
+// Temporary file containing zlib-compressed project checkpoints. The file is removed when the
+// last UndoStack or collapsed entry that uses it is destroyed. SetFileCheckpoint() writes to it
+// from a BackgroundTasks worker, so every file access is made with m_mutex held.
+class UndoSpillFile
+{
+public:
+    UndoSpillFile()
+    {
+        m_path = wxFileName::CreateTempFileName("wxue_undo");
+        if (!m_path.empty())
+        {
+            std::ignore = m_file.Open(m_path, wxFile::read_write);
+        }
+    }
+
+    ~UndoSpillFile()
+    {
+        if (m_file.IsOpened())
+        {
+            m_file.Close();
+        }
+        if (!m_path.empty())
+        {
+            wxRemoveFile(m_path);
+        }
+    }
+
+    UndoSpillFile(const UndoSpillFile&) = delete;
+    UndoSpillFile& operator=(const UndoSpillFile&) = delete;
+
+    [[nodiscard]] bool IsOk() const { return m_file.IsOpened(); }
+    [[nodiscard]] std::uint64_t GetSize() const
+    {
+        const std::scoped_lock lock(m_mutex);
+        return m_size;
+    }
+
+    // Compresses data and appends it to the file, setting offset and size to the location
+    // that must be passed to Read().
+    bool Write(std::string_view data, std::uint64_t& offset, std::uint64_t& size)
+    {
+        wxMemoryOutputStream memory_stream;
+        {
+            wxZlibOutputStream save_stream(memory_stream, wxZ_BEST_SPEED);
+            save_stream.Write(data.data(), data.size());
+            save_stream.Close();
+        }
+        const auto compressed_size = static_cast<size_t>(memory_stream.TellO());
+        const auto* buffer = memory_stream.GetOutputStreamBuffer();
+
+        const std::uint64_t original_size = data.size();
+        const std::scoped_lock lock(m_mutex);
+        if (m_file.Seek(static_cast<wxFileOffset>(m_size)) == wxInvalidOffset ||
+            m_file.Write(&original_size, sizeof(original_size)) != sizeof(original_size) ||
+            m_file.Write(buffer->GetBufferStart(), compressed_size) != compressed_size)
+        {
+            return false;
+        }
+
+        offset = m_size;
+        size = sizeof(original_size) + compressed_size;
+        m_size += size;
+        return true;
+    }
+
+    // Returns an empty string if the data could not be read
+    std::string Read(std::uint64_t offset, std::uint64_t size)
+    {
+        std::uint64_t original_size = 0;
+        std::vector<char> compressed;
+        {
+            const std::scoped_lock lock(m_mutex);
+            if (size <= sizeof(original_size) ||
+                m_file.Seek(static_cast<wxFileOffset>(offset)) == wxInvalidOffset)
+            {
+                return {};
+            }
+
+            compressed.resize(size);
+            if (m_file.Read(compressed.data(), size) != static_cast<ssize_t>(size))
+            {
+                return {};
+            }
+        }
+        std::memcpy(&original_size, compressed.data(), sizeof(original_size));
+
+        wxMemoryInputStream stream_in(compressed.data() + sizeof(original_size),
+                                      size - sizeof(original_size));
+        wxZlibInputStream zlib_stream(stream_in);
+        std::string result(original_size, '\0');
+        if (zlib_stream.Read(result.data(), original_size).LastRead() != original_size)
+        {
+            return {};
+        }
+        return result;
+    }
+
+private:
+    wxString m_path;
+    wxFile m_file;
+    std::uint64_t m_size { 0 };
+    mutable std::mutex m_mutex;
+};
+
+///////////////////////////////// CollapsedAction ////////////////////////////////////
+
+namespace
+{
+    // Replaces a range of the oldest undo entries. Revert() restores the project checkpoint that
+    // was captured before the first of them, and Change() puts back the exact nodes that were in
+    // the project before Revert() was called -- newer entries in the redo stack depend on them.
+    class CollapsedAction : public UndoAction
+    {
+    public:
+        CollapsedAction(std::shared_ptr<UndoSpillFile> spill_file, std::uint64_t offset,
+                        std::uint64_t size, size_t count) :
+            m_spill_file(std::move(spill_file)), m_offset(offset), m_size(size), m_count(count)
+        {
+            m_undo_string << count << " earlier changes";
+
+            m_RedoEventGenerated = true;
+            m_RedoSelectEventGenerated = true;
+            m_UndoEventGenerated = true;
+            m_UndoSelectEventGenerated = true;
+        }
+
+        void Change() override;
+        void Revert() override;
+
+        size_t GetMemorySize() override
+        {
+            size_t total = sizeof(*this);
+            for (const auto& child: m_saved_children)
+            {
+                total += child->get_TreeSize();
+            }
+            for (const auto& value: m_saved_values)
+            {
+                total += value.size() + 1;
+            }
+            return total;
+        }
+
+        // Number of actions this entry replaced
+        [[nodiscard]] size_t GetCount() const { return m_count; }
+
+    private:
+        std::shared_ptr<UndoSpillFile> m_spill_file;
+        std::uint64_t m_offset;
+        std::uint64_t m_size;
+        size_t m_count;
+
+        // Set by Revert()
+        std::vector<NodeSharedPtr> m_saved_children;
+        std::vector<wxue::string> m_saved_values;
+        bool m_is_reverted { false };
+    };
+
+    void CollapsedAction::Revert()
+    {
+        const std::string xml = m_spill_file->Read(m_offset, m_size);
+        pugi::xml_document doc;
+        if (xml.empty() || !doc.load_string(xml.c_str()))
+        {
+            FAIL_MSG("Unable to read the undo checkpoint from the temporary file");
+            return;
+        }
+        // Checkpoints have the same layout as a project file, since one may be the project file
+        pugi::xml_node xml_project = doc.first_child().child("node");
+        const NodeSharedPtr checkpoint = NodeCreation.CreateProjectNode(&xml_project, false);
+        if (!checkpoint)
+        {
+            return;
+        }
+
+        Node* project = Project.get_ProjectNode();
+        m_saved_children = project->get_ChildNodePtrs();
+        project->removeAllChildren();
+
+        // Both nodes were created from the same declaration, so the properties are in the same
+        // order.
+        auto& props = project->get_PropsVector();
+        const auto& checkpoint_props = checkpoint->get_PropsVector();
+        m_saved_values.clear();
+        m_saved_values.reserve(props.size());
+        for (size_t idx = 0; idx < props.size(); ++idx)
+        {
+            m_saved_values.emplace_back(props[idx].as_string());
+            props[idx].set_value(checkpoint_props[idx].as_string());
+        }
+        for (const auto& child: checkpoint->get_ChildNodePtrs())
+        {
+            project->AdoptChild(child);
+        }
+        m_is_reverted = true;
+
+        wxGetFrame().FireProjectUpdatedEvent();
+        if (isAllowedSelectEvent())
+        {
+            wxGetFrame().SelectNode(project);
+        }
+    }
+
+    void CollapsedAction::Change()
+    {
+        if (!m_is_reverted)
+        {
+            return;
+        }
+
+        Node* project = Project.get_ProjectNode();
+        project->removeAllChildren();
+        auto& props = project->get_PropsVector();
+        for (size_t idx = 0; idx < props.size() && idx < m_saved_values.size(); ++idx)
+        {
+            props[idx].set_value(m_saved_values[idx]);
+        }
+        for (const auto& child: m_saved_children)
+        {
+            project->AdoptChild(child);
+        }
+        m_saved_children.clear();
+        m_saved_values.clear();
+        m_is_reverted = false;
+
+        wxGetFrame().FireProjectUpdatedEvent();
+        if (isAllowedSelectEvent())
+        {
+            wxGetFrame().SelectNode(project);
+        }
+    }
+}  // namespace
 
 ///////////////////////////////// UndoStack ////////////////////////////////////
 
+UndoStack::UndoStack() = default;
+UndoStack::~UndoStack() = default;
+
 void UndoStack::Push(const UndoActionPtr& ptr)
 {
-    if (!m_locked)
+    if (m_locked)
     {
-        m_undo.push_back(ptr);
-        m_redo.clear();
+        ptr->Change();
+        return;
     }
+
+    m_redo.clear();
+    m_collapsed_count = std::min(m_collapsed_count, m_undo.size());
+
+    // Any checkpoint past the current position was captured before an action that was in the
+    // redo stack.
+    std::erase_if(m_checkpoints,
+                  [this](const Checkpoint& checkpoint)
+                  {
+                      return checkpoint.index > m_undo.size();
+                  });
+    if (m_pending_checkpoint && m_pending_checkpoint->index > m_undo.size())
+    {
+        // The task only uses its own references to the spill file and the checkpoint
+        m_pending_task.detach();
+        m_pending_checkpoint.reset();
+    }
+
+    // Without a checkpoint here nothing before this change could ever be collapsed. This only
+    // happens if SetFileCheckpoint() wasn't called for the project.
+    if (m_undo.size() == m_collapsed_count && !HasCheckpointAt(m_undo.size()))
+    {
+        CaptureCheckpoint();
+    }
+
+    m_undo.push_back(ptr);
     ptr->Change();
+
+    const size_t memory_size = ptr->GetMemorySize();
+    m_undo_sizes.push_back(memory_size);
+    m_undo_memory += memory_size;
+
+    EnforceMemoryLimit();
 }
 
 void UndoStack::Undo()
@@ -30,6 +317,12 @@ void UndoStack::Undo()
         const UndoActionPtr command =
             m_undo.back();  // make a copy of the share_ptr to increase the reference count
         m_undo.pop_back();
+        m_undo_memory -= m_undo_sizes.back();
+        m_undo_sizes.pop_back();
+        if (m_undo.size() < m_collapsed_count)
+        {
+            m_collapsed_extra -= static_cast<CollapsedAction*>(command.get())->GetCount() - 1;
+        }
         m_redo.push_back(command);
         command->Revert();
     }
@@ -42,11 +335,33 @@ void UndoStack::Redo()
         const UndoActionPtr command =
             m_redo.back();  // make a copy of the share_ptr to increase the reference count
         m_redo.pop_back();
+        if (m_undo.size() < m_collapsed_count)
+        {
+            m_collapsed_extra += static_cast<CollapsedAction*>(command.get())->GetCount() - 1;
+        }
         m_undo.push_back(command);
         command->Change();
+
+        const size_t memory_size = command->GetMemorySize();
+        m_undo_sizes.push_back(memory_size);
+        m_undo_memory += memory_size;
     }
 }
 
+void UndoStack::clear()
+{
+    m_redo.clear();
+    m_undo.clear();
+    m_undo_sizes.clear();
+    m_undo_memory = 0;
+    m_checkpoints.clear();
+    m_pending_task.detach();
+    m_pending_checkpoint.reset();
+    m_spill_file.reset();
+    m_collapsed_count = 0;
+    m_collapsed_extra = 0;
+}
+
 wxString UndoStack::GetUndoString()
 {
     wxString str;
@@ -67,6 +382,185 @@ wxString UndoStack::GetRedoString()
     return str;
 }
 
+size_t UndoStack::GetMemoryLimit()
+{
+    return static_cast<size_t>(std::max(UserPrefs.get_UndoMemoryLimit(), 1)) * 1024 * 1024;
+}
+
+size_t UndoStack::GetSpilledSize() const
+{
+    return m_spill_file ? static_cast<size_t>(m_spill_file->GetSize()) : 0;
+}
+
+void UndoStack::CaptureCheckpoint()
+{
+    if (!m_spill_file)
+    {
+        m_spill_file = std::make_shared<UndoSpillFile>();
+    }
+    if (!m_spill_file->IsOk())
+    {
+        return;
+    }
+
+    pugi::xml_document doc;
+    pugi::xml_node node = doc.append_child("wxUiEditorData").append_child("node");
+    int project_version = curSupportedVer;
+    Project.get_ProjectNode()->AddNodeToDoc(node, project_version);
+
+    std::ostringstream xml_stream;
+    doc.save(xml_stream, "", pugi::format_raw | pugi::format_no_declaration);
+
+    Checkpoint checkpoint { m_undo.size(), 0, 0 };
+    if (m_spill_file->Write(xml_stream.str(), checkpoint.offset, checkpoint.size))
+    {
+        m_checkpoints.push_back(checkpoint);
+    }
+}
+
+void UndoStack::SetFileCheckpoint(const wxue::string& project_file)
+{
+    // A checkpoint from a previous save is still worth keeping
+    AddPendingCheckpoint();
+    if (HasCheckpointAt(m_undo.size()))
+    {
+        return;
+    }
+
+    wxFile file;
+    if (!file.Open(project_file.wx()) || file.Length() <= 0)
+    {
+        return;
+    }
+    std::string xml(static_cast<size_t>(file.Length()), '\0');
+    if (file.Read(xml.data(), xml.size()) != static_cast<ssize_t>(xml.size()))
+    {
+        return;
+    }
+
+    if (!m_spill_file)
+    {
+        m_spill_file = std::make_shared<UndoSpillFile>();
+    }
+    if (!m_spill_file->IsOk())
+    {
+        return;
+    }
+
+    m_pending_checkpoint = std::make_shared<Checkpoint>(Checkpoint { m_undo.size(), 0, 0 });
+    m_pending_task = BackgroundTasks.Submit(
+        "UndoFileCheckpoint",
+        [spill_file = m_spill_file, checkpoint = m_pending_checkpoint, xml = std::move(xml)]
+        {
+            std::ignore = spill_file->Write(xml, checkpoint->offset, checkpoint->size);
+        });
+}
+
+void UndoStack::AddPendingCheckpoint()
+{
+    if (!m_pending_checkpoint)
+    {
+        return;
+    }
+    if (m_pending_task.joinable())
+    {
+        m_pending_task.join();
+    }
+    const Checkpoint checkpoint = *m_pending_checkpoint;
+    m_pending_checkpoint.reset();
+
+    if (checkpoint.size == 0 || HasCheckpointAt(checkpoint.index))
+    {
+        return;
+    }
+    const auto position = std::ranges::upper_bound(m_checkpoints, checkpoint.index, {},
+                                                   &Checkpoint::index);
+    m_checkpoints.insert(position, checkpoint);
+}
+
+bool UndoStack::HasCheckpointAt(size_t index) const
+{
+    if (m_pending_checkpoint && m_pending_checkpoint->index == index)
+    {
+        return true;
+    }
+    return std::ranges::any_of(m_checkpoints,
+                               [index](const Checkpoint& checkpoint)
+                               {
+                                   return checkpoint.index == index;
+                               });
+}
+
+void UndoStack::EnforceMemoryLimit()
+{
+    if (m_undo_memory <= GetMemoryLimit())
+    {
+        return;
+    }
+
+    AddPendingCheckpoint();
+    CollapseCheckpoints();
+    if (m_undo_memory > GetMemoryLimit() && !HasCheckpointAt(m_undo.size()))
+    {
+        // Capturing the project is only worth the time now that entries have to be collapsed
+        CaptureCheckpoint();
+        CollapseCheckpoints();
+    }
+}
+
+void UndoStack::CollapseCheckpoints()
+{
+    const size_t limit = GetMemoryLimit();
+    while (m_undo_memory > limit)
+    {
+        // Everything before m_collapsed_count has already been collapsed, so the next range
+        // must start with a checkpoint at exactly that position.
+        const auto first = std::ranges::find_if(m_checkpoints,
+                                                [this](const Checkpoint& checkpoint)
+                                                {
+                                                    return checkpoint.index >= m_collapsed_count;
+                                                });
+        if (first == m_checkpoints.end() || first->index != m_collapsed_count ||
+            first + 1 == m_checkpoints.end())
+        {
+            return;
+        }
+
+        const size_t begin = first->index;
+        const size_t end = (first + 1)->index;
+        const size_t count = end - begin;
+
+        auto collapsed =
+            std::make_shared<CollapsedAction>(m_spill_file, first->offset, first->size, count);
+        for (size_t idx = begin; idx < end; ++idx)
+        {
+            m_undo_memory -= m_undo_sizes[idx];
+        }
+        m_undo.erase(m_undo.begin() + static_cast<ptrdiff_t>(begin),
+                     m_undo.begin() + static_cast<ptrdiff_t>(end));
+        m_undo_sizes.erase(m_undo_sizes.begin() + static_cast<ptrdiff_t>(begin),
+                           m_undo_sizes.begin() + static_cast<ptrdiff_t>(end));
+
+        const size_t memory_size = collapsed->GetMemorySize();
+        m_undo.insert(m_undo.begin() + static_cast<ptrdiff_t>(begin), std::move(collapsed));
+        m_undo_sizes.insert(m_undo_sizes.begin() + static_cast<ptrdiff_t>(begin), memory_size);
+        m_undo_memory += memory_size;
+
+        // The collapsed entry now owns the first checkpoint
+        m_checkpoints.erase(first);
+        for (auto& checkpoint: m_checkpoints)
+        {
+            if (checkpoint.index >= end)
+            {
+                checkpoint.index -= count - 1;
+            }
+        }
+
+        ++m_collapsed_count;
+        m_collapsed_extra += count - 1;
+    }
+}
+
 ///////////////////////////////// GroupUndoActions ////////////////////////////////////
 
 GroupUndoActions::GroupUndoActions(std::string_view undo_str, Node* sel_node) : UndoAction(undo_str)
@@ -80,6 +574,10 @@ GroupUndoActions::GroupUndoActions(std::string_view undo_str, Node* sel_node) :
 
 void GroupUndoActions::Change()
 {
+    // Freezing the frame lets the panels handle all of the nodes inserted or removed by a group
+    // (e.g., pasting all the tools of a toolbar) as a single batch.
+    const wxWindowUpdateLocker freeze(&wxGetFrame());
+
     for (const auto& iter: m_actions)
     {
         iter->Change();
@@ -93,6 +591,8 @@ void GroupUndoActions::Change()
 
 void GroupUndoActions::Revert()
 {
+    const wxWindowUpdateLocker freeze(&wxGetFrame());
+
     for (std::vector<UndoActionPtr>::reverse_iterator iter = m_actions.rbegin();
          iter != m_actions.rend(); ++iter)
     {
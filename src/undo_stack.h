@@ -8,10 +8,28 @@
 
 #pragma once
 
+// UndoStack keeps a running total of UndoAction::GetMemorySize() for every entry in the undo
+// stack. Once that exceeds the limit set in Preferences (get_UndoMemoryLimit()), the oldest
+// entries are collapsed into a single entry that restores a checkpoint of the entire project.
+// Checkpoints are serialized as compressed XML and kept in a temporary file (UndoSpillFile),
+// so nothing is dropped -- undoing past a collapsed entry simply goes back in larger steps.
+//
+// Serializing a large project is slow, so the project is only captured once the limit has
+// actually been exceeded, and every entry since the previous checkpoint is then collapsed. The
+// first checkpoint is normally the project file as loaded or last saved (SetFileCheckpoint()),
+// which is compressed and written on BackgroundTasks. Only a project that was not loaded
+// unchanged from a file (new, imported or upgraded) is captured before its first change.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "task_pool.h"  // PoolTask, BackgroundTasks
 #include "wxue_namespace/wxue_string.h"
 
 class Node;
 class NodeProperty;
+class UndoSpillFile;
 using NodeSharedPtr = std::shared_ptr<Node>;
 
 class UndoAction
@@ -33,7 +51,9 @@ public:
     // Called when Undo is requested
     virtual void Revert() = 0;
 
-    // Size of the UndoAction object itself, plus any additional memory it allocates.
+    // Size of the UndoAction object itself, plus any additional memory it allocates --
+    // including any nodes that are no longer in the project and are only kept alive by this
+    // action.
     virtual size_t GetMemorySize() = 0;
     [[nodiscard]] virtual NodeSharedPtr GetOldNode() { return nullptr; }
 
@@ -101,6 +121,12 @@ private:
 class UndoStack
 {
 public:
+    UndoStack();
+    ~UndoStack();
+
+    UndoStack(const UndoStack&) = delete;
+    UndoStack& operator=(const UndoStack&) = delete;
+
     // This will first call UndoAction->Change(), then clear the redo stack and push the
     // UndoAction onto the undo stack
     void Push(const UndoActionPtr& ptr);
@@ -125,16 +151,31 @@ public:
     [[nodiscard]] wxString GetUndoString();
     [[nodiscard]] wxString GetRedoString();
 
-    [[nodiscard]] size_t size() const { return m_undo.size(); }
+    // Number of actions that can be undone, including any that have been collapsed into a
+    // checkpoint.
+    [[nodiscard]] size_t size() const { return m_undo.size() + m_collapsed_extra; }
 
     [[nodiscard]] const std::vector<UndoActionPtr>& GetUndoVector() const { return m_undo; }
     [[nodiscard]] const std::vector<UndoActionPtr>& GetRedoVector() const { return m_redo; }
 
-    void clear()
-    {
-        m_redo.clear();
-        m_undo.clear();
-    }
+    // Total GetMemorySize() of every entry in the undo stack
+    [[nodiscard]] size_t GetMemoryUsed() const { return m_undo_memory; }
+
+    // get_UndoMemoryLimit() from Preferences, in bytes
+    [[nodiscard]] static size_t GetMemoryLimit();
+
+    // Number of bytes of compressed project checkpoints written to the temporary file
+    [[nodiscard]] size_t GetSpilledSize() const;
+
+    // Number of entries at the start of the undo stack that restore a project checkpoint
+    [[nodiscard]] size_t GetCollapsedCount() const { return m_collapsed_count; }
+
+    // Call after the project has been loaded from or saved to project_file, and only if the
+    // project is exactly what the file contains. The file is used as the checkpoint for the
+    // current position -- it is read now, and compressed and written on BackgroundTasks.
+    void SetFileCheckpoint(const wxue::string& project_file);
+
+    void clear();
 
     // When undo is called, the command is popped and pushed onto the redo stack. So to get at the
     // last undo command, you have to get the last item in the redo stack. Redo works just the
@@ -178,8 +219,55 @@ public:
     }
 
 private:
+    // Serializes the current project into the spill file and records it as the state before
+    // m_undo[m_undo.size()]
+    void CaptureCheckpoint();
+
+    // Waits for the checkpoint started by SetFileCheckpoint() (if any) and adds it to
+    // m_checkpoints
+    void AddPendingCheckpoint();
+
+    [[nodiscard]] bool HasCheckpointAt(size_t index) const;
+
+    // If the undo stack is over GetMemoryLimit(), captures a checkpoint of the current project
+    // and collapses the oldest entries.
+    void EnforceMemoryLimit();
+
+    // Collapses the oldest entries until the undo stack is within GetMemoryLimit(), or until
+    // there are no more pairs of checkpoints to collapse between.
+    void CollapseCheckpoints();
+
     std::vector<UndoActionPtr> m_undo;
     std::vector<UndoActionPtr> m_redo;
 
+    // GetMemorySize() of each entry in m_undo at the time it was pushed or redone. Entries below
+    // the top of the stack can't change until they are undone.
+    std::vector<size_t> m_undo_sizes;
+    size_t m_undo_memory { 0 };
+
+    struct Checkpoint
+    {
+        size_t index;  // project state before m_undo[index] was changed
+        std::uint64_t offset;
+        std::uint64_t size;
+    };
+    std::vector<Checkpoint> m_checkpoints;
+
+    // Set by SetFileCheckpoint() until AddPendingCheckpoint() is called. The task sets offset and
+    // size, and leaves size at 0 if the file could not be written.
+    std::shared_ptr<Checkpoint> m_pending_checkpoint;
+    PoolTask m_pending_task;
+
+    // Created the first time a checkpoint is captured. Collapsed entries share ownership so that
+    // the file remains valid while they are in the redo stack.
+    std::shared_ptr<UndoSpillFile> m_spill_file;
+
+    // Collapsed entries are always the oldest, so the first m_collapsed_count entries of the
+    // undo stack followed by the redo stack (in reverse) are collapsed. m_collapsed_extra is
+    // the number of actions replaced by the collapsed entries currently in the undo stack,
+    // minus one for each of those entries.
+    size_t m_collapsed_count { 0 };
+    size_t m_collapsed_extra { 0 };
+
     bool m_locked { false };
 };
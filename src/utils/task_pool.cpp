@@ -0,0 +1,198 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Process-wide task pool for background work
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <tuple>
+
+#include "task_pool.h"
+
+TaskPool& BackgroundTasks = TaskPool::getInstance();  // NOLINT (cppcheck-suppress)
+
+struct PoolTask::State
+{
+    std::function<void()> task;
+    std::string_view name;
+
+    // Set by whichever thread (worker or joiner) runs the task
+    std::atomic<bool> claimed { false };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool finished { false };
+    std::exception_ptr error;
+};
+
+PoolTask& PoolTask::operator=(PoolTask&& other)
+{
+    if (this != &other)
+    {
+        join();
+        m_state = std::move(other.m_state);
+    }
+    return *this;
+}
+
+PoolTask::~PoolTask()
+{
+    std::ignore = Wait();
+}
+
+void PoolTask::join()
+{
+    if (auto error = Wait(); error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+auto PoolTask::Wait() -> std::exception_ptr
+{
+    if (!m_state)
+    {
+        return nullptr;
+    }
+
+    auto state = std::move(m_state);
+    if (!state->claimed.exchange(true))
+    {
+        BackgroundTasks.RunTask(*state);
+    }
+    else
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->cv.wait(lock,
+                       [&state]
+                       {
+                           return state->finished;
+                       });
+    }
+
+    return state->error;
+}
+
+TaskPool::TaskPool()
+{
+    // The collection passes are short, so there is no point in more workers than cores. Two is
+    // the minimum so that the three passes of a single form can still overlap.
+    const size_t thread_count = std::max(std::thread::hardware_concurrency(), 2U);
+    m_workers.reserve(thread_count);
+    for (size_t idx = 0; idx < thread_count; ++idx)
+    {
+        m_workers.emplace_back(
+            [this](const std::stop_token& stop_token)
+            {
+                WorkerLoop(stop_token);
+            });
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    for (auto& worker: m_workers)
+    {
+        worker.request_stop();
+    }
+    m_queue_cv.notify_all();
+    m_workers.clear();  // std::jthread joins on destruction
+}
+
+auto TaskPool::Submit(std::string_view name, std::function<void()> task) -> PoolTask
+{
+    auto state = std::make_shared<PoolTask::State>();
+    state->task = std::move(task);
+    state->name = name;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_queue.push_back(state);
+    }
+    m_queue_cv.notify_one();
+
+    return PoolTask(std::move(state));
+}
+
+void TaskPool::WorkerLoop(const std::stop_token& stop_token)
+{
+    while (!stop_token.stop_requested())
+    {
+        std::shared_ptr<PoolTask::State> state;
+        {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            if (!m_queue_cv.wait(lock, stop_token,
+                                 [this]
+                                 {
+                                     return !m_queue.empty();
+                                 }))
+            {
+                return;  // stop requested
+            }
+            state = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        // The joining thread may have already run the task itself
+        if (!state->claimed.exchange(true))
+        {
+            RunTask(*state);
+        }
+    }
+}
+
+void TaskPool::RunTask(PoolTask::State& state)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+    try
+    {
+        state.task();
+    }
+    catch (...)
+    {
+        state.error = std::current_exception();
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time);
+
+    {
+        const std::lock_guard<std::mutex> lock(m_timing_mutex);
+        auto iter = m_timings.find(state.name);
+        if (iter == m_timings.end())
+        {
+            iter = m_timings.emplace(std::string(state.name), TaskTiming {}).first;
+            iter->second.name = state.name;
+        }
+        ++iter->second.count;
+        iter->second.total += elapsed;
+        iter->second.longest = std::max(iter->second.longest, elapsed);
+    }
+
+    state.task = nullptr;  // Release anything the task captured
+    {
+        const std::lock_guard<std::mutex> lock(state.mutex);
+        state.finished = true;
+    }
+    state.cv.notify_all();
+}
+
+auto TaskPool::GetTimings() const -> std::vector<TaskTiming>
+{
+    const std::lock_guard<std::mutex> lock(m_timing_mutex);
+    std::vector<TaskTiming> timings;
+    timings.reserve(m_timings.size());
+    for (const auto& iter: m_timings)
+    {
+        timings.push_back(iter.second);
+    }
+    return timings;
+}
+
+void TaskPool::ResetTimings()
+{
+    const std::lock_guard<std::mutex> lock(m_timing_mutex);
+    m_timings.clear();
+}
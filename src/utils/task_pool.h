@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Process-wide task pool for background work
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Rather than starting a std::thread for every piece of background work, the work is submitted
+// to a single pool of long-lived worker threads. The code generators run their collection passes
+// (CollectEventHandlers, CollectImageHeaders, ParseImageProperties) on it while they write the
+// rest of the class, and it is also used to decode project images and prefetch help pages.
+//
+// PoolTask is a drop-in replacement for the std::thread it replaces: joinable() and join() work
+// the same way. If join() is called before a worker has picked up the task, the task is run on
+// the calling thread instead of waiting -- this means a caller can never deadlock waiting for a
+// busy pool.
+//
+// Like std::jthread, a PoolTask that is destroyed or move-assigned over while it is still
+// joinable joins first, so a task can never outlive state that its caller owns. Call detach()
+// only when the task captures everything it uses by value or by shared_ptr.
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Accumulated run times for every task submitted under the same name
+struct TaskTiming
+{
+    std::string name;
+    size_t count { 0 };
+    std::chrono::microseconds total { 0 };
+    std::chrono::microseconds longest { 0 };
+};
+
+class PoolTask
+{
+public:
+    PoolTask() = default;
+    PoolTask(PoolTask&&) noexcept = default;
+    PoolTask(const PoolTask&) = delete;
+    PoolTask& operator=(const PoolTask&) = delete;
+
+    // Joins the current task (if any) before taking over other's task. Any exception thrown by
+    // the current task is rethrown.
+    PoolTask& operator=(PoolTask&& other);
+
+    // Joins the task if it is still joinable. An exception thrown by the task is discarded.
+    ~PoolTask();
+
+    // Returns true if the task has been submitted and neither join() nor detach() has been
+    // called yet.
+    [[nodiscard]] auto joinable() const noexcept -> bool { return m_state != nullptr; }
+
+    // Waits for the task to complete, running it on the calling thread if no worker has started
+    // it yet. Any exception thrown by the task is rethrown here.
+    void join();
+
+    // Lets the task run (or be discarded at shutdown) without anyone waiting for it.
+    void detach() noexcept { m_state.reset(); }
+
+private:
+    friend class TaskPool;
+    struct State;
+
+    explicit PoolTask(std::shared_ptr<State> state) : m_state(std::move(state)) {}
+
+    // Waits for the task the same way join() does, and returns any exception it threw
+    [[nodiscard]] auto Wait() -> std::exception_ptr;
+
+    std::shared_ptr<State> m_state;
+};
+
+class TaskPool
+{
+private:
+    TaskPool();
+
+public:
+    TaskPool(TaskPool const&) = delete;
+    TaskPool(TaskPool&&) = delete;
+    TaskPool& operator=(TaskPool const&) = delete;
+    TaskPool& operator=(TaskPool&&) = delete;
+
+    ~TaskPool();
+
+    static TaskPool& getInstance()
+    {
+        static TaskPool instance;
+        return instance;
+    }
+
+    // name is used to group timings -- each collection pass uses its function name.
+    [[nodiscard]] auto Submit(std::string_view name, std::function<void()> task) -> PoolTask;
+
+    // Returns the timings of every task name, sorted by name.
+    [[nodiscard]] auto GetTimings() const -> std::vector<TaskTiming>;
+    void ResetTimings();
+
+    [[nodiscard]] auto GetThreadCount() const { return m_workers.size(); }
+
+private:
+    friend class PoolTask;
+
+    void WorkerLoop(const std::stop_token& stop_token);
+
+    // Runs the task and signals anyone waiting in PoolTask::join(). The caller must have
+    // already claimed the task.
+    void RunTask(PoolTask::State& state);
+
+    std::vector<std::jthread> m_workers;
+
+    std::deque<std::shared_ptr<PoolTask::State>> m_queue;
+    std::mutex m_queue_mutex;
+    std::condition_variable_any m_queue_cv;
+
+    mutable std::mutex m_timing_mutex;
+    std::map<std::string, TaskTiming, std::less<>> m_timings;
+};
+
+extern TaskPool& BackgroundTasks;  // NOLINT (cppcheck-suppress)
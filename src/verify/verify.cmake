@@ -3,4 +3,7 @@ set (verify_files
     ${CMAKE_CURRENT_LIST_DIR}/verify_ttwx.cpp
     ${CMAKE_CURRENT_LIST_DIR}/verify_string_vector.cpp
     ${CMAKE_CURRENT_LIST_DIR}/verify_view_vector.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/verify_line_scan.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/verify_node_props.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/verify_node_tree.cpp
 )
@@ -27,6 +27,21 @@ void MainFrame::OnVerifyTTWX(wxCommandEvent& /* event unused */)  // NOLINT (cpp
     {
         MSG_INFO("VerifyViewVector: All tests passed successfully!");
     }
+
+    if (VerifyLineScan())
+    {
+        MSG_INFO("VerifyLineScan: All tests passed successfully!");
+    }
+
+    if (VerifyNodeProps())
+    {
+        MSG_INFO("VerifyNodeProps: All tests passed successfully!");
+    }
+
+    if (VerifyNodeTree())
+    {
+        MSG_INFO("VerifyNodeTree: All tests passed successfully!");
+    }
 }
 
 #endif  // Ends debug section.
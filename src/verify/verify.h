@@ -28,3 +28,6 @@
 auto VerifyTTwx() -> bool;
 auto VerifyStringVector() -> bool;
 auto VerifyViewVector() -> bool;
+auto VerifyLineScan() -> bool;
+auto VerifyNodeProps() -> bool;
+auto VerifyNodeTree() -> bool;
@@ -0,0 +1,203 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Verify and benchmark ViewVector line splitting and searching
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+// The benchmark writes a generated source file of at least generated_file_size bytes with mixed
+// line endings, then compares ReadFile(), SetString() and FindLineContaining() with the
+// implementations they replaced. The results must be identical, and the timings are reported
+// with MSG_INFO.
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "verify.h"
+
+#include "assertion_dlg.h"  // Assertion Dialog
+
+#include "wxue_namespace/wxue_string_vector.h"  // wxue::StringVector
+#include "wxue_namespace/wxue_view_vector.h"    // wxue::ViewVector
+
+namespace
+{
+    constexpr size_t generated_file_size = 8 * 1024 * 1024;
+    constexpr size_t benchmark_passes = 5;
+
+    constexpr std::string_view last_line_text = "FindThisLineInTheGeneratedFile";
+
+    // Code-like lines of varying length. Every seventh line ends with "\r\n" and every 101st
+    // line with "\r", so all three line breaks are exercised.
+    auto GenerateText() -> std::string
+    {
+        std::string text;
+        text.reserve(generated_file_size + 256);
+        for (size_t line = 0; text.size() < generated_file_size; ++line)
+        {
+            text += std::string(4 * (line % 4), ' ');
+            text += std::format("auto value_{} = node->as_string(prop_{});  // {}", line,
+                                line % 97, std::string(line % 23, '*'));
+            text += (line % 7 == 0) ? "\r\n" : (line % 101 == 0 ? "\r" : "\n");
+        }
+        text += last_line_text;
+        text += "();\n";
+        return text;
+    }
+
+    // The line splitting ViewVector::SetString() used before find_line_break(): every
+    // separator is compared at every position.
+    auto LegacySplit(std::string_view str, const std::vector<std::string_view>& separators)
+        -> std::vector<std::string_view>
+    {
+        auto find_first_separator = [&](size_t start_pos) -> std::pair<size_t, size_t>
+        {
+            for (size_t pos = start_pos; pos < str.size(); ++pos)
+            {
+                for (const auto& separator: separators)
+                {
+                    if (!separator.empty() && pos + separator.size() <= str.size() &&
+                        str.substr(pos, separator.size()) == separator)
+                    {
+                        return { pos, separator.size() };
+                    }
+                }
+            }
+            return { std::string::npos, 0 };
+        };
+
+        std::vector<std::string_view> lines;
+        for (size_t start = 0; start < str.size();)
+        {
+            auto [separator_pos, separator_length] = find_first_separator(start);
+            size_t segment_end = (separator_pos != std::string::npos) ? separator_pos : str.size();
+            lines.emplace_back(str.substr(start, segment_end - start));
+            if (separator_pos == std::string::npos)
+            {
+                break;
+            }
+            start = separator_pos + separator_length;
+        }
+        return lines;
+    }
+
+    // The per-line search ViewVector::FindLineContaining() used for CASE::exact
+    auto LegacyFindLine(const wxue::ViewVector& lines, std::string_view str) -> size_t
+    {
+        for (size_t line = 0; line < lines.size(); ++line)
+        {
+            if (lines[line].contains(str))
+            {
+                return line;
+            }
+        }
+        return wxue::npos;
+    }
+
+    // Returns the average time of benchmark_passes calls to func
+    template <typename T>
+    auto Milliseconds(T&& func) -> double
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+        for (size_t pass = 0; pass < benchmark_passes; ++pass)
+        {
+            func();
+        }
+        const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start_time;
+        return elapsed.count() / static_cast<double>(benchmark_passes);
+    }
+}  // namespace
+
+auto VerifyLineScan() -> bool
+{
+    bool result = true;
+
+    const std::string text = GenerateText();
+    const std::string filename = "verify_line_scan_temp.txt";
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file.write(text.c_str(), static_cast<std::streamsize>(text.size()));
+    }
+
+    std::vector<std::string_view> legacy_lines;
+    const double legacy_split_time = Milliseconds(
+        [&]()
+        {
+            legacy_lines = LegacySplit(text, wxue::line_separators);
+        });
+
+    wxue::ViewVector view_vector;
+    const double split_time = Milliseconds(
+        [&]()
+        {
+            view_vector.SetString(std::string_view(text), wxue::line_separators);
+        });
+    if (!std::ranges::equal(view_vector, legacy_lines, std::equal_to<std::string_view>()))
+    {
+        FAIL_MSG("ViewVector::SetString: lines differ from the legacy implementation");
+        result = false;
+    }
+
+    const double read_time = Milliseconds(
+        [&]()
+        {
+            std::ignore = view_vector.ReadFile(std::string_view(filename));
+        });
+    if (!std::ranges::equal(view_vector, legacy_lines, std::equal_to<std::string_view>()))
+    {
+        FAIL_MSG("ViewVector::ReadFile: lines differ from the legacy implementation");
+        result = false;
+    }
+
+    wxue::StringVector string_vector;
+    const double string_split_time = Milliseconds(
+        [&]()
+        {
+            string_vector.SetString(std::string_view(text), wxue::line_separators);
+        });
+    if (!std::ranges::equal(string_vector, legacy_lines, std::equal_to<std::string_view>()))
+    {
+        FAIL_MSG("StringVector::SetString: lines differ from the legacy implementation");
+        result = false;
+    }
+
+    size_t legacy_found = wxue::npos;
+    const double legacy_find_time = Milliseconds(
+        [&]()
+        {
+            legacy_found = LegacyFindLine(view_vector, last_line_text);
+        });
+
+    size_t found = wxue::npos;
+    const double find_time = Milliseconds(
+        [&]()
+        {
+            found = view_vector.FindLineContaining(last_line_text);
+        });
+    if (found != legacy_found || found != view_vector.size() - 1)
+    {
+        FAIL_MSG("FindLineContaining: did not find the last line");
+        result = false;
+    }
+
+    std::filesystem::remove(filename);
+
+    MSG_INFO(std::format("VerifyLineScan: {} KB, {} lines", text.size() / 1024,
+                         view_vector.size()));
+    MSG_INFO(std::format("  split: {:.2f} ms (legacy {:.2f} ms)", split_time,
+                         legacy_split_time));
+    MSG_INFO(std::format("  ReadFile: {:.2f} ms", read_time));
+    MSG_INFO(std::format("  StringVector split: {:.2f} ms", string_split_time));
+    MSG_INFO(std::format("  FindLineContaining (last line): {:.2f} ms (legacy {:.2f} ms)",
+                         find_time, legacy_find_time));
+
+    return result;
+}
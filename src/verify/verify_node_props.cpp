@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Verify and benchmark Node property and event lookups and storage
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+// Load a large project before running this -- the benchmark walks every node in the current
+// project. Compare the numbers against a build from before the node layout change to see the
+// difference in lookups per second and resident memory.
+
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "verify.h"
+
+#include "assertion_dlg.h"    // Assertion Dialog
+#include "node.h"             // Node class
+#include "project_handler.h"  // ProjectHandler class
+
+namespace
+{
+    void CollectNodes(Node* node, std::vector<Node*>& nodes)
+    {
+        nodes.push_back(node);
+        for (const auto& child: node->get_ChildNodePtrs())
+        {
+            CollectNodes(child.get(), nodes);
+        }
+    }
+
+    // Returns the resident set size in KB, or 0 if the platform doesn't make it easy to get
+    auto GetResidentKB() -> size_t
+    {
+#if defined(__linux__)
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (line.starts_with("VmRSS:"))
+            {
+                return std::stoul(line.substr(6));
+            }
+        }
+#endif  // __linux__
+        return 0;
+    }
+}  // namespace
+
+auto VerifyNodeProps() -> bool
+{
+    Node* project = Project.get_ProjectNode();
+    if (!project)
+    {
+        return false;
+    }
+
+    std::vector<Node*> nodes;
+    CollectNodes(project, nodes);
+
+    bool result = true;
+
+    // The project loader's perfect hash must agree with rmap_PropNames for every name
+    for (const auto& [prop_name, name]: map_PropNames)
+    {
+        if (LookupPropName(name) != prop_name || FindProp(name) != prop_name)
+        {
+            FAIL_MSG(std::format("LookupPropName: wrong result for {}", name));
+            result = false;
+        }
+    }
+    if (LookupPropName("not_a_property") != prop_unknown)
+    {
+        FAIL_MSG("LookupPropName: found a property that doesn't exist");
+        result = false;
+    }
+    size_t prop_count = 0;
+    size_t pooled_count = 0;
+    size_t prop_bytes = 0;
+    size_t event_count = 0;
+
+    // Every lookup must find the same property a linear search of the node finds -- the last
+    // property added with that name.
+    for (auto* node: nodes)
+    {
+        auto& props = node->get_PropsVector();
+        prop_count += props.size();
+        for (const auto& prop: props)
+        {
+            pooled_count += prop.is_ValuePooled() ? 1 : 0;
+            prop_bytes += prop.get_PropSize();
+        }
+        for (size_t idx = 0; idx < prop_name_array_size; ++idx)
+        {
+            const auto name = static_cast<PropName>(idx);
+            NodeProperty* expected = nullptr;
+            for (auto& prop: std::views::reverse(props))
+            {
+                if (prop.get_name() == name)
+                {
+                    expected = &prop;
+                    break;
+                }
+            }
+            if (node->get_PropPtr(name) != expected)
+            {
+                FAIL_MSG(std::format("{}: wrong lookup result for {}", node->get_DeclName(),
+                                     map_PropNames.at(name)));
+                result = false;
+            }
+        }
+
+        auto& events = node->get_Events();
+        event_count += events.size();
+        for (auto& event: events)
+        {
+            if (node->get_Event(event.get_name()) != &event)
+            {
+                FAIL_MSG(std::format("{}: wrong lookup result for {}", node->get_DeclName(),
+                                     event.get_name().c_str()));
+                result = false;
+            }
+        }
+    }
+
+    // Look up every property name (present or not) on every node, the same mix of hits and
+    // misses the code generators produce.
+    constexpr size_t passes = 20;
+    size_t found = 0;
+    auto start_time = std::chrono::steady_clock::now();
+    for (size_t pass = 0; pass < passes; ++pass)
+    {
+        for (auto* node: nodes)
+        {
+            for (size_t idx = 0; idx < prop_name_array_size; ++idx)
+            {
+                found += node->HasProp(static_cast<PropName>(idx)) ? 1 : 0;
+            }
+        }
+    }
+    const std::chrono::duration<double> prop_elapsed =
+        std::chrono::steady_clock::now() - start_time;
+
+    start_time = std::chrono::steady_clock::now();
+    for (size_t pass = 0; pass < passes; ++pass)
+    {
+        for (auto* node: nodes)
+        {
+            for (const auto& event: node->get_Events())
+            {
+                found += node->get_Event(event.get_name()) ? 1 : 0;
+            }
+        }
+    }
+    const std::chrono::duration<double> event_elapsed =
+        std::chrono::steady_clock::now() - start_time;
+
+    const auto prop_lookups = static_cast<double>(passes * nodes.size() * prop_name_array_size);
+    const auto event_lookups = static_cast<double>(passes * event_count);
+
+    MSG_INFO(std::format("VerifyNodeProps: {} nodes, {} properties, {} events ({} hits)",
+                         nodes.size(), prop_count, event_count, found));
+    const auto [pool_count, pool_bytes] = PropValuePool::GetStats();
+    MSG_INFO(std::format("  pooled values: {} of {} properties, {} property bytes ({} pooled "
+                         "strings using {} bytes)",
+                         pooled_count, prop_count, prop_bytes, pool_count, pool_bytes));
+    MSG_INFO(std::format("  property lookups: {:.1f} million/sec",
+                         prop_lookups / prop_elapsed.count() / 1'000'000.0));
+    if (event_lookups > 0)
+    {
+        MSG_INFO(std::format("  event lookups: {:.1f} million/sec",
+                             event_lookups / event_elapsed.count() / 1'000'000.0));
+    }
+    if (auto resident = GetResidentKB(); resident)
+    {
+        MSG_INFO(std::format("  resident memory: {} KB", resident));
+    }
+
+    return result;
+}
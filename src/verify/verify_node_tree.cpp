@@ -0,0 +1,166 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Verify and benchmark Node tree copy, load and release
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+// The benchmark repeats the forms of the current project until the tree has at least
+// tree_node_count nodes, then times copying, loading and releasing that tree. Load a project
+// with a variety of forms before running this so the tree is representative.
+
+#include <chrono>
+#include <format>
+#include <vector>
+
+#include "verify.h"
+
+#include "assertion_dlg.h"    // Assertion Dialog
+#include "node.h"             // Node class
+#include "node_arena.h"       // NodeArena -- Monotonic arena for Node allocations
+#include "node_creator.h"     // NodeCreator -- Class used to create nodes
+#include "project_handler.h"  // ProjectHandler class
+
+#include "pugixml.hpp"
+
+namespace
+{
+    constexpr size_t tree_node_count = 50'000;
+
+    auto CountNodes(const Node* node) -> size_t
+    {
+        size_t count = 1;
+        for (const auto& child: node->get_ChildNodePtrs())
+        {
+            count += CountNodes(child.get());
+        }
+        return count;
+    }
+
+    // Returns false if any child's parent link doesn't point to the node that owns it
+    auto VerifyParentLinks(Node* node) -> bool
+    {
+        for (const auto& child: node->get_ChildNodePtrs())
+        {
+            if (child->get_Parent() != node || !VerifyParentLinks(child.get()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto Milliseconds(std::chrono::steady_clock::time_point start_time) -> double
+    {
+        const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start_time;
+        return elapsed.count();
+    }
+}  // namespace
+
+auto VerifyNodeTree() -> bool
+{
+    Node* project = Project.get_ProjectNode();
+    if (!project || !project->get_ChildCount())
+    {
+        return false;
+    }
+
+    bool result = true;
+
+    // Build the benchmark tree out of copies of the project's top-level children
+    auto large_project = NodeCreation.MakeCopy(project);
+    const size_t project_nodes = CountNodes(project);
+    for (size_t total = CountNodes(large_project.get()); total < tree_node_count;
+         total += project_nodes - 1)
+    {
+        for (const auto& child: project->get_ChildNodePtrs())
+        {
+            large_project->AdoptChild(NodeCreation.MakeCopy(child.get()));
+        }
+    }
+    const size_t node_count = CountNodes(large_project.get());
+
+    // The arenas are created here rather than by MakeCopy() and CreateProjectNode() so that
+    // their allocation counts can be reported. Without an arena, each node is a separate heap
+    // allocation.
+    auto copy_arena = NodeArena::Create(64 * 1024);
+    auto start_time = std::chrono::steady_clock::now();
+    NodeSharedPtr copy;
+    {
+        const NodeArena::Scope arena_scope(copy_arena);
+        copy = NodeCreation.MakeCopy(large_project);
+    }
+    const double copy_time = Milliseconds(start_time);
+    const auto copy_stats = copy_arena->GetStats();
+    copy_arena.reset();
+
+    if (CountNodes(copy.get()) != node_count || !VerifyParentLinks(copy.get()))
+    {
+        FAIL_MSG("MakeCopy: copy does not match the original tree");
+        result = false;
+    }
+
+    // Load from an in-memory document so that disk speed doesn't affect the result
+    pugi::xml_document doc;
+    auto xml_project = doc.append_child("node");
+    int project_version = curSupportedVer;
+    large_project->AddNodeToDoc(xml_project, project_version);
+
+    auto load_arena = NodeArena::Create(256 * 1024);
+    start_time = std::chrono::steady_clock::now();
+    NodeSharedPtr loaded;
+    {
+        const NodeArena::Scope arena_scope(load_arena);
+        loaded = NodeCreation.CreateProjectNode(&xml_project, false);
+    }
+    const double load_time = Milliseconds(start_time);
+    const auto load_stats = load_arena->GetStats();
+    load_arena.reset();
+
+    if (!loaded || CountNodes(loaded.get()) != node_count || !VerifyParentLinks(loaded.get()))
+    {
+        FAIL_MSG("CreateProjectNode: loaded tree does not match the original tree");
+        result = false;
+    }
+
+    // A child that outlives its parent must not be left pointing at it
+    const NodeSharedPtr first_form = copy->get_ChildPtr(0);
+
+    // Releasing the last reference is all it takes to free a tree -- this is what closing a
+    // project does.
+    start_time = std::chrono::steady_clock::now();
+    copy.reset();
+    loaded.reset();
+    const double release_time = Milliseconds(start_time);
+
+    if (first_form->get_Parent())
+    {
+        FAIL_MSG("Node: child still points to a parent that has been destroyed");
+        result = false;
+    }
+
+    // The same applies to a child that is removed while its parent is still alive
+    const NodeSharedPtr removed_child = large_project->get_ChildPtr(0);
+    large_project->RemoveChild(removed_child);
+    const NodeSharedPtr cleared_child =
+        large_project->get_ChildCount() ? large_project->get_ChildPtr(0) : removed_child;
+    large_project->removeAllChildren();
+    if (removed_child->get_Parent() || cleared_child->get_Parent())
+    {
+        FAIL_MSG("Node: removed child still points to its former parent");
+        result = false;
+    }
+
+    MSG_INFO(std::format("VerifyNodeTree: {} nodes", node_count));
+    MSG_INFO(std::format("  MakeCopy: {:.1f} ms, {} node allocations in {} heap blocks ({} KB)",
+                         copy_time, copy_stats.allocations, copy_stats.blocks,
+                         copy_stats.block_bytes / 1024));
+    MSG_INFO(std::format("  project load (from memory): {:.1f} ms, {} node allocations in {} "
+                         "heap blocks ({} KB)",
+                         load_time, load_stats.allocations, load_stats.blocks,
+                         load_stats.block_bytes / 1024));
+    MSG_INFO(std::format("  project close (two trees): {:.1f} ms", release_time));
+
+    return result;
+}
@@ -497,6 +497,36 @@ auto VerifyViewVector() -> bool  // NOLINT(clang-analyzer-core.cognitive-complex
         std::filesystem::remove(tempFilename);
     }
 
+    // Test 12: FindLineContaining
+    {
+        wxue::ViewVector view_vector;
+
+        // Long enough that the search covers full SIMD blocks as well as the remainder
+        view_vector.ReadString(std::string_view(
+            "first line of the text\r\nsecond line ends here\n\nfourth line: needle\rlast"));
+        VERIFY_EQUAL(view_vector.FindLineContaining("needle"), 3U, "needle is on the fourth line");
+        VERIFY_EQUAL(view_vector.FindLineContaining("line", 2), 3U,
+                     "Search should begin at startline");
+        VERIFY_EQUAL(view_vector.FindLineContaining("text\r\nsecond"), wxue::npos,
+                     "A match that spans a line break should not be found");
+        VERIFY_EQUAL(view_vector.FindLineContaining("herefourth"), wxue::npos,
+                     "Lines should not be joined together");
+        VERIFY_EQUAL(view_vector.FindLineContaining("NEEDLE", 0, wxue::CASE::either), 3U,
+                     "Case-insensitive search should find needle");
+        VERIFY_EQUAL(view_vector.FindLineContaining("first", 10), wxue::npos,
+                     "startline past the end should not find anything");
+
+        // Lines added directly are in separate allocations, so they must be searched one at a
+        // time rather than as a single block.
+        const std::string first_line("a separate allocation");
+        const std::string second_line("another one with the needle");
+        wxue::ViewVector separate_lines;
+        separate_lines.emplace_back(first_line);
+        separate_lines.emplace_back(second_line);
+        VERIFY_EQUAL(separate_lines.FindLineContaining("needle"), 1U,
+                     "needle should be found in a separately allocated line");
+    }
+
     // If we reach here, all tests passed
 
     return true;
@@ -13,6 +13,7 @@
 #include "wxue.h"
 
 #include "wxue_string_vector.h"
+#include "wxue_view_vector.h"  // wxue::find_line_break()
 
 namespace
 {
@@ -142,8 +143,17 @@ void wxue::StringVector::SetString(std::string_view str,
         return;
     }
 
+    // find_first_separator() searches the rest of the string for each separator, which is
+    // quadratic when splitting a file without any "\r" characters into lines.
+    const bool is_line_breaks = (separators == line_separators);
+    auto next_separator = [&](size_t start) -> std::pair<size_t, size_t>
+    {
+        return is_line_breaks ? find_line_break(str, start) :
+                                find_first_separator(str, separators, start);
+    };
+
     // If there is a string with no separator, then add the string and return
-    if (auto [separator_pos, separator_length] = find_first_separator(str, separators, 0);
+    if (auto [separator_pos, separator_length] = next_separator(0);
         separator_pos == std::string::npos)
     {
         // No separator found, so just add the entire string
@@ -161,7 +171,7 @@ void wxue::StringVector::SetString(std::string_view str,
     for (size_t start = 0; start < str.size();)
     {
         // Find the next separator
-        auto [separator_pos, separator_length] = find_first_separator(str, separators, start);
+        auto [separator_pos, separator_length] = next_separator(start);
 
         // Determine the end position for this segment
         size_t segment_end = (separator_pos != std::string::npos) ? separator_pos : str.size();
@@ -244,7 +254,6 @@ auto wxue::StringVector::ReadFile(std::string_view filename) -> bool
     m_buffer.resize(file_size.GetValue());
     file.Read(m_buffer.data(), m_buffer.size());
 
-    std::vector<std::string_view> lineSeparators = { "\r\n", "\r", "\n" };
     std::string_view string_buffer(m_buffer);
 
     if (m_buffer.size() > 2 && m_buffer[0] == BOM_UTF8_0 && m_buffer[1] == BOM_UTF8_1 &&
@@ -253,7 +262,7 @@ auto wxue::StringVector::ReadFile(std::string_view filename) -> bool
         // BOM utf-8 string, so skip over the BOM and process normally
         string_buffer.remove_prefix(3);
     }
-    SetString(string_buffer, lineSeparators);
+    SetString(string_buffer, line_separators);
     m_buffer.clear();
     m_buffer.shrink_to_fit();
 
@@ -265,8 +274,7 @@ void wxue::StringVector::ReadString(std::string_view str)
     if (!str.empty())
     {
         m_buffer.assign(str);
-        std::vector<std::string_view> lineSeparators = { "\r\n", "\r", "\n" };
-        SetString(m_buffer, lineSeparators);
+        SetString(m_buffer, line_separators);
 
         // WARNING! str probably points to m_buffer, so it will be invalid after the clear().
         m_buffer.clear();
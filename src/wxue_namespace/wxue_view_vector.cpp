@@ -5,9 +5,23 @@
 // License:   Apache License -- see ../../LICENSE
 /////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>   // for std::ranges::upper_bound
+#include <bit>         // for std::countr_zero
 #include <cstddef>
+#include <cstring>     // for std::memcmp
+#include <functional>  // for std::less
 #include <ranges>
 
+// SSE2 is part of the x64 baseline, so it's available in every 64-bit build. AVX2 is only used
+// when the compiler has been told to target it (-mavx2, -march=native, /arch:AVX2, etc.).
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <immintrin.h>  // SSE2 and AVX2 intrinsics
+    #define WXUE_SIMD_SSE2
+    #if defined(__AVX2__)
+        #define WXUE_SIMD_AVX2
+    #endif
+#endif
+
 #include <wx/file.h>      // wxFile - encapsulates a file handle
 #include <wx/filename.h>  // wxFileName - encapsulates a file path
 
@@ -61,11 +75,163 @@ namespace
 
         return { earliest_pos, sep_length };
     }
+
+#if defined(WXUE_SIMD_SSE2)
+    // Each of the *_mask() functions returns a bit mask with one bit set for each character in
+    // the block that matches.
+
+    auto line_break_mask(__m128i block) -> unsigned int
+    {
+        const __m128i is_cr = _mm_cmpeq_epi8(block, _mm_set1_epi8('\r'));
+        const __m128i is_lf = _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'));
+        return static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(is_cr, is_lf)));
+    }
+
+    // Positions where both the first and last characters of the sub-string match
+    auto candidate_mask_128(const char* pos, size_t last, char first_char, char last_char)
+        -> unsigned int
+    {
+        const __m128i first_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+        const __m128i last_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos + last));
+        return static_cast<unsigned int>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_block, _mm_set1_epi8(first_char)),
+                                            _mm_cmpeq_epi8(last_block, _mm_set1_epi8(last_char)))));
+    }
+#endif  // WXUE_SIMD_SSE2
+
+#if defined(WXUE_SIMD_AVX2)
+    auto line_break_mask(__m256i block) -> unsigned int
+    {
+        const __m256i is_cr = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\r'));
+        const __m256i is_lf = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'));
+        return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_or_si256(is_cr, is_lf)));
+    }
+
+    auto candidate_mask_256(const char* pos, size_t last, char first_char, char last_char)
+        -> unsigned int
+    {
+        const __m256i first_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos));
+        const __m256i last_block =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos + last));
+        return static_cast<unsigned int>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(first_block, _mm256_set1_epi8(first_char)),
+                             _mm256_cmpeq_epi8(last_block, _mm256_set1_epi8(last_char)))));
+    }
+#endif  // WXUE_SIMD_AVX2
+
+    // Returns the offset of the first '\r' or '\n' in [pos, end), or npos if there isn't one
+    auto scan_line_break(const char* pos, const char* end) -> size_t
+    {
+        const char* const begin = pos;
+#if defined(WXUE_SIMD_AVX2)
+        for (; end - pos >= 32; pos += 32)
+        {
+            if (const auto mask =
+                    line_break_mask(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos)));
+                mask != 0)
+            {
+                return static_cast<size_t>(pos - begin + std::countr_zero(mask));
+            }
+        }
+#endif
+#if defined(WXUE_SIMD_SSE2)
+        for (; end - pos >= 16; pos += 16)
+        {
+            if (const auto mask =
+                    line_break_mask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)));
+                mask != 0)
+            {
+                return static_cast<size_t>(pos - begin + std::countr_zero(mask));
+            }
+        }
+#endif
+        for (; pos < end; ++pos)
+        {
+            if (*pos == '\r' || *pos == '\n')
+            {
+                return static_cast<size_t>(pos - begin);
+            }
+        }
+        return wxue::npos;
+    }
 }  // namespace
 
+auto wxue::find_line_break(std::string_view str, size_t start) noexcept
+    -> std::pair<size_t, size_t>
+{
+    if (start >= str.size())
+    {
+        return { npos, 0 };
+    }
+
+    auto offset = scan_line_break(str.data() + start, str.data() + str.size());
+    if (offset == npos)
+    {
+        return { npos, 0 };
+    }
+
+    auto pos = start + offset;
+    if (str[pos] == '\r' && pos + 1 < str.size() && str[pos + 1] == '\n')
+    {
+        return { pos, 2 };
+    }
+    return { pos, 1 };
+}
+
+auto wxue::find_substring(std::string_view str, std::string_view sub, size_t start) noexcept
+    -> size_t
+{
+    // Short sub-strings are left to std::string_view, which uses memchr() for a single character
+    if (sub.size() < 2 || start > str.size() || sub.size() > str.size() - start)
+    {
+        return str.find(sub, start);
+    }
+
+    // Every block is checked for positions where the first and last characters of sub match,
+    // and only those positions are compared against the rest of sub.
+
+    const size_t last = sub.size() - 1;
+    const char* const begin = str.data();
+    const char* pos = begin + start;
+
+    // One past the last position where sub could start
+    [[maybe_unused]] const char* const stop = begin + str.size() - last;
+
+#if defined(WXUE_SIMD_AVX2)
+    for (; stop - pos >= 32; pos += 32)
+    {
+        for (auto mask = candidate_mask_256(pos, last, sub.front(), sub.back()); mask != 0;
+             mask &= mask - 1)
+        {
+            const auto bit = static_cast<size_t>(std::countr_zero(mask));
+            if (std::memcmp(pos + bit + 1, sub.data() + 1, last - 1) == 0)
+            {
+                return static_cast<size_t>(pos - begin) + bit;
+            }
+        }
+    }
+#endif
+#if defined(WXUE_SIMD_SSE2)
+    for (; stop - pos >= 16; pos += 16)
+    {
+        for (auto mask = candidate_mask_128(pos, last, sub.front(), sub.back()); mask != 0;
+             mask &= mask - 1)
+        {
+            const auto bit = static_cast<size_t>(std::countr_zero(mask));
+            if (std::memcmp(pos + bit + 1, sub.data() + 1, last - 1) == 0)
+            {
+                return static_cast<size_t>(pos - begin) + bit;
+            }
+        }
+    }
+#endif
+    return str.find(sub, static_cast<size_t>(pos - begin));
+}
+
 void wxue::ViewVector::SetString(std::string_view str, std::string_view separator, TRIM trim)
 {
     clear();
+    m_source = str;
     if (trim == TRIM::both || trim == TRIM::left)
     {
         str.remove_prefix(trim_left(str, 0));
@@ -112,14 +278,15 @@ void wxue::ViewVector::SetString(std::string_view str, std::string_view separato
             trimmed_end = trim_right(str, segment_start, segment_end);
         }
 
-        // Add the segment to the vector (empty string_view if no text)
+        // Add the segment to the vector (empty string_view if no text). Empty segments still
+        // point into str so that the entries stay in order for FindLineContaining().
         if (trimmed_end > segment_start)
         {
             emplace_back(str.substr(segment_start, trimmed_end - segment_start));
         }
         else
         {
-            emplace_back(std::string_view(""));
+            emplace_back(str.substr(start, 0));
         }
 
         // If no more separators found, we're done
@@ -137,6 +304,7 @@ void wxue::ViewVector::SetString(std::string_view str,
                                  const std::vector<std::string_view>& separators, TRIM trim)
 {
     clear();
+    m_source = str;
     if (trim == TRIM::both || trim == TRIM::left)
     {
         str.remove_prefix(trim_left(str, 0));
@@ -146,8 +314,17 @@ void wxue::ViewVector::SetString(std::string_view str,
         return;
     }
 
+    // Splitting text into lines is by far the most common use, so rather than checking each
+    // separator at every position, line breaks get a dedicated scanner.
+    const bool is_line_breaks = (separators == line_separators);
+    auto next_separator = [&](size_t start) -> std::pair<size_t, size_t>
+    {
+        return is_line_breaks ? find_line_break(str, start) :
+                                find_first_separator(str, separators, start);
+    };
+
     // If there is a string with no separator, then add the string and return
-    if (auto [separator_pos, separator_length] = find_first_separator(str, separators, 0);
+    if (auto [separator_pos, separator_length] = next_separator(0);
         separator_pos == std::string::npos)
     {
         // No separator found, so just add the entire string
@@ -165,7 +342,7 @@ void wxue::ViewVector::SetString(std::string_view str,
     for (size_t start = 0; start < str.size();)
     {
         // Find the next separator
-        auto [separator_pos, separator_length] = find_first_separator(str, separators, start);
+        auto [separator_pos, separator_length] = next_separator(start);
 
         // Determine the end position for this segment
         size_t segment_end = (separator_pos != std::string::npos) ? separator_pos : str.size();
@@ -184,14 +361,15 @@ void wxue::ViewVector::SetString(std::string_view str,
             trimmed_end = trim_right(str, segment_start, segment_end);
         }
 
-        // Add the segment to the vector (empty string_view if no text)
+        // Add the segment to the vector (empty string_view if no text). Empty segments still
+        // point into str so that the entries stay in order for FindLineContaining().
         if (trimmed_end > segment_start)
         {
             emplace_back(str.substr(segment_start, trimmed_end - segment_start));
         }
         else
         {
-            emplace_back(std::string_view(""));
+            emplace_back(str.substr(start, 0));
         }
 
         // If no more separators found, we're done
@@ -208,6 +386,38 @@ void wxue::ViewVector::SetString(std::string_view str,
 auto wxue::ViewVector::FindLineContaining(std::string_view str, size_t startline,
                                           CASE checkcase) const -> size_t
 {
+    if (startline >= size())
+    {
+        return wxue::npos;
+    }
+
+    if (checkcase == CASE::exact && !str.empty() && is_from_source(startline))
+    {
+        const char* const text_begin = (*this)[startline].data();
+        const std::string_view text(
+            text_begin, static_cast<size_t>(back().data() + back().size() - text_begin));
+        auto lines = std::ranges::subrange(begin() + static_cast<std::ptrdiff_t>(startline), end());
+
+        for (auto pos = find_substring(text, str); pos != wxue::npos;
+             pos = find_substring(text, str, pos + 1))
+        {
+            // The line is the last one that starts at or before the match. A match that begins
+            // in a line break, or continues past the end of its line, doesn't count.
+            const char* match = text_begin + pos;
+            auto line = std::ranges::upper_bound(lines, match, std::less<>(),
+                                                 [](const auto& view)
+                                                 {
+                                                     return view.data();
+                                                 });
+            --line;
+            if (match + str.size() <= line->data() + line->size())
+            {
+                return static_cast<size_t>(std::distance(begin(), line));
+            }
+        }
+        return wxue::npos;
+    }
+
     auto subrange = std::ranges::subrange(begin() + static_cast<std::ptrdiff_t>(startline), end());
     auto iter = std::ranges::find_if(subrange,
                                      [&](const auto& line)
@@ -248,7 +458,6 @@ auto wxue::ViewVector::ReadFile(std::string_view filename) -> bool
     m_buffer.resize(file_size.GetValue());
     file.Read(m_buffer.data(), m_buffer.size());
 
-    std::vector<std::string_view> lineSeparators = { "\r\n", "\r", "\n" };
     std::string_view string_buffer(m_buffer);
 
     if (m_buffer.size() > 2 && m_buffer[0] == BOM_UTF8_0 && m_buffer[1] == BOM_UTF8_1 &&
@@ -257,14 +466,13 @@ auto wxue::ViewVector::ReadFile(std::string_view filename) -> bool
         // BOM utf-8 string, so skip over the BOM and process normally
         string_buffer.remove_prefix(3);
     }
-    SetString(string_buffer, lineSeparators);
+    SetString(string_buffer, line_separators);
 
     return true;
 }
 
 void wxue::ViewVector::ParseBuffer()
 {
-    std::vector<std::string_view> lineSeparators = { "\r\n", "\r", "\n" };
     std::string_view string_buffer(m_buffer);
 
     if (m_buffer.size() > 2 && m_buffer[0] == BOM_UTF8_0 && m_buffer[1] == BOM_UTF8_1 &&
@@ -273,7 +481,7 @@ void wxue::ViewVector::ParseBuffer()
         // BOM utf-8 string, so skip over the BOM and process normally
         string_buffer.remove_prefix(3);
     }
-    SetString(string_buffer, lineSeparators);
+    SetString(string_buffer, line_separators);
 }
 
 void wxue::ViewVector::ReadString(std::string_view str)
@@ -281,11 +489,34 @@ void wxue::ViewVector::ReadString(std::string_view str)
     if (!str.empty())
     {
         m_buffer.assign(str);
-        std::vector<std::string_view> lineSeparators = { "\r\n", "\r", "\n" };
-        SetString(m_buffer, lineSeparators);
+        SetString(m_buffer, line_separators);
     }
 }
 
+auto wxue::ViewVector::is_from_source(size_t startline) const -> bool
+{
+    // The vector can be changed directly, so every line is checked rather than trusting that it
+    // still holds what SetString() put in it.
+    if (!m_source.data())
+    {
+        return false;
+    }
+    const std::less<> less;
+    const char* prev_end = m_source.data();
+    const char* const source_end = m_source.data() + m_source.size();
+    for (const auto& line: std::ranges::subrange(begin() + static_cast<std::ptrdiff_t>(startline),
+                                                 end()))
+    {
+        if (!line.data() || less(line.data(), prev_end) ||
+            less(source_end, line.data() + line.size()))
+        {
+            return false;
+        }
+        prev_end = line.data() + line.size();
+    }
+    return true;
+}
+
 auto wxue::ViewVector::is_sameas(const wxue::ViewVector& other) const -> bool
 {
     if (size() != other.size())
@@ -21,6 +21,7 @@
 
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <wx/filename.h>  // wxFileName - encapsulates a file path
@@ -31,6 +32,22 @@
 
 namespace wxue
 {
+    // The separators ReadFile() and ReadString() use to split text into lines. When SetString()
+    // is passed this vector, it uses find_line_break() instead of checking each separator.
+    inline const std::vector<std::string_view> line_separators = { "\r\n", "\r", "\n" };
+
+    // Returns the position of the next "\r\n", "\r" or "\n" at or after start, along with the
+    // length of the line break. Returns { npos, 0 } if there are no more line breaks.
+    //
+    // Uses AVX2 or SSE2 when the compiler targets them, otherwise scans one character at a time.
+    auto find_line_break(std::string_view str, size_t start = 0) noexcept
+        -> std::pair<size_t, size_t>;
+
+    // Equivalent to std::string_view::find(sub, start), but compares blocks of 16 or 32
+    // characters at a time when the compiler targets SSE2 or AVX2.
+    auto find_substring(std::string_view str, std::string_view sub, size_t start = 0) noexcept
+        -> size_t;
+
     class ViewVector : public std::vector<string_view>
     {
     public:
@@ -110,13 +127,24 @@ namespace wxue
         // Searches every line to see if it contains the sub-string.
         //
         // startline is the zero-based offset to the line to start searching.
+        //
+        // For CASE::exact, lines created by SetString() or ReadFile() are searched as a single
+        // block of text rather than one line at a time.
         auto FindLineContaining(std::string_view str, size_t startline = 0,
                                 CASE checkcase = CASE::exact) const -> size_t;
 
     private:
+        // Returns true if the lines starting at startline all lie within the text last passed to
+        // SetString() (directly, or by ReadFile() or ReadString()), in order and without
+        // overlapping. Only then is it safe to search that text as a single block.
+        [[nodiscard]] auto is_from_source(size_t startline) const -> bool;
+
         // This will be the filename passed to ReadFile()
         wxString m_filename;
 
         string m_buffer;
+
+        // The text last passed to SetString() -- the lines it created are views into it
+        std::string_view m_source;
     };
 }  // namespace wxue
@@ -1,2216 +0,0 @@
-///////////////////////////////////////////////////////////////////////////////
-// <auto-generated>
-// Code generated by wxUiEditor - see https://github.com/KeyWorksRW/wxUiEditor/
-//
-// DO NOT EDIT ANYTHING IN THIS FILE UNTIL AFTER THE </auto-generated> MARKER
-// All changes before that marker will be lost if the code is re-generated.
-///////////////////////////////////////////////////////////////////////////////
-
-// clang-format off
-// NOLINTBEGIN
-// cppcheck-suppress-begin *
-
-#include "wxue_data.h"
-
-#include <wx/mstream.h>  // memory stream classes
-#include <wx/zstream.h>  // zlib stream classes
-
-namespace wxue_data
-{
-    // Convert compressed data string into a char array
-    std::unique_ptr<unsigned char[]> get_data(const unsigned char* data,
-        size_t size_data, size_t size_data_uncompressed)
-    {
-        auto str = std::unique_ptr<unsigned char[]>(new unsigned char[size_data_uncompressed]);
-        wxMemoryInputStream stream_in(data, size_data);
-        wxZlibInputStream zlib_strm(stream_in);
-        zlib_strm.Read(str.get(), size_data_uncompressed);
-        return str;
-    };
-
-    // ../xml/bars.xml (39184 bytes)
-    const unsigned char bars[6246] {
-            120,218,237,61,107,111,227,198,174,247,167,8,57,192,217,4,77,178,221,2,231,203,182,13,224,216,74,98,172,99,7,182,
-            179,143,126,49,198,214,216,30,172,44,249,72,114,18,23,231,199,95,146,243,208,72,214,195,206,198,217,109,107,160,
-            232,198,210,12,135,228,144,28,14,135,67,253,118,205,3,30,177,36,140,90,124,42,2,145,136,48,136,47,126,155,241,192,
-            153,248,44,142,127,63,26,134,161,127,201,162,35,71,44,216,140,255,126,244,248,100,158,36,235,37,60,72,224,231,152,
-            69,163,105,24,45,142,46,126,19,193,156,71,34,137,117,255,14,11,102,43,232,233,12,120,146,136,96,22,31,189,221,108,
-            244,185,223,172,124,255,248,244,73,4,94,248,8,240,231,194,227,78,192,22,48,50,140,200,103,81,184,10,188,209,36,
-            244,195,85,132,93,173,247,99,54,249,90,245,254,145,96,142,226,100,237,243,226,87,252,41,137,88,97,131,165,207,18,
-            164,152,208,125,171,241,221,196,92,226,237,184,15,60,72,168,237,50,10,151,60,74,214,10,14,53,27,225,223,154,159,
-            113,18,1,27,142,156,57,247,151,192,254,185,28,209,9,167,78,2,127,143,89,204,37,236,243,163,139,219,181,154,139,
-            75,120,250,219,91,13,122,99,144,5,139,102,34,136,245,8,143,79,3,241,39,215,35,124,100,254,138,199,78,18,58,99,238,
-            172,98,238,57,44,118,84,15,7,72,164,97,213,36,159,23,80,176,4,46,19,194,18,248,74,4,73,6,180,132,137,128,98,104,
-            10,45,9,88,124,238,32,105,170,179,35,226,205,102,34,160,161,31,96,44,49,97,190,227,137,136,79,80,64,29,49,181,145,
-            194,206,243,48,18,127,134,65,194,252,83,135,5,133,112,210,38,149,144,244,112,192,222,119,21,44,141,249,146,129,
-            222,0,140,34,194,145,52,143,79,217,202,79,28,213,18,17,2,174,35,217,48,10,252,135,227,226,19,96,123,242,200,65,
-            225,56,155,204,13,38,248,47,160,240,159,42,20,72,44,213,232,99,145,248,34,78,64,65,194,37,81,166,228,248,105,120,
-            57,186,234,52,134,26,179,107,241,192,227,12,205,204,153,130,44,59,126,24,126,117,142,165,184,198,196,195,235,225,
-            7,39,12,252,245,9,205,250,38,216,86,175,249,161,113,217,113,53,232,91,246,53,7,122,234,135,44,97,99,159,19,60,47,
-            156,124,165,31,199,117,144,111,122,253,246,31,189,238,176,209,209,176,7,75,62,17,83,193,237,153,118,124,182,14,
-            87,73,9,140,143,110,127,216,110,22,65,48,2,85,217,127,232,126,54,76,27,204,145,39,68,25,88,4,45,80,154,202,241,
-            42,73,192,106,254,234,140,215,102,210,145,58,71,76,224,177,195,34,152,103,0,16,148,12,212,237,181,155,189,238,96,
-            19,207,32,84,16,182,24,15,222,175,183,24,169,213,254,216,110,185,253,194,177,60,241,0,230,45,114,142,199,97,4,255,
-            158,56,108,28,62,240,204,200,70,60,170,38,175,219,107,116,218,215,221,194,49,152,47,102,193,2,76,161,243,40,146,
-            57,193,6,229,144,191,201,78,102,70,56,133,46,9,78,215,26,141,195,116,229,87,200,203,31,163,78,227,75,239,190,108,
-            202,80,254,240,135,154,18,63,132,133,6,168,53,35,144,64,192,148,197,9,24,36,176,67,27,138,240,139,162,89,170,47,
-            169,158,179,88,197,137,49,154,68,144,145,156,42,68,109,201,106,134,139,177,8,200,142,160,133,207,83,67,195,103,
-            128,230,244,195,54,15,111,97,213,206,44,221,214,82,93,179,120,31,253,176,75,238,46,75,107,190,1,90,215,104,52,153,
-            11,223,43,88,183,30,192,103,41,88,119,47,22,163,68,242,232,176,160,30,22,212,127,226,130,234,28,43,78,159,28,150,
-            214,195,210,250,207,89,90,11,25,62,26,246,122,157,97,251,206,8,81,43,12,222,36,36,11,210,224,128,250,36,244,138,
-            166,50,17,203,172,141,143,157,199,57,151,66,182,8,129,26,80,55,224,9,76,2,252,31,159,46,74,70,190,236,13,135,189,
-            91,61,104,3,39,55,107,100,18,185,29,12,65,96,23,72,95,102,178,75,128,246,219,215,55,195,90,152,145,152,205,129,
-            66,92,153,139,224,238,226,129,32,100,227,124,200,31,169,223,113,180,245,146,140,173,43,236,182,207,198,220,207,
-            246,25,241,120,194,150,188,104,199,13,134,125,193,150,186,57,225,102,175,50,203,8,30,129,90,224,152,142,108,91,
-            180,72,195,34,235,105,24,146,209,155,43,69,123,232,222,130,8,245,111,83,83,217,0,173,136,22,96,32,179,22,167,104,
-            190,168,119,243,198,109,126,72,59,79,230,92,153,124,66,239,24,116,106,29,3,202,60,38,55,99,154,128,80,9,16,71,112,
-            56,198,184,2,38,225,108,230,115,239,164,20,126,171,223,187,107,245,62,25,147,210,140,56,75,192,160,48,27,79,133,
-            164,212,67,230,120,192,9,144,133,0,140,98,4,90,16,160,17,0,103,71,36,165,163,244,27,173,118,175,148,138,199,185,
-            128,117,122,65,139,29,72,91,130,82,199,156,136,121,34,116,208,151,92,82,236,131,116,137,86,116,84,102,234,2,214,
-            130,173,64,252,153,54,49,171,128,64,163,201,0,165,227,168,98,12,172,16,120,133,154,4,101,239,37,88,232,175,218,
-            75,185,182,230,171,66,218,60,17,35,238,102,246,199,36,214,89,246,105,173,194,241,128,97,170,7,154,192,4,28,150,
-            65,184,0,57,211,1,36,96,171,239,3,34,44,152,201,37,225,65,196,2,153,67,173,117,220,135,160,33,151,3,15,136,77,176,
-            37,168,43,204,53,16,161,225,131,123,243,115,5,226,202,62,229,21,197,19,198,203,26,208,35,28,6,64,2,130,107,123,
-            125,132,174,69,138,128,88,174,226,113,186,165,40,128,171,12,123,164,28,83,90,72,53,104,211,223,57,6,223,145,5,235,
-            19,77,178,178,60,211,8,195,95,57,43,186,12,193,57,228,228,95,130,87,141,166,74,163,89,132,163,48,147,133,127,229,
-            23,207,116,178,60,24,15,159,69,231,206,39,28,111,38,131,163,136,246,221,58,153,131,252,76,66,92,217,80,59,64,29,
-            158,206,63,9,111,198,97,195,33,60,57,139,176,98,205,252,112,12,122,179,10,124,80,74,84,205,169,120,210,107,88,204,
-            253,41,76,18,72,90,107,212,232,126,177,231,138,227,46,198,104,141,251,113,72,11,207,81,186,27,131,229,108,1,75,
-            22,237,118,52,13,72,106,113,71,75,177,159,11,161,223,236,180,155,31,220,214,243,33,184,221,33,58,68,149,221,73,
-            52,96,70,99,107,197,84,19,223,110,157,210,67,181,101,61,117,98,218,81,197,43,240,197,192,187,4,110,146,2,128,180,
-            198,160,80,201,156,68,151,180,34,38,223,35,73,247,12,114,111,244,64,187,39,242,5,108,84,222,191,191,230,201,128,
-            251,122,7,147,145,136,83,7,22,243,179,119,122,95,35,165,111,178,138,98,120,140,102,118,1,11,185,7,48,209,100,25,
-            241,219,228,199,253,93,171,49,116,71,247,109,139,29,247,75,15,20,249,190,189,193,206,194,101,116,164,205,110,102,
-            61,181,158,166,11,107,250,112,167,21,214,116,123,149,165,182,122,121,61,216,170,191,156,173,250,54,147,243,237,
-            10,50,208,97,129,140,130,196,233,83,75,65,210,167,111,55,225,36,17,79,96,57,30,99,44,192,130,148,121,110,121,177,
-            89,8,141,149,200,7,221,216,74,232,48,155,234,7,79,70,135,99,179,239,120,108,150,206,210,225,228,236,239,24,232,
-            67,223,224,69,130,125,141,251,246,104,63,17,43,167,96,179,164,70,171,137,58,232,48,3,153,245,84,146,193,23,226,
-            139,248,188,18,108,227,126,216,235,187,131,246,31,110,10,152,124,37,220,71,157,193,54,18,185,138,228,216,128,43,
-            64,94,247,219,119,119,86,208,139,88,195,96,123,37,150,192,107,196,112,7,96,189,143,110,255,170,211,251,100,139,
-            66,134,192,9,195,69,13,228,16,120,142,241,147,169,15,236,168,163,58,31,172,188,143,165,159,104,66,77,32,240,147,
-            92,152,85,106,180,81,31,84,11,248,77,211,104,98,174,208,6,187,248,124,154,160,139,152,6,77,98,109,115,84,220,13,
-            188,1,216,21,198,182,64,128,215,138,180,140,51,170,5,64,242,35,226,96,104,85,130,53,1,169,160,242,197,195,116,181,
-            209,56,91,51,170,208,202,197,157,27,1,12,61,3,191,8,25,184,49,73,167,168,63,229,51,98,219,42,228,141,114,0,101,
-            195,37,114,48,141,135,165,51,80,193,182,187,78,163,221,29,93,54,154,31,174,251,189,251,110,203,104,69,196,30,65,
-            142,97,181,2,81,75,215,67,231,24,215,17,15,229,90,58,124,39,232,209,37,156,121,122,68,61,195,51,12,95,160,143,147,
-            118,174,155,189,10,27,99,102,43,157,193,210,121,43,25,5,38,2,182,99,141,97,187,215,29,221,54,6,31,156,157,204,217,
-            185,115,185,123,0,94,17,215,114,175,26,247,157,225,104,48,252,146,30,109,108,1,174,24,192,255,74,231,174,230,40,
-            116,87,199,236,112,36,106,31,137,50,195,189,131,179,116,112,150,14,206,210,193,89,58,56,75,7,103,233,224,44,253,
-            45,157,37,229,23,21,30,220,106,15,233,112,120,123,56,188,253,11,30,222,210,21,7,230,143,232,108,117,43,135,230,
-            242,126,56,4,51,48,24,98,120,58,43,15,93,201,101,133,157,60,220,45,81,237,12,148,27,92,188,53,144,27,92,156,129,
-            232,157,161,220,129,111,50,112,141,21,190,83,114,180,51,156,86,123,128,73,103,169,57,215,167,213,187,211,213,110,
-            181,92,35,141,55,194,243,64,138,119,134,66,90,147,162,211,84,66,145,135,83,58,59,21,179,143,254,16,8,252,104,193,
-            131,85,209,241,189,125,206,194,18,165,45,103,164,46,216,37,85,37,31,188,14,112,218,192,4,104,5,50,7,51,202,38,56,
-            247,114,237,3,193,214,62,128,229,214,125,227,57,253,13,166,27,169,51,42,114,51,14,71,95,63,242,49,253,0,57,3,86,
-            93,118,184,117,187,247,206,217,153,198,90,217,59,233,172,128,123,46,13,91,24,243,32,239,94,128,199,70,82,120,172,
-            118,147,49,130,69,146,0,52,3,93,243,80,14,25,181,57,121,137,99,232,205,238,160,113,72,238,101,163,95,122,226,151,
-            74,249,110,240,244,126,102,68,89,7,47,0,144,114,221,94,12,218,45,152,182,142,251,98,224,46,221,107,112,199,90,253,
-            198,245,118,192,202,92,180,145,242,158,76,122,255,32,193,245,116,8,70,233,187,56,108,23,183,107,167,131,239,43,
-            250,63,10,47,153,27,69,7,58,47,206,170,34,32,245,70,129,16,58,88,133,31,193,42,28,180,248,89,90,140,33,68,158,203,
-            91,80,143,234,148,56,163,77,20,27,188,120,247,243,54,187,59,112,129,183,206,115,40,31,30,127,134,209,70,124,50,
-            27,211,44,136,198,15,200,157,176,131,241,5,14,138,126,80,17,137,127,187,123,234,64,121,144,59,214,72,85,152,35,
-            48,48,190,23,219,56,82,18,135,122,170,246,5,171,197,24,3,122,83,71,62,223,240,161,234,130,190,91,69,91,7,176,173,
-            199,224,36,134,21,45,223,29,83,161,236,176,162,157,212,125,54,199,192,150,206,236,78,81,114,208,144,200,109,153,
-            10,181,145,87,9,134,195,138,114,214,38,152,19,66,55,160,252,153,88,172,198,40,151,29,31,162,119,200,2,142,249,241,
-            248,183,66,132,194,42,102,7,204,125,31,122,0,2,222,219,36,130,253,33,217,197,49,159,48,244,45,45,244,169,151,23,
-            242,24,227,190,83,145,40,124,3,12,106,129,122,156,59,221,80,103,204,90,177,76,28,134,79,167,124,162,194,42,180,
-            42,224,133,132,99,178,247,240,215,79,206,197,239,206,47,231,239,126,57,193,148,63,36,223,95,151,81,238,118,58,64,
-            54,204,7,110,70,250,38,56,213,231,64,254,68,98,59,230,51,17,4,184,32,101,185,143,232,199,106,131,110,136,182,46,
-            14,216,84,18,65,128,247,211,132,115,47,63,133,72,242,155,88,183,57,166,180,74,92,124,130,36,10,253,247,239,93,205,
-            206,147,122,34,164,169,44,162,98,1,251,58,159,255,5,72,112,211,16,165,141,63,15,188,31,22,249,194,240,95,230,148,
-            7,37,247,61,24,148,137,191,242,8,186,109,6,156,255,57,57,53,52,79,50,108,161,167,87,247,157,206,168,239,222,53,
-            218,221,225,8,246,208,234,168,3,119,214,27,168,212,88,243,118,48,13,109,91,46,224,183,101,201,31,201,209,250,86,
-            51,254,82,71,153,66,34,91,101,127,231,120,232,74,150,33,23,37,212,174,27,151,38,70,182,161,232,60,90,36,18,24,236,
-            44,15,77,48,235,12,77,125,118,162,131,80,119,75,195,72,234,201,169,195,255,187,18,15,204,71,59,155,132,58,138,167,
-            185,244,254,61,134,159,143,79,208,229,187,1,27,14,127,97,228,108,83,150,64,216,232,174,0,30,183,24,13,192,103,234,
-            144,197,58,141,41,239,76,11,70,69,111,122,95,222,61,9,151,21,157,225,109,121,87,121,44,81,209,91,54,216,4,16,251,
-            20,97,200,18,62,160,135,219,80,110,186,103,72,47,234,95,66,187,1,96,17,95,212,189,144,122,211,57,75,126,81,255,
-            50,250,193,99,11,204,30,233,138,65,63,60,251,3,71,100,149,40,9,219,236,195,159,192,104,153,78,46,253,162,21,42,
-            130,237,146,239,179,37,157,0,166,189,83,241,173,80,32,76,97,120,182,2,65,103,91,127,156,131,2,29,20,232,159,166,
-            64,222,42,155,244,97,229,124,104,213,209,77,180,47,195,2,177,144,15,142,1,233,133,0,95,35,230,147,48,240,226,19,
-            117,20,109,175,78,120,123,37,171,103,71,23,255,249,185,122,227,120,203,131,85,182,152,132,121,34,177,196,24,195,
-            247,73,105,255,65,210,202,21,63,106,114,202,183,219,222,221,110,214,3,104,248,190,62,126,150,199,17,230,172,223,
-            227,9,155,204,241,114,181,220,193,164,151,200,43,14,67,150,203,17,202,7,213,252,98,249,136,30,198,202,70,40,186,
-            190,57,96,109,7,78,243,167,159,116,20,45,88,171,251,84,180,185,21,24,45,83,224,117,48,77,239,33,165,235,205,28,
-            107,48,231,248,95,98,250,246,95,160,109,98,122,226,140,253,112,242,213,97,50,107,0,169,67,62,58,192,72,240,165,
-            211,120,24,142,123,94,24,70,185,11,151,171,229,45,157,233,40,209,180,15,120,150,248,86,30,249,188,144,76,190,172,
-            208,24,236,243,98,83,224,104,55,229,1,22,182,86,209,165,2,130,39,201,147,38,55,191,46,131,109,242,121,84,137,107,
-            154,53,166,90,75,220,105,243,156,153,89,21,212,144,97,129,55,58,142,217,236,117,49,55,131,226,153,231,78,123,74,
-            55,245,204,229,86,188,153,7,208,78,241,156,91,158,162,101,142,128,1,180,108,154,131,78,97,82,142,43,245,69,47,176,
-            120,80,195,173,109,13,214,171,5,152,212,120,63,160,109,40,225,94,161,124,21,203,86,53,213,149,36,131,246,143,68,
-            77,66,70,16,6,188,40,67,161,53,186,106,167,92,184,71,39,242,9,175,115,34,80,58,137,56,54,141,78,100,64,11,240,226,
-            170,248,6,157,28,156,23,131,117,91,237,97,45,88,108,180,27,216,27,183,115,87,11,22,27,85,128,69,94,60,255,128,166,
-            86,113,226,213,120,97,207,189,249,173,32,170,159,91,75,128,234,240,124,140,7,171,241,109,53,128,138,180,160,75,
-            122,101,50,140,21,50,116,168,82,188,154,72,201,111,195,251,140,244,11,122,144,106,0,253,222,94,11,160,199,8,187,
-            236,81,17,26,151,118,66,35,158,108,165,167,99,24,247,149,69,74,192,116,202,220,101,105,105,101,35,225,105,215,152,
-            144,128,223,37,226,219,104,181,246,60,66,179,227,54,250,123,31,163,55,112,247,61,70,175,139,137,154,123,31,229,
-            238,203,190,135,216,187,80,181,220,142,59,220,247,124,216,246,124,95,67,124,222,251,16,87,237,110,107,239,67,244,
-            7,251,38,195,94,5,247,52,4,48,202,253,252,10,99,116,135,123,31,228,170,183,231,33,58,141,189,207,120,215,253,244,
-            151,31,161,119,151,102,55,238,105,136,59,152,137,125,91,194,187,190,123,229,246,221,110,211,29,236,127,164,143,
-            237,189,79,203,93,191,189,119,37,188,235,195,228,247,135,237,189,179,172,239,182,122,123,31,226,182,247,209,221,
-            251,32,119,157,70,115,223,163,12,26,31,95,99,136,198,190,103,125,0,30,80,115,216,232,116,246,60,206,125,247,85,
-            124,45,24,166,183,247,33,94,126,241,253,134,125,181,14,159,97,138,128,222,106,154,125,230,41,198,175,100,54,181,
-            186,228,135,175,206,157,70,224,176,201,132,251,242,3,12,206,87,190,214,233,55,177,74,112,244,156,85,172,131,244,
-            108,1,200,196,72,201,191,255,187,10,147,95,255,13,15,126,149,127,34,109,17,155,36,60,50,97,232,118,205,94,19,203,
-            86,78,86,73,53,57,189,165,10,215,2,106,227,144,69,158,163,251,201,107,181,241,58,72,216,19,93,229,8,0,247,108,193,
-            77,137,90,115,216,239,200,191,78,213,147,70,103,168,176,78,105,25,220,180,175,244,83,137,74,236,28,79,48,78,170,
-            179,122,22,44,73,176,114,170,186,230,138,121,64,107,135,11,186,30,242,230,236,13,30,104,188,249,233,77,202,136,
-            88,221,207,197,176,152,108,76,60,180,216,45,18,202,232,36,66,236,231,11,70,129,72,164,136,249,75,16,154,213,130,
-            71,98,146,130,166,146,96,248,122,186,10,228,245,94,156,185,227,105,20,46,156,171,119,40,88,87,239,126,57,41,8,12,
-            202,123,220,52,86,156,101,60,134,249,242,204,111,120,38,90,110,161,23,31,56,255,12,206,35,71,43,46,62,24,57,87,
-            151,31,50,193,238,140,226,166,201,62,207,187,192,96,108,194,119,205,87,126,118,244,44,13,157,201,27,175,94,184,
-            26,251,120,227,76,82,167,47,112,73,128,166,102,94,74,51,158,18,164,87,227,138,88,104,110,129,141,42,176,186,15,
-            114,35,149,225,151,157,195,58,124,72,112,101,73,77,147,238,151,94,75,59,207,213,104,46,58,9,146,45,51,87,139,42,
-            175,250,20,214,18,173,236,241,204,171,139,27,87,3,179,65,208,218,219,139,105,255,244,254,95,61,136,204,213,193,
-            20,132,188,29,104,205,85,51,12,98,14,171,138,120,224,234,37,93,84,199,105,93,228,110,19,198,43,172,94,128,250,201,
-            159,192,38,80,218,38,47,187,32,24,83,81,71,188,92,153,144,217,88,132,88,32,187,242,190,224,102,194,55,158,100,125,
-            135,146,118,241,70,57,187,141,82,118,187,135,161,13,136,234,131,126,79,92,225,109,174,250,243,51,79,140,94,251,
-            12,77,101,66,22,157,165,21,17,210,10,39,181,100,120,225,228,245,201,72,199,172,57,135,235,139,241,56,12,108,2,34,
-            122,50,178,50,44,229,147,23,192,255,165,146,44,163,113,80,157,99,137,165,207,121,89,114,24,106,45,105,178,161,157,
-            74,165,243,141,100,202,150,20,6,251,64,173,149,150,237,95,20,92,56,165,239,157,137,137,221,67,61,42,235,113,59,
-            248,100,183,134,159,105,75,53,216,55,31,232,246,219,151,151,61,188,159,223,47,78,1,166,143,179,201,146,57,153,198,
-            116,215,38,173,27,65,121,189,214,107,74,3,190,107,92,187,163,78,227,210,237,12,74,222,119,221,206,8,207,236,229,
-            101,218,226,86,195,222,245,117,199,85,77,10,91,96,76,87,189,47,90,16,108,172,123,157,22,117,219,154,68,93,242,162,
-            156,64,250,208,195,55,208,39,91,221,182,187,237,219,246,64,211,57,168,33,36,207,95,179,212,49,74,253,166,13,163,
-            46,121,148,113,35,19,54,54,183,66,164,238,26,151,114,155,209,50,95,181,80,131,201,162,16,47,53,86,78,176,114,99,
-            97,158,187,47,51,230,5,86,247,152,201,194,78,84,85,195,170,59,82,124,89,162,108,110,119,25,35,45,229,177,29,207,
-            114,18,144,27,10,246,101,60,136,17,130,170,224,145,103,163,194,229,152,10,203,152,203,37,62,221,32,33,135,132,169,
-            158,39,219,163,147,23,181,28,78,11,17,136,133,136,249,235,160,148,209,238,28,38,76,21,162,208,78,22,94,39,148,119,
-            223,195,188,80,209,101,163,112,121,38,235,251,76,194,40,224,91,9,181,101,58,54,6,167,40,206,150,67,203,212,208,
-            141,225,203,237,107,181,231,39,123,97,39,210,186,230,77,163,123,157,169,135,110,150,167,108,73,115,24,127,70,53,
-            29,100,77,15,66,43,98,32,97,196,4,218,173,162,211,138,50,13,115,138,27,62,240,100,209,247,165,155,154,158,152,78,
-            57,101,61,109,52,40,185,191,89,132,103,187,123,189,3,162,203,72,132,145,201,174,125,17,92,85,208,141,5,160,172,
-            10,176,140,192,213,18,49,108,92,234,155,154,185,203,229,117,100,164,213,7,228,29,37,89,132,64,111,14,210,90,43,
-            33,126,149,1,236,226,46,168,220,223,189,32,34,17,184,56,108,103,76,228,101,216,231,242,68,106,197,139,176,68,34,
-            242,60,142,20,163,241,60,134,116,220,43,224,71,254,58,239,214,168,80,57,178,60,38,50,164,1,208,4,5,24,182,199,135,
-            76,104,235,57,120,104,235,38,223,232,120,175,101,219,48,32,33,241,169,69,131,76,233,230,151,27,182,198,197,54,183,
-            185,97,75,247,38,119,20,154,201,110,78,150,244,204,222,157,208,147,215,217,94,193,238,3,113,122,126,198,89,74,215,
-            243,194,102,54,103,42,234,80,201,248,68,97,37,26,189,7,66,221,144,130,64,22,150,230,137,121,152,185,159,175,34,
-            83,49,61,129,85,35,194,204,79,144,50,64,79,16,62,122,197,25,10,184,255,237,83,84,13,100,171,57,66,191,169,98,146,
-            118,217,193,73,223,174,110,15,23,132,142,44,108,53,245,217,44,150,245,55,223,86,131,84,245,40,141,219,104,149,125,
-            34,222,91,46,32,45,218,217,196,106,233,77,254,169,74,0,226,78,129,71,176,134,199,147,8,175,89,83,173,129,90,12,
-            82,255,57,239,163,5,27,30,116,198,91,53,169,220,128,220,27,44,99,17,225,247,143,116,189,10,178,111,129,46,10,38,
-            131,175,178,108,37,240,106,158,223,13,150,236,232,128,131,39,242,60,97,204,231,236,65,132,171,72,102,219,3,180,
-            212,152,129,239,232,227,199,147,68,40,75,99,226,125,41,238,201,50,138,48,189,138,87,20,51,166,226,161,154,48,44,
-            162,145,171,4,5,235,149,12,213,43,215,134,136,171,101,97,206,231,223,240,117,143,61,126,146,115,252,95,146,147,
-            178,188,232,118,219,17,117,71,94,51,22,96,161,172,210,213,0,195,41,121,236,148,86,185,172,20,88,36,4,203,196,97,
-            165,72,18,83,137,39,226,4,212,131,255,238,63,98,153,0,250,166,14,11,86,204,215,83,36,63,149,71,134,15,136,82,146,
-            204,227,90,102,15,134,125,119,216,188,177,190,23,131,101,45,136,207,242,94,139,194,3,240,74,75,6,24,95,182,22,252,
-            85,199,253,220,46,78,192,55,112,169,118,2,22,197,4,109,79,171,1,199,191,90,199,11,84,121,64,126,130,81,25,119,141,
-            157,182,79,166,98,173,62,99,17,190,151,214,222,130,145,78,169,240,158,152,172,124,22,249,244,25,28,83,26,21,182,
-            226,48,140,148,248,116,167,24,152,250,20,17,162,140,78,15,95,162,152,7,137,222,88,49,112,139,2,42,230,103,21,93,
-            37,59,225,176,7,38,124,60,0,56,119,244,93,52,154,148,213,130,60,254,5,123,162,191,117,125,26,26,2,181,4,231,30,
-            168,244,97,249,122,96,0,111,198,141,138,62,70,160,154,168,77,70,123,51,219,182,2,163,186,205,198,205,152,9,85,36,
-            174,209,28,182,63,54,134,5,126,17,45,1,117,158,145,148,82,220,219,200,207,175,233,121,206,219,190,106,95,233,146,
-            218,20,69,115,233,197,102,76,215,60,126,181,133,249,50,201,199,110,109,14,91,238,38,177,21,237,72,153,191,89,84,
-            8,167,128,179,234,72,234,56,8,131,51,93,159,242,4,76,236,76,157,103,235,80,134,22,78,245,171,198,51,46,66,84,23,
-            44,251,86,140,77,21,205,93,145,116,54,228,64,125,130,204,220,2,59,62,65,99,191,242,169,166,49,218,217,244,12,93,
-            82,167,175,101,129,213,199,91,84,44,144,247,167,245,87,176,192,188,34,40,85,20,202,212,218,124,196,35,179,69,24,
-            39,41,238,58,178,148,14,231,133,32,3,39,197,2,28,89,104,23,203,110,145,224,190,176,212,110,229,19,74,28,159,231,
-            20,218,84,86,248,132,69,249,4,217,236,141,12,187,158,87,129,86,47,212,210,122,85,149,30,13,85,33,119,85,227,149,
-            132,77,126,37,58,226,204,20,246,33,39,3,63,149,39,83,13,196,132,172,89,113,253,218,236,216,249,66,179,173,172,8,
-            109,53,190,229,54,104,119,199,72,34,165,67,213,98,113,243,229,178,223,54,217,239,151,5,67,39,143,97,110,240,216,
-            57,163,248,85,134,7,185,145,101,164,170,160,213,174,108,146,33,128,231,79,145,140,179,198,25,243,161,138,246,179,
-            180,78,48,224,186,10,244,47,171,28,106,145,184,108,21,223,148,29,74,99,6,25,67,245,234,86,188,0,211,90,35,190,53,
-            202,255,64,51,158,91,232,182,244,66,182,248,38,202,203,250,32,91,124,108,68,4,35,244,45,11,74,36,220,42,119,52,
-            235,231,214,20,93,3,191,181,20,158,114,105,115,240,240,179,160,42,27,129,166,110,81,54,108,182,190,101,153,116,
-            235,170,130,123,119,166,200,14,133,129,85,178,120,123,21,212,72,238,213,145,170,67,208,41,26,228,187,232,158,44,
-            108,190,139,3,53,180,11,235,87,184,79,197,229,22,139,18,12,135,148,207,172,147,9,51,223,139,62,54,31,187,145,116,
-            35,47,240,27,11,241,201,94,115,14,223,238,238,113,213,124,14,118,91,127,107,168,62,200,121,240,182,14,222,214,143,
-            233,109,29,172,252,223,219,202,107,164,175,17,161,104,157,55,245,51,253,216,182,245,250,225,171,121,87,10,185,10,
-            111,72,161,52,138,233,11,110,69,223,115,203,230,181,79,194,197,2,191,206,128,1,79,152,93,252,122,199,90,146,110,
-            146,114,37,196,115,167,189,144,185,60,244,133,133,136,171,79,181,99,182,46,118,54,25,219,48,163,178,124,208,130,
-            37,42,78,108,13,82,41,190,215,141,78,199,237,127,81,183,170,10,196,86,209,191,85,196,79,158,209,209,41,7,229,140,
-            211,233,138,77,208,54,152,148,233,79,17,34,3,177,16,190,172,222,82,78,146,60,179,48,40,75,126,39,2,43,138,107,196,
-            210,186,225,82,161,78,73,45,148,54,224,105,136,15,182,208,91,155,36,233,173,8,161,79,151,148,102,194,108,201,87,
-            66,76,230,138,204,213,215,79,40,198,175,180,151,216,174,110,107,201,67,29,73,73,96,233,182,22,19,178,133,252,177,
-            0,36,221,21,233,222,119,58,42,237,31,36,77,208,201,27,126,30,138,190,45,83,208,169,132,7,250,184,166,50,9,188,128,
-            208,141,99,49,229,156,153,25,50,249,23,85,46,163,226,106,166,34,73,214,156,140,236,226,36,25,155,162,210,195,95,
-            210,174,212,124,130,73,221,200,176,12,173,190,156,33,115,253,211,82,204,128,161,202,243,167,79,166,205,217,3,199,
-            250,141,242,3,93,88,244,89,193,138,229,231,255,74,184,179,249,217,119,197,155,141,116,121,203,177,70,112,215,210,
-            247,13,35,58,152,165,124,167,248,226,255,254,31,217,111,141,142
-        };
-
-    // ../xml/boxes.xml (14336 bytes)
-    const unsigned char boxes[2429] {
-            120,218,237,91,91,111,219,58,18,222,159,66,248,97,55,193,38,206,233,121,60,155,19,192,177,213,198,168,99,7,150,
-            219,180,251,98,208,18,109,113,75,137,2,73,197,113,127,253,206,144,148,44,197,151,92,154,30,52,187,6,138,194,150,
-            200,185,113,230,155,79,99,229,252,3,203,152,162,70,170,30,155,243,140,27,46,51,125,113,190,96,25,137,4,213,250,
-            207,214,242,190,43,211,153,188,148,247,45,194,83,186,96,205,75,102,149,227,21,30,47,152,105,93,156,243,44,97,138,
-            27,93,238,238,38,146,71,140,124,166,130,199,168,165,117,182,185,102,121,127,203,179,88,46,183,221,115,119,72,112,
-            199,50,163,183,45,208,252,59,83,211,40,225,34,198,219,185,146,57,83,102,69,50,154,130,93,119,84,77,241,83,105,167,
-            54,138,103,139,214,69,58,141,188,7,231,103,229,150,141,205,9,207,76,115,227,148,233,136,230,76,183,72,194,68,254,
-            103,43,100,96,8,37,184,144,24,73,102,140,232,68,46,51,178,76,32,126,38,97,196,176,123,67,230,156,137,152,112,77,
-            88,154,131,112,154,197,36,150,76,147,76,26,146,208,59,102,87,206,101,84,232,246,22,23,34,153,25,235,124,195,18,
-            193,181,41,173,232,250,21,68,206,173,40,123,56,4,79,103,83,154,102,130,69,120,200,83,31,138,71,252,195,213,218,
-            74,229,134,165,100,201,77,98,191,233,156,69,28,28,139,137,219,73,184,115,24,173,85,82,180,201,80,26,116,140,66,
-            96,18,112,29,254,69,84,179,83,158,105,150,105,72,179,59,118,66,120,155,181,157,52,47,3,22,201,52,167,10,196,90,
-            77,84,8,123,31,204,72,235,30,122,45,27,34,133,139,174,141,39,87,218,144,148,26,72,13,16,13,187,213,10,21,184,0,
-            176,248,132,48,200,41,194,231,224,152,61,142,236,31,254,52,216,61,141,12,72,178,134,65,208,172,22,66,181,115,196,
-            155,234,213,40,134,50,105,230,54,57,117,132,206,13,83,75,170,226,173,231,185,62,129,90,122,217,143,181,156,178,
-            186,203,133,152,90,120,225,142,138,130,145,34,19,76,107,180,26,52,159,190,107,147,254,34,147,24,49,62,111,110,243,
-            39,76,42,253,24,53,10,209,130,140,181,162,218,173,139,211,119,123,242,95,155,149,168,42,103,198,141,205,185,139,
-            115,153,91,163,220,26,128,130,203,105,216,191,190,25,4,85,58,42,70,13,67,45,182,198,102,242,222,31,38,1,225,41,
-            205,224,40,32,186,49,215,185,160,43,176,27,197,182,137,43,116,56,225,76,172,108,216,54,213,244,198,163,155,222,
-            232,118,248,184,162,24,28,57,141,177,18,155,194,241,212,174,165,129,72,237,81,51,14,58,189,209,112,240,181,84,211,
-            121,32,222,167,1,196,6,10,30,51,70,131,150,111,144,33,4,182,59,184,59,66,69,41,93,17,33,229,183,178,52,108,46,45,
-            225,34,164,210,146,9,113,2,233,109,18,89,44,146,170,68,32,34,102,46,85,122,26,179,156,101,49,68,234,24,206,215,
-            96,29,160,249,40,165,208,76,97,66,68,137,148,144,150,115,37,83,123,29,29,197,242,112,254,104,50,43,214,105,109,
-            183,55,118,131,100,248,224,243,192,2,81,174,24,148,145,41,141,181,113,219,30,159,112,52,158,84,201,42,149,207,86,
-            44,48,142,135,33,242,132,206,152,225,17,104,221,26,226,73,48,189,25,143,186,65,24,78,131,225,36,24,151,178,38,181,
-            194,94,114,168,252,133,107,77,14,31,177,90,13,68,56,248,60,153,78,130,47,19,183,151,28,73,172,194,37,135,80,160,
-            7,26,19,62,176,206,125,99,182,222,25,199,5,88,4,17,220,198,50,193,187,25,26,71,102,171,6,154,72,133,241,137,1,138,
-            21,24,123,199,23,212,218,13,206,44,25,64,69,204,169,144,139,114,181,62,182,190,237,174,30,11,232,85,245,72,41,74,
-            63,111,177,57,68,9,139,190,33,10,217,163,111,184,141,93,132,217,126,162,88,196,0,213,208,149,153,4,60,1,219,115,
-            56,214,170,187,32,82,66,80,48,99,208,85,7,121,145,173,138,24,138,251,183,186,117,46,126,229,25,96,20,187,163,235,
-            203,209,229,232,75,171,209,233,161,64,99,219,109,75,115,61,65,64,72,70,189,128,117,182,19,200,117,158,212,97,181,
-            77,186,8,218,31,152,249,140,169,117,116,236,252,48,133,114,235,51,182,244,73,39,31,192,149,13,231,166,149,120,214,
-            207,179,208,29,169,175,88,219,128,163,132,102,11,166,247,104,40,51,241,57,122,254,46,204,191,198,193,228,211,120,
-            120,97,107,87,149,249,213,176,96,135,210,50,248,53,80,123,174,143,54,244,232,35,164,129,89,119,70,236,253,120,21,
-            15,197,146,145,35,68,67,77,16,14,143,109,95,70,132,90,119,102,103,27,119,200,75,116,145,231,80,211,160,7,138,195,
-            195,230,9,148,221,135,201,71,135,126,240,225,159,228,247,246,187,223,176,92,0,174,152,58,177,176,186,188,31,133,
-            95,206,186,50,146,244,49,151,187,131,81,24,124,186,249,1,143,55,156,141,4,128,161,38,69,222,38,147,77,167,22,149,
-            40,44,237,10,139,75,180,213,22,145,183,31,11,161,51,121,7,44,165,35,180,68,156,244,145,179,98,235,93,165,230,126,
-            25,67,66,227,24,225,8,84,198,144,228,198,50,28,40,29,237,82,164,180,210,193,8,152,248,128,117,95,114,147,210,124,
-            131,123,207,210,220,113,215,233,236,45,211,111,112,163,123,96,224,7,6,126,96,224,175,194,192,31,114,214,29,212,
-            88,2,123,160,174,36,88,204,1,15,218,100,148,17,45,27,96,88,63,94,228,176,52,207,25,85,228,142,41,100,237,243,57,
-            179,164,195,23,88,69,133,225,3,146,167,3,103,220,207,25,55,159,115,254,111,25,36,223,199,32,241,76,14,36,178,65,
-            34,183,112,4,215,222,235,115,57,127,225,205,78,229,172,97,123,106,226,241,94,220,81,10,64,11,18,195,221,114,176,
-            132,9,100,167,155,224,241,119,7,14,78,85,213,46,15,157,250,208,169,255,146,89,217,115,59,225,91,238,15,87,163,126,
-            55,120,221,238,176,3,9,7,176,174,249,19,69,117,229,17,44,196,117,191,32,18,162,227,179,189,15,71,207,127,44,177,
-            174,94,250,118,114,0,187,3,216,189,16,236,208,180,210,64,135,112,155,80,55,192,159,5,134,31,214,63,11,132,152,156,
-            236,116,109,252,174,17,51,236,188,254,52,152,244,107,63,41,92,23,194,240,124,99,247,31,235,153,118,68,49,26,11,
-            208,64,82,191,216,15,91,100,102,207,68,206,231,126,54,196,245,250,4,237,224,7,20,2,123,11,134,189,160,135,217,106,
-            135,93,191,19,28,225,236,48,175,92,93,154,23,220,27,156,214,199,251,205,99,118,213,131,19,132,199,137,194,62,128,
-            132,87,253,247,19,124,156,232,78,198,3,196,99,141,254,48,251,32,82,21,87,84,40,13,75,82,121,103,211,222,45,243,
-            35,173,84,130,38,52,184,22,251,31,110,88,32,233,42,236,142,71,131,65,243,201,18,71,46,82,241,239,152,56,130,232,
-            8,106,78,204,224,33,17,82,173,132,37,2,213,10,46,72,176,62,102,228,168,254,220,115,188,35,174,157,193,109,231,107,
-            56,13,47,43,46,39,150,116,229,230,152,152,155,96,62,54,198,181,190,29,114,134,65,0,167,83,147,51,194,113,93,84,
-            90,190,41,7,237,206,24,139,183,63,191,162,196,81,77,90,79,34,36,236,19,247,36,111,235,76,96,226,91,157,157,101,
-            214,3,168,221,48,22,210,178,78,13,224,204,99,166,222,58,61,24,244,195,201,171,63,61,110,127,60,243,170,166,189,
-            238,160,223,253,248,178,201,179,31,170,199,178,152,1,18,69,130,99,252,118,241,145,144,167,0,65,87,38,21,155,204,
-            100,203,189,71,56,74,197,64,54,14,25,191,66,138,32,4,123,33,5,182,140,139,125,240,61,23,116,161,55,74,31,2,245,
-            229,166,51,236,213,55,158,149,134,252,133,196,39,129,184,252,20,246,115,53,185,30,84,63,33,28,40,208,129,2,253,
-            252,231,189,43,128,249,94,240,190,3,116,102,26,78,190,174,9,13,226,125,204,230,20,168,138,155,159,254,1,180,227,
-            114,52,238,5,227,105,248,105,248,49,24,110,107,26,87,63,143,26,89,222,176,97,238,161,187,252,2,221,165,174,15,181,
-            33,142,77,187,193,0,254,67,117,72,67,43,133,216,84,186,76,136,134,198,14,89,223,32,75,138,8,253,20,233,87,163,207,
-            141,105,230,86,217,147,146,121,194,105,217,201,37,80,83,101,95,133,41,151,239,214,50,232,15,63,190,204,135,132,
-            3,148,212,74,54,129,44,84,130,103,223,54,220,219,58,52,133,220,220,236,202,205,203,111,115,104,16,149,62,236,67,
-            174,67,151,59,116,185,39,118,185,135,36,203,230,23,162,213,20,115,161,180,119,224,95,61,43,27,154,21,173,203,0,
-            113,85,118,3,136,28,224,222,182,136,28,6,10,135,129,194,97,160,112,24,40,252,240,239,13,65,247,227,107,240,62,235,
-            203,250,117,51,244,199,67,24,254,222,159,249,47,251,217,224,255,228,88,99,76,99,222,120,29,77,225,133,39,189,138,
-            214,135,36,92,0,246,252,122,172,73,121,167,246,164,190,128,66,17,59,152,210,197,245,138,216,184,144,203,87,158,
-            88,84,82,237,107,58,213,219,152,246,228,168,182,175,36,40,32,29,16,84,124,79,7,170,12,78,47,207,225,128,61,67,88,
-            201,2,18,42,18,69,140,176,98,20,229,246,189,10,157,211,8,91,127,203,203,47,140,1,32,105,61,133,51,54,134,76,222,
-            234,127,51,37,79,103,20,201,127,46,181,253,11,162,230,123,25,248,50,169,213,241,176,130,31,104,73,233,127,164,234,
-            241,20,185,220,118,85,161,231,156,174,225,166,244,158,167,69,74,178,34,157,65,12,64,167,66,136,60,226,115,255,78,
-            82,69,119,32,113,59,211,240,38,232,246,223,127,157,142,71,183,225,49,22,114,36,69,145,102,143,111,232,142,6,176,
-            1,223,240,129,32,46,229,105,92,154,8,184,105,115,7,231,73,164,179,126,37,5,210,80,58,228,43,28,111,132,90,92,57,
-            227,106,106,45,159,68,254,136,176,108,229,248,48,233,71,226,212,232,180,219,233,18,234,42,131,230,206,215,161,63,
-            85,10,223,98,137,171,30,3,109,236,8,48,7,215,111,105,43,222,212,189,146,214,109,219,203,242,155,142,219,40,207,
-            127,217,143,219,227,78,175,255,130,247,136,26,65,43,145,179,196,235,71,198,179,192,68,121,244,96,44,91,94,11,17,
-            71,214,85,138,87,17,224,158,135,86,47,5,35,167,111,58,123,57,28,217,155,141,41,174,245,255,108,235,95,250,253,237,
-            191,208,149,242,41
-        };
-
-    // ../xml/buttons.xml (15325 bytes)
-    const unsigned char buttons[2721] {
-            120,218,237,91,221,110,219,184,18,62,143,66,228,230,52,221,52,233,31,22,139,69,55,64,226,184,137,209,196,14,108,
-            167,233,238,141,64,73,180,205,19,137,20,72,42,182,247,233,207,12,73,201,146,173,216,249,109,179,219,0,77,99,75,
-            226,112,102,248,205,55,51,20,243,233,152,9,166,168,145,234,136,141,184,224,134,75,161,247,63,141,153,32,81,66,181,
-            254,99,107,58,107,77,88,116,117,40,103,91,132,167,116,204,234,151,204,60,195,43,60,30,51,179,181,255,137,139,9,
-            83,220,232,98,244,161,148,9,163,130,124,165,9,143,113,154,173,189,213,135,166,179,75,46,98,57,109,186,231,238,144,
-            246,53,19,70,55,61,160,249,223,76,5,209,132,39,49,222,206,148,204,152,50,115,34,104,10,138,93,83,21,224,167,66,
-            81,109,20,23,227,173,253,20,70,56,19,62,237,21,67,86,6,39,52,100,73,125,100,192,116,68,51,166,183,246,207,230,196,
-            122,33,92,43,194,206,194,226,66,72,8,238,216,218,127,187,102,128,54,243,164,212,54,228,38,225,26,253,42,51,92,25,
-            255,204,116,118,112,218,57,238,6,253,206,241,201,112,139,76,88,146,253,177,117,144,240,177,208,196,76,24,137,188,
-            94,196,72,251,93,241,241,196,16,57,178,95,12,155,25,194,133,54,140,198,197,181,132,141,204,46,122,175,162,23,67,
-            143,151,19,182,191,14,131,214,73,187,245,229,176,247,109,171,2,13,153,166,84,196,118,117,10,69,60,162,88,76,166,
-            19,128,81,77,33,142,203,198,209,35,110,58,192,89,13,108,214,163,31,6,6,134,151,104,179,131,63,104,119,109,3,220,
-            10,92,90,9,63,45,232,108,28,211,36,168,249,204,33,104,21,74,173,147,47,193,69,215,174,109,251,168,88,195,225,210,
-            162,229,194,3,217,46,91,131,132,13,227,55,140,190,232,30,181,135,237,254,89,167,187,78,133,152,25,166,82,46,156,
-            156,37,205,159,109,72,53,152,123,112,122,218,187,12,62,244,143,130,193,240,96,216,14,62,247,250,193,197,160,221,
-            47,230,237,140,136,102,9,139,32,134,118,172,176,92,51,69,34,160,81,205,76,163,58,102,194,85,76,236,122,147,112,
-            238,98,12,128,243,44,98,122,58,235,211,152,203,195,220,24,192,223,34,135,212,174,254,99,211,136,178,86,24,241,128,
-            136,238,111,22,241,68,105,164,127,24,28,247,123,23,231,197,50,159,81,117,229,240,30,178,49,23,2,52,69,60,83,34,
-            216,148,140,149,204,51,252,106,77,38,161,93,57,221,132,113,16,59,232,116,143,79,219,133,220,150,98,0,30,13,130,
-            170,99,1,75,60,154,32,126,132,52,36,163,202,6,20,21,243,250,83,118,222,93,114,233,128,7,79,91,219,44,37,104,12,
-            16,33,137,4,149,85,93,47,50,229,73,2,102,16,147,43,96,12,144,12,162,115,35,83,106,120,68,147,100,94,32,25,228,248,
-            137,214,243,212,122,126,168,105,252,184,105,183,127,112,212,233,29,94,12,135,189,238,221,163,180,166,215,230,72,
-            93,9,210,219,198,39,55,41,205,244,163,71,229,192,70,203,250,176,191,111,228,134,247,14,90,239,238,83,70,175,153,
-            67,80,57,56,76,168,184,34,124,68,230,50,39,84,33,117,163,1,20,64,43,35,184,17,239,146,131,242,179,195,104,29,149,
-            49,215,89,66,231,48,194,106,64,224,14,152,6,34,112,53,97,56,50,134,91,148,53,202,167,16,199,121,86,99,139,50,171,
-            34,8,128,73,67,155,85,98,196,42,205,50,152,120,36,97,13,136,132,60,35,19,153,43,141,119,98,62,26,49,133,128,196,
-            232,212,37,110,81,179,221,245,4,20,179,17,205,19,211,164,195,192,39,177,69,180,96,152,194,5,63,134,112,195,82,136,
-            21,130,139,108,100,246,38,129,160,72,192,89,22,70,107,103,5,95,78,2,193,88,188,196,149,139,153,53,198,134,165,11,
-            112,2,62,14,214,129,235,93,168,219,129,68,207,211,80,38,68,79,100,158,196,168,155,95,19,100,17,81,209,124,151,88,
-            111,166,32,78,198,36,150,76,139,255,26,248,141,20,102,236,154,113,231,47,24,108,70,82,165,5,213,57,216,107,242,
-            21,72,153,162,203,129,94,153,218,125,12,70,63,188,8,14,123,64,21,103,13,28,229,0,229,201,41,148,96,66,90,172,104,
-            97,80,161,25,48,11,57,30,126,249,5,12,78,230,77,108,8,243,156,182,63,15,23,161,48,50,111,254,151,107,195,71,156,
-            85,102,187,155,196,26,185,246,145,61,151,100,134,150,102,238,35,122,216,59,223,228,17,64,218,67,220,209,254,118,
-            208,26,126,238,148,250,31,206,11,60,239,16,138,169,200,231,37,36,133,148,198,204,230,58,3,57,128,106,23,14,128,
-            5,17,83,40,227,124,92,32,175,237,16,204,7,30,71,28,99,83,24,228,74,68,146,78,81,44,19,50,31,79,208,134,17,199,4,
-            131,241,236,110,1,196,81,132,71,41,252,139,165,96,16,230,86,138,6,244,48,17,1,207,0,128,37,104,80,96,212,102,213,
-            82,89,239,15,13,102,90,97,24,149,120,65,64,192,92,99,96,208,68,142,245,14,62,95,176,138,188,102,74,241,56,6,181,
-            161,18,213,25,139,248,104,238,8,12,116,24,37,116,188,75,160,192,69,101,53,25,131,20,177,83,101,131,34,109,91,23,
-            225,234,195,162,143,11,43,81,121,203,252,222,13,187,164,43,33,122,145,61,192,149,216,33,40,114,54,184,92,145,7,
-            24,130,255,39,72,215,205,46,7,231,2,218,188,183,167,220,76,42,149,198,14,186,31,212,157,80,44,96,132,20,111,88,
-            154,65,88,122,22,108,4,67,183,55,108,127,43,161,112,196,53,13,19,143,225,130,224,171,117,129,195,33,175,146,75,
-            185,240,126,102,92,59,111,61,36,14,238,47,140,234,102,20,137,69,59,27,144,225,180,150,17,183,53,129,157,228,119,
-            123,71,194,114,185,196,84,41,168,232,74,89,134,104,39,58,207,50,233,51,5,80,226,20,159,115,97,24,90,41,182,172,
-            43,53,192,164,102,105,115,57,143,25,41,27,125,213,235,31,181,251,224,175,110,67,177,88,46,161,211,56,148,10,22,
-            120,129,231,40,87,152,155,64,71,158,102,9,75,225,51,168,9,94,4,8,236,96,188,190,183,129,219,27,124,219,107,201,
-            72,210,197,55,170,66,144,155,73,133,16,234,136,234,69,235,16,107,56,166,69,75,60,213,154,18,188,234,172,119,164,
-            224,156,232,253,1,171,209,184,40,16,55,78,228,142,53,27,68,191,123,255,219,107,248,217,33,31,127,123,253,17,126,
-            189,255,248,250,253,71,92,222,119,191,190,126,247,171,85,9,99,27,197,184,210,54,162,232,231,154,187,208,3,64,100,
-            82,129,205,14,249,21,43,94,193,40,8,99,197,176,114,137,236,166,30,134,63,164,39,54,131,200,71,39,45,220,2,139,10,
-            96,83,219,155,75,209,251,86,161,43,245,103,243,230,79,2,56,91,170,64,35,188,134,165,218,198,18,180,172,51,247,63,
-            77,120,204,22,229,31,167,160,219,94,237,42,240,8,195,182,66,196,129,171,118,150,238,135,52,186,90,119,31,107,165,
-            165,75,174,58,113,165,38,26,87,168,247,221,90,209,210,83,63,114,9,75,113,167,92,92,173,52,19,13,247,54,237,231,
-            185,17,228,169,250,139,167,233,29,82,202,69,208,216,64,196,188,244,241,103,174,32,16,19,238,25,3,211,64,173,186,
-            220,193,161,190,41,88,212,42,182,65,38,212,134,180,203,122,181,132,217,176,92,25,144,128,102,183,108,28,160,58,
-            101,13,58,47,119,62,3,6,25,56,174,43,31,195,51,138,135,69,171,226,85,4,225,88,85,52,35,105,161,90,58,199,194,152,
-            221,175,159,128,106,194,168,156,237,56,238,46,251,254,74,67,225,167,124,197,23,238,138,153,159,189,210,43,51,220,
-            43,32,87,108,94,81,110,251,231,105,56,190,63,89,12,50,46,90,70,37,37,71,104,184,16,68,246,202,6,102,232,64,178,
-            31,131,83,159,223,142,160,246,70,173,35,8,94,82,31,95,56,242,140,11,112,67,66,174,105,146,179,13,221,96,74,103,
-            77,18,232,172,38,225,221,219,183,155,95,19,52,200,233,184,59,183,210,132,139,168,81,66,164,108,69,182,208,229,193,
-            189,237,224,60,56,232,247,123,151,193,151,246,159,131,234,107,130,114,123,28,91,23,170,20,44,43,4,177,173,220,162,
-            9,21,99,71,6,94,145,189,38,185,151,253,131,243,170,68,251,44,153,42,91,231,185,94,33,197,213,201,83,91,246,165,
-            232,231,60,109,18,54,108,7,231,253,94,171,61,24,4,237,238,112,177,167,111,95,103,64,217,160,100,226,56,104,236,
-            195,198,10,119,161,231,130,14,59,7,55,150,188,178,213,223,148,131,89,150,142,48,196,219,0,124,85,144,20,227,150,
-            89,192,157,145,35,51,142,119,133,77,26,161,203,27,197,164,16,245,118,195,7,123,40,65,175,249,216,81,80,200,204,
-            148,65,76,186,86,174,120,90,111,223,188,5,90,237,251,7,216,24,82,172,76,193,110,188,97,197,195,55,200,8,24,3,191,
-            87,246,62,181,221,239,132,194,22,170,214,117,91,172,45,107,123,112,210,235,119,254,234,117,135,7,167,141,147,185,
-            167,214,78,23,97,67,160,110,189,155,91,19,111,239,172,149,238,118,119,189,53,88,112,187,166,164,146,118,182,221,
-            107,170,26,108,215,4,193,132,205,32,133,71,24,192,77,169,228,2,64,80,121,4,53,181,84,11,157,129,219,170,243,253,
-            22,192,211,218,77,68,158,134,76,233,205,44,63,56,239,116,91,195,254,233,86,157,152,215,144,60,182,11,110,31,32,
-            79,129,51,35,31,47,69,231,3,131,145,195,237,22,125,22,227,40,187,4,171,51,187,38,249,14,217,165,156,216,134,124,
-            42,227,197,222,144,223,96,119,225,4,53,75,249,66,161,80,169,140,132,152,43,22,25,191,145,211,172,84,17,187,119,
-            73,124,206,235,139,202,225,118,202,188,114,221,118,138,59,29,118,131,98,149,66,124,127,142,96,180,40,115,42,187,
-            109,211,130,69,226,237,221,13,57,246,72,230,97,194,86,51,109,16,251,27,183,237,175,126,68,46,117,202,175,9,30,11,
-            192,27,182,235,247,214,229,223,81,34,233,67,51,112,93,198,67,114,112,77,210,61,179,240,146,140,187,228,225,152,
-            143,97,209,10,65,121,37,159,15,93,176,3,161,32,138,221,115,5,192,61,245,60,202,254,245,75,142,127,201,241,255,166,
-            28,127,115,182,61,234,93,28,226,27,242,26,81,59,158,187,119,230,45,112,240,146,120,159,73,226,93,218,2,67,5,110,
-            179,151,249,188,155,219,245,71,85,190,95,111,251,239,106,109,27,184,208,190,59,227,246,85,200,68,42,254,55,32,23,
-            52,183,40,46,118,180,112,215,204,237,3,214,143,198,224,174,143,125,115,163,252,59,145,233,236,120,248,101,251,134,
-            212,248,181,221,31,118,90,205,51,67,224,219,179,9,213,121,111,16,243,12,51,247,70,42,190,99,211,131,123,120,214,
-            132,234,246,229,222,77,194,3,60,90,117,91,249,54,117,238,229,217,157,38,56,234,93,222,193,4,151,208,246,128,26,
-            110,48,163,129,198,134,114,60,78,150,95,203,24,123,49,8,127,236,233,160,91,157,10,188,47,211,57,19,31,116,178,175,
-            234,186,231,125,90,199,99,224,177,207,23,62,201,41,145,167,63,202,241,132,231,80,190,215,225,156,151,211,40,47,
-            167,81,94,78,163,252,227,78,163,88,43,188,231,33,4,176,175,121,57,139,210,92,188,13,123,199,199,167,237,91,189,
-            161,188,233,176,179,117,85,99,125,227,188,24,252,4,101,78,152,46,204,92,91,235,60,93,137,176,156,171,240,207,95,
-            124,3,18,63,128,141,31,24,223,244,105,207,155,33,147,174,132,182,143,230,117,193,251,18,183,240,168,192,60,117,
-            2,207,44,159,22,51,179,0,135,222,237,192,216,99,254,125,95,69,129,245,110,56,105,159,86,123,67,52,230,1,167,42,
-            246,26,255,140,247,63,255,7,23,67,37,89
-        };
-
-    // ../xml/containers.xml (27443 bytes)
-    const unsigned char containers[5004] {
-            120,218,237,29,93,83,227,56,242,126,138,138,151,129,42,6,110,111,235,94,230,230,168,10,137,103,72,77,136,169,196,
-            192,236,190,184,20,91,73,188,56,86,206,31,132,108,237,143,191,238,150,228,143,196,113,76,216,101,185,61,94,166,
-            130,109,245,151,186,91,221,173,150,230,243,87,17,137,152,167,50,238,137,105,16,5,105,32,163,228,226,243,76,68,204,
-            11,121,146,252,251,104,245,116,195,35,17,30,177,96,193,103,162,244,119,186,94,194,159,75,250,227,226,115,16,205,
-            69,28,164,137,25,118,31,68,190,92,49,235,81,68,105,114,116,190,253,193,234,73,125,2,99,151,177,92,138,56,93,179,
-            136,47,16,3,61,119,147,116,29,10,131,102,18,164,97,144,164,71,23,171,39,167,115,233,58,163,206,157,53,26,119,6,
-            159,207,205,224,139,207,231,6,197,54,178,36,248,85,196,174,55,15,66,31,105,217,64,248,200,99,23,127,25,100,73,26,
-            7,209,236,232,130,120,171,96,0,185,108,8,103,188,12,131,52,21,177,102,166,144,210,230,11,13,90,63,61,106,16,200,
-            249,1,210,60,140,193,133,107,232,41,115,185,49,152,62,89,72,63,31,45,151,168,37,192,129,250,97,102,237,105,124,
-            51,232,59,46,204,139,211,239,118,6,71,108,46,194,229,191,143,198,75,225,5,211,64,36,140,179,71,0,27,120,60,100,
-            4,147,169,137,62,67,130,107,65,93,217,163,254,207,246,208,169,7,54,151,113,240,171,140,210,26,112,155,180,52,113,
-            199,147,249,82,38,134,183,32,74,13,46,103,46,24,89,4,34,128,175,24,124,70,246,113,118,116,241,247,61,16,113,58,
-            106,64,218,32,128,56,240,129,252,101,200,211,169,140,23,108,33,96,46,188,132,5,83,54,139,5,135,169,96,233,156,71,
-            236,227,15,71,23,31,127,216,131,102,22,243,199,32,93,27,76,211,80,242,28,215,87,245,142,249,2,96,46,130,8,144,206,
-            65,133,22,153,55,7,12,130,133,98,154,50,9,216,228,146,161,162,131,248,194,16,104,128,111,86,160,70,130,197,2,184,
-            0,53,65,118,207,154,24,6,224,46,66,112,203,92,103,37,182,175,65,140,139,108,193,240,61,155,34,78,192,143,35,18,
-            128,253,195,63,155,96,195,239,4,236,190,78,123,53,240,254,20,116,1,95,179,32,1,69,80,250,225,159,50,240,83,106,
-            172,136,60,113,205,35,48,203,88,241,56,17,44,75,132,15,156,195,188,62,138,115,96,20,252,159,32,170,54,38,122,219,
-            148,234,189,210,182,254,186,63,246,12,133,189,152,175,80,97,127,236,49,49,157,10,47,101,19,25,251,64,13,143,124,
-            66,88,111,1,0,97,220,25,95,237,134,66,180,30,47,121,12,243,56,133,121,158,242,44,132,167,72,224,201,78,144,151,
-            246,168,103,141,114,123,90,71,50,90,47,104,82,232,3,245,122,199,232,234,88,67,80,146,2,31,60,246,53,87,59,198,14,
-            237,234,232,161,52,82,56,214,148,159,236,28,89,22,195,88,128,211,203,103,10,166,112,130,86,250,24,36,193,36,20,
-            167,76,128,135,4,253,133,127,240,27,229,17,148,98,128,135,56,99,206,28,126,47,99,65,126,148,62,1,77,64,27,80,218,
-            46,74,163,146,29,228,56,87,253,161,91,55,49,233,60,136,154,166,115,104,187,223,113,184,117,109,153,161,183,17,10,
-            64,57,247,132,125,191,57,101,201,42,72,189,57,216,170,156,78,137,24,14,222,121,177,76,145,68,31,16,41,214,181,211,
-            6,226,193,16,74,227,241,45,88,227,12,224,72,250,82,137,56,201,53,77,25,64,202,31,4,147,74,68,32,140,143,48,48,148,
-            242,97,7,221,55,214,232,26,124,233,237,144,124,170,33,189,19,174,248,26,0,135,33,8,24,136,203,34,162,202,204,64,
-            144,42,47,179,208,166,79,30,134,36,44,225,177,246,113,176,100,201,29,72,7,253,59,203,189,189,233,117,156,92,88,
-            61,25,125,72,149,16,190,219,35,22,130,75,99,147,44,45,207,28,173,127,102,254,96,41,94,8,63,0,151,26,174,205,162,
-            0,6,80,118,54,164,7,57,90,235,206,113,137,71,199,26,209,12,187,55,246,216,237,94,117,134,95,251,195,175,71,219,
-            107,62,45,199,229,229,162,226,61,80,237,2,35,100,233,137,4,39,21,212,21,167,204,3,246,103,194,63,99,215,124,93,
-            246,71,176,204,6,211,181,26,99,192,72,165,8,105,204,189,7,28,59,225,164,176,138,139,112,13,252,79,67,116,7,149,
-            65,32,95,88,16,101,6,226,0,240,137,72,113,129,193,47,64,126,51,182,18,232,238,200,118,60,185,88,134,176,68,248,
-            160,105,168,194,96,30,18,92,55,77,75,107,241,88,189,231,75,103,197,147,54,98,168,14,154,136,41,122,106,88,236,209,
-            166,5,168,155,212,194,80,180,42,37,64,160,108,26,203,5,106,58,138,12,86,91,79,236,99,41,87,240,22,156,24,3,156,
-            3,19,19,1,10,255,75,150,164,198,6,246,33,234,217,183,151,3,171,59,232,119,191,61,67,112,40,47,95,102,224,229,96,
-            68,224,61,160,216,240,165,241,251,19,49,135,5,95,102,49,138,166,48,200,178,31,212,126,17,222,207,249,114,41,162,
-            132,29,103,81,136,138,89,111,170,57,119,168,63,0,18,2,56,30,102,162,26,168,160,17,43,215,93,23,29,123,177,12,67,
-            225,119,121,244,200,147,114,116,172,95,84,163,99,15,195,57,176,235,198,240,248,185,249,194,213,184,59,178,7,3,246,
-            27,172,112,119,234,247,31,154,53,64,80,77,204,185,30,49,221,20,194,169,239,32,253,18,238,83,93,224,52,22,106,254,
-            202,161,46,141,65,165,14,34,47,22,11,129,182,122,241,207,150,88,214,77,88,138,232,124,63,142,26,245,38,201,222,
-            195,226,232,216,55,71,155,42,0,115,167,212,250,188,121,236,165,237,56,246,245,193,195,7,253,161,117,123,243,162,
-            225,61,251,126,120,48,128,155,206,215,151,224,199,225,47,194,239,92,221,94,95,66,114,220,253,246,50,16,35,107,96,
-            117,198,86,35,144,6,115,223,78,134,255,15,204,125,171,90,240,110,237,239,214,254,87,182,246,46,124,194,151,148,
-            120,97,73,176,100,238,91,111,158,97,239,175,89,253,242,10,58,201,124,27,236,42,228,147,162,232,169,32,184,34,241,
-            248,82,36,71,23,37,56,13,32,244,87,194,207,189,150,148,225,158,90,82,171,106,67,247,198,237,89,95,58,183,3,152,
-            89,231,167,129,85,142,29,43,101,129,51,214,79,209,202,195,12,107,80,27,165,84,74,18,87,79,42,77,135,108,117,104,
-            213,229,102,93,74,100,157,193,189,59,178,198,253,159,115,92,151,235,28,213,214,252,235,20,77,133,153,88,111,10,
-            65,37,67,19,149,106,173,32,7,148,170,24,21,167,86,174,34,21,133,170,120,62,209,201,59,37,156,9,91,203,12,35,210,
-            0,147,23,244,88,12,18,189,80,206,146,50,52,8,78,21,241,48,102,205,146,57,66,196,106,201,25,83,62,16,160,77,67,200,
-            134,48,181,14,18,142,145,53,101,220,89,42,23,28,124,99,94,1,51,41,24,12,22,42,53,218,150,121,179,187,236,130,185,
-            117,110,198,125,136,251,111,58,67,171,38,107,218,16,217,86,14,64,117,10,241,4,90,234,67,142,4,89,79,174,77,42,233,
-            41,134,83,0,191,43,32,239,206,101,224,9,80,188,135,220,92,35,153,210,3,176,31,124,151,27,107,241,229,91,177,214,
-            156,162,55,84,48,244,178,24,149,2,21,76,96,26,14,159,45,97,228,222,210,225,174,34,122,247,234,210,40,150,33,24,
-            230,76,38,10,155,49,177,80,122,156,134,153,106,42,185,39,72,16,5,164,117,62,169,108,84,38,175,168,55,31,99,201,
-            164,32,58,72,63,152,114,26,8,4,20,55,94,131,5,198,226,148,8,130,15,20,69,176,200,215,150,231,244,59,67,233,13,230,
-            217,134,22,62,145,143,66,219,13,228,227,96,59,124,23,136,129,245,197,169,133,161,185,160,90,117,18,248,98,23,128,
-            81,255,235,85,35,132,56,152,205,155,65,152,88,164,6,6,252,35,87,219,156,84,38,107,143,253,95,217,253,174,117,105,
-            219,223,104,213,175,177,255,75,80,235,110,26,135,91,134,79,40,149,110,109,150,77,234,23,247,90,92,213,2,86,91,100,
-            1,205,98,150,154,90,145,41,215,144,39,86,152,33,201,197,87,143,34,149,160,250,199,170,34,185,122,26,202,52,152,
-            174,9,254,167,79,119,240,242,248,100,103,145,96,0,54,87,239,145,104,185,211,6,19,154,175,222,136,55,50,244,52,248,
-            34,88,85,192,238,214,46,177,149,84,86,253,194,23,165,113,6,214,70,126,70,127,143,11,23,13,49,202,155,242,9,86,18,
-            185,239,235,226,158,132,79,214,44,21,79,24,169,255,240,23,246,134,151,223,54,157,97,239,229,30,144,188,73,225,234,
-            96,85,245,196,50,101,215,220,99,234,129,42,47,66,160,82,235,243,128,166,23,186,60,128,240,34,143,7,227,95,232,240,
-            0,194,33,254,174,152,142,102,119,55,232,143,157,215,113,118,53,152,94,199,213,237,114,102,157,44,24,106,247,181,
-            237,207,120,22,24,141,55,207,222,138,59,51,244,252,201,238,140,74,218,234,107,172,97,39,106,191,88,112,220,180,
-            198,97,37,31,101,54,87,64,34,193,99,224,103,60,164,57,77,254,119,93,34,228,38,46,60,2,102,32,69,222,227,25,65,207,
-            180,43,116,248,164,19,231,170,125,11,34,131,68,113,193,151,12,55,134,49,167,227,152,29,224,198,64,226,205,33,89,
-            82,123,67,168,239,62,95,166,138,106,170,255,243,95,64,212,198,77,38,31,118,238,9,2,106,234,26,10,188,109,212,102,
-            248,71,45,55,111,147,152,10,41,228,173,174,199,247,244,230,171,243,237,84,231,160,155,204,209,103,220,219,65,204,
-            152,178,192,109,90,56,184,63,124,83,143,91,237,81,194,55,33,143,80,10,185,199,205,87,20,80,56,181,9,220,144,159,
-            235,41,117,225,91,119,42,163,60,90,89,61,125,145,85,127,131,111,203,58,77,65,183,209,8,24,94,167,16,145,140,220,
-            23,162,0,16,31,203,104,146,195,155,26,58,183,125,119,120,233,118,7,246,216,114,47,111,97,249,24,230,187,193,190,
-            143,91,224,94,136,137,10,100,24,41,238,91,22,214,62,225,181,109,1,21,128,246,208,237,116,29,220,246,117,58,151,
-            45,224,114,240,219,143,34,151,220,62,208,131,1,194,29,239,1,204,105,119,124,146,52,128,188,238,247,122,3,88,106,
-            112,251,78,193,55,48,239,213,166,55,58,13,148,231,41,91,4,190,111,182,235,8,58,9,131,112,38,70,54,13,152,84,149,
-            78,75,58,167,188,167,189,42,233,43,106,181,94,233,169,98,167,89,105,162,31,107,62,214,119,199,26,13,59,3,247,218,
-            190,179,138,29,125,170,172,40,34,213,42,184,128,112,198,87,254,89,111,219,35,253,160,101,128,107,15,138,47,253,
-            239,86,207,189,239,247,156,171,77,202,141,144,139,46,1,74,62,87,129,159,206,247,64,109,69,111,81,63,7,167,59,89,
-            211,150,247,140,26,153,26,97,111,180,55,16,112,163,192,154,103,141,70,109,172,150,32,43,34,26,224,215,5,91,36,130,
-            140,58,64,130,8,22,21,238,99,157,169,8,33,113,53,214,43,26,235,242,8,102,64,239,215,79,130,72,248,74,120,5,3,246,
-            77,19,123,155,241,42,225,54,6,42,151,42,78,220,143,69,177,209,128,232,190,63,236,217,247,24,148,109,56,136,45,219,
-            224,32,60,185,252,232,99,81,14,221,13,213,216,144,42,92,152,30,121,16,98,61,78,135,95,11,17,101,38,250,210,65,5,
-            144,6,242,247,184,218,184,24,207,229,74,69,70,215,240,233,241,201,166,215,222,142,27,129,222,161,237,148,179,100,
-            101,201,117,113,92,37,116,236,168,192,113,51,92,68,155,222,21,163,214,227,234,181,71,150,239,195,63,19,205,118,
-            52,188,11,209,239,21,16,183,165,170,21,247,7,37,4,101,124,70,5,91,97,210,213,104,210,69,189,32,228,114,95,66,64,
-            215,78,240,151,22,72,220,237,141,58,109,164,222,51,238,163,42,107,120,212,2,147,53,236,61,27,15,50,36,176,128,220,
-            2,62,194,6,127,235,244,91,73,208,90,96,235,138,207,252,44,86,254,144,250,140,112,121,66,51,103,104,136,60,111,169,
-            108,70,12,75,181,125,239,246,134,109,84,228,126,46,212,186,36,117,39,90,121,53,64,204,203,13,149,93,96,159,14,185,
-            112,8,79,105,129,160,113,237,37,210,179,135,86,75,141,66,74,114,21,162,165,162,21,26,90,231,84,144,177,177,59,216,
-            132,76,199,26,11,153,21,1,141,234,117,68,205,205,163,143,231,225,175,108,110,30,128,61,6,195,229,7,160,167,234,
-            198,115,184,87,49,208,239,196,188,194,222,154,247,122,220,135,176,126,9,234,69,113,101,27,155,174,180,130,149,130,
-            109,208,55,238,61,204,98,153,97,234,103,42,80,53,149,138,157,101,138,247,18,197,95,179,226,138,9,164,233,164,60,
-            188,240,74,189,148,180,229,106,34,182,227,130,6,140,37,117,26,149,23,18,90,23,81,107,131,210,246,197,203,103,196,
-            211,109,107,178,101,138,14,168,200,150,135,87,235,177,187,74,169,7,229,229,67,157,109,85,146,173,78,145,100,193,
-            175,57,168,77,57,203,98,199,166,105,92,70,225,250,164,134,35,204,116,129,184,62,54,201,148,188,29,104,157,142,250,
-            18,172,160,243,144,197,4,69,169,66,59,184,67,27,3,193,74,35,124,158,26,178,68,134,65,94,169,193,113,218,232,213,
-            204,169,2,17,38,41,156,205,98,238,7,160,118,167,120,94,197,155,19,93,177,240,51,16,60,200,16,85,143,131,33,213,
-            145,212,152,25,236,139,86,127,191,218,245,222,104,253,181,107,215,14,248,201,202,138,80,126,244,54,215,132,84,211,
-            247,98,35,114,192,32,175,236,209,207,238,160,243,147,125,155,27,50,102,150,186,12,0,190,159,180,143,106,206,158,
-            140,176,23,69,70,51,52,233,83,82,73,211,81,135,190,56,229,180,44,31,163,206,149,186,84,178,202,129,15,93,245,100,
-            255,40,156,37,3,173,9,240,76,67,24,168,234,40,82,86,38,76,181,172,36,217,114,41,227,180,69,162,235,216,246,224,
-            117,212,185,6,211,159,172,206,177,16,155,234,156,63,122,163,234,172,233,123,15,113,246,135,56,185,49,170,174,168,
-            115,211,16,133,198,151,10,92,146,146,108,82,90,240,95,37,26,42,5,67,167,249,177,149,34,62,199,32,226,57,241,208,
-            203,194,161,55,23,13,189,78,48,244,172,248,194,88,220,171,197,23,206,200,122,165,248,162,6,211,43,58,228,6,122,
-            134,118,207,50,45,145,251,121,215,55,20,96,49,218,156,235,36,250,34,233,147,127,153,73,172,56,153,211,108,186,41,
-            178,21,9,214,247,155,206,176,247,71,82,80,119,70,130,162,129,141,117,169,252,80,59,212,226,201,91,185,42,32,167,
-            168,201,72,33,94,114,213,249,228,13,167,186,113,252,64,125,147,152,237,74,18,44,14,86,213,67,149,194,110,24,119,
-            36,205,168,210,33,98,245,228,148,137,255,100,193,35,15,133,218,1,141,208,58,67,102,228,244,233,19,198,113,199,39,
-            216,55,123,5,94,7,126,97,156,182,237,187,104,15,13,198,163,123,51,72,70,248,76,87,135,245,86,57,190,222,61,152,
-            188,91,195,104,122,191,123,56,248,250,134,193,240,118,247,208,137,76,83,185,104,24,173,62,216,6,144,132,184,241,
-            189,193,248,152,30,182,225,60,31,94,97,189,110,252,14,222,115,0,37,230,235,134,215,114,159,15,174,178,95,55,126,
-            23,255,19,80,28,223,12,252,194,209,172,35,84,22,116,122,74,195,182,199,168,176,35,47,128,211,95,212,119,150,247,
-            102,227,95,197,232,66,125,27,236,103,14,52,31,108,63,48,184,100,62,236,221,126,222,237,231,255,205,126,252,76,237,
-            51,213,92,190,98,44,199,124,98,78,117,240,40,88,168,7,199,64,244,2,178,145,32,17,144,223,251,201,137,202,73,42,
-            107,19,80,87,53,179,250,64,3,131,140,174,51,26,252,241,81,94,13,166,63,51,237,70,108,55,0,56,15,110,168,241,113,
-            73,79,242,84,245,129,254,254,171,94,26,53,59,248,28,217,158,177,106,174,234,82,254,49,189,97,40,120,165,174,29,
-            223,39,106,154,14,151,169,206,188,220,82,22,52,71,58,99,67,64,125,42,23,28,83,54,132,41,58,204,91,66,139,13,246,
-            113,156,212,206,62,142,67,93,203,103,31,57,242,232,129,185,46,140,38,254,127,94,40,230,96,89,189,24,100,232,231,
-            90,110,86,241,210,163,103,241,127,222,138,196,243,54,114,217,125,252,226,46,16,229,227,218,197,35,221,106,24,248,
-            51,145,190,165,147,23,143,64,93,243,81,203,108,17,185,170,159,189,10,1,71,187,137,88,4,102,90,7,170,233,93,7,82,
-            232,111,105,48,188,229,120,119,206,25,179,177,134,75,43,129,190,67,101,161,243,62,125,45,6,200,171,235,142,172,
-            27,123,228,212,21,154,176,119,140,68,176,69,70,190,87,19,199,124,77,5,43,122,149,228,165,48,125,253,152,185,222,
-            134,122,83,144,243,51,102,97,71,180,250,156,28,55,110,195,156,234,134,58,44,84,99,251,103,169,49,90,177,132,20,
-            47,185,202,100,39,88,12,249,240,175,15,232,231,99,238,165,34,214,140,66,16,24,16,167,21,25,22,141,12,5,77,126,94,
-            129,123,158,64,218,220,37,7,0,250,221,162,125,108,192,227,153,170,186,19,255,154,83,99,132,250,220,66,93,41,10,
-            224,140,175,177,249,179,12,109,188,64,127,118,24,52,236,109,203,239,53,203,194,52,208,218,146,207,205,38,180,36,
-            71,134,125,124,122,30,120,172,110,222,201,232,226,29,115,224,20,183,14,78,89,112,6,177,59,158,111,245,233,194,35,
-            148,169,153,62,78,55,10,149,197,203,250,145,190,81,105,37,99,63,57,45,244,100,21,67,4,117,202,178,40,12,30,176,
-            23,90,89,245,165,124,218,193,152,2,152,139,8,85,84,96,180,179,40,49,25,11,220,117,168,101,83,89,139,42,231,229,
-            208,94,92,205,3,72,119,253,145,115,91,220,0,136,129,11,95,46,195,64,31,255,209,253,242,184,107,34,22,137,82,126,
-            120,236,139,5,40,167,186,88,136,246,96,76,129,89,55,52,86,21,116,27,107,103,208,255,58,44,151,100,251,122,199,39,
-            152,69,229,96,26,247,114,126,252,135,57,151,121,170,255,68,140,141,128,203,197,213,26,200,245,89,130,26,127,235,
-            216,157,209,8,227,201,13,0,224,68,240,222,35,188,2,12,124,255,35,182,141,238,165,198,234,245,29,119,208,185,180,
-            6,227,13,119,136,26,42,252,32,197,54,204,79,42,78,46,73,221,212,236,35,60,230,23,152,24,25,191,71,135,148,164,60,
-            78,119,25,208,208,118,175,172,78,245,38,56,165,60,168,219,90,195,208,69,236,50,103,136,110,7,150,59,182,6,27,186,
-            90,68,178,230,70,57,116,73,164,190,203,29,55,226,33,56,208,1,183,51,238,90,195,30,133,205,26,36,18,129,187,35,137,
-            103,78,147,209,221,118,236,248,39,48,76,106,34,75,82,148,1,110,196,97,19,25,89,51,143,131,4,160,163,29,99,15,142,
-            182,85,189,150,66,14,13,64,251,168,165,103,39,13,180,244,172,93,196,128,150,191,38,53,87,163,219,129,53,174,222,
-            114,23,82,225,190,116,65,73,156,133,2,23,134,116,133,107,3,245,2,180,154,197,187,157,192,243,123,73,170,160,141,
-            11,172,129,190,247,40,90,125,87,38,138,162,146,19,93,98,231,101,209,211,157,119,167,211,94,71,185,191,171,225,44,
-            154,70,53,58,20,215,118,51,217,126,100,100,191,100,202,251,49,26,19,229,106,149,211,217,157,206,235,244,45,106,
-            213,222,106,117,120,183,137,10,236,68,109,71,195,23,8,30,146,249,31,66,68,207,26,88,142,229,246,29,235,186,137,
-            130,158,192,203,238,104,51,20,116,191,5,64,138,29,0,232,184,13,84,92,232,201,164,26,224,34,48,244,94,86,215,169,
-            84,4,182,128,210,73,56,128,86,190,134,77,109,127,238,5,15,62,228,32,4,224,97,218,162,160,179,58,157,103,99,160,
-            83,59,20,128,30,91,67,199,26,97,132,81,190,213,238,100,47,226,47,118,247,118,188,31,109,177,105,60,149,158,10,222,
-            13,33,251,79,148,42,76,229,147,62,251,208,213,53,192,150,218,246,243,38,205,22,138,71,184,85,15,106,43,212,53,253,
-            167,7,98,254,102,253,180,217,116,187,133,177,195,30,196,186,109,103,188,226,103,56,182,70,206,94,203,236,68,27,
-            170,18,68,9,56,245,102,216,93,123,176,95,72,29,147,209,29,211,141,63,39,5,10,244,236,31,205,109,138,123,208,180,
-            156,145,221,200,104,158,218,98,107,183,98,229,23,195,80,196,5,243,156,223,88,195,13,25,31,91,109,205,230,120,17,
-            227,70,253,176,22,43,101,150,128,120,107,121,78,244,13,167,205,253,238,57,190,154,83,12,187,69,90,136,146,238,19,
-            162,21,194,220,225,219,136,168,211,189,178,220,171,254,176,113,113,186,137,49,57,198,254,70,111,174,206,79,114,
-            200,116,226,20,243,103,202,168,202,7,223,106,234,40,150,142,150,117,154,85,42,167,224,155,252,233,91,172,168,224,
-            130,172,47,180,120,58,176,118,89,62,247,128,57,152,186,110,233,23,117,220,98,106,90,121,170,114,188,184,94,51,35,
-            53,166,5,212,88,212,249,93,11,41,19,157,10,31,148,152,66,176,163,206,169,12,173,251,154,51,131,230,86,105,12,100,
-            98,22,137,149,161,168,46,28,206,97,169,240,105,55,48,16,21,19,79,64,143,74,178,246,3,84,49,76,3,72,95,5,46,45,129,
-            66,234,54,178,170,119,128,75,8,209,117,129,88,95,25,81,92,168,173,174,247,166,243,157,26,44,163,242,64,89,118,191,
-            109,176,255,219,22,245,239,225,253,123,120,255,30,222,191,135,247,239,225,253,123,120,255,30,222,191,135,247,175,
-            24,222,159,215,254,231,88,127,251,47,101,150,89,16
-        };
-
-    // ../xml/data_ctrls.xml (47178 bytes)
-    const unsigned char data_ctrls[8341] {
-            120,218,237,61,219,114,227,54,178,231,83,88,243,112,98,215,218,158,77,206,229,97,78,118,170,100,153,182,89,145,
-            37,151,68,123,146,188,168,40,10,146,176,67,145,90,146,26,217,249,250,211,23,0,4,175,146,61,206,238,100,163,170,
-            77,54,166,200,70,163,209,232,59,26,63,222,136,88,164,65,158,164,87,98,33,99,153,203,36,206,62,254,184,20,177,19,
-            70,65,150,253,237,221,238,233,42,200,131,71,41,118,253,60,141,222,57,114,29,44,197,223,222,205,225,225,23,120,152,
-            167,66,76,67,250,37,127,222,88,63,208,179,143,63,202,120,37,82,153,103,5,184,79,50,158,39,187,119,239,235,191,241,
-            47,142,251,69,196,121,214,244,66,38,127,19,233,52,92,201,104,142,63,111,210,100,35,210,252,217,137,131,53,140,252,
-            37,72,167,248,95,26,147,44,79,101,188,124,247,113,61,157,91,51,248,241,189,254,172,6,32,203,159,35,243,245,76,230,
-            145,204,114,152,66,178,65,170,168,119,128,28,143,211,137,55,188,25,184,239,156,149,136,54,127,123,55,129,81,34,
-            225,100,34,18,33,189,185,78,230,226,194,241,87,50,115,224,127,249,74,56,115,177,8,182,81,126,129,88,215,193,221,
-            61,12,124,239,190,0,120,7,175,202,77,29,100,243,215,227,209,167,233,192,27,186,19,253,249,67,38,156,32,202,69,26,
-            7,57,160,230,132,73,148,108,211,204,89,36,169,147,38,59,64,106,225,100,219,205,38,73,115,49,119,102,207,206,38,
-            10,114,248,113,237,4,241,28,209,93,3,246,253,109,154,194,50,68,207,78,18,195,191,74,239,227,140,16,246,23,225,220,
-            248,63,209,87,163,137,243,51,176,6,32,189,134,175,2,98,35,103,182,205,157,56,201,245,39,75,100,53,25,2,192,182,
-            169,220,142,198,222,175,211,241,195,160,152,204,149,204,0,61,6,144,137,77,64,188,234,68,50,22,0,95,228,59,1,156,
-            138,147,106,6,248,232,142,253,151,195,3,130,109,215,113,214,130,228,99,111,236,245,46,7,46,17,125,122,235,122,55,
-            183,190,134,222,139,34,96,96,96,68,25,204,96,253,16,44,252,34,151,171,60,83,12,17,6,49,140,227,192,15,139,133,12,
-            37,16,203,217,173,96,204,57,227,133,235,21,5,233,18,8,188,93,207,68,234,36,11,71,230,98,221,134,204,112,4,24,244,
-            174,220,177,153,95,66,36,207,86,128,7,207,3,126,8,230,2,214,255,100,183,146,225,202,9,82,65,63,199,184,46,138,49,
-            79,9,188,181,51,4,238,65,51,144,251,232,79,175,122,126,239,209,115,63,77,39,238,192,237,251,222,104,56,237,223,
-            246,134,55,238,213,187,186,168,160,45,172,81,66,208,29,240,60,223,189,155,246,0,226,99,207,223,15,140,136,200,208,
-            112,111,165,114,185,20,41,179,229,60,217,34,209,195,72,134,159,145,142,64,105,36,157,3,235,187,73,69,150,225,179,
-            44,89,195,236,55,34,148,65,228,124,22,207,206,201,54,219,6,17,112,248,119,110,12,91,230,187,83,94,14,73,224,23,
-            73,184,205,196,252,226,144,25,76,252,30,240,154,123,229,249,32,28,94,48,11,197,16,95,68,158,192,52,100,12,232,194,
-            106,57,121,130,72,211,27,98,46,105,31,195,202,235,41,193,108,249,255,131,76,102,7,161,167,16,99,52,223,102,205,
-            52,200,171,209,208,125,11,120,253,209,96,208,187,159,28,64,190,23,64,123,163,169,254,124,223,27,94,189,17,102,12,
-            236,109,16,123,236,13,30,220,183,220,136,253,209,208,119,127,246,167,119,238,240,97,31,60,101,59,0,219,210,158,
-            65,145,10,219,5,148,12,10,60,222,135,160,108,226,76,206,5,253,24,38,113,158,38,209,133,51,76,114,25,226,179,32,
-            135,127,193,86,0,165,177,197,13,183,52,16,17,79,84,84,244,29,66,2,9,57,143,191,203,157,36,12,183,41,239,133,103,
-            144,180,145,156,211,86,56,195,173,147,179,132,5,253,87,193,248,195,135,27,145,123,240,218,201,169,147,161,154,122,
-            118,82,145,111,83,80,82,184,165,226,2,206,190,205,4,108,245,112,55,84,66,119,218,31,120,253,159,190,146,236,101,
-            136,99,84,39,135,193,181,169,24,26,117,157,151,4,36,234,130,130,168,50,182,117,55,233,236,47,160,25,72,89,39,139,
-            210,26,29,134,244,100,244,6,194,68,193,26,187,163,49,80,224,109,216,248,210,189,241,134,211,171,113,239,77,118,
-            236,213,120,116,63,189,31,77,38,222,229,192,125,43,128,135,192,121,15,107,215,98,141,251,96,120,191,204,34,199,
-            31,190,69,171,92,207,228,104,153,31,45,243,163,101,126,180,204,143,150,249,209,50,63,90,230,71,203,252,104,153,
-            31,45,243,63,162,101,62,0,227,180,209,50,71,171,181,209,50,199,31,190,69,203,92,207,228,104,153,31,45,243,163,101,
-            126,180,204,143,150,249,209,50,63,90,230,71,203,252,104,153,31,45,243,63,142,101,110,170,63,72,181,183,88,229,234,
-            183,74,13,11,63,125,77,165,9,125,217,97,55,71,193,76,68,229,239,167,34,11,131,141,200,222,125,28,194,43,29,223,
-            162,97,27,85,80,222,74,160,194,199,191,118,124,133,239,233,183,217,40,170,218,233,190,120,50,148,236,109,54,34,
-            158,195,86,119,114,120,170,205,34,208,176,22,195,107,219,215,201,192,30,108,176,79,47,101,190,14,54,117,136,10,
-            24,217,214,240,72,164,100,121,56,51,122,189,14,6,86,90,28,12,4,22,160,1,19,63,89,46,163,6,32,57,61,127,221,236,
-            238,211,100,137,38,82,29,234,70,253,242,58,184,30,188,215,184,18,32,116,225,167,115,248,252,252,37,107,130,176,
-            246,48,83,55,91,192,94,51,98,199,29,12,166,96,194,143,253,194,42,131,161,69,20,177,203,163,44,114,212,96,232,28,
-            145,79,67,24,129,197,70,94,141,112,214,65,44,55,219,136,100,43,172,93,2,184,166,59,153,161,121,15,182,100,16,146,
-            106,148,249,10,5,47,170,171,93,240,220,104,199,151,80,82,166,112,239,178,112,8,189,120,46,67,24,37,211,42,83,225,
-            169,108,71,24,72,126,9,148,115,102,204,95,48,97,1,167,45,153,189,96,233,206,146,32,157,239,31,29,141,186,61,67,
-            147,142,199,161,209,48,101,247,22,36,5,204,241,28,232,21,10,158,44,252,155,188,31,124,7,208,208,43,74,64,118,18,
-            112,39,15,101,187,169,152,14,187,0,220,127,100,3,3,27,39,138,104,55,174,92,7,47,236,228,60,95,105,102,32,129,114,
-            254,125,199,235,96,0,44,227,189,190,127,111,224,221,12,167,3,247,218,242,248,224,59,66,148,12,114,197,192,145,88,
-            52,58,251,252,189,143,194,191,235,243,60,217,180,127,61,46,59,156,77,223,147,1,214,14,225,114,228,251,163,187,110,
-            16,179,36,207,147,117,59,140,190,11,118,226,184,27,70,40,112,27,236,131,193,94,63,152,157,189,65,55,184,85,146,
-            202,223,128,143,192,115,59,16,50,186,255,94,127,31,92,48,129,192,144,10,20,151,21,75,220,193,45,139,40,88,102,251,
-            35,69,150,133,3,230,205,196,251,213,222,89,172,86,245,30,6,25,43,127,19,123,54,40,128,65,139,171,29,10,109,126,
-            144,3,56,51,86,7,36,62,147,52,87,110,37,57,142,25,109,71,12,180,237,29,78,25,101,237,35,206,211,0,60,112,26,49,
-            92,5,241,82,16,124,26,108,47,240,91,239,234,202,29,86,224,42,163,149,35,20,32,44,130,250,246,183,169,217,177,72,
-            32,56,228,6,169,218,173,18,26,176,4,249,226,129,35,250,171,59,29,146,111,171,67,43,232,127,24,168,188,83,81,121,
-            21,88,182,3,34,191,91,67,186,223,178,108,83,176,50,71,73,214,44,15,112,165,22,234,15,52,3,206,180,19,196,127,58,
-            177,16,160,63,53,18,164,148,186,7,190,3,34,23,139,87,27,89,185,4,107,57,159,3,183,188,237,208,238,240,106,223,140,
-            193,26,120,221,160,214,178,183,26,201,20,242,125,177,161,76,1,236,87,27,203,197,152,191,147,193,252,207,55,125,
-            143,6,231,209,224,60,26,156,71,131,243,104,112,30,13,206,163,193,121,52,56,143,6,103,189,94,226,38,149,115,99,100,
-            46,233,15,102,1,208,10,75,145,127,43,197,16,136,89,7,3,83,34,221,14,194,234,76,131,201,69,143,225,141,139,119,31,
-            255,167,3,8,88,86,123,128,244,117,126,189,19,142,74,123,26,161,151,36,81,57,205,174,243,162,56,41,75,192,124,236,
-            210,186,248,238,148,178,253,77,112,39,104,34,16,56,122,229,80,88,232,72,36,169,89,241,167,62,21,92,148,140,60,122,
-            130,22,7,9,46,144,97,229,113,234,107,136,98,142,150,107,106,11,148,58,17,224,87,164,1,213,117,144,173,200,180,165,
-            124,56,74,74,77,32,61,161,174,168,250,58,72,225,253,105,201,144,177,87,112,34,114,46,103,1,25,148,6,14,189,71,211,
-            81,53,21,65,154,108,99,193,22,52,142,121,216,112,92,31,113,192,120,252,162,53,160,224,17,15,30,208,148,211,76,15,
-            177,219,113,75,79,232,139,62,72,131,172,64,10,31,129,24,155,203,47,114,190,37,219,0,126,118,130,204,217,161,137,
-            28,152,84,26,176,163,76,69,109,105,14,174,12,178,16,224,47,43,40,40,248,122,197,209,135,232,6,51,166,237,221,4,
-            131,112,60,12,192,40,109,193,70,162,51,98,79,220,32,150,214,200,161,43,131,106,84,140,225,229,89,148,132,159,179,
-            110,76,134,73,44,138,60,104,81,40,101,10,108,214,1,215,96,105,51,159,84,41,186,46,88,34,146,235,47,200,73,226,145,
-            117,250,88,87,90,213,24,192,102,44,116,80,150,73,170,25,107,128,254,124,86,15,23,112,162,21,197,195,148,139,112,
-            154,246,177,7,220,146,110,197,25,248,190,187,167,91,122,13,235,212,144,65,72,94,200,56,203,225,169,189,209,216,
-            101,37,235,133,66,9,153,121,9,88,15,133,11,238,122,44,228,194,89,241,68,224,253,57,153,74,34,90,236,217,38,22,214,
-            12,189,19,235,50,30,91,172,61,211,9,230,40,73,62,147,135,8,198,10,98,180,123,26,83,118,75,164,67,122,225,195,135,
-            43,192,149,167,124,185,5,243,63,62,57,101,79,54,198,146,28,181,81,20,15,224,150,89,2,123,32,69,22,78,141,178,248,
-            123,38,72,58,32,94,77,34,149,80,156,206,150,109,130,250,50,8,63,47,89,160,144,64,215,5,115,214,230,85,211,108,135,
-            190,72,226,188,128,127,157,20,194,12,255,251,53,16,115,138,102,52,99,204,127,181,66,37,99,145,141,23,205,176,53,
-            214,101,217,86,87,226,240,184,131,84,87,44,181,56,40,48,171,208,173,105,46,4,111,33,243,138,208,213,34,4,11,178,
-            22,82,148,68,34,236,214,85,240,69,226,4,117,109,2,133,32,148,162,71,46,0,143,125,158,136,12,183,246,2,43,182,98,
-            229,96,5,95,2,25,209,78,207,54,65,8,204,80,145,36,224,181,108,106,226,165,176,222,171,191,36,224,176,45,34,50,213,
-            244,127,118,217,63,52,213,86,62,40,145,14,95,107,37,87,215,202,151,160,232,128,86,7,233,201,149,157,82,204,97,45,
-            226,150,101,208,64,45,191,215,124,129,107,64,131,125,9,162,45,89,18,135,134,42,186,67,19,77,110,61,59,219,205,190,
-            105,107,72,194,132,32,14,244,168,137,44,232,137,31,74,21,237,181,191,156,38,245,240,75,87,184,229,117,20,105,10,
-            177,20,33,21,11,147,146,35,211,46,22,148,142,111,178,238,89,43,76,121,210,101,31,131,194,234,153,88,75,141,8,134,
-            195,137,76,251,132,29,191,64,198,238,11,97,210,39,141,38,52,47,28,41,9,219,136,110,178,48,181,204,97,155,118,65,
-            1,68,182,94,148,191,74,230,165,227,41,13,180,141,35,12,81,7,206,38,201,36,233,58,162,134,82,66,23,251,66,127,219,
-            60,65,132,166,182,171,84,50,237,225,5,140,255,134,84,153,74,19,68,135,223,224,4,98,110,193,209,74,153,22,158,143,
-            193,14,36,99,117,238,150,122,172,34,221,109,12,144,31,130,80,214,32,250,218,221,16,248,85,149,154,87,189,143,139,
-            3,225,31,228,230,52,195,255,190,219,27,85,252,218,194,2,183,236,85,212,120,212,1,11,71,121,28,226,31,96,160,102,
-            206,249,247,72,241,88,63,165,82,195,40,84,209,248,160,188,100,9,7,158,227,68,105,98,170,85,222,198,184,203,230,
-            251,216,163,64,249,32,169,125,219,38,173,235,150,192,225,50,155,173,185,151,139,110,245,225,171,36,184,250,182,
-            38,200,121,156,131,8,118,136,60,127,108,150,227,7,83,171,38,205,21,222,47,22,234,7,211,170,73,182,171,143,235,34,
-            190,78,173,118,41,79,14,97,83,20,232,53,34,30,45,208,118,249,142,64,95,34,220,83,222,244,221,146,93,3,61,68,178,
-            171,93,91,28,130,249,29,229,186,29,71,59,68,174,19,66,135,11,117,61,237,175,19,234,85,226,117,199,150,236,120,18,
-            101,24,41,136,155,128,191,183,71,0,23,220,212,178,82,159,72,229,150,25,8,133,47,171,226,138,236,229,135,191,155,
-            232,45,144,253,42,209,107,102,242,239,45,119,45,65,241,106,185,123,32,169,254,112,66,183,90,181,17,204,166,198,
-            159,221,83,190,1,175,78,96,94,229,19,93,43,52,117,14,139,28,34,128,79,105,81,172,124,7,150,155,201,178,10,216,193,
-            49,157,38,98,159,58,70,223,241,196,132,232,76,114,4,15,31,1,174,217,41,174,80,243,24,3,17,124,17,77,131,148,96,
-            22,128,76,145,197,34,87,129,66,142,217,190,255,168,167,220,162,181,234,213,244,55,99,239,138,179,242,184,135,106,
-            199,37,48,224,85,57,111,165,171,8,84,190,50,96,199,205,72,50,220,113,44,206,48,54,153,171,156,79,215,192,205,7,
-            53,94,62,50,31,150,121,209,208,52,231,171,195,135,230,131,113,231,111,61,247,183,195,224,101,52,24,244,46,221,175,
-            88,120,150,54,175,155,61,15,253,250,165,175,140,253,234,121,127,13,233,223,106,254,111,136,195,43,246,64,253,200,
-            91,7,253,169,78,96,110,87,14,41,22,236,26,134,207,185,210,104,7,141,130,14,50,70,233,207,40,14,203,249,5,195,235,
-            93,3,97,5,212,104,108,138,19,186,135,82,229,77,104,198,234,93,20,100,206,74,206,231,34,62,96,144,201,237,232,211,
-            43,199,160,2,137,206,117,193,106,17,239,87,183,2,126,2,102,95,51,197,84,9,74,113,0,198,54,50,101,222,53,22,30,122,
-            127,229,88,104,113,188,96,32,100,51,197,11,149,193,198,200,85,156,32,106,30,211,226,1,140,143,111,216,207,140,115,
-            185,220,2,171,115,222,233,128,53,235,143,221,202,201,104,90,53,90,164,126,42,208,174,61,112,9,67,126,251,162,165,
-            233,195,189,82,190,165,98,134,234,99,54,93,80,79,83,153,195,55,82,216,176,177,112,236,48,195,102,234,20,151,114,
-            66,112,134,165,35,217,202,180,226,215,84,73,144,114,20,181,31,153,229,64,194,51,76,61,172,183,25,167,20,163,29,
-            86,109,242,25,210,29,160,46,200,169,195,143,168,64,83,129,203,232,228,61,91,81,1,151,154,206,41,43,9,86,33,153,
-            78,51,193,78,230,251,87,54,166,184,191,153,246,30,252,17,85,108,149,102,69,229,143,97,128,210,117,146,164,249,201,
-            105,197,101,98,131,76,159,45,199,90,25,144,38,224,21,127,162,147,240,113,134,134,59,29,72,139,146,220,52,36,40,
-            37,76,153,30,193,51,252,243,25,103,1,223,224,140,112,196,235,84,136,223,4,140,57,19,192,141,72,0,60,140,74,169,
-            90,36,129,191,10,118,136,16,162,176,11,210,57,249,193,50,70,78,133,143,225,93,42,133,141,195,198,150,17,48,99,144,
-            154,238,180,15,251,227,102,52,246,138,54,15,125,54,30,49,165,132,84,231,92,51,248,199,236,34,210,186,158,232,35,
-            198,52,219,211,22,248,189,193,253,45,40,61,223,235,79,239,70,87,110,137,174,180,44,176,163,215,51,106,31,17,39,
-            241,185,50,90,101,72,100,161,25,26,90,83,89,28,69,44,27,71,186,28,13,174,112,12,239,218,115,175,10,179,122,142,
-            137,177,185,74,49,88,205,27,36,198,247,163,121,145,66,170,67,156,220,15,60,31,203,18,137,45,202,222,16,173,109,
-            121,111,227,202,43,49,121,230,100,155,72,230,185,82,107,89,165,192,146,253,144,34,63,151,129,237,142,245,3,161,
-            40,10,107,97,209,184,177,130,2,128,21,86,10,102,11,186,254,104,132,125,80,234,173,58,146,4,251,161,112,3,147,34,
-            225,197,231,158,77,105,52,83,5,22,99,19,137,92,96,246,24,99,8,79,15,19,215,0,198,9,254,245,140,3,9,196,186,58,121,
-            72,59,16,75,1,196,98,1,18,187,139,213,238,122,227,27,111,104,161,136,105,70,216,4,84,203,66,235,13,186,88,133,117,
-            196,211,6,30,188,7,229,22,193,246,215,166,141,42,108,222,37,91,88,189,96,179,17,65,234,36,219,220,156,146,87,160,
-            78,112,182,217,118,118,174,100,1,176,242,41,16,30,139,44,57,187,111,24,176,188,153,121,80,147,47,160,145,231,237,
-            61,68,238,169,37,4,178,183,230,150,6,22,87,157,40,50,94,217,69,154,172,117,192,255,128,101,85,224,7,189,95,70,15,
-            126,145,185,198,77,195,37,238,32,81,88,78,210,96,138,60,36,72,48,167,187,222,36,89,38,49,151,187,160,234,114,238,
-            141,177,198,125,193,133,16,192,34,64,190,150,193,7,222,157,7,186,179,232,203,81,89,183,221,19,86,248,83,189,197,
-            44,64,66,177,226,100,94,43,40,239,112,235,20,85,91,130,239,240,105,250,32,102,204,91,234,236,1,129,43,247,186,247,
-            48,240,129,10,191,216,21,173,74,100,96,167,24,52,5,120,230,77,32,252,222,229,212,31,247,30,221,241,164,40,43,174,
-            60,198,181,198,24,29,151,222,131,51,253,126,178,146,139,252,28,254,139,235,33,128,189,35,211,221,198,154,21,204,
-            128,227,159,62,189,130,95,195,188,89,12,211,42,131,82,206,29,163,140,72,143,196,176,231,151,32,229,74,206,190,114,
-            237,217,244,197,122,0,11,198,66,166,89,222,252,173,142,13,232,150,64,117,138,117,213,7,98,81,216,244,96,213,232,
-            254,60,245,134,158,63,29,142,64,91,88,133,7,88,237,9,166,89,6,206,72,184,34,150,78,156,38,205,162,186,58,121,90,
-            139,80,221,104,227,139,170,160,120,142,151,80,160,40,37,42,89,186,1,205,80,114,67,240,148,73,176,20,250,3,115,170,
-            66,121,16,5,70,20,106,5,241,192,164,204,229,26,3,57,32,234,96,9,177,161,205,14,55,76,6,44,128,162,185,62,89,3,56,
-            219,143,10,123,98,1,242,179,227,221,221,99,237,247,208,119,134,35,223,253,128,242,20,118,26,8,77,108,24,21,115,
-            209,180,77,181,186,254,59,195,218,47,169,63,67,73,75,95,42,203,32,180,116,52,21,52,43,209,204,108,108,9,56,226,
-            29,208,76,104,126,97,65,19,48,37,85,14,195,35,208,62,161,104,19,108,64,133,91,119,112,63,237,77,106,186,133,42,
-            61,13,67,225,51,85,255,75,133,124,168,113,28,82,57,186,174,10,31,34,163,39,177,174,155,206,129,109,103,65,218,62,
-            244,16,196,222,163,59,189,26,61,96,179,168,203,135,235,107,119,108,137,160,30,239,217,20,84,149,106,238,163,170,
-            166,148,179,60,219,130,46,74,219,205,5,24,129,212,250,195,112,114,239,246,201,104,224,110,48,19,43,5,98,83,17,168,
-            14,154,145,37,40,43,188,153,4,193,253,204,213,112,185,182,48,128,174,150,132,192,165,138,51,85,158,51,103,227,247,
-            194,153,0,26,72,18,248,44,231,194,46,64,232,30,155,100,84,81,98,15,4,150,175,128,217,62,159,79,99,144,213,163,225,
-            224,23,160,150,7,203,53,156,246,124,127,236,93,62,248,197,164,176,238,172,152,147,170,145,59,3,213,42,163,252,28,
-            37,114,14,203,8,138,22,112,63,201,182,216,238,42,99,244,174,7,163,158,15,72,2,98,19,111,52,164,45,166,244,19,46,
-            203,244,190,55,153,124,26,141,175,78,141,193,72,135,192,230,92,85,164,89,229,187,172,24,193,108,154,147,124,181,
-            165,189,245,108,190,5,243,117,142,26,230,148,154,221,216,173,110,138,114,182,101,148,204,2,37,51,193,14,136,20,
-            189,145,90,136,88,193,158,40,93,3,144,37,105,7,237,116,15,185,162,61,87,133,209,214,186,169,92,121,117,103,162,
-            112,83,193,43,38,238,56,193,158,112,186,99,214,228,214,187,246,249,208,148,57,233,133,231,210,12,122,180,201,107,
-            233,161,90,88,9,248,122,23,159,182,79,192,29,82,83,53,31,246,43,40,182,254,79,214,86,225,110,89,49,107,108,48,53,
-            207,35,241,133,194,71,228,76,130,22,96,172,84,123,51,158,110,197,180,37,241,148,107,147,129,168,29,26,235,3,181,
-            220,249,90,198,184,166,134,232,156,248,227,208,81,166,73,163,44,95,195,124,184,212,140,216,220,234,166,134,194,
-            153,188,45,229,20,241,31,97,26,100,43,50,37,26,45,111,170,245,36,210,237,158,122,15,30,18,53,147,107,25,129,117,
-            152,61,103,216,153,72,11,224,194,161,113,22,32,218,149,188,68,243,149,95,212,6,212,179,62,32,83,30,236,59,155,134,
-            155,32,165,22,116,76,74,228,75,60,76,179,139,149,40,230,54,104,41,234,154,53,150,110,18,33,121,194,214,54,220,223,
-            60,14,183,25,241,101,41,140,97,99,213,213,88,170,224,53,171,35,226,42,64,15,4,185,146,163,123,45,129,20,24,153,
-            66,133,229,222,93,173,35,223,151,151,31,125,225,89,178,205,213,78,209,67,57,15,89,149,170,69,155,169,71,252,18,
-            92,90,180,113,208,136,5,236,133,248,172,207,159,224,113,84,92,46,130,127,166,165,80,29,208,163,200,19,6,162,219,
-            192,169,197,36,155,10,0,35,16,58,254,72,134,72,44,64,13,102,65,250,188,135,12,135,209,191,78,133,181,242,67,219,
-            193,223,122,55,183,3,12,12,191,106,137,89,82,176,171,136,53,150,214,154,183,15,217,28,135,127,5,87,97,62,89,197,
-            166,95,30,147,70,147,149,117,252,219,96,82,9,150,191,56,80,15,248,180,54,192,59,28,35,14,156,43,255,49,179,81,68,
-            39,92,165,230,246,96,208,208,232,238,133,8,24,103,246,133,195,115,158,2,157,62,238,4,246,122,12,202,18,0,29,115,
-            125,236,200,194,137,210,25,23,206,47,32,156,209,69,196,94,142,118,31,54,107,19,147,246,9,205,161,178,125,200,187,
-            213,166,131,95,129,61,38,119,127,119,220,49,7,208,216,123,237,133,136,211,193,68,21,142,98,132,57,69,240,166,136,
-            34,138,55,175,165,175,74,89,112,192,76,183,184,213,68,151,177,233,99,160,76,6,211,145,47,136,178,196,106,201,103,
-            79,218,222,249,229,136,89,169,47,40,168,99,10,195,181,103,46,212,252,128,123,190,114,25,240,26,69,50,90,234,11,
-            113,64,14,225,46,136,193,60,78,91,82,9,230,215,114,70,97,29,196,223,98,82,65,97,219,117,186,12,92,202,142,99,62,
-            228,113,130,240,90,233,56,159,249,156,14,2,170,83,44,166,253,98,247,65,182,99,62,224,152,15,56,230,3,142,249,128,
-            99,62,224,15,149,15,248,83,5,243,27,168,223,31,221,221,247,250,254,104,92,82,138,184,71,193,92,195,40,18,71,138,
-            56,88,70,237,68,116,105,11,71,30,41,88,147,236,96,11,72,144,169,249,243,222,168,226,93,111,216,146,129,177,250,
-            37,23,185,125,201,235,28,39,134,245,74,89,249,166,236,206,164,63,246,238,237,112,27,77,41,152,255,125,11,24,83,
-            152,4,73,58,75,158,72,32,225,162,128,52,8,83,201,160,208,30,192,216,51,190,68,126,188,57,185,120,198,210,205,160,
-            105,130,116,37,183,184,89,104,94,246,202,4,70,129,57,11,184,26,196,168,161,13,70,46,77,56,165,5,218,112,52,245,
-            80,75,12,123,96,214,83,99,150,114,111,18,234,169,68,189,151,248,208,46,76,148,172,84,235,92,126,201,204,185,112,
-            198,86,44,73,101,6,248,204,48,27,64,58,11,84,91,184,99,34,232,152,8,250,154,68,16,112,242,245,160,231,87,247,135,
-            251,148,51,47,170,8,168,74,149,16,29,241,4,73,163,203,98,54,20,71,149,105,14,139,8,63,49,209,208,230,24,61,24,140,
-            211,203,7,223,31,13,75,137,40,84,206,155,21,248,225,160,179,223,87,44,70,109,35,112,216,143,199,61,166,187,142,
-            233,174,63,121,186,139,68,237,125,239,166,182,159,110,201,218,46,43,183,250,38,234,102,229,99,46,237,223,33,151,
-            134,10,226,27,75,167,233,225,14,74,168,181,169,49,165,193,166,87,222,163,215,108,144,81,79,29,180,194,102,124,40,
-            135,148,198,25,162,195,161,178,142,125,165,129,79,220,251,222,184,87,181,212,3,235,202,172,153,192,35,130,220,60,
-            210,104,165,38,77,119,204,12,30,51,131,199,204,224,49,51,120,204,12,254,169,51,131,100,172,189,64,210,180,239,132,
-            181,242,194,54,202,101,86,178,247,152,147,60,230,36,155,114,146,200,55,8,250,158,14,251,168,84,164,206,54,110,232,
-            97,57,3,73,207,14,77,19,154,174,229,192,29,152,239,192,87,46,170,201,67,28,250,149,215,1,232,182,24,116,96,82,245,
-            40,230,230,251,148,4,209,199,181,213,158,248,78,57,243,150,26,56,252,4,212,101,195,169,167,234,166,131,1,138,64,
-            93,59,173,241,170,189,26,173,37,61,44,211,154,158,125,13,173,217,157,180,34,144,244,208,28,98,215,202,147,110,246,
-            171,172,10,34,249,118,171,130,219,139,173,255,82,196,243,61,114,211,197,107,110,117,208,14,27,60,107,155,79,217,
-            134,87,57,206,231,242,221,7,182,143,90,82,143,165,111,123,105,26,60,79,74,100,54,166,158,242,127,112,253,145,243,
-            34,213,161,69,5,144,46,28,229,20,155,107,74,23,245,151,184,15,165,73,173,224,154,209,25,92,229,78,8,112,89,130,
-            40,105,136,253,92,90,25,244,177,64,71,154,242,78,129,131,169,117,129,34,23,237,80,12,118,246,87,9,222,134,168,189,
-            191,32,171,220,4,112,102,57,149,245,113,202,221,245,172,145,116,227,61,28,130,123,84,154,33,40,27,67,247,207,178,
-            4,194,204,231,6,77,179,180,117,58,253,109,154,37,105,227,132,96,32,250,177,97,46,246,237,4,60,223,206,123,229,74,
-            216,227,15,190,196,27,157,117,31,59,69,22,0,142,191,221,19,194,184,42,103,120,105,244,42,217,46,87,142,89,40,96,
-            109,204,74,238,146,244,179,110,112,219,48,182,108,38,28,179,211,133,163,200,166,104,133,115,157,75,208,23,57,246,
-            33,98,175,45,105,8,198,224,249,86,55,222,174,27,137,165,122,117,235,148,47,122,96,139,84,8,76,119,114,46,46,177,
-            78,223,114,242,75,55,141,35,210,214,175,139,110,31,170,122,187,55,129,11,170,0,157,115,152,241,104,7,10,11,123,
-            154,198,152,207,76,46,147,167,151,172,225,181,140,196,11,9,185,144,6,181,38,26,94,243,173,1,77,219,71,230,220,58,
-            8,41,184,192,40,5,237,199,40,193,3,209,32,74,151,162,17,92,18,228,141,224,148,149,0,79,66,153,17,145,240,85,114,
-            68,19,217,84,143,96,119,196,44,205,21,127,184,112,30,245,185,168,82,190,155,98,39,37,106,90,253,131,225,85,221,
-            134,177,118,41,12,234,161,22,234,162,234,192,159,137,148,39,248,254,233,133,227,229,197,101,44,160,106,87,219,245,
-            44,14,100,164,197,48,127,32,137,21,98,211,62,31,1,144,210,170,13,31,231,45,156,181,196,110,217,37,154,59,19,17,
-            172,177,7,85,113,231,122,230,252,239,127,159,207,184,189,169,160,117,63,145,23,36,242,6,240,37,254,115,138,161,
-            29,221,153,180,62,125,124,165,44,218,27,185,235,150,236,138,82,10,182,96,180,108,29,232,58,11,37,63,218,68,28,93,
-            94,207,2,172,113,56,75,211,212,84,71,80,68,86,91,247,155,86,59,181,129,247,78,177,254,5,197,247,246,138,126,54,
-            49,116,52,80,9,122,224,60,241,244,58,89,253,208,194,16,49,230,30,126,55,158,96,26,116,152,32,136,80,183,185,227,
-            83,153,77,209,134,90,198,156,74,178,51,218,179,228,169,219,52,44,172,148,138,121,56,13,131,188,106,30,78,181,197,
-            242,79,176,17,11,227,232,95,97,39,210,45,245,108,42,106,10,237,49,25,127,231,245,2,115,13,52,42,90,1,102,165,114,
-            120,48,13,233,201,222,203,45,244,199,151,65,38,154,106,50,255,37,5,157,185,66,234,171,75,43,253,49,71,97,40,32,
-            99,114,79,24,251,181,179,117,156,95,216,129,183,90,56,226,28,46,214,93,232,73,84,152,22,238,28,77,7,28,75,183,112,
-            215,135,30,142,170,89,175,107,182,115,129,96,82,80,213,29,44,122,18,110,215,28,121,224,110,120,58,9,134,74,148,
-            177,192,78,241,113,203,24,183,189,73,117,144,202,244,48,143,138,73,129,191,208,246,58,47,170,217,138,27,169,40,
-            187,202,204,222,90,112,6,99,249,159,188,137,95,75,140,147,2,192,216,4,109,90,202,21,243,192,0,244,47,239,139,241,
-            168,68,130,178,232,105,146,179,209,113,242,159,255,216,38,249,255,229,64,122,252,155,255,194,76,167,234,252,72,
-            73,238,11,167,95,190,52,221,100,162,232,54,54,188,37,94,32,1,169,45,36,134,57,238,100,152,38,89,2,211,82,105,20,
-            231,17,224,7,132,0,118,34,76,205,115,115,169,58,57,58,69,227,122,134,83,52,6,129,93,153,99,61,107,70,105,83,115,
-            153,59,191,198,192,45,204,184,240,193,48,74,70,146,141,234,5,73,210,5,74,3,169,176,143,205,71,248,137,251,180,137,
-            0,9,214,102,170,47,137,206,34,83,92,40,88,43,90,38,42,5,166,50,110,51,42,237,90,136,84,51,109,185,27,74,75,186,
-            138,217,116,224,13,221,14,254,161,90,104,211,87,155,83,104,128,114,76,230,108,27,183,92,63,96,7,178,209,167,34,
-            175,208,49,0,181,86,193,142,46,229,30,245,74,169,19,25,139,188,145,92,174,34,110,248,75,85,33,156,110,176,174,174,
-            176,250,162,99,19,33,165,64,74,132,230,204,223,133,115,66,1,54,188,181,171,190,254,154,75,84,179,81,148,17,92,114,
-            240,236,148,232,102,60,174,211,102,66,208,75,211,158,15,196,24,249,123,54,41,93,255,98,170,6,211,36,65,145,0,122,
-            224,194,25,33,179,171,36,238,140,165,22,11,0,204,176,35,100,221,101,148,19,82,54,126,250,230,172,230,242,56,27,
-            70,7,118,96,208,208,117,143,196,85,74,81,41,202,26,52,207,84,33,46,200,128,136,83,192,186,26,138,10,161,84,242,
-            149,38,68,37,5,92,68,75,246,44,200,92,201,101,30,214,164,155,177,69,158,218,195,176,116,113,79,192,171,29,144,108,
-            209,21,111,154,180,250,106,154,57,181,77,237,16,174,143,189,177,71,89,122,98,101,183,155,143,57,235,141,76,199,
-            109,108,117,185,193,223,169,5,145,92,2,135,146,227,94,244,144,213,29,100,41,205,173,86,233,172,104,54,187,205,132,
-            42,150,77,151,2,96,20,160,249,210,20,171,34,178,168,229,208,236,12,102,42,44,185,67,225,89,25,182,222,27,3,19,157,
-            120,195,155,162,232,114,175,150,34,193,155,196,234,182,60,37,124,138,46,90,57,58,99,20,203,96,229,192,121,122,150,
-            101,244,5,145,137,89,73,85,78,22,219,155,203,43,227,231,51,173,252,132,6,124,240,133,60,48,33,93,26,210,190,84,
-            84,51,129,109,198,40,39,107,78,71,148,203,67,104,85,144,57,129,28,115,245,42,109,51,254,249,172,52,5,250,185,64,
-            31,19,129,5,238,205,104,54,214,188,250,36,237,72,41,211,117,130,76,115,52,7,194,40,201,144,11,202,194,157,139,97,
-            169,82,144,213,175,22,114,220,85,12,20,59,200,237,109,20,112,61,220,103,169,154,199,86,135,239,206,255,251,99,215,
-            157,222,184,254,212,27,94,143,222,149,237,199,82,50,96,44,254,177,69,28,237,203,81,57,227,93,46,66,105,73,63,208,
-            56,147,3,198,241,44,248,116,168,1,185,12,165,84,212,158,228,38,224,148,216,132,153,168,218,187,174,49,112,37,18,
-            114,228,182,177,85,146,102,221,19,201,193,125,51,254,82,226,217,20,125,187,137,85,113,115,18,114,253,148,25,226,
-            195,135,137,200,125,248,222,151,155,211,11,163,107,204,30,109,163,140,223,243,97,10,119,148,164,171,36,171,27,209,
-            231,122,108,142,132,20,5,23,156,153,110,24,182,197,189,160,219,146,171,46,6,93,192,108,121,25,165,103,223,144,39,
-            161,145,255,122,111,98,80,17,148,147,74,204,241,140,101,204,1,18,106,80,147,80,234,126,134,90,92,165,229,243,254,
-            173,219,255,233,114,244,115,185,128,156,188,151,45,86,239,253,160,27,224,133,43,17,126,6,239,81,20,98,194,58,7,
-            166,75,148,173,196,92,125,172,255,34,174,171,141,100,65,54,1,94,117,232,67,41,132,92,27,185,202,112,61,51,23,138,
-            105,63,235,140,155,162,3,217,82,144,166,104,119,129,125,190,230,50,108,53,129,253,88,59,222,154,203,20,75,148,57,
-            58,49,127,30,39,102,48,125,152,184,227,42,163,170,114,96,139,135,137,255,74,87,85,83,74,93,11,117,155,163,121,104,
-            155,35,117,153,113,137,219,24,110,11,82,141,234,125,66,244,181,169,167,9,87,36,190,206,216,98,180,68,78,113,196,
-            68,105,239,193,75,181,247,0,249,222,84,202,54,148,120,104,65,95,81,179,188,254,213,236,74,24,40,203,148,207,158,
-            170,203,192,205,148,24,5,163,112,10,219,144,18,157,124,0,201,62,45,131,80,10,211,9,123,160,218,118,31,32,209,16,
-            112,70,20,206,42,190,97,162,234,176,9,43,28,158,232,168,27,11,159,40,46,35,119,147,16,83,183,33,26,60,48,96,110,
-            6,62,213,226,202,108,150,218,96,133,81,139,119,39,99,14,142,96,235,1,149,103,120,70,118,124,89,149,82,165,225,196,
-            220,135,200,149,130,169,0,205,37,148,47,28,139,157,53,216,1,37,130,102,149,173,218,173,114,137,74,227,18,151,107,
-            76,48,200,173,207,252,242,157,158,155,32,166,92,81,18,2,15,102,250,166,123,220,170,88,71,195,177,116,93,62,3,4,
-            38,99,111,133,178,34,214,199,4,14,67,117,63,51,54,96,90,52,169,111,67,148,239,147,100,84,15,194,134,20,200,126,
-            100,116,49,81,203,210,246,81,150,136,249,4,101,70,203,226,18,147,178,129,166,156,118,123,28,130,50,138,230,117,
-            64,75,37,174,106,39,249,246,205,172,7,91,255,177,210,163,184,113,110,149,138,158,188,220,32,220,177,170,140,104,
-            14,232,103,240,145,37,37,202,141,193,255,89,60,207,146,32,61,144,240,163,161,239,254,236,79,239,220,225,195,62,
-            12,247,192,235,143,6,15,119,67,58,82,127,8,91,105,129,165,15,22,135,160,189,159,139,43,210,57,15,78,6,30,174,54,
-            110,92,120,204,119,175,193,146,172,69,190,74,204,49,57,188,152,26,87,233,115,156,236,116,153,85,205,172,182,217,
-            133,225,52,154,214,161,250,169,110,96,171,95,94,147,229,240,43,183,146,98,42,131,254,236,48,144,75,119,13,203,50,
-            233,118,250,98,24,235,186,83,212,243,242,9,195,229,202,122,163,200,89,16,57,231,63,232,146,100,86,25,166,60,192,
-            250,88,85,51,240,225,76,234,43,96,223,76,95,178,94,170,182,32,201,5,53,20,237,41,60,137,86,244,126,214,221,197,
-            41,254,130,151,0,171,254,207,116,253,36,27,166,193,103,17,107,45,198,210,93,93,102,6,234,9,83,119,185,153,113,113,
-            254,8,222,18,182,233,133,38,171,164,107,136,126,232,186,134,168,251,30,150,158,125,253,202,44,81,53,196,106,154,
-            170,13,5,153,124,121,166,163,246,7,223,95,99,121,176,38,9,240,162,187,104,170,0,204,165,52,135,223,240,82,5,161,
-            122,20,28,126,51,228,130,171,38,246,56,109,88,204,56,118,39,222,175,24,196,179,46,100,69,42,42,53,166,185,226,68,
-            198,97,180,157,243,153,20,109,116,210,40,141,103,120,168,143,62,30,184,108,5,172,43,192,113,134,116,76,186,16,41,
-            42,26,249,92,230,237,150,81,198,46,157,233,109,31,136,206,33,241,64,234,144,1,29,104,161,49,154,102,117,106,249,
-            35,133,211,90,115,69,224,131,27,255,39,230,50,197,218,168,94,43,238,68,11,210,250,158,132,18,190,58,20,205,5,146,
-            116,136,148,87,188,180,76,165,251,101,72,116,190,87,26,41,73,175,240,148,174,36,155,233,227,127,252,63,102,129,
-            155,100
-        };
-
-    // ../xml/forms.xml (55979 bytes)
-    const unsigned char forms[6635] {
-            120,218,237,93,91,111,35,55,178,62,207,251,43,26,179,216,51,54,34,123,146,44,206,75,50,25,64,150,218,182,96,89,
-            18,36,121,46,121,17,40,137,146,122,221,106,42,125,177,199,193,254,248,83,23,178,111,106,221,60,114,50,153,112,129,
-            44,198,221,205,98,177,88,172,170,175,88,164,222,94,201,64,134,34,86,97,83,206,188,192,139,61,21,68,239,222,206,
-            101,224,76,124,17,69,191,188,122,252,124,25,138,165,124,229,120,75,49,151,185,191,227,167,21,252,57,195,63,70,51,
-            21,46,95,189,123,235,5,11,25,122,113,100,218,182,69,48,79,160,149,51,144,113,236,5,243,232,213,155,245,143,62,246,
-            27,91,223,63,126,30,170,85,91,62,72,255,131,23,76,213,99,213,55,252,198,113,31,100,16,111,32,162,27,191,123,187,
-            240,166,210,9,128,235,95,94,173,124,17,35,235,212,228,141,105,243,238,237,42,84,43,25,198,79,250,51,162,49,10,114,
-            163,142,226,16,216,125,229,44,164,191,250,229,213,112,193,4,29,53,115,98,248,247,88,68,146,59,62,127,245,238,246,
-            137,228,117,1,207,222,190,49,132,215,186,136,189,216,47,81,31,201,104,34,86,50,202,247,18,203,207,177,19,43,103,
-            234,69,192,251,147,163,2,234,144,38,225,117,228,16,21,232,62,60,199,1,149,186,128,127,71,94,20,155,78,198,74,249,
-            175,222,125,191,133,167,40,126,202,120,26,3,105,108,253,238,173,90,161,146,232,111,30,63,55,221,203,250,93,123,
-            56,186,236,215,111,221,209,96,248,169,237,26,142,73,165,228,212,17,145,243,248,249,182,213,105,221,182,126,117,
-            71,23,221,143,206,127,241,65,253,99,241,65,223,29,240,159,253,166,219,167,39,131,79,131,161,123,59,186,117,59,119,
-            244,119,163,222,27,182,186,29,254,119,187,59,200,218,54,218,173,222,168,113,221,106,55,251,110,7,7,95,226,82,183,
-            52,156,245,18,80,13,225,128,124,233,171,188,24,207,171,90,155,190,210,145,177,252,137,134,175,96,182,199,234,243,
-            78,42,44,161,97,183,219,30,125,104,117,154,221,15,134,90,67,36,145,68,90,212,212,121,244,226,5,252,17,45,133,239,
-            243,148,194,140,226,172,143,65,171,66,41,98,57,253,57,235,201,153,42,104,27,168,216,17,171,149,132,15,61,102,35,
-            22,209,61,182,75,130,169,12,29,214,254,200,81,161,115,53,188,249,110,51,123,157,238,104,88,31,220,92,212,251,41,
-            119,212,37,176,7,114,2,194,225,163,7,227,13,96,213,8,95,115,48,78,98,199,139,159,197,136,115,2,13,224,155,133,32,
-            18,143,30,12,121,9,118,104,233,253,46,113,200,72,96,42,163,251,88,173,224,37,45,242,34,157,199,133,55,89,56,75,
-            88,11,145,148,75,7,150,14,216,156,180,41,200,53,68,206,167,240,87,18,97,15,75,111,190,136,81,146,99,48,57,146,196,
-            10,31,193,107,47,114,72,225,97,26,253,39,154,3,5,195,42,233,45,125,113,122,238,180,2,120,3,252,215,120,30,124,49,
-            119,160,125,40,163,149,156,192,244,48,13,111,198,67,132,55,48,58,95,138,40,118,30,112,17,130,208,127,60,255,81,
-            179,37,205,184,150,34,0,83,25,58,81,178,90,169,16,244,115,212,113,135,163,15,183,176,166,234,67,88,89,55,160,225,
-            122,106,156,133,23,196,231,206,181,64,121,59,114,54,131,94,181,92,104,138,156,212,176,109,158,232,203,118,183,62,
-            28,117,59,163,94,29,150,204,48,111,101,140,26,194,92,8,255,17,213,124,44,73,187,97,18,192,196,161,89,93,137,16,
-            76,173,115,146,4,190,119,47,113,169,14,235,159,144,218,176,219,3,249,212,53,13,173,174,172,210,57,25,47,19,144,
-            197,66,60,72,208,243,64,5,103,157,187,118,91,211,220,204,241,224,186,222,115,155,134,209,84,1,74,164,129,8,112,
-            237,171,71,232,22,38,151,58,1,153,120,32,216,5,152,83,103,178,64,5,73,89,34,223,52,160,55,75,9,115,62,173,234,191,
-            213,232,118,64,5,74,171,63,183,6,189,137,10,64,99,167,206,137,81,222,41,72,33,213,117,208,134,42,178,198,2,174,
-            89,149,140,240,82,124,102,114,251,83,219,96,167,12,165,189,76,149,81,122,67,167,53,133,153,241,38,176,226,65,164,
-            169,60,246,224,41,183,120,170,120,50,43,125,31,158,10,238,161,130,24,172,62,32,37,198,232,1,85,136,107,65,132,42,
-            41,172,177,42,178,57,197,53,68,7,177,118,173,172,239,104,134,121,89,49,149,168,134,182,6,30,71,40,139,202,213,84,
-            217,81,230,204,42,184,143,158,162,24,236,215,82,6,9,54,174,244,171,91,124,53,196,5,161,24,237,231,177,153,162,251,
-            113,4,179,56,116,63,14,175,221,118,58,244,187,188,113,173,57,43,246,147,191,37,50,124,66,51,31,103,206,82,251,78,
-            208,129,5,4,139,43,144,126,36,167,181,204,46,163,245,152,43,112,2,160,49,224,37,85,128,177,203,89,36,131,8,130,
-            76,88,147,216,159,179,84,16,139,161,29,196,248,108,58,151,177,110,8,159,65,216,0,79,221,247,195,17,242,231,72,12,
-            237,208,164,26,179,14,142,215,155,220,147,173,69,215,4,62,7,254,22,52,80,61,217,206,39,149,0,155,1,186,164,146,
-            141,143,21,244,197,51,10,86,160,20,139,128,107,42,106,238,102,147,4,66,188,117,135,245,182,17,95,55,112,110,197,
-            196,233,14,156,143,53,214,228,117,3,69,3,4,131,26,45,212,99,96,156,61,216,30,80,51,111,226,248,74,221,83,127,155,
-            231,122,2,146,144,161,153,102,230,43,117,214,244,46,202,251,21,61,95,198,139,106,175,60,89,64,216,18,64,32,25,130,
-            239,192,121,44,235,73,160,42,70,125,221,237,183,126,5,173,129,17,175,191,124,239,246,135,173,70,229,171,139,238,
-            240,154,180,26,255,177,101,104,104,71,205,192,8,111,164,75,18,28,171,55,243,36,143,140,94,229,227,96,19,106,152,
-            248,215,68,226,153,49,41,203,112,181,26,65,95,83,2,60,194,47,69,222,19,80,203,81,4,255,242,83,6,192,227,55,190,
-            251,206,193,55,53,208,183,39,231,65,248,137,228,142,97,106,83,242,102,118,65,225,200,255,0,123,19,201,11,192,116,
-            230,156,252,211,155,189,249,39,168,184,55,59,117,198,190,154,220,231,77,213,165,14,230,231,140,204,128,12,118,74,
-            131,224,69,96,132,138,107,3,173,201,232,186,117,117,221,134,255,192,137,167,112,231,22,12,9,193,33,210,37,160,85,
-            2,117,77,53,233,145,191,181,232,238,203,208,93,42,72,139,240,44,194,179,8,207,34,60,139,240,44,194,179,8,207,34,
-            60,139,240,44,194,179,8,207,34,188,131,16,94,53,82,107,44,60,127,106,129,218,23,3,181,76,142,22,172,89,176,102,
-            193,154,5,107,22,172,89,176,102,193,154,5,107,22,172,89,176,102,193,154,5,107,71,0,107,183,205,150,221,89,59,18,
-            96,75,101,105,241,154,197,107,22,175,89,188,102,241,154,197,107,22,175,89,188,102,241,154,197,107,22,175,89,188,
-            118,28,188,102,247,215,142,6,215,236,22,155,133,108,22,178,89,200,102,33,155,133,108,22,178,89,200,102,33,155,133,
-            108,22,178,89,200,118,60,200,86,79,60,187,197,118,36,204,150,151,165,197,107,22,175,89,188,102,241,154,197,107,
-            22,175,89,188,102,241,154,197,107,22,175,89,188,102,241,218,113,240,154,221,98,59,18,92,155,122,118,139,205,66,
-            54,11,217,44,100,179,144,205,66,54,11,217,44,100,179,144,205,66,54,11,217,44,100,59,30,100,235,169,85,178,210,48,
-            199,160,181,21,62,27,61,234,135,26,178,29,0,214,142,139,132,136,195,29,240,135,13,118,181,74,23,167,30,191,192,
-            142,180,137,215,225,27,140,174,96,230,43,20,16,189,6,68,183,157,212,167,117,148,33,98,230,76,107,147,172,140,1,
-            52,133,126,189,53,200,130,144,188,251,17,30,78,57,147,220,66,96,208,186,237,181,221,10,2,160,71,193,65,158,203,
-            16,188,235,220,184,157,42,151,146,4,247,50,216,205,17,56,128,219,42,134,2,65,134,90,179,20,37,94,76,206,21,101,
-            205,6,61,84,126,45,117,7,73,72,17,161,137,60,207,29,176,133,169,31,161,53,98,196,140,67,149,203,84,86,63,35,137,
-            165,130,128,176,20,187,150,135,80,88,91,231,218,156,164,211,250,197,64,182,119,71,14,177,222,234,12,232,31,253,
-            110,123,96,164,114,241,4,246,115,38,18,63,198,21,15,222,97,240,1,172,128,67,11,205,216,89,226,14,125,77,44,238,
-            81,74,19,0,28,179,80,45,243,241,178,241,76,215,16,158,2,20,192,152,31,128,75,12,30,80,132,83,35,83,144,151,23,76,
-            252,100,10,107,12,158,45,151,228,116,65,255,163,4,160,14,129,233,33,248,210,70,28,130,248,3,9,130,228,206,96,45,
-            204,146,128,172,57,52,11,209,176,3,10,33,239,106,88,123,84,225,61,64,38,116,216,104,151,216,121,166,67,163,225,
-            156,59,67,156,44,194,52,224,60,243,182,108,137,3,195,201,230,113,231,198,137,157,248,50,166,80,201,140,130,59,67,
-            108,8,232,135,90,133,222,132,214,46,97,68,12,209,113,128,244,38,47,29,236,233,94,202,149,38,13,0,207,207,247,138,
-            126,20,61,103,77,67,63,228,145,66,49,116,169,10,252,168,135,78,23,188,157,23,162,186,234,225,176,235,133,127,104,
-            61,245,159,52,70,91,174,124,208,197,0,205,44,204,44,204,43,141,37,194,231,79,41,162,93,32,163,140,175,144,145,42,
-            140,181,89,251,30,68,232,137,32,222,224,175,23,74,49,246,7,103,48,147,36,6,221,192,152,83,45,21,227,234,180,197,
-            59,129,96,28,100,12,102,155,23,217,123,110,116,90,225,199,17,169,103,70,143,112,59,70,202,107,6,129,18,14,230,195,
-            250,24,225,239,143,255,247,47,206,67,208,200,65,210,76,109,221,152,96,36,95,108,250,239,127,239,217,212,23,97,230,
-            231,117,91,232,150,30,175,53,229,127,109,91,235,56,50,45,106,136,185,233,175,42,63,130,223,21,37,140,168,245,236,
-            7,208,130,41,198,145,244,153,86,92,118,245,160,117,137,63,165,36,140,240,39,137,79,174,89,36,177,90,10,130,70,160,
-            47,15,158,64,235,6,81,150,143,169,75,234,164,50,23,71,192,39,89,142,182,112,139,177,48,118,174,63,173,102,24,172,
-            199,74,233,128,154,185,164,165,174,192,182,132,152,241,196,143,83,22,153,132,97,222,35,195,45,208,38,224,176,88,
-            176,48,6,244,131,96,109,42,185,70,8,185,39,215,252,41,47,115,114,27,235,252,59,39,62,160,63,4,24,121,14,97,169,
-            157,86,117,14,75,77,206,201,45,66,120,230,171,36,204,56,104,232,191,75,60,100,45,28,110,81,18,95,69,39,99,49,185,
-            63,172,147,172,197,222,157,204,84,102,13,0,72,208,95,107,172,195,250,231,160,134,28,39,79,55,91,178,133,158,175,
-            56,53,205,236,145,139,70,20,144,210,19,192,31,152,202,215,240,12,205,9,74,154,232,114,38,81,71,130,232,134,159,
-            232,221,4,115,213,64,226,175,21,45,179,245,219,247,14,118,141,120,53,8,79,131,232,6,163,211,236,34,118,61,12,215,
-            99,75,31,170,7,92,77,79,52,189,0,218,192,38,77,209,174,25,119,91,67,204,40,166,12,89,203,196,112,92,156,7,75,35,
-            6,131,242,43,56,108,186,3,136,60,62,189,42,239,97,52,37,72,91,61,21,216,27,96,99,10,49,40,2,195,6,232,248,226,48,
-            153,196,192,208,127,48,201,54,150,184,12,242,171,206,211,31,41,19,232,110,66,21,195,80,0,88,135,62,42,225,69,108,
-            222,126,37,8,35,229,214,66,13,11,53,44,212,176,80,195,66,13,11,53,44,212,176,80,195,66,13,11,53,44,212,248,74,161,
-            70,223,27,143,85,112,33,194,20,93,132,244,100,52,22,233,130,224,39,240,224,133,43,206,14,41,22,219,89,139,118,92,
-            132,147,138,105,87,25,25,70,187,27,176,141,244,177,74,4,137,167,212,56,58,94,243,227,77,14,210,210,61,97,96,69,
-            63,50,13,202,142,149,126,154,218,155,228,91,232,71,155,90,64,248,147,255,26,163,161,244,75,221,217,23,135,217,253,
-            214,197,69,183,51,186,168,247,71,102,55,125,115,125,90,238,227,203,118,247,195,40,219,234,228,226,180,236,245,224,
-            26,94,247,234,87,238,168,93,191,112,219,131,13,239,59,110,123,132,6,224,226,110,56,236,118,170,191,26,118,175,174,
-            218,174,254,164,242,11,220,252,214,239,43,139,34,114,92,119,219,77,106,182,247,16,205,134,237,230,1,98,161,199,
-            151,140,143,191,226,189,244,129,25,231,96,199,64,202,242,45,149,201,249,98,44,253,72,187,22,222,68,87,166,210,108,
-            28,153,173,96,54,26,105,45,228,62,189,209,96,75,157,225,134,244,241,250,42,41,86,169,175,149,8,112,96,88,17,0,132,
-            87,96,208,168,103,192,108,224,135,22,42,244,126,7,115,143,129,211,62,189,164,155,241,7,244,1,161,156,14,47,247,
-            147,89,73,3,74,93,129,99,194,98,15,20,12,21,142,172,137,81,243,114,2,32,81,187,13,122,2,46,207,224,79,221,242,116,
-            127,118,202,170,86,226,137,11,142,34,249,199,176,84,88,221,107,197,158,177,154,207,125,195,9,50,162,203,38,85,89,
-            169,8,212,170,213,89,72,165,139,0,183,3,185,151,82,231,76,199,90,231,84,125,179,103,215,168,237,21,221,111,182,
-            175,219,106,87,190,222,240,46,245,138,251,70,120,60,124,28,61,153,143,198,117,189,115,133,249,186,52,160,72,41,
-            22,66,169,33,8,18,224,38,26,229,89,172,97,62,39,83,105,54,41,200,2,84,68,139,19,70,132,249,0,49,33,216,69,149,84,
-            25,120,95,251,224,0,62,91,157,171,3,24,93,133,158,10,77,77,237,113,120,173,81,242,3,51,42,15,82,19,230,202,204,
-            157,131,24,214,47,96,153,55,155,176,178,154,221,15,157,3,134,65,217,40,6,186,211,41,86,161,170,36,53,5,14,41,19,
-            21,177,113,166,10,12,252,33,172,220,245,142,200,72,40,177,90,248,80,78,250,248,187,178,207,150,9,47,239,163,136,
-            132,25,121,158,68,170,217,120,158,64,218,238,37,200,163,209,110,53,110,158,195,138,47,103,235,156,76,85,130,41,
-            134,124,241,225,126,252,144,47,104,62,135,15,99,166,249,141,73,100,230,140,52,230,26,153,159,157,108,144,79,32,
-            137,60,143,151,188,223,40,117,91,117,101,159,39,124,53,207,157,34,50,15,182,238,24,241,71,26,110,111,197,108,127,
-            222,81,163,35,223,199,71,35,126,209,35,66,83,234,226,79,58,35,180,215,233,27,230,16,75,193,191,248,8,14,147,170,
-            34,99,226,148,102,171,222,238,94,21,177,146,251,91,226,65,116,161,243,40,24,58,44,199,94,192,233,75,152,183,116,
-            24,181,194,233,35,174,94,206,159,84,58,33,227,129,167,61,208,53,122,124,38,134,226,18,206,235,223,5,222,231,211,
-            42,222,152,167,78,183,116,36,35,219,17,170,145,79,37,49,21,78,86,8,39,119,128,162,176,73,4,17,209,28,188,45,139,
-            37,87,35,141,138,144,230,142,117,3,97,246,142,206,157,187,114,185,52,58,2,206,48,209,142,13,250,253,5,6,141,1,121,
-            116,244,228,58,237,4,162,10,87,152,72,215,115,224,116,96,240,161,196,189,37,8,188,116,6,113,169,166,16,142,241,
-            23,209,145,206,50,108,158,243,103,28,66,216,76,108,219,41,132,226,33,4,62,192,241,220,51,8,195,108,69,0,56,123,
-            138,182,157,71,56,236,180,193,250,97,131,114,219,15,245,206,112,128,113,98,127,144,207,209,208,212,199,42,221,182,
-            200,118,45,140,198,137,32,166,47,230,102,127,110,33,194,55,247,242,137,171,247,35,206,30,195,115,120,20,57,103,
-            244,148,158,209,223,116,144,8,220,54,38,56,65,251,221,190,222,117,195,3,61,73,148,208,142,65,154,131,214,162,9,
-            196,131,55,231,21,74,235,144,26,208,46,3,230,162,81,249,211,64,222,156,232,202,212,250,220,105,113,230,154,54,54,
-            215,15,130,121,168,203,122,231,31,71,68,75,40,12,245,233,53,25,79,206,107,180,231,200,187,26,81,140,235,141,6,97,
-            142,29,233,67,114,48,186,177,194,77,215,28,183,180,161,73,24,165,70,44,232,84,59,130,111,167,195,159,17,3,120,164,
-            12,112,106,122,160,173,36,204,161,24,211,192,7,11,111,22,159,13,117,28,82,62,170,0,182,97,212,119,123,245,86,135,
-            142,168,176,10,175,205,108,186,212,129,176,134,78,184,99,9,124,64,4,16,138,199,210,142,10,134,4,180,177,236,197,
-            250,236,27,29,128,242,2,80,45,49,197,143,185,25,26,8,74,15,235,221,215,242,102,163,160,211,107,188,55,64,68,160,
-            193,185,211,72,247,78,243,71,187,208,126,73,90,10,116,176,142,143,208,229,207,32,49,170,152,37,32,197,80,174,132,
-            23,160,215,167,3,120,124,142,13,183,155,176,121,197,182,106,181,111,56,210,145,27,77,242,111,112,230,6,204,189,
-            252,201,65,235,213,11,213,127,96,102,193,211,252,239,111,137,138,127,198,206,71,122,127,35,228,71,25,124,95,242,
-            6,2,48,193,155,81,27,120,199,211,103,42,188,63,223,236,61,95,240,68,78,217,74,14,176,179,139,118,183,113,51,114,
-            223,131,197,74,141,37,110,204,44,151,32,98,142,23,201,130,225,72,197,156,44,81,178,122,68,107,160,87,116,193,105,
-            215,96,53,189,142,202,207,208,212,152,16,86,59,96,44,153,160,12,70,148,229,65,132,177,132,113,126,47,175,102,92,
-            55,54,54,166,3,253,55,163,241,28,95,179,36,164,101,193,252,69,155,199,220,235,119,27,238,96,48,106,53,179,224,41,
-            239,175,216,150,233,37,7,29,76,64,79,29,15,129,46,247,95,99,203,175,21,139,244,17,231,29,12,192,227,231,22,124,
-            70,98,251,233,39,24,241,45,190,195,161,124,198,190,210,142,7,61,183,209,186,108,185,205,221,60,222,181,0,136,54,
-            235,67,119,176,55,167,119,45,16,193,20,13,240,110,118,239,232,195,187,214,58,203,14,190,165,158,145,135,3,56,127,
-            95,111,183,168,89,223,109,220,245,7,173,247,110,251,83,85,40,248,94,248,30,118,254,134,42,223,102,50,108,138,88,
-            12,213,155,75,152,92,182,8,39,167,250,48,51,86,199,40,115,216,43,221,125,45,111,145,163,189,7,13,162,3,148,18,28,
-            152,167,146,240,148,20,47,167,116,185,218,156,37,198,117,9,0,6,136,33,145,175,104,130,22,132,141,15,218,147,100,
-            156,143,79,190,252,60,91,6,16,178,48,173,112,252,235,239,113,166,45,23,155,254,117,146,171,77,3,63,247,202,172,
-            66,192,110,220,112,46,73,209,10,188,152,233,20,178,20,87,89,136,103,178,20,90,83,188,72,27,57,136,240,99,120,68,
-            231,168,43,83,21,61,204,242,95,98,58,34,203,85,208,51,35,67,218,6,56,234,254,243,145,75,96,145,191,29,9,132,37,
-            204,73,178,218,82,82,67,69,31,94,69,45,80,78,43,179,61,17,173,159,183,68,213,33,6,32,162,206,95,3,193,247,18,80,
-            216,60,137,19,93,11,102,6,144,18,161,82,7,180,61,158,111,180,130,162,8,134,23,92,112,146,203,80,177,106,98,200,
-            110,118,111,112,111,19,119,236,133,57,246,138,53,7,38,63,198,221,0,17,140,178,117,156,35,57,188,138,104,57,47,5,
-            24,199,180,168,87,247,211,19,152,136,126,247,227,247,223,215,254,225,228,254,7,15,254,154,155,27,52,61,213,203,
-            15,161,220,92,133,102,16,229,180,219,186,61,155,166,214,108,154,215,78,143,238,8,0,123,22,166,226,36,225,131,28,
-            209,125,143,234,157,79,182,116,241,43,41,93,92,169,40,51,1,61,229,101,214,84,79,63,151,250,33,212,160,112,201,20,
-            36,71,206,201,217,15,53,231,236,135,83,141,181,75,37,140,25,164,208,161,149,209,183,66,233,175,217,61,42,85,210,
-            191,57,164,194,210,148,175,241,250,198,15,95,128,85,178,87,5,101,174,177,196,29,25,168,100,190,200,27,70,12,121,
-            30,188,136,194,39,201,133,190,209,11,212,99,242,146,218,123,168,107,163,76,11,74,77,230,203,208,255,226,113,29,
-            94,177,185,62,174,10,186,172,29,123,226,236,97,191,222,25,112,246,180,116,199,210,176,80,149,70,123,152,140,178,
-            106,250,242,33,44,133,143,179,242,117,8,33,37,194,78,74,34,104,32,176,251,190,19,220,117,2,30,32,106,28,100,16,
-            180,128,220,168,131,137,224,84,19,149,145,80,78,7,193,96,40,240,118,32,201,241,249,182,220,158,205,207,125,83,249,
-            185,247,131,70,191,219,110,111,78,200,201,128,18,202,34,45,208,113,162,73,168,124,31,55,113,48,84,194,179,14,122,
-            174,211,102,250,222,19,19,52,80,82,67,159,178,201,78,77,208,116,112,221,174,190,117,42,163,140,49,156,190,31,5,
-            171,63,242,59,5,84,248,68,199,104,232,162,170,170,49,93,239,61,166,172,176,41,63,42,92,174,17,134,187,84,183,77,
-            115,18,97,128,55,163,203,89,180,196,40,1,197,107,39,83,154,202,189,163,252,229,112,155,89,194,190,2,156,216,25,
-            165,185,66,94,167,148,153,44,213,95,51,172,208,41,70,76,193,197,8,61,82,96,173,83,43,252,146,74,228,9,47,239,182,
-            31,54,85,187,95,170,182,96,103,183,196,57,218,121,28,146,170,253,166,147,48,54,133,185,53,133,153,246,248,245,231,
-            48,119,177,250,199,37,49,55,175,62,8,33,209,200,79,11,229,4,217,102,36,57,128,156,238,163,109,167,93,6,47,88,37,
-            113,62,9,64,137,157,181,99,39,145,99,58,168,241,158,232,172,112,184,132,116,214,124,65,73,2,137,23,26,50,32,126,
-            162,183,161,100,55,4,175,231,2,79,91,154,4,146,238,201,195,228,202,54,196,191,240,166,128,122,171,198,55,88,232,
-            56,4,15,19,68,197,19,195,219,40,30,255,88,16,109,230,243,126,11,91,36,189,247,2,139,23,207,81,102,8,97,66,40,155,
-            51,169,64,40,172,229,238,251,140,40,87,249,68,21,13,154,188,222,68,166,79,211,82,104,180,169,95,126,16,41,7,115,
-            170,143,33,173,31,57,74,41,236,56,114,180,5,98,172,39,223,210,250,154,10,104,154,140,41,251,86,157,173,211,129,
-            43,69,153,16,161,130,113,158,82,157,10,30,155,33,203,165,211,139,164,142,148,153,18,204,58,134,184,148,16,51,173,
-            168,141,142,47,204,36,208,154,96,98,148,18,196,98,101,190,237,142,225,139,14,151,241,148,16,215,108,9,140,146,103,
-            158,62,81,205,9,55,106,174,13,56,38,19,71,139,105,56,226,195,192,50,75,61,241,10,55,41,162,151,200,213,234,60,224,
-            166,84,237,243,15,86,85,54,118,251,117,172,219,169,55,110,174,250,221,187,78,190,6,206,13,65,10,91,154,178,171,
-            200,70,104,140,252,150,177,233,37,50,198,242,23,201,238,99,195,160,176,96,59,71,28,173,199,250,249,171,117,153,
-            233,194,117,178,50,83,173,220,235,196,41,156,204,81,239,97,180,181,101,164,28,115,102,204,192,100,108,249,58,245,
-            15,185,38,5,143,178,233,142,9,173,98,131,133,148,113,169,82,16,213,111,20,225,139,209,212,79,235,5,241,41,61,60,
-            172,112,176,120,160,75,209,106,206,61,49,89,190,220,163,245,3,160,197,247,133,92,71,233,85,62,189,179,253,204,216,
-            183,82,189,136,19,201,147,232,191,108,13,99,65,99,118,150,50,162,10,129,71,190,31,97,111,166,79,252,255,81,49,185,
-            60,44,92,245,161,238,181,25,174,184,217,3,226,159,222,224,218,117,135,163,78,119,232,94,116,187,55,21,161,91,246,
-            81,227,186,219,106,236,254,172,221,26,12,119,126,132,183,134,239,254,168,239,154,238,170,152,221,150,15,230,245,
-            6,243,1,226,82,163,153,23,23,4,86,12,108,240,171,194,142,108,118,153,2,52,204,95,209,225,227,173,220,62,99,70,58,
-            1,112,162,239,152,72,161,13,57,164,148,25,90,220,4,26,151,98,210,29,156,238,136,149,120,138,249,36,79,145,95,13,
-            238,170,143,227,155,59,48,114,103,128,184,122,177,98,202,65,152,133,107,208,193,139,191,238,222,188,214,109,1,252,
-            166,105,22,174,22,53,169,150,79,208,153,254,166,98,202,62,101,145,124,70,22,154,236,166,219,189,217,66,182,222,
-            235,101,40,53,35,92,199,44,201,235,45,237,58,221,245,70,29,181,173,69,163,222,105,184,237,245,86,192,246,68,250,
-            187,135,209,224,138,221,205,244,177,188,182,130,60,54,219,131,58,113,177,133,124,190,250,42,163,126,13,127,231,
-            7,141,179,255,95,51,214,93,106,168,146,88,134,163,226,229,66,164,139,94,69,168,187,126,245,14,25,30,157,152,227,
-            236,144,131,110,23,125,188,103,106,105,157,36,64,163,126,118,230,120,243,64,133,28,6,35,136,3,5,62,251,193,57,209,
-            73,9,92,53,103,63,236,226,215,11,130,47,225,247,113,161,252,180,20,225,133,89,45,21,165,103,22,105,183,113,40,164,
-            124,10,166,193,214,168,111,168,81,7,66,84,160,126,110,43,212,191,221,10,245,234,2,245,205,52,109,129,186,221,0,
-            59,222,6,216,193,165,214,100,203,43,146,248,219,45,186,45,186,182,69,215,182,232,250,111,85,116,109,75,174,247,
-            43,185,38,131,90,172,187,174,200,140,124,3,197,215,140,117,114,21,216,140,113,94,180,12,155,133,91,93,11,74,221,
-            219,130,236,114,150,191,84,131,218,64,143,103,242,149,69,126,186,55,23,228,157,27,236,20,11,27,0,153,249,79,81,
-            156,182,46,198,195,234,139,150,152,96,202,93,154,84,201,29,105,47,203,225,147,140,142,223,113,150,37,218,210,51,
-            165,111,142,223,119,157,107,103,22,114,55,7,29,117,252,238,241,74,228,93,253,114,30,231,248,125,23,242,67,219,250,
-            71,204,254,2,221,231,146,95,91,122,199,116,212,241,59,191,174,188,192,161,180,203,87,177,91,243,1,64,99,56,205,
-            29,143,48,15,244,158,46,255,245,39,110,114,84,223,223,87,222,142,217,111,19,103,143,205,155,23,222,83,97,233,190,
-            232,110,10,119,177,107,27,229,15,187,224,225,107,190,153,225,101,14,253,127,65,2,228,72,153,198,175,55,137,245,
-            2,9,167,111,51,121,105,206,108,5,251,36,49,95,244,140,251,135,214,175,245,126,19,225,20,230,49,138,247,206,113,
-            53,148,40,120,159,4,67,95,2,153,212,96,7,98,41,238,84,84,109,82,60,122,83,152,43,99,78,215,118,44,104,255,17,228,
-            47,42,79,78,126,219,71,80,97,206,150,98,85,121,8,245,130,94,85,184,7,186,253,42,66,159,152,98,86,244,23,233,222,
-            205,79,248,195,189,178,242,254,236,241,114,53,34,68,178,204,253,60,200,46,189,65,12,126,181,182,224,153,115,84,
-            240,236,114,74,88,238,222,156,46,53,77,47,39,172,132,246,5,186,13,88,241,125,183,154,52,207,62,16,220,126,1,102,
-            145,32,136,124,216,189,61,148,215,177,2,221,95,110,161,126,205,212,241,234,178,106,218,249,139,64,83,234,58,173,
-            133,115,182,155,246,54,81,84,82,55,186,77,98,218,77,159,174,127,59,156,121,186,249,109,11,245,97,171,189,129,233,
-            24,79,142,238,178,31,160,147,224,130,70,100,37,182,153,17,115,40,138,205,137,169,71,212,157,113,53,170,182,252,
-            120,53,44,93,128,205,99,192,236,169,208,162,210,231,93,245,146,193,18,7,186,255,80,115,60,211,191,122,253,187,12,
-            149,121,152,174,23,206,249,224,133,163,99,137,53,127,50,166,109,128,56,103,231,49,17,70,1,61,155,208,50,5,254,81,
-            114,13,177,33,220,121,194,93,5,252,133,116,170,139,212,63,215,177,107,231,21,229,117,120,45,170,46,64,37,49,101,
-            63,98,96,178,20,51,20,28,111,82,72,145,254,126,9,12,99,101,142,88,84,10,172,118,184,196,94,38,139,193,17,243,33,
-            181,138,90,117,55,220,15,202,244,138,87,238,225,52,51,157,236,4,15,222,144,185,127,23,197,171,61,119,246,177,111,
-            7,23,238,101,183,239,30,48,148,76,128,124,207,105,7,97,72,6,57,105,103,74,95,25,127,37,227,244,45,158,133,157,66,
-            136,100,126,88,126,211,24,89,203,211,235,241,205,15,24,100,63,75,35,2,125,163,40,134,139,102,51,112,73,215,75,230,
-            78,166,135,50,78,194,64,231,217,192,211,105,86,116,96,117,176,148,136,69,44,230,236,236,154,3,29,145,60,10,83,197,
-            73,63,108,35,60,208,126,16,204,73,188,89,17,78,183,179,96,106,115,118,117,79,123,75,34,6,152,177,50,22,140,243,
-            34,121,103,159,99,67,91,144,189,120,224,157,182,253,180,99,211,221,146,122,167,237,220,217,218,211,37,44,234,193,
-            245,254,186,152,246,54,131,213,27,45,42,250,219,80,174,202,84,241,98,128,1,253,146,207,90,42,36,255,42,159,20,161,
-            75,182,249,249,150,172,197,51,202,54,31,68,88,149,96,120,7,221,34,47,207,139,7,177,229,25,23,154,123,19,99,106,
-            171,98,62,22,209,27,45,89,21,210,77,243,148,123,142,222,253,207,255,3,250,169,101,87
-        };
-
-    // ../xml/interfaces.xml (57278 bytes)
-    const unsigned char interfaces[11331] {
-            120,218,237,125,107,115,219,72,146,224,253,20,132,35,54,44,109,203,180,221,158,190,219,245,246,116,4,77,209,18,
-            199,20,169,16,41,219,61,177,17,8,144,0,73,140,64,128,131,135,40,77,236,253,247,203,87,61,0,130,32,169,135,207,61,
-            227,47,221,50,88,143,172,172,172,172,124,85,230,175,103,65,28,164,94,158,164,167,193,44,140,195,60,76,226,236,183,
-            95,231,65,236,76,35,47,203,254,252,226,75,24,251,201,218,233,222,6,113,158,189,112,242,251,85,240,231,23,97,156,
-            7,233,204,155,6,47,126,251,117,234,229,193,60,73,239,157,216,91,194,79,31,147,105,145,169,230,191,253,26,224,31,
-            242,211,250,174,251,121,236,126,234,245,251,238,199,97,231,122,244,66,205,177,190,163,94,212,233,197,235,186,78,
-            163,238,120,71,159,215,10,142,13,136,120,137,81,19,76,157,225,96,220,253,58,118,47,186,131,107,107,134,78,2,235,
-            188,203,47,130,184,104,128,173,123,213,30,117,221,15,237,206,167,179,171,225,245,224,212,26,160,155,122,89,208,
-            208,245,188,219,191,180,154,159,7,209,170,161,245,101,187,55,24,91,205,47,61,216,135,38,164,245,254,218,181,154,
-            143,194,127,52,193,114,125,121,218,30,119,221,235,158,213,229,122,229,3,46,175,123,123,96,249,83,112,63,73,188,
-            212,111,68,243,121,251,202,26,29,186,52,192,131,141,221,243,225,240,83,93,15,103,1,168,250,243,139,235,56,10,111,
-            2,199,139,34,39,95,4,78,2,255,73,157,155,224,222,161,225,178,19,248,26,102,252,15,7,254,88,165,201,202,155,3,220,
-            190,83,172,214,0,108,70,221,214,76,226,139,16,200,36,157,46,238,157,245,34,156,46,112,212,100,157,57,68,235,211,
-            96,149,135,241,220,9,97,156,152,58,173,188,20,71,149,190,201,140,62,206,144,36,97,116,249,154,39,50,84,72,211,103,
-            4,6,30,50,24,250,222,57,10,169,83,26,224,111,113,82,233,92,133,157,58,195,128,4,240,93,123,181,114,230,81,50,1,
-            178,78,38,127,11,166,249,113,203,233,81,59,47,202,18,103,206,167,26,6,155,4,179,4,102,240,226,251,13,236,192,71,
-            223,193,198,225,109,144,213,172,201,139,157,100,181,74,210,188,0,144,239,113,238,101,226,135,179,123,106,122,163,
-            182,123,1,163,68,136,26,64,65,8,131,78,23,97,228,195,48,39,78,208,154,183,100,229,180,46,66,100,76,75,159,0,142,
-            239,190,132,254,60,200,17,193,0,197,18,102,135,169,50,156,70,99,28,54,44,200,50,28,188,155,77,9,114,104,139,75,
-            161,73,112,70,207,241,1,153,201,28,187,77,163,36,11,8,56,249,6,224,4,209,12,182,0,184,89,152,191,204,120,184,192,
-            111,57,31,238,29,63,152,121,69,148,159,56,180,11,54,166,105,69,129,15,191,180,130,22,141,199,95,82,199,79,130,44,
-            126,153,59,83,36,56,160,82,236,241,254,253,232,38,92,29,29,159,56,113,16,18,134,133,205,117,127,119,79,135,95,6,
-            176,179,234,19,82,180,194,253,58,132,33,38,129,181,83,71,94,148,47,146,98,190,176,6,184,190,116,178,28,91,74,243,
-            99,1,10,176,154,6,171,8,24,48,111,28,204,177,4,82,48,123,219,114,206,147,53,252,153,34,170,17,92,68,34,182,204,
-            86,193,20,176,227,156,38,109,36,239,1,176,55,90,198,209,177,179,12,96,126,223,185,79,10,232,17,203,162,157,202,
-            97,100,162,33,152,232,124,168,169,101,89,178,28,184,69,90,206,24,177,138,148,155,224,200,12,128,71,24,134,99,22,
-            0,21,0,85,204,10,88,86,145,211,132,128,141,52,248,123,17,166,72,43,51,130,35,14,224,111,216,90,216,56,218,29,79,
-            147,104,5,42,181,67,179,52,89,58,105,17,199,56,221,58,68,132,230,78,86,172,52,33,109,193,214,199,144,9,51,78,242,
-            112,26,48,160,101,170,128,95,172,205,34,154,194,177,150,9,172,2,127,159,122,171,188,64,208,189,76,136,126,10,87,
-            105,232,7,248,77,198,211,172,134,185,194,194,227,221,147,174,78,6,208,2,89,167,193,52,128,35,169,185,154,62,106,
-            130,227,60,73,244,210,104,15,152,49,101,6,55,227,100,213,135,198,209,23,205,134,248,194,70,94,131,61,113,216,48,
-            69,118,56,101,180,180,234,89,176,162,225,6,14,124,86,70,9,30,78,196,43,46,109,18,192,7,125,228,122,91,142,25,17,
-            20,34,55,131,99,180,194,99,103,29,22,34,123,252,177,116,82,60,90,55,240,203,148,135,196,9,105,30,231,8,105,169,
-            116,124,212,193,105,88,225,245,229,35,214,7,132,28,120,184,192,230,219,241,130,200,164,225,106,236,130,0,114,229,
-            126,233,13,0,223,22,56,212,175,225,146,236,119,219,159,187,15,233,246,113,236,158,118,250,189,206,167,131,123,149,
-            233,97,175,62,37,12,239,234,113,209,59,61,237,119,15,135,78,245,59,12,62,233,117,16,132,87,189,179,243,7,160,79,
-            186,29,6,31,119,58,8,188,246,245,215,183,135,67,199,189,14,3,142,250,28,10,219,207,15,130,237,231,7,192,246,243,
-            129,132,55,28,247,134,7,209,206,240,122,212,253,114,222,237,246,183,118,178,56,194,107,96,96,37,205,10,248,116,
-            26,4,157,60,141,62,0,7,169,83,173,54,167,28,95,117,65,213,232,158,245,6,238,233,85,251,236,69,121,172,38,206,53,
-            9,230,33,95,139,112,29,248,169,55,215,55,129,19,5,179,92,46,50,224,159,57,220,221,245,235,181,38,191,122,186,217,
-            211,112,190,216,127,250,238,224,244,208,149,7,177,143,19,227,172,115,37,22,152,117,195,37,114,24,4,140,128,126,
-            251,67,183,239,118,79,123,227,38,72,72,4,18,217,70,100,24,148,201,141,72,246,57,200,147,163,227,93,11,254,102,147,
-            157,118,251,93,208,1,123,227,238,69,237,76,219,123,98,23,183,221,25,247,62,131,18,121,250,144,206,157,97,191,223,
-            190,28,61,170,115,111,112,246,204,24,162,217,186,95,47,219,131,211,135,65,202,125,191,17,160,124,123,84,217,237,
-            222,176,202,229,248,144,254,35,32,88,16,225,6,103,7,99,73,247,124,126,28,213,200,183,251,227,166,108,42,218,197,
-            132,72,206,103,115,18,40,90,113,33,210,43,8,253,32,64,78,177,89,152,7,75,91,174,252,123,17,100,57,202,195,162,86,
-            194,202,60,97,85,211,40,156,222,32,231,154,160,18,165,212,26,26,22,132,83,22,69,171,183,205,135,48,95,122,171,90,
-            11,30,154,69,130,52,87,178,234,132,90,234,134,75,111,30,148,112,30,178,214,194,205,80,105,89,199,202,40,34,74,53,
-            40,136,176,114,178,72,172,89,83,204,18,220,38,50,3,224,194,81,124,103,115,4,143,146,177,22,14,130,53,168,48,36,
-            240,7,119,43,88,100,152,131,78,150,5,57,45,169,2,166,31,102,222,4,20,8,119,178,172,7,246,131,13,160,222,4,102,240,
-            184,8,53,64,221,224,162,182,60,120,236,85,145,45,80,167,39,27,8,104,123,17,27,38,0,1,104,129,9,86,153,165,60,74,
-            47,153,210,193,1,242,227,58,160,200,64,244,48,144,144,174,180,30,73,227,144,218,45,122,173,82,210,106,230,156,22,
-            105,74,84,189,247,140,90,35,78,208,252,96,193,64,202,89,88,157,244,184,229,12,44,165,27,232,96,65,29,133,188,164,
-            49,153,45,102,33,30,240,130,53,105,1,204,89,69,94,14,36,181,116,174,123,136,222,76,186,19,160,153,62,101,12,2,40,
-            136,89,129,150,189,204,97,213,56,115,190,94,226,57,58,27,127,250,233,24,45,110,178,6,193,144,6,65,19,46,89,131,
-            104,2,34,113,28,105,29,68,145,24,59,150,222,77,64,218,255,42,1,181,122,130,155,158,32,249,58,127,43,178,124,115,
-            224,28,13,117,104,201,241,178,36,6,82,188,119,230,73,130,38,187,133,119,27,38,69,138,164,128,39,69,45,49,171,165,
-            212,36,35,171,189,218,161,100,69,255,250,237,87,254,67,90,97,199,210,135,245,29,106,102,106,39,47,101,144,210,201,
-            22,147,5,74,73,53,221,233,106,217,167,63,177,172,154,1,198,195,203,125,186,231,201,170,166,243,135,225,120,60,188,
-            216,167,255,36,129,157,95,18,75,84,152,219,192,225,210,75,65,50,212,188,145,77,229,134,231,1,77,115,3,216,154,124,
-            29,168,147,37,211,196,62,195,137,156,93,204,192,34,68,106,11,152,208,42,108,112,18,195,127,194,229,42,10,150,124,
-            95,21,177,15,196,116,49,250,66,22,18,115,58,52,193,159,160,141,83,216,42,131,161,9,210,75,147,66,102,103,96,234,
-            57,127,39,89,46,17,202,31,55,192,143,27,224,199,13,240,79,112,3,108,156,240,83,246,119,136,185,119,20,228,232,171,
-            218,231,160,135,190,110,228,219,252,46,244,1,177,136,237,84,175,153,125,42,173,23,191,173,239,122,167,110,123,240,
-            123,3,63,189,245,210,208,51,36,35,87,146,140,223,89,36,9,238,18,186,110,102,104,146,134,45,148,14,138,127,138,149,
-            28,142,39,44,156,60,79,72,80,71,40,216,103,184,60,94,232,103,238,4,7,165,114,61,176,125,95,205,55,96,107,127,134,
-            44,189,122,145,100,240,139,110,216,158,160,69,253,231,95,254,205,161,207,68,186,160,94,240,104,173,141,190,203,
-            48,14,203,93,223,189,219,179,107,4,124,60,168,244,133,105,233,243,70,87,254,171,1,219,64,106,230,230,186,76,66,
-            163,131,140,208,189,102,57,196,148,172,128,196,106,88,53,144,237,209,171,183,39,206,171,183,199,202,93,25,251,33,
-            26,174,50,62,145,198,85,39,30,10,101,138,183,174,38,53,244,6,189,108,50,20,218,137,218,171,182,10,47,182,124,6,
-            88,113,216,10,156,39,140,124,39,136,201,3,135,70,42,33,62,60,126,183,33,159,229,128,175,237,90,57,12,201,97,89,
-            44,221,61,86,39,77,25,14,33,121,65,215,222,139,221,88,39,28,142,105,17,241,66,75,19,60,122,97,222,221,222,11,227,
-            166,117,11,171,189,204,210,96,78,34,140,59,77,34,224,118,102,244,142,252,187,50,190,233,225,112,143,221,147,76,
-            188,233,205,97,147,152,30,123,79,50,75,12,179,195,184,148,154,19,136,77,170,103,131,175,12,217,63,241,114,177,167,
-            156,189,159,126,130,206,230,53,50,70,61,68,78,98,84,24,131,228,20,138,189,195,140,248,210,184,223,107,160,100,174,
-            234,226,63,20,176,89,158,194,77,225,6,217,212,91,5,153,142,170,200,216,235,10,119,75,50,13,153,164,176,151,177,
-            156,170,16,5,237,126,196,143,222,10,5,54,114,254,178,152,35,87,223,5,92,238,51,184,227,50,192,37,92,242,183,94,
-            84,200,189,140,228,124,27,250,5,176,103,57,241,147,228,46,168,165,194,172,152,208,101,87,134,92,65,220,99,132,193,
-            173,137,167,39,13,111,81,58,230,219,145,93,194,235,59,185,35,81,16,198,166,140,85,190,88,238,113,147,85,55,234,
-            36,130,0,203,28,247,204,89,120,52,194,3,6,109,180,156,223,113,24,114,80,138,151,218,243,89,24,95,4,30,10,245,51,
-            148,249,112,153,52,62,119,151,0,142,137,151,5,238,194,79,221,48,158,70,133,31,112,104,10,46,151,100,33,145,132,
-            168,31,54,149,206,75,148,33,20,76,30,249,151,243,180,152,230,24,96,128,59,19,39,232,2,6,0,225,190,167,169,150,94,
-            142,178,142,94,253,209,177,221,169,94,150,232,123,241,188,0,201,169,65,140,120,93,86,47,126,250,233,16,145,131,
-            150,142,168,81,109,249,111,35,123,224,191,9,203,74,153,210,8,168,165,11,34,42,23,68,73,111,57,49,131,78,19,63,112,
-            3,63,44,91,11,85,43,138,147,241,125,138,73,193,63,248,230,194,29,140,65,217,72,167,122,56,75,234,84,103,23,5,163,
-            20,45,142,9,134,221,24,13,7,173,144,24,144,129,42,221,20,110,240,57,59,170,69,133,85,139,177,2,115,112,89,48,23,
-            147,137,55,3,132,209,244,71,44,41,120,209,49,130,59,77,150,171,16,189,228,22,77,213,161,33,74,128,255,187,8,186,
-            162,40,179,21,244,111,66,185,62,225,253,48,3,190,148,196,1,138,190,75,12,16,162,1,236,89,36,18,135,58,43,229,206,
-            64,191,3,156,236,62,203,131,229,99,224,225,17,158,12,32,213,208,13,125,13,201,36,73,34,139,129,76,23,193,244,134,
-            244,237,24,227,64,226,87,86,132,146,111,2,118,166,64,26,57,135,121,120,232,91,42,150,2,65,4,107,128,189,143,48,
-            14,1,57,140,144,206,148,226,74,128,122,195,57,195,76,252,79,209,67,40,26,226,137,179,188,15,253,63,191,125,243,
-            6,197,217,183,13,210,158,196,143,185,56,179,171,184,96,29,79,228,179,148,2,80,33,211,185,133,45,236,172,87,132,
-            60,154,248,18,156,10,2,78,9,249,231,189,179,243,238,104,236,252,228,52,1,68,71,211,245,129,84,57,240,103,27,52,
-            120,213,201,105,202,84,92,203,58,1,101,20,183,220,155,166,137,102,161,204,35,153,231,193,184,32,192,240,165,162,
-            85,55,23,167,139,112,180,35,31,164,237,59,140,28,59,118,106,53,102,252,175,155,173,144,21,109,187,57,44,83,11,225,
-            128,240,130,26,94,10,106,16,83,131,30,100,15,134,96,248,183,89,5,241,51,102,223,185,96,189,136,195,191,23,129,90,
-            172,244,166,88,184,21,92,236,72,31,108,217,247,172,217,183,216,119,128,1,159,51,249,31,192,135,249,192,60,128,113,
-            110,112,185,166,179,168,24,27,197,203,189,214,199,151,206,179,138,88,4,30,183,36,187,88,145,153,123,20,176,139,
-            1,154,22,254,50,186,103,89,228,225,80,53,142,96,92,6,203,9,222,119,120,230,44,242,57,149,251,188,67,3,40,196,108,
-            231,157,246,109,252,61,240,206,71,192,243,196,188,51,140,65,152,131,118,4,18,210,199,86,90,25,137,108,130,63,240,
-            140,216,19,131,207,146,13,193,72,206,71,16,251,138,23,174,138,9,200,143,239,129,31,77,89,73,69,1,107,137,154,10,
-            236,42,192,148,147,159,236,61,109,250,10,54,23,96,215,141,51,100,11,66,31,100,94,148,75,29,246,101,147,86,216,220,
-            48,137,234,37,77,125,85,144,168,228,178,184,186,235,206,8,60,224,76,104,161,1,17,220,94,37,241,18,18,75,105,52,
-            37,252,50,87,19,88,41,248,85,225,64,153,141,140,32,215,114,186,116,65,240,0,33,171,17,75,184,200,156,63,147,132,
-            8,127,49,170,208,23,90,80,4,44,50,49,148,95,233,174,66,38,178,4,117,50,92,225,249,133,49,188,24,195,70,41,120,150,
-            204,102,36,59,26,91,140,150,16,145,229,90,96,188,248,237,77,195,45,16,39,46,198,223,162,54,49,73,45,110,91,143,
-            48,20,85,165,185,67,205,157,163,255,251,95,199,53,65,177,155,84,98,19,43,43,80,18,167,141,231,31,232,44,184,203,
-            3,49,138,171,27,68,61,108,16,102,84,38,126,162,213,9,28,225,155,234,10,107,25,109,61,91,217,131,223,194,206,184,
-            162,99,184,37,77,198,198,80,7,209,195,27,40,58,96,73,236,224,251,160,164,169,144,219,0,117,71,77,138,42,126,87,
-            123,25,232,10,99,87,182,132,201,162,35,3,99,119,203,152,64,148,2,249,206,48,20,150,152,50,246,80,152,105,146,0,
-            86,69,26,184,183,97,154,131,34,231,206,224,98,160,19,185,231,250,80,15,195,235,161,4,160,163,71,17,133,23,167,112,
-            100,10,231,8,40,159,228,164,38,130,44,225,186,70,233,181,197,36,91,221,168,98,119,30,39,18,144,188,177,131,100,
-            23,142,5,241,181,14,10,105,125,136,186,83,153,95,29,236,40,64,38,194,17,180,203,21,204,16,90,42,175,23,1,117,248,
-            247,214,94,230,50,242,35,23,96,216,168,43,38,7,100,30,101,68,162,220,91,181,32,180,13,251,165,137,212,5,68,67,176,
-            70,126,4,32,162,98,199,1,28,164,234,162,19,65,53,151,229,25,113,139,67,150,109,222,10,247,216,166,30,45,151,155,
-            173,148,170,59,194,241,38,32,213,213,74,137,76,36,114,83,28,180,60,190,180,148,130,46,87,141,200,48,71,18,224,46,
-            107,65,199,214,191,195,81,253,119,45,217,149,247,250,184,214,11,37,215,158,251,8,16,213,24,207,6,165,130,141,4,
-            177,195,169,67,223,199,90,150,123,74,4,146,160,80,5,110,11,83,34,155,137,60,40,82,200,42,75,12,70,242,192,171,20,
-            168,17,207,173,17,78,228,74,66,170,38,145,22,72,219,71,209,108,99,5,219,248,57,173,185,225,148,30,215,235,0,235,
-            187,203,123,216,213,248,144,27,105,69,61,246,99,78,98,41,131,101,168,23,30,0,58,93,157,51,122,222,194,179,111,151,
-            30,93,153,108,47,241,145,99,165,234,69,72,30,199,214,45,202,151,24,220,122,160,12,178,111,142,77,218,218,11,95,
-            100,5,233,226,74,205,144,166,182,168,152,248,5,236,241,137,253,36,5,47,79,144,218,64,220,146,169,245,170,201,115,
-            203,207,171,234,164,141,90,167,50,99,129,103,118,241,108,52,138,246,163,146,190,44,243,11,144,172,98,138,241,24,
-            77,194,52,38,190,180,24,19,99,85,130,3,219,185,76,148,152,172,122,202,65,1,77,64,50,183,222,231,234,20,234,32,193,
-            59,182,140,211,70,66,41,233,216,129,211,147,155,32,247,38,138,99,11,253,174,188,56,144,231,78,74,95,241,156,204,
-            67,89,134,198,55,231,102,115,162,45,39,227,170,0,141,241,128,115,145,66,251,167,57,21,56,243,187,134,67,65,51,61,
-            250,72,224,40,135,31,136,13,242,166,97,30,67,220,105,16,1,6,110,3,87,94,113,29,74,223,4,64,137,186,145,93,234,39,
-            97,228,233,64,23,59,181,216,69,230,85,96,20,193,159,144,30,200,3,115,11,101,48,64,45,158,196,132,68,94,42,149,37,
-            227,218,21,227,254,125,227,115,66,212,252,228,167,228,6,221,86,105,158,122,7,221,32,51,238,242,20,135,197,0,208,
-            112,94,212,124,143,62,50,50,208,246,83,179,251,184,168,33,182,157,24,88,193,28,116,231,234,153,169,195,252,217,
-            240,16,164,207,147,39,194,247,217,176,1,213,48,203,163,177,60,79,158,128,45,193,32,7,49,165,58,4,255,165,136,66,
-            239,16,28,255,13,59,60,17,154,105,242,6,76,243,92,143,70,54,13,243,4,248,230,113,30,141,242,126,225,253,165,55,
-            62,4,231,81,225,253,13,216,232,211,32,157,167,111,192,186,204,246,104,180,243,56,143,97,36,50,194,163,49,62,134,
-            69,140,166,105,184,202,15,193,58,54,200,168,215,19,97,222,128,209,128,125,107,214,71,239,128,25,235,9,168,223,26,
-            236,113,27,242,245,170,115,200,54,220,165,211,71,224,31,38,147,5,41,113,40,52,86,31,219,189,100,28,112,32,14,77,
-            194,24,90,32,160,236,142,217,230,92,218,3,124,237,42,117,111,65,201,222,140,70,47,135,105,148,66,24,242,52,137,
-            208,115,161,71,36,201,79,164,182,140,130,23,148,27,86,198,118,48,202,73,194,228,72,80,139,11,212,209,173,224,77,
-            218,186,77,99,50,26,186,201,17,10,211,106,157,79,25,56,203,17,122,239,90,63,183,222,108,196,237,189,107,189,171,
-            253,250,167,218,175,191,208,87,26,169,41,246,92,226,198,196,211,159,214,99,110,108,133,141,169,150,72,206,177,143,
-            78,50,45,35,43,159,100,217,188,109,211,134,55,155,17,33,88,62,7,62,88,146,154,65,247,220,64,201,219,183,27,107,
-            124,251,127,224,211,219,38,211,48,25,232,124,128,13,3,78,238,213,218,86,94,190,176,87,86,137,138,224,19,150,20,
-            249,10,212,112,221,153,228,99,79,57,89,116,24,9,209,144,135,193,249,100,112,241,204,81,57,210,73,18,28,156,144,
-            163,123,197,29,182,73,28,161,16,147,53,95,159,108,174,147,200,139,111,56,82,87,34,9,73,141,102,74,203,112,34,221,
-            197,145,132,14,234,184,109,211,27,148,121,231,0,196,148,141,68,155,184,105,128,117,249,56,96,37,194,38,184,219,
-            18,207,91,86,226,104,75,200,7,147,73,76,13,178,171,178,55,10,141,179,18,12,38,156,167,66,87,173,233,106,243,209,
-            71,107,58,173,249,118,119,7,31,177,125,3,17,138,171,251,137,87,96,187,87,55,87,176,216,132,117,81,247,173,110,161,
-            11,94,212,162,41,232,98,181,2,245,58,6,29,59,136,231,72,51,188,174,194,14,254,213,171,242,156,121,17,250,1,182,
-            39,14,81,113,126,209,119,30,167,229,92,36,89,78,95,204,25,89,167,30,38,230,192,84,65,42,172,225,222,241,19,121,
-            164,49,165,224,55,60,57,50,196,11,224,8,77,12,15,180,166,16,223,103,130,102,158,23,105,76,178,192,46,247,170,137,
-            203,208,132,109,60,68,228,191,244,28,53,174,195,227,210,136,182,145,214,67,31,138,95,105,176,195,137,196,161,1,
-            171,233,98,111,23,142,39,209,0,219,98,183,28,213,193,92,213,172,192,19,7,250,123,145,228,91,226,31,173,168,180,
-            173,226,82,71,68,36,19,243,92,10,64,67,171,182,125,238,44,81,137,128,200,196,250,129,226,208,206,85,136,244,164,
-            204,15,246,105,56,81,222,67,248,139,34,123,224,255,65,62,173,127,101,67,204,231,89,35,215,60,139,108,252,10,227,
-            57,60,96,104,128,161,40,20,10,132,206,230,152,147,78,109,196,42,161,35,170,5,2,32,250,207,97,31,98,122,202,203,
-            97,44,43,202,218,36,68,235,39,197,132,238,176,8,227,155,232,173,16,34,28,118,224,253,123,56,117,239,223,103,197,
-            4,123,29,55,6,42,160,207,98,255,35,228,21,121,242,202,10,139,111,81,127,33,74,96,115,148,54,10,57,28,113,135,138,
-            76,208,116,90,104,156,131,156,157,214,204,152,192,139,66,235,202,217,185,114,91,170,85,177,119,7,220,103,191,173,
-            239,138,144,148,12,94,230,78,240,111,189,180,217,146,167,157,85,74,30,199,248,57,129,200,66,165,45,116,137,136,
-            66,98,8,81,39,162,216,118,215,138,101,14,129,13,92,253,153,192,110,140,72,0,225,125,79,229,98,167,168,97,240,104,
-            51,144,59,9,80,101,122,126,62,33,3,65,244,124,31,177,239,42,230,177,79,156,166,221,222,142,0,19,197,34,171,216,
-            135,69,101,84,58,207,142,184,6,4,42,78,220,245,34,204,131,18,71,216,6,81,156,232,59,198,116,210,32,20,25,123,103,
-            244,51,49,45,109,200,163,33,246,59,81,0,41,250,243,145,200,118,156,184,59,98,155,248,88,203,245,114,160,84,232,
-            191,59,86,201,180,180,238,32,159,158,163,214,131,199,239,146,24,58,98,185,26,58,59,186,96,3,91,20,219,199,147,238,
-            198,179,172,2,217,34,115,223,157,203,224,30,108,178,87,235,32,95,43,177,214,159,29,97,180,37,9,0,221,3,200,107,
-            188,201,46,86,198,234,177,11,251,226,210,195,187,93,208,116,41,8,149,40,235,232,99,24,113,54,6,137,104,98,182,101,
-            166,87,228,167,248,2,25,234,57,161,25,190,240,107,196,149,210,219,221,102,139,65,152,25,94,107,211,31,165,164,68,
-            111,0,77,136,128,80,82,10,121,11,97,130,151,181,191,89,52,196,10,54,140,182,78,49,21,91,79,116,154,31,194,120,44,
-            116,176,167,146,30,112,82,104,136,70,25,45,38,74,60,188,139,90,175,27,153,163,113,41,236,193,35,77,227,102,19,70,
-            89,87,80,42,185,178,76,0,145,89,158,20,137,71,4,204,166,69,92,167,151,87,181,134,55,173,255,36,155,1,253,191,129,
-            8,148,31,132,213,64,216,146,200,55,134,3,27,191,162,49,227,207,124,93,89,65,216,120,132,242,50,113,168,135,217,
-            182,111,99,203,203,45,154,255,187,213,64,254,99,31,236,41,217,243,177,98,53,95,230,150,92,105,201,213,149,48,186,
-            173,14,160,253,40,244,108,248,120,226,60,27,62,136,46,55,13,92,111,91,111,132,86,155,144,61,79,158,141,74,197,51,
-            84,27,195,155,124,191,180,185,11,93,223,15,89,146,231,106,63,202,164,166,143,39,78,118,212,61,27,223,100,87,219,
-            115,209,163,241,156,213,145,36,207,253,253,82,229,207,59,241,246,253,16,38,123,247,246,163,76,110,251,120,210,20,
-            135,230,179,209,102,84,60,31,101,194,216,91,233,18,231,253,99,222,227,8,249,247,67,147,198,239,185,31,93,154,246,
-            143,167,77,203,245,251,108,244,105,185,108,159,139,76,43,206,215,58,106,181,160,248,99,18,173,181,128,239,132,118,
-            85,240,238,94,110,94,110,250,72,138,213,193,202,7,19,235,159,196,45,251,167,29,78,85,9,97,125,46,66,181,34,129,
-            27,2,104,255,152,18,168,0,255,205,137,147,226,50,173,48,11,121,186,92,9,220,104,138,241,221,139,128,177,225,163,
-            201,151,98,48,15,38,222,183,18,17,176,249,245,151,154,175,255,187,133,254,118,250,127,195,110,81,4,234,115,145,
-            185,142,8,222,26,251,250,199,228,193,146,246,13,195,175,49,202,113,181,211,96,10,64,192,150,39,29,32,233,181,151,
-            198,244,168,72,155,28,37,135,156,138,46,169,37,132,55,187,182,240,255,207,113,67,11,186,134,191,186,194,250,163,
-            246,145,169,8,221,67,67,121,34,191,95,164,48,118,115,119,135,131,232,65,9,56,29,183,196,145,84,184,194,61,99,69,
-            134,20,12,66,193,46,58,119,208,50,51,155,132,6,82,130,169,222,190,69,208,238,21,166,177,19,224,93,145,27,79,1,169,
-            118,44,214,187,173,118,194,24,31,224,212,124,10,120,155,61,133,59,193,221,207,141,248,132,144,54,58,5,119,130,155,
-            31,226,53,60,12,232,109,231,83,139,88,15,56,164,251,10,79,123,173,91,232,93,46,159,178,253,206,4,230,41,104,57,
-            90,237,169,80,64,215,244,3,16,176,223,165,250,148,203,191,210,55,237,147,45,94,57,33,30,176,254,189,221,11,79,137,
-            130,143,182,207,225,201,176,112,54,124,8,2,246,49,90,63,229,218,1,202,167,93,54,219,81,31,176,242,61,45,164,79,
-            185,248,191,24,179,233,147,173,95,140,117,15,64,128,188,11,248,166,24,16,104,159,18,5,101,163,208,3,240,112,136,
-            185,231,41,113,97,65,253,148,248,64,255,241,3,176,176,51,114,230,233,150,206,190,248,195,87,188,69,108,217,39,76,
-            96,47,224,245,67,1,37,116,61,122,75,48,59,40,64,136,137,42,247,216,9,47,10,231,241,210,74,64,61,9,115,122,88,186,
-            145,19,190,221,239,157,13,92,59,173,125,59,82,73,215,168,184,134,122,178,67,101,127,102,82,14,17,133,94,204,32,
-            147,231,242,42,60,87,57,53,9,78,208,254,124,204,221,108,5,215,79,146,20,247,49,164,64,201,86,77,114,122,6,196,202,
-            111,95,15,135,149,22,240,25,193,40,229,233,175,7,132,139,138,60,63,40,229,164,253,245,176,112,186,254,111,0,76,
-            135,42,238,53,3,51,197,160,168,244,155,1,227,158,15,175,122,127,29,14,198,237,126,51,92,139,36,13,255,129,193,50,
-            209,55,7,241,115,247,106,220,235,236,2,16,24,75,142,153,15,159,5,188,134,215,38,212,54,219,131,83,104,248,187,49,
-            105,101,200,139,85,239,230,82,25,210,65,51,18,238,181,171,64,134,213,139,79,219,214,110,22,219,176,58,33,175,216,
-            218,165,124,174,172,94,114,152,116,71,90,249,78,252,149,50,61,23,117,233,196,101,79,176,221,137,122,98,54,139,188,
-            185,73,23,198,21,139,115,59,18,27,239,24,233,136,109,203,169,174,117,82,204,95,76,90,74,160,31,46,134,176,0,140,
-            57,167,151,61,149,186,26,99,228,126,105,88,6,245,116,107,22,179,61,54,186,180,166,189,64,112,218,209,26,254,175,
-            218,0,22,168,43,172,251,151,19,231,237,27,12,79,127,251,203,142,96,62,196,195,110,106,229,138,97,165,244,252,120,
-            212,20,144,193,221,202,139,197,18,61,11,165,102,172,156,52,202,58,106,226,94,177,95,221,9,31,157,183,47,187,123,
-            204,224,97,14,98,78,193,169,19,213,113,105,11,170,239,177,196,122,228,18,192,135,245,104,61,180,49,231,14,25,143,
-            234,166,253,216,251,218,61,117,47,122,3,46,84,110,167,235,143,176,64,52,230,24,79,197,210,138,111,112,206,130,188,
-            45,236,225,67,144,229,248,51,37,52,71,130,91,162,5,121,173,178,110,146,213,94,146,254,147,201,158,11,10,224,170,
-            50,147,51,133,115,65,232,225,57,161,138,12,106,210,169,211,73,247,238,65,136,43,231,155,227,111,146,171,136,202,
-            59,72,133,88,70,30,103,199,228,180,131,136,140,73,144,201,232,19,124,83,129,73,0,85,202,61,122,217,70,201,208,184,
-            254,175,71,117,81,56,179,151,13,58,186,65,12,179,68,222,9,31,82,245,178,145,159,63,210,91,165,50,102,235,80,127,
-            213,29,117,175,62,119,221,209,101,187,211,117,187,159,187,3,183,247,209,61,239,157,158,118,7,219,119,130,19,146,
-            227,250,49,9,189,16,25,50,234,69,232,251,65,44,176,102,72,251,92,219,133,16,46,104,35,6,145,104,145,147,196,68,
-            83,232,66,89,246,179,98,54,11,167,33,218,169,117,16,177,154,208,92,10,130,20,204,25,135,39,143,74,138,32,104,146,
-            207,190,169,24,135,127,15,56,144,172,188,88,183,132,54,104,129,153,94,173,152,113,126,55,152,6,128,103,21,141,90,
-            170,141,190,227,30,194,127,38,169,157,12,215,102,163,231,48,41,29,35,66,129,122,2,75,100,152,229,105,144,83,158,
-            127,199,140,161,78,47,163,84,67,105,199,219,211,229,137,239,77,136,227,190,177,75,102,203,144,84,228,185,217,15,
-            145,172,45,113,92,1,123,5,192,42,172,51,251,216,17,55,29,21,203,184,102,156,14,253,112,200,80,0,15,80,64,221,88,
-            148,79,133,222,252,226,217,198,118,38,223,46,159,19,232,183,59,144,58,218,107,120,94,209,94,51,108,209,116,252,
-            112,201,111,9,247,208,118,118,87,145,80,167,242,196,72,77,18,101,174,57,22,178,155,18,7,68,79,137,79,57,20,169,
-            4,149,179,80,20,40,71,44,55,117,3,200,173,41,213,186,43,124,20,136,245,55,231,205,137,243,18,248,240,69,24,35,80,
-            47,121,106,121,80,39,133,10,55,58,122,153,41,103,136,226,94,105,190,164,166,3,74,14,152,99,255,4,120,251,74,202,
-            183,98,148,63,215,192,192,234,57,243,121,163,118,25,82,246,241,253,159,223,255,80,50,127,40,153,63,148,204,31,74,
-            230,15,37,243,135,146,249,67,201,252,161,100,254,80,50,127,40,153,223,157,146,185,33,234,206,162,224,110,14,11,
-            165,91,13,101,252,23,252,102,146,127,113,241,39,226,76,233,30,18,240,237,220,20,124,45,42,202,144,190,104,161,141,
-            115,132,186,105,120,23,68,217,113,169,28,238,52,136,44,165,148,244,209,102,253,110,209,48,163,37,123,108,155,243,
-            224,249,230,160,40,226,165,133,138,95,165,254,25,69,217,225,239,174,104,123,70,107,93,46,61,184,99,56,141,131,212,
-            248,209,74,33,151,227,11,176,166,40,30,17,220,68,74,109,14,176,36,39,142,170,227,100,107,242,24,197,200,76,142,
-            203,162,112,226,135,227,106,46,95,4,37,150,59,47,37,234,12,238,242,212,83,12,247,214,11,35,79,40,205,90,253,235,
-            173,75,70,21,121,235,146,249,199,230,245,166,200,28,190,243,197,34,205,227,249,19,135,237,214,248,94,96,92,208,
-            242,12,14,7,49,28,202,98,34,172,14,25,55,40,170,116,108,195,152,178,140,232,193,232,245,123,17,171,159,143,94,202,
-            124,247,47,143,21,21,18,59,218,188,90,171,210,236,21,114,47,204,64,171,70,160,233,253,58,14,186,41,171,119,196,
-            28,177,95,127,16,218,206,117,173,94,0,143,141,37,30,151,54,220,50,14,102,230,55,53,158,75,178,19,37,31,231,81,27,
-            75,129,196,174,222,12,34,177,165,149,227,111,35,35,156,49,99,132,146,195,75,117,222,220,3,6,77,178,246,169,250,
-            67,156,244,247,229,230,254,191,60,166,216,102,180,104,168,58,18,126,48,13,145,36,23,82,253,130,39,86,165,66,153,
-            204,45,99,219,209,203,24,147,141,203,200,176,211,6,20,132,141,132,57,91,34,50,212,42,245,154,54,197,145,126,247,
-            171,123,118,53,252,114,49,60,237,186,131,225,64,203,36,76,141,126,18,208,37,99,195,98,195,96,32,168,21,118,74,163,
-            143,46,187,157,222,199,158,17,186,120,138,69,18,39,112,207,42,230,160,72,225,53,209,6,202,211,116,209,183,125,255,
-            76,90,0,205,17,205,88,159,128,134,65,160,16,103,255,20,3,113,233,96,56,114,151,81,41,72,78,196,99,215,34,205,108,
-            131,26,220,178,52,227,14,114,107,94,162,165,100,241,226,212,249,20,179,103,144,113,46,255,202,156,141,136,61,65,
-            25,75,89,178,184,30,185,198,21,12,128,49,231,210,191,126,83,182,110,67,227,101,62,198,250,241,159,49,9,165,151,
-            39,123,221,216,170,173,171,98,75,183,39,44,226,236,23,149,90,6,166,190,167,145,237,28,61,106,13,135,53,51,194,127,
-            189,82,226,174,242,169,62,133,159,57,255,150,232,228,149,153,55,143,197,168,4,50,255,75,21,163,171,161,1,208,6,
-            6,20,143,43,129,44,82,61,76,101,11,202,185,232,229,25,6,215,132,83,141,84,201,248,181,81,4,26,164,141,124,199,80,
-            61,216,135,121,144,238,26,202,18,99,30,55,16,92,148,243,167,27,201,121,186,225,138,88,180,189,39,196,154,30,243,
-            201,208,167,71,124,134,133,63,49,66,57,3,216,142,177,62,70,9,37,30,164,234,222,187,70,156,97,227,199,13,168,14,
-            100,147,56,29,228,186,214,83,61,227,249,40,191,234,144,119,44,117,191,81,1,83,241,132,218,164,119,135,207,145,29,
-            58,7,220,79,159,177,109,253,248,84,10,121,114,95,183,157,164,214,111,65,164,228,45,11,43,111,200,8,38,111,58,13,
-            86,86,233,102,205,85,91,255,29,255,119,172,18,42,73,46,158,165,119,71,208,177,134,154,209,250,182,20,233,126,246,
-            85,72,113,239,253,87,161,23,33,40,222,181,8,204,54,24,86,28,101,155,75,168,135,149,45,125,198,109,135,130,222,146,
-            234,74,207,201,74,164,95,65,169,31,68,201,73,184,76,181,210,209,121,89,45,231,213,91,60,52,229,133,107,240,180,
-            170,15,242,221,171,38,211,155,185,48,179,252,222,220,207,202,8,103,223,150,32,66,2,132,120,235,81,83,41,32,130,
-            66,129,217,43,250,84,189,212,234,100,204,94,31,173,232,182,112,57,72,172,25,114,50,89,80,29,207,122,139,25,117,
-            111,143,58,189,158,233,31,191,162,15,40,117,167,222,148,42,76,147,238,64,163,162,253,178,200,155,6,235,95,158,183,
-            237,193,188,104,181,240,30,51,216,224,250,162,123,213,235,108,140,73,5,121,177,34,215,131,134,62,237,157,245,198,
-            35,123,208,125,198,115,174,169,100,89,70,196,118,116,76,238,119,16,219,176,184,34,153,70,208,4,220,48,105,205,82,
-            246,152,149,243,177,137,157,80,81,245,10,15,5,166,221,12,227,34,123,189,138,10,144,232,225,218,98,157,15,97,121,
-            25,188,68,58,122,217,125,105,198,110,0,173,55,232,244,175,65,134,237,247,70,99,235,40,58,86,230,79,36,101,62,125,
-            154,220,121,197,153,178,218,83,49,248,48,198,24,104,82,241,216,218,9,221,40,81,40,208,161,88,115,169,144,33,70,
-            49,4,85,210,127,255,126,20,228,61,201,15,218,0,110,247,235,86,112,131,187,167,7,151,76,130,219,1,238,222,237,4,
-            88,225,183,115,222,190,122,56,146,169,250,40,67,172,55,21,97,15,13,236,206,17,106,210,230,87,160,79,254,30,112,
-            145,200,227,103,219,139,239,112,105,143,216,55,56,171,238,231,118,223,29,159,15,175,71,237,193,233,200,29,117,47,
-            219,87,237,241,240,106,247,109,219,114,190,112,138,122,116,92,17,155,167,178,100,148,58,178,224,202,119,116,202,
-            209,38,78,206,75,83,207,8,141,197,25,28,226,204,92,92,234,86,19,180,169,150,68,190,176,236,244,222,57,18,138,158,
-            22,41,217,149,41,85,110,96,110,182,218,65,53,34,143,155,214,255,215,238,213,16,174,8,247,67,191,61,248,244,72,57,
-            3,208,194,234,167,70,139,103,228,55,180,47,170,221,182,20,86,173,196,162,116,146,122,113,22,121,226,237,197,179,
-            78,21,50,89,6,146,135,206,242,173,36,22,170,208,171,205,33,202,211,55,225,97,48,116,199,87,237,94,191,55,56,35,
-            156,116,71,251,75,44,61,180,168,122,185,170,118,165,19,88,227,156,129,229,66,114,210,96,153,224,19,98,50,184,218,
-            144,231,104,52,32,143,16,145,180,34,5,140,224,177,147,232,162,75,13,61,163,50,176,41,149,140,162,15,128,150,73,
-            137,13,35,225,208,35,149,114,206,243,146,148,103,242,170,138,145,87,12,31,70,242,104,52,118,124,72,146,40,128,77,
-            249,190,237,29,187,85,156,225,170,92,6,84,181,126,38,109,167,105,186,221,138,207,102,109,15,228,178,31,18,208,245,
-            208,209,246,29,237,69,203,185,82,245,63,76,245,143,119,173,119,40,185,80,241,143,214,183,181,78,149,16,245,80,163,
-            83,101,152,127,70,213,186,134,194,146,112,26,252,48,107,238,99,214,180,148,93,185,61,77,203,127,102,123,204,38,
-            209,36,17,58,235,127,240,163,237,252,136,48,244,8,70,68,253,255,37,136,9,144,27,140,195,229,191,48,15,82,24,120,
-            56,185,168,17,254,37,8,70,241,222,63,186,104,250,71,193,55,22,116,249,129,236,111,132,108,145,64,190,111,116,127,
-            27,84,172,239,198,201,170,31,220,6,209,23,138,182,171,67,5,191,160,210,33,178,159,199,110,187,51,238,125,110,143,
-            187,47,204,48,109,0,229,22,86,215,189,13,140,4,215,142,29,79,190,59,60,10,197,42,199,42,126,83,5,23,162,101,4,99,
-            37,164,244,52,69,43,146,209,66,58,251,216,194,15,244,63,105,45,155,96,117,250,195,81,215,253,210,27,156,14,191,
-            88,160,117,48,143,87,9,174,145,6,65,155,138,22,88,162,37,13,217,26,192,153,191,60,76,23,152,210,134,194,236,161,
-            23,37,115,103,146,220,89,230,40,1,127,233,197,30,50,203,163,175,199,216,52,187,207,48,130,20,75,95,56,71,140,214,
-            236,184,30,226,94,103,56,160,128,92,13,108,111,154,196,225,63,202,224,114,166,9,29,84,163,35,51,239,46,70,95,78,
-            240,210,26,127,114,48,220,44,219,130,151,139,246,215,222,69,121,154,11,244,230,84,231,25,89,59,131,81,240,17,210,
-            133,142,138,205,216,5,164,131,172,106,230,25,126,46,205,145,220,150,199,63,51,25,78,74,219,79,229,204,111,155,134,
-            237,13,206,246,29,56,148,128,124,182,95,211,200,229,237,82,53,211,105,34,54,53,138,101,144,158,133,69,118,69,34,
-            50,92,1,150,9,189,13,171,118,71,227,246,213,248,128,181,107,8,41,140,144,67,132,160,11,145,15,61,22,123,78,96,187,
-            24,226,254,16,80,147,149,198,39,3,74,135,244,153,64,29,157,151,78,241,104,145,172,27,14,177,33,37,244,98,210,131,
-            58,142,148,110,57,131,36,71,245,91,63,93,212,156,8,99,152,224,204,227,43,58,123,177,21,86,20,242,137,244,157,35,
-            242,96,227,159,116,204,65,15,202,197,73,205,233,150,96,61,91,150,210,59,237,151,206,184,31,237,196,184,48,17,21,
-            192,30,250,219,57,248,118,206,93,45,59,108,50,205,248,245,121,94,21,22,177,166,16,126,85,182,122,171,202,174,149,
-            163,238,4,246,30,131,199,214,119,45,165,14,134,190,41,42,26,37,19,47,82,222,239,85,26,204,194,59,117,249,101,65,
-            52,163,66,95,189,83,183,61,248,189,209,121,12,215,87,188,165,100,101,103,145,36,25,229,85,213,1,254,142,116,80,
-            215,159,172,72,222,146,168,58,150,71,24,148,158,225,75,97,70,222,103,238,116,188,225,70,142,41,48,191,28,166,79,
-            39,116,51,126,10,3,248,245,197,55,193,160,246,159,127,249,55,85,212,138,235,244,242,104,155,70,15,36,172,114,215,
-            119,239,246,236,74,85,169,42,125,97,90,46,86,85,237,202,127,237,81,134,119,251,195,91,253,48,201,142,104,44,35,
-            187,229,180,49,145,82,146,133,112,93,43,105,132,168,66,61,73,224,99,86,228,201,18,104,106,202,67,168,87,32,100,
-            200,197,163,202,47,52,98,245,50,66,234,90,109,9,251,216,27,106,137,98,32,135,49,135,168,110,194,95,23,148,145,100,
-            102,100,242,96,212,31,32,94,53,219,162,87,152,56,84,61,111,76,98,16,222,10,204,160,85,121,89,1,216,194,56,139,176,
-            226,5,209,98,156,241,127,232,119,50,190,193,29,162,166,86,144,222,142,138,18,188,234,13,206,55,131,213,105,235,
-            109,231,87,61,206,81,38,239,156,176,1,114,24,216,44,138,98,109,199,254,199,48,63,134,61,187,47,81,78,38,211,213,
-            22,174,100,64,235,35,77,106,2,195,175,78,49,220,161,251,177,125,221,31,219,79,47,132,109,112,242,87,162,93,142,
-            153,166,197,222,192,143,72,50,19,29,250,140,119,206,73,195,187,78,153,104,212,187,184,236,235,104,148,83,121,223,
-            134,210,22,166,12,147,225,188,52,41,36,76,65,97,29,118,144,122,186,60,142,138,69,74,34,46,166,41,187,164,252,134,
-            77,0,92,15,62,153,87,71,22,0,89,17,223,4,10,4,154,144,90,62,122,194,171,118,111,100,34,175,173,9,83,47,36,207,160,
-            158,144,91,62,126,133,227,246,216,4,145,88,19,170,71,135,69,152,107,41,218,163,148,234,24,96,194,158,68,90,56,13,
-            176,39,28,206,23,245,12,43,142,154,54,126,124,222,189,168,219,247,216,35,22,89,15,155,0,117,162,130,47,148,255,
-            26,58,231,232,28,199,20,116,26,128,175,151,40,147,124,6,50,247,42,229,66,61,42,76,169,113,253,95,56,220,18,147,
-            139,115,112,191,26,109,131,10,42,21,27,63,170,74,179,97,204,158,121,92,166,176,7,51,58,69,138,8,76,39,48,118,128,
-            65,241,89,16,160,108,88,223,170,1,107,118,232,150,70,90,156,200,32,39,138,41,40,241,94,69,205,43,108,234,8,178,
-            10,107,175,190,2,190,106,15,70,151,237,171,238,96,172,117,199,13,70,160,156,227,252,52,237,68,21,138,55,89,227,
-            81,150,76,131,105,128,219,185,194,199,153,34,7,239,38,145,113,251,3,58,207,63,119,175,70,230,129,203,72,210,15,
-            154,157,156,122,108,173,164,186,141,206,77,64,178,12,192,132,41,249,3,78,36,161,30,5,214,205,242,165,61,24,143,
-            40,10,197,118,205,243,248,244,114,152,89,186,225,232,178,240,181,23,179,122,130,182,28,122,68,176,240,210,215,56,
-            189,200,249,42,135,35,124,202,156,87,252,78,16,191,209,191,163,240,6,182,190,253,1,105,147,30,181,75,246,10,84,
-            14,138,140,223,40,232,76,144,162,98,199,222,109,56,103,242,162,112,9,234,64,194,0,190,8,41,85,171,87,175,7,237,
-            19,41,239,59,227,128,85,121,109,226,149,72,19,235,189,138,178,78,121,105,42,47,41,177,60,51,7,148,177,240,145,229,
-            84,103,17,23,1,237,233,149,40,203,35,184,186,73,226,165,190,13,45,6,20,114,60,225,9,129,32,183,33,94,107,206,128,
-            155,17,0,160,56,172,224,138,213,111,185,42,200,28,195,246,226,194,71,139,112,150,191,26,99,145,206,205,237,252,
-            60,234,92,13,205,171,143,235,242,42,41,125,57,91,157,204,179,197,108,10,204,36,154,120,105,85,35,210,221,166,94,
-            140,100,172,10,32,144,164,46,28,202,60,216,164,237,224,215,169,89,177,226,186,20,106,100,60,157,169,152,183,146,
-            213,43,219,126,64,177,74,196,118,140,165,162,250,204,107,239,53,89,15,35,173,85,141,85,30,160,8,180,180,92,114,
-            181,123,153,4,145,10,198,72,187,227,179,211,120,157,180,251,95,218,191,143,72,9,117,71,31,74,37,36,228,100,160,
-            197,200,172,252,68,149,16,80,101,128,117,189,213,133,230,80,75,173,222,241,123,26,68,182,132,160,28,133,45,160,
-            93,163,253,109,8,165,146,240,5,112,144,20,115,68,175,112,28,114,200,113,31,179,11,248,171,38,56,208,106,248,141,
-            174,142,181,50,106,121,184,92,113,116,152,28,193,146,73,137,131,149,174,227,16,89,140,199,143,159,240,97,22,206,
-            188,144,100,52,230,145,152,190,71,234,176,217,233,247,46,129,249,244,250,167,87,70,252,168,217,96,220,185,152,234,
-            218,131,6,126,67,207,18,139,204,132,87,79,188,233,205,156,197,35,54,16,166,1,241,90,73,44,16,155,124,58,252,179,
-            252,72,23,5,109,192,110,110,252,241,186,223,119,175,186,151,237,30,92,7,195,1,252,105,191,152,223,4,25,150,140,
-            239,51,57,182,46,200,49,74,201,79,189,117,101,243,116,65,113,14,80,162,215,206,244,210,67,83,9,119,67,160,233,125,
-            187,60,131,174,170,177,156,110,150,17,162,158,76,183,156,142,222,79,59,120,76,30,159,193,218,96,51,127,114,126,
-            166,253,179,151,207,111,242,103,5,165,46,34,84,81,96,32,70,167,83,186,5,42,35,140,197,94,106,246,119,187,10,41,
-            2,56,189,94,221,83,12,255,50,114,187,95,49,142,172,119,218,30,119,1,229,157,235,171,81,239,115,183,255,187,126,
-            181,105,133,113,137,217,62,120,61,198,11,25,180,126,116,6,142,147,215,31,211,100,201,203,59,58,102,123,211,58,73,
-            111,112,1,252,46,205,74,182,84,194,233,17,149,154,207,233,5,155,126,36,127,44,105,196,244,107,122,52,208,33,127,
-            167,99,12,195,21,105,6,231,34,66,184,178,105,16,211,171,157,132,46,194,172,152,52,221,195,180,214,15,253,97,231,
-            19,229,2,48,97,214,232,144,94,46,97,75,186,198,128,134,184,245,230,116,215,21,171,53,222,55,114,103,148,158,200,
-            163,20,242,50,171,126,195,203,204,41,201,17,180,16,170,123,34,57,1,212,240,116,215,230,74,216,224,238,146,57,13,
-            59,171,203,9,227,238,228,96,25,184,102,69,74,244,193,240,53,172,153,228,172,30,172,88,139,116,116,137,88,62,88,
-            38,241,140,194,98,151,104,131,195,124,2,188,40,37,198,49,45,10,126,223,115,199,37,30,152,210,165,69,162,90,104,
-            144,65,215,0,117,93,135,44,68,241,19,107,206,17,147,221,208,131,76,21,225,231,137,32,242,154,109,255,107,29,148,
-            105,1,168,113,109,132,19,170,121,206,97,147,211,212,203,22,42,142,90,90,134,24,157,14,106,117,114,31,148,10,60,
-            17,81,110,71,218,229,213,176,211,29,141,196,130,104,213,181,22,96,68,198,144,19,11,219,50,69,99,27,90,11,101,215,
-            78,116,230,6,50,127,96,221,28,116,19,113,120,170,178,67,82,188,239,5,254,134,35,223,225,100,122,102,253,110,115,
-            55,144,215,61,247,250,18,143,240,104,127,80,175,123,64,57,190,118,16,53,194,123,77,13,175,123,117,48,243,196,8,
-            66,61,224,13,181,232,146,36,202,195,85,37,51,0,86,27,114,225,104,123,171,64,231,5,104,231,57,198,97,163,115,132,
-            186,168,195,184,221,108,164,202,10,213,101,197,57,53,242,130,66,17,82,185,137,187,39,57,77,164,52,113,152,148,142,
-            56,209,148,76,192,229,153,146,89,57,171,28,178,16,93,217,8,232,118,29,68,145,122,3,193,34,72,26,176,80,5,63,207,
-            225,6,48,18,136,38,219,93,249,43,200,200,94,183,62,52,216,103,98,135,47,153,151,119,140,136,71,131,47,121,204,67,
-            65,17,62,202,142,85,142,248,209,70,61,211,195,225,30,187,237,121,70,146,216,119,18,75,246,216,119,146,89,98,12,
-            215,88,218,163,38,189,19,54,49,70,5,227,72,9,117,224,179,45,145,179,93,160,66,4,172,239,176,68,142,218,26,145,0,
-            141,203,143,253,195,120,65,169,0,55,146,14,214,64,140,98,62,220,220,46,66,89,61,16,229,179,160,87,128,255,228,8,
-            108,158,142,0,245,56,163,39,124,125,149,97,214,71,210,33,168,101,117,173,117,182,203,98,66,118,183,122,175,183,
-            232,119,164,140,169,162,82,158,24,234,232,134,242,116,116,154,124,69,130,167,148,63,136,28,201,54,186,4,13,44,96,
-            20,225,5,116,79,121,113,100,94,145,37,185,52,220,61,159,63,30,137,76,64,120,121,180,156,223,113,64,82,252,69,209,
-            244,124,95,240,225,81,222,173,80,140,15,52,52,119,87,185,59,100,30,87,154,170,229,55,225,194,165,116,95,217,142,
-            61,49,133,230,124,63,84,65,210,42,79,152,232,249,192,94,114,251,2,18,133,86,227,204,106,79,204,160,67,117,164,64,
-            164,10,217,66,43,110,218,109,112,242,154,234,234,44,140,52,62,165,252,147,156,31,27,97,132,107,174,181,5,171,40,
-            237,74,131,177,119,179,40,149,198,76,141,37,95,201,177,59,196,82,145,148,181,171,137,208,80,73,86,139,248,73,139,
-            56,22,101,104,171,69,11,116,168,187,67,6,194,246,155,163,92,120,211,67,6,129,230,56,134,0,245,63,56,230,255,192,
-            183,61,42,2,70,94,60,47,188,249,46,193,189,243,211,79,213,187,12,11,226,81,41,67,125,204,21,116,71,161,60,233,5,
-            126,165,106,108,232,44,31,170,138,159,234,94,251,230,70,213,103,45,207,88,42,154,245,192,105,75,99,212,206,205,
-            133,53,171,51,235,122,85,15,158,87,143,80,51,171,148,130,170,78,107,87,136,122,224,188,246,16,53,19,159,13,171,
-            115,74,101,166,7,78,39,189,107,102,82,21,204,203,179,89,133,128,30,56,163,53,66,205,172,84,106,169,58,169,169,191,
-            244,192,57,205,0,53,83,218,101,177,203,243,86,42,253,60,112,242,202,40,199,59,147,166,173,239,46,252,240,159,58,
-            112,224,135,199,246,143,229,177,109,190,196,153,128,95,75,160,76,146,158,2,81,196,180,111,217,111,255,235,255,1,
-            4,205,159,251
-        };
-
-    // ../xml/mdi.xml (17170 bytes)
-    const unsigned char mdi[1995] {
-            120,218,237,92,91,111,227,184,21,238,79,33,252,210,164,205,58,237,108,81,20,232,204,0,30,199,179,49,198,151,192,
-            86,38,51,125,81,25,139,182,137,72,164,150,164,34,103,209,31,223,115,72,81,150,109,57,241,46,242,144,1,248,50,177,
-            69,242,240,92,191,239,200,36,230,253,47,76,48,69,141,84,87,108,201,5,55,92,10,253,241,253,138,9,178,72,169,214,
-            31,58,87,114,241,149,179,178,151,231,29,194,51,186,98,31,58,229,230,179,162,25,235,16,243,148,179,157,25,31,223,
-            115,177,102,138,27,237,151,143,168,88,21,176,138,204,153,49,92,172,116,231,242,112,82,185,25,39,252,142,139,68,
-            150,109,195,110,132,12,30,153,48,118,125,174,100,206,148,121,34,2,212,248,208,177,211,98,209,80,73,27,5,123,117,
-            200,154,165,249,135,78,180,102,118,38,145,75,98,224,179,157,223,237,124,220,42,254,137,106,246,254,210,139,61,216,
-            192,112,147,238,201,142,153,94,208,156,233,230,30,134,109,12,49,146,36,92,231,41,125,34,82,216,237,150,232,172,
-            63,107,98,165,144,123,170,186,45,54,60,128,141,126,7,153,99,24,192,153,238,67,53,163,119,59,244,155,245,21,163,
-            134,17,74,202,77,175,224,227,171,225,13,85,224,27,23,149,203,189,117,48,220,178,14,108,63,92,119,220,3,218,60,109,
-            61,112,15,134,112,109,246,21,4,161,131,207,189,219,81,20,127,158,245,198,131,120,30,125,31,13,252,214,54,189,88,
-            66,168,134,205,199,195,201,112,60,252,207,32,254,52,253,70,254,135,15,122,223,118,31,204,6,115,247,117,118,53,152,
-            217,39,243,239,243,104,48,142,199,131,201,173,253,222,239,221,68,195,233,196,125,30,77,231,219,181,253,209,240,
-            38,238,95,15,71,87,179,193,228,192,29,245,74,175,217,77,1,153,70,9,68,211,206,106,6,173,219,182,218,239,85,91,230,
-            162,109,101,164,82,67,132,229,230,69,41,206,67,209,116,58,138,239,134,147,171,233,93,29,34,90,104,134,178,236,82,
-            82,114,179,134,47,58,163,105,234,18,8,242,7,115,236,30,210,216,70,51,249,247,118,39,146,72,88,43,164,33,52,207,
-            25,76,228,78,13,67,245,3,174,43,68,194,20,113,229,164,137,84,228,151,232,203,95,143,171,55,153,198,81,111,254,229,
-            83,111,182,155,64,160,30,248,9,4,171,146,131,189,66,42,80,175,210,224,190,48,132,155,63,164,8,57,131,5,48,103,77,
-            173,136,146,131,201,25,96,82,198,127,99,104,50,10,72,152,126,48,50,135,65,11,9,187,114,202,53,95,172,73,6,149,167,
-            25,203,8,20,42,128,79,189,20,252,170,80,243,4,190,21,26,119,200,248,106,109,208,147,247,128,77,204,186,21,38,193,
-            48,215,196,38,60,132,49,125,178,49,144,96,214,94,222,218,25,231,93,50,20,48,2,250,95,184,56,164,116,69,96,189,98,
-            58,103,11,8,143,147,193,151,206,68,24,1,235,82,70,181,33,143,160,15,58,253,93,247,93,165,22,243,118,101,84,0,102,
-            42,162,139,60,151,10,242,51,158,12,162,248,110,12,53,213,139,160,178,190,64,134,87,161,33,107,46,76,151,92,83,244,
-            55,97,203,37,236,90,249,197,134,136,64,114,154,37,132,72,31,15,244,231,209,180,23,197,211,73,124,211,131,146,137,
-            154,152,230,211,16,98,65,211,18,211,252,158,217,236,134,32,0,156,34,74,231,22,68,200,89,33,82,254,192,176,84,163,
-            222,119,148,22,77,111,192,63,189,74,70,149,174,46,165,27,62,206,10,240,197,154,62,34,46,9,41,126,154,220,142,70,
-            149,204,227,26,207,175,123,55,131,43,175,104,157,0,123,162,65,8,104,157,202,18,182,133,224,218,77,192,39,28,28,
-            187,6,240,38,139,53,38,72,173,146,37,169,185,29,201,24,196,60,105,219,127,216,159,78,32,5,246,170,191,81,131,124,
-            33,5,100,108,66,206,124,242,38,224,133,58,215,33,27,218,196,122,4,60,64,149,173,224,140,110,156,184,211,165,29,
-            193,41,47,233,36,168,242,73,239,229,12,19,136,12,95,64,197,131,75,107,127,156,160,83,163,120,218,116,242,149,126,
-            138,78,59,244,208,34,12,170,15,68,209,123,228,91,169,176,22,168,146,197,78,141,181,137,109,36,174,23,58,55,21,145,
-            187,124,71,24,118,101,229,164,232,11,196,26,120,172,209,23,173,213,212,186,209,150,204,90,180,215,79,218,0,126,
-            101,76,20,109,139,191,206,251,179,233,104,228,23,222,238,66,22,4,133,9,107,57,69,132,113,145,210,11,37,211,212,
-            183,30,123,242,174,79,150,183,150,138,255,38,133,217,151,216,202,252,205,110,226,18,26,202,253,174,178,0,251,204,
-            16,59,202,186,177,180,127,180,111,51,202,77,156,84,211,78,109,44,95,175,49,220,106,247,66,111,152,37,60,254,189,
-            251,108,27,207,63,208,139,178,12,17,157,197,64,133,11,197,93,171,216,186,107,15,80,14,200,131,52,38,162,2,37,242,
-            171,37,227,74,18,146,18,16,68,151,68,46,234,40,195,33,62,64,125,213,203,2,156,85,20,190,228,169,253,7,9,19,187,
-            64,20,233,75,223,142,105,150,2,5,73,165,187,164,37,36,181,250,78,196,17,205,5,246,13,176,80,113,212,175,185,165,
-            46,128,226,129,235,254,210,53,27,243,156,252,132,43,171,198,211,241,144,36,108,73,139,20,28,228,167,250,14,0,188,
-            177,111,203,115,91,65,219,207,132,62,26,135,230,86,86,106,61,159,156,121,115,192,152,243,103,247,128,74,120,38,
-            193,122,46,189,108,235,4,65,47,210,4,99,87,8,254,107,225,172,161,100,197,225,245,201,46,198,136,249,194,186,64,
-            123,19,59,101,69,17,215,48,246,180,14,236,35,164,36,246,50,41,123,164,194,190,219,80,164,102,0,149,34,133,54,206,
-            75,121,86,115,148,241,26,170,163,156,23,54,210,252,190,241,150,34,101,186,251,118,86,165,59,54,136,59,153,221,104,
-            16,49,203,19,78,83,185,194,162,252,251,73,24,54,131,174,51,130,152,246,141,74,107,40,83,240,16,223,7,23,246,225,
-            91,1,180,166,170,1,211,2,166,5,76,11,152,214,138,105,243,60,229,248,78,92,253,40,183,253,229,111,127,224,173,32,
-            219,174,94,1,219,2,182,5,108,11,216,214,142,109,248,94,155,28,116,108,122,193,133,129,42,162,111,8,212,118,52,13,
-            160,22,64,45,128,90,0,181,86,80,59,128,179,114,179,125,244,86,240,204,107,20,126,82,11,104,22,208,44,160,217,1,
-            154,97,189,190,112,36,128,58,191,210,61,147,87,66,183,90,233,19,96,237,249,156,107,1,53,155,12,110,43,116,234,177,
-            136,233,156,165,233,98,205,22,15,47,92,210,112,103,57,73,125,160,95,40,60,104,77,159,220,145,15,130,149,59,114,
-            118,232,4,14,155,223,145,179,114,13,33,82,133,16,152,202,187,103,238,255,194,211,123,204,1,117,126,225,206,193,
-            137,157,93,104,156,139,95,127,182,135,219,229,102,58,255,102,15,203,105,146,216,107,70,23,149,116,197,126,45,0,
-            45,180,203,87,227,239,209,44,164,48,74,166,100,77,221,25,40,240,217,32,158,13,251,215,239,170,131,41,205,160,212,
-            202,53,86,191,21,222,34,168,85,198,248,118,20,13,71,195,201,192,201,57,60,17,91,41,154,101,84,121,23,13,172,199,
-            52,169,30,19,235,101,52,142,111,109,193,208,216,16,212,163,93,18,92,219,125,141,59,69,149,106,205,211,73,252,109,
-            125,215,146,29,199,85,172,107,15,254,53,30,250,163,187,50,169,44,34,10,242,207,127,124,249,100,11,12,5,84,12,92,
-            201,169,249,26,157,128,49,91,9,88,150,156,126,157,194,251,241,121,109,183,23,63,254,134,33,254,25,254,180,25,240,
-            59,212,104,56,153,225,45,185,90,161,193,215,40,142,6,223,162,206,22,2,251,18,210,88,36,246,54,157,215,179,186,5,
-            136,87,33,48,195,182,153,98,47,72,128,66,19,9,4,197,124,248,65,39,183,205,222,189,144,213,49,49,206,112,109,63,
-            224,37,62,47,152,252,132,51,173,65,190,72,146,130,85,61,3,50,71,94,24,116,209,66,102,48,121,169,100,102,133,130,
-            181,88,141,120,251,132,165,75,114,134,156,198,54,20,200,136,93,224,85,27,224,128,175,52,45,216,217,57,74,92,64,
-            38,176,164,123,110,29,213,198,56,173,7,56,111,158,114,154,90,7,230,9,204,19,152,39,48,79,96,158,31,139,121,78,60,
-            102,251,239,155,39,35,175,111,32,162,64,68,129,136,2,17,5,34,250,193,136,232,244,51,209,55,74,64,59,6,4,26,10,52,
-            20,104,40,208,80,160,161,31,139,134,78,59,197,126,155,12,20,184,39,112,79,224,158,192,61,129,123,126,16,238,185,
-            108,253,191,47,254,244,127,52,75,214,64
-        };
-
-    // ../xml/pickers.xml (10219 bytes)
-    const unsigned char pickers[2480] {
-            120,218,221,90,91,111,26,201,18,62,63,165,197,195,73,44,217,56,251,122,226,88,194,128,19,20,108,16,224,56,43,173,
-            132,154,153,6,90,158,153,158,237,238,49,102,149,31,127,170,170,123,46,192,96,19,199,155,120,247,13,207,244,165,
-            174,223,87,85,227,179,143,34,17,154,91,165,59,98,46,19,105,165,74,204,249,217,66,36,44,136,184,49,31,26,171,135,
-            75,25,137,161,12,238,132,110,91,29,53,152,140,249,66,124,104,204,139,199,13,102,215,41,60,89,201,112,33,108,227,
-            252,76,38,75,161,165,53,229,25,183,50,9,213,170,113,186,251,206,189,97,221,123,145,88,83,183,192,200,191,132,158,
-            6,75,25,133,248,58,213,42,21,218,174,89,194,99,184,243,158,235,41,254,202,101,48,86,203,100,209,56,143,167,165,
-            124,103,167,249,166,157,237,164,50,143,166,41,183,203,252,8,250,189,123,83,44,140,1,197,55,47,154,10,19,240,84,
-            152,154,245,43,16,56,224,58,60,120,131,177,235,168,56,126,38,109,36,13,26,83,165,232,148,252,208,135,203,254,112,
-            122,51,238,78,39,221,175,147,246,100,212,111,176,165,136,210,15,141,182,22,220,10,195,56,179,226,193,178,64,37,
-            86,171,136,89,197,236,82,176,72,204,45,83,115,250,157,146,81,216,44,179,22,206,93,45,101,176,100,18,204,173,226,
-            52,18,86,68,107,22,243,4,52,13,217,108,77,27,182,67,128,241,36,244,251,2,158,176,153,96,153,41,87,195,111,141,215,
-            154,84,4,114,190,6,129,208,160,236,173,17,130,141,133,29,194,31,71,77,54,129,149,27,130,130,4,60,179,42,230,86,
-            6,60,2,33,204,58,9,150,90,37,224,126,184,77,194,17,78,226,55,134,221,243,40,19,77,118,99,4,155,103,73,64,65,203,
-            66,12,96,88,42,65,167,7,39,236,5,135,21,32,74,172,66,148,196,110,221,217,68,39,212,152,119,48,236,94,239,154,213,
-            155,205,233,13,18,170,149,217,212,87,68,34,176,176,16,3,15,31,128,115,147,125,87,140,91,95,186,47,112,133,225,247,
-            98,175,22,95,186,163,219,81,111,210,157,14,71,131,171,225,164,184,206,185,12,220,61,35,123,145,105,75,169,152,74,
-            162,245,255,24,55,119,104,166,185,212,232,17,56,218,7,18,137,50,19,115,165,133,23,7,130,218,75,180,79,146,203,94,
-            191,59,189,186,25,79,166,221,175,189,241,33,130,160,7,188,32,120,169,187,8,150,144,222,113,102,44,110,132,237,226,
-            1,114,4,5,120,236,250,246,167,214,245,199,238,180,211,27,21,55,47,121,178,128,155,51,173,1,117,216,74,233,59,60,
-            36,148,26,174,81,122,13,87,51,193,193,7,164,45,93,234,117,133,23,1,109,222,235,216,171,86,191,200,73,12,80,19,131,
-            35,225,148,123,161,13,46,246,73,152,135,61,41,205,221,42,246,223,63,51,101,223,55,155,77,247,35,79,81,153,24,43,
-            120,152,111,77,20,248,36,95,124,161,33,72,132,95,175,18,146,107,23,36,190,149,102,253,86,235,147,71,32,114,174,
-            130,204,20,176,164,84,148,107,119,187,68,150,88,10,136,217,240,24,36,35,12,201,181,2,109,102,104,53,139,129,3,102,
-            21,242,94,176,59,177,158,41,128,68,208,40,205,192,238,120,0,33,18,39,63,64,80,197,136,3,16,116,224,225,128,210,
-            34,108,54,206,223,85,165,19,72,20,133,201,187,95,38,164,202,176,215,254,220,29,121,87,119,26,155,228,213,145,218,
-            225,1,145,76,46,190,103,62,12,188,92,14,114,183,243,175,75,188,138,235,29,178,84,93,39,192,117,176,62,51,24,59,
-            248,194,187,75,21,207,170,248,70,248,183,235,153,247,224,78,11,185,188,228,214,157,143,86,36,216,130,3,157,174,
-            206,34,112,63,38,4,147,243,66,84,64,66,103,72,73,144,40,193,11,162,185,104,238,36,134,3,96,216,88,235,122,182,226,
-            134,45,192,61,201,17,5,245,41,144,255,86,5,80,24,112,163,0,8,243,167,175,147,255,11,241,126,13,253,31,198,230,0,
-            74,195,105,167,123,217,186,233,79,166,227,201,239,253,130,21,144,32,129,210,120,22,89,70,103,161,151,243,13,189,
-            81,213,129,68,199,238,77,53,180,234,32,106,103,209,79,41,31,54,226,231,223,92,61,212,120,231,64,150,47,200,157,
-            146,188,72,223,156,146,164,48,77,16,236,227,228,115,161,50,143,86,124,13,231,133,161,113,176,49,143,248,2,228,183,
-            66,39,100,2,72,107,105,89,168,224,82,192,24,102,178,52,85,26,192,2,82,139,207,140,72,2,177,87,133,31,165,204,242,
-            241,33,188,73,87,190,14,226,220,205,199,127,50,51,162,54,127,15,49,110,59,248,133,216,113,7,158,254,110,122,44,
-            245,72,9,89,246,16,224,37,136,89,215,2,23,143,95,105,11,92,200,119,0,7,226,226,66,13,210,184,142,5,101,50,77,21,
-            128,204,20,101,202,151,103,178,140,30,0,105,23,34,176,84,198,89,204,104,57,195,229,14,121,29,228,97,49,15,161,144,
-            251,234,36,88,42,128,36,70,66,108,134,245,182,4,252,225,96,9,248,195,243,36,112,4,147,179,175,219,3,65,244,219,
-            187,119,77,118,93,196,227,76,46,104,181,33,30,211,226,207,12,130,9,32,41,82,196,149,177,136,49,174,144,237,218,
-            195,27,102,101,12,57,160,0,180,240,86,74,97,68,53,124,141,15,32,205,67,129,126,123,15,135,103,230,216,17,32,225,
-            248,76,4,60,243,33,79,137,184,228,78,63,15,163,21,182,164,154,21,69,66,93,45,240,95,182,88,110,83,122,94,136,94,
-            79,54,83,237,232,24,168,225,13,18,212,66,41,72,231,80,112,60,26,19,8,116,146,177,180,121,53,144,219,21,111,114,
-            102,37,160,88,102,11,127,59,144,14,81,78,204,239,176,93,3,86,0,203,26,128,216,115,48,225,35,190,61,112,2,178,45,
-            249,207,25,129,108,64,192,247,22,49,100,170,188,136,25,123,200,196,35,95,243,40,4,237,124,57,184,158,116,186,227,
-            246,180,53,158,246,91,23,221,194,216,159,133,72,93,24,70,124,38,162,220,178,222,164,89,26,58,6,65,97,243,168,156,
-            243,64,208,233,100,189,252,41,69,80,147,117,17,154,33,7,21,145,131,227,229,9,228,140,97,215,98,197,70,96,13,48,
-            179,138,66,140,82,0,243,192,29,77,209,247,219,59,79,227,115,173,226,226,220,16,178,71,45,142,29,227,58,121,42,226,
-            190,85,80,87,172,0,100,105,124,145,0,254,107,113,47,85,102,220,251,163,82,242,90,81,142,203,75,209,140,123,205,
-            7,97,138,22,4,51,142,54,205,7,14,115,214,243,21,85,84,97,82,178,10,248,42,212,124,181,207,194,190,207,175,117,209,
-            183,125,151,63,209,71,195,218,253,229,66,17,254,135,215,10,166,226,227,23,237,161,183,1,224,133,171,4,217,132,120,
-            132,186,64,45,32,227,248,44,18,123,235,130,182,138,84,86,215,27,7,149,23,61,16,255,201,250,192,157,196,190,160,
-            4,56,142,175,43,3,138,26,226,252,108,9,240,92,210,191,228,142,172,79,243,29,63,177,198,168,106,250,8,180,187,101,
-            101,125,209,246,127,111,81,182,47,70,152,91,222,124,118,95,221,238,255,138,62,119,59,28,190,151,37,188,214,175,
-            150,17,200,170,227,79,131,219,77,44,27,47,243,65,181,83,0,111,249,52,185,234,187,182,229,109,171,117,113,209,110,
-            31,97,63,234,223,123,155,122,36,174,116,105,137,242,15,33,145,65,207,163,199,133,104,245,135,159,90,185,16,45,215,
-            72,151,51,105,149,242,64,66,216,20,136,131,87,159,16,195,128,221,223,138,249,28,23,66,239,149,97,229,229,155,107,
-            55,74,25,140,191,2,47,83,70,61,6,152,237,65,127,112,179,191,195,170,70,195,119,55,88,222,82,207,192,205,109,71,
-            230,168,185,147,18,213,90,246,135,81,211,185,234,41,27,221,140,70,93,32,164,151,182,213,46,133,150,129,232,186,
-            85,44,5,32,0,141,130,154,122,163,46,201,163,189,93,156,65,170,226,124,195,224,76,195,225,166,217,209,110,71,183,
-            78,175,213,31,124,156,182,91,215,237,110,191,255,189,202,85,76,139,80,17,136,200,28,42,57,59,68,244,186,161,46,
-            28,87,55,213,133,199,233,97,61,45,158,128,117,209,129,172,245,83,135,191,133,114,63,220,110,116,0,109,134,189,154,
-            15,130,213,73,148,162,46,41,134,39,8,245,17,52,115,92,67,253,166,82,104,133,86,9,102,167,175,87,83,153,156,248,
-            141,39,145,132,246,136,107,237,7,128,46,164,33,102,67,121,47,195,12,88,144,106,86,36,28,149,160,129,144,24,32,223,
-            138,105,112,101,170,87,178,202,2,99,10,202,99,63,54,171,157,183,13,167,157,209,96,216,25,220,62,161,85,189,74,39,
-            164,82,202,181,117,5,183,35,184,106,248,150,31,42,81,131,199,197,134,20,5,184,61,109,171,64,113,144,144,16,249,
-            113,217,17,251,219,0,35,55,163,223,115,241,47,149,14,64,250,80,154,52,226,235,98,84,8,70,203,116,193,0,121,63,79,
-            86,69,106,226,208,232,223,122,231,217,82,196,234,214,64,101,81,136,196,237,143,198,121,30,96,44,168,112,12,231,
-            165,96,20,162,154,154,11,180,128,142,2,218,94,235,250,124,47,131,89,3,215,197,207,182,72,9,117,123,108,211,234,
-            247,193,171,131,235,226,51,194,173,131,139,252,182,227,13,22,169,249,196,140,162,8,156,33,83,83,68,208,238,244,
-            113,140,92,26,76,90,118,178,161,245,201,214,209,52,157,198,81,133,81,177,168,156,244,210,225,224,167,181,79,68,
-            50,25,223,187,151,19,109,205,132,169,94,156,207,130,242,9,55,120,219,186,250,165,164,151,2,12,124,205,224,17,150,
-            170,134,82,106,255,57,166,76,50,6,104,46,128,190,180,107,36,170,82,127,219,142,232,71,224,42,201,162,104,138,204,
-            190,5,119,94,241,222,156,109,134,64,105,98,35,172,31,67,83,51,76,179,103,178,135,118,51,80,31,218,37,197,230,166,
-            195,143,7,201,27,11,110,188,23,149,128,240,37,102,73,60,116,182,52,142,128,120,96,51,42,82,169,216,117,150,186,
-            26,223,30,51,50,1,6,78,181,24,198,127,148,0,7,107,108,104,168,236,206,251,112,55,118,43,234,110,99,81,244,82,86,
-            15,119,69,133,92,41,96,142,201,5,114,145,40,44,93,10,227,55,255,72,254,72,160,228,129,142,110,125,236,75,36,39,
-            136,136,83,176,50,66,112,89,220,47,115,129,40,250,37,213,166,149,116,64,137,168,110,151,56,136,175,45,125,58,173,
-            73,183,166,212,65,214,124,110,137,83,249,156,178,89,16,238,35,121,164,231,26,146,199,97,100,250,138,7,215,182,16,
-            251,135,233,123,178,139,16,69,216,38,42,31,179,186,92,129,76,214,162,232,149,16,17,182,45,232,242,183,60,243,241,
-            6,97,210,187,250,21,17,112,90,251,79,125,255,249,63,151,2,47,222
-        };
-
-    // ../xml/project.xml (6107 bytes)
-    const unsigned char project[1659] {
-            120,218,237,88,77,111,219,56,16,221,159,66,228,210,22,77,157,238,61,45,80,36,105,55,69,191,208,166,187,237,73,160,
-            165,145,205,134,34,5,146,138,237,254,250,125,67,74,178,21,203,118,130,166,216,203,230,16,88,212,112,102,56,111,
-            230,205,80,167,111,200,144,147,193,186,115,42,149,81,65,89,227,95,158,206,200,136,92,75,239,95,28,125,114,246,7,
-            229,225,72,132,85,77,47,142,234,238,81,85,114,182,241,252,242,84,153,57,57,21,124,183,241,236,233,211,163,147,237,
-            229,197,242,211,42,204,173,25,127,247,185,153,174,198,222,92,47,150,175,173,11,78,154,29,111,223,124,220,241,226,
-            93,35,223,94,94,237,120,249,182,209,74,238,120,119,133,243,126,201,157,170,195,152,192,183,207,103,188,140,227,
-            215,228,194,74,24,89,33,26,185,45,40,171,29,149,228,200,228,212,5,205,214,28,215,35,49,39,93,191,56,250,82,83,174,
-            202,149,8,115,18,188,65,172,108,35,210,38,17,172,152,37,68,104,34,174,230,10,246,164,17,178,44,17,99,81,80,41,27,
-            29,132,167,16,148,153,121,81,90,39,110,164,83,114,170,41,122,224,143,227,179,109,188,136,96,74,45,190,94,10,31,
-            160,14,175,164,41,162,81,44,21,202,215,90,174,32,21,87,222,219,252,186,169,69,45,13,233,9,176,76,14,183,135,106,
-            129,28,172,173,49,28,44,119,240,13,22,55,128,27,172,39,200,6,75,107,176,6,203,61,76,131,213,33,64,131,87,9,29,56,
-            126,122,210,33,180,133,85,23,231,76,75,51,107,144,204,190,131,107,170,130,86,62,140,225,5,29,51,39,171,10,225,23,
-            253,190,8,96,165,102,243,32,22,210,4,6,241,70,209,66,0,157,206,136,40,157,173,160,1,128,182,21,195,240,182,248,
-            175,19,166,215,41,228,212,222,144,88,40,173,133,212,11,185,242,98,138,197,27,169,116,4,123,49,39,51,80,39,240,83,
-            91,89,80,241,95,226,55,14,212,14,84,127,17,63,233,66,86,40,135,179,91,183,234,233,73,134,121,135,27,199,183,23,
-            64,164,77,144,40,10,0,7,184,92,226,47,47,30,215,102,118,44,84,110,143,197,178,174,142,5,133,124,242,4,33,156,156,
-            236,49,93,160,176,236,44,107,80,98,235,164,177,86,119,150,255,97,116,242,57,229,215,84,28,195,135,138,140,103,98,
-            77,120,118,101,140,52,105,60,251,147,212,137,168,110,34,190,35,153,184,232,67,227,140,64,68,144,69,182,44,7,66,
-            177,240,73,230,115,212,111,161,110,84,209,160,208,123,51,226,217,179,148,26,63,26,31,201,194,199,212,237,204,242,
-            94,131,236,92,187,133,227,254,185,231,180,202,4,114,70,50,60,82,171,159,52,122,98,39,107,240,140,139,180,4,82,145,
-            34,123,252,68,84,50,119,22,218,159,239,209,206,251,65,153,22,167,32,55,78,152,177,80,152,118,17,136,184,36,58,249,
-            20,67,138,103,98,128,105,25,158,121,62,85,80,168,30,22,221,170,6,99,13,117,138,63,88,225,155,186,70,126,239,213,
-            112,59,59,23,203,47,170,170,53,253,133,183,159,122,207,147,202,175,240,102,236,61,123,218,122,125,15,59,172,225,
-            12,210,206,106,77,110,183,189,221,114,119,179,203,65,217,151,1,69,108,106,106,185,230,200,132,53,211,100,230,169,
-            82,157,59,31,235,148,38,162,147,103,251,178,174,245,10,252,133,24,131,195,68,142,180,4,25,170,34,82,32,252,231,
-            108,103,118,43,192,94,93,71,186,60,23,23,133,66,229,182,137,63,25,233,182,112,203,55,229,189,220,234,228,215,110,
-            201,18,217,253,144,94,217,214,86,150,219,10,21,54,206,16,175,138,66,120,91,145,160,37,250,176,145,45,69,165,13,
-            236,28,91,235,154,71,17,219,196,237,58,58,193,235,193,164,86,90,29,19,163,157,204,186,199,100,188,125,218,30,100,
-            94,199,23,2,92,43,62,222,144,115,72,20,63,54,240,180,114,221,248,118,71,97,110,40,119,18,5,227,15,229,110,69,21,
-            109,143,244,16,229,77,122,96,33,102,7,14,91,58,42,194,85,173,50,164,92,229,247,100,246,255,3,219,72,195,31,105,
-            236,187,102,128,223,218,240,183,50,220,55,211,108,111,150,111,8,252,182,12,218,242,234,178,74,195,99,235,145,170,
-            54,103,201,246,105,203,155,169,244,148,149,74,247,41,151,126,175,253,225,130,228,181,232,23,178,12,236,196,236,
-            137,249,129,61,164,106,74,137,152,210,24,163,76,242,54,61,238,73,248,58,230,193,94,203,109,129,223,211,248,65,203,
-            14,169,182,215,110,228,138,135,182,10,250,206,208,243,48,192,140,242,240,101,185,158,211,210,64,197,10,69,33,131,
-            20,210,57,20,92,28,217,250,62,208,50,243,156,36,147,22,59,43,164,71,157,138,100,227,192,172,35,155,96,51,40,58,
-            228,73,224,249,145,71,124,2,35,70,182,193,38,182,146,188,139,102,185,129,197,142,142,158,143,1,54,180,119,5,88,
-            168,48,170,229,136,218,106,203,237,148,169,226,29,218,227,193,110,210,133,59,165,84,159,221,184,27,85,178,238,14,
-            16,133,90,137,237,20,31,136,38,161,147,17,75,184,106,99,20,93,151,116,255,156,54,134,248,176,165,29,180,153,241,
-            175,91,21,253,178,202,226,134,67,243,236,141,236,185,0,207,67,166,87,148,38,102,211,224,120,60,125,227,114,167,
-            49,83,16,194,93,240,69,44,44,136,175,95,108,71,0,34,180,108,30,161,159,63,63,136,61,136,221,133,195,232,171,246,
-            166,16,197,219,255,236,80,178,216,182,128,90,162,101,133,118,48,62,115,20,111,153,141,201,153,85,15,228,33,166,
-            189,204,207,237,189,61,145,184,143,144,224,157,173,43,143,213,204,160,70,81,147,165,88,31,16,119,81,243,40,116,
-            106,158,28,112,70,245,229,192,191,198,112,136,182,30,161,226,11,28,152,151,153,154,23,203,203,243,236,213,135,239,
-            155,154,35,22,253,240,124,241,247,85,118,117,249,254,226,243,209,173,76,187,96,177,158,121,214,40,194,152,12,125,
-            193,123,74,87,249,141,88,115,47,120,212,78,46,147,209,92,62,7,113,244,137,204,44,146,165,47,9,233,128,235,133,109,
-            72,154,80,55,225,23,58,66,164,172,245,13,44,70,168,161,140,151,247,214,121,244,105,111,83,221,148,120,168,174,154,
-            116,226,48,254,176,115,157,214,214,57,190,194,12,226,180,41,116,119,154,104,125,72,207,251,238,250,157,167,3,88,
-            182,7,84,99,121,224,199,84,232,125,28,29,15,50,124,162,241,152,109,6,5,53,229,217,50,237,39,220,65,206,88,178,45,
-            64,238,6,224,113,254,84,32,197,84,25,233,86,109,15,224,124,157,115,3,210,168,255,130,9,31,162,221,223,166,58,216,
-            6,53,140,91,31,88,110,63,73,252,212,106,122,176,69,196,208,44,43,221,67,131,223,15,130,12,235,121,48,96,88,25,19,
-            55,46,189,232,85,92,194,50,220,25,30,254,192,38,29,199,133,103,113,71,11,92,93,2,153,99,252,172,112,169,102,68,
-            16,65,173,64,139,83,64,112,141,161,93,193,84,136,95,75,226,158,238,82,215,222,14,18,155,214,196,145,174,163,110,
-            86,162,82,133,164,51,39,163,17,12,110,242,70,124,123,255,46,121,225,110,127,169,73,144,156,140,126,196,255,227,
-            95,220,131,122,218
-        };
-
-    // ../xml/sizers.xml (12871 bytes)
-    const unsigned char sizers[2268] {
-            120,218,237,91,91,111,227,54,22,238,79,33,252,226,22,72,157,153,5,250,150,9,224,216,222,196,72,198,30,36,78,218,
-            217,23,129,22,105,153,91,73,212,74,116,108,23,253,241,61,135,212,221,18,229,52,206,76,167,219,151,32,145,206,253,
-            242,241,240,104,230,226,154,135,60,166,74,198,99,190,18,161,80,66,134,201,229,133,199,67,226,250,52,73,62,244,18,
-            241,27,143,133,226,65,143,168,125,196,203,15,46,47,68,184,198,223,147,3,98,39,225,74,137,208,75,122,231,151,23,
-            81,44,35,30,171,61,9,105,0,2,240,79,25,163,166,76,228,70,132,170,119,249,238,226,60,163,188,188,56,7,19,42,118,
-            120,203,3,75,202,143,254,164,45,177,220,102,210,14,109,168,209,186,210,223,4,225,209,228,32,58,137,104,149,254,
-            189,93,188,157,254,32,36,73,228,11,165,106,217,41,63,59,175,144,111,119,87,114,247,128,81,233,17,17,80,47,203,165,
-            179,150,177,248,77,134,138,250,149,28,183,197,212,97,34,224,97,130,249,59,111,35,113,215,194,103,13,241,126,166,
-            177,131,191,229,138,84,12,153,233,93,46,229,206,209,156,150,0,129,149,28,140,44,23,142,140,244,95,151,23,230,151,
-            148,112,187,123,154,220,47,166,163,225,93,143,172,185,31,125,232,13,125,225,133,4,99,146,144,103,16,41,92,234,251,
-            123,180,175,198,120,51,191,159,254,103,62,91,52,179,22,129,210,204,101,114,139,221,107,193,184,9,72,204,115,203,
-            151,82,250,153,138,27,32,72,8,8,37,114,69,212,154,19,29,137,62,132,52,101,26,116,53,199,83,234,83,115,130,255,201,
-            234,203,178,154,233,249,2,137,180,228,116,187,123,192,176,184,7,57,61,124,241,149,210,155,104,51,28,200,178,37,
-            191,62,93,114,191,202,233,240,196,165,17,79,122,151,250,229,55,90,28,237,86,11,150,131,56,235,1,203,116,236,12,
-            103,159,45,12,76,36,116,233,115,214,84,83,99,243,238,37,85,117,88,182,204,86,175,185,72,66,67,6,110,91,36,243,103,
-            72,71,30,185,201,211,194,121,252,52,30,46,38,206,227,180,87,212,237,99,196,168,226,143,211,9,82,103,186,26,234,
-            202,214,79,240,234,67,239,253,233,16,210,180,204,104,205,221,95,161,94,91,123,74,19,188,93,99,213,95,95,129,179,
-            156,134,228,137,250,130,225,20,118,234,238,115,83,135,157,54,41,129,227,166,46,191,85,15,107,249,181,218,182,14,
-            66,137,218,251,185,157,75,161,124,145,168,195,126,31,222,77,175,103,206,253,244,250,102,81,233,91,83,207,153,223,
-            68,73,253,119,44,188,181,202,138,71,241,157,34,34,76,20,167,44,123,230,243,149,26,96,244,255,239,193,72,65,130,
-            148,136,234,233,102,66,229,57,207,76,83,138,186,107,66,73,202,146,5,59,15,190,46,141,65,67,77,191,18,240,206,200,
-            114,3,48,36,85,163,186,111,4,12,15,217,71,55,147,209,237,213,252,151,18,247,72,6,1,24,82,97,78,175,108,156,145,
-            237,26,0,174,18,2,129,208,34,176,223,76,49,55,195,224,61,101,66,94,169,176,21,6,51,130,191,11,12,198,232,207,82,
-            133,22,24,140,83,151,255,50,48,248,15,220,28,9,55,58,115,136,8,10,60,251,50,144,211,164,242,155,133,157,251,225,
-            120,58,191,122,92,44,230,179,151,35,79,37,18,93,232,179,221,253,28,211,168,6,57,240,196,249,186,215,212,194,132,
-            191,225,246,65,59,183,242,169,151,116,142,84,147,95,22,147,217,216,185,27,62,44,156,249,204,153,12,71,55,206,221,
-            116,54,201,140,89,224,156,68,19,165,237,33,192,200,177,31,125,17,114,178,21,208,58,155,4,90,40,220,147,152,7,84,
-            132,16,90,146,68,212,229,72,169,214,84,105,202,6,175,239,39,31,231,79,19,231,110,2,117,56,187,118,30,62,13,71,147,
-            135,76,231,61,15,228,51,206,254,32,87,75,139,9,247,57,148,0,36,125,21,203,64,23,225,146,123,34,212,10,161,123,41,
-            193,165,30,198,167,205,159,223,91,116,126,221,29,206,118,119,29,11,86,109,14,15,158,124,229,230,40,76,232,216,117,
-            86,150,185,105,84,102,155,96,9,25,131,144,220,3,197,128,76,87,164,255,174,127,70,0,8,4,243,56,216,166,11,135,110,
-            148,12,104,218,23,4,126,186,27,31,96,70,199,49,204,69,160,18,168,173,255,109,68,12,8,4,224,191,150,62,51,177,222,
-            68,145,47,56,51,141,50,232,92,227,118,216,58,210,139,94,99,46,40,69,88,67,224,135,16,200,51,130,236,96,98,8,69,
-            71,18,174,208,14,112,73,155,67,159,121,201,51,237,148,162,29,78,153,165,114,225,23,24,255,47,139,241,207,30,141,
-            154,140,199,214,204,160,133,0,13,249,94,132,36,18,59,238,39,63,128,165,106,203,179,73,145,251,96,191,8,139,26,237,
-            58,185,44,26,11,68,106,213,249,114,125,95,162,211,254,237,243,134,110,91,193,83,231,164,45,135,18,81,160,38,93,
-            210,132,159,174,47,107,198,158,160,57,117,25,235,116,21,69,12,101,253,234,118,196,54,218,203,13,228,71,74,56,33,
-            128,114,37,118,102,120,128,230,50,2,207,76,47,193,179,62,54,88,31,72,188,77,172,137,177,237,178,219,250,169,90,
-            219,222,100,95,12,236,175,168,215,128,247,75,234,85,11,48,253,206,245,151,43,193,170,181,150,128,242,32,82,123,
-            7,161,64,147,102,114,182,250,246,89,6,20,124,139,99,4,35,43,25,87,177,3,149,193,105,161,214,128,197,186,176,6,47,
-            220,40,158,40,115,11,190,83,213,164,225,58,169,154,176,173,238,158,222,201,246,236,154,11,213,216,238,81,240,250,
-            136,75,212,3,126,31,76,204,10,108,19,17,152,202,66,190,197,193,44,209,55,143,200,135,17,203,92,71,204,67,232,34,
-            73,178,181,0,250,78,228,242,191,220,213,39,55,228,66,135,48,226,174,88,97,191,7,116,39,130,77,0,175,24,188,131,
-            196,209,226,80,42,190,62,66,136,63,238,23,118,111,180,132,242,167,208,220,124,163,43,201,23,121,144,187,138,90,
-            144,254,99,215,103,83,28,35,139,79,100,233,159,175,74,93,197,222,250,49,105,194,145,21,156,86,7,160,232,133,18,
-            129,83,172,72,241,65,220,140,26,225,143,26,243,160,3,138,107,161,192,170,133,187,0,112,20,87,136,174,163,148,227,
-            214,179,245,240,230,229,157,232,235,205,42,95,79,58,12,163,140,57,140,175,232,198,87,206,82,198,172,8,127,185,87,
-            225,216,72,151,38,103,228,39,173,9,238,208,44,187,245,167,151,1,141,24,120,153,144,113,0,85,6,183,124,40,225,125,
-            114,166,171,25,158,255,44,66,6,7,213,25,121,255,174,16,33,177,50,215,224,62,25,127,154,102,60,21,223,161,131,184,
-            130,203,77,201,241,14,159,90,254,85,67,225,75,38,231,172,108,62,200,79,85,161,222,176,28,243,212,79,9,63,0,10,33,
-            176,177,236,152,164,26,63,33,178,177,160,190,244,174,244,13,189,246,113,88,49,166,95,154,235,251,75,32,236,77,190,
-            38,50,251,250,109,126,219,84,37,163,152,227,108,66,73,127,126,219,79,23,17,3,50,162,33,142,236,48,163,187,50,88,
-            10,172,79,141,87,159,1,57,160,128,31,112,84,79,189,30,216,215,112,159,121,98,87,11,4,221,122,231,183,13,106,109,
-            229,132,164,118,189,72,113,172,98,116,251,56,189,67,24,221,246,118,197,154,36,211,108,151,54,147,118,81,51,121,
-            156,28,240,206,45,86,175,205,178,12,77,119,68,70,62,78,161,41,149,61,247,154,180,67,43,146,28,161,84,27,87,104,
-            181,57,123,3,42,236,74,145,162,127,156,176,17,0,7,156,146,221,50,75,132,71,138,206,17,220,36,176,186,20,43,29,52,
-            41,93,158,232,234,254,7,96,49,31,1,199,50,236,43,179,70,170,115,213,215,70,8,6,41,83,74,40,204,76,80,130,129,3,
-            166,207,197,28,84,231,42,117,241,1,155,233,197,102,190,114,23,30,48,98,249,55,179,149,10,191,206,148,213,122,51,
-            99,181,202,15,153,77,197,182,240,150,107,21,88,231,183,214,175,176,250,187,138,222,217,181,22,14,28,168,233,32,
-            160,171,28,120,66,70,99,150,97,13,92,234,34,106,22,198,249,174,46,230,73,62,116,152,211,71,31,110,122,161,183,220,
-            227,185,92,44,21,178,185,243,14,140,128,227,89,165,219,34,198,80,173,17,173,183,140,154,200,44,34,101,232,239,241,
-            0,23,10,197,194,45,34,72,242,207,146,155,56,198,221,55,28,246,10,95,32,1,110,183,49,122,223,167,47,145,89,101,11,
-            31,51,44,108,66,152,79,200,71,234,226,210,59,54,183,96,44,81,185,42,43,78,244,141,197,139,229,38,66,147,64,2,140,
-            21,174,220,196,112,210,50,179,212,207,166,15,238,39,92,139,250,97,64,22,107,97,182,73,218,238,101,122,249,209,147,
-            179,9,78,29,161,92,136,166,39,227,2,161,132,251,43,209,75,122,184,212,86,150,251,243,91,115,230,143,204,70,190,
-            99,181,255,41,150,48,248,99,62,205,71,1,243,61,128,24,129,249,182,31,78,147,131,85,127,253,163,2,116,210,233,21,
-            23,7,152,69,51,246,226,233,85,151,14,109,139,110,125,40,158,94,185,22,107,118,220,93,22,204,228,233,213,207,100,
-            183,94,131,72,167,215,93,57,50,109,250,17,213,222,64,125,105,76,176,104,199,243,242,244,202,81,234,17,158,23,71,
-            246,27,248,95,8,111,182,228,60,131,162,3,80,50,223,30,237,168,212,245,169,178,110,100,254,141,51,181,115,149,94,
-            67,115,68,26,180,226,208,159,87,149,41,41,208,103,208,142,57,175,87,83,66,154,129,5,95,94,175,168,142,42,131,54,
-            44,121,189,170,28,65,6,54,220,120,189,158,218,128,221,142,17,39,80,85,185,64,180,226,193,235,21,149,122,111,208,
-            217,251,37,117,69,83,191,192,169,131,118,31,212,154,220,108,23,206,27,255,195,200,119,127,0,54,106,223,182
-        };
-
-    // ../xml/text_ctrls.xml (30396 bytes)
-    const unsigned char text_ctrls[7105] {
-            120,218,237,61,105,111,227,56,178,239,167,8,253,97,39,13,164,211,61,61,215,98,142,6,20,91,73,188,113,44,175,164,
-            164,187,7,3,24,180,69,219,218,200,146,87,146,115,12,222,143,127,117,144,58,44,250,136,147,158,55,187,24,96,48,157,
-            144,20,89,85,172,155,100,229,231,115,153,200,76,20,105,214,149,211,40,137,138,40,77,242,15,63,207,100,98,77,98,
-            145,231,191,188,186,127,240,11,81,68,147,64,62,20,175,172,104,33,102,114,189,177,120,92,98,91,20,206,100,241,234,
-            195,207,81,50,151,89,84,228,213,12,31,163,36,76,239,95,189,109,247,113,143,229,220,201,164,200,77,3,252,34,139,
-            146,153,117,35,226,40,68,48,77,99,242,232,119,153,141,38,243,40,14,177,123,153,165,75,153,21,143,86,34,22,0,215,
-            157,200,70,248,147,134,51,167,25,95,125,88,140,242,18,135,159,223,234,143,90,159,199,98,44,227,230,183,35,25,70,
-            197,72,230,19,177,148,249,171,15,87,143,125,28,179,101,142,133,200,110,87,75,61,201,56,77,97,194,185,140,151,128,
-            94,180,88,198,210,226,1,214,68,36,214,88,90,171,92,134,86,145,90,98,185,140,31,173,48,154,78,101,6,244,177,166,
-            41,16,201,74,51,107,146,198,233,42,203,113,76,213,187,20,25,246,78,173,98,46,97,68,82,100,105,108,17,244,214,253,
-            28,246,51,95,45,151,105,86,200,240,196,234,77,245,138,81,110,37,105,81,245,89,227,199,198,247,176,216,50,22,197,
-            52,205,22,199,86,84,224,248,28,65,126,180,144,20,203,37,124,33,146,208,242,101,65,52,56,122,141,35,8,254,251,168,
-            152,211,84,153,204,87,113,129,155,200,212,59,249,45,249,45,241,5,226,253,163,21,204,97,60,252,247,183,184,248,41,
-            250,16,21,176,205,19,252,249,109,244,129,38,46,106,253,249,18,200,51,157,33,242,217,47,95,101,50,252,234,3,252,
-            143,70,99,215,135,87,31,222,109,217,131,251,76,148,59,16,37,133,222,128,143,208,156,215,81,254,42,87,68,203,83,
-            104,22,133,37,197,100,142,100,69,134,139,163,68,230,176,69,147,116,1,255,66,231,34,205,11,6,114,33,146,71,107,25,
-            61,200,56,7,220,67,105,69,83,107,153,230,121,52,134,253,61,194,5,248,99,145,73,107,156,165,183,176,35,240,253,125,
-            154,133,48,97,186,74,66,145,69,208,13,171,2,153,23,209,108,94,208,206,0,59,16,112,34,167,25,121,60,206,81,164,169,
-            21,167,201,236,53,109,39,172,8,228,198,221,148,51,96,234,59,121,12,95,91,136,243,18,41,15,29,97,154,200,147,87,
-            31,222,124,189,133,70,121,241,24,151,114,50,142,138,56,202,81,160,211,37,170,5,77,199,7,187,223,59,31,140,250,206,
-            89,160,137,104,199,209,44,33,56,11,16,38,100,75,194,87,78,139,19,20,72,227,247,94,239,252,98,199,4,25,82,97,243,
-            12,29,103,16,56,222,232,194,245,122,191,186,131,192,238,235,217,58,32,14,50,171,166,59,154,167,89,244,59,108,175,
-            136,227,199,215,166,9,253,96,52,112,71,246,117,224,122,142,223,251,213,209,51,157,130,248,201,169,0,254,61,110,
-            136,197,125,20,199,150,8,255,181,130,221,71,190,64,13,132,80,203,7,49,41,64,56,166,81,137,4,117,41,169,36,104,72,
-            24,155,2,51,1,192,148,92,18,47,209,62,88,211,88,208,206,205,96,59,19,195,250,200,30,147,185,72,102,178,130,225,
-            168,246,61,252,32,243,165,156,68,136,54,10,229,116,21,179,88,170,105,128,81,231,17,48,183,136,129,235,230,226,142,
-            89,173,177,65,168,0,234,141,45,154,171,181,64,36,4,172,96,165,48,56,187,143,114,154,234,17,216,53,249,10,184,89,
-            220,2,29,100,2,173,40,36,200,181,176,61,98,138,155,36,8,121,36,86,69,146,77,91,228,244,251,189,33,110,207,200,15,
-            108,175,100,158,30,19,151,164,150,41,76,194,32,31,38,82,134,249,26,221,160,231,24,84,18,40,181,9,163,59,150,179,
-            40,73,80,72,210,218,60,76,39,208,55,50,142,163,101,30,229,63,33,1,129,96,15,29,158,234,199,31,29,238,249,93,238,
-            132,246,170,215,237,246,29,19,184,214,211,225,93,68,97,24,203,47,7,172,51,232,190,16,164,18,244,247,179,192,172,
-            41,170,183,224,145,172,185,37,104,183,59,69,22,215,156,146,170,105,135,75,130,3,183,251,20,207,114,90,14,117,72,
-            10,5,255,22,21,125,39,226,149,220,230,142,104,199,66,22,188,65,228,212,137,152,54,74,38,45,15,225,196,0,224,156,
-            236,99,115,9,195,236,194,194,129,40,186,96,164,242,121,122,159,176,110,171,179,5,234,160,197,18,102,70,99,30,166,
-            146,221,141,82,215,76,211,201,42,55,129,128,191,142,22,226,33,150,201,172,152,107,96,240,255,35,69,46,5,73,128,
-            34,33,30,162,197,106,97,241,96,68,16,248,42,123,67,86,0,61,41,160,234,137,245,206,90,72,145,224,250,96,136,23,17,
-            180,12,210,66,178,137,143,0,242,135,243,224,146,181,239,116,149,76,72,62,22,226,209,74,19,208,157,218,39,35,6,206,
-            97,245,152,173,57,11,133,214,166,27,241,16,171,34,29,129,203,0,30,79,33,13,184,160,153,29,229,114,17,213,4,15,172,
-            53,234,222,69,10,166,158,71,177,217,87,72,29,43,253,138,118,160,230,49,170,205,70,75,128,139,234,53,55,66,6,230,
-            33,142,39,115,57,185,221,97,245,101,34,192,143,9,75,11,187,202,208,231,140,31,75,7,173,242,32,137,152,87,254,71,
-            235,136,184,33,91,177,118,5,15,7,212,61,139,78,110,253,29,145,3,199,82,102,175,143,21,237,105,244,10,169,107,225,
-            175,223,16,203,220,63,184,254,39,48,140,224,44,133,33,69,39,199,106,246,76,254,123,21,129,111,201,59,88,90,87,205,
-            120,115,145,43,195,21,56,96,202,58,23,239,149,165,202,37,216,114,176,123,177,228,201,13,19,25,231,184,186,238,7,
-            189,126,111,224,240,60,109,61,58,203,196,2,188,106,77,34,135,40,6,214,155,155,45,162,50,249,98,21,46,184,101,180,
-            5,101,239,137,245,23,105,215,117,255,65,78,42,76,59,244,220,142,227,251,35,114,89,234,250,162,225,69,205,56,0,86,
-            38,11,85,58,0,229,220,4,163,192,249,20,240,183,214,81,229,214,44,1,29,34,164,67,62,230,45,8,33,234,184,8,7,64,103,
-            58,129,110,218,41,232,77,200,241,106,71,84,36,173,16,82,1,176,119,17,186,235,41,134,125,197,189,132,93,10,65,124,
-            211,89,169,83,140,174,80,13,183,192,62,221,136,89,38,39,18,92,71,133,78,231,194,246,24,191,156,214,134,47,25,25,
-            128,229,13,104,197,108,129,208,30,83,187,142,225,112,220,82,48,190,202,157,77,234,156,128,172,172,33,142,146,188,
-            144,2,156,216,51,229,50,234,65,147,76,138,162,10,8,181,123,122,108,61,166,43,138,120,243,2,161,69,239,17,109,223,
-            27,38,44,44,135,43,27,151,157,102,233,130,90,129,250,227,84,100,225,6,34,149,124,85,39,81,131,149,1,101,20,153,
-            5,6,168,75,165,212,243,77,36,183,125,255,163,235,117,91,147,105,37,44,39,243,20,227,97,80,212,64,138,44,202,111,
-            55,77,229,57,118,215,29,244,63,155,167,82,97,31,219,48,144,76,212,35,155,38,2,233,211,147,92,231,24,49,129,59,223,
-            192,176,161,27,78,56,222,86,88,131,21,198,141,37,19,3,2,154,88,223,127,123,121,74,238,1,78,16,53,12,185,250,178,
-            12,44,32,92,75,209,182,242,244,41,115,191,74,20,228,91,128,125,191,29,218,59,153,229,248,213,251,147,119,40,40,
-            223,192,63,38,4,158,5,6,70,121,163,107,175,140,22,47,32,202,140,41,222,70,124,161,35,39,245,216,208,11,236,90,94,
-            103,49,251,124,172,80,23,41,242,172,18,169,116,50,89,1,4,119,28,119,46,214,1,37,55,162,82,228,40,88,37,77,16,185,
-            111,222,211,162,196,136,111,200,181,32,205,253,222,224,97,180,49,26,184,23,189,174,227,59,253,77,97,171,54,13,13,
-            90,163,55,134,209,25,122,110,28,169,202,88,178,227,67,232,65,8,171,135,144,191,70,190,26,168,138,21,5,119,37,114,
-            32,160,128,205,4,99,80,202,89,197,247,226,49,231,73,209,201,122,254,126,65,96,126,227,119,60,183,95,162,135,26,
-            134,40,69,132,42,131,89,164,241,143,160,144,96,15,138,8,162,74,43,159,64,123,60,6,227,203,114,37,113,119,64,178,
-            148,70,82,192,145,55,200,214,72,192,150,130,254,215,34,192,209,177,74,202,105,111,18,52,123,218,208,111,240,235,
-            61,154,55,53,46,140,114,192,232,145,173,53,208,132,81,69,179,58,94,113,74,135,91,112,119,235,214,30,123,40,25,184,
-            192,149,152,69,112,153,253,136,84,207,198,148,218,164,41,194,165,158,194,188,204,27,76,93,68,211,8,22,58,82,172,
-            178,201,212,116,90,246,115,219,228,19,77,167,163,73,137,154,102,63,246,58,136,173,113,175,94,111,212,19,181,204,
-            208,174,245,40,71,84,199,230,224,101,65,35,7,31,61,123,88,198,56,208,133,202,252,254,225,130,217,143,217,248,71,
-            204,164,129,76,96,110,13,51,120,160,76,143,153,221,171,44,83,141,243,180,89,220,64,91,48,202,245,53,49,27,105,85,
-            185,66,157,227,107,196,88,128,28,248,84,128,31,46,142,57,199,52,103,103,242,232,254,225,58,137,238,246,197,23,109,
-            217,115,214,198,84,100,61,115,249,196,229,79,29,63,216,178,188,97,1,16,8,133,50,203,196,100,46,50,49,65,103,33,
-            162,144,22,204,24,70,72,156,34,85,73,38,178,107,164,193,57,102,231,4,198,145,118,173,177,167,193,254,155,221,78,
-            82,127,166,20,254,71,84,150,228,191,115,88,134,249,188,53,38,5,199,24,201,168,29,50,237,182,0,115,44,87,69,21,52,
-            47,133,74,243,103,11,4,110,26,101,121,81,42,171,181,236,54,123,170,154,158,218,95,125,85,165,47,58,41,132,29,73,
-            72,6,75,131,170,14,123,208,25,211,107,178,73,160,44,98,78,33,113,52,145,218,93,71,199,150,29,98,74,119,178,102,
-            7,116,102,155,166,209,154,184,204,53,168,137,193,106,192,72,218,52,77,249,112,69,166,3,157,28,69,6,58,215,192,180,
-            122,233,222,1,182,24,61,97,118,83,198,83,235,8,85,162,124,160,147,131,99,220,115,95,22,55,152,14,105,36,81,95,227,
-            54,154,169,163,35,129,167,208,136,83,201,48,189,246,149,201,231,109,24,210,35,182,19,11,76,6,147,165,108,71,31,
-            58,163,155,102,117,178,178,100,149,212,100,14,220,0,58,57,44,141,220,151,246,70,182,108,174,168,251,40,236,162,
-            160,106,38,47,5,228,2,230,212,106,181,137,208,86,205,185,1,192,43,251,83,223,25,60,157,1,137,3,10,18,112,76,160,
-            19,185,217,37,101,173,191,110,109,181,64,147,217,38,201,130,0,11,56,225,74,60,244,41,255,195,114,220,206,23,122,
-            176,73,173,156,33,186,160,184,208,100,159,172,97,153,19,108,31,46,81,251,200,28,154,222,63,40,255,229,127,75,83,
-            2,63,125,180,7,129,79,6,192,223,118,114,24,37,152,218,26,97,70,177,132,239,193,167,223,214,18,125,106,104,227,192,
-            129,225,58,230,212,80,8,78,81,33,235,231,18,152,39,128,40,172,176,22,18,37,53,202,23,53,209,143,154,211,170,88,
-            62,180,56,61,251,225,219,119,239,142,223,127,215,208,73,111,53,193,94,46,35,154,169,77,123,106,70,244,191,42,25,
-            186,95,198,195,99,87,13,255,177,61,39,216,152,22,40,178,71,4,243,86,202,165,58,90,204,64,136,216,149,214,206,155,
-            118,161,193,210,115,62,7,227,80,76,79,25,108,185,183,103,60,219,8,101,255,178,179,123,216,217,156,218,254,116,38,
-            246,47,11,203,128,27,172,107,174,108,235,102,211,202,25,214,117,195,106,6,11,147,3,4,26,70,119,163,78,191,215,185,
-            124,213,182,103,123,25,88,112,218,165,200,101,94,30,204,43,216,33,38,45,64,150,181,71,144,142,255,37,39,197,201,
-            14,112,40,64,123,65,120,40,134,123,14,64,124,192,250,130,16,169,67,214,167,128,212,222,176,238,179,224,9,211,21,
-            40,203,55,147,56,154,220,230,251,147,2,29,10,187,211,20,194,39,173,203,82,136,6,173,138,175,64,145,158,240,113,
-            169,98,118,125,68,150,255,104,157,203,226,44,22,179,252,24,127,26,170,88,148,126,233,232,239,119,194,236,14,252,
-            235,171,222,224,252,139,65,79,185,151,177,156,162,95,201,183,152,170,84,61,202,34,68,233,82,157,176,52,253,205,
-            19,171,131,215,19,110,36,54,167,56,61,163,65,233,114,61,137,54,140,91,80,236,58,125,39,112,158,139,21,221,87,16,
-            192,15,75,60,99,7,85,23,74,60,222,123,250,254,236,148,112,39,184,246,6,47,1,46,248,22,171,44,121,121,8,253,224,
-            115,223,241,47,28,135,88,126,112,14,220,115,0,184,213,157,47,50,31,249,92,74,226,14,49,70,175,24,54,156,173,235,
-            83,129,113,186,47,5,11,158,147,49,12,224,243,212,140,115,69,108,17,134,216,135,222,21,134,118,154,39,128,175,213,
-            105,218,22,178,123,56,241,161,100,247,156,97,223,238,124,33,186,99,102,143,175,146,172,225,173,44,239,52,226,132,
-            114,156,138,208,40,182,27,144,70,65,38,132,221,56,244,113,105,31,151,166,150,129,188,175,90,158,76,135,151,221,
-            242,49,30,5,126,17,2,60,31,117,112,187,134,142,23,244,28,255,64,102,87,206,53,70,252,228,204,17,178,120,215,53,
-            226,75,12,123,162,209,176,53,222,222,98,122,32,208,184,65,120,90,86,238,206,31,1,48,24,198,0,188,219,81,111,224,
-            3,197,159,12,179,138,17,42,152,183,152,185,47,1,54,27,189,103,67,173,21,90,25,180,124,17,160,79,175,207,206,28,
-            15,164,217,119,2,235,0,89,30,175,240,34,118,93,122,85,110,138,192,71,214,65,71,66,33,119,98,125,86,135,223,229,
-            105,26,94,5,129,15,132,206,71,55,2,26,169,130,212,68,222,99,244,42,32,102,91,206,119,178,59,144,191,19,244,220,
-            193,51,140,82,117,38,152,209,69,211,154,61,218,181,252,153,219,185,246,71,238,233,63,0,136,231,152,69,62,207,81,
-            199,143,236,4,183,192,48,164,251,72,161,133,173,132,95,62,1,222,135,48,91,124,217,103,11,7,63,73,208,224,109,123,
-            145,32,31,100,166,63,229,100,204,122,54,200,254,254,239,151,173,84,141,125,106,255,243,218,111,55,119,237,118,219,
-            176,219,111,55,26,190,245,175,12,109,131,175,13,141,159,175,134,129,11,46,112,171,231,250,155,118,219,141,97,220,
-            77,123,249,83,219,30,24,26,253,11,67,99,208,49,180,246,78,129,85,219,205,253,94,240,43,76,211,235,180,187,174,251,
-            125,123,16,180,218,59,246,85,155,96,157,254,71,83,219,192,237,216,126,27,193,206,149,125,105,104,117,79,93,195,
-            204,46,40,43,199,239,120,189,161,1,22,119,112,102,106,12,236,222,0,34,171,86,207,112,104,106,219,4,165,239,94,15,
-            186,134,230,246,238,180,71,117,123,103,109,200,186,87,246,208,208,216,107,79,232,116,218,148,112,96,78,136,24,219,
-            237,176,148,211,223,208,124,217,222,23,199,131,125,61,55,52,123,174,215,239,249,134,5,54,80,255,236,135,31,218,
-            109,125,251,220,191,232,181,209,60,115,189,224,194,216,234,25,56,251,204,115,28,51,91,158,27,72,120,126,221,251,
-            182,211,239,181,218,47,108,255,210,233,183,73,115,17,24,88,184,119,97,144,143,222,96,224,130,149,188,110,175,249,
-            15,223,109,131,125,217,107,79,113,121,211,243,218,104,244,109,147,56,2,249,135,134,198,192,241,96,248,38,108,250,
-            110,96,104,187,54,52,94,183,213,223,149,125,222,187,52,180,94,58,103,189,190,99,232,240,46,187,238,199,129,161,
-            35,232,219,167,237,102,39,176,135,174,129,167,174,174,122,159,236,54,46,87,110,247,186,111,128,210,247,255,105,
-            24,252,217,212,58,232,93,121,110,91,32,7,131,142,135,138,161,13,227,192,55,8,224,224,218,64,105,183,19,152,244,
-            181,59,52,96,226,110,16,154,161,237,119,12,195,33,206,48,52,94,12,55,205,210,111,91,163,161,107,104,186,49,180,
-            125,116,60,179,108,81,23,4,61,230,14,136,1,13,52,129,225,231,224,73,250,166,14,21,60,181,187,12,77,215,222,6,129,
-            31,126,14,46,12,162,214,214,238,48,129,193,126,120,206,57,232,52,239,115,187,227,250,212,212,104,224,85,222,3,195,
-            220,254,149,221,239,7,118,255,210,208,99,24,237,122,29,131,83,226,15,29,176,135,3,67,123,175,211,230,53,19,199,
-            251,158,211,38,155,31,4,159,218,168,4,182,193,176,4,118,215,255,198,208,106,24,105,250,186,115,213,150,54,208,86,
-            6,245,102,82,121,0,229,251,0,108,70,171,227,230,212,208,180,65,28,110,28,175,215,119,219,54,237,230,194,224,220,
-            221,244,252,107,187,15,236,105,250,226,83,199,237,182,169,254,201,176,157,159,217,15,2,255,225,63,231,136,111,13,
-            58,24,20,142,240,84,198,248,94,23,150,247,96,128,139,247,57,175,210,80,158,88,221,40,231,155,254,234,140,20,143,
-            205,20,148,69,182,146,59,86,147,105,60,90,192,60,107,254,252,250,193,117,153,205,86,119,233,241,162,19,101,254,
-            170,80,62,4,170,46,26,39,134,173,100,108,121,103,253,100,61,96,248,45,251,45,177,142,58,222,219,254,217,235,214,
-            166,254,150,97,151,161,29,62,225,241,234,167,173,65,203,180,24,45,68,54,139,146,17,93,194,50,188,197,45,177,229,
-            91,90,234,108,126,28,139,228,214,226,79,235,79,75,235,143,42,171,167,147,120,219,148,137,255,29,221,125,165,59,
-            152,124,174,186,42,210,133,208,199,218,57,252,35,45,64,101,30,205,230,86,119,216,211,23,55,115,160,205,119,219,
-            216,3,15,171,94,14,19,62,251,250,255,65,229,46,146,247,35,153,198,70,70,199,27,141,234,5,31,223,13,40,57,112,7,
-            71,211,172,247,243,168,144,116,76,177,145,177,203,243,106,26,107,241,153,6,224,124,23,209,155,233,19,203,167,150,
-            26,231,139,229,82,138,12,239,100,230,11,74,166,232,235,10,97,90,240,101,165,66,140,27,31,224,237,94,164,175,200,
-            50,188,207,180,76,49,186,174,30,51,168,7,198,107,108,29,37,10,132,22,195,171,163,249,77,221,170,93,189,108,141,
-            146,16,51,27,235,131,232,38,56,247,213,38,42,215,220,69,88,192,144,94,141,221,202,116,85,152,54,174,126,247,27,
-            31,140,151,27,81,163,237,113,73,168,9,145,9,148,73,152,137,251,100,79,130,33,135,150,48,208,189,128,74,101,163,
-            234,17,227,181,57,69,253,110,44,113,19,124,46,139,201,156,95,47,21,81,204,236,15,31,22,233,114,157,191,240,214,
-            210,44,205,52,25,174,88,126,58,105,188,90,36,121,251,46,22,167,172,70,244,246,93,134,35,92,206,68,39,192,161,14,
-            182,186,218,106,169,207,24,74,146,64,156,173,204,77,226,105,172,122,196,69,231,196,4,11,17,132,95,99,171,9,105,
-            147,41,127,182,26,243,109,254,210,124,241,116,128,227,182,135,248,248,141,210,49,27,228,7,223,117,79,31,107,64,
-            208,115,154,123,145,168,171,60,201,106,49,150,92,34,66,137,13,192,185,206,233,73,154,180,185,248,93,171,165,157,
-            206,121,223,106,105,187,74,223,66,11,46,176,11,205,48,154,69,69,110,70,19,47,18,49,38,168,135,120,164,149,72,25,
-            114,226,93,233,57,245,196,56,155,201,156,177,199,155,253,210,106,42,95,69,165,242,158,186,136,39,171,152,82,141,
-            99,129,199,192,248,26,15,181,238,250,114,45,162,237,139,123,179,229,187,86,203,247,208,242,221,86,47,41,14,15,230,
-            1,252,152,74,110,60,46,198,120,93,232,79,205,6,132,233,38,83,106,87,59,7,155,249,187,204,210,170,216,69,169,53,
-            81,156,190,223,131,150,183,50,107,94,210,220,76,81,78,191,167,92,41,133,31,164,97,174,30,243,241,56,27,219,193,
-            53,243,128,74,179,69,128,101,188,202,223,46,162,100,149,183,186,38,81,54,193,179,220,76,182,233,63,78,31,116,7,
-            205,187,39,118,92,26,166,186,42,218,81,191,175,249,37,120,139,96,150,225,221,122,85,76,166,38,38,183,132,91,59,
-            107,93,122,29,35,197,93,59,174,36,226,45,72,82,191,229,77,73,187,233,183,160,139,161,110,251,107,169,110,95,48,
-            84,158,22,223,131,41,223,108,129,177,7,194,169,203,49,192,28,8,145,102,148,134,119,212,158,144,192,82,183,230,26,
-            222,206,26,40,172,241,105,98,176,86,171,73,177,202,36,27,187,218,185,195,246,61,193,10,30,249,58,149,180,253,89,
-            123,6,12,16,208,107,60,166,191,54,48,90,142,25,181,234,205,100,121,155,23,7,148,175,36,201,225,199,35,39,48,188,
-            248,21,99,84,191,135,6,102,89,180,248,86,95,140,153,90,242,97,9,148,173,222,121,119,97,34,60,148,191,107,244,182,
-            105,90,205,64,241,26,186,95,27,230,64,51,185,121,30,229,57,109,0,100,44,99,124,85,54,221,103,130,13,112,148,83,
-            108,135,35,148,227,213,12,190,123,128,72,227,78,198,37,159,116,149,193,129,30,17,130,174,192,75,64,196,33,60,12,
-            73,77,214,183,242,241,69,4,238,41,206,54,83,37,70,212,142,110,90,83,121,71,162,144,219,214,172,70,237,179,100,44,
-            31,232,252,49,9,203,213,173,142,72,170,119,166,234,113,238,223,254,189,74,139,159,214,113,231,214,93,143,178,37,
-            30,75,22,105,118,176,197,170,191,219,211,147,169,34,11,127,102,219,85,33,190,201,128,97,153,9,124,150,184,167,25,
-            219,182,22,25,243,131,41,12,152,188,249,143,242,11,52,190,120,11,115,132,245,131,34,172,108,181,203,153,55,251,
-            232,236,248,229,24,209,10,245,34,222,15,58,163,43,219,59,239,13,232,162,166,69,111,114,155,29,245,171,174,124,207,
-            160,237,235,215,214,88,171,223,198,206,62,172,199,103,231,42,146,222,21,63,79,86,16,4,45,14,222,101,124,143,187,
-            66,243,202,243,224,75,145,63,217,182,42,4,159,231,240,89,95,127,207,197,235,184,110,1,211,60,106,184,250,56,115,
-            45,137,194,122,140,121,74,235,180,237,94,163,2,20,231,217,126,220,206,147,150,187,195,191,173,83,134,3,11,61,168,
-            95,5,105,109,107,90,58,103,205,41,85,9,143,150,239,214,154,0,141,241,150,9,170,238,77,19,20,84,215,81,237,7,94,
-            116,154,112,149,138,16,139,68,170,146,58,173,143,248,41,174,192,82,110,122,136,154,194,227,156,130,234,17,181,9,
-            141,19,77,26,62,43,86,10,16,138,155,181,179,170,111,197,212,72,209,8,243,208,90,241,166,236,222,222,61,61,102,45,
-            226,12,0,122,24,21,119,180,184,140,71,213,44,231,38,25,207,111,71,42,154,48,169,53,202,50,107,206,222,182,94,131,
-            171,173,186,54,68,187,147,223,150,4,251,193,138,211,25,27,89,101,1,180,178,10,101,146,22,149,195,169,74,128,156,
-            88,174,46,125,210,152,75,208,187,158,182,61,209,159,237,167,226,254,203,21,251,91,157,185,106,229,176,124,125,173,
-            202,144,191,162,234,28,138,54,25,140,18,88,110,106,195,89,68,94,38,81,115,208,150,156,79,227,211,17,252,108,21,
-            11,124,75,25,74,245,136,75,93,230,130,49,101,113,78,126,225,160,107,130,236,220,56,93,40,101,148,87,8,236,130,172,
-            44,174,82,125,163,233,185,0,135,246,201,43,162,4,212,131,207,77,235,242,48,189,20,204,137,135,65,250,192,196,0,
-            212,14,64,116,176,38,226,17,189,152,203,71,58,123,187,11,144,234,75,126,107,151,243,11,167,54,8,148,52,221,207,
-            21,108,67,131,121,198,219,3,54,67,195,68,223,239,160,193,18,11,219,140,244,28,187,228,149,70,135,205,26,57,124,
-            102,133,15,125,5,61,232,42,161,153,240,237,243,125,5,40,160,28,51,200,124,143,50,233,66,89,229,53,120,81,132,48,
-            169,108,130,20,205,10,101,170,81,157,113,62,30,216,229,88,23,108,64,161,166,180,121,190,99,39,48,33,223,112,101,
-            218,245,233,170,148,34,207,136,204,216,60,170,192,247,180,91,214,136,42,36,71,179,85,20,202,124,187,63,146,164,
-            150,30,166,99,16,171,54,135,234,36,118,163,167,170,237,96,52,147,162,218,211,45,95,34,185,176,216,45,142,111,44,
-            81,59,212,57,49,249,39,247,34,11,247,90,96,44,31,83,42,4,12,204,51,41,86,107,203,172,150,213,145,32,4,171,218,11,
-            160,114,81,104,159,248,189,45,231,132,85,57,75,124,195,19,129,218,91,235,7,239,25,15,42,40,154,159,3,3,112,33,159,
-            100,43,221,136,119,176,82,31,61,88,47,33,80,167,59,234,169,186,168,114,210,108,182,11,101,95,103,105,202,101,94,
-            134,143,197,60,53,108,194,56,69,174,98,26,89,214,31,66,37,42,248,188,137,64,248,8,147,106,232,168,167,225,51,58,
-            79,207,182,96,70,229,145,99,52,69,98,166,10,107,237,199,229,245,247,238,166,115,85,253,200,189,142,37,186,5,50,
-            91,228,213,227,119,149,254,23,138,15,145,3,48,78,226,123,214,101,247,187,99,245,54,156,118,141,102,86,8,230,170,
-            4,140,58,156,226,167,239,120,182,160,74,141,232,90,146,88,123,168,254,125,126,76,15,206,232,101,122,14,52,207,115,
-            102,134,119,92,154,47,3,159,65,245,97,137,73,122,4,129,69,129,242,40,195,155,4,150,156,78,65,31,26,115,176,168,
-            109,120,161,124,143,67,173,82,60,55,72,230,113,137,217,173,46,38,169,176,200,132,122,74,44,244,171,1,124,147,187,
-            166,178,182,169,197,242,153,218,104,149,188,28,192,107,47,224,74,168,245,26,13,184,203,139,247,40,161,74,19,53,
-            97,174,236,203,235,95,126,1,25,243,94,193,63,71,235,182,230,163,170,162,253,202,88,83,220,116,123,163,173,142,117,
-            37,238,122,248,151,43,30,42,244,161,163,225,117,125,90,105,73,42,144,131,228,192,178,56,192,71,170,240,114,89,31,
-            167,253,117,185,87,141,41,116,165,65,44,164,83,59,212,47,75,177,43,29,57,149,84,43,132,220,71,117,246,97,231,17,
-            144,181,20,103,116,42,168,116,156,228,196,56,162,89,219,42,189,14,213,227,49,160,86,187,33,208,68,16,1,171,245,
-            98,62,161,164,223,142,2,239,232,147,129,242,163,196,251,206,138,166,37,101,111,232,35,174,183,141,5,223,57,154,
-            212,71,183,164,64,234,199,194,134,35,133,66,100,197,134,217,168,190,244,246,249,44,95,117,81,134,35,228,250,95,
-            99,42,178,132,111,146,11,235,107,220,1,170,162,157,165,16,4,151,111,66,96,137,77,7,38,38,104,116,170,88,249,35,
-            85,168,188,39,85,227,148,163,246,221,148,29,213,163,255,237,228,229,75,2,9,166,32,233,250,139,153,184,219,38,108,
-            84,240,222,54,237,14,44,153,244,123,200,243,52,122,144,13,177,196,157,84,11,231,101,154,3,182,76,95,83,82,197,167,
-            240,36,80,215,152,83,143,131,104,97,198,112,195,125,145,156,222,137,108,90,11,13,81,181,30,95,115,211,36,224,9,
-            219,4,85,11,61,99,78,198,100,147,227,35,244,67,82,162,211,46,170,55,144,111,91,124,252,219,6,107,155,211,202,126,
-            208,58,252,163,170,76,184,205,77,168,152,132,125,255,186,40,230,45,39,2,108,115,6,202,174,246,156,156,252,134,63,
-            208,11,160,187,12,42,64,89,3,95,233,139,165,228,69,161,235,174,18,13,181,124,164,8,88,211,140,53,2,66,176,98,209,
-            14,176,245,21,37,2,168,165,42,245,83,102,131,72,140,170,168,172,253,252,11,83,44,88,97,179,227,94,13,71,29,123,
-            208,113,250,253,198,187,175,234,93,22,191,252,122,187,123,150,11,219,51,188,37,92,159,104,87,61,133,242,89,116,
-            109,43,41,45,82,171,148,141,4,70,149,198,193,192,4,179,82,39,251,64,8,255,219,5,222,238,89,202,247,122,135,35,137,
-            239,226,202,27,75,184,153,133,92,80,182,33,49,97,201,172,197,80,17,75,36,101,145,132,230,219,63,226,51,126,58,122,
-            242,20,68,212,179,191,67,168,210,193,75,228,189,97,171,166,199,19,9,162,110,8,160,87,65,213,107,138,104,169,60,
-            29,94,118,45,177,87,191,80,68,209,81,89,11,30,84,87,145,82,238,85,63,192,214,61,8,57,149,120,5,77,161,94,99,83,
-            122,173,250,203,60,32,234,116,51,55,223,66,188,157,148,218,81,90,232,8,253,200,242,222,202,107,173,190,202,75,193,
-            101,233,161,173,32,120,118,183,251,28,33,67,2,113,177,146,44,140,18,129,149,166,84,221,35,37,113,71,192,160,233,
-            114,153,234,191,112,132,245,136,176,64,80,53,228,181,42,201,159,183,43,174,242,245,88,211,203,89,60,23,103,63,85,
-            239,160,254,187,34,209,146,234,70,50,255,91,235,2,176,133,24,253,222,240,212,181,189,46,8,247,240,243,65,28,92,
-            206,48,180,253,224,32,33,232,186,215,167,32,74,59,68,96,203,231,163,174,231,14,15,250,212,179,207,71,238,77,163,
-            16,203,254,31,127,68,165,63,232,30,252,173,250,243,46,135,114,33,150,54,203,235,233,237,132,124,149,178,80,170,
-            246,159,195,123,44,189,15,30,73,148,110,211,107,23,110,224,15,221,224,229,84,17,255,141,35,197,229,148,11,230,88,
-            174,204,202,207,211,34,95,130,60,139,162,200,34,48,226,244,236,97,15,8,187,207,4,145,107,14,253,17,144,122,96,34,
-            108,223,25,29,204,219,189,65,183,215,177,3,215,123,161,109,169,184,165,129,54,26,212,234,186,85,154,157,236,3,145,
-            66,238,112,152,154,181,168,158,5,213,149,221,241,92,207,233,80,225,250,253,225,161,244,124,17,97,250,11,79,147,
-            64,157,147,79,170,254,220,20,215,58,59,222,182,106,121,250,118,16,21,24,103,116,194,104,123,200,8,80,94,168,188,
-            70,67,116,192,1,116,97,142,170,238,151,7,137,39,187,0,219,80,193,236,16,248,248,253,198,75,67,233,118,123,103,189,
-            3,13,49,177,137,202,15,213,254,172,213,186,39,128,67,246,174,116,132,64,13,28,167,235,95,224,51,215,167,66,181,
-            126,78,90,106,148,170,86,119,121,177,3,243,217,171,56,212,167,131,213,107,144,205,128,13,237,222,224,64,223,219,
-            115,137,212,159,237,32,112,174,134,193,33,83,248,246,141,51,116,1,2,46,193,126,192,134,229,24,249,209,75,11,42,
-            232,163,255,106,222,142,229,60,199,238,92,28,200,34,205,21,149,159,181,109,81,180,199,228,19,28,68,33,44,187,131,
-            220,115,0,180,37,123,106,191,142,206,39,168,210,106,169,13,203,191,50,163,56,126,11,34,215,195,174,29,56,215,189,
-            39,195,161,254,192,203,62,242,85,171,77,162,255,122,222,122,21,21,252,154,42,196,87,62,201,238,194,42,4,191,239,
-            80,53,130,47,25,42,114,55,199,135,155,33,249,213,117,175,14,95,252,247,52,93,168,234,235,106,95,249,102,82,235,
-            143,186,112,97,151,183,198,191,82,251,63,255,7,171,12,171,228
-        };
-
-    // ../xml/widgets.xml (28672 bytes)
-    const unsigned char widgets[6714] {
-            120,218,237,61,107,115,226,72,146,247,83,42,122,47,110,236,93,219,61,125,27,247,165,103,166,35,48,200,54,59,24,
-            124,128,237,233,253,162,16,82,1,90,11,73,43,9,3,123,179,255,253,50,179,30,42,137,146,192,118,207,244,204,221,70,
-            116,180,141,40,101,86,101,229,59,179,202,223,95,243,152,103,94,145,100,61,62,15,227,176,8,147,56,255,244,253,130,
-            199,204,143,188,60,255,225,221,102,219,241,139,240,57,44,118,253,56,8,125,28,250,142,133,43,111,193,27,190,43,118,
-            41,126,21,6,11,94,188,251,244,125,24,47,121,22,22,121,9,239,49,140,131,100,3,95,45,195,128,179,216,91,193,240,121,
-            146,241,69,150,172,227,192,245,147,40,89,103,239,222,215,190,143,11,124,244,94,129,219,7,44,192,50,231,153,199,
-            69,142,99,235,3,242,240,31,60,115,253,101,24,5,248,117,154,37,41,207,138,157,196,240,236,101,46,254,166,22,144,
-            23,89,24,47,222,125,90,185,161,90,219,247,239,213,59,123,111,123,235,34,113,243,194,203,10,245,254,44,73,34,154,
-            49,208,178,78,208,24,232,135,148,238,22,89,100,18,83,61,127,37,17,97,9,161,39,232,100,60,221,208,72,152,220,46,
-            226,246,175,248,182,200,60,235,128,32,204,189,89,196,131,189,221,120,243,110,189,118,51,60,69,35,215,7,226,181,
-            236,72,26,121,187,202,94,176,37,143,210,31,222,245,231,204,95,114,255,137,7,103,236,14,198,156,156,178,77,24,69,
-            108,198,153,239,69,176,86,230,229,44,79,146,24,127,22,75,120,10,139,201,146,136,133,48,247,140,123,5,15,46,44,51,
-            22,212,83,248,194,34,10,115,220,184,36,197,185,42,114,111,59,93,183,231,92,117,238,7,83,119,50,253,60,112,212,164,
-            166,128,39,224,115,111,29,21,140,32,125,100,155,237,229,104,220,115,198,238,112,52,116,8,227,62,172,225,200,237,
-            220,79,71,99,103,210,255,171,134,117,185,83,160,206,42,243,167,85,122,193,223,214,121,193,112,35,112,7,88,145,48,
-            190,245,252,34,218,177,121,88,208,120,122,158,204,233,119,77,237,11,214,199,39,64,3,154,30,155,71,222,2,41,146,
-            115,27,150,56,41,128,200,94,188,224,26,19,174,96,127,253,45,251,183,206,185,187,64,229,20,250,181,109,4,62,251,
-            225,221,7,219,126,110,182,215,226,141,138,132,233,253,5,144,1,11,227,188,224,94,128,43,172,73,162,109,91,189,186,
-            72,150,15,246,7,135,177,135,234,144,187,176,255,43,47,85,175,144,124,55,168,130,75,47,134,9,75,97,46,53,65,245,
-            113,69,25,16,233,225,221,56,113,231,137,191,206,93,78,10,15,104,238,62,241,157,252,116,180,202,248,5,148,195,204,
-            243,159,246,148,195,215,208,219,51,34,98,11,139,21,32,166,181,247,92,158,251,94,202,115,45,152,56,4,25,61,227,113,
-            192,51,226,31,54,75,34,208,18,113,192,242,101,178,134,95,129,181,60,96,242,120,1,67,163,48,230,54,70,90,241,60,
-            71,54,168,97,11,194,98,15,37,72,147,28,13,26,41,102,75,239,25,30,128,56,135,169,132,159,179,217,186,192,73,161,
-            156,109,50,47,77,81,107,129,5,66,206,68,37,182,3,113,141,253,104,13,123,194,183,105,20,250,32,218,248,34,155,129,
-            2,123,202,113,13,36,233,52,9,22,206,217,46,89,179,13,152,14,212,7,22,124,182,5,217,120,92,174,96,146,114,63,156,
-            135,48,79,143,137,97,8,23,164,79,169,212,146,69,236,170,20,204,168,226,29,197,252,219,174,252,92,71,33,22,2,111,
-            224,82,196,75,40,219,30,91,100,94,16,2,79,1,45,22,113,66,91,55,47,39,132,186,75,194,176,78,130,151,236,123,212,
-            20,96,252,235,39,96,193,31,132,25,247,77,197,35,180,191,66,222,227,5,207,86,196,11,136,29,140,157,207,87,128,75,
-            41,110,193,251,196,164,248,81,67,163,153,197,59,86,128,88,95,236,219,167,233,232,206,98,105,46,71,211,233,232,214,
-            242,197,192,185,154,90,30,143,251,215,55,83,210,247,0,207,148,191,61,5,8,191,186,93,48,72,201,170,43,236,135,214,
-            129,181,167,175,242,135,242,245,140,190,175,41,40,245,216,93,130,29,224,95,77,61,249,180,194,54,15,6,62,170,57,
-            202,183,241,127,96,203,128,147,230,48,53,134,24,7,70,28,100,182,88,122,5,248,0,48,191,76,242,7,77,85,218,112,48,
-            222,97,150,75,133,16,36,92,168,17,18,33,176,148,197,146,253,33,148,186,3,198,198,146,185,11,96,32,178,241,100,107,
-            148,65,37,182,35,149,248,247,117,82,160,188,3,191,165,25,68,18,91,120,92,1,118,193,238,118,197,18,189,42,24,50,
-            94,207,118,12,151,161,52,40,234,134,148,190,119,195,85,154,128,248,163,255,68,99,51,24,235,102,252,239,107,152,
-            129,120,106,88,112,242,72,20,217,108,98,140,255,231,41,204,178,70,127,73,185,238,159,254,196,244,144,146,82,40,
-            156,146,126,184,186,11,54,53,241,224,183,161,146,232,152,196,41,2,95,103,141,10,123,198,115,96,180,156,1,96,219,
-            116,4,223,89,248,193,216,73,252,86,137,177,224,17,185,125,239,62,73,161,192,79,45,124,3,219,4,80,215,21,237,177,
-            199,51,35,18,89,47,18,219,0,234,89,191,85,117,122,75,90,131,93,64,13,183,217,222,135,14,0,74,50,227,149,16,148,
-            92,103,14,42,73,236,8,193,68,138,41,254,0,248,8,117,33,130,77,120,132,124,42,28,71,37,32,37,121,43,238,26,188,233,
-            249,62,152,67,115,90,54,210,166,94,6,63,97,10,121,205,198,210,210,253,188,88,185,52,196,36,117,249,142,50,80,27,
-            197,242,154,15,244,34,193,78,48,178,205,158,159,37,57,251,247,255,9,131,127,158,193,143,52,201,233,39,234,1,250,
-            101,223,113,50,31,227,108,225,51,178,182,126,38,6,233,133,103,92,18,142,36,168,32,156,5,40,24,160,190,230,117,48,
-            240,82,162,206,4,205,237,47,231,60,154,3,227,156,224,144,211,22,158,1,63,30,13,104,78,212,106,100,154,78,16,132,
-            53,182,81,186,194,147,187,223,64,57,155,44,16,51,187,171,196,127,90,107,63,162,246,80,90,90,94,176,37,232,96,237,
-            165,236,208,198,42,217,144,156,10,235,6,109,7,234,73,72,37,206,228,150,160,192,46,199,60,146,50,76,84,34,15,39,
-            134,200,103,62,7,171,200,18,185,227,184,34,131,67,129,193,5,30,201,115,168,61,103,9,208,20,172,16,252,143,27,184,
-            228,225,98,9,106,10,116,35,16,16,201,113,254,225,172,84,155,149,152,104,166,199,232,32,171,84,40,98,188,52,53,19,
-            185,23,48,158,100,24,246,15,108,48,121,13,223,157,127,128,127,173,38,21,204,47,247,178,12,131,175,90,122,161,246,
-            252,128,73,29,160,170,125,240,162,48,160,180,206,251,22,163,251,254,87,180,154,153,90,68,43,51,71,130,114,174,210,
-            174,109,46,254,132,70,11,253,18,22,124,85,74,157,246,207,180,167,92,217,215,11,54,4,163,39,172,45,137,32,242,188,
-            151,243,115,80,154,60,206,67,12,5,207,88,120,1,182,207,244,182,81,48,86,41,153,22,194,4,254,186,48,178,17,121,112,
-            185,214,253,146,123,234,32,33,84,87,110,157,48,228,90,57,192,219,217,78,68,229,184,36,140,136,49,28,68,183,19,2,
-            0,52,245,241,55,133,224,126,21,244,211,196,80,251,34,22,225,158,83,140,79,83,149,104,50,210,229,16,137,208,75,2,
-            157,144,247,141,151,5,214,224,160,220,1,208,253,58,70,136,11,67,162,165,231,174,6,42,193,120,246,162,53,168,254,
-            56,66,149,31,82,148,115,254,161,226,65,87,94,147,59,92,138,18,82,205,3,106,129,163,77,160,64,120,170,2,179,111,
-            44,201,167,209,10,8,115,9,232,102,184,200,11,106,190,36,12,176,47,42,71,67,160,115,69,160,48,83,41,8,116,163,10,
-            107,252,135,208,107,174,252,190,59,125,233,78,250,195,235,50,45,52,161,152,242,188,36,18,78,204,150,11,130,55,111,
-            239,7,211,254,93,249,238,173,140,224,106,111,127,36,250,129,169,203,40,184,44,146,5,70,173,58,220,195,69,231,76,
-            186,105,201,124,46,213,102,152,151,156,2,76,66,8,157,159,166,206,176,231,244,80,42,54,219,235,233,143,255,201,208,
-            115,107,152,158,26,173,166,231,108,11,140,168,131,246,233,113,26,85,227,20,240,29,215,24,109,179,201,77,255,106,
-            202,64,79,119,167,227,1,123,226,59,52,227,160,205,128,101,75,33,246,215,89,14,67,86,201,179,8,144,104,88,34,76,
-            213,42,1,76,34,51,165,105,223,166,87,142,202,241,1,164,155,73,119,60,26,12,180,151,73,105,67,224,200,101,146,133,
-            255,64,6,141,88,14,78,68,20,205,188,12,89,90,59,214,104,73,138,36,65,19,195,217,137,80,162,184,29,209,238,180,129,
-            174,157,193,99,231,243,196,157,92,106,27,29,109,60,88,97,142,6,19,100,0,166,143,41,129,18,95,3,156,161,227,192,
-            238,24,112,70,128,84,38,60,173,112,112,222,49,231,129,52,238,22,136,35,3,90,47,65,213,211,6,238,168,213,78,70,227,
-            169,233,192,225,14,204,146,109,149,128,176,221,210,9,240,162,116,233,205,184,64,149,100,16,32,17,220,230,29,166,
-            140,154,45,107,252,136,54,93,231,25,165,147,107,181,238,16,104,115,208,210,200,103,179,4,244,35,204,35,93,23,165,
-            99,137,154,31,216,16,220,139,21,138,149,80,225,58,177,252,233,91,115,118,148,204,211,235,119,30,166,110,247,198,
-            233,254,56,232,79,166,151,163,159,222,149,134,184,155,172,86,32,177,100,110,213,148,175,181,43,67,184,65,154,200,
-            186,41,27,134,107,33,250,49,36,32,174,71,170,48,144,141,117,44,63,16,185,246,103,241,37,38,32,66,185,210,86,181,
-            163,114,123,221,65,191,251,227,203,48,22,6,135,96,68,151,172,103,160,15,253,40,212,75,179,120,79,147,2,147,104,
-            151,50,187,37,157,167,106,178,235,23,201,196,182,22,111,190,70,133,230,23,114,225,102,171,180,77,197,130,164,114,
-            112,255,131,3,198,114,152,196,188,212,45,34,131,129,175,10,47,14,55,109,95,131,92,129,160,106,203,170,7,151,9,202,
-            121,40,61,49,179,2,98,70,156,21,104,29,244,14,139,171,50,56,178,131,44,154,32,162,25,91,129,167,130,222,10,26,51,
-            42,183,16,76,150,97,129,161,25,227,161,85,180,162,164,178,140,13,159,206,28,202,244,36,106,119,140,187,189,140,
-            18,43,72,240,150,125,59,190,226,33,228,107,16,226,254,73,233,202,233,145,27,209,179,47,88,249,4,75,138,110,205,
-            215,175,135,90,75,34,198,247,100,190,182,133,139,187,250,107,149,82,13,162,31,235,242,52,250,173,125,247,102,52,
-            238,255,117,52,156,118,106,78,79,94,245,122,116,117,100,31,194,131,51,158,246,187,182,247,181,179,160,222,174,97,
-            60,16,14,79,32,132,229,101,207,66,46,63,30,224,179,62,236,200,2,252,200,223,94,4,44,22,208,150,55,78,242,208,204,
-            253,25,113,87,31,59,60,128,146,106,8,101,57,72,91,16,80,240,63,254,235,219,22,200,171,48,126,192,200,199,2,249,
-            22,180,216,106,189,146,128,52,130,186,71,83,7,232,109,27,1,122,219,6,128,31,190,253,182,61,248,175,54,98,84,194,
-            78,21,67,232,138,145,134,203,200,225,93,147,124,99,0,36,221,209,67,241,35,162,131,16,229,215,65,134,2,224,34,223,
-            216,182,118,206,62,125,123,134,94,168,136,213,226,245,106,198,169,18,149,23,60,205,141,93,166,88,40,47,93,36,138,
-            182,196,179,117,138,238,31,76,5,220,53,41,110,173,251,151,130,72,253,66,19,66,208,230,132,14,204,4,52,196,147,59,
-            199,58,1,143,253,221,161,233,192,96,166,7,139,170,197,225,173,105,69,191,132,213,185,17,143,23,197,242,8,90,200,
-            117,211,91,76,188,245,74,196,160,91,65,193,120,150,74,225,158,146,157,12,26,213,116,85,75,47,188,245,194,170,166,
-            1,130,93,77,155,90,90,191,93,195,248,230,192,26,160,97,183,11,160,255,113,162,125,191,48,199,70,31,185,165,43,47,
-            123,146,124,148,173,99,114,171,76,66,90,23,116,219,31,186,183,157,159,220,65,231,210,25,236,195,93,9,189,118,6,
-            176,133,62,138,32,160,140,154,128,61,116,6,247,142,0,181,7,73,100,182,232,245,134,183,143,157,2,242,171,1,45,103,
-            39,101,98,166,58,9,26,106,89,166,206,147,156,54,77,5,43,187,54,26,231,42,93,30,241,185,40,208,129,9,241,121,149,
-            173,19,140,135,21,67,52,96,16,69,226,86,20,153,200,174,191,30,7,150,179,91,49,20,73,218,240,170,172,121,183,190,
-            61,75,10,172,64,156,20,70,138,76,102,8,79,155,193,222,52,3,165,242,2,21,16,27,94,159,56,131,113,103,120,237,148,
-            201,158,8,83,38,90,105,2,85,68,60,13,2,73,89,114,53,85,105,223,153,153,100,105,192,209,31,130,140,79,156,210,101,
-            0,34,231,146,248,146,21,105,79,20,55,130,245,75,147,144,18,215,85,92,67,236,2,195,84,119,17,162,74,163,140,92,101,
-            21,245,100,204,126,244,63,25,244,123,206,248,232,168,95,20,161,176,32,43,187,207,168,201,107,82,247,32,172,137,
-            6,145,178,19,44,83,250,142,148,158,170,96,107,125,91,113,205,171,1,12,250,67,231,254,238,141,0,122,163,199,225,
-            27,64,220,117,174,223,54,7,4,240,198,57,76,111,238,111,47,167,227,78,37,229,99,1,98,236,189,33,6,65,230,45,196,
-            71,178,176,16,205,249,79,23,135,241,141,157,129,211,65,206,127,245,180,187,55,200,215,189,99,231,92,26,167,82,32,
-            45,17,204,53,90,84,29,192,44,196,167,47,146,138,122,89,148,115,68,200,253,11,5,200,95,179,253,155,232,253,130,112,
-            107,125,76,188,37,157,164,86,215,142,20,184,29,170,216,53,161,225,79,148,34,38,151,224,84,229,113,20,134,246,104,
-            233,5,238,227,117,231,173,238,35,64,120,145,251,88,193,248,102,247,17,160,77,110,71,134,253,213,184,243,85,130,
-            134,23,160,46,50,44,59,98,57,130,172,85,18,115,150,134,91,30,137,130,204,58,13,240,5,12,95,216,9,165,28,215,105,
-            42,138,13,179,29,213,113,193,158,23,152,217,207,79,235,182,205,150,152,32,213,112,233,25,185,9,85,13,249,61,167,
-            39,212,170,142,18,25,163,23,71,137,136,228,95,163,208,20,203,15,108,13,226,4,174,145,41,18,199,72,144,209,87,43,
-            69,165,17,89,13,120,187,240,144,113,17,209,111,137,194,204,187,210,128,51,140,96,159,195,156,156,32,100,23,27,222,
-            179,3,171,252,112,32,8,175,206,162,116,71,141,160,219,0,46,122,22,116,225,138,190,49,139,38,13,1,248,209,51,58,
-            42,107,56,185,180,232,19,179,117,216,86,45,181,250,172,151,123,106,197,4,99,47,129,214,240,31,112,67,255,229,27,
-            254,203,55,252,109,250,134,55,32,99,89,20,198,79,149,102,175,165,122,74,167,164,190,116,221,242,215,52,39,122,37,
-            109,105,81,204,130,28,56,199,193,183,186,55,94,131,124,247,233,230,8,232,235,236,16,108,47,3,178,238,67,223,95,
-            230,50,121,70,34,128,135,219,120,170,96,74,229,58,58,68,160,250,95,83,64,42,106,122,180,208,61,68,165,222,166,126,
-            22,84,253,136,231,80,195,108,12,126,138,23,189,121,54,70,165,29,166,178,4,81,139,57,98,159,113,98,83,170,181,195,
-            7,140,0,216,137,110,134,43,7,131,27,69,67,209,66,2,223,159,234,230,54,189,24,28,114,204,130,36,132,47,183,162,214,
-            25,232,121,234,165,120,17,56,148,193,238,216,149,87,86,109,91,207,26,79,28,97,18,62,56,116,142,145,180,25,114,184,
-            110,157,214,175,82,219,170,56,143,39,7,123,229,49,185,138,242,192,133,86,78,200,145,139,235,61,123,97,68,41,105,
-            12,93,54,91,209,115,124,42,26,152,61,128,28,159,151,200,116,127,220,245,125,159,97,204,182,215,203,29,136,156,151,
-            158,49,102,189,149,158,59,163,141,201,176,137,50,22,108,65,61,53,178,23,240,224,180,79,244,60,232,145,106,97,57,
-            189,56,224,171,236,98,223,45,5,179,60,239,211,68,108,26,171,120,200,214,218,139,185,88,145,158,37,254,70,41,147,
-            195,245,9,12,111,6,64,140,93,170,156,45,208,83,151,173,196,162,85,135,146,140,196,173,194,194,144,10,48,167,50,
-            207,146,21,76,5,147,222,186,21,41,168,116,78,154,171,164,150,78,201,176,48,252,64,40,122,92,132,117,51,112,59,131,
-            254,245,176,146,61,238,68,225,34,46,57,84,18,9,179,199,54,95,78,131,168,164,135,237,48,40,61,220,10,164,235,12,
-            167,99,157,201,236,98,115,120,86,130,57,41,29,204,134,142,51,0,212,5,247,208,249,105,122,235,12,239,21,156,187,
-            36,69,183,216,99,178,108,207,86,60,94,151,90,163,212,203,120,108,16,231,168,91,142,216,84,234,15,253,150,209,174,
-            250,31,120,134,230,187,110,146,238,216,253,120,32,62,137,65,162,43,121,25,250,75,218,53,243,160,31,104,146,56,136,
-            68,0,90,69,78,153,127,122,135,78,252,250,73,138,238,176,234,254,138,194,84,116,167,225,39,64,39,132,93,235,192,
-            211,131,237,47,68,156,227,206,50,75,205,81,145,218,218,249,102,246,51,171,83,91,61,50,119,82,56,238,117,196,237,
-            190,251,205,231,59,103,12,158,175,233,44,234,169,84,124,47,117,194,89,192,144,106,95,209,247,4,214,16,22,223,228,
-            44,127,10,241,188,229,119,32,53,28,102,72,16,62,126,156,192,211,83,41,175,30,29,36,71,46,221,108,7,30,74,115,79,
-            144,227,50,3,45,199,51,209,139,22,243,178,71,85,239,26,192,135,205,104,108,77,227,94,230,47,43,142,94,78,143,142,
-            239,154,249,85,51,1,122,186,45,154,229,217,44,255,219,253,43,149,68,19,67,45,94,149,209,99,222,212,226,95,80,64,
-            25,138,19,174,51,58,119,182,137,141,211,62,229,25,127,190,74,11,81,18,214,103,227,168,99,158,250,237,209,93,182,
-            247,187,227,82,221,217,186,40,202,68,154,105,64,38,75,114,228,51,58,189,174,90,223,241,29,38,222,57,96,164,192,
-            34,250,60,122,25,124,241,78,9,255,237,250,125,234,184,119,227,81,215,153,76,92,16,71,172,203,152,62,149,209,13,
-            171,78,209,136,115,13,36,78,66,24,81,184,197,187,32,80,88,127,220,132,120,242,15,179,110,104,183,28,82,208,16,132,
-            208,70,132,212,200,13,51,197,54,52,113,140,140,103,49,105,61,169,237,20,210,68,58,115,168,104,98,239,57,92,120,
-            162,81,156,23,27,116,178,2,224,158,100,161,70,231,86,85,111,172,109,218,185,108,92,153,234,238,85,221,184,157,49,
-            147,209,19,226,134,55,197,98,96,46,231,210,244,71,187,51,122,174,220,20,28,151,122,98,189,210,144,197,104,14,202,
-            19,119,192,169,114,198,210,19,187,96,87,73,213,247,148,253,194,74,131,168,107,25,206,232,136,20,54,206,231,5,206,
-            22,221,87,148,191,115,65,88,244,30,240,108,150,13,45,121,15,248,84,245,45,55,16,105,56,186,233,247,156,73,89,223,
-            174,95,55,161,130,214,194,132,174,206,158,80,87,122,181,155,159,100,176,126,60,133,4,13,72,136,11,48,110,157,192,
-            246,70,172,4,227,120,60,24,104,180,186,227,9,196,126,9,37,72,176,12,88,208,177,24,114,179,88,34,184,73,37,104,27,
-            150,103,122,46,83,229,40,132,246,227,92,232,195,156,163,113,21,103,132,78,218,74,191,0,186,187,39,51,109,192,125,
-            114,86,16,172,191,206,176,99,28,184,126,179,189,157,60,202,146,62,157,183,16,173,242,204,142,175,226,65,29,66,39,
-            252,20,99,49,7,177,254,206,27,233,81,19,189,188,155,92,48,53,213,150,115,42,112,135,190,121,0,76,170,58,186,104,
-            69,240,38,45,39,46,234,16,164,38,42,207,45,72,152,192,242,48,146,56,85,53,21,4,107,46,15,167,102,146,2,116,242,
-            118,5,131,181,204,82,229,194,91,225,101,43,60,154,179,19,212,49,124,235,173,82,84,9,224,248,131,253,163,54,187,
-            147,83,113,70,13,179,189,167,246,100,85,169,161,95,70,29,225,91,211,41,105,165,173,65,143,85,148,192,137,112,71,
-            87,232,142,146,148,239,91,20,195,97,52,8,42,76,182,62,154,121,218,148,174,115,58,227,238,13,158,5,146,191,186,151,
-            211,225,203,247,184,98,151,137,94,202,123,175,29,247,211,254,1,221,155,37,75,73,226,101,124,17,27,34,54,177,80,
-            201,120,80,134,212,47,207,136,95,41,6,76,145,63,51,241,162,208,133,64,51,58,114,42,214,38,92,79,8,26,63,3,132,149,
-            183,35,109,72,95,93,92,243,98,66,158,14,236,40,137,10,124,224,210,73,145,39,226,168,21,132,38,131,212,148,98,95,
-            1,76,39,94,15,211,178,219,25,118,157,193,235,104,89,241,65,76,90,54,101,51,139,85,84,187,12,103,9,143,54,97,252,
-            219,116,113,151,98,190,111,143,156,31,101,150,248,178,3,1,145,243,80,218,137,33,37,211,84,218,68,151,48,242,51,
-            226,60,58,222,105,104,196,5,229,62,34,76,72,162,4,121,226,185,104,107,183,198,112,38,94,108,174,171,245,38,25,8,
-            73,237,163,50,65,44,223,200,235,163,248,214,7,206,206,37,134,111,202,171,158,44,136,240,60,152,51,112,186,211,254,
-            104,88,61,22,230,97,23,147,173,137,73,220,82,66,49,95,125,162,45,36,199,77,113,103,116,220,43,183,245,229,86,175,
-            142,161,155,31,148,167,88,82,75,167,247,180,138,6,17,234,221,245,207,225,91,158,226,209,69,144,24,170,13,131,33,
-            56,255,192,228,37,113,92,214,214,60,29,2,139,137,8,114,149,247,5,161,43,120,168,219,151,214,33,209,155,118,252,
-            102,122,59,40,167,37,148,163,100,16,4,42,87,76,111,211,225,253,247,118,200,148,215,46,161,98,18,0,96,69,137,39,
-            238,54,146,16,77,173,183,44,138,52,255,136,214,166,72,124,17,45,81,102,81,187,10,101,61,252,4,111,40,194,241,31,
-            97,212,169,80,97,228,151,18,241,119,216,93,156,96,77,142,238,43,17,181,118,81,115,79,214,72,60,124,252,241,253,
-            251,247,242,50,145,11,219,181,73,226,194,37,187,250,66,18,129,195,133,85,23,60,54,86,169,186,160,142,233,242,163,
-            42,55,37,152,155,209,67,197,34,190,20,8,38,32,26,230,50,168,231,33,26,116,227,35,159,61,132,220,184,37,140,207,
-            158,233,243,241,39,102,44,23,204,136,122,244,241,165,93,170,29,237,233,51,88,233,79,119,157,97,175,210,241,240,
-            229,47,255,147,75,126,85,177,198,186,55,143,206,229,67,223,1,221,212,121,232,95,119,166,253,225,245,187,61,130,
-            55,216,56,153,216,47,178,157,180,182,88,3,242,192,20,231,96,193,253,38,187,90,67,88,97,134,118,124,162,183,17,2,
-            159,141,71,126,35,248,187,43,116,42,132,182,81,104,217,70,105,24,234,110,207,155,15,86,170,153,12,70,157,222,11,
-            166,161,141,77,0,30,254,74,38,202,230,107,12,202,81,117,240,138,242,56,136,220,25,143,71,227,151,225,246,204,8,
-            159,103,25,232,141,196,199,67,222,135,40,238,60,62,246,135,189,209,227,139,209,241,141,178,9,181,43,32,155,145,
-            77,251,211,129,99,169,248,30,73,91,50,228,116,59,157,14,54,218,241,93,221,131,142,2,3,233,56,195,55,98,197,251,
-            85,200,168,8,135,30,168,27,113,138,200,97,139,193,25,0,35,121,96,42,48,139,254,221,212,189,5,159,190,115,13,81,
-            168,211,117,250,15,205,211,177,235,186,174,23,129,137,245,178,74,174,211,151,15,191,232,25,193,223,242,197,179,
-            106,193,111,118,47,187,29,224,142,251,97,175,243,217,189,234,143,39,83,51,107,200,38,176,118,240,244,100,143,132,
-            8,163,241,129,12,25,192,47,122,18,213,1,117,207,195,169,197,191,67,12,183,163,6,12,183,201,23,194,48,185,25,61,
-            130,41,30,244,1,143,62,39,113,19,46,150,17,157,20,88,38,216,12,183,43,171,28,146,126,236,132,124,87,121,155,104,
-            19,112,240,79,63,67,212,35,229,199,112,132,169,250,137,240,118,16,79,149,7,104,79,2,188,113,8,125,190,224,140,29,
-            137,0,72,52,189,105,193,176,2,110,91,178,19,80,161,16,183,175,196,205,141,152,64,84,216,79,53,250,54,10,77,238,
-            65,173,194,118,131,57,3,177,116,202,211,50,19,149,126,139,241,226,34,240,76,233,66,47,32,191,38,25,86,23,195,100,
-            45,174,54,161,4,33,77,41,175,146,240,76,165,55,140,142,214,216,195,203,105,202,36,107,211,4,157,255,190,135,80,
-            191,47,248,5,136,177,23,19,220,227,69,52,17,165,122,197,13,58,171,132,238,158,91,129,167,94,156,85,50,4,138,96,
-            56,89,218,156,50,173,168,83,44,71,237,61,145,13,73,229,14,239,111,47,157,113,149,98,196,160,162,147,174,122,252,
-            5,143,106,232,74,153,102,54,201,201,6,74,11,247,254,126,114,103,71,223,203,219,124,29,175,169,206,91,110,227,53,
-            135,29,113,21,70,103,224,128,194,25,187,189,209,253,37,240,208,158,115,173,192,85,236,94,135,52,15,250,80,226,58,
-            8,221,168,81,211,25,13,86,78,35,5,182,181,88,90,43,202,169,206,119,99,135,4,166,123,132,81,15,14,225,192,94,185,
-            87,33,41,213,200,123,188,197,172,84,28,135,113,162,6,127,221,186,118,199,162,48,149,224,107,214,117,36,26,67,153,
-            191,12,75,169,230,45,72,42,40,72,99,28,201,120,247,116,167,145,100,182,196,176,124,72,57,121,123,103,85,87,29,90,
-            224,23,193,46,181,23,173,89,54,11,91,102,97,59,148,34,190,239,133,85,39,77,190,22,132,153,173,245,240,255,174,175,
-            182,168,144,163,69,127,202,188,208,60,137,140,107,8,218,11,223,61,186,189,55,201,172,55,156,206,67,180,149,237,
-            128,58,76,140,146,185,225,51,121,127,150,238,86,202,119,113,225,109,133,131,230,21,178,95,227,42,140,120,143,234,
-            144,242,18,48,76,65,131,222,22,5,242,112,46,97,138,59,151,68,191,22,85,219,48,179,197,28,81,125,248,40,187,90,58,
-            145,72,245,128,57,254,227,197,31,79,127,134,255,126,254,203,157,115,93,62,252,91,186,192,199,240,67,188,97,91,170,
-            34,93,101,197,230,193,24,20,99,216,190,132,146,116,91,163,31,77,45,95,220,172,120,168,24,14,54,223,5,182,10,120,
-            99,169,157,137,175,197,244,191,68,105,189,215,31,83,178,29,126,186,163,225,224,115,229,22,46,42,112,6,146,9,66,
-            158,139,230,59,36,57,225,183,229,91,21,188,63,247,220,62,22,86,134,101,111,60,250,87,127,238,201,188,100,46,171,
-            3,162,178,174,189,166,54,144,194,97,171,186,249,228,153,72,234,154,199,96,193,209,40,150,103,58,157,171,189,127,
-            74,251,73,139,27,84,184,187,9,41,250,78,87,253,193,180,238,155,17,4,160,248,57,93,90,32,247,185,233,154,60,5,205,
-            233,245,167,181,211,214,29,157,131,22,146,41,142,29,227,52,229,25,107,145,103,197,204,35,122,235,109,208,235,55,
-            241,201,67,186,250,142,61,193,243,226,88,115,20,200,203,103,103,134,1,202,67,28,235,197,28,28,241,104,71,254,163,
-            101,63,127,207,213,215,42,47,129,243,111,177,211,150,10,211,68,123,27,138,103,168,147,86,217,234,166,130,44,252,
-            82,222,235,74,37,19,21,62,168,178,43,181,99,201,166,146,90,49,85,137,26,25,197,98,153,228,188,50,26,43,22,13,134,
-            90,45,18,216,214,233,192,42,31,106,249,62,219,10,167,170,8,66,127,73,66,36,254,4,27,2,62,243,2,51,186,219,32,171,
-            181,206,52,217,106,84,229,181,203,96,203,71,255,79,12,244,92,46,184,69,108,68,29,55,114,171,182,25,85,88,221,34,
-            139,17,23,214,191,1,34,97,0,58,115,34,248,121,15,10,238,43,14,178,1,2,121,12,124,16,188,35,58,219,68,213,74,12,
-            63,147,77,159,88,108,145,205,165,85,205,67,224,192,132,24,61,2,202,74,95,222,222,149,6,121,182,74,209,32,195,143,
-            159,175,251,87,229,243,69,56,199,231,240,163,217,80,11,53,236,146,21,182,217,105,61,107,89,58,82,122,251,68,173,
-            226,148,209,187,103,229,213,57,212,235,128,182,221,218,126,247,21,44,246,85,215,29,221,57,195,253,235,170,136,200,
-            74,171,230,107,97,47,136,220,128,133,238,36,17,86,155,117,117,155,59,133,194,242,126,4,128,59,233,60,88,255,226,
-            143,252,106,15,101,220,130,51,23,183,182,31,66,137,75,105,64,89,55,103,87,194,59,20,239,148,45,120,120,70,137,73,
-            83,39,211,48,128,183,106,244,204,9,248,201,106,70,173,239,71,173,123,56,66,15,224,166,223,235,149,36,191,209,173,
-            142,130,19,105,155,111,196,54,163,122,203,101,15,53,217,187,89,178,45,123,225,19,153,103,36,211,42,87,242,123,54,
-            167,104,97,190,156,169,57,57,198,212,52,69,167,122,42,47,52,237,122,54,210,152,87,212,131,78,235,225,212,74,230,
-            194,131,169,188,252,40,102,127,202,14,205,236,106,52,232,57,227,227,167,165,149,148,112,12,19,245,71,52,12,145,
-            211,231,121,218,115,19,230,62,77,95,53,133,80,136,82,241,146,121,8,135,224,189,245,47,253,253,219,255,2,173,3,122,
-            14
-        };
-
-    std::string get_bars()
-    {
-        return std::string((const char*) get_data(bars, sizeof(bars), 39184).get(), 39184);
-    }
-    std::string get_boxes()
-    {
-        return std::string((const char*) get_data(boxes, sizeof(boxes), 14336).get(), 14336);
-    }
-    std::string get_buttons()
-    {
-        return std::string((const char*) get_data(buttons, sizeof(buttons), 15325).get(), 15325);
-    }
-    std::string get_containers()
-    {
-        return std::string((const char*) get_data(containers, sizeof(containers), 27443).get(), 27443);
-    }
-    std::string get_data_ctrls()
-    {
-        return std::string((const char*) get_data(data_ctrls, sizeof(data_ctrls), 47178).get(), 47178);
-    }
-    std::string get_forms()
-    {
-        return std::string((const char*) get_data(forms, sizeof(forms), 55979).get(), 55979);
-    }
-    std::string get_interfaces()
-    {
-        return std::string((const char*) get_data(interfaces, sizeof(interfaces), 57278).get(), 57278);
-    }
-    std::string get_mdi()
-    {
-        return std::string((const char*) get_data(mdi, sizeof(mdi), 17170).get(), 17170);
-    }
-    std::string get_pickers()
-    {
-        return std::string((const char*) get_data(pickers, sizeof(pickers), 10219).get(), 10219);
-    }
-    std::string get_project()
-    {
-        return std::string((const char*) get_data(project, sizeof(project), 6107).get(), 6107);
-    }
-    std::string get_sizers()
-    {
-        return std::string((const char*) get_data(sizers, sizeof(sizers), 12871).get(), 12871);
-    }
-    std::string get_text_ctrls()
-    {
-        return std::string((const char*) get_data(text_ctrls, sizeof(text_ctrls), 30396).get(), 30396);
-    }
-    std::string get_widgets()
-    {
-        return std::string((const char*) get_data(widgets, sizeof(widgets), 28672).get(), 28672);
-    }
-}
-
-// ************* End of generated code ***********
-// DO NOT EDIT THIS COMMENT BLOCK!
-//
-// Code below this comment block will be preserved
-// if the code for this class is re-generated.
-//
-// NOLINTEND
-// cppcheck-suppress-end *
-// ***********************************************
-// </auto-generated>
@@ -43,15 +43,23 @@ struct CommandLine
     bool create_ui_zip { false };
     bool build_docs_zip { false };
 
+    // Converts src/xml/*.xml into src/nodes/node_tables.cpp
+    bool node_tables_mode { false };
+    std::string node_tables_path;
+    std::string node_tables_hash;
+
     // Parser / zip-test modes (migrated from wxViewer)
     bool parser_mode { false };
     bool zip_test_mode { false };
     std::string zip_test_path;
+    bool fts_test_mode { false };
+    std::string fts_test_path;
 
     // Parser options
     std::string output_dir;
     bool verbose { false };
     bool no_fts { false };
+    bool zip_only { false };
     std::optional<std::string> single_file;
     std::optional<std::string> zip_path;
 };
@@ -84,14 +92,18 @@ int main(int argc, char* argv[])
                    "  --help, -h             Show this help message\n"
                    "  --parse                Run documentation parser pipeline\n"
                    "  --zip-test <path>      Verify a parser-produced ZIP archive\n"
+                   "  --fts-test <path>      Verify the search index of a parser-produced ZIP\n"
                    "  --srcdir <path>        Root of the source tree (default: .)\n"
                    "  --outdir <path>        Output directory for parser results\n"
                    "  --verbose              Enable verbose parser output\n"
                    "  --no-fts               Skip full-text search indexing\n"
                    "  --single-file <path>   Process only a single file\n"
                    "  --zip-path <path>      Path to an existing zip archive\n"
+                   "  --zip-only             Write parser output only to the --zip-path archive\n"
                    "  --create-ui-zip <path> Compress all XML + SVG files into a zip archive\n"
                    "  --build-docs-zip <path> Build wxWidgets documentation zip\n"
+                   "  --node-tables <path>   Generate node declaration tables from --srcdir XML\n"
+                   "  --xml-hash <sha256>    Hash of the XML files to record in --node-tables\n"
                    "  --docdir <path>        Path to wxViewer/tests docs source\n");
         return std::to_underlying(ExitCode::success);
     }
@@ -101,6 +113,11 @@ int main(int argc, char* argv[])
         return RunZipTest(fs::path(cmd.zip_test_path));
     }
 
+    if (cmd.fts_test_mode)
+    {
+        return RunFtsTest(fs::path(cmd.fts_test_path));
+    }
+
     if (cmd.parser_mode)
     {
         ParseOptions opts;
@@ -108,6 +125,7 @@ int main(int argc, char* argv[])
         opts.output_dir = fs::path(cmd.output_dir);
         opts.verbose = cmd.verbose;
         opts.no_fts = cmd.no_fts;
+        opts.zip_only = cmd.zip_only;
         if (cmd.single_file.has_value())
         {
             opts.single_file = fs::path(cmd.single_file.value());
@@ -119,6 +137,12 @@ int main(int argc, char* argv[])
         return RunParser(opts);
     }
 
+    if (cmd.node_tables_mode)
+    {
+        return RunNodeTables(fs::path(cmd.source_dir.empty() ? "src/xml" : cmd.source_dir),
+                             fs::path(cmd.node_tables_path), cmd.node_tables_hash);
+    }
+
     if (cmd.create_ui_zip)
     {
         return std::to_underlying(create_ui_zip(cmd));
@@ -163,6 +187,29 @@ std::expected<CommandLine, ExitCode> parse_args(std::span<const char* const> arg
             continue;
         }
 
+        if (current_arg == "--node-tables")
+        {
+            if (++i >= args.size())
+            {
+                std::print(stderr, "ERROR: --node-tables requires a path argument\n");
+                return std::unexpected(ExitCode::bad_arg);
+            }
+            cmd.node_tables_mode = true;
+            cmd.node_tables_path = args[i];
+            continue;
+        }
+
+        if (current_arg == "--xml-hash")
+        {
+            if (++i >= args.size())
+            {
+                std::print(stderr, "ERROR: --xml-hash requires a hash argument\n");
+                return std::unexpected(ExitCode::bad_arg);
+            }
+            cmd.node_tables_hash = args[i];
+            continue;
+        }
+
         if (current_arg == "--srcdir")
         {
             if (++i >= args.size())
@@ -215,6 +262,18 @@ std::expected<CommandLine, ExitCode> parse_args(std::span<const char* const> arg
             continue;
         }
 
+        if (current_arg == "--fts-test")
+        {
+            if (++i >= args.size())
+            {
+                std::print(stderr, "ERROR: --fts-test requires a path argument\n");
+                return std::unexpected(ExitCode::bad_arg);
+            }
+            cmd.fts_test_mode = true;
+            cmd.fts_test_path = args[i];
+            continue;
+        }
+
         if (current_arg == "--outdir" || current_arg == "--output-dir")
         {
             if (++i >= args.size())
@@ -238,6 +297,12 @@ std::expected<CommandLine, ExitCode> parse_args(std::span<const char* const> arg
             continue;
         }
 
+        if (current_arg == "--zip-only")
+        {
+            cmd.zip_only = true;
+            continue;
+        }
+
         if (current_arg == "--single-file")
         {
             if (++i >= args.size())
@@ -0,0 +1,996 @@
+/////////////////////////////////////////////////////////////////////////////
+// Purpose:   Convert src/xml/*.xml into constexpr node declaration tables
+// Author:    Ralph Walden
+// Copyright: Copyright (c) 2026 KeyWorks Software (Ralph Walden)
+// License:   Apache License -- see ../../LICENSE
+/////////////////////////////////////////////////////////////////////////////
+
+// The output is src/nodes/node_tables.cpp -- see src/nodes/node_tables.h for a description of
+// the tables.
+//
+// The XML files are simple enough (elements, attributes, text, comments and the standard
+// entities) that they are read with the small parser below rather than pulling pugixml (which
+// depends on wxWidgets in this repository) into build_resources. The parser follows pugixml's
+// default parse options so that the tables contain exactly what NodeCreator used to get from
+// pugixml: whitespace-only text is dropped, line endings are normalized, and tabs and line
+// endings in attribute values are converted to spaces.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <print>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils.h"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // The order matters: interfaces must be first, and the rest must match the order the
+    // declarations were created in before the tables existed. CheckXmlFiles() fails if src/xml
+    // contains a file that isn't listed here or in ignored_xml_files.
+    constexpr auto xml_files = std::to_array<std::string_view>({
+        "interfaces.xml",
+        "bars.xml",
+        "boxes.xml",
+        "buttons.xml",
+        "containers.xml",
+        "data_ctrls.xml",
+        "forms.xml",
+        "mdi.xml",
+        "pickers.xml",
+        "project.xml",
+        "sizers.xml",
+        "text_ctrls.xml",
+        "widgets.xml",
+    });
+
+    // XML files in src/xml that don't contain generator declarations
+    constexpr auto ignored_xml_files = std::to_array<std::string_view>({
+        "tips.xml",
+    });
+
+    constexpr std::uint16_t no_index = UINT16_MAX;
+
+    // ###########################################################################
+    //  Minimal XML reader
+    // ###########################################################################
+
+    struct XmlNode
+    {
+        std::string name;  // empty for a text node
+        std::string text;
+        std::vector<std::pair<std::string, std::string>> attributes;
+        std::vector<XmlNode> children;
+
+        [[nodiscard]] auto attribute(std::string_view attr_name) const -> const std::string*
+        {
+            for (const auto& [key, value]: attributes)
+            {
+                if (key == attr_name)
+                {
+                    return &value;
+                }
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] auto attr(std::string_view attr_name, std::string_view def = {}) const
+            -> std::string_view
+        {
+            const auto* value = attribute(attr_name);
+            return value ? std::string_view(*value) : def;
+        }
+
+        // Same as pugi::xml_node::text() -- a text node returns itself, an element returns its
+        // first text child.
+        [[nodiscard]] auto get_text() const -> std::string_view
+        {
+            if (name.empty())
+            {
+                return text;
+            }
+            for (const auto& child: children)
+            {
+                if (child.name.empty())
+                {
+                    return child.text;
+                }
+            }
+            return {};
+        }
+    };
+
+    class XmlReader
+    {
+    public:
+        XmlReader(std::string_view xml, std::string_view file_name) :
+            m_xml(xml), m_file_name(file_name)
+        {
+        }
+
+        auto ParseDocument() -> XmlNode
+        {
+            XmlNode document;
+            ParseContent(document, {});
+            return document;
+        }
+
+    private:
+        [[noreturn]] void Fail(std::string_view msg) const
+        {
+            size_t line = 1;
+            for (size_t idx = 0; idx < m_pos && idx < m_xml.size(); ++idx)
+            {
+                line += (m_xml[idx] == '\n') ? 1 : 0;
+            }
+            throw std::runtime_error(std::string(m_file_name) + "(" + std::to_string(line) +
+                                     "): " + std::string(msg));
+        }
+
+        [[nodiscard]] auto StartsWith(std::string_view str) const -> bool
+        {
+            return m_xml.substr(m_pos).starts_with(str);
+        }
+
+        void SkipPast(std::string_view str)
+        {
+            auto end = m_xml.find(str, m_pos);
+            if (end == std::string_view::npos)
+            {
+                Fail(std::string("missing ") + std::string(str));
+            }
+            m_pos = end + str.size();
+        }
+
+        void SkipSpace()
+        {
+            while (m_pos < m_xml.size() && IsSpace(m_xml[m_pos]))
+            {
+                ++m_pos;
+            }
+        }
+
+        static auto IsSpace(char chr) -> bool
+        {
+            return chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r';
+        }
+
+        static auto IsNameChar(char chr) -> bool
+        {
+            return !IsSpace(chr) && chr != '=' && chr != '>' && chr != '/' && chr != '<' &&
+                   chr != '"' && chr != '\'';
+        }
+
+        auto ParseName() -> std::string
+        {
+            const auto start = m_pos;
+            while (m_pos < m_xml.size() && IsNameChar(m_xml[m_pos]))
+            {
+                ++m_pos;
+            }
+            if (start == m_pos)
+            {
+                Fail("expected a name");
+            }
+            return std::string(m_xml.substr(start, m_pos - start));
+        }
+
+        // Decodes the entity starting at m_pos (which points to the '&')
+        void DecodeEntity(std::string& result)
+        {
+            auto end = m_xml.find(';', m_pos);
+            if (end == std::string_view::npos || end - m_pos > 10)
+            {
+                // pugixml leaves an unrecognized entity as-is
+                result += '&';
+                ++m_pos;
+                return;
+            }
+            auto entity = m_xml.substr(m_pos + 1, end - m_pos - 1);
+            if (entity == "lt")
+            {
+                result += '<';
+            }
+            else if (entity == "gt")
+            {
+                result += '>';
+            }
+            else if (entity == "amp")
+            {
+                result += '&';
+            }
+            else if (entity == "quot")
+            {
+                result += '"';
+            }
+            else if (entity == "apos")
+            {
+                result += '\'';
+            }
+            else if (entity.starts_with('#'))
+            {
+                const bool is_hex = entity.size() > 1 && (entity[1] == 'x' || entity[1] == 'X');
+                const auto digits = entity.substr(is_hex ? 2 : 1);
+                std::uint32_t code = 0;
+                for (auto chr: digits)
+                {
+                    code = code * (is_hex ? 16 : 10) +
+                           static_cast<std::uint32_t>(
+                               (chr >= '0' && chr <= '9') ? chr - '0' :
+                               (chr >= 'a' && chr <= 'f') ? chr - 'a' + 10 :
+                                                            chr - 'A' + 10);
+                }
+                AppendUtf8(result, code);
+            }
+            else
+            {
+                result += '&';
+                ++m_pos;
+                return;
+            }
+            m_pos = end + 1;
+        }
+
+        static void AppendUtf8(std::string& result, std::uint32_t code)
+        {
+            if (code < 0x80)
+            {
+                result += static_cast<char>(code);
+            }
+            else if (code < 0x800)
+            {
+                result += static_cast<char>(0xC0 | (code >> 6));
+                result += static_cast<char>(0x80 | (code & 0x3F));
+            }
+            else if (code < 0x10000)
+            {
+                result += static_cast<char>(0xE0 | (code >> 12));
+                result += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                result += static_cast<char>(0x80 | (code & 0x3F));
+            }
+            else
+            {
+                result += static_cast<char>(0xF0 | (code >> 18));
+                result += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                result += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                result += static_cast<char>(0x80 | (code & 0x3F));
+            }
+        }
+
+        auto ParseAttributeValue() -> std::string
+        {
+            const char quote = m_xml[m_pos++];
+            std::string value;
+            while (m_pos < m_xml.size() && m_xml[m_pos] != quote)
+            {
+                const char chr = m_xml[m_pos];
+                if (chr == '&')
+                {
+                    DecodeEntity(value);
+                    continue;
+                }
+                if (chr == '\r' && m_pos + 1 < m_xml.size() && m_xml[m_pos + 1] == '\n')
+                {
+                    ++m_pos;
+                }
+                value += (chr == '\r' || chr == '\n' || chr == '\t') ? ' ' : chr;
+                ++m_pos;
+            }
+            if (m_pos >= m_xml.size())
+            {
+                Fail("unterminated attribute value");
+            }
+            ++m_pos;  // closing quote
+            return value;
+        }
+
+        void AddText(XmlNode& parent, std::string& text)
+        {
+            if (text.find_first_not_of(" \t\n\r") != std::string::npos)
+            {
+                auto& node = parent.children.emplace_back();
+                node.text = std::move(text);
+            }
+            text.clear();
+        }
+
+        // Parses children until the end tag of parent (or the end of the document if
+        // parent_name is empty).
+        void ParseContent(XmlNode& parent, std::string_view parent_name)
+        {
+            std::string text;
+            while (m_pos < m_xml.size())
+            {
+                const char chr = m_xml[m_pos];
+                if (chr != '<')
+                {
+                    if (chr == '&')
+                    {
+                        DecodeEntity(text);
+                        continue;
+                    }
+                    if (chr == '\r')
+                    {
+                        text += '\n';
+                        if (m_pos + 1 < m_xml.size() && m_xml[m_pos + 1] == '\n')
+                        {
+                            ++m_pos;
+                        }
+                    }
+                    else
+                    {
+                        text += chr;
+                    }
+                    ++m_pos;
+                    continue;
+                }
+
+                if (StartsWith("<!--"))
+                {
+                    AddText(parent, text);
+                    SkipPast("-->");
+                }
+                else if (StartsWith("<![CDATA["))
+                {
+                    m_pos += sizeof("<![CDATA[") - 1;
+                    const auto end = m_xml.find("]]>", m_pos);
+                    if (end == std::string_view::npos)
+                    {
+                        Fail("unterminated CDATA section");
+                    }
+                    text += m_xml.substr(m_pos, end - m_pos);
+                    m_pos = end + 3;
+                }
+                else if (StartsWith("<?") || StartsWith("<!"))
+                {
+                    SkipPast(">");
+                }
+                else if (StartsWith("</"))
+                {
+                    AddText(parent, text);
+                    m_pos += 2;
+                    if (auto name = ParseName(); name != parent_name)
+                    {
+                        Fail("mismatched end tag </" + name + ">");
+                    }
+                    SkipSpace();
+                    SkipPast(">");
+                    return;
+                }
+                else
+                {
+                    AddText(parent, text);
+                    ++m_pos;
+                    ParseElement(parent.children.emplace_back());
+                }
+            }
+
+            if (!parent_name.empty())
+            {
+                Fail("missing end tag for <" + std::string(parent_name) + ">");
+            }
+            AddText(parent, text);
+        }
+
+        void ParseElement(XmlNode& element)
+        {
+            element.name = ParseName();
+            for (;;)
+            {
+                SkipSpace();
+                if (m_pos >= m_xml.size())
+                {
+                    Fail("unterminated element");
+                }
+                if (StartsWith("/>"))
+                {
+                    m_pos += 2;
+                    return;
+                }
+                if (m_xml[m_pos] == '>')
+                {
+                    ++m_pos;
+                    ParseContent(element, element.name);
+                    return;
+                }
+
+                auto attr_name = ParseName();
+                SkipSpace();
+                if (m_pos >= m_xml.size() || m_xml[m_pos] != '=')
+                {
+                    Fail("expected '=' after " + attr_name);
+                }
+                ++m_pos;
+                SkipSpace();
+                if (m_pos >= m_xml.size() || (m_xml[m_pos] != '"' && m_xml[m_pos] != '\''))
+                {
+                    Fail("expected a quoted value for " + attr_name);
+                }
+                element.attributes.emplace_back(std::move(attr_name), ParseAttributeValue());
+            }
+        }
+
+        std::string_view m_xml;
+        std::string_view m_file_name;
+        size_t m_pos { 0 };
+    };
+
+    // ###########################################################################
+    //  Table builder
+    // ###########################################################################
+
+    struct Category
+    {
+        std::string name;
+        std::string base_name;
+        std::uint16_t base_category { no_index };
+        std::uint16_t first_category { 0 };
+        std::uint16_t category_count { 0 };
+        std::uint16_t first_property { 0 };
+        std::uint16_t property_count { 0 };
+        std::uint16_t first_event { 0 };
+        std::uint16_t event_count { 0 };
+    };
+
+    struct Property
+    {
+        std::string name;
+        std::string type;
+        std::string def_value;
+        std::string help;
+        bool hide { false };
+        std::uint16_t first_option { 0 };
+        std::uint16_t option_count { 0 };
+    };
+
+    struct Generator
+    {
+        std::string class_name;
+        std::string type;
+        std::string image;
+        std::string flags;
+        bool internal { false };
+        std::uint16_t category { 0 };
+        std::uint16_t first_inherit { 0 };
+        std::uint16_t inherit_count { 0 };
+    };
+
+    struct Inherit
+    {
+        std::string class_name;
+        std::uint16_t first_override { 0 };
+        std::uint16_t override_count { 0 };
+        std::uint16_t first_hide { 0 };
+        std::uint16_t hide_count { 0 };
+    };
+
+    struct File
+    {
+        std::string name;
+        bool is_interface { false };
+        std::uint16_t first_generator { 0 };
+        std::uint16_t generator_count { 0 };
+    };
+
+    struct Tables
+    {
+        std::vector<File> files;
+        std::vector<Generator> generators;
+        std::vector<Category> categories;
+        std::vector<Property> properties;
+        std::vector<std::pair<std::string, std::string>> options;
+        std::vector<std::array<std::string, 3>> events;
+        std::vector<Inherit> inherits;
+        std::vector<std::pair<std::string, std::string>> overrides;
+        std::vector<std::string> hidden;
+
+        // Root category of every interface, used to resolve base_name
+        std::map<std::string, std::uint16_t, std::less<>> interface_categories;
+    };
+
+    auto ToIndex(size_t index) -> std::uint16_t
+    {
+        if (index >= no_index)
+        {
+            throw std::runtime_error("Too many entries for a std::uint16_t index");
+        }
+        return static_cast<std::uint16_t>(index);
+    }
+
+    auto StripPrefix(std::string_view value, std::string_view prefix) -> std::string
+    {
+        if (value.starts_with(prefix))
+        {
+            value.remove_prefix(prefix.size());
+        }
+        return std::string(value);
+    }
+
+    // Matches wxString::Trim(false) followed by wxString::Trim()
+    auto TrimSpace(std::string_view value) -> std::string
+    {
+        constexpr std::string_view spaces(" \t\n\v\f\r");
+        const auto start = value.find_first_not_of(spaces);
+        if (start == std::string_view::npos)
+        {
+            return {};
+        }
+        const auto end = value.find_last_not_of(spaces);
+        return std::string(value.substr(start, end - start + 1));
+    }
+
+    void AddProperty(Tables& tables, const XmlNode& elem_prop)
+    {
+        Property prop;
+        prop.name = StripPrefix(elem_prop.attr("name"), "prop_");
+        prop.type = StripPrefix(elem_prop.attr("type"), "type_");
+        prop.help = elem_prop.attr("help");
+
+        // Same as pugi::xml_attribute::as_bool()
+        const auto hide = elem_prop.attr("hide");
+        prop.hide = !hide.empty() && std::string_view("1tTyY").contains(hide[0]);
+
+        if (!elem_prop.children.empty())
+        {
+            if (auto def_value = elem_prop.children.back().get_text(); !def_value.empty())
+            {
+                prop.def_value = def_value.contains('\n') ? TrimSpace(def_value) :
+                                                            std::string(def_value);
+            }
+        }
+
+        if (prop.type == "bitlist" || prop.type == "option" || prop.type == "editoption")
+        {
+            prop.first_option = ToIndex(tables.options.size());
+            for (const auto& child: elem_prop.children)
+            {
+                if (child.name == "option")
+                {
+                    tables.options.emplace_back(child.attr("name"), child.attr("help"));
+                }
+            }
+            prop.option_count = ToIndex(tables.options.size() - prop.first_option);
+        }
+
+        tables.properties.push_back(std::move(prop));
+    }
+
+    void FillCategory(Tables& tables, std::uint16_t index, const XmlNode& element)
+    {
+        std::vector<const XmlNode*> child_categories;
+        for (const auto& child: element.children)
+        {
+            if (child.name == "category")
+            {
+                child_categories.push_back(&child);
+            }
+        }
+
+        // Reserve the child categories first so that they are contiguous
+        const auto first_category = ToIndex(tables.categories.size());
+        for (const auto* child: child_categories)
+        {
+            auto& category = tables.categories.emplace_back();
+            category.name = child->attr("name");
+            category.base_name = child->attr("base_name");
+        }
+
+        const auto first_property = ToIndex(tables.properties.size());
+        for (const auto& child: element.children)
+        {
+            if (child.name == "property")
+            {
+                AddProperty(tables, child);
+            }
+        }
+
+        const auto first_event = ToIndex(tables.events.size());
+        for (const auto& child: element.children)
+        {
+            if (child.name == "event")
+            {
+                tables.events.push_back({ std::string(child.attr("name")),
+                                          std::string(child.attr("class", "wxEvent")),
+                                          std::string(child.attr("help")) });
+            }
+        }
+
+        auto& category = tables.categories.at(index);
+        category.first_category = first_category;
+        category.category_count = ToIndex(child_categories.size());
+        category.first_property = first_property;
+        category.property_count = ToIndex(tables.properties.size() - first_property);
+        category.first_event = first_event;
+        category.event_count = ToIndex(tables.events.size() - first_event);
+
+        for (size_t idx = 0; idx < child_categories.size(); ++idx)
+        {
+            FillCategory(tables, ToIndex(first_category + idx), *child_categories[idx]);
+        }
+    }
+
+    void AddInherits(Tables& tables, Generator& generator, const XmlNode& elem_gen)
+    {
+        generator.first_inherit = ToIndex(tables.inherits.size());
+        for (const auto& elem_base: elem_gen.children)
+        {
+            if (elem_base.name != "inherits")
+            {
+                continue;
+            }
+            Inherit inherit;
+            inherit.class_name = elem_base.attr("class");
+            inherit.first_override = ToIndex(tables.overrides.size());
+            inherit.first_hide = ToIndex(tables.hidden.size());
+            for (const auto& child: elem_base.children)
+            {
+                if (child.name == "property")
+                {
+                    tables.overrides.emplace_back(child.attr("name"), child.get_text());
+                }
+                else if (child.name == "hide")
+                {
+                    tables.hidden.emplace_back(child.attr("name"));
+                }
+            }
+            inherit.override_count = ToIndex(tables.overrides.size() - inherit.first_override);
+            inherit.hide_count = ToIndex(tables.hidden.size() - inherit.first_hide);
+            tables.inherits.push_back(std::move(inherit));
+        }
+        generator.inherit_count = ToIndex(tables.inherits.size() - generator.first_inherit);
+    }
+
+    void AddFile(Tables& tables, std::string_view file_name, const XmlNode& document)
+    {
+        const XmlNode* root = nullptr;
+        for (const auto& child: document.children)
+        {
+            if (child.name == "GeneratorDefinitions")
+            {
+                root = &child;
+                break;
+            }
+        }
+        if (!root)
+        {
+            throw std::runtime_error(std::string(file_name) +
+                                     ": GeneratorDefinitions not found");
+        }
+
+        File file;
+        file.name = file_name;
+        file.is_interface = (file_name == "interfaces.xml");
+        file.first_generator = ToIndex(tables.generators.size());
+
+        for (const auto& elem_gen: root->children)
+        {
+            if (elem_gen.name != "gen")
+            {
+                continue;
+            }
+
+            Generator generator;
+            generator.class_name = StripPrefix(elem_gen.attr("class"), "gen_");
+            generator.type = elem_gen.attr("type");
+            generator.image = elem_gen.attr("image");
+            generator.flags = elem_gen.attr("flags");
+            generator.internal = (elem_gen.attr("enable") == "internal");
+
+            generator.category = ToIndex(tables.categories.size());
+            tables.categories.emplace_back();
+            FillCategory(tables, generator.category, elem_gen);
+
+            // Interfaces never inherit anything
+            if (!file.is_interface)
+            {
+                AddInherits(tables, generator, elem_gen);
+            }
+            else
+            {
+                generator.first_inherit = ToIndex(tables.inherits.size());
+                tables.interface_categories[generator.class_name] = generator.category;
+            }
+
+            tables.generators.push_back(std::move(generator));
+        }
+
+        file.generator_count = ToIndex(tables.generators.size() - file.first_generator);
+        tables.files.push_back(std::move(file));
+    }
+
+    void ResolveBaseNames(Tables& tables)
+    {
+        for (auto& category: tables.categories)
+        {
+            if (category.base_name.empty())
+            {
+                continue;
+            }
+            auto result = tables.interface_categories.find(category.base_name);
+            if (result == tables.interface_categories.end())
+            {
+                throw std::runtime_error("Unknown category base_name: " + category.base_name);
+            }
+            category.base_category = result->second;
+        }
+    }
+
+    // ###########################################################################
+    //  Output
+    // ###########################################################################
+
+    auto Quote(std::string_view value) -> std::string
+    {
+        std::string result("\"");
+        for (auto chr: value)
+        {
+            switch (chr)
+            {
+                case '\\':
+                    result += "\\\\";
+                    break;
+                case '"':
+                    result += "\\\"";
+                    break;
+                case '\n':
+                    result += "\\n";
+                    break;
+                case '\t':
+                    result += "\\t";
+                    break;
+                case '\r':
+                    result += "\\r";
+                    break;
+                default:
+                    if (const auto byte = static_cast<unsigned char>(chr); byte < 0x20 || byte > 0x7E)
+                    {
+                        // Octal escapes never consume more than three digits
+                        constexpr std::string_view digits("01234567");
+                        result += '\\';
+                        result += digits[(byte >> 6) & 7];
+                        result += digits[(byte >> 3) & 7];
+                        result += digits[byte & 7];
+                    }
+                    else
+                    {
+                        result += chr;
+                    }
+                    break;
+            }
+        }
+        result += '"';
+        return result;
+    }
+
+    auto Bool(bool value) -> std::string_view
+    {
+        return value ? "true" : "false";
+    }
+
+    template <typename T, typename F>
+    void WriteTable(std::ostringstream& out, std::string_view type, std::string_view name,
+                    const std::vector<T>& table, F write_entry)
+    {
+        out << "    constexpr " << type << " s_" << name << "[] = {\n";
+        if (table.empty())
+        {
+            // A zero-length array isn't allowed
+            out << "        {},\n";
+        }
+        for (const auto& entry: table)
+        {
+            out << "        { ";
+            write_entry(entry);
+            out << " },\n";
+        }
+        out << "    };\n\n";
+    }
+
+    auto GenerateSource(const Tables& tables, std::string_view xml_hash) -> std::string
+    {
+        std::ostringstream out;
+        out << "///////////////////////////////////////////////////////////////////////////////\n"
+               "// <auto-generated>\n"
+               "// Generated by build_resources --node-tables from the XML files in src/xml/\n";
+        if (!xml_hash.empty())
+        {
+            // cmake/build_node_tables.cmake compares this with the current XML files
+            out << "// xml-sha256: " << xml_hash << '\n';
+        }
+        out << "//\n"
+               "// DO NOT EDIT THIS FILE! Change the XML files and re-run CMake instead.\n"
+               "// </auto-generated>\n"
+               "///////////////////////////////////////////////////////////////////////////////\n"
+               "\n"
+               "// clang-format off\n"
+               "// NOLINTBEGIN\n"
+               "// cppcheck-suppress-begin *\n"
+               "\n"
+               "#include \"node_tables.h\"\n"
+               "\n"
+               "using namespace node_tables;\n"
+               "\n"
+               "namespace\n"
+               "{\n";
+
+        WriteTable(out, "File", "files", tables.files,
+                   [&](const File& file)
+                   {
+                       out << Quote(file.name) << ", " << Bool(file.is_interface) << ", "
+                           << file.first_generator << ", " << file.generator_count;
+                   });
+        WriteTable(out, "Generator", "generators", tables.generators,
+                   [&](const Generator& gen)
+                   {
+                       out << Quote(gen.class_name) << ", " << Quote(gen.type) << ", "
+                           << Quote(gen.image) << ", " << Quote(gen.flags) << ", "
+                           << Bool(gen.internal) << ", " << gen.category << ", "
+                           << gen.first_inherit << ", " << gen.inherit_count;
+                   });
+        WriteTable(out, "Category", "categories", tables.categories,
+                   [&](const Category& cat)
+                   {
+                       out << Quote(cat.name) << ", ";
+                       if (cat.base_category == no_index)
+                       {
+                           out << "no_index, ";
+                       }
+                       else
+                       {
+                           out << cat.base_category << ", ";
+                       }
+                       out << cat.first_category << ", " << cat.category_count << ", "
+                           << cat.first_property << ", " << cat.property_count << ", "
+                           << cat.first_event << ", " << cat.event_count;
+                   });
+        WriteTable(out, "Property", "properties", tables.properties,
+                   [&](const Property& prop)
+                   {
+                       out << Quote(prop.name) << ", " << Quote(prop.type) << ", "
+                           << Quote(prop.def_value) << ", " << Quote(prop.help) << ", "
+                           << Bool(prop.hide) << ", " << prop.first_option << ", "
+                           << prop.option_count;
+                   });
+        WriteTable(out, "Option", "options", tables.options,
+                   [&](const std::pair<std::string, std::string>& opt)
+                   {
+                       out << Quote(opt.first) << ", " << Quote(opt.second);
+                   });
+        WriteTable(out, "Event", "events", tables.events,
+                   [&](const std::array<std::string, 3>& event)
+                   {
+                       out << Quote(event[0]) << ", " << Quote(event[1]) << ", "
+                           << Quote(event[2]);
+                   });
+        WriteTable(out, "Inherit", "inherits", tables.inherits,
+                   [&](const Inherit& inherit)
+                   {
+                       out << Quote(inherit.class_name) << ", " << inherit.first_override
+                           << ", " << inherit.override_count << ", " << inherit.first_hide
+                           << ", " << inherit.hide_count;
+                   });
+        WriteTable(out, "Override", "overrides", tables.overrides,
+                   [&](const std::pair<std::string, std::string>& override_value)
+                   {
+                       out << Quote(override_value.first) << ", "
+                           << Quote(override_value.second);
+                   });
+
+        out << "    constexpr std::string_view s_hidden[] = {\n";
+        if (tables.hidden.empty())
+        {
+            out << "        {},\n";
+        }
+        for (const auto& name: tables.hidden)
+        {
+            out << "        " << Quote(name) << ",\n";
+        }
+        out << "    };\n"
+               "}  // namespace\n"
+               "\n";
+
+        // An empty table is written with a single placeholder entry, so the spans use the real
+        // sizes rather than the array sizes.
+        auto write_span = [&](std::string_view type, std::string_view name, size_t size)
+        {
+            out << "const std::span<const " << type << "> node_tables::" << name << " { s_"
+                << name << ", " << size << " };\n";
+        };
+        write_span("File", "files", tables.files.size());
+        write_span("Generator", "generators", tables.generators.size());
+        write_span("Category", "categories", tables.categories.size());
+        write_span("Property", "properties", tables.properties.size());
+        write_span("Option", "options", tables.options.size());
+        write_span("Event", "events", tables.events.size());
+        write_span("Inherit", "inherits", tables.inherits.size());
+        write_span("Override", "overrides", tables.overrides.size());
+        write_span("std::string_view", "hidden", tables.hidden.size());
+
+        out << "\n"
+               "// cppcheck-suppress-end *\n"
+               "// NOLINTEND\n";
+        return out.str();
+    }
+
+    auto ReadFile(const fs::path& path) -> std::string
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            throw std::runtime_error("Unable to open " + path.string());
+        }
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+
+    // Throws if xml_dir contains an XML file that neither xml_files nor ignored_xml_files lists,
+    // since it would otherwise be silently left out of the tables.
+    void CheckXmlFiles(const fs::path& xml_dir)
+    {
+        for (const auto& entry: fs::directory_iterator(xml_dir))
+        {
+            const auto file_name = entry.path().filename().string();
+            if (entry.is_regular_file() && entry.path().extension() == ".xml" &&
+                std::ranges::find(xml_files, file_name) == xml_files.end() &&
+                std::ranges::find(ignored_xml_files, file_name) == ignored_xml_files.end())
+            {
+                throw std::runtime_error(file_name +
+                                         " is not listed in xml_files in "
+                                         "tools/build_resources/node_tables.cpp");
+            }
+        }
+    }
+}  // namespace
+
+int RunNodeTables(const fs::path& xml_dir, const fs::path& output_file,
+                  std::string_view xml_hash)
+{
+    try
+    {
+        CheckXmlFiles(xml_dir);
+
+        Tables tables;
+        for (auto file_name: xml_files)
+        {
+            const auto xml = ReadFile(xml_dir / file_name);
+            XmlReader reader(xml, file_name);
+            AddFile(tables, file_name, reader.ParseDocument());
+        }
+        ResolveBaseNames(tables);
+
+        const auto source = GenerateSource(tables, xml_hash);
+
+        // Only write the file if it changed so that the build doesn't recompile it needlessly
+        if (fs::exists(output_file) && ReadFile(output_file) == source)
+        {
+            std::print("{} is up to date\n", output_file.string());
+            return 0;
+        }
+
+        std::ofstream file(output_file, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            std::print(stderr, "ERROR: unable to create {}\n", output_file.string());
+            return 1;
+        }
+        file << source;
+        std::print("Wrote {} ({} generators, {} properties, {} events)\n", output_file.string(),
+                   tables.generators.size(), tables.properties.size(), tables.events.size());
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::print(stderr, "ERROR: {}\n", error.what());
+        return 1;
+    }
+}
@@ -21,6 +21,9 @@ struct ParseOptions
     std::filesystem::path output_dir;
     bool verbose { false };
     bool no_fts { false };
+    // Only package the generated files into zip_path (which must be set) instead of
+    // also writing them to output_dir.
+    bool zip_only { false };
     std::optional<std::filesystem::path> single_file;
     std::optional<std::filesystem::path> zip_path;
 };
@@ -29,10 +32,23 @@ struct ParseOptions
 // FTS indexing, optional ZIP packaging).  Returns 0 on success, 1 on error.
 [[nodiscard]] int RunParser(const ParseOptions& opts);
 
+// Convert the generator declarations in xml_dir (src/xml) into the constexpr tables that
+// NodeCreator::Initialize() reads (src/nodes/node_tables.cpp). xml_hash is recorded in the
+// output so that CMake can tell whether the XML files changed. The output file is only
+// rewritten if its contents changed.  Returns 0 on success, 1 on error.
+[[nodiscard]] int RunNodeTables(const std::filesystem::path& xml_dir,
+                                const std::filesystem::path& output_file,
+                                std::string_view xml_hash);
+
 // Open a parser-produced ZIP archive and verify that every entry can be
 // extracted.  Prints per-entry results to stdout.  Returns 0 on success.
 [[nodiscard]] int RunZipTest(const std::filesystem::path& zip_path);
 
+// Rebuild the search index of a parser-produced ZIP archive from its markdown,
+// serially and from several shards, and verify that every build is
+// byte-identical to the archived index.  Returns 0 on success.
+[[nodiscard]] int RunFtsTest(const std::filesystem::path& zip_path);
+
 // ---------------------------------------------------------------------------
 //  Documentation archive reader (parser module)
 // ---------------------------------------------------------------------------